@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GenerateGitHashMmg"
+  "src/common/git_log_mmg.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/GenerateGitHashMmg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
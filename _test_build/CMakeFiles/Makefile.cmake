@@ -0,0 +1,223 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/config/CTestCustom.cmake"
+  "/root/repo/cmake/config/mmgConfig.cmake.in"
+  "/root/repo/cmake/modules/FindElas.cmake"
+  "/root/repo/cmake/modules/FindSCOTCH.cmake"
+  "/root/repo/cmake/modules/add-mmg-options.cmake"
+  "/root/repo/cmake/modules/add_build_types.cmake"
+  "/root/repo/cmake/modules/build-targets.cmake"
+  "/root/repo/cmake/modules/doxygen.cmake"
+  "/root/repo/cmake/modules/macros.cmake"
+  "/root/repo/cmake/modules/mmg.cmake"
+  "/root/repo/cmake/modules/mmg2d.cmake"
+  "/root/repo/cmake/modules/mmg3d.cmake"
+  "/root/repo/cmake/modules/mmgcommon.cmake"
+  "/root/repo/cmake/modules/mmgs.cmake"
+  "/root/repo/cmake/modules/optional-dependencies.cmake"
+  "/root/repo/cmake/modules/packages.cmake"
+  "/root/repo/cmake/testing/libmmg2d_tests.cmake"
+  "/root/repo/cmake/testing/libmmg3d_tests.cmake"
+  "/root/repo/cmake/testing/libmmg_tests.cmake"
+  "/root/repo/cmake/testing/libmmgs_tests.cmake"
+  "/root/repo/src/common/mmgcmakedefines.h.in"
+  "/root/repo/src/common/mmgcmakedefinesf.h.in"
+  "/root/repo/src/common/mmgversion.h.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMsys.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPerl.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "src/common/mmgcmakedefines.h"
+  "src/common/mmgcmakedefinesf.h"
+  "src/common/mmgversion.h"
+  "mmgConfig.cmake"
+  "CTestCustom.cmake"
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/GenerateGitHashMmg.dir/DependInfo.cmake"
+  "CMakeFiles/genheader.dir/DependInfo.cmake"
+  "CMakeFiles/mmg_fortran_header.dir/DependInfo.cmake"
+  "CMakeFiles/mmgmmgcommon_libmmgtypes_header.dir/DependInfo.cmake"
+  "CMakeFiles/copymmgcommon_libmmgtypes.dir/DependInfo.cmake"
+  "CMakeFiles/mmgmmgcommon_mmgcmakedefines_header.dir/DependInfo.cmake"
+  "CMakeFiles/copymmgcommon_mmgcmakedefines.dir/DependInfo.cmake"
+  "CMakeFiles/mmgmmgcommon_mmg_export_header.dir/DependInfo.cmake"
+  "CMakeFiles/copymmgcommon_mmg_export.dir/DependInfo.cmake"
+  "CMakeFiles/copymmgcommon_mmgcmakedefinesf.dir/DependInfo.cmake"
+  "CMakeFiles/mmgmmgcommon_mmgversion_header.dir/DependInfo.cmake"
+  "CMakeFiles/copymmgcommon_mmgversion.dir/DependInfo.cmake"
+  "CMakeFiles/copymmgcommon_libmmgtypesf.dir/DependInfo.cmake"
+  "CMakeFiles/copymmgcommon_mmggithash.dir/DependInfo.cmake"
+  "CMakeFiles/copy_mmgcommon_headers.dir/DependInfo.cmake"
+  "CMakeFiles/mmg2d_fortran_header.dir/DependInfo.cmake"
+  "CMakeFiles/mmg2d_libmmg2d_header.dir/DependInfo.cmake"
+  "CMakeFiles/copy2d_libmmg2d.dir/DependInfo.cmake"
+  "CMakeFiles/mmg2d_mmg2d_export_header.dir/DependInfo.cmake"
+  "CMakeFiles/copy2d_mmg2d_export.dir/DependInfo.cmake"
+  "CMakeFiles/copy_libmmg2df.dir/DependInfo.cmake"
+  "CMakeFiles/copy_2d_headers.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_a.dir/DependInfo.cmake"
+  "CMakeFiles/mmg2d.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_adp_example0_a.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_adp_example0_b.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_adp_example1.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_adp_example2.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_gene_example0.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_ls_example0.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_lsOnly.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_lsOnly_optim.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_lsOnly_hsiz.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_lsAndMetric_optim.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_lsAndMetric_hsiz.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg2d_lsAndMetric.dir/DependInfo.cmake"
+  "CMakeFiles/test_met2d.dir/DependInfo.cmake"
+  "CMakeFiles/mmgs_fortran_header.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_a.dir/DependInfo.cmake"
+  "CMakeFiles/mmgs_libmmgs_header.dir/DependInfo.cmake"
+  "CMakeFiles/copys_libmmgs.dir/DependInfo.cmake"
+  "CMakeFiles/mmgs_mmgs_export_header.dir/DependInfo.cmake"
+  "CMakeFiles/copys_mmgs_export.dir/DependInfo.cmake"
+  "CMakeFiles/copy_libmmgsf.dir/DependInfo.cmake"
+  "CMakeFiles/copy_s_headers.dir/DependInfo.cmake"
+  "CMakeFiles/mmgs.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_example0_a.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_example0_b.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_example1.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_example2.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_example3.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_lsOnly.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_lsOnly_optim.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_lsOnly_hsiz.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_lsAndMetric_optim.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_lsAndMetric_hsiz.dir/DependInfo.cmake"
+  "CMakeFiles/libmmgs_lsAndMetric.dir/DependInfo.cmake"
+  "CMakeFiles/mmg3d_fortran_header.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_a.dir/DependInfo.cmake"
+  "CMakeFiles/mmg3d_libmmg3d_header.dir/DependInfo.cmake"
+  "CMakeFiles/copy3d_libmmg3d.dir/DependInfo.cmake"
+  "CMakeFiles/mmg3d_mmg3d_export_header.dir/DependInfo.cmake"
+  "CMakeFiles/copy3d_mmg3d_export.dir/DependInfo.cmake"
+  "CMakeFiles/copy_libmmg3df.dir/DependInfo.cmake"
+  "CMakeFiles/copy_3d_headers.dir/DependInfo.cmake"
+  "CMakeFiles/mmg3d.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_example0_a.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_example0_b.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_example1.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_example2.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_example4.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_example6_io.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_lsOnly.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_lsOnly_optim.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_lsOnly_hsiz.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_lsAndMetric_optim.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_lsAndMetric_hsiz.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_lsAndMetric.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_generic_io.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_threaded.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_update.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg3d_region.dir/DependInfo.cmake"
+  "CMakeFiles/test_met3d.dir/DependInfo.cmake"
+  "CMakeFiles/hash_tetra_bench.dir/DependInfo.cmake"
+  "CMakeFiles/proctree_bench.dir/DependInfo.cmake"
+  "CMakeFiles/ascii_tokenizer.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg_a.dir/DependInfo.cmake"
+  "CMakeFiles/copy_mmg_headers.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg_example0_a.dir/DependInfo.cmake"
+  "CMakeFiles/libmmg_cpp_a.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  )
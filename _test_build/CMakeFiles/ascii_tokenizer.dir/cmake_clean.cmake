@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ascii_tokenizer.dir/cmake/testing/code/ascii-tokenizer.c.o"
+  "CMakeFiles/ascii_tokenizer.dir/cmake/testing/code/ascii-tokenizer.c.o.d"
+  "CMakeFiles/ascii_tokenizer.dir/src/common/inout.c.o"
+  "CMakeFiles/ascii_tokenizer.dir/src/common/inout.c.o.d"
+  "bin/ascii_tokenizer"
+  "bin/ascii_tokenizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ascii_tokenizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
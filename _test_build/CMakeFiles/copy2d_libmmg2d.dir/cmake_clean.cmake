@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy2d_libmmg2d"
+  "include/mmg/mmg2d/libmmg2d.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy2d_libmmg2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
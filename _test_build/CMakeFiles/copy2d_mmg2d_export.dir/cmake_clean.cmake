@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy2d_mmg2d_export"
+  "include/mmg/mmg2d/mmg2d_export.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy2d_mmg2d_export.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy3d_libmmg3d"
+  "include/mmg/mmg3d/libmmg3d.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy3d_libmmg3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
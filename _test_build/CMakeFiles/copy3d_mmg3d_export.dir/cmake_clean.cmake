@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy3d_mmg3d_export"
+  "include/mmg/mmg3d/mmg3d_export.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy3d_mmg3d_export.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_libmmg2df"
+  "include/mmg/mmg2d/libmmg2df.h"
+  "src/mmg2d/libmmg2df.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_libmmg2df.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_libmmg3df"
+  "include/mmg/mmg3d/libmmg3df.h"
+  "src/mmg3d/libmmg3df.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_libmmg3df.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
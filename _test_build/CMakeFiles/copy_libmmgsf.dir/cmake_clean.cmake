@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_libmmgsf"
+  "include/mmg/mmgs/libmmgsf.h"
+  "src/mmgs/libmmgsf.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_libmmgsf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_mmgcommon_headers"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_mmgcommon_headers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copymmgcommon_libmmgtypes"
+  "include/mmg/common/libmmgtypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copymmgcommon_libmmgtypes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copymmgcommon_libmmgtypesf"
+  "include/mmg/common/libmmgtypesf.h"
+  "src/common/libmmgtypesf.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copymmgcommon_libmmgtypesf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copymmgcommon_mmg_export"
+  "include/mmg/common/mmg_export.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copymmgcommon_mmg_export.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
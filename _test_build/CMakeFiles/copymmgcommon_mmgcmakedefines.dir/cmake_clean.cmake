@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copymmgcommon_mmgcmakedefines"
+  "include/mmg/common/mmgcmakedefines.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copymmgcommon_mmgcmakedefines.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copymmgcommon_mmgcmakedefinesf"
+  "include/mmg/common/mmgcmakedefinesf.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copymmgcommon_mmgcmakedefinesf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
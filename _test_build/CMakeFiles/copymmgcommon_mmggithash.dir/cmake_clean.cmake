@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copymmgcommon_mmggithash"
+  "include/mmg/common/git_log_mmg.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copymmgcommon_mmggithash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copymmgcommon_mmgversion"
+  "include/mmg/common/mmgversion.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copymmgcommon_mmgversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
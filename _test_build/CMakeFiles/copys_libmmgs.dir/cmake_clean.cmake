@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copys_libmmgs"
+  "include/mmg/mmgs/libmmgs.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copys_libmmgs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
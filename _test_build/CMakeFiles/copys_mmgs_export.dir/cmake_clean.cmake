@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copys_mmgs_export"
+  "include/mmg/mmgs/mmgs_export.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copys_mmgs_export.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/genheader.dir/scripts/genheader.c.o"
+  "CMakeFiles/genheader.dir/scripts/genheader.c.o.d"
+  "bin/genheader"
+  "bin/genheader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/genheader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
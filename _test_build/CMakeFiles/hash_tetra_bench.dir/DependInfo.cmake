@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cmake/testing/code/hash-tetra-bench.c" "CMakeFiles/hash_tetra_bench.dir/cmake/testing/code/hash-tetra-bench.c.o" "gcc" "CMakeFiles/hash_tetra_bench.dir/cmake/testing/code/hash-tetra-bench.c.o.d"
+  "/root/repo/src/common/chrono.c" "CMakeFiles/hash_tetra_bench.dir/src/common/chrono.c.o" "gcc" "CMakeFiles/hash_tetra_bench.dir/src/common/chrono.c.o.d"
+  "/root/repo/src/common/tools.c" "CMakeFiles/hash_tetra_bench.dir/src/common/tools.c.o" "gcc" "CMakeFiles/hash_tetra_bench.dir/src/common/tools.c.o.d"
+  "/root/repo/src/mmg3d/hash_3d.c" "CMakeFiles/hash_tetra_bench.dir/src/mmg3d/hash_3d.c.o" "gcc" "CMakeFiles/hash_tetra_bench.dir/src/mmg3d/hash_3d.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/libmmg3d_a.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_tetra_bench.dir/cmake/testing/code/hash-tetra-bench.c.o"
+  "CMakeFiles/hash_tetra_bench.dir/cmake/testing/code/hash-tetra-bench.c.o.d"
+  "CMakeFiles/hash_tetra_bench.dir/src/common/chrono.c.o"
+  "CMakeFiles/hash_tetra_bench.dir/src/common/chrono.c.o.d"
+  "CMakeFiles/hash_tetra_bench.dir/src/common/tools.c.o"
+  "CMakeFiles/hash_tetra_bench.dir/src/common/tools.c.o.d"
+  "CMakeFiles/hash_tetra_bench.dir/src/mmg3d/hash_3d.c.o"
+  "CMakeFiles/hash_tetra_bench.dir/src/mmg3d/hash_3d.c.o.d"
+  "bin/hash_tetra_bench"
+  "bin/hash_tetra_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hash_tetra_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,79 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/API_functions.c" "CMakeFiles/libmmg2d_a.dir/src/common/API_functions.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/API_functions.c.o.d"
+  "/root/repo/src/common/API_functionsf.c" "CMakeFiles/libmmg2d_a.dir/src/common/API_functionsf.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/API_functionsf.c.o.d"
+  "/root/repo/src/common/analys.c" "CMakeFiles/libmmg2d_a.dir/src/common/analys.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/analys.c.o.d"
+  "/root/repo/src/common/anisomovpt.c" "CMakeFiles/libmmg2d_a.dir/src/common/anisomovpt.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/anisomovpt.c.o.d"
+  "/root/repo/src/common/anisosiz.c" "CMakeFiles/libmmg2d_a.dir/src/common/anisosiz.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/anisosiz.c.o.d"
+  "/root/repo/src/common/bezier.c" "CMakeFiles/libmmg2d_a.dir/src/common/bezier.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/bezier.c.o.d"
+  "/root/repo/src/common/boulep.c" "CMakeFiles/libmmg2d_a.dir/src/common/boulep.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/boulep.c.o.d"
+  "/root/repo/src/common/chrono.c" "CMakeFiles/libmmg2d_a.dir/src/common/chrono.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/chrono.c.o.d"
+  "/root/repo/src/common/eigenv.c" "CMakeFiles/libmmg2d_a.dir/src/common/eigenv.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/eigenv.c.o.d"
+  "/root/repo/src/common/gzio.c" "CMakeFiles/libmmg2d_a.dir/src/common/gzio.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/gzio.c.o.d"
+  "/root/repo/src/common/hash.c" "CMakeFiles/libmmg2d_a.dir/src/common/hash.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/hash.c.o.d"
+  "/root/repo/src/common/inout.c" "CMakeFiles/libmmg2d_a.dir/src/common/inout.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/inout.c.o.d"
+  "/root/repo/src/common/intmet.c" "CMakeFiles/libmmg2d_a.dir/src/common/intmet.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/intmet.c.o.d"
+  "/root/repo/src/common/isosiz.c" "CMakeFiles/libmmg2d_a.dir/src/common/isosiz.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/isosiz.c.o.d"
+  "/root/repo/src/common/librnbg.c" "CMakeFiles/libmmg2d_a.dir/src/common/librnbg.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/librnbg.c.o.d"
+  "/root/repo/src/common/libtools.c" "CMakeFiles/libmmg2d_a.dir/src/common/libtools.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/libtools.c.o.d"
+  "/root/repo/src/common/mettools.c" "CMakeFiles/libmmg2d_a.dir/src/common/mettools.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/mettools.c.o.d"
+  "/root/repo/src/common/mmg2.c" "CMakeFiles/libmmg2d_a.dir/src/common/mmg2.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/mmg2.c.o.d"
+  "/root/repo/src/common/mmg2s.c" "CMakeFiles/libmmg2d_a.dir/src/common/mmg2s.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/mmg2s.c.o.d"
+  "/root/repo/src/common/mmg3.c" "CMakeFiles/libmmg2d_a.dir/src/common/mmg3.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/mmg3.c.o.d"
+  "/root/repo/src/common/quality.c" "CMakeFiles/libmmg2d_a.dir/src/common/quality.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/quality.c.o.d"
+  "/root/repo/src/common/scalem.c" "CMakeFiles/libmmg2d_a.dir/src/common/scalem.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/scalem.c.o.d"
+  "/root/repo/src/common/tools.c" "CMakeFiles/libmmg2d_a.dir/src/common/tools.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/common/tools.c.o.d"
+  "/root/repo/src/mmg2d/API_functions_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functions_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functions_2d.c.o.d"
+  "/root/repo/src/mmg2d/API_functionsf_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functionsf_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functionsf_2d.c.o.d"
+  "/root/repo/src/mmg2d/analys_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/analys_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/analys_2d.c.o.d"
+  "/root/repo/src/mmg2d/anisomovpt_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisomovpt_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisomovpt_2d.c.o.d"
+  "/root/repo/src/mmg2d/anisosiz_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisosiz_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisosiz_2d.c.o.d"
+  "/root/repo/src/mmg2d/bezier_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/bezier_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/bezier_2d.c.o.d"
+  "/root/repo/src/mmg2d/boulep_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/boulep_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/boulep_2d.c.o.d"
+  "/root/repo/src/mmg2d/cenrad_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/cenrad_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/cenrad_2d.c.o.d"
+  "/root/repo/src/mmg2d/chkmsh_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/chkmsh_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/chkmsh_2d.c.o.d"
+  "/root/repo/src/mmg2d/colver_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/colver_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/colver_2d.c.o.d"
+  "/root/repo/src/mmg2d/delone_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/delone_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/delone_2d.c.o.d"
+  "/root/repo/src/mmg2d/enforcement_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/enforcement_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/enforcement_2d.c.o.d"
+  "/root/repo/src/mmg2d/hash_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/hash_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/hash_2d.c.o.d"
+  "/root/repo/src/mmg2d/inout_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inout_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inout_2d.c.o.d"
+  "/root/repo/src/mmg2d/intmet_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/intmet_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/intmet_2d.c.o.d"
+  "/root/repo/src/mmg2d/isosiz_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/isosiz_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/isosiz_2d.c.o.d"
+  "/root/repo/src/mmg2d/length_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/length_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/length_2d.c.o.d"
+  "/root/repo/src/mmg2d/libmmg2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d.c.o.d"
+  "/root/repo/src/mmg2d/libmmg2d_tools.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_tools.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_tools.c.o.d"
+  "/root/repo/src/mmg2d/libmmg2d_toolsf.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_toolsf.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_toolsf.c.o.d"
+  "/root/repo/src/mmg2d/libmmg2df.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2df.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2df.c.o.d"
+  "/root/repo/src/mmg2d/lissmet_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/lissmet_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/lissmet_2d.c.o.d"
+  "/root/repo/src/mmg2d/locate_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/locate_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/locate_2d.c.o.d"
+  "/root/repo/src/mmg2d/mmg2d1.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d1.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d1.c.o.d"
+  "/root/repo/src/mmg2d/mmg2d2.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d2.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d2.c.o.d"
+  "/root/repo/src/mmg2d/mmg2d6.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d6.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d6.c.o.d"
+  "/root/repo/src/mmg2d/mmg2d9.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d9.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d9.c.o.d"
+  "/root/repo/src/mmg2d/mmg2dexterns.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2dexterns.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2dexterns.c.o.d"
+  "/root/repo/src/mmg2d/movpt_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/movpt_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/movpt_2d.c.o.d"
+  "/root/repo/src/mmg2d/quality_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/quality_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/quality_2d.c.o.d"
+  "/root/repo/src/mmg2d/solmap_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/solmap_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/solmap_2d.c.o.d"
+  "/root/repo/src/mmg2d/split_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/split_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/split_2d.c.o.d"
+  "/root/repo/src/mmg2d/swapar_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/swapar_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/swapar_2d.c.o.d"
+  "/root/repo/src/mmg2d/tools_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/tools_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/tools_2d.c.o.d"
+  "/root/repo/src/mmg2d/variadic_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/variadic_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/variadic_2d.c.o.d"
+  "/root/repo/src/mmg2d/velextls_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/velextls_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/velextls_2d.c.o.d"
+  "/root/repo/src/mmg2d/zaldy_2d.c" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/zaldy_2d.c.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/zaldy_2d.c.o.d"
+  "/root/repo/src/mmg2d/inoutcpp_2d.cpp" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inoutcpp_2d.cpp.o" "gcc" "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inoutcpp_2d.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
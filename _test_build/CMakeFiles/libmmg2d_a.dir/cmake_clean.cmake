@@ -0,0 +1,131 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_a.dir/src/common/API_functions.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/API_functions.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/API_functionsf.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/API_functionsf.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/analys.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/analys.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/anisomovpt.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/anisomovpt.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/anisosiz.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/anisosiz.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/bezier.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/bezier.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/boulep.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/boulep.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/chrono.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/chrono.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/eigenv.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/eigenv.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/gzio.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/gzio.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/hash.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/hash.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/inout.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/inout.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/intmet.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/intmet.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/isosiz.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/isosiz.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/librnbg.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/librnbg.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/libtools.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/libtools.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mettools.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mettools.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mmg2.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mmg2.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mmg2s.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mmg2s.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mmg3.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/mmg3.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/quality.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/quality.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/scalem.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/scalem.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/common/tools.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/common/tools.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functions_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functions_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functionsf_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/API_functionsf_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/analys_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/analys_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisomovpt_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisomovpt_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisosiz_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/anisosiz_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/bezier_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/bezier_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/boulep_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/boulep_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/cenrad_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/cenrad_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/chkmsh_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/chkmsh_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/colver_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/colver_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/delone_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/delone_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/enforcement_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/enforcement_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/hash_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/hash_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inout_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inout_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inoutcpp_2d.cpp.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/inoutcpp_2d.cpp.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/intmet_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/intmet_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/isosiz_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/isosiz_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/length_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/length_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_tools.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_tools.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_toolsf.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2d_toolsf.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2df.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/libmmg2df.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/lissmet_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/lissmet_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/locate_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/locate_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d1.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d1.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d2.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d2.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d6.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d6.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d9.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2d9.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2dexterns.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/mmg2dexterns.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/movpt_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/movpt_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/quality_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/quality_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/solmap_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/solmap_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/split_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/split_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/swapar_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/swapar_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/tools_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/tools_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/variadic_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/variadic_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/velextls_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/velextls_2d.c.o.d"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/zaldy_2d.c.o"
+  "CMakeFiles/libmmg2d_a.dir/src/mmg2d/zaldy_2d.c.o.d"
+  "lib/libmmg2d.a"
+  "lib/libmmg2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libmmg2d_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_adp_example0_b.dir/libexamples/mmg2d/adaptation_example0/example0_b/main.c.o"
+  "CMakeFiles/libmmg2d_adp_example0_b.dir/libexamples/mmg2d/adaptation_example0/example0_b/main.c.o.d"
+  "bin/libmmg2d_adp_example0_b"
+  "bin/libmmg2d_adp_example0_b.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_adp_example0_b.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
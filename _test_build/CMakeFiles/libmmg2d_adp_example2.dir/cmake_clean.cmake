@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_adp_example2.dir/libexamples/mmg2d/adaptation_example2/main.c.o"
+  "CMakeFiles/libmmg2d_adp_example2.dir/libexamples/mmg2d/adaptation_example2/main.c.o.d"
+  "bin/libmmg2d_adp_example2"
+  "bin/libmmg2d_adp_example2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_adp_example2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
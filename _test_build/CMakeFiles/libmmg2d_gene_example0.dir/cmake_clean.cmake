@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_gene_example0.dir/libexamples/mmg2d/squareGeneration_example0/main.c.o"
+  "CMakeFiles/libmmg2d_gene_example0.dir/libexamples/mmg2d/squareGeneration_example0/main.c.o.d"
+  "bin/libmmg2d_gene_example0"
+  "bin/libmmg2d_gene_example0.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_gene_example0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_lsAndMetric.dir/libexamples/mmg2d/IsosurfDiscretization_lsAndMetric/main.c.o"
+  "CMakeFiles/libmmg2d_lsAndMetric.dir/libexamples/mmg2d/IsosurfDiscretization_lsAndMetric/main.c.o.d"
+  "bin/libmmg2d_lsAndMetric"
+  "bin/libmmg2d_lsAndMetric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_lsAndMetric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
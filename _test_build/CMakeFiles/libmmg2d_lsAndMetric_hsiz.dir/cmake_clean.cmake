@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_lsAndMetric_hsiz.dir/libexamples/mmg2d/IsosurfDiscretization_lsAndMetric/main_hsiz.c.o"
+  "CMakeFiles/libmmg2d_lsAndMetric_hsiz.dir/libexamples/mmg2d/IsosurfDiscretization_lsAndMetric/main_hsiz.c.o.d"
+  "bin/libmmg2d_lsAndMetric_hsiz"
+  "bin/libmmg2d_lsAndMetric_hsiz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_lsAndMetric_hsiz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
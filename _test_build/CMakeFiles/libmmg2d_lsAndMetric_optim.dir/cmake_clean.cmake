@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_lsAndMetric_optim.dir/libexamples/mmg2d/IsosurfDiscretization_lsAndMetric/main_optim.c.o"
+  "CMakeFiles/libmmg2d_lsAndMetric_optim.dir/libexamples/mmg2d/IsosurfDiscretization_lsAndMetric/main_optim.c.o.d"
+  "bin/libmmg2d_lsAndMetric_optim"
+  "bin/libmmg2d_lsAndMetric_optim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_lsAndMetric_optim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_lsOnly.dir/libexamples/mmg2d/IsosurfDiscretization_lsOnly/main.c.o"
+  "CMakeFiles/libmmg2d_lsOnly.dir/libexamples/mmg2d/IsosurfDiscretization_lsOnly/main.c.o.d"
+  "bin/libmmg2d_lsOnly"
+  "bin/libmmg2d_lsOnly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_lsOnly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
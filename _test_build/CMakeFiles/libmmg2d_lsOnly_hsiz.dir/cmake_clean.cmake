@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg2d_lsOnly_hsiz.dir/libexamples/mmg2d/IsosurfDiscretization_lsOnly/main_hsiz.c.o"
+  "CMakeFiles/libmmg2d_lsOnly_hsiz.dir/libexamples/mmg2d/IsosurfDiscretization_lsOnly/main_hsiz.c.o.d"
+  "bin/libmmg2d_lsOnly_hsiz"
+  "bin/libmmg2d_lsOnly_hsiz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg2d_lsOnly_hsiz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,83 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/API_functions.c" "CMakeFiles/libmmg3d_a.dir/src/common/API_functions.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/API_functions.c.o.d"
+  "/root/repo/src/common/API_functionsf.c" "CMakeFiles/libmmg3d_a.dir/src/common/API_functionsf.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/API_functionsf.c.o.d"
+  "/root/repo/src/common/analys.c" "CMakeFiles/libmmg3d_a.dir/src/common/analys.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/analys.c.o.d"
+  "/root/repo/src/common/anisomovpt.c" "CMakeFiles/libmmg3d_a.dir/src/common/anisomovpt.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/anisomovpt.c.o.d"
+  "/root/repo/src/common/anisosiz.c" "CMakeFiles/libmmg3d_a.dir/src/common/anisosiz.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/anisosiz.c.o.d"
+  "/root/repo/src/common/bezier.c" "CMakeFiles/libmmg3d_a.dir/src/common/bezier.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/bezier.c.o.d"
+  "/root/repo/src/common/boulep.c" "CMakeFiles/libmmg3d_a.dir/src/common/boulep.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/boulep.c.o.d"
+  "/root/repo/src/common/chrono.c" "CMakeFiles/libmmg3d_a.dir/src/common/chrono.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/chrono.c.o.d"
+  "/root/repo/src/common/eigenv.c" "CMakeFiles/libmmg3d_a.dir/src/common/eigenv.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/eigenv.c.o.d"
+  "/root/repo/src/common/gzio.c" "CMakeFiles/libmmg3d_a.dir/src/common/gzio.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/gzio.c.o.d"
+  "/root/repo/src/common/hash.c" "CMakeFiles/libmmg3d_a.dir/src/common/hash.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/hash.c.o.d"
+  "/root/repo/src/common/inout.c" "CMakeFiles/libmmg3d_a.dir/src/common/inout.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/inout.c.o.d"
+  "/root/repo/src/common/intmet.c" "CMakeFiles/libmmg3d_a.dir/src/common/intmet.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/intmet.c.o.d"
+  "/root/repo/src/common/isosiz.c" "CMakeFiles/libmmg3d_a.dir/src/common/isosiz.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/isosiz.c.o.d"
+  "/root/repo/src/common/librnbg.c" "CMakeFiles/libmmg3d_a.dir/src/common/librnbg.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/librnbg.c.o.d"
+  "/root/repo/src/common/libtools.c" "CMakeFiles/libmmg3d_a.dir/src/common/libtools.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/libtools.c.o.d"
+  "/root/repo/src/common/mettools.c" "CMakeFiles/libmmg3d_a.dir/src/common/mettools.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/mettools.c.o.d"
+  "/root/repo/src/common/mmg2.c" "CMakeFiles/libmmg3d_a.dir/src/common/mmg2.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/mmg2.c.o.d"
+  "/root/repo/src/common/mmg2s.c" "CMakeFiles/libmmg3d_a.dir/src/common/mmg2s.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/mmg2s.c.o.d"
+  "/root/repo/src/common/mmg3.c" "CMakeFiles/libmmg3d_a.dir/src/common/mmg3.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/mmg3.c.o.d"
+  "/root/repo/src/common/quality.c" "CMakeFiles/libmmg3d_a.dir/src/common/quality.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/quality.c.o.d"
+  "/root/repo/src/common/scalem.c" "CMakeFiles/libmmg3d_a.dir/src/common/scalem.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/scalem.c.o.d"
+  "/root/repo/src/common/tools.c" "CMakeFiles/libmmg3d_a.dir/src/common/tools.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/common/tools.c.o.d"
+  "/root/repo/src/mmg3d/API_functions_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functions_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functions_3d.c.o.d"
+  "/root/repo/src/mmg3d/API_functionsf_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functionsf_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functionsf_3d.c.o.d"
+  "/root/repo/src/mmg3d/PRoctree_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/PRoctree_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/PRoctree_3d.c.o.d"
+  "/root/repo/src/mmg3d/analys_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/analys_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/analys_3d.c.o.d"
+  "/root/repo/src/mmg3d/anisomovpt_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisomovpt_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisomovpt_3d.c.o.d"
+  "/root/repo/src/mmg3d/anisosiz_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisosiz_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisosiz_3d.c.o.d"
+  "/root/repo/src/mmg3d/bezier_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/bezier_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/bezier_3d.c.o.d"
+  "/root/repo/src/mmg3d/boulep_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/boulep_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/boulep_3d.c.o.d"
+  "/root/repo/src/mmg3d/cenrad_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/cenrad_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/cenrad_3d.c.o.d"
+  "/root/repo/src/mmg3d/chkmsh_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/chkmsh_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/chkmsh_3d.c.o.d"
+  "/root/repo/src/mmg3d/colver_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/colver_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/colver_3d.c.o.d"
+  "/root/repo/src/mmg3d/delaunay_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/delaunay_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/delaunay_3d.c.o.d"
+  "/root/repo/src/mmg3d/hash_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/hash_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/hash_3d.c.o.d"
+  "/root/repo/src/mmg3d/inout_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inout_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inout_3d.c.o.d"
+  "/root/repo/src/mmg3d/intmet_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/intmet_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/intmet_3d.c.o.d"
+  "/root/repo/src/mmg3d/isosiz_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/isosiz_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/isosiz_3d.c.o.d"
+  "/root/repo/src/mmg3d/libmmg3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d.c.o.d"
+  "/root/repo/src/mmg3d/libmmg3d_tools.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_tools.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_tools.c.o.d"
+  "/root/repo/src/mmg3d/libmmg3d_toolsf.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_toolsf.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_toolsf.c.o.d"
+  "/root/repo/src/mmg3d/libmmg3df.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3df.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3df.c.o.d"
+  "/root/repo/src/mmg3d/librnbg_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/librnbg_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/librnbg_3d.c.o.d"
+  "/root/repo/src/mmg3d/mmg3d1.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1.c.o.d"
+  "/root/repo/src/mmg3d/mmg3d1_delone.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_delone.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_delone.c.o.d"
+  "/root/repo/src/mmg3d/mmg3d1_pattern.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_pattern.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_pattern.c.o.d"
+  "/root/repo/src/mmg3d/mmg3d2.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2.c.o.d"
+  "/root/repo/src/mmg3d/mmg3d2s.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2s.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2s.c.o.d"
+  "/root/repo/src/mmg3d/mmg3d3.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d3.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d3.c.o.d"
+  "/root/repo/src/mmg3d/mmg3dexterns.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3dexterns.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3dexterns.c.o.d"
+  "/root/repo/src/mmg3d/movpt_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/movpt_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/movpt_3d.c.o.d"
+  "/root/repo/src/mmg3d/optbdry_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optbdry_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optbdry_3d.c.o.d"
+  "/root/repo/src/mmg3d/optlap_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optlap_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optlap_3d.c.o.d"
+  "/root/repo/src/mmg3d/opttyp_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/opttyp_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/opttyp_3d.c.o.d"
+  "/root/repo/src/mmg3d/quality_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/quality_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/quality_3d.c.o.d"
+  "/root/repo/src/mmg3d/split_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/split_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/split_3d.c.o.d"
+  "/root/repo/src/mmg3d/swap_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swap_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swap_3d.c.o.d"
+  "/root/repo/src/mmg3d/swapgen_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swapgen_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swapgen_3d.c.o.d"
+  "/root/repo/src/mmg3d/threaded_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/threaded_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/threaded_3d.c.o.d"
+  "/root/repo/src/mmg3d/tools_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/tools_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/tools_3d.c.o.d"
+  "/root/repo/src/mmg3d/variadic_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/variadic_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/variadic_3d.c.o.d"
+  "/root/repo/src/mmg3d/velextls_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/velextls_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/velextls_3d.c.o.d"
+  "/root/repo/src/mmg3d/zaldy_3d.c" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/zaldy_3d.c.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/zaldy_3d.c.o.d"
+  "/root/repo/src/mmg3d/inoutcpp_3d.cpp" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inoutcpp_3d.cpp.o" "gcc" "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inoutcpp_3d.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
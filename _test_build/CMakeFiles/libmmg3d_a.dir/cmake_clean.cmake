@@ -0,0 +1,139 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_a.dir/src/common/API_functions.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/API_functions.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/API_functionsf.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/API_functionsf.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/analys.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/analys.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/anisomovpt.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/anisomovpt.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/anisosiz.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/anisosiz.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/bezier.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/bezier.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/boulep.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/boulep.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/chrono.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/chrono.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/eigenv.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/eigenv.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/gzio.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/gzio.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/hash.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/hash.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/inout.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/inout.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/intmet.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/intmet.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/isosiz.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/isosiz.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/librnbg.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/librnbg.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/libtools.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/libtools.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mettools.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mettools.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mmg2.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mmg2.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mmg2s.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mmg2s.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mmg3.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/mmg3.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/quality.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/quality.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/scalem.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/scalem.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/common/tools.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/common/tools.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functions_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functions_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functionsf_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/API_functionsf_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/PRoctree_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/PRoctree_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/analys_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/analys_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisomovpt_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisomovpt_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisosiz_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/anisosiz_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/bezier_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/bezier_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/boulep_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/boulep_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/cenrad_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/cenrad_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/chkmsh_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/chkmsh_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/colver_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/colver_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/delaunay_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/delaunay_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/hash_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/hash_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inout_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inout_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inoutcpp_3d.cpp.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/inoutcpp_3d.cpp.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/intmet_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/intmet_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/isosiz_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/isosiz_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_tools.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_tools.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_toolsf.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3d_toolsf.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3df.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/libmmg3df.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/librnbg_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/librnbg_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_delone.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_delone.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_pattern.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d1_pattern.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2s.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d2s.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d3.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3d3.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3dexterns.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/mmg3dexterns.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/movpt_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/movpt_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optbdry_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optbdry_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optlap_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/optlap_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/opttyp_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/opttyp_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/quality_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/quality_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/split_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/split_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swap_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swap_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swapgen_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/swapgen_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/threaded_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/threaded_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/tools_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/tools_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/variadic_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/variadic_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/velextls_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/velextls_3d.c.o.d"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/zaldy_3d.c.o"
+  "CMakeFiles/libmmg3d_a.dir/src/mmg3d/zaldy_3d.c.o.d"
+  "lib/libmmg3d.a"
+  "lib/libmmg3d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libmmg3d_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
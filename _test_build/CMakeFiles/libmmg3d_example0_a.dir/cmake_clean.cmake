@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_example0_a.dir/libexamples/mmg3d/adaptation_example0/example0_a/main.c.o"
+  "CMakeFiles/libmmg3d_example0_a.dir/libexamples/mmg3d/adaptation_example0/example0_a/main.c.o.d"
+  "bin/libmmg3d_example0_a"
+  "bin/libmmg3d_example0_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_example0_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
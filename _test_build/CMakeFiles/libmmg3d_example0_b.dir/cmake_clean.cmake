@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_example0_b.dir/libexamples/mmg3d/adaptation_example0/example0_b/main.c.o"
+  "CMakeFiles/libmmg3d_example0_b.dir/libexamples/mmg3d/adaptation_example0/example0_b/main.c.o.d"
+  "bin/libmmg3d_example0_b"
+  "bin/libmmg3d_example0_b.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_example0_b.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
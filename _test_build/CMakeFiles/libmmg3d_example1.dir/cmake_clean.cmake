@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_example1.dir/libexamples/mmg3d/adaptation_example1/main.c.o"
+  "CMakeFiles/libmmg3d_example1.dir/libexamples/mmg3d/adaptation_example1/main.c.o.d"
+  "bin/libmmg3d_example1"
+  "bin/libmmg3d_example1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_example1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
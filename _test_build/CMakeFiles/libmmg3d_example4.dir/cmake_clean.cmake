@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_example4.dir/libexamples/mmg3d/LagrangianMotion_example0/main.c.o"
+  "CMakeFiles/libmmg3d_example4.dir/libexamples/mmg3d/LagrangianMotion_example0/main.c.o.d"
+  "bin/libmmg3d_example4"
+  "bin/libmmg3d_example4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_example4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_example6_io.dir/libexamples/mmg3d/io_multisols_example6/main.c.o"
+  "CMakeFiles/libmmg3d_example6_io.dir/libexamples/mmg3d/io_multisols_example6/main.c.o.d"
+  "bin/libmmg3d_example6_io"
+  "bin/libmmg3d_example6_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_example6_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_generic_io.dir/libexamples/mmg3d/io_generic_and_get_adja/genericIO.c.o"
+  "CMakeFiles/libmmg3d_generic_io.dir/libexamples/mmg3d/io_generic_and_get_adja/genericIO.c.o.d"
+  "bin/libmmg3d_generic_io"
+  "bin/libmmg3d_generic_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_generic_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
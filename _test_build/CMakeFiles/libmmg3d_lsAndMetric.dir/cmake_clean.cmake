@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_lsAndMetric.dir/libexamples/mmg3d/IsosurfDiscretization_lsAndMetric/main.c.o"
+  "CMakeFiles/libmmg3d_lsAndMetric.dir/libexamples/mmg3d/IsosurfDiscretization_lsAndMetric/main.c.o.d"
+  "bin/libmmg3d_lsAndMetric"
+  "bin/libmmg3d_lsAndMetric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_lsAndMetric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_lsOnly.dir/libexamples/mmg3d/IsosurfDiscretization_lsOnly/main.c.o"
+  "CMakeFiles/libmmg3d_lsOnly.dir/libexamples/mmg3d/IsosurfDiscretization_lsOnly/main.c.o.d"
+  "bin/libmmg3d_lsOnly"
+  "bin/libmmg3d_lsOnly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_lsOnly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
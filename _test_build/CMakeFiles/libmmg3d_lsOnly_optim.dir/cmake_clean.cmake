@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_lsOnly_optim.dir/libexamples/mmg3d/IsosurfDiscretization_lsOnly/main_optim.c.o"
+  "CMakeFiles/libmmg3d_lsOnly_optim.dir/libexamples/mmg3d/IsosurfDiscretization_lsOnly/main_optim.c.o.d"
+  "bin/libmmg3d_lsOnly_optim"
+  "bin/libmmg3d_lsOnly_optim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_lsOnly_optim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
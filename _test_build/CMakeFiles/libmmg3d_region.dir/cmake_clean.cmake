@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_region.dir/libexamples/mmg3d/region_remeshing/main.c.o"
+  "CMakeFiles/libmmg3d_region.dir/libexamples/mmg3d/region_remeshing/main.c.o.d"
+  "bin/libmmg3d_region"
+  "bin/libmmg3d_region.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_region.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
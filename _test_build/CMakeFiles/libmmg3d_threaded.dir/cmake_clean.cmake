@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_threaded.dir/libexamples/mmg3d/threaded_remeshing/main.c.o"
+  "CMakeFiles/libmmg3d_threaded.dir/libexamples/mmg3d/threaded_remeshing/main.c.o.d"
+  "bin/libmmg3d_threaded"
+  "bin/libmmg3d_threaded.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_threaded.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
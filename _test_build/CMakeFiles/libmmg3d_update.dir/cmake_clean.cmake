@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg3d_update.dir/libexamples/mmg3d/warm_start_remeshing/main.c.o"
+  "CMakeFiles/libmmg3d_update.dir/libexamples/mmg3d/warm_start_remeshing/main.c.o.d"
+  "bin/libmmg3d_update"
+  "bin/libmmg3d_update.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg3d_update.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg_cpp_a.dir/libexamples/mmg/adaptation_example0_cpp/main.cpp.o"
+  "CMakeFiles/libmmg_cpp_a.dir/libexamples/mmg/adaptation_example0_cpp/main.cpp.o.d"
+  "bin/libmmg_cpp_a"
+  "bin/libmmg_cpp_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmmg_cpp_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmg_example0_a.dir/libexamples/mmg/adaptation_example0/main.c.o"
+  "CMakeFiles/libmmg_example0_a.dir/libexamples/mmg/adaptation_example0/main.c.o.d"
+  "bin/libmmg_example0_a"
+  "bin/libmmg_example0_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmg_example0_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,70 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/API_functions.c" "CMakeFiles/libmmgs_a.dir/src/common/API_functions.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/API_functions.c.o.d"
+  "/root/repo/src/common/API_functionsf.c" "CMakeFiles/libmmgs_a.dir/src/common/API_functionsf.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/API_functionsf.c.o.d"
+  "/root/repo/src/common/analys.c" "CMakeFiles/libmmgs_a.dir/src/common/analys.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/analys.c.o.d"
+  "/root/repo/src/common/anisomovpt.c" "CMakeFiles/libmmgs_a.dir/src/common/anisomovpt.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/anisomovpt.c.o.d"
+  "/root/repo/src/common/anisosiz.c" "CMakeFiles/libmmgs_a.dir/src/common/anisosiz.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/anisosiz.c.o.d"
+  "/root/repo/src/common/bezier.c" "CMakeFiles/libmmgs_a.dir/src/common/bezier.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/bezier.c.o.d"
+  "/root/repo/src/common/boulep.c" "CMakeFiles/libmmgs_a.dir/src/common/boulep.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/boulep.c.o.d"
+  "/root/repo/src/common/chrono.c" "CMakeFiles/libmmgs_a.dir/src/common/chrono.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/chrono.c.o.d"
+  "/root/repo/src/common/eigenv.c" "CMakeFiles/libmmgs_a.dir/src/common/eigenv.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/eigenv.c.o.d"
+  "/root/repo/src/common/gzio.c" "CMakeFiles/libmmgs_a.dir/src/common/gzio.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/gzio.c.o.d"
+  "/root/repo/src/common/hash.c" "CMakeFiles/libmmgs_a.dir/src/common/hash.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/hash.c.o.d"
+  "/root/repo/src/common/inout.c" "CMakeFiles/libmmgs_a.dir/src/common/inout.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/inout.c.o.d"
+  "/root/repo/src/common/intmet.c" "CMakeFiles/libmmgs_a.dir/src/common/intmet.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/intmet.c.o.d"
+  "/root/repo/src/common/isosiz.c" "CMakeFiles/libmmgs_a.dir/src/common/isosiz.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/isosiz.c.o.d"
+  "/root/repo/src/common/librnbg.c" "CMakeFiles/libmmgs_a.dir/src/common/librnbg.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/librnbg.c.o.d"
+  "/root/repo/src/common/libtools.c" "CMakeFiles/libmmgs_a.dir/src/common/libtools.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/libtools.c.o.d"
+  "/root/repo/src/common/mettools.c" "CMakeFiles/libmmgs_a.dir/src/common/mettools.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/mettools.c.o.d"
+  "/root/repo/src/common/mmg2.c" "CMakeFiles/libmmgs_a.dir/src/common/mmg2.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/mmg2.c.o.d"
+  "/root/repo/src/common/mmg2s.c" "CMakeFiles/libmmgs_a.dir/src/common/mmg2s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/mmg2s.c.o.d"
+  "/root/repo/src/common/mmg3.c" "CMakeFiles/libmmgs_a.dir/src/common/mmg3.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/mmg3.c.o.d"
+  "/root/repo/src/common/quality.c" "CMakeFiles/libmmgs_a.dir/src/common/quality.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/quality.c.o.d"
+  "/root/repo/src/common/scalem.c" "CMakeFiles/libmmgs_a.dir/src/common/scalem.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/scalem.c.o.d"
+  "/root/repo/src/common/tools.c" "CMakeFiles/libmmgs_a.dir/src/common/tools.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/common/tools.c.o.d"
+  "/root/repo/src/mmgs/API_functions_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functions_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functions_s.c.o.d"
+  "/root/repo/src/mmgs/API_functionsf_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functionsf_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functionsf_s.c.o.d"
+  "/root/repo/src/mmgs/analys_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/analys_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/analys_s.c.o.d"
+  "/root/repo/src/mmgs/anisomovpt_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/anisomovpt_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/anisomovpt_s.c.o.d"
+  "/root/repo/src/mmgs/anisosiz_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/anisosiz_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/anisosiz_s.c.o.d"
+  "/root/repo/src/mmgs/bezier_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/bezier_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/bezier_s.c.o.d"
+  "/root/repo/src/mmgs/boulep_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/boulep_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/boulep_s.c.o.d"
+  "/root/repo/src/mmgs/chkmsh_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/chkmsh_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/chkmsh_s.c.o.d"
+  "/root/repo/src/mmgs/colver_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/colver_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/colver_s.c.o.d"
+  "/root/repo/src/mmgs/gentools_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/gentools_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/gentools_s.c.o.d"
+  "/root/repo/src/mmgs/hash_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/hash_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/hash_s.c.o.d"
+  "/root/repo/src/mmgs/inout_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/inout_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/inout_s.c.o.d"
+  "/root/repo/src/mmgs/intmet_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/intmet_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/intmet_s.c.o.d"
+  "/root/repo/src/mmgs/isosiz_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/isosiz_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/isosiz_s.c.o.d"
+  "/root/repo/src/mmgs/libmmgs.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs.c.o.d"
+  "/root/repo/src/mmgs/libmmgs_tools.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_tools.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_tools.c.o.d"
+  "/root/repo/src/mmgs/libmmgs_toolsf.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_toolsf.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_toolsf.c.o.d"
+  "/root/repo/src/mmgs/libmmgsf.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgsf.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgsf.c.o.d"
+  "/root/repo/src/mmgs/librnbg_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/librnbg_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/librnbg_s.c.o.d"
+  "/root/repo/src/mmgs/mmgs1.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs1.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs1.c.o.d"
+  "/root/repo/src/mmgs/mmgs2.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs2.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs2.c.o.d"
+  "/root/repo/src/mmgs/mmgsexterns.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgsexterns.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgsexterns.c.o.d"
+  "/root/repo/src/mmgs/movpt_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/movpt_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/movpt_s.c.o.d"
+  "/root/repo/src/mmgs/quality_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/quality_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/quality_s.c.o.d"
+  "/root/repo/src/mmgs/split_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/split_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/split_s.c.o.d"
+  "/root/repo/src/mmgs/swapar_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/swapar_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/swapar_s.c.o.d"
+  "/root/repo/src/mmgs/variadic_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/variadic_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/variadic_s.c.o.d"
+  "/root/repo/src/mmgs/zaldy_s.c" "CMakeFiles/libmmgs_a.dir/src/mmgs/zaldy_s.c.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/zaldy_s.c.o.d"
+  "/root/repo/src/mmgs/inoutcpp_s.cpp" "CMakeFiles/libmmgs_a.dir/src/mmgs/inoutcpp_s.cpp.o" "gcc" "CMakeFiles/libmmgs_a.dir/src/mmgs/inoutcpp_s.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,113 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_a.dir/src/common/API_functions.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/API_functions.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/API_functionsf.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/API_functionsf.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/analys.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/analys.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/anisomovpt.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/anisomovpt.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/anisosiz.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/anisosiz.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/bezier.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/bezier.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/boulep.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/boulep.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/chrono.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/chrono.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/eigenv.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/eigenv.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/gzio.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/gzio.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/hash.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/hash.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/inout.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/inout.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/intmet.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/intmet.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/isosiz.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/isosiz.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/librnbg.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/librnbg.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/libtools.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/libtools.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/mettools.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/mettools.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/mmg2.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/mmg2.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/mmg2s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/mmg2s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/mmg3.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/mmg3.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/quality.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/quality.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/scalem.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/scalem.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/common/tools.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/common/tools.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functions_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functions_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functionsf_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/API_functionsf_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/analys_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/analys_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/anisomovpt_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/anisomovpt_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/anisosiz_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/anisosiz_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/bezier_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/bezier_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/boulep_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/boulep_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/chkmsh_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/chkmsh_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/colver_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/colver_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/gentools_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/gentools_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/hash_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/hash_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/inout_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/inout_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/inoutcpp_s.cpp.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/inoutcpp_s.cpp.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/intmet_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/intmet_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/isosiz_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/isosiz_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_tools.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_tools.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_toolsf.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgs_toolsf.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgsf.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/libmmgsf.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/librnbg_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/librnbg_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs1.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs1.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs2.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgs2.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgsexterns.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/mmgsexterns.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/movpt_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/movpt_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/quality_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/quality_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/split_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/split_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/swapar_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/swapar_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/variadic_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/variadic_s.c.o.d"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/zaldy_s.c.o"
+  "CMakeFiles/libmmgs_a.dir/src/mmgs/zaldy_s.c.o.d"
+  "lib/libmmgs.a"
+  "lib/libmmgs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libmmgs_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_example0_a.dir/libexamples/mmgs/adaptation_example0/example0_a/main.c.o"
+  "CMakeFiles/libmmgs_example0_a.dir/libexamples/mmgs/adaptation_example0/example0_a/main.c.o.d"
+  "bin/libmmgs_example0_a"
+  "bin/libmmgs_example0_a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_example0_a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
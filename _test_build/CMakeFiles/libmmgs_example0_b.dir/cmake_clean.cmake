@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_example0_b.dir/libexamples/mmgs/adaptation_example0/example0_b/main.c.o"
+  "CMakeFiles/libmmgs_example0_b.dir/libexamples/mmgs/adaptation_example0/example0_b/main.c.o.d"
+  "bin/libmmgs_example0_b"
+  "bin/libmmgs_example0_b.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_example0_b.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
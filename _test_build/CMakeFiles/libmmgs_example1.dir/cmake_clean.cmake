@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_example1.dir/libexamples/mmgs/adaptation_example1/main.c.o"
+  "CMakeFiles/libmmgs_example1.dir/libexamples/mmgs/adaptation_example1/main.c.o.d"
+  "bin/libmmgs_example1"
+  "bin/libmmgs_example1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_example1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
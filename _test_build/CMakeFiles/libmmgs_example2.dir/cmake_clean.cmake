@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_example2.dir/libexamples/mmgs/IsosurfDiscretization_example0/main.c.o"
+  "CMakeFiles/libmmgs_example2.dir/libexamples/mmgs/IsosurfDiscretization_example0/main.c.o.d"
+  "bin/libmmgs_example2"
+  "bin/libmmgs_example2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_example2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
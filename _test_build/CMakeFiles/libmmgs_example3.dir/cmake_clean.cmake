@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_example3.dir/libexamples/mmgs/io_multisols_example3/main.c.o"
+  "CMakeFiles/libmmgs_example3.dir/libexamples/mmgs/io_multisols_example3/main.c.o.d"
+  "bin/libmmgs_example3"
+  "bin/libmmgs_example3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_example3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main.c" "CMakeFiles/libmmgs_lsAndMetric.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main.c.o" "gcc" "CMakeFiles/libmmgs_lsAndMetric.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/libmmgs_a.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_lsAndMetric.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main.c.o"
+  "CMakeFiles/libmmgs_lsAndMetric.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main.c.o.d"
+  "bin/libmmgs_lsAndMetric"
+  "bin/libmmgs_lsAndMetric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_lsAndMetric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_lsAndMetric_hsiz.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main_hsiz.c.o"
+  "CMakeFiles/libmmgs_lsAndMetric_hsiz.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main_hsiz.c.o.d"
+  "bin/libmmgs_lsAndMetric_hsiz"
+  "bin/libmmgs_lsAndMetric_hsiz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_lsAndMetric_hsiz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_lsAndMetric_optim.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main_optim.c.o"
+  "CMakeFiles/libmmgs_lsAndMetric_optim.dir/libexamples/mmgs/IsosurfDiscretization_lsAndMetric/main_optim.c.o.d"
+  "bin/libmmgs_lsAndMetric_optim"
+  "bin/libmmgs_lsAndMetric_optim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_lsAndMetric_optim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_lsOnly.dir/libexamples/mmgs/IsosurfDiscretization_lsOnly/main.c.o"
+  "CMakeFiles/libmmgs_lsOnly.dir/libexamples/mmgs/IsosurfDiscretization_lsOnly/main.c.o.d"
+  "bin/libmmgs_lsOnly"
+  "bin/libmmgs_lsOnly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_lsOnly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_lsOnly_hsiz.dir/libexamples/mmgs/IsosurfDiscretization_lsOnly/main_hsiz.c.o"
+  "CMakeFiles/libmmgs_lsOnly_hsiz.dir/libexamples/mmgs/IsosurfDiscretization_lsOnly/main_hsiz.c.o.d"
+  "bin/libmmgs_lsOnly_hsiz"
+  "bin/libmmgs_lsOnly_hsiz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_lsOnly_hsiz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libmmgs_lsOnly_optim.dir/libexamples/mmgs/IsosurfDiscretization_lsOnly/main_optim.c.o"
+  "CMakeFiles/libmmgs_lsOnly_optim.dir/libexamples/mmgs/IsosurfDiscretization_lsOnly/main_optim.c.o.d"
+  "bin/libmmgs_lsOnly_optim"
+  "bin/libmmgs_lsOnly_optim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libmmgs_lsOnly_optim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/apptools.c" "CMakeFiles/mmg2d.dir/src/common/apptools.c.o" "gcc" "CMakeFiles/mmg2d.dir/src/common/apptools.c.o.d"
+  "/root/repo/src/mmg2d/mmg2d.c" "CMakeFiles/mmg2d.dir/src/mmg2d/mmg2d.c.o" "gcc" "CMakeFiles/mmg2d.dir/src/mmg2d/mmg2d.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/libmmg2d_a.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
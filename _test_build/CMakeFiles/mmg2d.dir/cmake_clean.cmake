@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmg2d.dir/src/common/apptools.c.o"
+  "CMakeFiles/mmg2d.dir/src/common/apptools.c.o.d"
+  "CMakeFiles/mmg2d.dir/src/mmg2d/mmg2d.c.o"
+  "CMakeFiles/mmg2d.dir/src/mmg2d/mmg2d.c.o.d"
+  "bin/mmg2d_O3"
+  "bin/mmg2d_O3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mmg2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmg2d_fortran_header"
+  "src/mmg2d/libmmg2df.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mmg2d_fortran_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
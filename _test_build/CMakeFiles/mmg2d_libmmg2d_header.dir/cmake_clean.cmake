@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmg2d_libmmg2d_header"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mmg2d_libmmg2d_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmg3d.dir/src/common/apptools.c.o"
+  "CMakeFiles/mmg3d.dir/src/common/apptools.c.o.d"
+  "CMakeFiles/mmg3d.dir/src/mmg3d/mmg3d.c.o"
+  "CMakeFiles/mmg3d.dir/src/mmg3d/mmg3d.c.o.d"
+  "bin/mmg3d_O3"
+  "bin/mmg3d_O3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mmg3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
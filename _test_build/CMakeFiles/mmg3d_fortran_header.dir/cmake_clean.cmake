@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmg3d_fortran_header"
+  "src/mmg3d/libmmg3df.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mmg3d_fortran_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmg_fortran_header"
+  "src/common/libmmgtypesf.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mmg_fortran_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmgmmgcommon_mmgversion_header"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mmgmmgcommon_mmgversion_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/apptools.c" "CMakeFiles/mmgs.dir/src/common/apptools.c.o" "gcc" "CMakeFiles/mmgs.dir/src/common/apptools.c.o.d"
+  "/root/repo/src/mmgs/mmgs.c" "CMakeFiles/mmgs.dir/src/mmgs/mmgs.c.o" "gcc" "CMakeFiles/mmgs.dir/src/mmgs/mmgs.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/libmmgs_a.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmgs.dir/src/common/apptools.c.o"
+  "CMakeFiles/mmgs.dir/src/common/apptools.c.o.d"
+  "CMakeFiles/mmgs.dir/src/mmgs/mmgs.c.o"
+  "CMakeFiles/mmgs.dir/src/mmgs/mmgs.c.o.d"
+  "bin/mmgs_O3"
+  "bin/mmgs_O3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mmgs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
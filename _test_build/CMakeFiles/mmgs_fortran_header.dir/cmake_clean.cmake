@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmgs_fortran_header"
+  "src/mmgs/libmmgsf.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mmgs_fortran_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/proctree_bench.dir/cmake/testing/code/proctree-bench.c.o"
+  "CMakeFiles/proctree_bench.dir/cmake/testing/code/proctree-bench.c.o.d"
+  "CMakeFiles/proctree_bench.dir/src/common/chrono.c.o"
+  "CMakeFiles/proctree_bench.dir/src/common/chrono.c.o.d"
+  "CMakeFiles/proctree_bench.dir/src/mmg3d/PRoctree_3d.c.o"
+  "CMakeFiles/proctree_bench.dir/src/mmg3d/PRoctree_3d.c.o.d"
+  "bin/proctree_bench"
+  "bin/proctree_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/proctree_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
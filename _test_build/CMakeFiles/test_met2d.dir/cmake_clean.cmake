@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_met2d.dir/cmake/testing/code/test_met2d.c.o"
+  "CMakeFiles/test_met2d.dir/cmake/testing/code/test_met2d.c.o.d"
+  "CMakeFiles/test_met2d.dir/src/common/anisosiz.c.o"
+  "CMakeFiles/test_met2d.dir/src/common/anisosiz.c.o.d"
+  "CMakeFiles/test_met2d.dir/src/common/bezier.c.o"
+  "CMakeFiles/test_met2d.dir/src/common/bezier.c.o.d"
+  "CMakeFiles/test_met2d.dir/src/common/eigenv.c.o"
+  "CMakeFiles/test_met2d.dir/src/common/eigenv.c.o.d"
+  "CMakeFiles/test_met2d.dir/src/common/isosiz.c.o"
+  "CMakeFiles/test_met2d.dir/src/common/isosiz.c.o.d"
+  "CMakeFiles/test_met2d.dir/src/common/mettools.c.o"
+  "CMakeFiles/test_met2d.dir/src/common/mettools.c.o.d"
+  "CMakeFiles/test_met2d.dir/src/common/tools.c.o"
+  "CMakeFiles/test_met2d.dir/src/common/tools.c.o.d"
+  "bin/test_met2d"
+  "bin/test_met2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_met2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cmake/testing/code/test_met3d.c" "CMakeFiles/test_met3d.dir/cmake/testing/code/test_met3d.c.o" "gcc" "CMakeFiles/test_met3d.dir/cmake/testing/code/test_met3d.c.o.d"
+  "/root/repo/src/common/anisosiz.c" "CMakeFiles/test_met3d.dir/src/common/anisosiz.c.o" "gcc" "CMakeFiles/test_met3d.dir/src/common/anisosiz.c.o.d"
+  "/root/repo/src/common/bezier.c" "CMakeFiles/test_met3d.dir/src/common/bezier.c.o" "gcc" "CMakeFiles/test_met3d.dir/src/common/bezier.c.o.d"
+  "/root/repo/src/common/eigenv.c" "CMakeFiles/test_met3d.dir/src/common/eigenv.c.o" "gcc" "CMakeFiles/test_met3d.dir/src/common/eigenv.c.o.d"
+  "/root/repo/src/common/isosiz.c" "CMakeFiles/test_met3d.dir/src/common/isosiz.c.o" "gcc" "CMakeFiles/test_met3d.dir/src/common/isosiz.c.o.d"
+  "/root/repo/src/common/mettools.c" "CMakeFiles/test_met3d.dir/src/common/mettools.c.o" "gcc" "CMakeFiles/test_met3d.dir/src/common/mettools.c.o.d"
+  "/root/repo/src/common/tools.c" "CMakeFiles/test_met3d.dir/src/common/tools.c.o" "gcc" "CMakeFiles/test_met3d.dir/src/common/tools.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/libmmg3d_a.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,96 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_test_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(libmmg2d_adp_example0_a "/root/repo/_test_build/bin/libmmg2d_adp_example0_a" "/root/repo/libexamples/mmg2d/adaptation_example0/example0_a/init.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_Adaptation_0_a-init.o")
+set_tests_properties(libmmg2d_adp_example0_a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;162;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_adp_example0_b "/root/repo/_test_build/bin/libmmg2d_adp_example0_b" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_Adaptation_0_b.o.mesh")
+set_tests_properties(libmmg2d_adp_example0_b PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;167;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_adp_example1 "/root/repo/_test_build/bin/libmmg2d_adp_example1" "/root/repo/libexamples/mmg2d/adaptation_example1/dom.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_Adaptation_1-dom.o")
+set_tests_properties(libmmg2d_adp_example1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;171;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_adp_example2 "/root/repo/_test_build/bin/libmmg2d_adp_example2" "/root/repo/libexamples/mmg2d/adaptation_example1/dom.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_Adaptation_2-dom.o" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_Adaptation_2-dom-end.o")
+set_tests_properties(libmmg2d_adp_example2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;176;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_gene_example0 "/root/repo/_test_build/bin/libmmg2d_gene_example0" "/root/repo/libexamples/mmg2d/squareGeneration_example0/carretest.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_Generation_0-carre.o")
+set_tests_properties(libmmg2d_gene_example0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;182;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_ls0_io_0 "/root/repo/_test_build/bin/libmmg2d_ls_example0" "/root/repo/libexamples/mmg2d/io_multisols_example0/naca-multiSols.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_io_0-naca.o" "0")
+set_tests_properties(libmmg2d_ls0_io_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;187;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_ls0_io_1 "/root/repo/_test_build/bin/libmmg2d_ls_example0" "/root/repo/libexamples/mmg2d/io_multisols_example0/naca-multiSols.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_io_0-naca.o" "1")
+set_tests_properties(libmmg2d_ls0_io_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;192;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_lsOnly "/root/repo/_test_build/bin/libmmg2d_lsOnly" "/root/repo/libexamples/mmg2d/IsosurfDiscretization_lsOnly/multi-mat.mesh" "/root/repo/libexamples/mmg2d/IsosurfDiscretization_lsOnly/multi-mat-sol.sol" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_lsOnly_multimat.o")
+set_tests_properties(libmmg2d_lsOnly PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;197;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg2d_lsAndMetric "/root/repo/_test_build/bin/libmmg2d_lsAndMetric" "/root/repo/libexamples/mmg2d/IsosurfDiscretization_lsOnly/multi-mat.mesh" "/root/repo/libexamples/mmg2d/IsosurfDiscretization_lsOnly/multi-mat-sol.sol" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_lsAndMetric_multimat.o")
+set_tests_properties(libmmg2d_lsAndMetric PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;203;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(test_met2d "/root/repo/_test_build/bin/test_met2d")
+set_tests_properties(test_met2d PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg2d_tests.cmake;218;ADD_TEST;/root/repo/cmake/testing/libmmg2d_tests.cmake;0;;/root/repo/cmake/modules/mmg2d.cmake;177;INCLUDE;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(mmg2d_very_short "/root/repo/_test_build/bin/mmg2d_O3" "/root/repo/libexamples/mmg2d/adaptation_example0/example0_a/init.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg2d_Adaptation_0_a-init.o")
+set_tests_properties(mmg2d_very_short PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/mmg2d.cmake;194;ADD_TEST;/root/repo/cmake/modules/mmg2d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;39;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_example0_a "/root/repo/_test_build/bin/libmmgs_example0_a" "/root/repo/libexamples/mmgs/adaptation_example0/example0_a/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_Adaptation_0_a-cube.o")
+set_tests_properties(libmmgs_example0_a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;127;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_example0_b "/root/repo/_test_build/bin/libmmgs_example0_b" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_Adaptation_0_b.o.mesh")
+set_tests_properties(libmmgs_example0_b PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;132;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_example1 "/root/repo/_test_build/bin/libmmgs_example1" "/root/repo/libexamples/mmgs/adaptation_example1/2spheres" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_Adaptation_1-2spheres_1.o" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_Adaptation_1-2spheres_2.o")
+set_tests_properties(libmmgs_example1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;136;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_example2 "/root/repo/_test_build/bin/libmmgs_example2" "/root/repo/libexamples/mmgs/IsosurfDiscretization_example0/teapot" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs-IsosurfDiscretization_0-teapot.o")
+set_tests_properties(libmmgs_example2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;142;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_example3_io_0 "/root/repo/_test_build/bin/libmmgs_example3" "/root/repo/libexamples/mmgs/io_multisols_example3/torus.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_io_3-naca.o" "0")
+set_tests_properties(libmmgs_example3_io_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;147;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_example3_io_1 "/root/repo/_test_build/bin/libmmgs_example3" "/root/repo/libexamples/mmgs/io_multisols_example3/torus.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_io_3-naca.o" "1")
+set_tests_properties(libmmgs_example3_io_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;152;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_lsOnly "/root/repo/_test_build/bin/libmmgs_lsOnly" "/root/repo/libexamples/mmgs/IsosurfDiscretization_lsOnly/multi-mat.mesh" "/root/repo/libexamples/mmgs/IsosurfDiscretization_lsOnly/multi-mat-sol.sol" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_lsOnly_multimat.o")
+set_tests_properties(libmmgs_lsOnly PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;157;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmgs_lsAndMetric "/root/repo/_test_build/bin/libmmgs_lsAndMetric" "/root/repo/libexamples/mmgs/IsosurfDiscretization_lsOnly/multi-mat.mesh" "/root/repo/libexamples/mmgs/IsosurfDiscretization_lsOnly/multi-mat-sol.sol" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_lsAndMetric_multimat.o")
+set_tests_properties(libmmgs_lsAndMetric PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmgs_tests.cmake;163;ADD_TEST;/root/repo/cmake/testing/libmmgs_tests.cmake;0;;/root/repo/cmake/modules/mmgs.cmake;157;INCLUDE;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(mmgs_very_short "/root/repo/_test_build/bin/mmgs_O3" "/root/repo/libexamples/mmgs/adaptation_example0/example0_a/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmgs_Adaptation_0_a-cube.o")
+set_tests_properties(mmgs_very_short PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/mmgs.cmake;175;ADD_TEST;/root/repo/cmake/modules/mmgs.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;43;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_example0_a "/root/repo/_test_build/bin/libmmg3d_example0_a" "/root/repo/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_Adaptation_0_a-cube.o")
+set_tests_properties(libmmg3d_example0_a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;226;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_example0_b "/root/repo/_test_build/bin/libmmg3d_example0_b" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_Adaptation_0_b.o.mesh")
+set_tests_properties(libmmg3d_example0_b PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;231;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_example1 "/root/repo/_test_build/bin/libmmg3d_example1" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_Adaptation_1.o.mesh")
+set_tests_properties(libmmg3d_example1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;235;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_example2 "/root/repo/_test_build/bin/libmmg3d_example2" "/root/repo/libexamples/mmg3d/adaptation_example2/2spheres.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_Adaptation_1-2spheres_1.o" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_Adaptation_1-2spheres_2.o")
+set_tests_properties(libmmg3d_example2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;239;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_example6_io_0 "/root/repo/_test_build/bin/libmmg3d_example6_io" "/root/repo/libexamples/mmg3d/io_multisols_example6/torus.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_io_6-naca.o" "0")
+set_tests_properties(libmmg3d_example6_io_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;258;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_example6_io_1 "/root/repo/_test_build/bin/libmmg3d_example6_io" "/root/repo/libexamples/mmg3d/io_multisols_example6/torus.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_io_6-naca.o" "1")
+set_tests_properties(libmmg3d_example6_io_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;263;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_lsOnly "/root/repo/_test_build/bin/libmmg3d_lsOnly" "/root/repo/libexamples/mmg3d/IsosurfDiscretization_lsOnly/plane.mesh" "/root/repo/libexamples/mmg3d/IsosurfDiscretization_lsOnly/m.sol" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_lsOnly_multimat.o")
+set_tests_properties(libmmg3d_lsOnly PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;268;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_lsAndMetric "/root/repo/_test_build/bin/libmmg3d_lsAndMetric" "/root/repo/libexamples/mmg3d/IsosurfDiscretization_lsOnly/plane.mesh" "/root/repo/libexamples/mmg3d/IsosurfDiscretization_lsOnly/m.sol" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_lsAndMetric_multimat.o")
+set_tests_properties(libmmg3d_lsAndMetric PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;274;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(test_met3d "/root/repo/_test_build/bin/test_met3d")
+set_tests_properties(test_met3d PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;280;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_threaded "/root/repo/_test_build/bin/libmmg3d_threaded" "/root/repo/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_threaded-cube.o.mesh" "2")
+set_tests_properties(libmmg3d_threaded PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;281;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_update "/root/repo/_test_build/bin/libmmg3d_update" "/root/repo/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_update-cube.o.mesh")
+set_tests_properties(libmmg3d_update PROPERTIES  FAIL_REGULAR_EXPRESSION "warm start unavailable" _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;286;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_region "/root/repo/_test_build/bin/libmmg3d_region" "/root/repo/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_region-cube.o.mesh")
+set_tests_properties(libmmg3d_region PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;294;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(hash_tetra_bench "/root/repo/_test_build/bin/hash_tetra_bench" "20" "4")
+set_tests_properties(hash_tetra_bench PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;299;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(proctree_bench "/root/repo/_test_build/bin/proctree_bench" "30")
+set_tests_properties(proctree_bench PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;301;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(ascii_tokenizer "/root/repo/_test_build/bin/ascii_tokenizer" "/root/repo/_test_build/TEST_OUTPUTS")
+set_tests_properties(ascii_tokenizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;303;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_generic_io_msh "/root/repo/_test_build/bin/libmmg3d_generic_io" "/root/repo/libexamples/mmg3d/io_generic_and_get_adja/cube.msh" "/root/repo/_test_build/TEST_OUTPUTS/cube.o.msh" "1")
+set_tests_properties(libmmg3d_generic_io_msh PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;306;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_generic_io_mesh "/root/repo/_test_build/bin/libmmg3d_generic_io" "/root/repo/libexamples/mmg3d/io_generic_and_get_adja/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/cube.o.mesh" "1")
+set_tests_properties(libmmg3d_generic_io_mesh PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;311;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_generic_io_vtk "/root/repo/_test_build/bin/libmmg3d_generic_io" "/root/repo/libexamples/mmg3d/io_generic_and_get_adja/cube.vtk" "/root/repo/_test_build/TEST_OUTPUTS/cube.o.vtk" "1")
+set_tests_properties(libmmg3d_generic_io_vtk PROPERTIES  PASS_REGULAR_EXPRESSION "VTK library not founded" _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;316;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg3d_generic_io_vtu "/root/repo/_test_build/bin/libmmg3d_generic_io" "/root/repo/libexamples/mmg3d/io_generic_and_get_adja/cube.vtu" "/root/repo/_test_build/TEST_OUTPUTS/cube.o.vtu" "1")
+set_tests_properties(libmmg3d_generic_io_vtu PROPERTIES  PASS_REGULAR_EXPRESSION "VTK library not founded" _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg3d_tests.cmake;321;ADD_TEST;/root/repo/cmake/testing/libmmg3d_tests.cmake;0;;/root/repo/cmake/modules/mmg3d.cmake;205;INCLUDE;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(mmg3d_very_short "/root/repo/_test_build/bin/mmg3d_O3" "/root/repo/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh" "/root/repo/_test_build/TEST_OUTPUTS/libmmg3d_Adaptation_0_a-cube.o")
+set_tests_properties(mmg3d_very_short PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/mmg3d.cmake;231;ADD_TEST;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(mmg3d_gz_ascii_out "/root/repo/_test_build/bin/mmg3d_O3" "-v" "5" "-in" "/root/repo/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh" "-sol" "/root/repo/libexamples/mmg3d/adaptation_example0/example0_a/cube.sol" "-out" "/root/repo/_test_build/TEST_OUTPUTS/mmg3d_gz-cube.o.mesh.gz")
+set_tests_properties(mmg3d_gz_ascii_out PROPERTIES  FIXTURES_SETUP "mmg3d_gz_ascii" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/mmg3d.cmake;245;ADD_TEST;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(mmg3d_gz_ascii_in "/root/repo/_test_build/bin/mmg3d_O3" "-v" "5" "-in" "/root/repo/_test_build/TEST_OUTPUTS/mmg3d_gz-cube.o.mesh.gz" "-sol" "/root/repo/_test_build/TEST_OUTPUTS/mmg3d_gz-cube.o.sol.gz" "-out" "/root/repo/_test_build/TEST_OUTPUTS/mmg3d_gz-cube.o2.meshb.gz")
+set_tests_properties(mmg3d_gz_ascii_in PROPERTIES  FAIL_REGULAR_EXPRESSION "NOT FOUND" FIXTURES_REQUIRED "mmg3d_gz_ascii" FIXTURES_SETUP "mmg3d_gz_binary" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/mmg3d.cmake;253;ADD_TEST;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(mmg3d_gz_binary_in "/root/repo/_test_build/bin/mmg3d_O3" "-v" "5" "-noinsert" "-noswap" "-nomove" "-in" "/root/repo/_test_build/TEST_OUTPUTS/mmg3d_gz-cube.o2.meshb.gz" "-sol" "/root/repo/_test_build/TEST_OUTPUTS/mmg3d_gz-cube.o2.sol.gz" "-out" "/root/repo/_test_build/TEST_OUTPUTS/mmg3d_gz-cube.o3.meshb")
+set_tests_properties(mmg3d_gz_binary_in PROPERTIES  FAIL_REGULAR_EXPRESSION "NOT FOUND" FIXTURES_REQUIRED "mmg3d_gz_binary" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/mmg3d.cmake;263;ADD_TEST;/root/repo/cmake/modules/mmg3d.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;47;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg_example0_a "/root/repo/_test_build/bin/libmmg_example0_a" "/root/repo/libexamples/mmg/adaptation_example0/init" "/root/repo/libexamples/mmg/adaptation_example0/cube" "/root/repo/_test_build/TEST_OUTPUTS/libmmg_Adaptation_0.o")
+set_tests_properties(libmmg_example0_a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg_tests.cmake;80;ADD_TEST;/root/repo/cmake/testing/libmmg_tests.cmake;0;;/root/repo/cmake/modules/mmg.cmake;170;INCLUDE;/root/repo/cmake/modules/mmg.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;51;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
+add_test(libmmg_cpp_a "/root/repo/_test_build/bin/libmmg_cpp_a" "/root/repo/libexamples/mmg/adaptation_example0_cpp/init" "/root/repo/libexamples/mmg/adaptation_example0_cpp/cube" "/root/repo/_test_build/TEST_OUTPUTS/libmmg_Adaptation_0_cpp.o")
+set_tests_properties(libmmg_cpp_a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/testing/libmmg_tests.cmake;84;ADD_TEST;/root/repo/cmake/testing/libmmg_tests.cmake;0;;/root/repo/cmake/modules/mmg.cmake;170;INCLUDE;/root/repo/cmake/modules/mmg.cmake;0;;/root/repo/cmake/modules/build-targets.cmake;51;INCLUDE;/root/repo/cmake/modules/build-targets.cmake;0;;/root/repo/CMakeLists.txt;290;INCLUDE;/root/repo/CMakeLists.txt;0;")
@@ -0,0 +1,16025 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 2
+
+SolAtVertices
+16013
+1 1
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+
+
+End
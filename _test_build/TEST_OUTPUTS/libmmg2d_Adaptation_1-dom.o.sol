@@ -0,0 +1,42611 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 2
+
+SolAtVertices
+42599
+1 1
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+ 0.01
+
+
+End
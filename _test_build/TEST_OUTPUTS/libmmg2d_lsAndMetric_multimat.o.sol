@@ -0,0 +1,2368 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 2
+
+SolAtVertices
+2356
+1 3
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10095.9644542992 -127.872487464871 270.389892485336
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10069.601992592 -194.221712052495 1141.62304090698
+ 9999.99999999999 0 100
+ 10069.1619451658 -132.779784598465 354.915779996449
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10194.6348383484 -214.530613587735 336.460155627169
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10067.1047728521 73.6479978640782 191.88137938393
+ 10073.5267738106 60.0766108018498 149.086869699082
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10036.6321904236 -26.7660554594716 119.557163155572
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10099.4916562312 105.652792219148 212.195463685507
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10326.2320167421 117.264992086348 143.050597076527
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10373.9979573357 -903.768097046431 2283.96051961782
+ 11122.4508417421 681.559069540625 518.02416276631
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10210.8189516419 86.7707246940239 142.737656640747
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10331.8131299961 277.46917387854 351.250534058962
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10869.6506366373 814.690295234241 879.570620129934
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10153.918905585 -75.5587632148438 137.091783344334
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10068.1831896274 -32.7245230315851 692.699090564352
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10106.3411720277 107.366568865136 208.401853111729
+ 9999.99999999999 0 100
+ 10204.6037259239 249.966261487807 409.737465927037
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 15315.7936270569 3647.04796201486 3568.9618934624
+ 11189.9811523891 -1782.68337213633 2770.5969240866
+ 9999.99999999999 0 100
+ 10694.5646484456 -209.202074664391 163.011424698668
+ 9999.99999999999 0 100
+ 10002.1161368747 0.751517071366111 304.414066393736
+ 9999.99999999999 0 100
+ 10167.8853435977 86.8179787657698 188.167308086233
+ 9999.99999999999 0 100
+ 10036.6321904236 -26.7660554594708 119.557163155572
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 12608.7762507131 1793.66708157734 1333.23784424009
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10493.9824832473 142.359753713225 154.293242801143
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11952.1263132315 1342.18666938842 1022.82197277588
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10479.8015900123 -706.480151012348 1140.25125002525
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10122.0356008517 139.161131173321 301.310889532928
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10429.5928791508 242.914835354324 237.357065489215
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10525.2125675347 296.983331336661 267.930290597992
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10025.4966512396 50.9819331546648 201.941132729852
+ 10018.5525586832 -27.3066588847648 140.191416837992
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10176.78426383 92.2084140135127 148.094731005385
+ 10558.1545545234 639.489582853812 832.676860314604
+ 9999.99999999999 0 100
+ 10112.2654733155 -73.8174822665479 148.943555234434
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10749.3625839835 1125.57525721231 3250.00631180148
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11470.588318924 -2066.7178149563 7032.10147246309
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10003.6829086404 19.338375989302 201.542781106059
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10242.7833824843 336.489669580494 569.458422500492
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10055.450293837 -184.412908365681 713.308215676638
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10249.7428392901 443.056327586612 961.694589537389
+ 9999.99999999999 0 100
+ 10141.7044104895 295.174957312839 807.270754702309
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10002.3712694666 -11.5371842207591 156.133063583692
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10278.3270834367 -445.223920345279 812.199247015452
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10010.157470434 -21.6875230920841 146.30568810672
+ 9999.99999999999 0 100
+ 10394.8949416664 -135.262896269444 159.031715235055
+ 10389.9499067327 -352.274660330781 421.520183938763
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10272.5705905441 444.399588381857 824.549900118453
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11127.6993008994 -1580.46119261565 3764.53158768294
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 28798.8362340488 22637.3504031865 37262.3980694115
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11296.5697961064 -1687.0201005214 2295.05099386845
+ 9999.99999999999 0 100
+ 10016.5999755305 -8.70620339460414 104.566149956608
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11772.1080670413 897.78268324142 554.833292234762
+ 10229.8786563049 -206.79320039767 286.026090538759
+ 9999.99999999999 0 100
+ 10062.3902000489 -165.839196811706 540.816653538145
+ 9999.99999999999 0 100
+ 10061.4443531943 -105.218505243857 456.818183265168
+ 10177.1534048154 258.14239448116 476.157014300155
+ 10007.4881758524 -36.4330016065214 277.261275939847
+ 9999.99999999999 0 100
+ 11500.556892882 -1702.6907130643 2094.77888099233
+ 10196.7220456476 76.9401584472725 446.143452807161
+ 9999.99999999999 0 100
+ 10102.1991273881 -132.975473188787 273.01983805229
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10210.8189516419 86.7707246940248 142.737656640747
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10633.3052506363 -389.250637467652 351.122930159871
+ 10065.8627950733 151.941874387913 451.485684305424
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10162.7047323729 -152.61740649899 243.155472042994
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10138.8592461942 230.879195553405 483.879391544732
+ 9999.99999999999 0 100
+ 27686.3995066043 19246.4004341068 29475.7736239836
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10011.4992526781 -120.52377586818 1363.21083257361
+ 9999.99999999999 0 100
+ 10037.4411773503 22.7872180773433 113.868615905059
+ 12401.7146857557 1188.9453815375 922.103948580945
+ 10456.0798407904 664.585263257583 1068.41283616859
+ 9999.99999999999 0 100
+ 10733.4070791547 459.465536201874 387.84638839401
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10748.0515574922 225.859507608531 763.563781071289
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000 0 100
+ 10195.9922781041 315.915687773309 711.591906460488
+ 10179.280155433 -590.76191427923 2046.67189193343
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10142.8923827072 240.31817474656 702.293018546452
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10018.2430331982 -52.1581954024283 494.410284637432
+ 9999.99999999999 0 100
+ 10131.4134809173 -322.620031045411 892.032017607678
+ 9999.99999999999 0 100
+ 10000 0 100
+ 10000.0212126714 1.90568774503624 271.201718032231
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10767.7585624013 1118.75373712529 1730.21291539511
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11530.3643824911 1976.56665919529 8300.88060108925
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10176.78426383 92.2084140135127 148.094731005385
+ 10090.5981539396 -100.889198667918 219.770031603084
+ 9999.99999999999 0 100
+ 10934.7789855288 938.92082299693 2299.27712043651
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10151.6097308471 -231.223992394072 670.820722815182
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10146.0911070192 19.9232831525437 419.678810094108
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10802.8215454855 -61.0772394140066 598.374583357025
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10362.0471749518 -191.745381740822 312.348068255603
+ 10119.5247770526 -185.25637023698 390.210164288668
+ 10059.0745740117 -106.156949777322 290.763931429838
+ 10049.1210656155 69.8190941011389 220.777343565747
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10157.4409302491 489.579411087646 1820.01652333531
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10650.6577384621 180.56123679409 180.949583904178
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11326.2897593787 -889.859666005015 716.82130350412
+ 9999.99999999999 0 100
+ 10210.2381913687 -137.787464783805 209.146919095823
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10516.5890464155 -887.781133864624 2230.48263046596
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10388.3964174716 -374.559550613085 461.215630846359
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10221.8435643101 -137.708572702151 185.482087590141
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10302.5326437018 -504.316211668823 952.560458154101
+ 10000.0001058832 0.0779486147545319 157.383857842929
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10176.5330471514 405.288761157669 1030.47156082833
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10960.9579418771 335.506874181255 287.540219681327
+ 9999.99999999999 0 100
+ 10109.1943404973 141.708204182982 379.515205045928
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10001.7245456088 -18.4799387469312 298.027894625196
+ 10000.1294343163 11.6280211050982 1144.62926593249
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11093.1200652025 -1487.92941598105 2572.32221570652
+ 9999.99999999999 0 100
+ 10085.2540792329 -129.445230840188 296.542710190907
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10224.9760490318 116.881464686386 472.921281097542
+ 9999.99999999999 0 100
+ 10005.7362881297 63.4932198959349 802.787043051413
+ 9999.99999999999 0 100
+ 10013.80709028 -23.4199149117551 214.088427637091
+ 9999.99999999999 0 100
+ 11416.7420015781 2130.79400922704 3304.73530445238
+ 9999.99999999999 0 100
+ 10058.9014003639 -58.5690050618145 277.839818840824
+ 9999.99999999999 0 100
+ 10276.5077041064 457.748021191849 1162.56687235242
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10332.9475686665 124.978187362703 146.912934006472
+ 9999.99999999999 0 100
+ 10009.6334587636 81.2723710154274 785.651794700599
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10130.8045142762 -235.055579916734 522.394639479554
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 18666.1670578526 9857.12312929782 17192.9694469019
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10706.8692878586 541.049005484696 514.127521684821
+ 10183.9825849743 -171.960719471937 272.523997459154
+ 9999.99999999999 0 100
+ 10050.9704893187 -34.7833464933958 257.0056603722
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10613.1762805263 430.736493597491 1283.61095618213
+ 9999.99999999999 0 100
+ 10002.8100661161 18.9439225104975 227.709521858339
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11731.6909642131 2230.79907193517 3341.31321476783
+ 9999.99999999999 0 100
+ 10103.8046546831 -64.436355774869 139.99862971676
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10052.8448707778 172.094840502533 660.444820692508
+ 10015.8239511928 -52.1429026852886 271.820695559065
+ 12336.1486697775 1021.14358584008 546.347544739799
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10525.9049989195 527.731868452412 815.498454161278
+ 9999.99999999999 0 100
+ 11319.3891888512 115.534335872598 978.211011938418
+ 9999.99999999999 0 100
+ 10643.4329894934 -646.666945247836 749.917155173254
+ 14742.46926817 1745.04609522881 870.271292472279
+ 9999.99999999999 0 100
+ 10011.5728519936 -56.3066017125608 373.954371676512
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10326.2115767843 231.619796700751 264.456855739257
+ 9999.99999999999 0 100
+ 10098.4441803166 107.958385196175 244.083378995902
+ 10104.2535124397 164.690248970194 738.461765389639
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 15316.6430365427 -1758.62808442777 681.715326396875
+ 10485.5864702488 -705.087019788402 1359.27433669747
+ 9999.99999999999 0 100
+ 10340.8789930076 -469.285623191555 746.062094326089
+ 10015.7381372762 -42.5293193433284 214.927387661285
+ 9999.99999999999 0 100
+ 10273.5642057335 -263.818308702175 354.419615387439
+ 9999.99999999999 0 100
+ 10170.6528358744 -108.607903055439 169.120894157208
+ 9999.99999999999 0 100
+ 10339.7008973692 -277.337923101494 326.423669133422
+ 9999.99999999999 0 100
+ 10007.4650906215 31.0338038053929 1021.02237462095
+ 10382.6210136193 191.258074368529 824.647978271006
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 12244.8844570669 -2019.44299162802 1916.64137929123
+ 10007.2789334686 -60.8257004090628 608.28405647756
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10143.3226364492 329.043511737109 855.425906881664
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10323.600380994 -266.053913465829 357.654320926368
+ 10139.2462556261 64.8170796641917 487.973278089665
+ 10226.2222352009 -421.915003107289 886.891128048985
+ 10333.954312542 -263.285455334372 307.571001143768
+ 10146.9688913003 304.526275829854 794.298923170781
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10397.2442544489 97.7476421860202 133.66507364861
+ 9999.99999999999 0 100
+ 10003.8728699382 20.335832988302 206.780271460358
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10033.1348204834 -56.9304505594882 269.465630337708
+ 9999.99999999999 0 100
+ 10000.9673886086 10.70772880652 218.520577127098
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10028.3054886554 254.986034766311 2397.006023013
+ 10325.9057336179 125.205552641029 772.080641447885
+ 10008.0788216712 -35.945267459747 259.932017977039
+ 10718.6765790604 -874.946074037789 1622.71893032722
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10041.6417881829 83.2650076917888 266.492886315461
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10135.6290581 23.7921147450348 404.276893535018
+ 10005.5383450758 26.0787776258959 222.798892657529
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11139.4230626555 -255.141305657329 233.176239778997
+ 10093.5915138791 -119.321955684203 273.971407243853
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10030.5105007336 70.0208301687213 260.6960403675
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10045.7169883998 104.919336084327 340.787231829653
+ 10593.659322112 127.222888077442 128.515003300948
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10103.8046546831 -64.4363557748702 139.99862971676
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10261.4805500425 434.759806792038 822.868640023577
+ 10098.9293054345 -156.093815181679 653.811971102436
+ 10186.7343660915 324.520808068782 667.745851188839
+ 9999.99999999999 0 100
+ 10499.0876142394 733.409443216666 1863.69942890001
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10011.2630965515 -28.2757269389428 536.820646039644
+ 9999.99999999999 0 100
+ 10009.1684033901 -24.3705045514455 164.779162393076
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10059.9867170237 -169.75572914828 580.389809751628
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10683.5044260868 300.676975237868 235.295174424859
+ 11470.0923077448 -1453.24440008695 2696.51576530366
+ 9999.99999999999 0 100
+ 10112.2272029681 257.558602133608 691.090500151688
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10047.8368558693 29.1141717213853 117.719287349046
+ 10093.1374682371 57.4051441700384 847.515817665402
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10153.0099710776 -251.587219472409 635.385082439421
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 13601.1588636053 -2932.99265639536 5076.82783309725
+ 10413.995638426 76.2986618888877 505.481862157557
+ 9999.99999999999 0 100
+ 10115.5810355845 -603.702420360166 3253.25615924507
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10036.5622593611 -57.986167700906 191.963563067283
+ 10012.5037262201 -71.317882659206 506.777971418343
+ 10190.4621099386 -175.490792061637 261.696298063379
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10116.1591931949 -328.717581431854 1030.23414996573
+ 10343.0166280476 397.602797318591 778.054127077704
+ 10076.0566040655 -183.791197186716 544.132427135737
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10433.9942559393 -558.706889679909 819.256958597734
+ 9999.99999999999 0 100
+ 10308.290747513 382.707010883382 575.086123605167
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10022.3245275104 3.29864478571738 143.12387579412
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10037.459497199 30.6070770880037 125.008161825971
+ 10184.2494628002 422.847873132919 1070.42521099163
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10134.9792112452 -118.91315344177 204.759376877508
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10625.3205488741 430.745995600973 714.996833439378
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10048.9837019334 -255.851483470878 1436.36248406144
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10600.1240621075 682.020053973275 967.724234033441
+ 9999.99999999999 0 100
+ 10960.5292726049 -317.721867559587 205.095376064683
+ 9999.99999999999 0 100
+ 10153.0954270055 -141.061325818911 229.973167918808
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10249.6805339472 -219.962017638044 293.780782340153
+ 10017.9986016317 -59.3087858977918 295.433631825771
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000.014608836 -1.38011345047533 230.380896883659
+ 10722.0454442775 342.603691926678 538.946099962118
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10017.7060292151 -51.1559674829547 247.798977248388
+ 10102.1991273881 -132.975473188786 273.01983805229
+ 9999.99999999999 0 100
+ 10289.4221684543 307.344971283313 426.377664425709
+ 11223.8899827383 -1575.58713325852 2128.34801289545
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10702.04148746 51.2854454018694 147.906638023565
+ 10520.4481762252 -1472.81038240557 4267.88937229936
+ 9999.99999999999 0 100
+ 10119.4574742918 182.697718473399 465.480480297254
+ 9999.99999999999 0 100
+ 10298.4954749874 -262.966703475351 331.666785366182
+ 10007.5317251127 83.3663630497842 1022.75678999543
+ 9999.99999999999 0 100
+ 10025.2019242285 -131.634593664166 787.553303154392
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000.0221891586 2.45046639613333 370.617992433293
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11840.6005329678 -2369.51569022943 3150.41996113644
+ 10002.2010507865 3.55860893964091 493.017735299929
+ 10641.9848841185 336.093391464018 285.738314571211
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10063.1439016186 90.753829623053 230.436311031242
+ 12012.0725366627 3067.81535058083 4777.51080230408
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10163.934432653 576.66954827371 5428.08319798036
+ 10336.5882173726 -346.760813666622 753.004687853538
+ 9999.99999999999 0 100
+ 10017.7297086195 -92.6057458449894 583.697975391192
+ 10470.245972813 -100.032749925846 647.153384965248
+ 9999.99999999999 0 100
+ 10494.0638005868 57.6056117004123 152.553732988407
+ 10708.9273278889 398.671820311011 324.196774559961
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10003.9096576061 23.4281306867885 240.390121791272
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10565.7268215211 -284.785703284292 256.90168939792
+ 10111.1691251942 127.368838828821 245.929196404675
+ 9999.99999999999 0 100
+ 11077.277265493 -712.446761394087 674.261204151417
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10436.9273122498 -1439.75787371493 4844.27365103491
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10046.5490349978 -17.1705757345381 185.124895586521
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10410.9784640423 -122.253757764806 139.097308286916
+ 9999.99999999999 0 100
+ 11165.4273451266 -1552.93014136564 2169.27702018169
+ 9999.99999999999 0 100
+ 10268.1402240359 258.380511476415 704.429399307288
+ 10011.8967410794 131.681390529763 1557.54106071512
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10810.4500013665 1374.83738172957 2432.25716949109
+ 10042.4827126633 108.02273641939 374.674352271443
+ 10000.6441616347 -8.91700911689548 223.436490632517
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10539.1597193703 -914.478879936379 1651.06472498798
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10108.0647494056 -125.676102774536 259.950930141208
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10079.8379881357 203.00770379203 616.196972910445
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10100.7274461604 71.5194440119251 150.780904974271
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10187.0107319058 125.319998007409 183.979682559023
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10056.3838600314 -95.0591988605319 487.691060970769
+ 9999.99999999999 0 100
+ 10940.7675246883 -481.948633383196 346.898919365743
+ 9999.99999999999 0 100
+ 10336.1084619901 -1107.54075335953 3749.55560204982
+ 9999.99999999999 0 100
+ 10067.9566075262 68.8705116652162 188.218113322295
+ 10492.8208521648 836.015212424767 1518.2058903057
+ 9999.99999999999 0 100
+ 10041.7259712057 63.6197615395602 197.001314562483
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10004.3601479458 -70.9510132737708 1254.55859460622
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10212.1464214666 -452.960256626741 1067.12917740971
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10733.0125156369 -901.951062803888 1230.57459860294
+ 10102.2337936946 -131.611707098951 269.431660701514
+ 10031.3222145196 -83.2574810503117 321.306451575993
+ 9999.99999999999 0 100
+ 10182.7264718487 464.626956893754 1281.42821282698
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10316.954079522 142.314340487894 163.900018384509
+ 9999.99999999999 0 100
+ 11132.2352280619 -880.908521194608 823.837244958526
+ 12683.7254172501 3337.93736270133 5731.95961101272
+ 9999.99999999999 0 100
+ 10350.8026403363 249.469127854483 277.879831588147
+ 9999.99999999999 0 100
+ 10056.9885956776 -111.253522116449 317.189878714212
+ 10000.0003380399 0.248856707198857 283.202200669341
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11362.2238497738 -1517.83053652172 3161.76814478038
+ 10020.655901707 -18.945945681236 119.501061554246
+ 9999.99999999999 0 100
+ 10754.1242275626 1270.81360467238 2241.51350506286
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10298.4070270275 316.886227624879 436.509774111591
+ 10702.4348337156 -601.309903869812 614.743266046932
+ 10313.598719562 627.057600930915 1353.83558783153
+ 9999.99999999999 0 100
+ 10031.9583742076 48.7270658423499 174.294359599911
+ 10067.5742498481 -33.172187161081 116.28422074271
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10894.0278885202 1014.83404291598 1251.96421485896
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10268.6681938557 -369.6562880234 619.443907842459
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11853.5317939221 -881.297946377907 519.03034673413
+ 10005.6958269072 14.1609568573024 1324.5839388917
+ 10162.9135607793 -315.332926500324 731.932522727302
+ 9999.99999999999 0 100
+ 16425.095840136 9476.87973517396 14981.7111410708
+ 11152.1964327501 2111.99449247059 4654.12873182415
+ 9999.99999999999 0 100
+ 10522.9043023525 797.274360845097 1315.60752818675
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11771.8663236421 2301.97911795463 3518.36669810169
+ 10006.9463992143 -36.2824056494572 289.510121589561
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10116.0447985112 -452.849475793686 1992.7898473379
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10093.185601529 -150.623391475678 426.834877375126
+ 10013.9846730659 -28.7696130078913 186.796364898687
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10483.6620836997 -229.966598092949 209.342117194535
+ 10392.1627747484 784.150678458317 1667.951692817
+ 9999.99999999999 0 100
+ 10204.4547063307 -88.8358714996076 139.711197293437
+ 9999.99999999999 0 100
+ 10181.1686229773 98.7916460311643 315.10338326112
+ 10645.3163440563 763.557317293492 1158.89643914912
+ 10619.2634526475 1238.25076678812 2575.94937969646
+ 9999.99999999999 0 100
+ 10028.1991180511 -68.6583428160334 267.167215290482
+ 9999.99999999999 0 100
+ 10671.2986766555 927.36236616224 2136.52524069713
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10246.0100226663 813.295023401806 2788.70669544745
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10009.4634791428 -39.0875594288081 261.44562470556
+ 10006.7288443817 -51.0689279405523 487.590387450766
+ 9999.99999999999 0 100
+ 10175.5926048056 171.582873878836 267.664706842949
+ 9999.99999999999 0 100
+ 11061.2791014328 2122.08496320412 4343.22365810981
+ 10139.7560152306 -268.309018119305 615.110058664414
+ 10033.1620814851 67.8288670710714 238.735417142511
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10027.6699805912 81.1747980498083 383.141618557168
+ 10011.0062390952 34.9002106231987 210.666749195777
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10004.3018111907 -21.9576008572275 212.077498066629
+ 10092.3421616838 -63.2645689640285 143.343209788706
+ 9999.99999999999 0 100
+ 10016.7111493227 55.2461010822186 282.640441172049
+ 10053.1444623544 90.1536101592523 252.935471819156
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 13897.0022399254 7792.26675033424 15681.058816514
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 13106.0932227062 -1598.93520553228 923.089845726871
+ 9999.99999999999 0 100
+ 11680.606109358 -1585.16094247198 1595.13630799456
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000.0067958213 0.610517799318232 154.847231069935
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10836.0886065935 1274.7877698324 2043.67420545927
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10419.8842995178 438.66077260656 761.878163621179
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10020.9614806919 -159.088290092095 1307.4091719222
+ 9999.99999999999 0 100
+ 11504.6806743683 3008.6903899175 6116.03916138718
+ 10471.4422140237 942.674205163106 1984.92805829895
+ 10432.4324452065 319.874289325287 349.039234867524
+ 9999.99999999999 0 100
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10716.4015916553 1432.48372950618 2964.32869385248
+ 10901.6695620821 -543.579787096243 427.702073315291
+ 9999.99999999999 0 100
+ 10278.4931053826 323.054273010128 474.745590799222
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10222.272718636 444.446322660184 988.694460293432
+ 10195.5950471496 102.858113393369 157.250000968971
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10029.038752719 -220.391182492285 1772.67078549832
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10306.5387615873 60.7981547528308 140.183800101497
+ 10170.6528358744 -108.607903055439 169.120894157208
+ 10528.7129851445 1057.19020954171 2213.90900271811
+ 9999.99999999999 0 100
+ 10227.448270599 -292.807828883395 476.94911651606
+ 9999.99999999999 0 100
+ 10031.4956482522 114.985406875744 838.155570324388
+ 9999.99999999999 0 100
+ 10773.5853145839 1341.38978578605 2437.97512413104
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10058.9014003639 -58.5690050618145 277.839818840824
+ 10024.6486994386 109.188667679309 583.683335069316
+ 10064.0009726002 102.657839854769 294.912584173118
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11177.6605499094 677.658921689711 656.682732640117
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10188.9427622455 -510.581839015277 1479.75020177564
+ 11487.1258622853 -1014.52557910822 1362.78840277601
+ 10824.2737856133 1648.1800156547 3395.62508406403
+ 10460.9565099836 921.707472809732 1943.00394296089
+ 11287.3946542063 -1395.19504505075 2715.15089438083
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10258.3643081886 252.4644506288 346.699318795862
+ 9999.99999999999 0 100
+ 10089.6963904342 -242.38741636173 755.005840548408
+ 10196.0607288961 298.934607373088 555.786837009391
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10018.0842016306 94.9573081355397 598.605940838128
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10122.4159670655 -77.8482431314961 149.506196813506
+ 10154.4151253271 61.0227337448929 124.115345085612
+ 11689.0086608537 2339.34112859166 3951.77244725201
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11482.589769224 -745.845915823037 475.212443588536
+ 9999.99999999999 0 100
+ 10162.2340955055 324.395848487358 748.647044186088
+ 9999.99999999999 0 100
+ 10097.8599038387 210.93705990251 554.674912757548
+ 10466.1614378024 540.751068819913 727.275648986303
+ 9999.99999999999 0 100
+ 14177.8931637778 5951.60914127631 9348.77696976906
+ 10057.4642505919 142.447668983129 453.112381867234
+ 9999.99999999999 0 100
+ 10321.949522755 -783.872767323549 2008.54923496538
+ 12032.0423301089 1909.47285371969 2128.9754471364
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10310.5741197831 360.268511295662 517.914410646459
+ 9999.99999999999 0 100
+ 10241.3772316146 482.646829639495 1065.07844009503
+ 10026.6540294276 38.8394170927212 156.595582450246
+ 10609.7764769829 -524.978572634113 551.972996873507
+ 10032.4528571971 64.8912431970967 229.753550452728
+ 9999.99999999999 0 100
+ 10211.0879712099 455.000202137944 1080.75310856869
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10003.2172425292 -1.96441684133483 595.128968703862
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10157.2727280046 -267.786030603375 555.955454554126
+ 10361.1501483691 722.139254677216 1543.95649704328
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10537.9473619949 376.045705325909 479.99786941617
+ 10210.3353299063 -84.3497404612523 225.680776600701
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10158.2160572355 -447.733823278702 1367.036860926
+ 10122.8584870724 61.7156697266568 131.001715718396
+ 10003.2678366822 18.7303536040093 207.35730706459
+ 11138.8341604553 972.093325605615 929.765620403611
+ 9999.99999999999 0 100
+ 10141.3503523512 -487.335113499705 1780.19045513009
+ 10454.5446822787 459.579221950554 598.405432874081
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10083.4906403813 50.813557810584 130.925833669236
+ 9999.99999999999 0 100
+ 10096.9088671957 43.4330135094047 119.465986107319
+ 10052.3127243953 -208.449536874103 930.604980437798
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10054.5113242958 234.766218731664 1139.98119420526
+ 9999.99999999999 0 100
+ 10059.5239696786 -57.3491178324234 155.253729445693
+ 10104.2564523886 90.009950454086 177.710213565939
+ 9999.99999999999 0 100
+ 10340.4966355556 -223.400375963172 253.565778193865
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11053.756710606 -344.366392229344 286.979542846467
+ 10149.3330556644 -219.796464782709 423.508319815962
+ 9999.99999999999 0 100
+ 10803.7020710294 932.300955589097 1181.47671024293
+ 10038.1825267781 -71.2121904813622 232.814051375337
+ 11707.0262295739 2007.91416705593 3954.66535760763
+ 9999.99999999999 0 100
+ 10296.9430512561 -233.808343055574 306.089562890004
+ 10247.5386599099 -377.893501841966 725.462581579865
+ 10258.5610871453 -852.007532184241 2907.52545912147
+ 10034.5494330047 162.685236853511 866.046906949538
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10103.8248134859 207.603329989647 515.114086659517
+ 9999.99999999999 0 100
+ 10527.9194712292 -613.191720940719 827.719776844817
+ 9999.99999999999 0 100
+ 10702.3251080237 -317.106865230578 243.17694587243
+ 10119.5870434966 182.334861733127 378.006720721253
+ 10155.2577687621 310.446305845417 720.75417920459
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10967.3240313165 1454.86492855768 2288.13126917401
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10415.6711172364 895.979251121744 2031.28361618676
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10061.9979707231 299.248163307271 1544.39345672665
+ 9999.99999999999 0 100
+ 10185.6158172725 -84.1289997317663 138.130848436677
+ 10109.1493166578 218.249962060797 536.402603315076
+ 9999.99999999999 0 100
+ 11098.9944777044 1274.84255507591 1578.82775865009
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11065.2366500144 999.352233355427 1074.98631620114
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10008.0028188728 -33.0545091893037 236.526965699251
+ 9999.99999999999 0 100
+ 10005.0619557374 -16.6800985542272 154.964069662153
+ 9999.99999999999 0 100
+ 10037.3222411604 162.770195850992 904.911151848138
+ 9999.99999999999 0 100
+ 10080.8572680097 29.0900503273974 163.614148357016
+ 10060.742272911 283.036165523534 1437.01431890429
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10175.3179619889 206.678633088561 343.649064196022
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11620.09880124 1879.3278193375 2280.03559402218
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11641.8963225544 3205.52981382608 6779.90020022367
+ 10983.084938269 1158.34965614273 2203.40062875953
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10030.3564847356 181.907410632167 1190.05724250043
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10189.5830778798 -171.422199848837 282.295383612915
+ 10134.006214888 -441.997847243807 1557.85848164891
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10278.9302494952 -410.54462113057 704.261768826608
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11755.0885347895 2035.91701092897 2461.68033305917
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11379.1970768471 2102.867509362 3306.25082242731
+ 11095.924287949 182.345532083893 261.674336122565
+ 9999.99999999999 0 100
+ 10000.4768096118 -4.99744604235582 152.378279143922
+ 10151.9107937491 373.821689514287 1364.23458082668
+ 9999.99999999999 0 100
+ 10562.0108328544 -1358.10223282146 3381.86142858997
+ 10035.314667781 29.6628918967584 124.915628858111
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10236.8413002159 214.903556548556 464.047798934911
+ 9999.99999999999 0 100
+ 10401.956355754 473.857836504789 658.620969671658
+ 9999.99999999999 0 100
+ 10149.9977463279 -85.6142990403655 148.866122189248
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10070.9159964732 -370.408159925621 2034.7144757566
+ 12934.850144319 -1288.99344549581 759.787877953718
+ 9999.99999999999 0 100
+ 10063.842354454 272.70979236075 1264.91052821355
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10824.1531762495 1096.41180174991 1558.61093988263
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10175.0727102844 -314.605483390258 665.345735600031
+ 10148.5344171428 -358.934226495132 967.366509580082
+ 9999.99999999999 0 100
+ 11186.0669496622 -1380.1799459895 1706.06168467476
+ 10013.9009203268 -67.6335949609927 429.064771238641
+ 10036.0388358233 36.413486799431 148.626498035698
+ 10604.3929941511 -408.932392506552 376.683719466343
+ 10428.185148363 -412.930782920406 498.219863848971
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10101.7813446683 179.475380353979 1614.94346148837
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10261.9619632124 -633.032508192238 1629.72649736672
+ 10164.9330640633 -122.89243410265 191.567754746108
+ 10430.5124046727 283.961087644672 492.050730578814
+ 10013.6910159253 115.503824032683 1074.44436840356
+ 10330.1914064411 -844.179096569824 2601.48839599443
+ 10681.7520171003 1363.20003114112 2825.79219172262
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11548.4333179144 -898.168707294888 620.982736182879
+ 10389.4857498254 -515.368824798688 781.937723507049
+ 9999.99999999999 0 100
+ 10100.7202822456 93.3854141765381 186.584701576396
+ 9999.99999999999 0 100
+ 10942.8163040939 1080.20475713495 1337.61363933815
+ 11261.7511703626 2522.93970767636 5144.75440014107
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10052.9715784496 1.15123678371669 344.597774293763
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10006.6096926655 -55.2332546526269 561.551326800879
+ 10329.2315810671 658.316353022811 1416.33915328702
+ 9999.99999999999 0 100
+ 11132.5019031509 -1062.74469090138 1222.90154966082
+ 10057.0481789512 85.3248614227919 227.617254584872
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10806.6315923226 -1038.42532912961 1436.82733783456
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11267.1607054949 -1253.23710137727 1636.75273000825
+ 9999.99999999999 0 100
+ 10322.9315849496 -162.058567916665 288.94332476638
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10126.0248183046 251.993440324588 603.874513138809
+ 9999.99999999999 0 100
+ 10130.8273476058 -126.047254812706 221.441814242801
+ 10289.5365565086 416.137594375252 698.095451367478
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10023.7684916394 79.7304771340322 367.452772370195
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10105.4604127674 52.9760715656265 126.611541571681
+ 10162.9698412836 -258.463145111683 509.911409711505
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10243.635266985 308.402294546944 490.386730372921
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10839.9025372003 -184.955363649485 140.729114424087
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10353.9999481855 -341.065705979803 428.604047519596
+ 10272.5125375536 261.07593804066 508.178838246514
+ 9999.99999999999 0 100
+ 10141.2696229096 231.632072004901 576.525982339171
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10662.3629196551 -1050.47904612905 1766.01449690275
+ 10338.3420903754 21.3798782459476 120.428071018653
+ 9999.99999999999 0 100
+ 11185.7215059981 -1399.41104961972 3513.35246034338
+ 10234.2753193914 468.446172038336 1036.68345717082
+ 10355.9101938363 365.9520899441 695.292495304345
+ 9999.99999999999 0 100
+ 10270.2230349773 -503.978543668945 1039.94345263728
+ 10085.7470851018 135.01680986989 439.919980208341
+ 10059.1391704281 -244.265962210485 1108.90593937457
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10650.7644024601 -52.379095150717 793.685238800698
+ 10019.7637674548 93.062979906547 538.21190716365
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10055.4481952092 261.092642808096 1329.4244721819
+ 9999.99999999999 0 100
+ 10564.6328855986 481.962939440154 511.396999569929
+ 11064.2752793959 908.450880411045 875.441296154203
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10083.692411373 757.964238905027 6964.53858879281
+ 10238.5967963073 -689.274386105281 3261.72173933986
+ 10270.4151545087 -249.159109208088 329.573900228152
+ 10064.2593126335 -177.474272992722 1065.54941570984
+ 9999.99999999999 0 100
+ 10158.9968404851 35.1334973906211 429.84904519219
+ 10000 0 100
+ 10159.1634426439 453.788589742586 1393.7900862153
+ 10196.2251459444 128.796288887498 292.229332201853
+ 10057.5668512679 -282.80483273733 1661.82509967155
+ 10000.231857114 -22.5395682364915 2291.14318930107
+ 13045.0392182099 -675.579234529954 253.066589921253
+ 11180.1068628524 809.693274258663 655.545619652665
+ 10000 0 100
+ 12223.9380857819 759.030331063485 435.177533515346
+ 12350.3902638396 -1387.14651531515 918.662110949876
+ 10002.9687509274 14.8913215982064 174.695204940358
+ 10224.0563442639 -213.630383192607 346.965191667754
+ 10054.7083059263 -40.4079427082778 129.845593027794
+ 12370.6822162342 2197.01213031933 2202.86958784224
+ 10616.1262550192 -392.118772783266 349.554585146275
+ 10267.6351525691 -557.223382949725 1260.15364770045
+ 10285.7107536689 -259.464682239943 335.629637545581
+ 10379.4702801905 567.559730504587 948.878198125923
+ 10148.6920676945 88.2331055270647 152.357069423116
+ 10000 6.72703169447408e-14 100
+ 10000 6.72703169447408e-14 100
+ 10000 0 100
+ 10000 1.34540633889482e-13 100
+ 10238.304303732 165.017549363491 214.268987892709
+ 10124.539935782 320.825538359124 926.474057635637
+ 10000 -6.811119590655e-13 100
+ 10345.1614426983 337.279536093869 429.577616139236
+ 10031.0170159997 152.383081111969 848.640791538527
+ 10000 -1.51358213125667e-13 100
+ 10000 1.34540633889482e-13 100
+ 10705.5750701166 -447.302713150695 383.569708831855
+ 10001.1699749264 34.0057505227003 1088.38961628304
+ 12455.7848000542 987.802630594859 727.629859739482
+ 10109.4765248665 116.922413326215 224.874723185654
+ 10141.6417522706 -236.508634101294 494.914162722386
+ 10480.3803201963 799.526102148384 1806.79173163499
+ 10021.5408052722 -128.600704469615 867.758724945474
+ 10000 0 100
+ 10000 1.34540633889482e-13 100
+ 10065.5315194327 -26.7964448435953 110.957314319453
+ 10065.1121630178 75.5306400097429 187.616158270122
+ 10198.9524665285 -144.377061946279 204.772443287356
+ 10314.7814308463 -755.574595379582 2090.26570992457
+ 10681.5060546264 443.574304231004 388.710807539174
+ 10307.6227470317 -492.086518242019 887.162665219409
+ 10434.8234633612 -492.8009764866 658.508964877141
+ 10291.6343344163 23.8641740849114 414.184239701612
+ 10794.6822601961 477.351373931853 386.736404734129
+ 10561.5127212106 -275.646494384923 235.314814779048
+ 10000 0 100
+ 10000 -6.72703169447408e-14 100
+ 10570.341413646 394.160742638776 1786.11246630829
+ 9999.99999999999 0 100
+ 9999.99999999999 -3.36351584723704e-14 100
+ 10000 -6.72703169447408e-14 100
+ 10000 -1.34540633889482e-13 100
+ 9999.99999999999 0 100
+ 10434.7802156164 -342.775352016239 370.239853907076
+ 10541.7288109193 621.689091089232 813.451672107839
+ 10049.7223762046 171.196973888516 779.521914384596
+ 10049.1821827266 -350.510313717517 2598.00788031717
+ 10044.2659388577 -222.074920101375 1873.54250411603
+ 10068.0074455516 -44.6993697136964 129.379630959465
+ 10376.8906165775 148.941988018643 158.859825156675
+ 10548.7863021448 508.821410917478 571.766928577153
+ 10000 -1.34540633889482e-13 100
+ 10000 0 100
+ 10173.3293490432 -184.582597794901 296.566453383617
+ 10741.893913418 -552.78878970484 511.885635529122
+ 9999.99999999999 0 100
+ 10768.370680492 -657.753399812244 663.060962565033
+ 10000 1.68175792361852e-13 100
+ 10077.8994759253 48.0210905630419 129.602575774381
+ 10739.8621578245 613.037864763461 607.953298677691
+ 10000 0 100
+ 10000 -2.69081267778963e-13 100
+ 10000 6.72703169447408e-14 100
+ 10000 -1.34540633889482e-13 100
+ 10351.1920735374 355.119871612988 459.091598919538
+ 12807.3578032472 2739.33549362551 3003.99237609487
+ 10106.2131112946 314.717935649552 1032.53439064412
+ 10023.1780592897 -132.201400094036 854.041137282229
+ 10146.1787826997 -216.098774703623 419.462780890359
+ 12759.4647106774 -2758.71689959224 3288.99722813838
+ 10250.617049822 -196.429234254901 253.957777802286
+ 11040.3989396715 -1299.79547621647 1753.50773092874
+ 11187.0423238738 -1856.1008156127 4178.09544799862
+ 10341.9803953199 -795.606754371582 2511.21104775922
+ 10605.5426432689 342.406260970768 293.614849185627
+ 10162.4075125071 -340.484472326903 1633.51931219436
+ 10000 -3.36351584723704e-14 100
+ 10000 -6.72703169447408e-14 100
+ 15074.9195563701 3221.46196168668 2318.81489197482
+ 10043.0605439213 19.5863280181326 108.908950289497
+ 11372.4008730201 277.078535241214 155.940298640635
+ 10159.2590931564 -460.128744390627 1429.39637679968
+ 10511.503255724 -154.064193354118 146.403958153224
+ 10000 6.72703169447408e-14 100
+ 10000 0 100
+ 9999.99999999999 0 100
+ 10000 6.39068010975037e-13 100
+ 10106.9545841519 120.480840487093 235.717725795337
+ 10017.0882434486 97.9451770047595 661.395191222715
+ 10486.1996660536 933.190915531478 2619.1357927819
+ 10667.2279362912 920.296451332664 1399.13291254317
+ 10389.2182845688 483.169110555966 699.798104690934
+ 10498.5188821395 -631.839646531912 1208.66473230012
+ 10574.7859529139 -974.905200703259 1753.55493734671
+ 10245.4637244348 279.905867182852 419.180745194724
+ 10707.6197648504 1091.4170064107 1880.88966879207
+ 10017.2547049806 -180.846725778991 1995.45624001151
+ 10163.9005714443 -229.870607875213 422.393606680541
+ 10802.7182833484 125.273415305189 819.707188509607
+ 10138.7506821356 -102.48223774328 175.694107525966
+ 10019.8549673924 -156.343310312633 1331.08893590592
+ 10172.6140783381 115.471631085503 177.24571317657
+ 10147.0678956677 36.3185468577576 258.17034246373
+ 10245.8170742744 395.981347519915 737.877690337416
+ 10000 3.02716426251333e-13 100
+ 10000 -6.72703169447408e-14 100
+ 10183.9939604766 155.349651428308 247.118803320489
+ 10026.5077580483 -145.624108760314 900.006587265077
+ 15320.7162329933 -1993.1282914657 1104.55123109183
+ 10049.4951434289 -37.0148968407608 127.681556072246
+ 9999.99999999999 0 100
+ 10676.8687382807 -8.48707186115034 2971.03057863247
+ 11714.1303980972 -1880.18681896795 5395.64563168487
+ 10000 0 100
+ 10357.1529229607 160.363869621495 172.004368511943
+ 10476.6878279615 93.7844840324849 287.287124041286
+ 10070.4942755718 352.967229494432 1867.31889343291
+ 10041.3153121585 -25.1783869586083 115.344218322851
+ 10000 2.01810950834222e-13 100
+ 10922.8950402149 -1185.75880060701 1647.12223144545
+ 10000 3.69986743196074e-13 100
+ 10584.753803427 390.956798168557 450.111778166518
+ 10015.6975558903 -50.4517320969961 1189.52600867619
+ 10393.6278383618 447.355771706738 608.417258576632
+ 10111.1607950084 -95.6820604773689 182.358683171543
+ 10208.8708661037 -412.396714376546 946.696638650463
+ 11417.5239538359 1505.3057656635 1698.52356780854
+ 10291.3557749561 -166.29730149209 194.917605418028
+ 10000 1.34540633889482e-13 100
+ 10163.5576514378 74.787819860253 134.19722617855
+ 10000 1.34540633889482e-13 100
+ 11553.8013702366 -1947.94803455418 2565.08184281158
+ 10270.0540607003 -122.4000105921 155.476901751069
+ 10000 -1.34540633889482e-13 100
+ 10229.6002896263 -278.492194929709 648.879870660417
+ 10544.6483041292 -643.017375813782 859.152911087352
+ 10131.6459665189 -446.944279280701 1617.3969553646
+ 10443.0240256433 -1423.76005498436 4957.45773799145
+ 10346.2923018324 -861.293906786131 3242.68554340152
+ 10135.0905360709 -320.326284574445 1185.77441276401
+ 10085.410998466 -62.4072842862478 145.599152356626
+ 10574.4576530376 248.143470515554 221.935112139938
+ 10000 -1.34540633889482e-13 100
+ 10000 -1.00905475417111e-13 100
+ 10177.3233860887 -218.835646892554 370.066128372602
+ 10072.8436120788 83.3205505303892 616.112832810192
+ 10000 1.34540633889482e-13 100
+ 10000 0 100
+ 10000 2.01810950834222e-13 100
+ 9999.99999999999 0 100
+ 48957.1592490817 48894.0429181695 75972.4969152284
+ 11177.8041170193 2154.25449720874 4734.17855367584
+ 11674.5597988408 1539.86050282323 3113.57092910224
+ 10766.4011204195 952.981753955823 2527.10645598107
+ 10450.8377958688 -12.8473815398078 599.059368701933
+ 12550.0140824238 5120.90352492654 10510.4244145456
+ 10000 0 100
+ 12153.7932709107 1160.539644194 725.339620072482
+ 10252.9555196795 517.388702725404 1158.25352238624
+ 10000 1.34540633889482e-13 100
+ 12123.4676067899 -1280.15197378869 871.751389451385
+ 12767.2272663888 -3225.0960780265 10745.184632561
+ 10047.5586869225 -360.949223613576 2839.44363181471
+ 10045.7113703616 -196.50151829877 1894.17659656948
+ 10020.1257044912 105.676919658795 654.89294068993
+ 10013.574026084 -46.084460204047 256.458920820643
+ 10098.6268045177 -399.837175490442 1720.95657145166
+ 11095.924287949 182.345532083896 261.674336122565
+ 10000 0 100
+ 10000 -1.00905475417111e-13 100
+ 11700.5044029872 1499.74314031248 1422.68371840917
+ 10000 -1.34540633889482e-13 100
+ 10896.6676014636 -679.155294117559 716.495617626019
+ 10082.3740011577 -366.508337953962 1730.71308789146
+ 9999.99999999999 0 100
+ 10962.3829471922 -211.329681303577 147.979718265486
+ 10141.454778202 63.3977825807047 128.413878182403
+ 10000 -2.52263688542778e-13 100
+ 10777.5782734138 -313.351877490558 237.460354232336
+ 10438.5392537548 516.984640327098 709.462245501894
+ 10318.0721484956 402.6271797241 609.659983180945
+ 10006.2038166412 2.20629754022754 100.784637766968
+ 10126.8924538092 77.228501397447 147.002333464717
+ 10006.977068942 43.9760322830559 377.178200679391
+ 10000 4.70892218613185e-13 100
+ 10276.8903986325 167.445000765363 201.259662378287
+ 10000 -8.49287751427352e-13 100
+ 10000 1.34540633889482e-13 100
+ 10356.7356359071 -343.701438750048 431.143477433834
+ 9999.99999999999 0 100
+ 11230.7812482956 -1455.01752904754 3437.03369088883
+ 10281.4180436538 -356.264372932882 551.01693471153
+ 11507.992630907 1287.201967125 1198.73806423968
+ 10218.0285811565 525.994587139845 1368.96347365522
+ 12876.9330753419 896.196879643705 427.443800050259
+ 10000 6.72703169447408e-14 100
+ 10100.5473327457 356.244417155999 1572.50639188709
+ 10049.4070915995 232.646492288969 1195.4781716989
+ 10000 -1.34540633889482e-13 100
+ 15450.4494732774 -1802.88829823215 696.355627519999
+ 10000 0 100
+ 9999.99999999999 0 100
+ 13737.1334445191 -3361.83357658112 3124.22302131158
+ 10246.5631680992 390.678918619081 792.720610707146
+ 10212.9090669359 142.675041011083 195.609677974127
+ 9999.99999999999 8.4087896180926e-14 100
+ 10000 -3.36351584723704e-13 100
+ 9999.99999999999 0 100
+ 10168.7631409021 168.94690652749 269.130872254656
+ 10000.0998274969 -9.43081786246559 990.940154739954
+ 10034.4067507669 -18.0453380653556 109.464253922106
+ 10407.3293527139 289.21579913213 305.351708415659
+ 10555.5111714026 -333.317166839979 299.996578700129
+ 10390.3282841392 -882.995523196533 2172.87369546937
+ 10045.2227734965 23.5019764496148 112.213821805527
+ 10000 1.34540633889482e-13 100
+ 10000 1.34540633889482e-13 100
+ 10000 2.01810950834222e-13 100
+ 10101.865099164 435.128219806325 1958.69909542783
+ 10000 -1.00905475417111e-13 100
+ 10333.5474530559 -201.082149318585 221.224222832863
+ 9999.99999999999 0 100
+ 10000 -2.35446109306593e-13 100
+ 10057.1246069796 34.3031965250974 120.598991468956
+ 12579.9619834668 -2087.71219440295 2473.97857062135
+ 10402.3477832578 -159.996072652781 163.623423141643
+ 13038.0088079432 2360.45892823891 2001.9237149885
+ 10120.8635032603 199.002108359614 1203.65863145663
+ 10543.5828261183 71.7782432716553 109.478070239924
+ 10619.1531467839 -576.21429853995 961.932473795859
+ 10279.12988723 -258.20197450449 338.843143239217
+ 10174.6359491533 55.8322532863135 117.849935950423
+ 10000 0 100
+ 10543.6923140568 -1038.64235829509 2084.16994420146
+ 11516.045532947 -693.517267872026 417.250498342047
+ 11352.9439677246 1406.78824426063 2025.50024399787
+ 12849.6717686166 4228.34171941627 6526.94468369251
+ 10077.6106531902 48.3679172644629 130.143483199
+ 11149.2805299491 -1299.45847063309 1843.75442088089
+ 10457.9887160757 -392.190198076942 507.062083072774
+ 9999.99999999999 0 100
+ 10000 3.36351584723704e-13 100
+ 12001.0100033419 1462.69520855604 1169.19868944164
+ 10530.6539196177 266.564100068979 233.903504372072
+ 10128.3810982633 -530.259932121171 2290.16350083316
+ 10512.8998598549 164.928513192376 153.034552342325
+ 10000 6.72703169447408e-14 100
+ 10594.7174180507 -428.926802004333 409.353982065424
+ 12728.2734638247 -1297.21098322152 716.784335332544
+ 9999.99999999999 0 100
+ 10000 0 100
+ 10458.1966730654 3.51631968411301 576.947510494684
+ 10134.1086317166 139.67721480186 245.477021762757
+ 10035.3416017192 -118.146503444615 494.962186125103
+ 10000 -6.72703169447408e-14 100
+ 10128.1959428928 -59.3943365306974 127.517931787214
+ 10106.7775189116 -73.154381333632 150.118822415582
+ 10528.2203687327 275.512997567008 243.704060505048
+ 10024.2167838731 124.299826415735 738.00572891582
+ 10568.9622164499 574.448445783862 679.987576191831
+ 10364.3913157604 363.387831312349 1671.5136605955
+ 10182.6413234301 -350.641895997626 773.175910685313
+ 9999.99999999999 0 100
+ 9999.99999999999 -6.22250431738852e-13 100
+ 10000 1.34540633889482e-13 100
+ 10169.0312396681 82.0291623024634 139.807928293359
+ 10000 6.72703169447408e-14 100
+ 10405.7781770103 -254.871751296786 260.086503635301
+ 10279.1219652603 -100.91737074197 136.486973384459
+ 10023.4842056739 29.9911409425964 1179.36890131931
+ 10393.5177793313 453.223693863477 1063.80363433797
+ 10405.9381189337 350.467228986907 402.576360447255
+ 10000 6.72703169447408e-14 100
+ 10491.4296455442 -713.569342226012 1383.22678853721
+ 10000 -1.00905475417111e-13 100
+ 10331.8965046956 551.839363321464 1017.53507073037
+ 10249.1657309366 278.686222964635 411.704224246109
+ 10000 6.72703169447408e-14 100
+ 13079.4822712559 -3127.22768245148 5369.31412727904
+ 10000 -2.01810950834222e-13 100
+ 9999.99999999999 0 100
+ 9999.99999999999 1.34540633889482e-13 100
+ 10013.57052101 -46.7872296508111 261.308829394076
+ 10189.8070929107 -20.5667166594172 1209.54947297813
+ 10998.1189459013 374.66288500237 240.636822870388
+ 10120.3113755578 184.156071066999 3104.63325456745
+ 9999.99999999999 0 100
+ 13752.0445489521 4071.69307538299 12920.9478378597
+ 10543.1270771167 1493.33224953318 4640.23932899439
+ 10358.513195676 1272.94648406497 5673.85927462391
+ 10293.9308571435 244.775220078203 2496.95709882332
+ 10033.7993276981 -362.187872776454 3981.14391972835
+ 10000 2.69081267778963e-13 100
+ 10000 2.69081267778963e-13 100
+ 28778.0410822031 22626.6324804047 37263.8348011355
+ 10000 6.72703169447408e-14 100
+ 10000 -6.72703169447408e-14 100
+ 10108.9042795706 -165.35442919961 351.065315006362
+ 10177.6305890281 -169.679795050666 262.084880796482
+ 10287.5803310224 -178.514427702512 210.812171279819
+ 10708.870022817 757.082798375941 908.574696555783
+ 10030.270323026 -147.277354214371 816.56384524749
+ 10000 0 100
+ 10934.2658529729 -1101.37756351708 1586.50447010502
+ 11987.2287457283 1975.20852014822 2292.82255683015
+ 14333.5946133518 2058.970984337 1845.14898395647
+ 10000 -5.04527377085556e-14 100
+ 10335.1452269507 -518.441609052618 901.985767312206
+ 10082.0018864807 -162.962842900641 4558.74349921923
+ 10138.4365006423 89.026150206109 157.251197363036
+ 10507.904671545 -320.838670514106 305.339763061803
+ 10062.1221326228 -206.601667153255 787.102117528277
+ 10158.6700917783 196.973839576215 744.853002365513
+ 10000 -1.34540633889482e-13 100
+ 10096.1042495192 56.1199352401355 132.771153691052
+ 10717.6399607373 -10.855893779392 606.164650216884
+ 11088.3838174144 -146.316098788071 678.165941229425
+ 10011.1207002514 55.7816832361144 379.802181005703
+ 10332.18347865 -245.861273495258 361.49951079471
+ 10001.3135258793 -9.96907562031728 175.660837969937
+ 10103.896782013 -88.4836635571988 184.273928697538
+ 10026.8809305114 -37.582477841109 530.80890397573
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000 0 100
+ 10064.5205232492 323.05644893968 1717.55460039261
+ 10026.3863350999 88.5119308052354 396.909815827392
+ 11978.6687378848 -2300.65500587088 3550.98760433223
+ 9999.99999999999 0 100
+ 10140.5664142292 302.990959274057 753.097127825284
+ 10704.0855338176 -827.534357095886 1072.62772672096
+ 10095.4173305559 65.6042942675777 145.106307221903
+ 10140.9726917956 -582.267724717151 2504.97431757166
+ 10000 0 100
+ 10298.7046370531 440.106362606486 1103.51926943241
+ 10093.3268335177 18.6201043730068 184.22653804518
+ 10622.4982994674 -257.231498915758 220.105230235092
+ 10507.3103513523 581.236294382065 765.934824721138
+ 10139.1444418285 605.08299258339 3737.05444121584
+ 10145.920455337 -248.456677863321 523.043641361438
+ 9999.99999999999 0 100
+ 10161.9594374834 -534.19703532632 1861.96260610429
+ 10032.6508559543 -107.007272478852 789.421267485778
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10055.7627357823 505.017825309411 4673.71756069692
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000 0 100
+ 10009.5114988952 11.1799356957753 179.95611948829
+ 10063.3962289464 262.017449009873 1182.92156689174
+ 10010.706042348 29.4219876866167 216.804544220213
+ 10120.7238709691 -278.376589567117 741.907230086051
+ 10878.602494459 -358.404411736661 573.216524325328
+ 10052.1577512728 -80.6836747772102 224.810890360467
+ 10997.8792921654 1059.67412252051 1225.29566928165
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10419.559746669 -116.123570443952 247.033390205902
+ 9999.99999999999 0 100
+ 10482.8294599928 -109.26878990824 124.728541726075
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10036.8640453272 29.8988090160527 142.325905898741
+ 10381.1271584279 220.701596699175 288.748313523214
+ 10116.994613649 -92.2371083989412 172.718597040082
+ 9999.99999999999 0 100
+ 10060.1455868371 -82.801990677217 213.992896580713
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10380.8817351526 205.232488820601 210.586490713755
+ 10031.4165214149 -12.846506392011 105.253055368566
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10293.6571107188 -295.133059447809 396.616426436314
+ 11571.6103626696 3140.21943920702 6437.05124914021
+ 24156.3933174353 15586.8856809532 24280.9210468071
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10262.4987403148 -188.963583646675 260.73377140988
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10020.9100632884 41.8108024779864 183.602960915984
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11955.2145846877 3289.49576848105 5758.97505042102
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10037.4034102594 62.1900918256274 203.402537213933
+ 11011.40398626 955.788675095952 1043.46110820088
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10054.1268341435 -59.65973532232 165.758215403706
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10055.4142137812 -61.0787122431373 167.322241618504
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10137.2630011594 73.9621377214219 139.853403831442
+ 10033.1178282066 48.2582622793482 170.320428733912
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10942.6709209599 -117.305117891052 307.034783941987
+ 9999.99999999999 0 100
+ 10143.6032676157 -144.325031375472 245.050422788946
+ 10163.3505616151 -164.171577163538 264.996719214619
+ 9999.99999999999 0 100
+ 11690.8691742348 1600.32293612536 2091.66184275388
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10113.0430843699 40.1209060645011 250.68804118923
+ 9999.99999999999 0 100
+ 10010.0982796603 -33.5841885189025 211.692066016528
+ 10086.6360863393 -87.0715275966199 187.509157423374
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10028.9311619135 -51.9892687103583 193.424663313656
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10320.0253975554 600.494685815102 1231.03538702212
+ 10008.084296899 -27.0256967700333 190.346544050292
+ 11090.4707612309 2180.45526581852 4459.93823517918
+ 10099.5533296185 -78.4866154868135 161.877878260664
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10192.3761756053 -92.7123473206777 151.161575119908
+ 9999.99999999999 0 100
+ 10044.931203461 9.31559311102861 221.603556909215
+ 10018.4429184587 -52.1914054628667 247.695865504952
+ 10008.3777486504 21.556492804838 175.200386733396
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10098.0840979723 -80.0776219067929 165.376810949074
+ 10020.9431716045 30.5177338908096 144.469486256396
+ 9999.99999999999 0 100
+ 10049.8654645688 72.6623935855246 205.8813647327
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10015.7790051037 22.9926721660047 133.504201935251
+ 10142.8979159738 133.161684311361 258.642177609894
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10039.3671605212 49.7703153703265 229.677061555612
+ 10001.2329550026 -12.9226130205352 235.442029052471
+ 9999.99999999999 0 100
+ 10054.6516061285 -92.6956108988445 257.222758645246
+ 10275.8909232213 189.689118395147 230.420969336025
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10075.092208274 109.422014614616 259.446333481449
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10049.8654645688 72.6623935855191 205.8813647327
+ 9999.99999999999 0 100
+ 10046.7887216227 -56.0509470524488 167.146708790437
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10115.534774898 65.3295531283342 136.940830288692
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10196.9813168198 99.069557749078 160.955107861001
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10710.194807589 402.997951842926 433.222141326865
+ 10001.2329550026 -12.9226130205369 235.442029052471
+ 9999.99999999999 0 100
+ 10001.456375602 -15.2642864327349 259.98513019041
+ 10368.1985068333 -168.432950689279 177.049902026745
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10962.3829471922 -211.329681303577 147.979718265486
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10140.1625071987 148.842232715053 258.059460282069
+ 10063.5430526198 37.569919987245 122.213268479456
+ 10641.8626465293 -3.24385333610483 317.717621049554
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10341.3228438763 -171.709163496707 186.381668727176
+ 10763.8114702118 -551.5794567816 547.951426018154
+ 10723.2904864009 -512.239936424769 507.53673923853
+ 9999.99999999999 0 100
+ 10466.4655129246 -240.124193739405 223.609627767538
+ 10418.323393076 -215.341894955799 210.852351292557
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10095.9644542992 -127.872487464867 270.389892485336
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10022.074885557 -53.3440809530912 228.906261614656
+ 10160.2350861447 347.782297983544 956.926851893335
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10006.6160552107 31.9339866619137 254.137091008005
+ 9999.99999999999 0 100
+ 10002.051307825 -0.706134081136971 206.476469073699
+ 9999.99999999999 0 100
+ 10111.7119100235 -64.7984906127079 137.586362857826
+ 10054.0882044019 82.4685098205466 225.740079324672
+ 10386.1596131628 675.579840656421 1288.69070115077
+ 9999.99999999999 0 100
+ 10411.6371932481 823.090831533362 1745.81463499078
+ 9999.99999999999 0 100
+ 10014.2045639151 -46.8514589173683 254.531967036095
+ 10053.0658360729 -68.3148401501576 187.945799597429
+ 10004.1409934924 -22.7491319941389 224.975566235622
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11194.5557336702 -1171.18090649839 3967.65324776645
+ 11126.2493596674 -1948.8696606916 3605.1581004022
+ 10681.7666372287 -1163.22982745239 2164.63005053698
+ 10025.0549191682 -70.9026311684797 300.646550598341
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10001.473081832 16.3050925215844 280.476085142635
+ 9999.99999999999 0 100
+ 10088.8244646048 207.120235501227 584.206644913752
+ 10210.1040177859 437.737859339198 1012.4136507102
+ 10588.7987135364 923.019223223765 2258.54696802594
+ 10196.873189392 459.465299143443 1174.60180712727
+ 10724.01202325 682.391242847677 1327.17780626812
+ 9999.99999999999 0 100
+ 12976.0760882304 4096.53409223522 6384.90224626683
+ 17189.4580323062 6184.28811495434 9530.15824235089
+ 25019.8106934045 18354.7719969004 28735.3833783792
+ 12293.5102240931 4585.99773889104 9269.95051523261
+ 12055.7131773282 4110.50968249496 8319.18642942418
+ 10130.8264783765 22.0832720801119 428.312119001071
+ 11055.2813276321 2110.09209009668 4319.24325969022
+ 10780.9313489273 1561.51446930041 3222.33263677242
+ 10662.9162851712 1203.41947333928 2610.54623833754
+ 13383.2242511499 5900.87851288241 10441.3883563091
+ 10050.3072443534 100.592055980749 301.139256512598
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10254.0576938232 -153.161016991256 192.33452753501
+ 13847.4757914491 5342.66309062592 8748.71924655308
+ 20186.6955941214 12576.7071204689 22154.3084020703
+ 10208.8231827307 417.553248191742 934.920303366465
+ 11005.7743209911 2011.10015270341 4121.30352683695
+ 10037.3883099157 -55.0301358738882 180.996329096585
+ 9999.99999999999 0 100
+ 10187.692689335 -84.7451410490058 138.263285356822
+ 10051.1128974325 -75.2307257792782 210.72864943233
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10049.3560724314 58.1848286907323 168.592862498897
+ 10003.4605395608 -16.8369234192805 181.918436488954
+ 10055.8997987947 70.7599783329435 189.570528725268
+ 10000 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000 0 100
+ 9999.99999999999 0 100
+ 10672.0762510692 839.56765071743 1534.12280972208
+ 10188.7447757483 160.504135486266 252.731657811376
+ 10063.8233895876 28.604628476125 112.820139693985
+ 10270.1454517043 -59.4888669163673 113.100073551734
+ 9999.99999999999 0 100
+ 10594.0821186257 -237.379685573267 229.606154331645
+ 10448.9015337417 -194.057050090005 216.177231530386
+ 10111.6402865982 118.553740585412 225.895318214041
+ 10041.7569982789 -66.2247997579723 205.029678467013
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10125.8579505279 107.430632071696 191.701324063498
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10117.4635196582 298.67986358332 859.466949140758
+ 9999.99999999999 0 100
+ 10207.7276307543 -122.052560404614 211.257700116092
+ 9999.99999999999 0 100
+ 10015.0322272654 -49.5813727454852 263.536146701925
+ 10960.5292726049 -317.721867559586 205.095376064683
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10038.1825267782 -71.2121904813596 232.814051375337
+ 9999.99999999999 0 100
+ 10382.9253246428 20.3949505842339 219.693249707229
+ 10394.8949416664 -135.262896269444 159.031715235055
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10174.0133182857 -83.5285461774536 210.923053488787
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10080.6837633536 -108.369607227076 728.394268985621
+ 9999.99999999999 0 100
+ 10038.3537019177 29.2780346992566 213.70161418756
+ 10091.4698294096 104.798935310632 220.070376353976
+ 9999.99999999999 0 100
+ 10287.4324676086 -194.476851652386 231.583067644671
+ 9999.99999999999 0 100
+ 10065.2240721084 59.7483553418669 238.984710391493
+ 11802.7003546377 3023.83180359858 5951.41057923435
+ 10003.0956582095 -23.4946652147312 278.314030876042
+ 10081.4661454154 26.0452586488836 108.326839261003
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10073.2681305312 77.8053443327037 182.623530351297
+ 9999.99999999999 0 100
+ 10415.535148547 -521.462552766467 769.048946909734
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10177.8692516444 -108.801886801977 269.281528528315
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10053.1444623544 90.1536101592523 252.935471819156
+ 10276.3457920222 -60.7013461672034 230.486282543529
+ 10389.2709338844 -349.995822158774 433.329743595012
+ 9999.99999999999 0 100
+ 10113.5315849465 -146.007193539982 718.651770494857
+ 10000 0 100
+ 9999.99999999999 0 100
+ 10117.0104621055 -136.160520546534 258.444698208086
+ 10057.634709362 -76.2624369308226 200.910707297862
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10442.9754315097 548.171337469071 886.176588702477
+ 9999.99999999999 0 100
+ 10051.8554439668 -32.9765414299296 120.970841275136
+ 10024.8500490406 -23.9420925430002 123.067310426641
+ 9999.99999999999 0 100
+ 19714.3125659636 10154.1504602344 15589.7211753673
+ 10330.2756652934 -149.122791833317 167.33044356873
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10030.596106333 -72.7667003087474 273.060997245645
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10013.9422099486 35.45149487779 190.144137386088
+ 9999.99999999999 0 100
+ 10022.0711799669 44.0703411458557 415.025895685552
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10186.9246856297 -319.579995974846 674.953294963596
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10051.8554439668 -32.9765414299295 120.970841275136
+ 11376.8849790079 -727.7648772931 667.700350288531
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10026.5086909914 15.918408629537 109.558968165527
+ 9999.99999999999 0 100
+ 10730.8454857611 -455.569088139519 415.804820808982
+ 10184.2152265402 163.933800351672 258.172621324467
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10002.5368094621 16.4583243423314 206.778393963083
+ 10027.9463322657 -53.6524525107826 203.004059103339
+ 10000.0001058832 0.0779486165681864 157.383857842929
+ 11840.2179678228 3679.61535590675 7457.58991824399
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11139.4230626555 -255.141305657328 233.176239778997
+ 10020.31981809 -58.7076831765591 269.617269637374
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10047.3488321491 -44.0979390704864 145.382716480127
+ 9999.99999999999 0 100
+ 11073.0347773706 671.531142345281 742.462799798191
+ 10000 0 100
+ 9999.99999999999 0 100
+ 10020.8482222181 47.8461445126131 209.80569569802
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10063.3568893885 -137.609917495721 514.652300817832
+ 10031.9828883078 15.5209743539606 107.532172910012
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10163.03556865 -148.495934734124 243.032392451927
+ 10313.1756864167 394.476980530673 2369.59026210565
+ 9999.99999999999 0 100
+ 10004.9651336794 -37.6831502865651 385.998304819154
+ 9999.99999999999 0 100
+ 10068.4434513005 116.106626224733 296.961848024099
+ 11904.5300322601 2310.02262656037 7256.94848012041
+ 11640.8740330612 525.308914824988 856.635010565339
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10000.014608836 -1.38011345035325 230.380896883659
+ 10081.0330304985 -121.393717684888 281.857134093412
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11467.9239412234 -2071.98069221484 6935.95838174556
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10402.7833968735 -360.183484881717 479.710765326262
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10191.4623269312 119.947493290232 175.144815051674
+ 9999.99999999999 0 100
+ 10004.7976910057 -23.342705561764 213.571695696495
+ 9999.99999999999 0 100
+ 10097.1019032873 -93.6425868594158 190.306510756816
+ 10171.6582343021 160.796465205439 250.621980516593
+ 10211.7053302884 359.920172496159 1070.24491669208
+ 11095.924287949 182.345532083895 261.674336122565
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10027.5584099304 26.9291020577341 126.314164694797
+ 9999.99999999999 0 100
+ 10010.6088414255 -35.2821809642252 217.339136637029
+ 11057.3942585926 -1299.66242632715 2111.43209557076
+ 9999.99999999999 0 100
+ 10567.4102678503 1134.56751927663 2368.62911852906
+ 10738.1839294664 176.56736372153 270.891861519476
+ 11151.8259869717 69.3451233785896 337.89156097057
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10620.7180563893 -256.605346118816 219.882836897868
+ 11239.3692211966 -1749.57953055787 3013.97190171303
+ 9999.99999999999 0 100
+ 10121.3357016804 -166.733952614268 430.813148396549
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11119.9052361317 2190.58858467845 4556.08551664826
+ 12633.4106047873 -914.574444897303 449.599655998594
+ 10322.9315849496 -162.058567916665 288.94332476638
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 11019.3825814106 1751.41267591079 3124.03170124014
+ 10572.9456481055 -460.346381223077 707.463409175773
+ 9999.99999999999 0 100
+ 10070.6089132684 27.9036713875307 111.027147152714
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10002.9687509274 14.8913215982192 174.695204940358
+ 10059.5342521936 98.4417629098705 264.128333355672
+ 10698.6211858489 171.020032094485 211.397145387558
+ 10201.2105586483 12.1398542692933 532.087746390822
+ 10626.597075678 -483.136560199419 479.212695557031
+ 11241.6683781333 -37.1331451845188 821.961035764429
+ 9999.99999999999 0 100
+ 10394.8949416664 -135.262896269444 159.031715235055
+ 9999.99999999999 0 100
+ 9999.99999999999 0 100
+ 10118.9642984278 62.7644590607011 234.116551396535
+ 9999.99999999999 0 100
+ 10001.8944681218 15.9826205569319 234.836874228715
+ 10017.9746872457 -51.9321698326547 250.041568270895
+ 10563.1269688321 131.498513934742 255.359385672632
+ 9999.99999999999 0 100
+ 14110.5822155244 6243.35736365061 10457.070293779
+ 10032.4344061164 -41.3004687340377 240.141778092416
+ 10958.9625495393 -910.685537716346 1701.60004226638
+ 16733.614477062 6479.84001130805 11267.5815572416
+ 10058.0307092691 -26.8861509784842 112.456596232274
+ 22731.5897626579 16805.8207268707 29278.1174416782
+ 10038.755917392 39.1296220857348 139.506930234337
+ 10721.6993452184 -675.428760012083 815.777918169895
+ 12292.1534132207 -1150.51983954908 789.868412315621
+ 9999.99999999999 0 100
+ 10271.7728757742 -105.597624608061 146.420618966009
+ 10208.6893555992 -170.377743784276 239.099454755028
+ 10069.7536516562 530.260420716535 4628.20205156167
+ 16730.4891950262 9327.08798230596 16371.916134051
+ 10000 0 100
+ 10032.4344061164 -41.3004687340377 240.141778092416
+ 9999.99999999999 0 100
+ 10092.7314491727 -82.1721732726291 248.133352335542
+ 12415.1239455816 2828.97649717283 6481.42491347962
+ 10003.448814311 -20.589757178163 222.922854763796
+ 9999.99999999999 0 100
+ 10010.706042348 29.4219876866167 216.804544220213
+ 12102.9246787253 -2293.49843710813 4552.76672876014
+ 10334.2484887164 -503.132318590162 1101.39076877202
+ 10650.6577384621 180.561236794088 180.949583904178
+ 10006.5311786243 32.7018329593999 263.73918712456
+
+
+End
@@ -0,0 +1,61 @@
+MeshVersionFormatted 2
+
+Dimension 3
+
+SolAtVertices
+51
+1 1 
+
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+
+End
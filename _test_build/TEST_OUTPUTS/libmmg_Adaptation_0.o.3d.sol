@@ -0,0 +1,292 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 3
+
+SolAtVertices
+280
+1 1
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+
+
+End
@@ -0,0 +1,131 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 3
+
+SolAtVertices
+119
+1 1
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+ 0.25
+
+
+End
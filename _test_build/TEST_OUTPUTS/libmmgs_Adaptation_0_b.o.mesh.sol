@@ -0,0 +1,44 @@
+MeshVersionFormatted 2
+
+Dimension 3
+
+SolAtVertices
+34
+1 1 
+
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+0.5 
+
+End
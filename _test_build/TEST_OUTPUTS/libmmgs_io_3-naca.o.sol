@@ -0,0 +1,4440 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 3
+
+SolAtVertices
+1469
+2 3 2
+ 32.5918 0 25 0 0 25 32.5918 1.5 1.3
+ 32.529 0 25 0 0 25 32.529 1.5 1.3
+ 32.6732 0 25 0 0 25 32.6732 1.5 1.3
+ 32.4686 0 25 0 0 25 32.4686 1.5 1.3
+ 32.4466 0 25 0 0 25 32.4466 1.5 1.3
+ 32.7266 0 25 0 0 25 32.7266 1.5 1.3
+ 32.4883 0 25 0 0 25 32.4883 1.5 1.3
+ 32.6539 0 25 0 0 25 32.6539 1.5 1.3
+ 32.7327 0 25 0 0 25 32.7327 1.5 1.3
+ 58.8952 0 25 0 0 25 58.8952 1.5 1.3
+ 59.5145 0 25 0 0 25 59.5145 1.5 1.3
+ 60.6471 0 25 0 0 25 60.6471 1.5 1.3
+ 57.9475 0 25 0 0 25 57.9475 1.5 1.3
+ 57.028 0 25 0 0 25 57.028 1.5 1.3
+ 62.6219 0 25 0 0 25 62.6219 1.5 1.3
+ 57.3644 0 25 0 0 25 57.3644 1.5 1.3
+ 61.4693 0 25 0 0 25 61.4693 1.5 1.3
+ 62.11 0 25 0 0 25 62.11 1.5 1.3
+ 91.5279 0 25 0 0 25 91.5279 1.5 1.3
+ 301.76 0 25 0 0 25 301.76 1.5 1.3
+ 483.984 0 25 0 0 25 483.984 1.5 1.3
+ 114.688 0 25 0 0 25 114.688 1.5 1.3
+ 119.69 0 25 0 0 25 119.69 1.5 1.3
+ 165.903 0 25 0 0 25 165.903 1.5 1.3
+ 518.691 0 25 0 0 25 518.691 1.5 1.3
+ 648.418 0 25 0 0 25 648.418 1.5 1.3
+ 283.235 0 25 0 0 25 283.235 1.5 1.3
+ 167.263 0 25 0 0 25 167.263 1.5 1.3
+ 79.6669 0 25 0 0 25 79.6669 1.5 1.3
+ 89.8408 0 25 0 0 25 89.8408 1.5 1.3
+ 78.8326 0 25 0 0 25 78.8326 1.5 1.3
+ 82.981 0 25 0 0 25 82.981 1.5 1.3
+ 98.2528 0 25 0 0 25 98.2528 1.5 1.3
+ 80.45 0 25 0 0 25 80.45 1.5 1.3
+ 256.7 0 25 0 0 25 256.7 1.5 1.3
+ 591.445 0 25 0 0 25 591.445 1.5 1.3
+ 84.0883 0 25 0 0 25 84.0883 1.5 1.3
+ 78.4162 0 25 0 0 25 78.4162 1.5 1.3
+ 109.961 0 25 0 0 25 109.961 1.5 1.3
+ 89.8854 0 25 0 0 25 89.8854 1.5 1.3
+ 156.456 0 25 0 0 25 156.456 1.5 1.3
+ 408.894 0 25 0 0 25 408.894 1.5 1.3
+ 601.87 0 25 0 0 25 601.87 1.5 1.3
+ 265.096 0 25 0 0 25 265.096 1.5 1.3
+ 411.973 0 25 0 0 25 411.973 1.5 1.3
+ 140.578 0 25 0 0 25 140.578 1.5 1.3
+ 118.368 0 25 0 0 25 118.368 1.5 1.3
+ 82.635 0 25 0 0 25 82.635 1.5 1.3
+ 184.56 0 25 0 0 25 184.56 1.5 1.3
+ 547.281 0 25 0 0 25 547.281 1.5 1.3
+ 139.692 0 25 0 0 25 139.692 1.5 1.3
+ 95.0853 0 25 0 0 25 95.0853 1.5 1.3
+ 121.28 0 25 0 0 25 121.28 1.5 1.3
+ 475.217 0 25 0 0 25 475.217 1.5 1.3
+ 300.417 0 25 0 0 25 300.417 1.5 1.3
+ 641.61 0 25 0 0 25 641.61 1.5 1.3
+ 360.378 0 25 0 0 25 360.378 1.5 1.3
+ 221.413 0 25 0 0 25 221.413 1.5 1.3
+ 85.6166 0 25 0 0 25 85.6166 1.5 1.3
+ 101.555 0 25 0 0 25 101.555 1.5 1.3
+ 78.7742 0 25 0 0 25 78.7742 1.5 1.3
+ 78.6121 0 25 0 0 25 78.6121 1.5 1.3
+ 104.98 0 25 0 0 25 104.98 1.5 1.3
+ 80.9135 0 25 0 0 25 80.9135 1.5 1.3
+ 180.542 0 25 0 0 25 180.542 1.5 1.3
+ 648.451 0 25 0 0 25 648.451 1.5 1.3
+ 85.2133 0 25 0 0 25 85.2133 1.5 1.3
+ 78.4223 0 25 0 0 25 78.4223 1.5 1.3
+ 92.0956 0 25 0 0 25 92.0956 1.5 1.3
+ 118.797 0 25 0 0 25 118.797 1.5 1.3
+ 305.558 0 25 0 0 25 305.558 1.5 1.3
+ 521.678 0 25 0 0 25 521.678 1.5 1.3
+ 283.911 0 25 0 0 25 283.911 1.5 1.3
+ 487.756 0 25 0 0 25 487.756 1.5 1.3
+ 168.437 0 25 0 0 25 168.437 1.5 1.3
+ 128.797 0 25 0 0 25 128.797 1.5 1.3
+ 65982.9 0 25 0 0 25 65982.9 1.5 1.3
+ 12842.7 0 25 0 0 25 12842.7 1.5 1.3
+ 19928.6 0 25 0 0 25 19928.6 1.5 1.3
+ 12345.3 0 25 0 0 25 12345.3 1.5 1.3
+ 8661.93 0 25 0 0 25 8661.93 1.5 1.3
+ 8854.85 0 25 0 0 25 8854.85 1.5 1.3
+ 11636.5 0 25 0 0 25 11636.5 1.5 1.3
+ 19427.9 0 25 0 0 25 19427.9 1.5 1.3
+ 8914.47 0 25 0 0 25 8914.47 1.5 1.3
+ 61.6744 0 25 0 0 25 61.6744 1.5 1.3
+ 61.8982 0 25 0 0 25 61.8982 1.5 1.3
+ 61.106 0 25 0 0 25 61.106 1.5 1.3
+ 62.4034 0 25 0 0 25 62.4034 1.5 1.3
+ 62.6905 0 25 0 0 25 62.6905 1.5 1.3
+ 60.7089 0 25 0 0 25 60.7089 1.5 1.3
+ 62.4162 0 25 0 0 25 62.4162 1.5 1.3
+ 61.0408 0 25 0 0 25 61.0408 1.5 1.3
+ 60.7145 0 25 0 0 25 60.7145 1.5 1.3
+ 2511.86 0 25 0 0 25 2511.86 1.5 1.3
+ 401.783 0 25 0 0 25 401.783 1.5 1.3
+ 113.05 0 25 0 0 25 113.05 1.5 1.3
+ 536.775 0 25 0 0 25 536.775 1.5 1.3
+ 72.7757 0 25 0 0 25 72.7757 1.5 1.3
+ 49.0522 0 25 0 0 25 49.0522 1.5 1.3
+ 39.3783 0 25 0 0 25 39.3783 1.5 1.3
+ 51.6484 0 25 0 0 25 51.6484 1.5 1.3
+ 69.2443 0 25 0 0 25 69.2443 1.5 1.3
+ 46.4832 0 25 0 0 25 46.4832 1.5 1.3
+ 37.6654 0 25 0 0 25 37.6654 1.5 1.3
+ 49.6035 0 25 0 0 25 49.6035 1.5 1.3
+ 1178.44 0 25 0 0 25 1178.44 1.5 1.3
+ 679.853 0 25 0 0 25 679.853 1.5 1.3
+ 147.79 0 25 0 0 25 147.79 1.5 1.3
+ 975.07 0 25 0 0 25 975.07 1.5 1.3
+ 35.5678 0 25 0 0 25 35.5678 1.5 1.3
+ 40.0609 0 25 0 0 25 40.0609 1.5 1.3
+ 36.1601 0 25 0 0 25 36.1601 1.5 1.3
+ 42.061 0 25 0 0 25 42.061 1.5 1.3
+ 34.238 0 25 0 0 25 34.238 1.5 1.3
+ 42.5218 0 25 0 0 25 42.5218 1.5 1.3
+ 36.6509 0 25 0 0 25 36.6509 1.5 1.3
+ 36.2499 0 25 0 0 25 36.2499 1.5 1.3
+ 39.9501 0 25 0 0 25 39.9501 1.5 1.3
+ 33.8619 0 25 0 0 25 33.8619 1.5 1.3
+ 53.9997 0 25 0 0 25 53.9997 1.5 1.3
+ 47.5565 0 25 0 0 25 47.5565 1.5 1.3
+ 53.0194 0 25 0 0 25 53.0194 1.5 1.3
+ 66.2096 0 25 0 0 25 66.2096 1.5 1.3
+ 49.3201 0 25 0 0 25 49.3201 1.5 1.3
+ 49.0004 0 25 0 0 25 49.0004 1.5 1.3
+ 68.8844 0 25 0 0 25 68.8844 1.5 1.3
+ 182.558 0 25 0 0 25 182.558 1.5 1.3
+ 59.4337 0 25 0 0 25 59.4337 1.5 1.3
+ 50.9423 0 25 0 0 25 50.9423 1.5 1.3
+ 62.8103 0 25 0 0 25 62.8103 1.5 1.3
+ 134.851 0 25 0 0 25 134.851 1.5 1.3
+ 70.1203 0 25 0 0 25 70.1203 1.5 1.3
+ 67.2972 0 25 0 0 25 67.2972 1.5 1.3
+ 52.2962 0 25 0 0 25 52.2962 1.5 1.3
+ 50.0297 0 25 0 0 25 50.0297 1.5 1.3
+ 64.3754 0 25 0 0 25 64.3754 1.5 1.3
+ 166.074 0 25 0 0 25 166.074 1.5 1.3
+ 17903.6 0 25 0 0 25 17903.6 1.5 1.3
+ 1109.97 0 25 0 0 25 1109.97 1.5 1.3
+ 2371.3 0 25 0 0 25 2371.3 1.5 1.3
+ 930.821 0 25 0 0 25 930.821 1.5 1.3
+ 775.144 0 25 0 0 25 775.144 1.5 1.3
+ 101.41 0 25 0 0 25 101.41 1.5 1.3
+ 74.5938 0 25 0 0 25 74.5938 1.5 1.3
+ 187.954 0 25 0 0 25 187.954 1.5 1.3
+ 95.2523 0 25 0 0 25 95.2523 1.5 1.3
+ 88.6373 0 25 0 0 25 88.6373 1.5 1.3
+ 734.493 0 25 0 0 25 734.493 1.5 1.3
+ 890.837 0 25 0 0 25 890.837 1.5 1.3
+ 1997.87 0 25 0 0 25 1997.87 1.5 1.3
+ 809.433 0 25 0 0 25 809.433 1.5 1.3
+ 3780.94 0 25 0 0 25 3780.94 1.5 1.3
+ 3044.27 0 25 0 0 25 3044.27 1.5 1.3
+ 7012.36 0 25 0 0 25 7012.36 1.5 1.3
+ 151.625 0 25 0 0 25 151.625 1.5 1.3
+ 546.608 0 25 0 0 25 546.608 1.5 1.3
+ 146.824 0 25 0 0 25 146.824 1.5 1.3
+ 3749.89 0 25 0 0 25 3749.89 1.5 1.3
+ 4177.84 0 25 0 0 25 4177.84 1.5 1.3
+ 1632.45 0 25 0 0 25 1632.45 1.5 1.3
+ 65.6399 0 25 0 0 25 65.6399 1.5 1.3
+ 65.2314 0 25 0 0 25 65.2314 1.5 1.3
+ 71.8325 0 25 0 0 25 71.8325 1.5 1.3
+ 40.1058 0 25 0 0 25 40.1058 1.5 1.3
+ 33.6889 0 25 0 0 25 33.6889 1.5 1.3
+ 41.9519 0 25 0 0 25 41.9519 1.5 1.3
+ 36.8786 0 25 0 0 25 36.8786 1.5 1.3
+ 38.0103 0 25 0 0 25 38.0103 1.5 1.3
+ 33.5925 0 25 0 0 25 33.5925 1.5 1.3
+ 41.104 0 25 0 0 25 41.104 1.5 1.3
+ 33.5002 0 25 0 0 25 33.5002 1.5 1.3
+ 44.6368 0 25 0 0 25 44.6368 1.5 1.3
+ 38.4016 0 25 0 0 25 38.4016 1.5 1.3
+ 39.7391 0 25 0 0 25 39.7391 1.5 1.3
+ 33.0593 0 25 0 0 25 33.0593 1.5 1.3
+ 36.0951 0 25 0 0 25 36.0951 1.5 1.3
+ 34.4149 0 25 0 0 25 34.4149 1.5 1.3
+ 40.4641 0 25 0 0 25 40.4641 1.5 1.3
+ 47.0624 0 25 0 0 25 47.0624 1.5 1.3
+ 42.0166 0 25 0 0 25 42.0166 1.5 1.3
+ 33.7356 0 25 0 0 25 33.7356 1.5 1.3
+ 34.837 0 25 0 0 25 34.837 1.5 1.3
+ 41.0721 0 25 0 0 25 41.0721 1.5 1.3
+ 33.8503 0 25 0 0 25 33.8503 1.5 1.3
+ 43.1097 0 25 0 0 25 43.1097 1.5 1.3
+ 38.4373 0 25 0 0 25 38.4373 1.5 1.3
+ 38.3047 0 25 0 0 25 38.3047 1.5 1.3
+ 35.4199 0 25 0 0 25 35.4199 1.5 1.3
+ 34.3545 0 25 0 0 25 34.3545 1.5 1.3
+ 32.9007 0 25 0 0 25 32.9007 1.5 1.3
+ 34.5345 0 25 0 0 25 34.5345 1.5 1.3
+ 50.4348 0 25 0 0 25 50.4348 1.5 1.3
+ 46.4183 0 25 0 0 25 46.4183 1.5 1.3
+ 75.706 0 25 0 0 25 75.706 1.5 1.3
+ 41.5892 0 25 0 0 25 41.5892 1.5 1.3
+ 59.4243 0 25 0 0 25 59.4243 1.5 1.3
+ 49.8235 0 25 0 0 25 49.8235 1.5 1.3
+ 64.5899 0 25 0 0 25 64.5899 1.5 1.3
+ 45.5272 0 25 0 0 25 45.5272 1.5 1.3
+ 46.6028 0 25 0 0 25 46.6028 1.5 1.3
+ 49.2918 0 25 0 0 25 49.2918 1.5 1.3
+ 53.454 0 25 0 0 25 53.454 1.5 1.3
+ 58.1034 0 25 0 0 25 58.1034 1.5 1.3
+ 81.9088 0 25 0 0 25 81.9088 1.5 1.3
+ 77.903 0 25 0 0 25 77.903 1.5 1.3
+ 47.3011 0 25 0 0 25 47.3011 1.5 1.3
+ 39.8093 0 25 0 0 25 39.8093 1.5 1.3
+ 54.8416 0 25 0 0 25 54.8416 1.5 1.3
+ 48.3344 0 25 0 0 25 48.3344 1.5 1.3
+ 51.4203 0 25 0 0 25 51.4203 1.5 1.3
+ 40.9766 0 25 0 0 25 40.9766 1.5 1.3
+ 79.1987 0 25 0 0 25 79.1987 1.5 1.3
+ 57.7173 0 25 0 0 25 57.7173 1.5 1.3
+ 55.482 0 25 0 0 25 55.482 1.5 1.3
+ 175.558 0 25 0 0 25 175.558 1.5 1.3
+ 140.241 0 25 0 0 25 140.241 1.5 1.3
+ 51.9127 0 25 0 0 25 51.9127 1.5 1.3
+ 49.0043 0 25 0 0 25 49.0043 1.5 1.3
+ 72.5986 0 25 0 0 25 72.5986 1.5 1.3
+ 92.0827 0 25 0 0 25 92.0827 1.5 1.3
+ 61.4992 0 25 0 0 25 61.4992 1.5 1.3
+ 43.6855 0 25 0 0 25 43.6855 1.5 1.3
+ 53.3481 0 25 0 0 25 53.3481 1.5 1.3
+ 55.4937 0 25 0 0 25 55.4937 1.5 1.3
+ 49.7404 0 25 0 0 25 49.7404 1.5 1.3
+ 82.1686 0 25 0 0 25 82.1686 1.5 1.3
+ 54.3119 0 25 0 0 25 54.3119 1.5 1.3
+ 162.143 0 25 0 0 25 162.143 1.5 1.3
+ 155.853 0 25 0 0 25 155.853 1.5 1.3
+ 88.8141 0 25 0 0 25 88.8141 1.5 1.3
+ 83.2965 0 25 0 0 25 83.2965 1.5 1.3
+ 60.8103 0 25 0 0 25 60.8103 1.5 1.3
+ 71.6975 0 25 0 0 25 71.6975 1.5 1.3
+ 50.111 0 25 0 0 25 50.111 1.5 1.3
+ 43.2261 0 25 0 0 25 43.2261 1.5 1.3
+ 54.3794 0 25 0 0 25 54.3794 1.5 1.3
+ 48.7814 0 25 0 0 25 48.7814 1.5 1.3
+ 54.8528 0 25 0 0 25 54.8528 1.5 1.3
+ 41.4376 0 25 0 0 25 41.4376 1.5 1.3
+ 56.5746 0 25 0 0 25 56.5746 1.5 1.3
+ 56.3419 0 25 0 0 25 56.3419 1.5 1.3
+ 75.9226 0 25 0 0 25 75.9226 1.5 1.3
+ 164.641 0 25 0 0 25 164.641 1.5 1.3
+ 83.4672 0 25 0 0 25 83.4672 1.5 1.3
+ 143.894 0 25 0 0 25 143.894 1.5 1.3
+ 364.525 0 25 0 0 25 364.525 1.5 1.3
+ 1854.46 0 25 0 0 25 1854.46 1.5 1.3
+ 1990.31 0 25 0 0 25 1990.31 1.5 1.3
+ 467.416 0 25 0 0 25 467.416 1.5 1.3
+ 435.358 0 25 0 0 25 435.358 1.5 1.3
+ 38142.8 0 25 0 0 25 38142.8 1.5 1.3
+ 931.876 0 25 0 0 25 931.876 1.5 1.3
+ 868.033 0 25 0 0 25 868.033 1.5 1.3
+ 2231.35 0 25 0 0 25 2231.35 1.5 1.3
+ 501.278 0 25 0 0 25 501.278 1.5 1.3
+ 3105.45 0 25 0 0 25 3105.45 1.5 1.3
+ 70.7574 0 25 0 0 25 70.7574 1.5 1.3
+ 188.874 0 25 0 0 25 188.874 1.5 1.3
+ 183.861 0 25 0 0 25 183.861 1.5 1.3
+ 64.7536 0 25 0 0 25 64.7536 1.5 1.3
+ 91.0633 0 25 0 0 25 91.0633 1.5 1.3
+ 79.9139 0 25 0 0 25 79.9139 1.5 1.3
+ 154.143 0 25 0 0 25 154.143 1.5 1.3
+ 307.624 0 25 0 0 25 307.624 1.5 1.3
+ 69.183 0 25 0 0 25 69.183 1.5 1.3
+ 186.999 0 25 0 0 25 186.999 1.5 1.3
+ 77.0239 0 25 0 0 25 77.0239 1.5 1.3
+ 69.7269 0 25 0 0 25 69.7269 1.5 1.3
+ 152.679 0 25 0 0 25 152.679 1.5 1.3
+ 13777.2 0 25 0 0 25 13777.2 1.5 1.3
+ 648.721 0 25 0 0 25 648.721 1.5 1.3
+ 212.389 0 25 0 0 25 212.389 1.5 1.3
+ 1876.49 0 25 0 0 25 1876.49 1.5 1.3
+ 410.66 0 25 0 0 25 410.66 1.5 1.3
+ 2544.49 0 25 0 0 25 2544.49 1.5 1.3
+ 163.423 0 25 0 0 25 163.423 1.5 1.3
+ 99895.6 0 25 0 0 25 99895.6 1.5 1.3
+ 538.805 0 25 0 0 25 538.805 1.5 1.3
+ 11264 0 25 0 0 25 11264 1.5 1.3
+ 630.211 0 25 0 0 25 630.211 1.5 1.3
+ 14757.6 0 25 0 0 25 14757.6 1.5 1.3
+ 261.939 0 25 0 0 25 261.939 1.5 1.3
+ 298.978 0 25 0 0 25 298.978 1.5 1.3
+ 688.504 0 25 0 0 25 688.504 1.5 1.3
+ 3428.16 0 25 0 0 25 3428.16 1.5 1.3
+ 1020.51 0 25 0 0 25 1020.51 1.5 1.3
+ 7320.33 0 25 0 0 25 7320.33 1.5 1.3
+ 3420.78 0 25 0 0 25 3420.78 1.5 1.3
+ 495.993 0 25 0 0 25 495.993 1.5 1.3
+ 127.335 0 25 0 0 25 127.335 1.5 1.3
+ 436.708 0 25 0 0 25 436.708 1.5 1.3
+ 244.978 0 25 0 0 25 244.978 1.5 1.3
+ 25467.5 0 25 0 0 25 25467.5 1.5 1.3
+ 180.817 0 25 0 0 25 180.817 1.5 1.3
+ 936.065 0 25 0 0 25 936.065 1.5 1.3
+ 218.631 0 25 0 0 25 218.631 1.5 1.3
+ 117.91 0 25 0 0 25 117.91 1.5 1.3
+ 770.615 0 25 0 0 25 770.615 1.5 1.3
+ 388.564 0 25 0 0 25 388.564 1.5 1.3
+ 688.236 0 25 0 0 25 688.236 1.5 1.3
+ 2319.28 0 25 0 0 25 2319.28 1.5 1.3
+ 2329.45 0 25 0 0 25 2329.45 1.5 1.3
+ 598.209 0 25 0 0 25 598.209 1.5 1.3
+ 1305.83 0 25 0 0 25 1305.83 1.5 1.3
+ 72.399 0 25 0 0 25 72.399 1.5 1.3
+ 71.1276 0 25 0 0 25 71.1276 1.5 1.3
+ 64.1963 0 25 0 0 25 64.1963 1.5 1.3
+ 64.2196 0 25 0 0 25 64.2196 1.5 1.3
+ 72.6574 0 25 0 0 25 72.6574 1.5 1.3
+ 84.4364 0 25 0 0 25 84.4364 1.5 1.3
+ 90.2046 0 25 0 0 25 90.2046 1.5 1.3
+ 42.2957 0 25 0 0 25 42.2957 1.5 1.3
+ 37.5601 0 25 0 0 25 37.5601 1.5 1.3
+ 32.9205 0 25 0 0 25 32.9205 1.5 1.3
+ 33.14 0 25 0 0 25 33.14 1.5 1.3
+ 34.6266 0 25 0 0 25 34.6266 1.5 1.3
+ 36.3062 0 25 0 0 25 36.3062 1.5 1.3
+ 38.1768 0 25 0 0 25 38.1768 1.5 1.3
+ 32.885 0 25 0 0 25 32.885 1.5 1.3
+ 34.6636 0 25 0 0 25 34.6636 1.5 1.3
+ 44.1843 0 25 0 0 25 44.1843 1.5 1.3
+ 38.0452 0 25 0 0 25 38.0452 1.5 1.3
+ 33.0764 0 25 0 0 25 33.0764 1.5 1.3
+ 33.8276 0 25 0 0 25 33.8276 1.5 1.3
+ 41.6413 0 25 0 0 25 41.6413 1.5 1.3
+ 36.9214 0 25 0 0 25 36.9214 1.5 1.3
+ 39.6888 0 25 0 0 25 39.6888 1.5 1.3
+ 32.707 0 25 0 0 25 32.707 1.5 1.3
+ 33.5614 0 25 0 0 25 33.5614 1.5 1.3
+ 33.0423 0 25 0 0 25 33.0423 1.5 1.3
+ 37.3919 0 25 0 0 25 37.3919 1.5 1.3
+ 37.5579 0 25 0 0 25 37.5579 1.5 1.3
+ 34.9651 0 25 0 0 25 34.9651 1.5 1.3
+ 35.0731 0 25 0 0 25 35.0731 1.5 1.3
+ 33.9142 0 25 0 0 25 33.9142 1.5 1.3
+ 35.8889 0 25 0 0 25 35.8889 1.5 1.3
+ 34.1427 0 25 0 0 25 34.1427 1.5 1.3
+ 38.1359 0 25 0 0 25 38.1359 1.5 1.3
+ 46.0209 0 25 0 0 25 46.0209 1.5 1.3
+ 38.8122 0 25 0 0 25 38.8122 1.5 1.3
+ 43.4953 0 25 0 0 25 43.4953 1.5 1.3
+ 32.9915 0 25 0 0 25 32.9915 1.5 1.3
+ 35.2922 0 25 0 0 25 35.2922 1.5 1.3
+ 33.2119 0 25 0 0 25 33.2119 1.5 1.3
+ 44.7009 0 25 0 0 25 44.7009 1.5 1.3
+ 38.1214 0 25 0 0 25 38.1214 1.5 1.3
+ 33.0154 0 25 0 0 25 33.0154 1.5 1.3
+ 33.1773 0 25 0 0 25 33.1773 1.5 1.3
+ 33.2759 0 25 0 0 25 33.2759 1.5 1.3
+ 34.9006 0 25 0 0 25 34.9006 1.5 1.3
+ 41.6255 0 25 0 0 25 41.6255 1.5 1.3
+ 36.8518 0 25 0 0 25 36.8518 1.5 1.3
+ 38.9838 0 25 0 0 25 38.9838 1.5 1.3
+ 37.7466 0 25 0 0 25 37.7466 1.5 1.3
+ 36.335 0 25 0 0 25 36.335 1.5 1.3
+ 36.4843 0 25 0 0 25 36.4843 1.5 1.3
+ 34.5309 0 25 0 0 25 34.5309 1.5 1.3
+ 33.7342 0 25 0 0 25 33.7342 1.5 1.3
+ 35.288 0 25 0 0 25 35.288 1.5 1.3
+ 32.6418 0 25 0 0 25 32.6418 1.5 1.3
+ 33.2861 0 25 0 0 25 33.2861 1.5 1.3
+ 35.1423 0 25 0 0 25 35.1423 1.5 1.3
+ 34.0222 0 25 0 0 25 34.0222 1.5 1.3
+ 35.7209 0 25 0 0 25 35.7209 1.5 1.3
+ 34.0865 0 25 0 0 25 34.0865 1.5 1.3
+ 51.3086 0 25 0 0 25 51.3086 1.5 1.3
+ 48.011 0 25 0 0 25 48.011 1.5 1.3
+ 42.7391 0 25 0 0 25 42.7391 1.5 1.3
+ 41.2602 0 25 0 0 25 41.2602 1.5 1.3
+ 49.7197 0 25 0 0 25 49.7197 1.5 1.3
+ 90.1883 0 25 0 0 25 90.1883 1.5 1.3
+ 78.7004 0 25 0 0 25 78.7004 1.5 1.3
+ 61.3828 0 25 0 0 25 61.3828 1.5 1.3
+ 40.0064 0 25 0 0 25 40.0064 1.5 1.3
+ 39.4342 0 25 0 0 25 39.4342 1.5 1.3
+ 44.2189 0 25 0 0 25 44.2189 1.5 1.3
+ 66.4349 0 25 0 0 25 66.4349 1.5 1.3
+ 66.4995 0 25 0 0 25 66.4995 1.5 1.3
+ 52.1445 0 25 0 0 25 52.1445 1.5 1.3
+ 52.006 0 25 0 0 25 52.006 1.5 1.3
+ 47.2366 0 25 0 0 25 47.2366 1.5 1.3
+ 57.6124 0 25 0 0 25 57.6124 1.5 1.3
+ 48.6438 0 25 0 0 25 48.6438 1.5 1.3
+ 77.2756 0 25 0 0 25 77.2756 1.5 1.3
+ 92.8311 0 25 0 0 25 92.8311 1.5 1.3
+ 57.2244 0 25 0 0 25 57.2244 1.5 1.3
+ 62.2425 0 25 0 0 25 62.2425 1.5 1.3
+ 41.7931 0 25 0 0 25 41.7931 1.5 1.3
+ 49.0618 0 25 0 0 25 49.0618 1.5 1.3
+ 50.7767 0 25 0 0 25 50.7767 1.5 1.3
+ 46.5951 0 25 0 0 25 46.5951 1.5 1.3
+ 48.2552 0 25 0 0 25 48.2552 1.5 1.3
+ 47.3718 0 25 0 0 25 47.3718 1.5 1.3
+ 51.3844 0 25 0 0 25 51.3844 1.5 1.3
+ 44.1275 0 25 0 0 25 44.1275 1.5 1.3
+ 57.4364 0 25 0 0 25 57.4364 1.5 1.3
+ 60.8562 0 25 0 0 25 60.8562 1.5 1.3
+ 73.9823 0 25 0 0 25 73.9823 1.5 1.3
+ 57.53 0 25 0 0 25 57.53 1.5 1.3
+ 71.6107 0 25 0 0 25 71.6107 1.5 1.3
+ 50.5871 0 25 0 0 25 50.5871 1.5 1.3
+ 37.4326 0 25 0 0 25 37.4326 1.5 1.3
+ 40.0336 0 25 0 0 25 40.0336 1.5 1.3
+ 45.1873 0 25 0 0 25 45.1873 1.5 1.3
+ 42.7365 0 25 0 0 25 42.7365 1.5 1.3
+ 48.8071 0 25 0 0 25 48.8071 1.5 1.3
+ 56.0987 0 25 0 0 25 56.0987 1.5 1.3
+ 52.0414 0 25 0 0 25 52.0414 1.5 1.3
+ 38.2553 0 25 0 0 25 38.2553 1.5 1.3
+ 40.6346 0 25 0 0 25 40.6346 1.5 1.3
+ 45.0294 0 25 0 0 25 45.0294 1.5 1.3
+ 44.3174 0 25 0 0 25 44.3174 1.5 1.3
+ 36.377 0 25 0 0 25 36.377 1.5 1.3
+ 82.0536 0 25 0 0 25 82.0536 1.5 1.3
+ 51.8814 0 25 0 0 25 51.8814 1.5 1.3
+ 65.3485 0 25 0 0 25 65.3485 1.5 1.3
+ 160.335 0 25 0 0 25 160.335 1.5 1.3
+ 184.219 0 25 0 0 25 184.219 1.5 1.3
+ 123.091 0 25 0 0 25 123.091 1.5 1.3
+ 181.089 0 25 0 0 25 181.089 1.5 1.3
+ 97.298 0 25 0 0 25 97.298 1.5 1.3
+ 164.639 0 25 0 0 25 164.639 1.5 1.3
+ 49.6081 0 25 0 0 25 49.6081 1.5 1.3
+ 54.3714 0 25 0 0 25 54.3714 1.5 1.3
+ 55.5168 0 25 0 0 25 55.5168 1.5 1.3
+ 53.3432 0 25 0 0 25 53.3432 1.5 1.3
+ 44.6051 0 25 0 0 25 44.6051 1.5 1.3
+ 46.0368 0 25 0 0 25 46.0368 1.5 1.3
+ 88.8355 0 25 0 0 25 88.8355 1.5 1.3
+ 79.7624 0 25 0 0 25 79.7624 1.5 1.3
+ 65.7041 0 25 0 0 25 65.7041 1.5 1.3
+ 73.2876 0 25 0 0 25 73.2876 1.5 1.3
+ 83.8232 0 25 0 0 25 83.8232 1.5 1.3
+ 126.293 0 25 0 0 25 126.293 1.5 1.3
+ 122.531 0 25 0 0 25 122.531 1.5 1.3
+ 72.8768 0 25 0 0 25 72.8768 1.5 1.3
+ 67.5373 0 25 0 0 25 67.5373 1.5 1.3
+ 70.1727 0 25 0 0 25 70.1727 1.5 1.3
+ 41.9958 0 25 0 0 25 41.9958 1.5 1.3
+ 42.2876 0 25 0 0 25 42.2876 1.5 1.3
+ 56.2108 0 25 0 0 25 56.2108 1.5 1.3
+ 50.0728 0 25 0 0 25 50.0728 1.5 1.3
+ 51.2829 0 25 0 0 25 51.2829 1.5 1.3
+ 56.9021 0 25 0 0 25 56.9021 1.5 1.3
+ 61.7333 0 25 0 0 25 61.7333 1.5 1.3
+ 52.5142 0 25 0 0 25 52.5142 1.5 1.3
+ 58.0819 0 25 0 0 25 58.0819 1.5 1.3
+ 45.5765 0 25 0 0 25 45.5765 1.5 1.3
+ 54.93 0 25 0 0 25 54.93 1.5 1.3
+ 79.055 0 25 0 0 25 79.055 1.5 1.3
+ 95.0846 0 25 0 0 25 95.0846 1.5 1.3
+ 69.3942 0 25 0 0 25 69.3942 1.5 1.3
+ 57.9924 0 25 0 0 25 57.9924 1.5 1.3
+ 51.0755 0 25 0 0 25 51.0755 1.5 1.3
+ 64.1824 0 25 0 0 25 64.1824 1.5 1.3
+ 51.665 0 25 0 0 25 51.665 1.5 1.3
+ 155.339 0 25 0 0 25 155.339 1.5 1.3
+ 169.421 0 25 0 0 25 169.421 1.5 1.3
+ 187.367 0 25 0 0 25 187.367 1.5 1.3
+ 131.711 0 25 0 0 25 131.711 1.5 1.3
+ 151.24 0 25 0 0 25 151.24 1.5 1.3
+ 73.6927 0 25 0 0 25 73.6927 1.5 1.3
+ 86.8362 0 25 0 0 25 86.8362 1.5 1.3
+ 75.4585 0 25 0 0 25 75.4585 1.5 1.3
+ 107.62 0 25 0 0 25 107.62 1.5 1.3
+ 104.693 0 25 0 0 25 104.693 1.5 1.3
+ 62.3377 0 25 0 0 25 62.3377 1.5 1.3
+ 55.9131 0 25 0 0 25 55.9131 1.5 1.3
+ 39.6974 0 25 0 0 25 39.6974 1.5 1.3
+ 48.4287 0 25 0 0 25 48.4287 1.5 1.3
+ 45.9854 0 25 0 0 25 45.9854 1.5 1.3
+ 57.826 0 25 0 0 25 57.826 1.5 1.3
+ 53.6972 0 25 0 0 25 53.6972 1.5 1.3
+ 53.3268 0 25 0 0 25 53.3268 1.5 1.3
+ 38.428 0 25 0 0 25 38.428 1.5 1.3
+ 40.8022 0 25 0 0 25 40.8022 1.5 1.3
+ 45.3458 0 25 0 0 25 45.3458 1.5 1.3
+ 44.5387 0 25 0 0 25 44.5387 1.5 1.3
+ 52.6663 0 25 0 0 25 52.6663 1.5 1.3
+ 77.0324 0 25 0 0 25 77.0324 1.5 1.3
+ 166.051 0 25 0 0 25 166.051 1.5 1.3
+ 158.007 0 25 0 0 25 158.007 1.5 1.3
+ 66.8811 0 25 0 0 25 66.8811 1.5 1.3
+ 76.1774 0 25 0 0 25 76.1774 1.5 1.3
+ 110.791 0 25 0 0 25 110.791 1.5 1.3
+ 69.566 0 25 0 0 25 69.566 1.5 1.3
+ 121.828 0 25 0 0 25 121.828 1.5 1.3
+ 164.374 0 25 0 0 25 164.374 1.5 1.3
+ 149.558 0 25 0 0 25 149.558 1.5 1.3
+ 209.267 0 25 0 0 25 209.267 1.5 1.3
+ 451.483 0 25 0 0 25 451.483 1.5 1.3
+ 1654.47 0 25 0 0 25 1654.47 1.5 1.3
+ 2375.74 0 25 0 0 25 2375.74 1.5 1.3
+ 3054.67 0 25 0 0 25 3054.67 1.5 1.3
+ 556.756 0 25 0 0 25 556.756 1.5 1.3
+ 1131.9 0 25 0 0 25 1131.9 1.5 1.3
+ 551.04 0 25 0 0 25 551.04 1.5 1.3
+ 27999.1 0 25 0 0 25 27999.1 1.5 1.3
+ 242.99 0 25 0 0 25 242.99 1.5 1.3
+ 258.991 0 25 0 0 25 258.991 1.5 1.3
+ 1178.24 0 25 0 0 25 1178.24 1.5 1.3
+ 4247.8 0 25 0 0 25 4247.8 1.5 1.3
+ 242.084 0 25 0 0 25 242.084 1.5 1.3
+ 8244.3 0 25 0 0 25 8244.3 1.5 1.3
+ 2836.96 0 25 0 0 25 2836.96 1.5 1.3
+ 97.8763 0 25 0 0 25 97.8763 1.5 1.3
+ 2614.27 0 25 0 0 25 2614.27 1.5 1.3
+ 65.0264 0 25 0 0 25 65.0264 1.5 1.3
+ 83.345 0 25 0 0 25 83.345 1.5 1.3
+ 339.716 0 25 0 0 25 339.716 1.5 1.3
+ 125.789 0 25 0 0 25 125.789 1.5 1.3
+ 127.487 0 25 0 0 25 127.487 1.5 1.3
+ 167.97 0 25 0 0 25 167.97 1.5 1.3
+ 336.647 0 25 0 0 25 336.647 1.5 1.3
+ 62.4826 0 25 0 0 25 62.4826 1.5 1.3
+ 62.4917 0 25 0 0 25 62.4917 1.5 1.3
+ 68.4999 0 25 0 0 25 68.4999 1.5 1.3
+ 65.985 0 25 0 0 25 65.985 1.5 1.3
+ 106.579 0 25 0 0 25 106.579 1.5 1.3
+ 82.1541 0 25 0 0 25 82.1541 1.5 1.3
+ 87.6205 0 25 0 0 25 87.6205 1.5 1.3
+ 73.1988 0 25 0 0 25 73.1988 1.5 1.3
+ 80.9648 0 25 0 0 25 80.9648 1.5 1.3
+ 114.84 0 25 0 0 25 114.84 1.5 1.3
+ 63.8462 0 25 0 0 25 63.8462 1.5 1.3
+ 65.1801 0 25 0 0 25 65.1801 1.5 1.3
+ 66.1456 0 25 0 0 25 66.1456 1.5 1.3
+ 78.5321 0 25 0 0 25 78.5321 1.5 1.3
+ 276.048 0 25 0 0 25 276.048 1.5 1.3
+ 117.78 0 25 0 0 25 117.78 1.5 1.3
+ 205.857 0 25 0 0 25 205.857 1.5 1.3
+ 65.5102 0 25 0 0 25 65.5102 1.5 1.3
+ 63.9688 0 25 0 0 25 63.9688 1.5 1.3
+ 77.6836 0 25 0 0 25 77.6836 1.5 1.3
+ 213.825 0 25 0 0 25 213.825 1.5 1.3
+ 107.786 0 25 0 0 25 107.786 1.5 1.3
+ 142.007 0 25 0 0 25 142.007 1.5 1.3
+ 2809.5 0 25 0 0 25 2809.5 1.5 1.3
+ 710.366 0 25 0 0 25 710.366 1.5 1.3
+ 3341.88 0 25 0 0 25 3341.88 1.5 1.3
+ 3044.52 0 25 0 0 25 3044.52 1.5 1.3
+ 122.536 0 25 0 0 25 122.536 1.5 1.3
+ 181.491 0 25 0 0 25 181.491 1.5 1.3
+ 413.663 0 25 0 0 25 413.663 1.5 1.3
+ 296.176 0 25 0 0 25 296.176 1.5 1.3
+ 9418.47 0 25 0 0 25 9418.47 1.5 1.3
+ 468.721 0 25 0 0 25 468.721 1.5 1.3
+ 1483.38 0 25 0 0 25 1483.38 1.5 1.3
+ 110.569 0 25 0 0 25 110.569 1.5 1.3
+ 94.303 0 25 0 0 25 94.303 1.5 1.3
+ 146.683 0 25 0 0 25 146.683 1.5 1.3
+ 292.478 0 25 0 0 25 292.478 1.5 1.3
+ 238.67 0 25 0 0 25 238.67 1.5 1.3
+ 2239.5 0 25 0 0 25 2239.5 1.5 1.3
+ 4021.65 0 25 0 0 25 4021.65 1.5 1.3
+ 4425.83 0 25 0 0 25 4425.83 1.5 1.3
+ 19973.8 0 25 0 0 25 19973.8 1.5 1.3
+ 55908.9 0 25 0 0 25 55908.9 1.5 1.3
+ 233.904 0 25 0 0 25 233.904 1.5 1.3
+ 1344.93 0 25 0 0 25 1344.93 1.5 1.3
+ 1205.83 0 25 0 0 25 1205.83 1.5 1.3
+ 340.694 0 25 0 0 25 340.694 1.5 1.3
+ 1258.1 0 25 0 0 25 1258.1 1.5 1.3
+ 197.068 0 25 0 0 25 197.068 1.5 1.3
+ 440.809 0 25 0 0 25 440.809 1.5 1.3
+ 2470.05 0 25 0 0 25 2470.05 1.5 1.3
+ 215.589 0 25 0 0 25 215.589 1.5 1.3
+ 1068.63 0 25 0 0 25 1068.63 1.5 1.3
+ 614.619 0 25 0 0 25 614.619 1.5 1.3
+ 1856.45 0 25 0 0 25 1856.45 1.5 1.3
+ 17251.4 0 25 0 0 25 17251.4 1.5 1.3
+ 605.481 0 25 0 0 25 605.481 1.5 1.3
+ 53420.8 0 25 0 0 25 53420.8 1.5 1.3
+ 1922.12 0 25 0 0 25 1922.12 1.5 1.3
+ 8711.11 0 25 0 0 25 8711.11 1.5 1.3
+ 714.61 0 25 0 0 25 714.61 1.5 1.3
+ 254.687 0 25 0 0 25 254.687 1.5 1.3
+ 266.723 0 25 0 0 25 266.723 1.5 1.3
+ 870.034 0 25 0 0 25 870.034 1.5 1.3
+ 242.354 0 25 0 0 25 242.354 1.5 1.3
+ 189.572 0 25 0 0 25 189.572 1.5 1.3
+ 365.5 0 25 0 0 25 365.5 1.5 1.3
+ 405.505 0 25 0 0 25 405.505 1.5 1.3
+ 1512.42 0 25 0 0 25 1512.42 1.5 1.3
+ 1261.73 0 25 0 0 25 1261.73 1.5 1.3
+ 8450.81 0 25 0 0 25 8450.81 1.5 1.3
+ 143.982 0 25 0 0 25 143.982 1.5 1.3
+ 282.954 0 25 0 0 25 282.954 1.5 1.3
+ 1414.87 0 25 0 0 25 1414.87 1.5 1.3
+ 471.831 0 25 0 0 25 471.831 1.5 1.3
+ 484.095 0 25 0 0 25 484.095 1.5 1.3
+ 140.617 0 25 0 0 25 140.617 1.5 1.3
+ 504.375 0 25 0 0 25 504.375 1.5 1.3
+ 326.456 0 25 0 0 25 326.456 1.5 1.3
+ 1262.44 0 25 0 0 25 1262.44 1.5 1.3
+ 694.177 0 25 0 0 25 694.177 1.5 1.3
+ 207.792 0 25 0 0 25 207.792 1.5 1.3
+ 334.235 0 25 0 0 25 334.235 1.5 1.3
+ 307.1 0 25 0 0 25 307.1 1.5 1.3
+ 341.013 0 25 0 0 25 341.013 1.5 1.3
+ 3909.24 0 25 0 0 25 3909.24 1.5 1.3
+ 1317.25 0 25 0 0 25 1317.25 1.5 1.3
+ 819.718 0 25 0 0 25 819.718 1.5 1.3
+ 107414 0 25 0 0 25 107414 1.5 1.3
+ 56130.4 0 25 0 0 25 56130.4 1.5 1.3
+ 732.336 0 25 0 0 25 732.336 1.5 1.3
+ 308.251 0 25 0 0 25 308.251 1.5 1.3
+ 547.141 0 25 0 0 25 547.141 1.5 1.3
+ 7562.34 0 25 0 0 25 7562.34 1.5 1.3
+ 63.3883 0 25 0 0 25 63.3883 1.5 1.3
+ 67.1656 0 25 0 0 25 67.1656 1.5 1.3
+ 62.2839 0 25 0 0 25 62.2839 1.5 1.3
+ 62.1403 0 25 0 0 25 62.1403 1.5 1.3
+ 79.0438 0 25 0 0 25 79.0438 1.5 1.3
+ 71.1939 0 25 0 0 25 71.1939 1.5 1.3
+ 67.3354 0 25 0 0 25 67.3354 1.5 1.3
+ 91.878 0 25 0 0 25 91.878 1.5 1.3
+ 93.7747 0 25 0 0 25 93.7747 1.5 1.3
+ 76.2626 0 25 0 0 25 76.2626 1.5 1.3
+ 80.5919 0 25 0 0 25 80.5919 1.5 1.3
+ 109.831 0 25 0 0 25 109.831 1.5 1.3
+ 44.4194 0 25 0 0 25 44.4194 1.5 1.3
+ 37.7403 0 25 0 0 25 37.7403 1.5 1.3
+ 38.9527 0 25 0 0 25 38.9527 1.5 1.3
+ 45.5937 0 25 0 0 25 45.5937 1.5 1.3
+ 33.767 0 25 0 0 25 33.767 1.5 1.3
+ 33.3425 0 25 0 0 25 33.3425 1.5 1.3
+ 35.0913 0 25 0 0 25 35.0913 1.5 1.3
+ 39.0463 0 25 0 0 25 39.0463 1.5 1.3
+ 32.628 0 25 0 0 25 32.628 1.5 1.3
+ 34.1077 0 25 0 0 25 34.1077 1.5 1.3
+ 34.8207 0 25 0 0 25 34.8207 1.5 1.3
+ 36.5161 0 25 0 0 25 36.5161 1.5 1.3
+ 33.5072 0 25 0 0 25 33.5072 1.5 1.3
+ 39.8062 0 25 0 0 25 39.8062 1.5 1.3
+ 36.1476 0 25 0 0 25 36.1476 1.5 1.3
+ 42.768 0 25 0 0 25 42.768 1.5 1.3
+ 34.7375 0 25 0 0 25 34.7375 1.5 1.3
+ 32.9773 0 25 0 0 25 32.9773 1.5 1.3
+ 46.0197 0 25 0 0 25 46.0197 1.5 1.3
+ 32.7004 0 25 0 0 25 32.7004 1.5 1.3
+ 33.5952 0 25 0 0 25 33.5952 1.5 1.3
+ 35.4737 0 25 0 0 25 35.4737 1.5 1.3
+ 36.2928 0 25 0 0 25 36.2928 1.5 1.3
+ 37.2296 0 25 0 0 25 37.2296 1.5 1.3
+ 34.2964 0 25 0 0 25 34.2964 1.5 1.3
+ 33.065 0 25 0 0 25 33.065 1.5 1.3
+ 35.6609 0 25 0 0 25 35.6609 1.5 1.3
+ 32.78 0 25 0 0 25 32.78 1.5 1.3
+ 33.6428 0 25 0 0 25 33.6428 1.5 1.3
+ 36.6107 0 25 0 0 25 36.6107 1.5 1.3
+ 34.6326 0 25 0 0 25 34.6326 1.5 1.3
+ 33.8084 0 25 0 0 25 33.8084 1.5 1.3
+ 46.0408 0 25 0 0 25 46.0408 1.5 1.3
+ 40.774 0 25 0 0 25 40.774 1.5 1.3
+ 118.005 0 25 0 0 25 118.005 1.5 1.3
+ 38.6965 0 25 0 0 25 38.6965 1.5 1.3
+ 41.2493 0 25 0 0 25 41.2493 1.5 1.3
+ 71.9274 0 25 0 0 25 71.9274 1.5 1.3
+ 43.9918 0 25 0 0 25 43.9918 1.5 1.3
+ 66.5799 0 25 0 0 25 66.5799 1.5 1.3
+ 61.4817 0 25 0 0 25 61.4817 1.5 1.3
+ 55.6809 0 25 0 0 25 55.6809 1.5 1.3
+ 54.4995 0 25 0 0 25 54.4995 1.5 1.3
+ 74.0937 0 25 0 0 25 74.0937 1.5 1.3
+ 39.8672 0 25 0 0 25 39.8672 1.5 1.3
+ 53.1954 0 25 0 0 25 53.1954 1.5 1.3
+ 56.1125 0 25 0 0 25 56.1125 1.5 1.3
+ 99.3751 0 25 0 0 25 99.3751 1.5 1.3
+ 53.1845 0 25 0 0 25 53.1845 1.5 1.3
+ 57.6703 0 25 0 0 25 57.6703 1.5 1.3
+ 65.0296 0 25 0 0 25 65.0296 1.5 1.3
+ 58.1513 0 25 0 0 25 58.1513 1.5 1.3
+ 53.3258 0 25 0 0 25 53.3258 1.5 1.3
+ 35.925 0 25 0 0 25 35.925 1.5 1.3
+ 60.6648 0 25 0 0 25 60.6648 1.5 1.3
+ 49.9316 0 25 0 0 25 49.9316 1.5 1.3
+ 38.5644 0 25 0 0 25 38.5644 1.5 1.3
+ 34.8717 0 25 0 0 25 34.8717 1.5 1.3
+ 69.2402 0 25 0 0 25 69.2402 1.5 1.3
+ 80.0551 0 25 0 0 25 80.0551 1.5 1.3
+ 41.8989 0 25 0 0 25 41.8989 1.5 1.3
+ 63.5942 0 25 0 0 25 63.5942 1.5 1.3
+ 113.113 0 25 0 0 25 113.113 1.5 1.3
+ 80.6476 0 25 0 0 25 80.6476 1.5 1.3
+ 69.2843 0 25 0 0 25 69.2843 1.5 1.3
+ 84.5759 0 25 0 0 25 84.5759 1.5 1.3
+ 62.3764 0 25 0 0 25 62.3764 1.5 1.3
+ 59.8044 0 25 0 0 25 59.8044 1.5 1.3
+ 45.2793 0 25 0 0 25 45.2793 1.5 1.3
+ 66.6956 0 25 0 0 25 66.6956 1.5 1.3
+ 42.7225 0 25 0 0 25 42.7225 1.5 1.3
+ 50.7338 0 25 0 0 25 50.7338 1.5 1.3
+ 81.1231 0 25 0 0 25 81.1231 1.5 1.3
+ 117.554 0 25 0 0 25 117.554 1.5 1.3
+ 45.4624 0 25 0 0 25 45.4624 1.5 1.3
+ 46.7051 0 25 0 0 25 46.7051 1.5 1.3
+ 55.459 0 25 0 0 25 55.459 1.5 1.3
+ 337.086 0 25 0 0 25 337.086 1.5 1.3
+ 80.372 0 25 0 0 25 80.372 1.5 1.3
+ 71.7813 0 25 0 0 25 71.7813 1.5 1.3
+ 99.7769 0 25 0 0 25 99.7769 1.5 1.3
+ 65.7649 0 25 0 0 25 65.7649 1.5 1.3
+ 56.5804 0 25 0 0 25 56.5804 1.5 1.3
+ 64.9956 0 25 0 0 25 64.9956 1.5 1.3
+ 37.1539 0 25 0 0 25 37.1539 1.5 1.3
+ 43.2623 0 25 0 0 25 43.2623 1.5 1.3
+ 54.6498 0 25 0 0 25 54.6498 1.5 1.3
+ 51.2879 0 25 0 0 25 51.2879 1.5 1.3
+ 57.9877 0 25 0 0 25 57.9877 1.5 1.3
+ 73.676 0 25 0 0 25 73.676 1.5 1.3
+ 65.9275 0 25 0 0 25 65.9275 1.5 1.3
+ 59.1754 0 25 0 0 25 59.1754 1.5 1.3
+ 90.6376 0 25 0 0 25 90.6376 1.5 1.3
+ 130.971 0 25 0 0 25 130.971 1.5 1.3
+ 169.197 0 25 0 0 25 169.197 1.5 1.3
+ 5899.78 0 25 0 0 25 5899.78 1.5 1.3
+ 700.141 0 25 0 0 25 700.141 1.5 1.3
+ 1089.61 0 25 0 0 25 1089.61 1.5 1.3
+ 275.564 0 25 0 0 25 275.564 1.5 1.3
+ 1861.92 0 25 0 0 25 1861.92 1.5 1.3
+ 37858.4 0 25 0 0 25 37858.4 1.5 1.3
+ 2475.45 0 25 0 0 25 2475.45 1.5 1.3
+ 200.658 0 25 0 0 25 200.658 1.5 1.3
+ 466.761 0 25 0 0 25 466.761 1.5 1.3
+ 5149.12 0 25 0 0 25 5149.12 1.5 1.3
+ 6563.11 0 25 0 0 25 6563.11 1.5 1.3
+ 4450.62 0 25 0 0 25 4450.62 1.5 1.3
+ 78.1004 0 25 0 0 25 78.1004 1.5 1.3
+ 72.9088 0 25 0 0 25 72.9088 1.5 1.3
+ 187.732 0 25 0 0 25 187.732 1.5 1.3
+ 87.6016 0 25 0 0 25 87.6016 1.5 1.3
+ 79.1866 0 25 0 0 25 79.1866 1.5 1.3
+ 101.765 0 25 0 0 25 101.765 1.5 1.3
+ 301.963 0 25 0 0 25 301.963 1.5 1.3
+ 647.419 0 25 0 0 25 647.419 1.5 1.3
+ 72.0611 0 25 0 0 25 72.0611 1.5 1.3
+ 70.7134 0 25 0 0 25 70.7134 1.5 1.3
+ 63.6207 0 25 0 0 25 63.6207 1.5 1.3
+ 78.5158 0 25 0 0 25 78.5158 1.5 1.3
+ 102.614 0 25 0 0 25 102.614 1.5 1.3
+ 138.413 0 25 0 0 25 138.413 1.5 1.3
+ 69.8463 0 25 0 0 25 69.8463 1.5 1.3
+ 379.451 0 25 0 0 25 379.451 1.5 1.3
+ 90.0458 0 25 0 0 25 90.0458 1.5 1.3
+ 190.192 0 25 0 0 25 190.192 1.5 1.3
+ 65.5228 0 25 0 0 25 65.5228 1.5 1.3
+ 267.195 0 25 0 0 25 267.195 1.5 1.3
+ 117.655 0 25 0 0 25 117.655 1.5 1.3
+ 19104.4 0 25 0 0 25 19104.4 1.5 1.3
+ 2886.28 0 25 0 0 25 2886.28 1.5 1.3
+ 1053.47 0 25 0 0 25 1053.47 1.5 1.3
+ 90.1176 0 25 0 0 25 90.1176 1.5 1.3
+ 855.544 0 25 0 0 25 855.544 1.5 1.3
+ 119.245 0 25 0 0 25 119.245 1.5 1.3
+ 80.098 0 25 0 0 25 80.098 1.5 1.3
+ 641.924 0 25 0 0 25 641.924 1.5 1.3
+ 1783.55 0 25 0 0 25 1783.55 1.5 1.3
+ 6429.79 0 25 0 0 25 6429.79 1.5 1.3
+ 721.386 0 25 0 0 25 721.386 1.5 1.3
+ 277.06 0 25 0 0 25 277.06 1.5 1.3
+ 164.321 0 25 0 0 25 164.321 1.5 1.3
+ 3274.15 0 25 0 0 25 3274.15 1.5 1.3
+ 770.193 0 25 0 0 25 770.193 1.5 1.3
+ 638.081 0 25 0 0 25 638.081 1.5 1.3
+ 8032.42 0 25 0 0 25 8032.42 1.5 1.3
+ 11099.7 0 25 0 0 25 11099.7 1.5 1.3
+ 2459.31 0 25 0 0 25 2459.31 1.5 1.3
+ 294.885 0 25 0 0 25 294.885 1.5 1.3
+ 3570.66 0 25 0 0 25 3570.66 1.5 1.3
+ 6544.7 0 25 0 0 25 6544.7 1.5 1.3
+ 657.639 0 25 0 0 25 657.639 1.5 1.3
+ 173.656 0 25 0 0 25 173.656 1.5 1.3
+ 172.881 0 25 0 0 25 172.881 1.5 1.3
+ 2941.81 0 25 0 0 25 2941.81 1.5 1.3
+ 128.77 0 25 0 0 25 128.77 1.5 1.3
+ 267.891 0 25 0 0 25 267.891 1.5 1.3
+ 510.082 0 25 0 0 25 510.082 1.5 1.3
+ 158.131 0 25 0 0 25 158.131 1.5 1.3
+ 408.028 0 25 0 0 25 408.028 1.5 1.3
+ 287.396 0 25 0 0 25 287.396 1.5 1.3
+ 206.394 0 25 0 0 25 206.394 1.5 1.3
+ 854.321 0 25 0 0 25 854.321 1.5 1.3
+ 1881.62 0 25 0 0 25 1881.62 1.5 1.3
+ 525.979 0 25 0 0 25 525.979 1.5 1.3
+ 6536.43 0 25 0 0 25 6536.43 1.5 1.3
+ 18063.9 0 25 0 0 25 18063.9 1.5 1.3
+ 1863.02 0 25 0 0 25 1863.02 1.5 1.3
+ 1053.04 0 25 0 0 25 1053.04 1.5 1.3
+ 1346.58 0 25 0 0 25 1346.58 1.5 1.3
+ 2685.88 0 25 0 0 25 2685.88 1.5 1.3
+ 1001.96 0 25 0 0 25 1001.96 1.5 1.3
+ 68.5307 0 25 0 0 25 68.5307 1.5 1.3
+ 64.756 0 25 0 0 25 64.756 1.5 1.3
+ 106.014 0 25 0 0 25 106.014 1.5 1.3
+ 81.6427 0 25 0 0 25 81.6427 1.5 1.3
+ 34.103 0 25 0 0 25 34.103 1.5 1.3
+ 37.3776 0 25 0 0 25 37.3776 1.5 1.3
+ 35.379 0 25 0 0 25 35.379 1.5 1.3
+ 33.5536 0 25 0 0 25 33.5536 1.5 1.3
+ 35.4089 0 25 0 0 25 35.4089 1.5 1.3
+ 36.112 0 25 0 0 25 36.112 1.5 1.3
+ 37.205 0 25 0 0 25 37.205 1.5 1.3
+ 35.1277 0 25 0 0 25 35.1277 1.5 1.3
+ 35.82 0 25 0 0 25 35.82 1.5 1.3
+ 37.6195 0 25 0 0 25 37.6195 1.5 1.3
+ 38.1284 0 25 0 0 25 38.1284 1.5 1.3
+ 34.0713 0 25 0 0 25 34.0713 1.5 1.3
+ 35.2041 0 25 0 0 25 35.2041 1.5 1.3
+ 35.2853 0 25 0 0 25 35.2853 1.5 1.3
+ 33.1972 0 25 0 0 25 33.1972 1.5 1.3
+ 43.5144 0 25 0 0 25 43.5144 1.5 1.3
+ 42.3913 0 25 0 0 25 42.3913 1.5 1.3
+ 112.693 0 25 0 0 25 112.693 1.5 1.3
+ 91.3525 0 25 0 0 25 91.3525 1.5 1.3
+ 42.6839 0 25 0 0 25 42.6839 1.5 1.3
+ 56.1042 0 25 0 0 25 56.1042 1.5 1.3
+ 54.7008 0 25 0 0 25 54.7008 1.5 1.3
+ 43.2015 0 25 0 0 25 43.2015 1.5 1.3
+ 66.5919 0 25 0 0 25 66.5919 1.5 1.3
+ 112.224 0 25 0 0 25 112.224 1.5 1.3
+ 60.9224 0 25 0 0 25 60.9224 1.5 1.3
+ 60.436 0 25 0 0 25 60.436 1.5 1.3
+ 53.3239 0 25 0 0 25 53.3239 1.5 1.3
+ 46.4458 0 25 0 0 25 46.4458 1.5 1.3
+ 45.8293 0 25 0 0 25 45.8293 1.5 1.3
+ 63.5064 0 25 0 0 25 63.5064 1.5 1.3
+ 62.1876 0 25 0 0 25 62.1876 1.5 1.3
+ 87.812 0 25 0 0 25 87.812 1.5 1.3
+ 58.7104 0 25 0 0 25 58.7104 1.5 1.3
+ 48.6628 0 25 0 0 25 48.6628 1.5 1.3
+ 46.6537 0 25 0 0 25 46.6537 1.5 1.3
+ 69.7367 0 25 0 0 25 69.7367 1.5 1.3
+ 116.236 0 25 0 0 25 116.236 1.5 1.3
+ 48.5946 0 25 0 0 25 48.5946 1.5 1.3
+ 42.752 0 25 0 0 25 42.752 1.5 1.3
+ 45.4748 0 25 0 0 25 45.4748 1.5 1.3
+ 772.792 0 25 0 0 25 772.792 1.5 1.3
+ 85.6943 0 25 0 0 25 85.6943 1.5 1.3
+ 60.9349 0 25 0 0 25 60.9349 1.5 1.3
+ 62.6248 0 25 0 0 25 62.6248 1.5 1.3
+ 76.2009 0 25 0 0 25 76.2009 1.5 1.3
+ 56.6458 0 25 0 0 25 56.6458 1.5 1.3
+ 34.829 0 25 0 0 25 34.829 1.5 1.3
+ 59.7339 0 25 0 0 25 59.7339 1.5 1.3
+ 59.7755 0 25 0 0 25 59.7755 1.5 1.3
+ 47.8802 0 25 0 0 25 47.8802 1.5 1.3
+ 46.8682 0 25 0 0 25 46.8682 1.5 1.3
+ 87.7834 0 25 0 0 25 87.7834 1.5 1.3
+ 55.2075 0 25 0 0 25 55.2075 1.5 1.3
+ 81.6134 0 25 0 0 25 81.6134 1.5 1.3
+ 111.471 0 25 0 0 25 111.471 1.5 1.3
+ 76.9982 0 25 0 0 25 76.9982 1.5 1.3
+ 167.62 0 25 0 0 25 167.62 1.5 1.3
+ 273.176 0 25 0 0 25 273.176 1.5 1.3
+ 174.711 0 25 0 0 25 174.711 1.5 1.3
+ 107.313 0 25 0 0 25 107.313 1.5 1.3
+ 7595.18 0 25 0 0 25 7595.18 1.5 1.3
+ 792.513 0 25 0 0 25 792.513 1.5 1.3
+ 1374.76 0 25 0 0 25 1374.76 1.5 1.3
+ 474.271 0 25 0 0 25 474.271 1.5 1.3
+ 2351.92 0 25 0 0 25 2351.92 1.5 1.3
+ 266.02 0 25 0 0 25 266.02 1.5 1.3
+ 1017.32 0 25 0 0 25 1017.32 1.5 1.3
+ 831.981 0 25 0 0 25 831.981 1.5 1.3
+ 48822.3 0 25 0 0 25 48822.3 1.5 1.3
+ 719.572 0 25 0 0 25 719.572 1.5 1.3
+ 71.367 0 25 0 0 25 71.367 1.5 1.3
+ 67.0366 0 25 0 0 25 67.0366 1.5 1.3
+ 83.8474 0 25 0 0 25 83.8474 1.5 1.3
+ 65.3271 0 25 0 0 25 65.3271 1.5 1.3
+ 82.0714 0 25 0 0 25 82.0714 1.5 1.3
+ 65.1701 0 25 0 0 25 65.1701 1.5 1.3
+ 343.544 0 25 0 0 25 343.544 1.5 1.3
+ 263.304 0 25 0 0 25 263.304 1.5 1.3
+ 211.322 0 25 0 0 25 211.322 1.5 1.3
+ 134.974 0 25 0 0 25 134.974 1.5 1.3
+ 87.7121 0 25 0 0 25 87.7121 1.5 1.3
+ 79.9322 0 25 0 0 25 79.9322 1.5 1.3
+ 88.5921 0 25 0 0 25 88.5921 1.5 1.3
+ 98.1336 0 25 0 0 25 98.1336 1.5 1.3
+ 535.652 0 25 0 0 25 535.652 1.5 1.3
+ 344.761 0 25 0 0 25 344.761 1.5 1.3
+ 71.7726 0 25 0 0 25 71.7726 1.5 1.3
+ 66.6267 0 25 0 0 25 66.6267 1.5 1.3
+ 85.9229 0 25 0 0 25 85.9229 1.5 1.3
+ 85.609 0 25 0 0 25 85.609 1.5 1.3
+ 107.55 0 25 0 0 25 107.55 1.5 1.3
+ 93.4966 0 25 0 0 25 93.4966 1.5 1.3
+ 5691.24 0 25 0 0 25 5691.24 1.5 1.3
+ 75.9388 0 25 0 0 25 75.9388 1.5 1.3
+ 459.602 0 25 0 0 25 459.602 1.5 1.3
+ 70.4614 0 25 0 0 25 70.4614 1.5 1.3
+ 683.528 0 25 0 0 25 683.528 1.5 1.3
+ 7073.58 0 25 0 0 25 7073.58 1.5 1.3
+ 11525.4 0 25 0 0 25 11525.4 1.5 1.3
+ 343.385 0 25 0 0 25 343.385 1.5 1.3
+ 662.346 0 25 0 0 25 662.346 1.5 1.3
+ 115.725 0 25 0 0 25 115.725 1.5 1.3
+ 1977.26 0 25 0 0 25 1977.26 1.5 1.3
+ 717.44 0 25 0 0 25 717.44 1.5 1.3
+ 3252.64 0 25 0 0 25 3252.64 1.5 1.3
+ 296.61 0 25 0 0 25 296.61 1.5 1.3
+ 3876.54 0 25 0 0 25 3876.54 1.5 1.3
+ 1968 0 25 0 0 25 1968 1.5 1.3
+ 9943.19 0 25 0 0 25 9943.19 1.5 1.3
+ 286.641 0 25 0 0 25 286.641 1.5 1.3
+ 1322.79 0 25 0 0 25 1322.79 1.5 1.3
+ 212.02 0 25 0 0 25 212.02 1.5 1.3
+ 1790.81 0 25 0 0 25 1790.81 1.5 1.3
+ 268.077 0 25 0 0 25 268.077 1.5 1.3
+ 344.23 0 25 0 0 25 344.23 1.5 1.3
+ 301.955 0 25 0 0 25 301.955 1.5 1.3
+ 1064.23 0 25 0 0 25 1064.23 1.5 1.3
+ 12726.5 0 25 0 0 25 12726.5 1.5 1.3
+ 522.978 0 25 0 0 25 522.978 1.5 1.3
+ 7443.14 0 25 0 0 25 7443.14 1.5 1.3
+ 4938.06 0 25 0 0 25 4938.06 1.5 1.3
+ 79741.4 0 25 0 0 25 79741.4 1.5 1.3
+ 69.5066 0 25 0 0 25 69.5066 1.5 1.3
+ 77.0359 0 25 0 0 25 77.0359 1.5 1.3
+ 91.3561 0 25 0 0 25 91.3561 1.5 1.3
+ 40.7513 0 25 0 0 25 40.7513 1.5 1.3
+ 35.8725 0 25 0 0 25 35.8725 1.5 1.3
+ 35.4357 0 25 0 0 25 35.4357 1.5 1.3
+ 34.0718 0 25 0 0 25 34.0718 1.5 1.3
+ 36.5536 0 25 0 0 25 36.5536 1.5 1.3
+ 39.7418 0 25 0 0 25 39.7418 1.5 1.3
+ 37.7915 0 25 0 0 25 37.7915 1.5 1.3
+ 37.6053 0 25 0 0 25 37.6053 1.5 1.3
+ 36.2779 0 25 0 0 25 36.2779 1.5 1.3
+ 36.3304 0 25 0 0 25 36.3304 1.5 1.3
+ 33.9521 0 25 0 0 25 33.9521 1.5 1.3
+ 45.6354 0 25 0 0 25 45.6354 1.5 1.3
+ 62.144 0 25 0 0 25 62.144 1.5 1.3
+ 183.993 0 25 0 0 25 183.993 1.5 1.3
+ 64.1918 0 25 0 0 25 64.1918 1.5 1.3
+ 47.783 0 25 0 0 25 47.783 1.5 1.3
+ 47.3928 0 25 0 0 25 47.3928 1.5 1.3
+ 39.1751 0 25 0 0 25 39.1751 1.5 1.3
+ 57.3952 0 25 0 0 25 57.3952 1.5 1.3
+ 54.9122 0 25 0 0 25 54.9122 1.5 1.3
+ 98.534 0 25 0 0 25 98.534 1.5 1.3
+ 67.7876 0 25 0 0 25 67.7876 1.5 1.3
+ 1251.76 0 25 0 0 25 1251.76 1.5 1.3
+ 109.497 0 25 0 0 25 109.497 1.5 1.3
+ 65.9741 0 25 0 0 25 65.9741 1.5 1.3
+ 45.6111 0 25 0 0 25 45.6111 1.5 1.3
+ 45.7683 0 25 0 0 25 45.7683 1.5 1.3
+ 48.9374 0 25 0 0 25 48.9374 1.5 1.3
+ 40.1981 0 25 0 0 25 40.1981 1.5 1.3
+ 62.774 0 25 0 0 25 62.774 1.5 1.3
+ 101.38 0 25 0 0 25 101.38 1.5 1.3
+ 92.4425 0 25 0 0 25 92.4425 1.5 1.3
+ 125.798 0 25 0 0 25 125.798 1.5 1.3
+ 151.787 0 25 0 0 25 151.787 1.5 1.3
+ 95.2748 0 25 0 0 25 95.2748 1.5 1.3
+ 121.22 0 25 0 0 25 121.22 1.5 1.3
+ 131.839 0 25 0 0 25 131.839 1.5 1.3
+ 89.2867 0 25 0 0 25 89.2867 1.5 1.3
+ 5414.59 0 25 0 0 25 5414.59 1.5 1.3
+ 332.111 0 25 0 0 25 332.111 1.5 1.3
+ 256.09 0 25 0 0 25 256.09 1.5 1.3
+ 18986 0 25 0 0 25 18986 1.5 1.3
+ 533.13 0 25 0 0 25 533.13 1.5 1.3
+ 430.365 0 25 0 0 25 430.365 1.5 1.3
+ 348.968 0 25 0 0 25 348.968 1.5 1.3
+ 77.3091 0 25 0 0 25 77.3091 1.5 1.3
+ 70.3861 0 25 0 0 25 70.3861 1.5 1.3
+ 719.585 0 25 0 0 25 719.585 1.5 1.3
+ 233.05 0 25 0 0 25 233.05 1.5 1.3
+ 190.285 0 25 0 0 25 190.285 1.5 1.3
+ 154.243 0 25 0 0 25 154.243 1.5 1.3
+ 73.849 0 25 0 0 25 73.849 1.5 1.3
+ 68.9751 0 25 0 0 25 68.9751 1.5 1.3
+ 117.5 0 25 0 0 25 117.5 1.5 1.3
+ 196.593 0 25 0 0 25 196.593 1.5 1.3
+ 97.2799 0 25 0 0 25 97.2799 1.5 1.3
+ 134.579 0 25 0 0 25 134.579 1.5 1.3
+ 101.078 0 25 0 0 25 101.078 1.5 1.3
+ 89.7979 0 25 0 0 25 89.7979 1.5 1.3
+ 107.403 0 25 0 0 25 107.403 1.5 1.3
+ 68.6307 0 25 0 0 25 68.6307 1.5 1.3
+ 104.279 0 25 0 0 25 104.279 1.5 1.3
+ 295.252 0 25 0 0 25 295.252 1.5 1.3
+ 75.626 0 25 0 0 25 75.626 1.5 1.3
+ 248.133 0 25 0 0 25 248.133 1.5 1.3
+ 81.8866 0 25 0 0 25 81.8866 1.5 1.3
+ 604.191 0 25 0 0 25 604.191 1.5 1.3
+ 11417.9 0 25 0 0 25 11417.9 1.5 1.3
+ 4073.64 0 25 0 0 25 4073.64 1.5 1.3
+ 628.779 0 25 0 0 25 628.779 1.5 1.3
+ 408.184 0 25 0 0 25 408.184 1.5 1.3
+ 554.162 0 25 0 0 25 554.162 1.5 1.3
+ 355.465 0 25 0 0 25 355.465 1.5 1.3
+ 303.588 0 25 0 0 25 303.588 1.5 1.3
+ 325.479 0 25 0 0 25 325.479 1.5 1.3
+ 1966.86 0 25 0 0 25 1966.86 1.5 1.3
+ 1504.59 0 25 0 0 25 1504.59 1.5 1.3
+ 1160.84 0 25 0 0 25 1160.84 1.5 1.3
+ 5346.43 0 25 0 0 25 5346.43 1.5 1.3
+ 81.9586 0 25 0 0 25 81.9586 1.5 1.3
+ 113.841 0 25 0 0 25 113.841 1.5 1.3
+ 103.856 0 25 0 0 25 103.856 1.5 1.3
+ 94.6302 0 25 0 0 25 94.6302 1.5 1.3
+ 43.2931 0 25 0 0 25 43.2931 1.5 1.3
+ 36.9473 0 25 0 0 25 36.9473 1.5 1.3
+ 34.4222 0 25 0 0 25 34.4222 1.5 1.3
+ 36.5689 0 25 0 0 25 36.5689 1.5 1.3
+ 40.2632 0 25 0 0 25 40.2632 1.5 1.3
+ 34.3694 0 25 0 0 25 34.3694 1.5 1.3
+ 290.445 0 25 0 0 25 290.445 1.5 1.3
+ 205.143 0 25 0 0 25 205.143 1.5 1.3
+ 121.72 0 25 0 0 25 121.72 1.5 1.3
+ 89.5368 0 25 0 0 25 89.5368 1.5 1.3
+ 37.1489 0 25 0 0 25 37.1489 1.5 1.3
+ 41.7308 0 25 0 0 25 41.7308 1.5 1.3
+ 38.6981 0 25 0 0 25 38.6981 1.5 1.3
+ 53.6291 0 25 0 0 25 53.6291 1.5 1.3
+ 59.438 0 25 0 0 25 59.438 1.5 1.3
+ 119.546 0 25 0 0 25 119.546 1.5 1.3
+ 1440.5 0 25 0 0 25 1440.5 1.5 1.3
+ 452.34 0 25 0 0 25 452.34 1.5 1.3
+ 65.2416 0 25 0 0 25 65.2416 1.5 1.3
+ 50.5529 0 25 0 0 25 50.5529 1.5 1.3
+ 46.7986 0 25 0 0 25 46.7986 1.5 1.3
+ 43.449 0 25 0 0 25 43.449 1.5 1.3
+ 37.3391 0 25 0 0 25 37.3391 1.5 1.3
+ 41.524 0 25 0 0 25 41.524 1.5 1.3
+ 119.196 0 25 0 0 25 119.196 1.5 1.3
+ 94.9226 0 25 0 0 25 94.9226 1.5 1.3
+ 240.998 0 25 0 0 25 240.998 1.5 1.3
+ 525.073 0 25 0 0 25 525.073 1.5 1.3
+ 85 0 25 0 0 25 85 1.5 1.3
+ 77.8631 0 25 0 0 25 77.8631 1.5 1.3
+ 992.29 0 25 0 0 25 992.29 1.5 1.3
+ 146.653 0 25 0 0 25 146.653 1.5 1.3
+ 345.399 0 25 0 0 25 345.399 1.5 1.3
+ 67.0455 0 25 0 0 25 67.0455 1.5 1.3
+ 75.6747 0 25 0 0 25 75.6747 1.5 1.3
+ 134.459 0 25 0 0 25 134.459 1.5 1.3
+ 97.237 0 25 0 0 25 97.237 1.5 1.3
+ 142.22 0 25 0 0 25 142.22 1.5 1.3
+ 71.8367 0 25 0 0 25 71.8367 1.5 1.3
+ 87.2576 0 25 0 0 25 87.2576 1.5 1.3
+ 154.928 0 25 0 0 25 154.928 1.5 1.3
+ 461.045 0 25 0 0 25 461.045 1.5 1.3
+ 159.219 0 25 0 0 25 159.219 1.5 1.3
+ 115.018 0 25 0 0 25 115.018 1.5 1.3
+ 370.697 0 25 0 0 25 370.697 1.5 1.3
+ 2627.51 0 25 0 0 25 2627.51 1.5 1.3
+ 232.415 0 25 0 0 25 232.415 1.5 1.3
+ 198.473 0 25 0 0 25 198.473 1.5 1.3
+ 297.003 0 25 0 0 25 297.003 1.5 1.3
+ 44.1942 0 25 0 0 25 44.1942 1.5 1.3
+ 38.1278 0 25 0 0 25 38.1278 1.5 1.3
+ 37.4492 0 25 0 0 25 37.4492 1.5 1.3
+ 280.41 0 25 0 0 25 280.41 1.5 1.3
+ 386.137 0 25 0 0 25 386.137 1.5 1.3
+ 148.914 0 25 0 0 25 148.914 1.5 1.3
+ 88.3586 0 25 0 0 25 88.3586 1.5 1.3
+ 122.161 0 25 0 0 25 122.161 1.5 1.3
+ 101.869 0 25 0 0 25 101.869 1.5 1.3
+ 78.3366 0 25 0 0 25 78.3366 1.5 1.3
+ 68.2165 0 25 0 0 25 68.2165 1.5 1.3
+ 41.4706 0 25 0 0 25 41.4706 1.5 1.3
+ 104.867 0 25 0 0 25 104.867 1.5 1.3
+ 44.4117 0 25 0 0 25 44.4117 1.5 1.3
+ 44.6423 0 25 0 0 25 44.6423 1.5 1.3
+ 35.1028 0 25 0 0 25 35.1028 1.5 1.3
+ 768.512 0 25 0 0 25 768.512 1.5 1.3
+ 105.689 0 25 0 0 25 105.689 1.5 1.3
+ 161.111 0 25 0 0 25 161.111 1.5 1.3
+ 463.871 0 25 0 0 25 463.871 1.5 1.3
+ 134.281 0 25 0 0 25 134.281 1.5 1.3
+ 84.3926 0 25 0 0 25 84.3926 1.5 1.3
+ 136.685 0 25 0 0 25 136.685 1.5 1.3
+ 76.8078 0 25 0 0 25 76.8078 1.5 1.3
+ 107.624 0 25 0 0 25 107.624 1.5 1.3
+ 598.399 0 25 0 0 25 598.399 1.5 1.3
+ 221.921 0 25 0 0 25 221.921 1.5 1.3
+ 87.9483 0 25 0 0 25 87.9483 1.5 1.3
+ 448.62 0 25 0 0 25 448.62 1.5 1.3
+ 695.023 0 25 0 0 25 695.023 1.5 1.3
+ 43.3427 0 25 0 0 25 43.3427 1.5 1.3
+ 37.7952 0 25 0 0 25 37.7952 1.5 1.3
+ 237.497 0 25 0 0 25 237.497 1.5 1.3
+ 524.093 0 25 0 0 25 524.093 1.5 1.3
+ 89.8949 0 25 0 0 25 89.8949 1.5 1.3
+ 172.874 0 25 0 0 25 172.874 1.5 1.3
+ 114.65 0 25 0 0 25 114.65 1.5 1.3
+ 130.014 0 25 0 0 25 130.014 1.5 1.3
+ 44.4455 0 25 0 0 25 44.4455 1.5 1.3
+ 41.4404 0 25 0 0 25 41.4404 1.5 1.3
+ 43.0687 0 25 0 0 25 43.0687 1.5 1.3
+ 41.1272 0 25 0 0 25 41.1272 1.5 1.3
+ 34.6805 0 25 0 0 25 34.6805 1.5 1.3
+ 116.793 0 25 0 0 25 116.793 1.5 1.3
+ 446.67 0 25 0 0 25 446.67 1.5 1.3
+ 101.575 0 25 0 0 25 101.575 1.5 1.3
+ 211.817 0 25 0 0 25 211.817 1.5 1.3
+ 94.5105 0 25 0 0 25 94.5105 1.5 1.3
+ 202.382 0 25 0 0 25 202.382 1.5 1.3
+ 102.84 0 25 0 0 25 102.84 1.5 1.3
+ 86.7322 0 25 0 0 25 86.7322 1.5 1.3
+ 312.217 0 25 0 0 25 312.217 1.5 1.3
+ 151.348 0 25 0 0 25 151.348 1.5 1.3
+ 80.1648 0 25 0 0 25 80.1648 1.5 1.3
+ 250.121 0 25 0 0 25 250.121 1.5 1.3
+ 40.5079 0 25 0 0 25 40.5079 1.5 1.3
+ 40.155 0 25 0 0 25 40.155 1.5 1.3
+ 77.822 0 25 0 0 25 77.822 1.5 1.3
+ 153.275 0 25 0 0 25 153.275 1.5 1.3
+ 38.4895 0 25 0 0 25 38.4895 1.5 1.3
+ 42.5161 0 25 0 0 25 42.5161 1.5 1.3
+ 38.9504 0 25 0 0 25 38.9504 1.5 1.3
+ 275.954 0 25 0 0 25 275.954 1.5 1.3
+ 98.9156 0 25 0 0 25 98.9156 1.5 1.3
+ 304.865 0 25 0 0 25 304.865 1.5 1.3
+ 93.2649 0 25 0 0 25 93.2649 1.5 1.3
+ 163.515 0 25 0 0 25 163.515 1.5 1.3
+ 356.158 0 25 0 0 25 356.158 1.5 1.3
+ 468.985 0 25 0 0 25 468.985 1.5 1.3
+ 74.5453 0 25 0 0 25 74.5453 1.5 1.3
+ 65.7392 0 25 0 0 25 65.7392 1.5 1.3
+ 36.4432 0 25 0 0 25 36.4432 1.5 1.3
+ 40.8942 0 25 0 0 25 40.8942 1.5 1.3
+ 36.5027 0 25 0 0 25 36.5027 1.5 1.3
+ 182.455 0 25 0 0 25 182.455 1.5 1.3
+ 439.346 0 25 0 0 25 439.346 1.5 1.3
+ 98.6121 0 25 0 0 25 98.6121 1.5 1.3
+ 95.8998 0 25 0 0 25 95.8998 1.5 1.3
+ 83.5375 0 25 0 0 25 83.5375 1.5 1.3
+ 120.942 0 25 0 0 25 120.942 1.5 1.3
+ 277.617 0 25 0 0 25 277.617 1.5 1.3
+ 39.5103 0 25 0 0 25 39.5103 1.5 1.3
+ 38.2853 0 25 0 0 25 38.2853 1.5 1.3
+ 129.036 0 25 0 0 25 129.036 1.5 1.3
+ 310.742 0 25 0 0 25 310.742 1.5 1.3
+ 103.924 0 25 0 0 25 103.924 1.5 1.3
+ 176.673 0 25 0 0 25 176.673 1.5 1.3
+ 178.507 0 25 0 0 25 178.507 1.5 1.3
+ 36.7262 0 25 0 0 25 36.7262 1.5 1.3
+ 110.336 0 25 0 0 25 110.336 1.5 1.3
+ 187.331 0 25 0 0 25 187.331 1.5 1.3
+ 290.994 0 25 0 0 25 290.994 1.5 1.3
+ 211.401 0 25 0 0 25 211.401 1.5 1.3
+ 124.822 0 25 0 0 25 124.822 1.5 1.3
+ 35.427 0 25 0 0 25 35.427 1.5 1.3
+ 37.4679 0 25 0 0 25 37.4679 1.5 1.3
+ 133.508 0 25 0 0 25 133.508 1.5 1.3
+ 139.365 0 25 0 0 25 139.365 1.5 1.3
+ 35.8683 0 25 0 0 25 35.8683 1.5 1.3
+ 183.718 0 25 0 0 25 183.718 1.5 1.3
+ 182.548 0 25 0 0 25 182.548 1.5 1.3
+ 128.262 0 25 0 0 25 128.262 1.5 1.3
+ 79.7398 0 25 0 0 25 79.7398 1.5 1.3
+ 163.304 0 25 0 0 25 163.304 1.5 1.3
+ 163.313 0 25 0 0 25 163.313 1.5 1.3
+ 174.294 0 25 0 0 25 174.294 1.5 1.3
+ 168.508 0 25 0 0 25 168.508 1.5 1.3
+ 582.149 0 25 0 0 25 582.149 1.5 1.3
+ 89.2605 0 25 0 0 25 89.2605 1.5 1.3
+ 450.149 0 25 0 0 25 450.149 1.5 1.3
+ 163.313 0 25 0 0 25 163.313 1.5 1.3
+ 410.996 0 25 0 0 25 410.996 1.5 1.3
+ 87.0486 0 25 0 0 25 87.0486 1.5 1.3
+ 85.621 0 25 0 0 25 85.621 1.5 1.3
+ 90.8267 0 25 0 0 25 90.8267 1.5 1.3
+ 553.397 0 25 0 0 25 553.397 1.5 1.3
+ 163.313 0 25 0 0 25 163.313 1.5 1.3
+ 162.032 0 25 0 0 25 162.032 1.5 1.3
+ 171.839 0 25 0 0 25 171.839 1.5 1.3
+ 3746.71 0 25 0 0 25 3746.71 1.5 1.3
+ 1262.66 0 25 0 0 25 1262.66 1.5 1.3
+ 270.972 0 25 0 0 25 270.972 1.5 1.3
+ 2277.9 0 25 0 0 25 2277.9 1.5 1.3
+ 69.4595 0 25 0 0 25 69.4595 1.5 1.3
+ 119.161 0 25 0 0 25 119.161 1.5 1.3
+ 249.061 0 25 0 0 25 249.061 1.5 1.3
+ 1429.29 0 25 0 0 25 1429.29 1.5 1.3
+ 1181.38 0 25 0 0 25 1181.38 1.5 1.3
+ 254.877 0 25 0 0 25 254.877 1.5 1.3
+ 1206.72 0 25 0 0 25 1206.72 1.5 1.3
+ 484.892 0 25 0 0 25 484.892 1.5 1.3
+ 73.255 0 25 0 0 25 73.255 1.5 1.3
+ 77.1747 0 25 0 0 25 77.1747 1.5 1.3
+ 114.543 0 25 0 0 25 114.543 1.5 1.3
+ 92.2532 0 25 0 0 25 92.2532 1.5 1.3
+ 74 0 25 0 0 25 74 1.5 1.3
+ 72.598 0 25 0 0 25 72.598 1.5 1.3
+ 110.316 0 25 0 0 25 110.316 1.5 1.3
+ 89.231 0 25 0 0 25 89.231 1.5 1.3
+ 70.8637 0 25 0 0 25 70.8637 1.5 1.3
+ 118.164 0 25 0 0 25 118.164 1.5 1.3
+ 90.1761 0 25 0 0 25 90.1761 1.5 1.3
+ 89.2687 0 25 0 0 25 89.2687 1.5 1.3
+ 1516.52 0 25 0 0 25 1516.52 1.5 1.3
+ 486.83 0 25 0 0 25 486.83 1.5 1.3
+ 266.949 0 25 0 0 25 266.949 1.5 1.3
+ 502.285 0 25 0 0 25 502.285 1.5 1.3
+ 2293.98 0 25 0 0 25 2293.98 1.5 1.3
+ 244.261 0 25 0 0 25 244.261 1.5 1.3
+ 542.259 0 25 0 0 25 542.259 1.5 1.3
+ 628.835 0 25 0 0 25 628.835 1.5 1.3
+ 129.303 0 25 0 0 25 129.303 1.5 1.3
+ 104.317 0 25 0 0 25 104.317 1.5 1.3
+ 68.2854 0 25 0 0 25 68.2854 1.5 1.3
+ 71.8253 0 25 0 0 25 71.8253 1.5 1.3
+ 116.315 0 25 0 0 25 116.315 1.5 1.3
+ 75.3654 0 25 0 0 25 75.3654 1.5 1.3
+ 122.662 0 25 0 0 25 122.662 1.5 1.3
+ 115.852 0 25 0 0 25 115.852 1.5 1.3
+ 273.243 0 25 0 0 25 273.243 1.5 1.3
+ 256.513 0 25 0 0 25 256.513 1.5 1.3
+ 253.667 0 25 0 0 25 253.667 1.5 1.3
+ 69.7802 0 25 0 0 25 69.7802 1.5 1.3
+ 251.346 0 25 0 0 25 251.346 1.5 1.3
+ 124.914 0 25 0 0 25 124.914 1.5 1.3
+ 83.1512 0 25 0 0 25 83.1512 1.5 1.3
+ 78.2075 0 25 0 0 25 78.2075 1.5 1.3
+ 96.2331 0 25 0 0 25 96.2331 1.5 1.3
+ 199.428 0 25 0 0 25 199.428 1.5 1.3
+ 550.513 0 25 0 0 25 550.513 1.5 1.3
+ 397.316 0 25 0 0 25 397.316 1.5 1.3
+ 126.823 0 25 0 0 25 126.823 1.5 1.3
+ 123.067 0 25 0 0 25 123.067 1.5 1.3
+ 89.0527 0 25 0 0 25 89.0527 1.5 1.3
+ 96.7625 0 25 0 0 25 96.7625 1.5 1.3
+ 83.319 0 25 0 0 25 83.319 1.5 1.3
+ 123.664 0 25 0 0 25 123.664 1.5 1.3
+ 98.6865 0 25 0 0 25 98.6865 1.5 1.3
+ 94.1558 0 25 0 0 25 94.1558 1.5 1.3
+ 79.9104 0 25 0 0 25 79.9104 1.5 1.3
+ 195.175 0 25 0 0 25 195.175 1.5 1.3
+ 129.021 0 25 0 0 25 129.021 1.5 1.3
+ 174.332 0 25 0 0 25 174.332 1.5 1.3
+ 632.557 0 25 0 0 25 632.557 1.5 1.3
+ 638.486 0 25 0 0 25 638.486 1.5 1.3
+ 338.111 0 25 0 0 25 338.111 1.5 1.3
+ 293.738 0 25 0 0 25 293.738 1.5 1.3
+ 208.58 0 25 0 0 25 208.58 1.5 1.3
+ 343.316 0 25 0 0 25 343.316 1.5 1.3
+ 626.123 0 25 0 0 25 626.123 1.5 1.3
+ 111.077 0 25 0 0 25 111.077 1.5 1.3
+ 147.999 0 25 0 0 25 147.999 1.5 1.3
+ 149.813 0 25 0 0 25 149.813 1.5 1.3
+ 84.7764 0 25 0 0 25 84.7764 1.5 1.3
+ 87.4814 0 25 0 0 25 87.4814 1.5 1.3
+ 99.1386 0 25 0 0 25 99.1386 1.5 1.3
+ 109.099 0 25 0 0 25 109.099 1.5 1.3
+ 107.767 0 25 0 0 25 107.767 1.5 1.3
+ 89.1064 0 25 0 0 25 89.1064 1.5 1.3
+ 79.1531 0 25 0 0 25 79.1531 1.5 1.3
+ 98.3183 0 25 0 0 25 98.3183 1.5 1.3
+ 84.5086 0 25 0 0 25 84.5086 1.5 1.3
+ 92.6554 0 25 0 0 25 92.6554 1.5 1.3
+ 114.627 0 25 0 0 25 114.627 1.5 1.3
+ 104.403 0 25 0 0 25 104.403 1.5 1.3
+ 86.5254 0 25 0 0 25 86.5254 1.5 1.3
+ 83.9324 0 25 0 0 25 83.9324 1.5 1.3
+ 86.1313 0 25 0 0 25 86.1313 1.5 1.3
+ 273.626 0 25 0 0 25 273.626 1.5 1.3
+ 124.288 0 25 0 0 25 124.288 1.5 1.3
+ 154.141 0 25 0 0 25 154.141 1.5 1.3
+ 360.843 0 25 0 0 25 360.843 1.5 1.3
+ 250.506 0 25 0 0 25 250.506 1.5 1.3
+ 179.7 0 25 0 0 25 179.7 1.5 1.3
+ 501.395 0 25 0 0 25 501.395 1.5 1.3
+ 648.873 0 25 0 0 25 648.873 1.5 1.3
+ 606.236 0 25 0 0 25 606.236 1.5 1.3
+ 631.597 0 25 0 0 25 631.597 1.5 1.3
+ 540.216 0 25 0 0 25 540.216 1.5 1.3
+ 463.649 0 25 0 0 25 463.649 1.5 1.3
+ 644.164 0 25 0 0 25 644.164 1.5 1.3
+ 541.516 0 25 0 0 25 541.516 1.5 1.3
+ 250.499 0 25 0 0 25 250.499 1.5 1.3
+ 178.418 0 25 0 0 25 178.418 1.5 1.3
+ 244.267 0 25 0 0 25 244.267 1.5 1.3
+ 157.804 0 25 0 0 25 157.804 1.5 1.3
+ 568.065 0 25 0 0 25 568.065 1.5 1.3
+ 259.065 0 25 0 0 25 259.065 1.5 1.3
+ 405.423 0 25 0 0 25 405.423 1.5 1.3
+ 231.872 0 25 0 0 25 231.872 1.5 1.3
+ 79.2518 0 25 0 0 25 79.2518 1.5 1.3
+ 78.9351 0 25 0 0 25 78.9351 1.5 1.3
+ 78.3352 0 25 0 0 25 78.3352 1.5 1.3
+ 78.6209 0 25 0 0 25 78.6209 1.5 1.3
+ 81.5811 0 25 0 0 25 81.5811 1.5 1.3
+ 86.739 0 25 0 0 25 86.739 1.5 1.3
+ 84.8003 0 25 0 0 25 84.8003 1.5 1.3
+ 397.113 0 25 0 0 25 397.113 1.5 1.3
+ 107.954 0 25 0 0 25 107.954 1.5 1.3
+ 147.58 0 25 0 0 25 147.58 1.5 1.3
+ 317.265 0 25 0 0 25 317.265 1.5 1.3
+ 379.498 0 25 0 0 25 379.498 1.5 1.3
+ 570.999 0 25 0 0 25 570.999 1.5 1.3
+ 404.713 0 25 0 0 25 404.713 1.5 1.3
+ 144.907 0 25 0 0 25 144.907 1.5 1.3
+ 594.729 0 25 0 0 25 594.729 1.5 1.3
+ 189.384 0 25 0 0 25 189.384 1.5 1.3
+ 80.7454 0 25 0 0 25 80.7454 1.5 1.3
+ 78.602 0 25 0 0 25 78.602 1.5 1.3
+ 82.015 0 25 0 0 25 82.015 1.5 1.3
+ 79.3117 0 25 0 0 25 79.3117 1.5 1.3
+ 83.6537 0 25 0 0 25 83.6537 1.5 1.3
+ 79.4896 0 25 0 0 25 79.4896 1.5 1.3
+ 78.8127 0 25 0 0 25 78.8127 1.5 1.3
+ 78.6135 0 25 0 0 25 78.6135 1.5 1.3
+ 78.543 0 25 0 0 25 78.543 1.5 1.3
+ 78.9455 0 25 0 0 25 78.9455 1.5 1.3
+ 78.3662 0 25 0 0 25 78.3662 1.5 1.3
+ 91.6505 0 25 0 0 25 91.6505 1.5 1.3
+ 282.884 0 25 0 0 25 282.884 1.5 1.3
+ 339.106 0 25 0 0 25 339.106 1.5 1.3
+ 648.954 0 25 0 0 25 648.954 1.5 1.3
+ 112.461 0 25 0 0 25 112.461 1.5 1.3
+ 81.0402 0 25 0 0 25 81.0402 1.5 1.3
+ 78.5691 0 25 0 0 25 78.5691 1.5 1.3
+ 86.4416 0 25 0 0 25 86.4416 1.5 1.3
+ 97.5819 0 25 0 0 25 97.5819 1.5 1.3
+ 128.622 0 25 0 0 25 128.622 1.5 1.3
+ 292.084 0 25 0 0 25 292.084 1.5 1.3
+ 276.004 0 25 0 0 25 276.004 1.5 1.3
+ 134.965 0 25 0 0 25 134.965 1.5 1.3
+ 385.195 0 25 0 0 25 385.195 1.5 1.3
+ 208.604 0 25 0 0 25 208.604 1.5 1.3
+ 638.898 0 25 0 0 25 638.898 1.5 1.3
+ 109.032 0 25 0 0 25 109.032 1.5 1.3
+ 182.234 0 25 0 0 25 182.234 1.5 1.3
+ 130.561 0 25 0 0 25 130.561 1.5 1.3
+ 79.8102 0 25 0 0 25 79.8102 1.5 1.3
+ 79.2092 0 25 0 0 25 79.2092 1.5 1.3
+ 78.4013 0 25 0 0 25 78.4013 1.5 1.3
+ 87.8687 0 25 0 0 25 87.8687 1.5 1.3
+ 82.1846 0 25 0 0 25 82.1846 1.5 1.3
+ 86.0524 0 25 0 0 25 86.0524 1.5 1.3
+ 98.336 0 25 0 0 25 98.336 1.5 1.3
+ 122.478 0 25 0 0 25 122.478 1.5 1.3
+ 90.9663 0 25 0 0 25 90.9663 1.5 1.3
+ 134.428 0 25 0 0 25 134.428 1.5 1.3
+ 99.8832 0 25 0 0 25 99.8832 1.5 1.3
+ 392.324 0 25 0 0 25 392.324 1.5 1.3
+ 221.051 0 25 0 0 25 221.051 1.5 1.3
+ 168.895 0 25 0 0 25 168.895 1.5 1.3
+ 208.527 0 25 0 0 25 208.527 1.5 1.3
+ 354.145 0 25 0 0 25 354.145 1.5 1.3
+ 111.193 0 25 0 0 25 111.193 1.5 1.3
+ 180.513 0 25 0 0 25 180.513 1.5 1.3
+ 450.444 0 25 0 0 25 450.444 1.5 1.3
+ 252.2 0 25 0 0 25 252.2 1.5 1.3
+ 426.78 0 25 0 0 25 426.78 1.5 1.3
+ 175.826 0 25 0 0 25 175.826 1.5 1.3
+ 244.16 0 25 0 0 25 244.16 1.5 1.3
+ 284.814 0 25 0 0 25 284.814 1.5 1.3
+ 489.384 0 25 0 0 25 489.384 1.5 1.3
+ 408.816 0 25 0 0 25 408.816 1.5 1.3
+ 593.889 0 25 0 0 25 593.889 1.5 1.3
+ 603.483 0 25 0 0 25 603.483 1.5 1.3
+ 440.674 0 25 0 0 25 440.674 1.5 1.3
+ 99.4076 0 25 0 0 25 99.4076 1.5 1.3
+ 138.443 0 25 0 0 25 138.443 1.5 1.3
+ 140.043 0 25 0 0 25 140.043 1.5 1.3
+ 119.233 0 25 0 0 25 119.233 1.5 1.3
+ 152.53 0 25 0 0 25 152.53 1.5 1.3
+ 78.1388 0 25 0 0 25 78.1388 1.5 1.3
+ 78.7871 0 25 0 0 25 78.7871 1.5 1.3
+ 79.0572 0 25 0 0 25 79.0572 1.5 1.3
+ 82.9334 0 25 0 0 25 82.9334 1.5 1.3
+ 88.8425 0 25 0 0 25 88.8425 1.5 1.3
+ 82.0077 0 25 0 0 25 82.0077 1.5 1.3
+ 78.1315 0 25 0 0 25 78.1315 1.5 1.3
+ 81.4482 0 25 0 0 25 81.4482 1.5 1.3
+ 78.6768 0 25 0 0 25 78.6768 1.5 1.3
+ 103.035 0 25 0 0 25 103.035 1.5 1.3
+ 97.6648 0 25 0 0 25 97.6648 1.5 1.3
+ 592.929 0 25 0 0 25 592.929 1.5 1.3
+ 205.858 0 25 0 0 25 205.858 1.5 1.3
+ 580.289 0 25 0 0 25 580.289 1.5 1.3
+ 141.413 0 25 0 0 25 141.413 1.5 1.3
+ 215.712 0 25 0 0 25 215.712 1.5 1.3
+ 367.019 0 25 0 0 25 367.019 1.5 1.3
+ 403.319 0 25 0 0 25 403.319 1.5 1.3
+ 608.888 0 25 0 0 25 608.888 1.5 1.3
+ 525.023 0 25 0 0 25 525.023 1.5 1.3
+ 629.783 0 25 0 0 25 629.783 1.5 1.3
+ 475.448 0 25 0 0 25 475.448 1.5 1.3
+ 79.1084 0 25 0 0 25 79.1084 1.5 1.3
+ 88.5131 0 25 0 0 25 88.5131 1.5 1.3
+ 94.1156 0 25 0 0 25 94.1156 1.5 1.3
+ 80.902 0 25 0 0 25 80.902 1.5 1.3
+ 82.2351 0 25 0 0 25 82.2351 1.5 1.3
+ 85.5289 0 25 0 0 25 85.5289 1.5 1.3
+ 568.789 0 25 0 0 25 568.789 1.5 1.3
+ 561.858 0 25 0 0 25 561.858 1.5 1.3
+ 485.778 0 25 0 0 25 485.778 1.5 1.3
+ 609.176 0 25 0 0 25 609.176 1.5 1.3
+ 98.2323 0 25 0 0 25 98.2323 1.5 1.3
+ 648.564 0 25 0 0 25 648.564 1.5 1.3
+ 548.584 0 25 0 0 25 548.584 1.5 1.3
+ 643.934 0 25 0 0 25 643.934 1.5 1.3
+ 520.051 0 25 0 0 25 520.051 1.5 1.3
+ 646.751 0 25 0 0 25 646.751 1.5 1.3
+ 84.1431 0 25 0 0 25 84.1431 1.5 1.3
+ 350.869 0 25 0 0 25 350.869 1.5 1.3
+ 647.495 0 25 0 0 25 647.495 1.5 1.3
+ 40.8931 0 25 0 0 25 40.8931 1.5 1.3
+ 40.8528 0 25 0 0 25 40.8528 1.5 1.3
+ 40.0649 0 25 0 0 25 40.0649 1.5 1.3
+ 40.0169 0 25 0 0 25 40.0169 1.5 1.3
+ 35.5191 0 25 0 0 25 35.5191 1.5 1.3
+ 35.4574 0 25 0 0 25 35.4574 1.5 1.3
+ 48.0546 0 25 0 0 25 48.0546 1.5 1.3
+ 46.1907 0 25 0 0 25 46.1907 1.5 1.3
+ 35.9351 0 25 0 0 25 35.9351 1.5 1.3
+ 35.7883 0 25 0 0 25 35.7883 1.5 1.3
+ 40.497 0 25 0 0 25 40.497 1.5 1.3
+ 35.6281 0 25 0 0 25 35.6281 1.5 1.3
+ 47.3188 0 25 0 0 25 47.3188 1.5 1.3
+ 48.195 0 25 0 0 25 48.195 1.5 1.3
+ 35.6539 0 25 0 0 25 35.6539 1.5 1.3
+ 40.497 0 25 0 0 25 40.497 1.5 1.3
+ 40.3636 0 25 0 0 25 40.3636 1.5 1.3
+ 41.336 0 25 0 0 25 41.336 1.5 1.3
+ 33.6995 0 25 0 0 25 33.6995 1.5 1.3
+ 34.0629 0 25 0 0 25 34.0629 1.5 1.3
+ 37.8309 0 25 0 0 25 37.8309 1.5 1.3
+ 33.5701 0 25 0 0 25 33.5701 1.5 1.3
+ 54.6629 0 25 0 0 25 54.6629 1.5 1.3
+ 52.3481 0 25 0 0 25 52.3481 1.5 1.3
+ 43.5595 0 25 0 0 25 43.5595 1.5 1.3
+ 51.8287 0 25 0 0 25 51.8287 1.5 1.3
+ 47.1155 0 25 0 0 25 47.1155 1.5 1.3
+ 37.8911 0 25 0 0 25 37.8911 1.5 1.3
+ 33.7955 0 25 0 0 25 33.7955 1.5 1.3
+ 33.8913 0 25 0 0 25 33.8913 1.5 1.3
+ 43.7304 0 25 0 0 25 43.7304 1.5 1.3
+ 37.8879 0 25 0 0 25 37.8879 1.5 1.3
+ 33.8632 0 25 0 0 25 33.8632 1.5 1.3
+ 37.486 0 25 0 0 25 37.486 1.5 1.3
+ 35.7661 0 25 0 0 25 35.7661 1.5 1.3
+ 51.3773 0 25 0 0 25 51.3773 1.5 1.3
+ 51.5251 0 25 0 0 25 51.5251 1.5 1.3
+ 43.4359 0 25 0 0 25 43.4359 1.5 1.3
+ 47.7326 0 25 0 0 25 47.7326 1.5 1.3
+ 53.7708 0 25 0 0 25 53.7708 1.5 1.3
+ 54.6428 0 25 0 0 25 54.6428 1.5 1.3
+ 43.9394 0 25 0 0 25 43.9394 1.5 1.3
+ 38.1263 0 25 0 0 25 38.1263 1.5 1.3
+ 33.7321 0 25 0 0 25 33.7321 1.5 1.3
+ 35.751 0 25 0 0 25 35.751 1.5 1.3
+ 37.4436 0 25 0 0 25 37.4436 1.5 1.3
+ 34.5501 0 25 0 0 25 34.5501 1.5 1.3
+ 41.9354 0 25 0 0 25 41.9354 1.5 1.3
+ 47.8669 0 25 0 0 25 47.8669 1.5 1.3
+ 43.776 0 25 0 0 25 43.776 1.5 1.3
+ 51.4618 0 25 0 0 25 51.4618 1.5 1.3
+ 34.8953 0 25 0 0 25 34.8953 1.5 1.3
+ 37.6572 0 25 0 0 25 37.6572 1.5 1.3
+ 50.4879 0 25 0 0 25 50.4879 1.5 1.3
+ 43.8174 0 25 0 0 25 43.8174 1.5 1.3
+ 54.9273 0 25 0 0 25 54.9273 1.5 1.3
+ 43.6302 0 25 0 0 25 43.6302 1.5 1.3
+ 37.6269 0 25 0 0 25 37.6269 1.5 1.3
+ 33.9822 0 25 0 0 25 33.9822 1.5 1.3
+ 37.8663 0 25 0 0 25 37.8663 1.5 1.3
+ 46.3694 0 25 0 0 25 46.3694 1.5 1.3
+ 44.879 0 25 0 0 25 44.879 1.5 1.3
+
+
+SolAtTriangles
+2954
+0
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+End
@@ -0,0 +1,3729 @@
+MeshVersionFormatted
+ 2
+
+Dimension
+ 3
+
+SolAtVertices
+3717
+1 3
+ 10000 0 10000 0 0 10000
+ 10000 0 4759.30230950513 0 0 1
+ 10000 0 991.418527725123 0 0 1
+ 8160.56786409962 700.74545248995 2864.56574203776 0 0 0.999999999942651
+ 10000 0 547.634505180893 0 0 1
+ 10000 0 1881.96507832335 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 404.363137923147 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1249.67121087296 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 6847.52078961724 482.140750338278 3238.44444504931 0 0 0.999999999999956
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 503.136625064471 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1044.14583936746 0 0 1
+ 10000 0 299.405913833073 0 0 1
+ 10000 0 1883.23565304701 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 863.576781071065 0 0 1
+ 10000 0 10000 0 0 10000
+ 10000 0 1395.28674581907 0 0 1
+ 7490.2197823006 1333.33349550897 1821.2124382595 0 0 0.999999999967936
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 234.276717720327 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1263.01668977151 0 0 1
+ 9999.99999999999 0 785.398599672805 0 0 1
+ 10000 0 3107.03067836546 0 0 1
+ 10000 0 244.185474653784 0 0 1
+ 10000 0 4264.09088581599 0 0 1
+ 9999.99999999999 0 1399.37184487782 0 0 1
+ 10000 0 993.872105843876 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 326.730102337417 0 0 1
+ 10000 0 3428.54917965818 0 0 1
+ 9999.99999999995 0 329.266464264982 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9604.20063327791 -350.171806059537 517.810012653411 0 0 0.999999999694745
+ 10000 0 6650.67579140087 0 0 1
+ 10000 0 1552.43319689508 0 0 1
+ 9999.99999999999 0 285.711337982941 0 0 1
+ 9999.99999999999 0 2757.3659708342 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9477.43211805249 0.669125957576995 444.165974515631 0 0 0.999999997092011
+ 10000 0 100 0 0 1
+ 10000 0 188.614138265925 0 0 1
+ 10000 0 5625.86559602093 0 0 1
+ 9999.99999999999 0 911.860937056634 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 201.942894289419 0 0 0.999999999999999
+ 10000 0 178.591025891933 0 0 1
+ 10000 0 1413.11019064643 0 0 1
+ 10000 0 1064.43904296148 0 0 1
+ 9999.99999999995 0 1202.24610937392 0 0 1
+ 9999.99999999999 0 1008.42712599029 0 0 1
+ 9999.99999999999 0 769.231910011287 0 0 1
+ 9999.99999999999 0 195.032296150646 0 0 1
+ 9999.99999999999 0 1726.04366322749 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 354.033480446105 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 975.470580009765 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 171.753017861798 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 235.230312886101 0 0 1
+ 10000 0 1039.31314920196 0 0 1
+ 10000 0 817.11728200071 0 0 1
+ 9999.99999999999 0 1151.52226870122 0 0 1.3023986520174
+ 9999.99999999995 0 1157.51546902615 0 0 1
+ 9999.99999999995 0 1948.13834680749 0 0 1
+ 10000 0 1104.40077662694 0 0 1
+ 8366.05995283713 184.823150796014 1410.82825257448 0 0 0.999999999933641
+ 10000 0 1146.29686942478 0 0 1
+ 8125.93021178325 -254.505925674262 1816.8221513419 0 0 0.999999999944433
+ 9999.99999999999 0 341.677823622299 0 0 1
+ 9999.99999999999 0 1169.45794962598 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 442.333679737443 0 0 1
+ 9999.99999999995 0 1079.43853137328 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 461.552718327017 0 0 1
+ 9999.99999999999 0 350.660457711582 0 0 1
+ 9999.99999999995 0 396.047219486626 0 0 1
+ 10000 0 1251.16670805785 0 0 1
+ 10000 0 371.378091425663 0 0 1
+ 10000 0 1923.6258185693 0 0 1
+ 10000 0 1842.63366477129 0 0 1
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 424.396317470534 0 0 1
+ 10000 0 1013.79432526568 0 0 1
+ 10000 0 4152.2683255006 0 0 1
+ 10000 0 253.20831556924 0 0 1
+ 10000 0 790.777759811481 0 0 1
+ 9999.99999999998 0 711.605528851396 0 0 1
+ 8282.45643171741 -1415.10743904151 3144.21527089226 0 0 0.999999999999947
+ 10000 0 7157.50547299365 0 0 1
+ 10000 0 434.313718939982 0 0 1
+ 10000 0 100 0 0 1
+ 9474.57343342268 -142.915078568694 1486.38572262575 0 0 0.999999999999888
+ 10000 0 100 0 0 1
+ 10000 0 170.008845748506 0 0 1
+ 10000 0 169.33312615745 0 0 1
+ 10000 0 183.656965609736 0 0 1
+ 8334.39649536829 -1011.73496784377 1681.44595652743 0 0 0.999999999999823
+ 10000 0 1771.47180377108 0 0 1
+ 10000 0 2268.51806763078 0 0 1
+ 10000 0 330.168498541159 0 0 1
+ 10000 0 2741.02867327751 0 0 1
+ 9999.99999999999 0 1341.40271767688 0 0 1
+ 9999.99999999995 0 255.605925093608 0 0 1
+ 9999.99999999999 0 2379.63480321701 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 176.407235181584 0 0 1
+ 10000 0 5691.90812118314 0 0 1
+ 10000 0 198.951512036034 0 0 1
+ 7319.9808121493 -300.128542547095 1552.66682544143 0 0 1.00000000000113
+ 10000 0 100 0 0 1
+ 10000 0 203.083792846958 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 237.310636171175 0 0 1
+ 9999.99999999998 0 574.025602011033 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 753.295938168953 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2167.15208105708 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 279.520969250396 0 0 1
+ 10000 0 666.06092532532 0 0 1
+ 10000 0 2919.18280869493 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 7860.48962235398 -1294.05594586 1564.12935071462 0 0 0.999999999999762
+ 7711.32293914999 249.763418794193 3818.46113453067 0 0 1.30239865139197
+ 9999.99999999999 0 246.709840823089 0 0 1
+ 7110.61535326991 -61.6316822628679 2594.18838894948 0 0 1.00000000002194
+ 6298.85815986746 -794.74759804345 5370.23034415152 0 0 0.999999999873411
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 193.438763301923 0 0 1
+ 9728.69633074777 -59.9771624876275 1153.90365056267 0 0 0.999999999999939
+ 9999.99999999999 0 873.963536851893 0 0 1
+ 10000 0 667.06161393272 0 0 1
+ 9999.99999999997 0 1506.16640464326 0 0 1
+ 10000 0 1240.26869437819 0 0 1
+ 10000 0 931.388632394243 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 327.872794869395 0 0 1
+ 10000 0 1237.74665824374 0 0 1
+ 8750.36378791016 -211.928400048139 1191.64284746021 0 0 0.999999999907136
+ 9549.98736747277 -100.3361919175 1272.52487352597 0 0 0.999999999895032
+ 10000 0 1900.85732810938 0 0 1
+ 10000 0 247.262861990742 0 0 1
+ 9999.99999999999 0 1811.69145703516 0 0 1
+ 9999.99999999999 0 1409.07723000755 0 0 1
+ 7913.66201944075 153.164551496338 2307.60679680973 0 0 1.00000000000193
+ 8718.57276194055 -62.1343864396846 5127.42108780411 0 0 0.999999999995078
+ 9999.99999999999 0 311.68722670803 0 0 1
+ 10000 0 100 0 0 1
+ 6162.66834362529 -237.790703427887 3297.36141215323 0 0 1.00000000000108
+ 10000 0 5530.18673942072 0 0 3.92118419762769
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1128.51310942858 0 0 1
+ 9999.99999999999 0 741.418051290898 0 0 1
+ 10000 0 2278.57010116704 0 0 1
+ 9999.99999999998 0 345.061608322694 0 0 1
+ 9999.99999999999 0 341.472045684778 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 798.69566776199 0 0 1
+ 10000 0 468.65796982658 0 0 1
+ 10000 0 456.80504591333 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 1413.9879307641 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 697.87278109699 0 0 1
+ 10000 0 473.123740955792 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 327.588415873353 0 0 1
+ 9999.99999999999 0 749.258734241484 0 0 1
+ 10000 0 744.011293813719 0 0 1
+ 10000 0 777.942437985895 0 0 1
+ 9999.99999999999 0 889.58096256976 0 0 1
+ 10000 0 1254.07226891877 0 0 1
+ 10000 0 1329.28110368754 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 8507.33774212888 280.005654461848 1590.03584114074 0 0 0.999999999999674
+ 9999.99999999998 0 209.309749551482 0 0 1
+ 8084.99576119735 435.327025677465 7932.69737831317 0 0 0.99999999996409
+ 10000 0 441.396679968093 0 0 1
+ 9999.99999999998 0 898.488054839737 0 0 1
+ 9999.99999999999 0 2330.10874657365 0 0 1
+ 9999.99999999999 0 139.208372546893 0 0 1
+ 9999.99999999996 0 769.272824441482 0 0 1
+ 7644.18629879549 -557.629672323629 2965.06254871689 0 0 1.00000000000577
+ 10000 0 193.903235413293 0 0 1
+ 10000 0 3918.17441310128 0 0 1
+ 10000 0 156.726950032504 0 0 1
+ 9999.99999999999 0 293.133607020797 0 0 1
+ 8733.46253396423 -1356.53710426311 1857.77097670525 0 0 0.999999999991682
+ 6633.23316412128 1266.61219901392 3326.82183144718 0 0 0.999999999975798
+ 9999.99999999999 0 681.699874768604 0 0 1
+ 9999.99999999999 0 644.849770164888 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1156.06383128414 0 0 1
+ 9999.99999999999 0 946.581534054988 0 0 1
+ 6970.52681403434 1061.35651470128 5216.82077219775 0 0 0.999999997250181
+ 10000 0 100 0 0 1
+ 8973.99245082586 16.9354955729981 1319.60653163293 0 0 0.999999999999871
+ 8258.08439174282 -253.077543549238 520.49930218948 0 0 0.999999999898517
+ 10000 0 1230.75391722239 0 0 1
+ 10000 0 165.779720411674 0 0 1
+ 8339.14480203067 353.68891881047 2027.80825512716 0 0 0.999999999996502
+ 9999.99999999999 0 598.276132164534 0 0 1
+ 9999.99999999995 0 396.140598881638 0 0 1
+ 9999.99999999996 0 128.76627817368 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 747.546714158093 0 0 1
+ 9999.99999999999 0 446.57999823394 0 0 1
+ 9999.99999999999 0 1773.55998814853 0 0 1
+ 9999.99999999995 0 278.034358979736 0 0 1
+ 9999.99999999999 0 303.351632012805 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 188.291147520329 0 0 1
+ 9999.99999999996 0 1110.06430403528 0 0 1
+ 9999.99999999999 0 1020.72443645199 0 0 1
+ 9999.99999999995 0 187.510798262315 0 0 1
+ 10000 0 195.23518736555 0 0 1
+ 9999.99999999999 0 164.512883721126 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 7469.53648904506 94.8136080979675 3771.01018736509 0 0 1.00000000030564
+ 10000 0 188.398493174286 0 0 1
+ 10000 0 172.849265315282 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 6273.67605698788 0 0 1
+ 10000 0 1431.38499789056 0 0 1
+ 10000 0 994.556003483983 0 0 1
+ 10000 0 100 0 0 1
+ 8951.57490788291 182.755947479271 4487.11431768219 0 0 1.00000000008892
+ 10000 0 306.006026084507 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 842.641296912371 0 0 1
+ 7793.84193846011 -772.531626948317 2966.41457265325 0 0 0.999999999999524
+ 9999.99999999999 0 575.389774304733 0 0 1
+ 9999.99999999998 0 1229.91699112616 0 0 1
+ 9999.99999999999 0 283.318936484369 0 0 1
+ 6919.2629257142 -169.534403149484 2577.82815372773 0 0 1.00000000000191
+ 9999.99999999999 0 183.707016374517 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 8230.54276995616 155.688468908137 5543.95375703436 0 0 1.00000000000089
+ 10000 0 1780.11455108614 0 0 1.3023986520174
+ 10000 0 256.014349038982 0 0 1
+ 9999.99999999995 0 574.38327390944 0 0 1
+ 9999.99999999997 0 673.920193652877 0 0 1
+ 9948.17439771234 -212.058226073545 5456.83850059679 0 0 1.76598492290203
+ 10000 0 3042.41364604967 0 0 1
+ 10000 0 3235.49293691715 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9494.2448110576 -169.891514370894 3525.03216940247 0 0 0.999999999997267
+ 9631.44898105505 -394.945267452781 2030.46772453159 0 0 0.99999999979709
+ 9996.15814345801 47.1349576636864 772.006299109183 0 0 0.999999999770719
+ 9999.99999999999 0 785.294432592513 0 0 1
+ 10000 0 104.877465897648 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 607.849109929851 0 0 1
+ 10000 0 2793.49385817623 0 0 1
+ 7663.24339458616 1502.40463663231 6751.36934275399 0 0 3.92118419762978
+ 8735.97002209471 2118.03662973882 3267.46476698857 0 0 3.92118419762802
+ 9999.99999999999 0 578.992710477746 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 154.928087746127 0 0 1
+ 9999.99999999995 0 2171.24576337159 0 0 1
+ 9999.99999999996 0 818.722046004357 0 0 1
+ 8985.55174995327 27.2205774981758 1536.31491317127 0 0 1.00000000000007
+ 9999.99999999996 0 745.934661493217 0 0 1
+ 9999.99999999998 0 560.45258509745 0 0 1
+ 10000 0 1939.26153765 0 0 3.92118419762768
+ 10000 0 672.023947606932 0 0 1
+ 9999.99999999999 0 379.340586835235 0 0 1
+ 9999.99999999999 0 2166.50750058092 0 0 1
+ 9999.99999999995 0 896.166276926731 0 0 1
+ 10000 0 112.990546112002 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 343.975582506973 0 0 1
+ 10000 0 1268.86318893335 0 0 1
+ 10000 0 1714.35352265109 0 0 1
+ 9999.99999999996 0 679.495996647274 0 0 1
+ 10000 0 2327.813844678 0 0 1
+ 9999.99999999999 0 440.60426363391 0 0 1
+ 9999.99999999999 0 375.625059216808 0 0 1
+ 9999.99999999998 0 907.232622556096 0 0 1
+ 9999.99999999999 0 3168.78832251853 0 0 1
+ 9999.99999999999 0 231.813923465151 0 0 1
+ 9999.99999999998 0 843.462178626895 0 0 1
+ 9999.99999999999 0 654.131372986277 0 0 1
+ 8075.14769395165 -91.9251520685178 2973.66327576001 0 0 0.999999999890799
+ 9999.99999999996 0 362.745727892476 0 0 1
+ 10000 0 100 0 0 1
+ 7446.51762711865 -634.789463107736 4056.07571326325 0 0 0.999999999853702
+ 10000 0 916.926519557202 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1273.36894596139 0 0 1
+ 10000 0 446.113113705887 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1581.22410117305 0 0 3.92118419762768
+ 9999.99999999995 0 729.605979012598 0 0 1
+ 10000 0 1194.98708549438 0 0 1
+ 10000 0 102.480480771057 0 0 1
+ 10000 0 1617.60765748561 0 0 1
+ 9508.17865703126 -200.503756963824 2066.21133995959 0 0 0.999999999999644
+ 10000 0 100 0 0 1
+ 10000 0 2003.54524521807 0 0 1
+ 9999.99999999998 0 1296.06130001932 0 0 1
+ 10000 0 959.404860532074 0 0 1
+ 9999.99999999996 0 252.939525741284 0 0 1
+ 9999.99999999999 0 267.352725891745 0 0 1
+ 9999.99999999999 0 802.633212318992 0 0 1
+ 10000 0 896.649153198218 0 0 1
+ 7933.66092839763 46.8432401477239 4155.99044775086 0 0 1.00000000020307
+ 9999.99999999999 0 809.505822077786 0 0 1
+ 7847.50793422532 -310.834020548174 1263.14418824222 0 0 0.999999999920863
+ 9999.99999999994 0 1075.97597037171 0 0 1
+ 9999.99999999998 0 368.434918226196 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 706.899544367308 0 0 1
+ 10000 0 570.772700627997 0 0 1
+ 10000 0 883.467952222081 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 224.764883364993 0 0 1
+ 9999.99999999995 0 1270.22570956078 0 0 1
+ 10000 0 973.63722058388 0 0 1
+ 8194.65751687287 -620.730928302273 2650.52385421029 0 0 0.999999999893169
+ 9999.99999999996 0 834.579397505334 0 0 1
+ 10000 0 1341.45309056717 0 0 1
+ 9387.40437161693 88.7203706842505 5311.7936067832 0 0 3.9211841976241
+ 10000 0 6462.78930583501 0 0 1
+ 9999.99999999997 0 771.129102001982 0 0 1
+ 9551.03697563398 -108.804372244932 988.534133386857 0 0 1.00000000000064
+ 9999.99999999996 0 498.357496741311 0 0 1
+ 10000 0 679.069325115236 0 0 1
+ 7005.79593920516 589.923819943328 4005.15246920381 0 0 1.00000000000045
+ 9999.99999999999 0 1605.66285118857 0 0 1
+ 9999.99999999999 0 521.981517670662 0 0 1
+ 10000 0 6553.6507654247 0 0 1
+ 10000 0 353.462597186109 0 0 1
+ 8949.85355807378 348.894722491065 2277.25212899862 0 0 1.0000000000004
+ 9999.99999999999 0 893.322083558243 0 0 1
+ 10000 0 2992.47791890112 0 0 1
+ 9999.99999999999 0 1305.67459801718 0 0 1
+ 10000 0 123.379977882127 0 0 1
+ 10000 0 806.283162580592 0 0 1
+ 9999.99999999999 0 459.672713227528 0 0 1
+ 10000 0 1242.94881776712 0 0 1
+ 10000 0 934.211199604564 0 0 1
+ 10000 0 447.637699134833 0 0 1
+ 10000 0 2690.7672164526 0 0 1
+ 10000 0 583.071398169952 0 0 1
+ 9999.99999999996 0 370.081869836073 0 0 1
+ 9999.99999999994 0 2068.255105195 0 0 1
+ 9847.20820260319 231.160052134931 1340.69738264032 0 0 0.999999999933777
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 326.781916453973 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 965.912587452882 0 0 1
+ 9999.99999999999 0 295.517149861905 0 0 1
+ 9999.99999999995 0 626.629604716673 0 0 1
+ 9741.27561789171 199.961786322756 4705.51326819382 0 0 0.999999999999089
+ 10000 0 690.39132941404 0 0 1
+ 5972.83908318091 -1046.42867441339 3471.12858822951 0 0 0.999999999999839
+ 10000 0 136.992802443277 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9732.82458342323 -4.66608461822671 633.566200138985 0 0 0.999999999997593
+ 9999.99999999995 0 161.269272962795 0 0 1
+ 10000 0 2687.3875408558 0 0 1
+ 10000 0 5686.67770285649 0 0 1
+ 10000 0 121.794491207423 0 0 1
+ 9999.99999999996 0 172.622122420462 0 0 1
+ 10000 0 184.867575320873 0 0 1
+ 10000 0 866.189899201359 0 0 1
+ 9999.99999999998 0 341.111408642555 0 0 1
+ 10000 0 306.337030834378 0 0 1
+ 7303.86436111212 -20.5670266527039 3299.42066923562 0 0 1.0000000000014
+ 9999.99999999997 0 638.986316158959 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 5754.64873077686 0 0 3.92118419762768
+ 10000 0 1254.22119961247 0 0 1
+ 10000 0 331.362731615126 0 0 1
+ 8919.31314663664 9.97107447684616 2826.13659584252 0 0 1.00000000000822
+ 10000 0 644.457389611193 0 0 1
+ 10000 0 1738.46048467836 0 0 1
+ 9049.93644286709 -590.146031581891 1121.06232350799 0 0 0.999999999373231
+ 10000 0 100 0 0 1
+ 10000 0 718.150506353053 0 0 1
+ 9999.99999999999 0 563.901165947302 0 0 1
+ 8056.41005115566 301.325051627699 1630.11517425442 0 0 0.999999997731494
+ 9421.28218226121 -642.103769967019 2356.91614853035 0 0 0.999999999639208
+ 9999.99999999996 0 1246.23613197759 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 6455.82540591699 242.88099560579 3493.51683094109 0 0 0.999999999998473
+ 9999.99999999999 0 333.978402606922 0 0 1
+ 10000 0 100 0 0 1
+ 7428.60696861989 -1166.08789311651 8035.80505557286 0 0 0.99999999917968
+ 9999.99999999999 0 750.242331193801 0 0 1
+ 9999.99999999999 0 331.082860587786 0 0 1
+ 9999.99999999999 0 720.001038728542 0 0 1
+ 10000 0 521.859560744431 0 0 1
+ 8355.34732258489 -629.497907725226 1558.46808156388 0 0 0.999999999943526
+ 9999.99999999999 0 3688.64442686603 0 0 1
+ 9999.99999999996 0 2347.00081157209 0 0 1
+ 10000 0 100 0 0 1
+ 7749.52181254934 -1317.482401819 1940.36448190621 0 0 0.999999999999475
+ 9999.99999999999 0 817.35008311742 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9617.72511739637 -57.6112247460339 928.377668664152 0 0 1.00000000000178
+ 9999.99999999996 0 1612.12046058143 0 0 1
+ 9999.99999999999 0 348.82119666314 0 0 1
+ 10000 0 147.764275929649 0 0 1
+ 9999.99999999995 0 737.286344845546 0 0 1
+ 9999.99999999999 0 1378.98507553568 0 0 1
+ 9999.99999999997 0 431.548113735317 0 0 1
+ 9999.99999999999 0 1446.62064747484 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 4115.92080655652 0 0 1
+ 10000 0 1371.15678122942 0 0 1
+ 10000 0 316.210461407005 0 0 1
+ 8587.31473224933 98.1235731691335 3255.25934117337 0 0 0.999999999981999
+ 10000 0 711.867213132659 0 0 1
+ 10000 0 291.024225105341 0 0 1
+ 10000 0 1014.86171971929 0 0 1
+ 9999.99999999999 0 1378.52872439524 0 0 1
+ 10000 0 1275.18744537085 0 0 1
+ 10000 0 1244.53560925694 0 0 1
+ 10000 0 176.955961810512 0 0 1
+ 9999.99999999996 0 309.848069284903 0 0 1
+ 9999.99999999999 0 485.017909829568 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2031.24035239358 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1947.28614571293 0 0 1
+ 7885.10283557532 -581.822087903535 3179.28774932776 0 0 1.00000000000012
+ 10000 0 1232.9612136211 0 0 1
+ 9869.27802172217 216.515647151431 3322.00733567955 0 0 0.999999999999686
+ 9104.73926355928 -171.695027538326 1613.42445042153 0 0 0.999999999999787
+ 10000 0 270.42253733901 0 0 1
+ 10000 0 611.117179170195 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 511.656591557612 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 443.423627774806 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 463.048954427954 0 0 1
+ 10000 0 100 0 0 1
+ 9371.01253885816 -84.2647229088405 1424.98272625313 0 0 1.30239865199578
+ 9999.99999999999 0 1092.16140293241 0 0 1
+ 9999.99999999998 0 260.397516744153 0 0 1
+ 9343.6333087206 -224.032996754787 2629.13404349154 0 0 0.999999999998174
+ 9999.99999999993 0 490.900603951888 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1376.35115206548 0 0 1
+ 7460.69075089806 793.913838109346 2793.07060417056 0 0 0.999999999999469
+ 9999.99999999999 0 5929.10076847845 0 0 1
+ 10000 0 200.06458618431 0 0 1
+ 9999.99999999999 0 135.019568402419 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 282.717902228848 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999997 0 339.725624541395 0 0 1
+ 9999.99999999995 0 1899.63619567399 0 0 1
+ 9999.99999999999 0 405.372991796866 0 0 1
+ 9999.99999999995 0 287.346325617245 0 0 1
+ 9999.99999999996 0 893.8533200372 0 0 1
+ 9999.99999999995 0 260.649681172657 0 0 1
+ 9999.99999999995 0 1068.10639224481 0 0 1
+ 8582.05386678861 757.829367495357 1538.04871188137 0 0 1.00000000000075
+ 9999.99999999996 0 710.074906068706 0 0 1
+ 8873.19078033005 47.1191975828205 2875.33941823745 0 0 0.999999999999742
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 176.383108064652 0 0 1
+ 9999.99999999996 0 311.222928753345 0 0 1
+ 10000 0 2719.34928717366 0 0 1
+ 9999.99999999999 0 571.656338613011 0 0 1
+ 10000 0 1631.57109874162 0 0 1
+ 9999.99999999994 0 308.923522776428 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9936.95063973522 43.2566657022817 1444.88321223351 0 0 0.999999999995599
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 423.751578713618 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9542.91219872262 432.837155149141 2274.67115411436 0 0 0.999999999866809
+ 8223.83743853593 -493.249179167767 1421.09941368611 0 0 0.999999999847505
+ 9999.99999999999 0 267.152514421831 0 0 1
+ 10000 0 683.517990711051 0 0 1
+ 9999.99999999998 0 964.143698621661 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 1141.53845478953 0 0 1
+ 7625.82827097141 641.205614311351 2009.23635994616 0 0 0.999999999999193
+ 9999.99999999999 0 232.763866164489 0 0 1
+ 8028.61890636528 380.454244523717 2649.41777634642 0 0 1.00000000000402
+ 10000 0 6556.0269204665 0 0 3.92118419762768
+ 10000 0 977.615164455894 0 0 1
+ 10000 0 870.475071877035 0 0 1
+ 10000 0 354.77224123501 0 0 1
+ 10000 0 10000 0 0 10000
+ 9999.99999999998 0 641.834030829996 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 583.546422161858 0 0 1
+ 9999.99999999999 0 1744.3064537593 0 0 1
+ 9999.99999999999 0 1112.13714424504 0 0 1
+ 10000 0 123.863945478459 0 0 1
+ 9999.99999999999 0 238.729918391933 0 0 1
+ 9056.75923368073 -32.9620410661721 1502.23853367143 0 0 1.00000000000154
+ 9999.99999999996 0 246.480556301469 0 0 1
+ 9999.99999999998 0 1043.31634288605 0 0 1
+ 9328.17672616385 -467.176103366513 784.836407618937 0 0 0.999999998449542
+ 9999.99999999999 0 213.698168831335 0 0 1
+ 10000 0 588.555053736615 0 0 1
+ 9999.99999999999 0 926.095252133596 0 0 1
+ 9200.17845040372 200.914857642122 5465.10489828826 0 0 0.999999999539065
+ 9999.99999999999 0 284.273378148571 0 0 1
+ 8819.3132391641 250.509071966386 3067.75934631415 0 0 0.999999999999576
+ 10000 0 4333.07628035864 0 0 1
+ 10000 0 100 0 0 1
+ 8939.35504200191 2910.93075611167 6636.29545320659 0 0 0.999999999987878
+ 6942.72814169468 -461.267760783227 4517.76569612726 0 0 1.0000000000007
+ 10000 0 2227.02735690081 0 0 1
+ 9325.94121462557 130.621703064495 297.460059288265 0 0 1.00000000000036
+ 10000 0 1445.32100789217 0 0 1
+ 9999.99999999995 0 536.547151867743 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1163.54040499695 0 0 1
+ 8048.71726332564 -119.177018444089 2734.25487525455 0 0 0.999999999871416
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 629.92918361721 0 0 1
+ 9999.99999999999 0 144.601590447986 0 0 1
+ 10000 0 320.131009819689 0 0 1
+ 9999.99999999996 0 163.893907313356 0 0 1
+ 9999.99999999999 0 1081.13809709601 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 1100.67910357731 0 0 1
+ 10000 0 1576.4539915511 0 0 1
+ 10000 0 313.438656292457 0 0 1
+ 9999.99999999998 0 423.860670968605 0 0 1
+ 10000 0 100 0 0 1
+ 10039.4124899432 -418.862546837838 511.240164916338 0 0 0.99999999978157
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1305.47831038617 0 0 1
+ 9999.99999999999 0 1586.35107191267 0 0 1
+ 9999.99999999995 0 731.025521848869 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1080.76413214453 0 0 1
+ 10000 0 345.812037269069 0 0 1
+ 9999.99999999995 0 1071.64583623855 0 0 1
+ 9999.99999999999 0 433.999062600971 0 0 1
+ 6399.58264594564 1025.23814913837 4225.28268585009 0 0 0.999999999999002
+ 10000 0 4264.88124272268 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 577.350989728757 0 0 1
+ 10000 0 278.199834291908 0 0 1
+ 9999.99999999999 0 552.397685884274 0 0 1
+ 9999.99999999995 0 1059.05487232721 0 0 1
+ 9999.99999999999 0 5509.84309797247 0 0 1
+ 9999.99999999995 0 1340.72851315503 0 0 1
+ 10000 0 192.769230857026 0 0 1
+ 9999.99999999999 0 1033.81615576735 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 461.456748557555 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 1062.17251504477 0 0 1
+ 9999.99999999996 0 506.872515703581 0 0 1
+ 10000 0 100 0 0 1
+ 8862.76850347974 73.9634888265225 1982.60955003538 0 0 1.00000000000096
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1271.25844649111 0 0 1
+ 10000 0 396.156773587317 0 0 1
+ 10000 0 1884.14383803278 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 411.646798039396 0 0 1
+ 8659.07565271455 -730.91602036196 3191.79699478582 0 0 0.999999999999976
+ 9999.99999999999 0 1053.368710266 0 0 1
+ 9999.99999999999 0 1610.55881873656 0 0 1
+ 9999.99999999998 0 393.128351581586 0 0 1
+ 9999.99999999999 0 1099.0452615329 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1459.13160376302 0 0 1
+ 10000 0 100 0 0 1
+ 9791.42363020987 237.944875383227 1193.05203466768 0 0 0.999999998483916
+ 9999.99999999999 0 426.915737906812 0 0 1
+ 9999.99999999995 0 327.754154363025 0 0 1
+ 10000 0 4348.32977708649 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 3166.83169517003 0 0 1
+ 9999.99999999999 0 257.459394714984 0 0 1
+ 10000 0 1292.15224903405 0 0 1
+ 9999.99999999999 0 1859.66429420477 0 0 1
+ 10000 0 3419.90337231608 0 0 1
+ 10000 0 776.789403635468 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2266.4407417351 0 0 1
+ 9999.99999999996 0 219.657547403897 0 0 1
+ 9999.99999999999 0 930.805727747356 0 0 1
+ 9999.99999999996 0 1221.24976538671 0 0 1
+ 10000 0 100 0 0 1
+ 7107.27195803696 -1362.10387243818 3545.06929920444 0 0 0.999999999786342
+ 9999.99999999996 0 214.251901826412 0 0 1
+ 9607.78686968363 437.969792272802 7717.17732141982 0 0 0.999999999084903
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 335.632032534119 0 0 1
+ 9999.99999999999 0 1140.3993270319 0 0 1
+ 6923.91011142149 -28.5254584733994 3926.09991723849 0 0 1.00000000000068
+ 10000 0 955.899533681614 0 0 1
+ 9999.99999999998 0 630.284538055789 0 0 1
+ 10000 0 3170.4559527967 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 260.477428668462 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 3063.59021908043 0 0 1.76598492290372
+ 9999.99999999998 0 252.579516229776 0 0 1
+ 10000 0 549.95253995755 0 0 1
+ 10000 0 5772.06605558048 0 0 1
+ 9999.99999999999 0 115.650578193296 0 0 1
+ 9999.99999999996 0 706.651963822322 0 0 1
+ 9999.99999999999 0 317.305188522421 0 0 1
+ 10000 0 970.037813339519 0 0 1
+ 9999.99999999995 0 415.167483825843 0 0 1
+ 8624.17720115395 334.705359658345 1136.16431268283 0 0 0.99999999836395
+ 9999.99999999999 0 298.335376927134 0 0 1
+ 7616.47410747538 705.682567118993 3808.88409569787 0 0 0.999999998624816
+ 10000 0 569.106621028683 0 0 1
+ 10000 0 262.549028787834 0 0 1
+ 9999.99999999998 0 1568.75277169358 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10502.9240892244 0 745.674220940575 0 0 1
+ 9999.99999999998 0 631.627429648859 0 0 1
+ 10000 0 113.22739627039 0 0 1
+ 10000 0 849.652396383318 0 0 1
+ 9999.99999999995 0 255.571093084715 0 0 1
+ 9874.29130905898 14.3852813215371 1321.99629249382 0 0 1.76598492289095
+ 10000 0 10000 0 0 10000
+ 7043.20654368863 -600.72716046769 3220.58580726921 0 0 0.999999999899802
+ 9999.99999999999 0 1457.8471055353 0 0 1
+ 9999.99999999999 0 459.024463678461 0 0 1
+ 9999.99999999998 0 470.919383551557 0 0 1
+ 8247.71397455844 -66.4213993155802 773.508894895708 0 0 1.00000000000091
+ 10000 0 225.451796468377 0 0 1
+ 9999.99999999999 0 102.128156266505 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1263.8811860521 0 0 1
+ 9999.99999999999 0 2123.4551257021 0 0 1
+ 9999.99999999999 0 717.881624218307 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 1818.3383800633 0 0 1
+ 9999.99999999999 0 1815.40149177826 0 0 1
+ 9999.99999999999 0 1811.40644587247 0 0 1
+ 10000 0 624.348280625879 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 350.829667183385 0 0 1
+ 10000 0 1900.08789865501 0 0 1
+ 9999.99999999999 0 751.489900479131 0 0 1
+ 8797.01245318493 -397.360926297243 1909.59180168079 0 0 0.999999999999999
+ 9999.99999999999 0 1266.80379537311 0 0 1
+ 9957.44741181935 266.997901316321 1467.5096478627 0 0 0.999999999998984
+ 9999.99999999999 0 492.368115648711 0 0 1
+ 8588.08178019336 -554.486353661064 1734.03322405115 0 0 0.999999999228385
+ 10000 0 100 0 0 1
+ 8639.09344897032 -362.99278759825 1645.23920425987 0 0 0.999999999650673
+ 9999.99999999999 0 1204.94615511232 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 974.763116047672 0 0 1
+ 10000 0 475.847525914155 0 0 1
+ 9999.99999999996 0 528.935038424592 0 0 1
+ 10000 0 229.414708469025 0 0 1
+ 9999.99999999999 0 442.705425299228 0 0 1
+ 9999.99999999998 0 2996.51560244105 0 0 1
+ 10000 0 2095.10760432952 0 0 1
+ 10000 0 846.274534065803 0 0 1
+ 10000 0 474.13919996583 0 0 1
+ 9999.99999999998 0 287.140789853668 0 0 1
+ 10000 0 259.915552176447 0 0 1
+ 9999.99999999995 0 323.932722435974 0 0 1
+ 9999.99999999996 0 1471.22522668792 0 0 1
+ 10000 0 4315.53974299336 0 0 1
+ 9999.99999999999 0 534.945574373091 0 0 1
+ 9999.99999999998 0 791.190028353129 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 979.519298989394 0 0 1
+ 10000 0 1758.38326471408 0 0 1
+ 10000 0 626.85040280511 0 0 1
+ 10000 0 100 0 0 1
+ 5874.20769523553 -132.795470515152 3194.75537793928 0 0 1.00000000000074
+ 9999.99999999999 0 242.736969145332 0 0 1
+ 9999.99999999996 0 190.768703488663 0 0 1
+ 10000 0 434.044026625555 0 0 1
+ 9999.99999999995 0 229.281097500617 0 0 1
+ 9999.99999999999 0 1159.26828959584 0 0 1
+ 10000 0 1259.0834267721 0 0 1
+ 9048.27530910035 234.655977018657 1041.20128254045 0 0 0.999999997756298
+ 9999.99999999994 0 276.896684609763 0 0 1
+ 9229.70122896134 569.609431950303 2955.96530407386 0 0 0.999999999989571
+ 7274.581014852 62.8850133287899 2297.94415700814 0 0 1.00000000000059
+ 9999.99999999995 0 401.258952647699 0 0 1
+ 10000 0 6797.030668007 0 0 1
+ 10000 0 845.780136501848 0 0 1
+ 9999.99999999999 0 718.463885018604 0 0 1
+ 10000 0 427.974545891789 0 0 1
+ 10000 0 909.830739009978 0 0 1
+ 9999.99999999995 0 606.273477246896 0 0 1
+ 7085.47853543064 -809.234301780254 3532.1808767132 0 0 0.999999998964746
+ 10000 0 100 0 0 1
+ 10000 0 913.62170511612 0 0 1
+ 10000 0 5468.16167392542 0 0 1
+ 10000 0 1462.87611858797 0 0 1
+ 9999.99999999999 0 335.5038930101 0 0 1
+ 10000 0 609.742792242969 0 0 1
+ 9999.99999999997 0 552.307106664548 0 0 1
+ 9999.99999999996 0 1122.73896636045 0 0 1
+ 8939.41603304923 -662.653670865337 1488.28434006255 0 0 0.999999999686528
+ 9079.42198583217 -281.689217489998 1380.66955527525 0 0 0.999999999547303
+ 10000 0 708.099388670082 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999994 0 798.918699570186 0 0 1
+ 9999.99999999998 0 278.627758776319 0 0 1
+ 6853.08531658268 223.411512827313 3385.96624235715 0 0 0.999999999971838
+ 10000 0 424.546060895656 0 0 1
+ 10000 0 2067.27431404229 0 0 1
+ 10000 0 209.949273663461 0 0 1
+ 10000 0 100 0 0 1
+ 8626.40657546804 777.443465979987 6144.12992491194 0 0 1.76598492290404
+ 9999.99999999994 0 355.224143976338 0 0 1
+ 9495.85993331238 38.0417229854593 233.408341231801 0 0 1.00000000000015
+ 9999.99999999995 0 545.310838236998 0 0 1
+ 9999.99999999996 0 738.865455662154 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 170.247352099772 0 0 1
+ 9999.99999999999 0 763.633089913615 0 0 1
+ 9999.99999999999 0 211.084195122051 0 0 1
+ 10000 0 10000 0 0 10000
+ 9994.45462517583 26.6198086135169 1305.89102763009 0 0 0.999999998314238
+ 10000 0 1616.39811573068 0 0 1
+ 9999.99999999999 0 1228.15726287537 0 0 1
+ 9999.99999999999 0 503.804733807971 0 0 1
+ 10000 0 3874.35354877228 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2093.02815424659 0 0 1
+ 10000 0 819.95063198272 0 0 1
+ 10000 0 457.445274158492 0 0 1
+ 10000 0 1673.00454884331 0 0 1
+ 9760.14864027382 -201.183766832747 605.696843031439 0 0 0.999999999847355
+ 9999.99999999998 0 356.668035926814 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 443.645800462173 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 789.213857367269 0 0 1
+ 10000 0 711.111139941116 0 0 1
+ 9999.99999999999 0 425.161251852115 0 0 1
+ 10000 0 225.341262267353 0 0 1
+ 9999.99999999999 0 953.699899363278 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2842.00082660974 0 0 1
+ 10000 0 2683.05620139339 0 0 1.76598492290372
+ 10000 0 10000 0 0 10000
+ 9205.2186109086 494.084320125486 1219.50142423543 0 0 0.999999999999818
+ 9999.99999999996 0 291.908150250891 0 0 1
+ 9999.99999999996 0 274.552653848982 0 0 1
+ 9999.99999999999 0 1462.56527825591 0 0 1
+ 10000 0 10000 0 0 10000
+ 10000 0 100 0 0 1
+ 10000 0 1722.31549209317 0 0 1
+ 9999.99999999998 0 941.631704090778 0 0 1
+ 10246.8354238797 0 350.808089856748 0 0 1
+ 9519.35646728498 37.8747380102279 1799.94100384758 0 0 0.99999999998865
+ 10000 0 100 0 0 1
+ 10000 0 539.440408361629 0 0 1
+ 9999.99999999999 0 1261.62860534696 0 0 1
+ 10000 0 3242.77357403535 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 297.453635219853 0 0 1
+ 8605.86100238436 -281.916712241018 2052.39064315451 0 0 1.00000000000026
+ 9999.99999999998 0 2406.30767376046 0 0 1
+ 9999.99999999999 0 259.556166495553 0 0 1
+ 10000 0 548.074032668089 0 0 1
+ 9999.99999999995 0 1154.38937649446 0 0 1
+ 9143.55751906388 -771.587219314483 1687.59816095694 0 0 0.999999999989074
+ 8969.32214043655 -217.520812498756 1265.15244050713 0 0 0.999999999966743
+ 9999.99999999998 0 2335.05454111077 0 0 1
+ 10000 0 4906.65685811644 0 0 1
+ 9999.99999999999 0 502.891434404282 0 0 1
+ 10000 0 362.666052841098 0 0 1
+ 9999.99999999994 0 819.993308365681 0 0 1
+ 10000 0 3581.39699061104 0 0 1
+ 10000 0 2732.19289205341 0 0 1
+ 9999.99999999999 0 567.909975567724 0 0 1
+ 9999.99999999999 0 262.677329688685 0 0 1
+ 6619.1110472074 208.914861151752 3046.22977179537 0 0 1.00000000000453
+ 10000 0 1567.31745794938 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 7762.19290612754 -372.951856205158 805.489922915979 0 0 0.999999999991383
+ 10000 0 909.057835802897 0 0 1
+ 10000 0 1914.09461901652 0 0 1
+ 10000 0 1510.36777414374 0 0 1
+ 9999.99999999995 0 362.363690503676 0 0 1
+ 10000 0 3753.72628433254 0 0 1
+ 9999.99999999999 0 1877.56127062611 0 0 1
+ 9999.99999999999 0 1324.04728971144 0 0 1
+ 9999.99999999999 0 1503.07713563404 0 0 1
+ 10000 0 1111.57177056533 0 0 1
+ 9999.99999999999 0 2622.94041892538 0 0 1
+ 10000 0 226.88247273247 0 0 1
+ 10000 0 2088.44149151234 0 0 1
+ 10000 0 1566.87605470795 0 0 1
+ 9999.99999999999 0 370.859322639143 0 0 1
+ 8306.64815939982 -269.197241019568 1702.37188100366 0 0 1.00000000000052
+ 10000 0 5605.72026255553 0 0 1
+ 9533.37092598914 -233.484542143481 1487.45568646791 0 0 0.999999998287731
+ 9999.99999999997 0 607.175751037078 0 0 1
+ 8260.07059726237 -142.929183477486 1479.45363532918 0 0 1.00000000000004
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 374.697393617712 0 0 1
+ 6910.7433157176 108.735764424166 3245.17764602356 0 0 0.999999999997157
+ 8589.93651194539 -445.337462157101 891.27481917779 0 0 1.00000000000003
+ 9999.99999999994 0 649.95267855959 0 0 1
+ 9999.99999999998 0 551.837042593494 0 0 1
+ 10000 0 2063.13236957799 0 0 1
+ 10000 0 1064.11372226706 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 8240.04259821469 -41.5272891118558 1172.37487957381 0 0 1.00000000021916
+ 9999.99999999999 0 330.205747106287 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 532.880053956299 0 0 1
+ 7693.08451451747 781.228189253296 3673.33764927501 0 0 1.00000000000084
+ 7897.56264611562 687.038175046282 2873.17072261479 0 0 1.00000000008936
+ 10000 0 1687.31937751807 0 0 1
+ 9999.99999999996 0 1050.18518527783 0 0 1
+ 10000 0 1181.05157266634 0 0 1
+ 9999.99999999999 0 221.260918746497 0 0 1
+ 9999.99999999999 0 884.457010275359 0 0 1
+ 9473.67271767503 -137.639929065202 1538.42346980173 0 0 0.999999996961152
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 314.278716745601 0 0 1
+ 9999.99999999999 0 2674.67790093215 0 0 1
+ 9999.99999999996 0 371.569285685663 0 0 1
+ 9793.52064230241 120.066349522688 854.059452086478 0 0 1.00000000000003
+ 8409.79567459657 668.626623953431 2184.20928210269 0 0 0.99999999999891
+ 7287.26564381091 -253.559272416491 4472.8787096938 0 0 0.999999999816536
+ 9999.99999999996 0 1564.32537538152 0 0 1
+ 9999.99999999997 0 637.447528888771 0 0 1
+ 10000 0 4036.04457427435 0 0 1
+ 10000 0 137.023510877361 0 0 1
+ 9999.99999999999 0 859.563080385718 0 0 1
+ 10000 0 698.912543099525 0 0 1
+ 10000 0 1204.95186462489 0 0 1
+ 10000 0 6491.0161659591 0 0 1
+ 10000 0 795.556655807545 0 0 1
+ 8984.54644702441 -1458.88427548764 6975.43150617752 0 0 3.92118419702231
+ 10000 0 100 0 0 1
+ 10000 0 2023.17161163182 0 0 1
+ 10000 0 1607.96690685641 0 0 1
+ 10000 0 168.950815949414 0 0 1
+ 9335.34168008221 -95.2346408418854 727.770116964786 0 0 0.999999999999949
+ 10000 0 268.971238450724 0 0 1
+ 9999.99999999998 0 347.11771634676 0 0 1
+ 9999.99999999999 0 195.496241585183 0 0 1
+ 9999.99999999999 0 2117.79152388768 0 0 1
+ 10000 0 692.094281414305 0 0 1
+ 9999.99999999995 0 623.349102245303 0 0 1
+ 10000 0 1308.60381679622 0 0 1
+ 9999.99999999995 0 439.117167216146 0 0 1
+ 9999.99999999999 0 1488.3927637198 0 0 1
+ 9999.99999999995 0 925.479749561829 0 0 1
+ 10000 0 5209.77576973784 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 8614.48535380906 52.3410806816574 1790.09719447868 0 0 0.999999999985737
+ 9999.99999999999 0 278.459160689153 0 0 1
+ 9999.99999999996 0 171.700651786272 0 0 1
+ 9999.99999999995 0 846.302607415213 0 0 1
+ 7118.33397000205 -221.692195710909 2851.20202357609 0 0 0.999999999876672
+ 10000 0 1374.58413658212 0 0 1
+ 9999.99999999999 0 821.935251517886 0 0 1
+ 9999.99999999995 0 1453.94506884635 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 555.048391391837 0 0 1
+ 9999.99999999999 0 494.721264705782 0 0 1
+ 8909.78556972233 234.584824530411 1306.6145490242 0 0 0.999999998454322
+ 9999.99999999999 0 152.024038888125 0 0 1
+ 10000 0 778.508752957137 0 0 1
+ 10000 0 234.934770340693 0 0 1
+ 10000 0 3246.05422016057 0 0 1
+ 10000 0 100 0 0 1
+ 7034.27702080883 136.761790439218 3983.23462784514 0 0 1.00000000001627
+ 10000 0 151.958333783549 0 0 1
+ 9999.99999999999 0 470.330035601449 0 0 1
+ 10000 0 816.728284637245 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 309.965659521573 0 0 1
+ 9999.99999999995 0 275.447618197658 0 0 1
+ 9999.99999999999 0 1105.94761005285 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 491.643604495719 0 0 1
+ 9999.99999999996 0 929.7728871808 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1582.84241076096 0 0 1
+ 9999.99999999999 0 372.968655720451 0 0 1
+ 9999.99999999999 0 1860.51200632591 0 0 1
+ 9999.99999999995 0 1332.7186179682 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 121.985956448993 0 0 1
+ 10000 0 474.256981284856 0 0 1
+ 7084.02441235122 254.824229320135 580.9645347936 0 0 0.999999999799842
+ 10000 0 340.004939288419 0 0 1
+ 10000 0 1438.49802805331 0 0 3.92118419762768
+ 10000 0 482.285060804115 0 0 1
+ 8247.73597967729 1006.96189315693 6504.88757695428 0 0 1.7659849229064
+ 9999.99999999999 0 341.715192823886 0 0 1
+ 6650.17662270624 1229.97122189976 2584.12880180657 0 0 1.00000000000039
+ 7381.95260877018 -436.297702075202 3036.13443249357 0 0 0.999999999999782
+ 9999.99999999999 0 907.404223047261 0 0 1
+ 9999.99999999995 0 939.261392920718 0 0 1
+ 10000 0 240.20998215172 0 0 1
+ 9999.99999999999 0 1886.99409177437 0 0 1
+ 10000 0 100 0 0 1
+ 9054.61634538226 525.328625067752 1125.44863919214 0 0 0.999999999999702
+ 9999.99999999995 0 412.517495316678 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 1242.58364653283 0 0 1
+ 9999.99999999999 0 600.675682391834 0 0 1
+ 10000 0 623.013143486659 0 0 1
+ 10000 0 100 0 0 1
+ 9664.88117549489 63.5235562801757 1139.04453465561 0 0 0.999999999990617
+ 10000 0 100 0 0 1
+ 10000 0 260.951348005056 0 0 1
+ 9983.28336508168 -172.829565482564 1523.73435292231 0 0 0.999999999961328
+ 6798.58638305516 -679.37721473779 3185.6340384146 0 0 0.999999999423568
+ 9999.99999999998 0 303.611545160726 0 0 1
+ 10000 0 2526.41842665437 0 0 1
+ 9999.99999999999 0 2740.75443532769 0 0 1
+ 8667.03756043018 272.022165824136 3820.94265079351 0 0 0.999999999762227
+ 9999.99999999999 0 215.971650854572 0 0 1
+ 9999.99999999999 0 127.784705320953 0 0 1
+ 10000 0 100 0 0 1
+ 9829.81711596783 39.8592214639749 1532.29329605204 0 0 0.999999999996238
+ 10000 0 394.805670372096 0 0 1
+ 10000 0 163.708776180462 0 0 1
+ 10000 0 3862.90365756426 0 0 1
+ 9999.99999999999 0 1368.80891752997 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2197.2652282583 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999997 0 516.784001465604 0 0 1
+ 7707.11332515596 590.384586393856 2270.72012410675 0 0 0.999999999996946
+ 10000 0 160.652874164813 0 0 1
+ 9999.99999999999 0 2230.57478696552 0 0 1
+ 10000 0 100 0 0 1
+ 9507.90623410596 -667.979409475389 829.688808132951 0 0 0.999999999999778
+ 10000 0 2500.20630607141 0 0 1
+ 10000 0 2892.72442797619 0 0 1
+ 9999.99999999999 0 1140.70428587202 0 0 1
+ 10000 0 1296.13963113228 0 0 1
+ 10000 0 249.241151132122 0 0 1
+ 9999.99999999996 0 1658.50825067878 0 0 1
+ 10000 0 10000 0 0 10000
+ 10000 0 1565.82481648427 0 0 1
+ 10000 0 487.649420183533 0 0 1
+ 10000 0 2176.26259196217 0 0 1
+ 9305.07657806676 -184.152802650087 721.737213906395 0 0 1.00000000000012
+ 10000 0 1237.48892485526 0 0 1
+ 10000 0 160.870050228827 0 0 1
+ 10000 0 720.514929004231 0 0 1
+ 9999.99999999999 0 593.944448626968 0 0 1
+ 10000 0 1196.29625459378 0 0 1
+ 9999.99999999998 0 370.936460558273 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 649.832495906488 0 0 1
+ 9999.99999999999 0 1916.9609180422 0 0 1
+ 9999.99999999999 0 447.889922984184 0 0 1
+ 9999.99999999999 0 678.115001988535 0 0 1
+ 9999.99999999999 0 824.967138444729 0 0 1
+ 10000 0 518.946399606994 0 0 1
+ 10000 0 219.90001967477 0 0 1
+ 9477.43232116952 0.810229271890522 575.028791383694 0 0 0.999999997088684
+ 10000 0 766.950399474716 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 3587.9976849442 0 0 1
+ 9075.18051313278 121.866519531687 3391.66282660849 0 0 0.999999999977275
+ 9999.99999999999 0 575.882111874703 0 0 1
+ 9999.99999999999 0 1445.27709744322 0 0 1
+ 7752.7011062872 -175.016651888068 3511.51609287804 0 0 0.999999999253074
+ 10000 0 2657.61964658156 0 0 1
+ 9999.99999999995 0 1481.23941885228 0 0 1
+ 9999.99999999996 0 466.556798130849 0 0 1
+ 10000 0 10000 0 0 10000
+ 10000 0 3503.64476215879 0 0 1
+ 9999.99999999999 0 935.66978242908 0 0 1
+ 9999.99999999999 0 138.607369345258 0 0 1
+ 7862.04232778982 -767.068378362246 2851.15790308204 0 0 0.999999999931328
+ 10000 0 4427.29879784903 0 0 3.92118419762768
+ 8155.08530176044 -132.77177087344 4260.37681361841 0 0 1.00000000000165
+ 9999.99999999996 0 164.423123302836 0 0 1
+ 9999.99999999996 0 712.168903526335 0 0 1
+ 9999.99999999996 0 1492.22807311668 0 0 1
+ 10000 0 2478.96065948643 0 0 1
+ 10000 0 972.033077491461 0 0 1
+ 10000 0 474.873198880716 0 0 1
+ 9999.99999999999 0 272.215267047462 0 0 1
+ 10000 0 2574.84600980221 0 0 1
+ 9999.99999999999 0 837.633863222275 0 0 1
+ 10000 0 128.687161454011 0 0 1
+ 8829.3486454862 649.683730938125 1079.4847327715 0 0 0.999999994301786
+ 10000 0 184.088923661119 0 0 1
+ 9999.99999999995 0 1325.03917415814 0 0 1
+ 10000 0 160.629263909966 0 0 1
+ 10000 0 138.837354150041 0 0 1
+ 10000 0 1807.09811929663 0 0 1
+ 9999.99999999999 0 367.154524597636 0 0 1
+ 9999.99999999999 0 1391.16551808558 0 0 1
+ 9999.99999999999 0 265.211387297053 0 0 1
+ 9999.99999999996 0 599.637917860086 0 0 1
+ 10000 0 4997.25998210125 0 0 1
+ 9999.99999999995 0 259.279932306854 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2029.62375089487 0 0 1
+ 9999.99999999999 0 1180.33437569395 0 0 1
+ 10000 0 1264.98729967865 0 0 1
+ 9999.99999999999 0 682.518683424994 0 0 1
+ 8030.68308272701 -669.388739973441 1435.31542213375 0 0 0.999999999994284
+ 10000 0 1398.61567264013 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 223.908404934572 0 0 1
+ 10000 0 239.301416791357 0 0 1
+ 9999.99999999995 0 230.328269721726 0 0 1
+ 10000 0 639.844406285472 0 0 1
+ 9999.99999999998 0 234.382557524413 0 0 1
+ 10645.5966888564 -1820.57027435063 1546.59525552129 0 0 0.999999999999515
+ 9999.99999999999 0 250.355315865251 0 0 1
+ 9999.99999999994 0 502.042346317894 0 0 1
+ 10000 0 4366.86855684016 0 0 1
+ 6884.03446262602 -150.272045848093 3242.61400600633 0 0 1.00000000000318
+ 9999.99999999995 0 394.107049664132 0 0 1
+ 10000 0 197.098002481186 0 0 1
+ 9999.99999999995 0 952.820168283155 0 0 1
+ 6890.72623302382 -19.4607709171132 2560.87406309613 0 0 0.999999999999609
+ 9999.99999999999 0 815.408088845241 0 0 1
+ 9999.99999999999 0 1368.1086966708 0 0 1
+ 7458.77510087272 195.231907981746 3692.01066045006 0 0 1.00000000000262
+ 8548.37938671773 981.34243793572 2431.66966313277 0 0 0.999999999999966
+ 9999.99999999999 0 216.00215395708 0 0 1
+ 9999.99999999999 0 367.353734497895 0 0 1
+ 6588.10111985297 1206.79817264324 4575.19781401888 0 0 0.99999999999889
+ 10000 0 567.588559647474 0 0 1
+ 10000 0 429.282694371642 0 0 1
+ 9999.99999999999 0 2667.80338173933 0 0 1
+ 6880.39508847596 -364.225707338423 3428.94776082104 0 0 1.00000000002269
+ 9999.99999999995 0 1533.47536792224 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2993.92098691695 0 0 1
+ 10000 0 2161.76420817418 0 0 1
+ 7188.63197041018 -1360.70289764006 2561.27235245597 0 0 0.99999999999319
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 134.39842804668 0 0 1
+ 10000 0 649.718911825039 0 0 1
+ 9999.99999999999 0 1489.73160028835 0 0 1
+ 9979.05880470256 -101.089115256704 1703.00595028453 0 0 0.999999999993844
+ 10000 0 1599.8414876872 0 0 1
+ 10000 0 311.393408666938 0 0 1
+ 10000 0 820.913843103583 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2417.87636644688 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 298.652132253798 0 0 1
+ 9999.99999999999 0 727.43917233877 0 0 1
+ 10000 0 113.195974414935 0 0 1
+ 9795.60966083178 -161.424423982492 1024.89232770033 0 0 0.999999999660415
+ 9999.99999999998 0 1023.41514431455 0 0 1
+ 9999.99999999999 0 2069.08939063036 0 0 1
+ 9999.99999999996 0 569.517880971553 0 0 1
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 968.239626713876 0 0 1
+ 10000 0 107.184341371347 0 0 1
+ 9999.99999999999 0 976.574415622592 0 0 1
+ 10000 0 132.932529195824 0 0 1
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 2088.42309134876 0 0 3.92118419762768
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 241.975267501673 0 0 1
+ 9999.99999999996 0 1760.12489663867 0 0 1
+ 9999.99999999998 0 285.030960175549 0 0 1
+ 9475.53749242258 -152.820829324255 1613.72916318685 0 0 0.999999999999885
+ 10000 0 636.49688957611 0 0 1
+ 10000 0 2287.40690057821 0 0 1
+ 9661.76313744699 -407.352518327517 2927.06607767164 0 0 1.00000000000018
+ 9999.99999999999 0 552.99897054472 0 0 1
+ 10000 0 568.219700781067 0 0 1
+ 8788.93073286422 170.608079631884 2468.69727826629 0 0 1.00000000005481
+ 9999.99999999999 0 833.55367944937 0 0 1
+ 7613.15799023465 -44.5873182871177 2866.48381291487 0 0 1.00000000000022
+ 10000 0 100 0 0 1
+ 8899.29629993788 949.898642645241 1325.96219815944 0 0 0.999999999999748
+ 9999.99999999999 0 199.66077064633 0 0 1
+ 9999.99999999999 0 788.347629050767 0 0 1
+ 9999.99999999996 0 1605.10656751747 0 0 1
+ 9999.99999999999 0 943.080417791137 0 0 1
+ 10000 0 6436.4303454041 0 0 3.92118419762768
+ 7034.24405923783 420.985214374629 1862.97766791287 0 0 0.99999999996608
+ 10000 0 106.86308037843 0 0 1
+ 10000 0 135.617628222187 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 253.474567383174 0 0 1
+ 9999.99999999995 0 823.72098376909 0 0 1
+ 10000 0 100 0 0 1
+ 9776.62702922659 -93.6517198254763 1744.59702525608 0 0 1.00000000000288
+ 8476.14953209222 82.9473009785764 1765.17737599011 0 0 1.00000000000241
+ 9999.99999999996 0 253.023576471899 0 0 1
+ 10000 0 1193.38541821037 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2489.16017051645 0 0 1
+ 9999.99999999999 0 3133.43438654994 0 0 1
+ 10000 0 212.46954251838 0 0 1
+ 8765.68911941238 -255.511931807244 1122.99456063321 0 0 0.999999999999998
+ 10000 0 1557.86035005804 0 0 1
+ 7958.69976087004 -1466.97303610982 2569.39463123746 0 0 0.999999999999584
+ 9262.97694956505 -303.039892256269 4517.72045174293 0 0 0.999999999995815
+ 9999.99999999999 0 155.419618455927 0 0 1
+ 9999.99999999999 0 1295.0130925129 0 0 1
+ 7751.60361143829 337.366362050695 1555.47173963339 0 0 0.999999999999901
+ 10876.0364311102 0 4129.92463073764 0 0 1
+ 9999.99999999999 0 856.450522827261 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 128.130035201066 0 0 1
+ 10000 0 106.212795405558 0 0 1
+ 10000 0 1134.65873293678 0 0 1
+ 10000 0 100 0 0 1
+ 9745.41280663798 -331.819540702744 1828.7119771869 0 0 0.999999999742111
+ 10000 0 1352.12414602131 0 0 1
+ 8376.30673632047 -612.609401966799 2772.87160347329 0 0 0.999999999962485
+ 9999.99999999996 0 1160.00990629056 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 540.843481697622 0 0 1
+ 7175.88318610143 -98.3892613297495 3709.15636399085 0 0 0.999999999658468
+ 9999.99999999998 0 326.570864462656 0 0 1
+ 10000 0 122.138593853063 0 0 1
+ 9279.20883981804 18.1684150709163 506.867719909162 0 0 1.00000000000406
+ 9999.99999999999 0 1160.22563011484 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 193.373081513037 0 0 1
+ 9999.99999999999 0 733.313980260287 0 0 1
+ 8489.59374173337 -583.356803341118 2194.03024173461 0 0 0.999999999284058
+ 10000 0 6148.73017139783 0 0 3.92118419762768
+ 9999.99999999999 0 1264.36291299577 0 0 1.76598492290372
+ 9999.99999999995 0 606.470717290468 0 0 1
+ 8474.89979808442 29.8689817002424 1832.85324718501 0 0 1.00000000004072
+ 10000 0 262.265414301044 0 0 1
+ 10000 0 4049.46104364185 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 447.718522203977 0 0 1
+ 10000 0 633.647018428374 0 0 1
+ 9999.99999999999 0 959.399168925463 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1490.97936439805 0 0 1
+ 8310.89809447609 47.3054506495102 893.588692946925 0 0 1.00000000000013
+ 9999.99999999999 0 340.337716126547 0 0 1
+ 9999.99999999998 0 2173.06359647207 0 0 2.09659916873119
+ 7750.38797389683 -1145.9937390403 2092.98583692642 0 0 0.999999998457188
+ 9999.99999999999 0 142.941616243659 0 0 1
+ 9999.99999999999 0 954.857295076505 0 0 1
+ 10000 0 100 0 0 1
+ 8282.66398065158 -254.044306942844 2759.88512512995 0 0 1.76598492290432
+ 8966.020556824 201.077472954321 1781.77242649897 0 0 1.0000000000201
+ 9999.99999999999 0 215.368081366471 0 0 1
+ 9999.99999999999 0 311.87958250839 0 0 1
+ 9999.99999999999 0 537.154892556513 0 0 1
+ 10000 0 489.245081058145 0 0 1
+ 9999.99999999999 0 116.202106661727 0 0 1
+ 10000 0 650.795509023123 0 0 1
+ 10000 0 260.066719059115 0 0 1
+ 9999.99999999998 0 933.343664923126 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 541.792518116047 0 0 1
+ 10000 0 379.07669913724 0 0 1
+ 9999.99999999999 0 1423.49615565172 0 0 1
+ 9999.99999999997 0 524.023137377139 0 0 1
+ 9999.99999999996 0 2436.44322905203 0 0 1
+ 7389.47656656144 -168.113141167237 2587.46896523901 0 0 0.999999999682948
+ 7648.69968240192 -57.6000746157257 913.899060028289 0 0 0.999999999983617
+ 8538.59430601215 -281.711641148178 551.196495896607 0 0 1.00000000000007
+ 9999.99999999999 0 609.978384698286 0 0 1
+ 10000 0 375.889327416672 0 0 1
+ 9999.99999999999 0 375.467703095868 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 546.570121814464 0 0 1
+ 9999.99999999994 0 219.43676354855 0 0 1
+ 10000 0 2200.88469497724 0 0 1
+ 9999.99999999995 0 381.333538550649 0 0 1
+ 9146.61921997703 -242.568779795965 1693.66573515775 0 0 0.999999999790061
+ 9999.99999999995 0 576.970292096204 0 0 1
+ 9999.99999999996 0 724.131414605843 0 0 1
+ 9999.99999999999 0 2150.83522817083 0 0 1
+ 9999.99999999996 0 244.066796576216 0 0 1
+ 9509.53752702998 113.490100223629 1796.22666948584 0 0 0.999999999999789
+ 9999.99999999995 0 905.560523389441 0 0 1
+ 9999.99999999999 0 320.382680557804 0 0 1
+ 9999.99999999995 0 833.862448917811 0 0 1
+ 8624.38978717466 400.758627233963 1140.84240097945 0 0 0.99999999846159
+ 9999.99999999999 0 2300.96276918549 0 0 1
+ 8401.73274312924 443.36851964065 1913.36889873393 0 0 0.999999999999948
+ 10000 0 1339.33053355719 0 0 1
+ 9999.99999999995 0 203.825471752813 0 0 1
+ 10000 0 199.067954018244 0 0 1
+ 10000 0 2771.42819644211 0 0 1
+ 10000 0 179.273331973495 0 0 1
+ 9999.99999999999 0 175.907152772674 0 0 1
+ 9999.99999999996 0 682.855372348394 0 0 1
+ 10000 0 528.335394914261 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 613.55013987515 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 956.0725222838 0 0 1
+ 7424.99730817738 193.036321309372 3401.51991624412 0 0 1.00000000002358
+ 9999.99999999999 0 325.306492717458 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 195.200690000881 0 0 1
+ 10000 0 2175.77678307634 0 0 1
+ 9999.99999999998 0 429.798630839013 0 0 1
+ 8177.78952667067 -152.460088859842 1856.55563531639 0 0 0.999999999927885
+ 10000 0 551.308536768951 0 0 1
+ 9999.99999999999 0 196.548390636908 0 0 1
+ 9999.99999999999 0 265.602638443296 0 0 1
+ 10000 0 145.314390893032 0 0 1
+ 10000 0 1274.94629034534 0 0 1
+ 9999.99999999998 0 120.912114035563 0 0 1
+ 10000 0 165.746604883399 0 0 1
+ 10000 0 1636.12508460224 0 0 1
+ 10000 0 170.042250271592 0 0 1
+ 9999.99999999999 0 160.871762053427 0 0 1
+ 9999.99999999999 0 285.561754239323 0 0 1
+ 9999.99999999999 0 457.808371984531 0 0 1
+ 9999.99999999995 0 623.632476432178 0 0 1
+ 10000 0 300.064827614796 0 0 1
+ 10000 0 894.506498081948 0 0 1
+ 9950.47562770451 104.562511030345 1294.36924097054 0 0 0.999999999885576
+ 10000 0 100 0 0 1
+ 10000 0 331.859963896359 0 0 1
+ 10000 0 349.415895455634 0 0 1
+ 9654.21407256508 395.607729781348 1620.57032733625 0 0 1.00000000000024
+ 10000 0 3046.5161658435 0 0 1
+ 9999.99999999998 0 1641.53239799061 0 0 1
+ 10000 0 1168.9766428041 0 0 1
+ 9999.99999999999 0 515.001846473705 0 0 1
+ 9999.99999999999 0 1191.90972415339 0 0 1
+ 10000 0 418.033818444348 0 0 1
+ 8539.75757264922 89.0142067901434 885.434613122657 0 0 0.999999996414919
+ 9999.99999999999 0 1338.70305643371 0 0 1
+ 10000 0 219.549694102406 0 0 1
+ 9999.99999999998 0 333.569840314138 0 0 1
+ 10000 0 707.109121317485 0 0 1
+ 7980.50546732457 371.097912213162 4294.87293133144 0 0 1.30239865204097
+ 8150.3547504801 -939.928120900975 7016.35473951047 0 0 3.92118419762791
+ 9999.99999999999 0 3341.26472166163 0 0 1
+ 10000 0 282.114307229433 0 0 1
+ 10000 0 1434.03949516394 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 1082.40581855992 0 0 1
+ 10000 0 1195.85437698823 0 0 1
+ 9999.99999999999 0 340.941447098606 0 0 1
+ 10000 0 103.410842651055 0 0 1
+ 9999.99999999999 0 1338.47616189271 0 0 1
+ 10000 0 172.441125141058 0 0 1
+ 9999.99999999999 0 888.78134267682 0 0 1
+ 9612.93281630003 -299.480303636288 578.600002052544 0 0 0.999999999827548
+ 9364.52663646283 -2.72520673367395 367.741226149257 0 0 0.999999999822691
+ 9999.99999999996 0 980.086823579272 0 0 1
+ 9999.99999999999 0 536.994390987103 0 0 1
+ 7825.0950694699 934.890085839682 6723.55630220607 0 0 1.76598492296137
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1157.88066162863 0 0 1
+ 9999.99999999998 0 239.101770855341 0 0 1
+ 10000 0 136.210418863827 0 0 1
+ 9999.99999999999 0 451.067234094486 0 0 1
+ 10000 0 3276.204044802 0 0 1
+ 10000 0 100 0 0 1
+ 9579.47923660061 367.95495160263 1774.62137773048 0 0 0.999999999998848
+ 10000 0 115.754829235122 0 0 1
+ 9999.99999999995 0 266.336159606798 0 0 1
+ 9999.99999999996 0 1523.19688109651 0 0 1
+ 9999.99999999999 0 1614.7098524583 0 0 1
+ 10000 0 272.620635488285 0 0 1
+ 8841.29593833922 -781.40479372662 2074.15075398843 0 0 0.99999999999989
+ 9999.99999999999 0 686.306875939832 0 0 1
+ 10000 0 6177.45074767829 0 0 1
+ 10000 0 100 0 0 1
+ 8359.04768930073 471.317505411322 2881.84533182794 0 0 0.999999999996237
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 722.762244968203 0 0 1
+ 8985.40978760267 25.8181429253558 1488.55356508114 0 0 1.00000000000003
+ 10000 0 2131.04603424736 0 0 1
+ 9999.99999999997 0 118.056759411884 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 659.283771726355 0 0 1
+ 9999.99999999996 0 741.077334534645 0 0 1
+ 9793.26532289688 95.135485478562 1326.4677826251 0 0 1.00000000001848
+ 10000 0 109.000701729559 0 0 1
+ 9999.99999999999 0 542.718517102191 0 0 1
+ 9999.99999999999 0 2451.64354039167 0 0 1
+ 10000 0 544.145235073865 0 0 1
+ 10000 0 2967.8809372495 0 0 1
+ 8305.42228509308 11.725349114589 3919.86059430016 0 0 1.00000000000045
+ 10000 0 155.591844145237 0 0 1
+ 9999.99999999999 0 2489.24433555993 0 0 1
+ 9999.99999999999 0 356.243664252298 0 0 1
+ 9999.99999999999 0 764.546860525439 0 0 1
+ 10000 0 1387.20280726975 0 0 1
+ 7184.58823449274 71.7270531098355 2287.50376556336 0 0 0.999999999985564
+ 9999.99999999999 0 1722.00989899253 0 0 1
+ 10000 0 2154.06696789855 0 0 1
+ 10000 0 230.558523516298 0 0 1
+ 9357.06952924559 -592.207334569678 1439.02531959419 0 0 0.999999999998548
+ 9999.99999999999 0 1103.19802722989 0 0 1
+ 8935.65400722084 141.102039861911 888.328611953086 0 0 0.999999999971326
+ 9999.99999999999 0 910.971938380945 0 0 1
+ 9999.99999999995 0 256.675369620497 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 735.092635801062 0 0 1
+ 10000 0 6857.33808248646 0 0 1
+ 9999.99999999999 0 558.027363741722 0 0 1
+ 9970.41852241823 143.740674705017 1614.40393016341 0 0 0.999999997425016
+ 7816.73881338761 -539.279617949582 1567.68523481977 0 0 0.999999999805519
+ 10000 0 100 0 0 1
+ 10000 0 3658.26691768287 0 0 1
+ 9640.07310726006 -121.007854368798 1005.17104630114 0 0 1.00000000000015
+ 10000 0 6076.16470974485 0 0 1
+ 10000 0 384.521027690143 0 0 1
+ 9999.99999999992 0 1000.93525035911 0 0 1
+ 9249.84658185328 -988.253166842382 1717.94163737157 0 0 0.99999999850481
+ 9999.99999999996 0 1175.98272794271 0 0 1
+ 10000 0 1724.47863947642 0 0 1
+ 9999.99999999999 0 619.605276734042 0 0 1
+ 10000 0 10000 0 0 10000
+ 10000 0 275.872269816258 0 0 1
+ 8522.26924696987 -18.0720714706498 5279.72710314862 0 0 0.999999999988674
+ 9999.99999999999 0 624.664561653276 0 0 1
+ 10000 0 7647.43437553039 0 0 15.0815345461401
+ 9999.99999999999 0 1018.27015252298 0 0 1
+ 9999.99999999994 0 144.373978402516 0 0 1
+ 8878.36011679452 741.173963733462 7649.10305445286 0 0 3.92118419732467
+ 10000 0 277.864242989529 0 0 1
+ 9999.99999999999 0 288.631137926112 0 0 1
+ 9999.99999999996 0 525.521420880136 0 0 1
+ 10000 0 898.064201530719 0 0 1
+ 9999.99999999996 0 1108.76180913167 0 0 1
+ 9999.99999999999 0 375.725198636975 0 0 1
+ 9999.99999999996 0 689.955773818708 0 0 1
+ 8628.75720420884 280.120207425569 1489.2795497852 0 0 0.999999999999696
+ 9999.99999999999 0 2066.50489898758 0 0 1
+ 10000 0 289.245970071299 0 0 1
+ 9999.99999999996 0 1421.86109307829 0 0 1
+ 10000 0 783.50006930763 0 0 1
+ 9999.99999999999 0 334.161783447943 0 0 1
+ 9999.99999999999 0 1232.12815713252 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 767.01215730072 0 0 1
+ 10000 0 535.520432344274 0 0 1
+ 9999.99999999994 0 1709.62475338757 0 0 1
+ 10000 0 4050.22754641541 0 0 1
+ 9999.99999999999 0 231.593919801285 0 0 1
+ 9999.99999999999 0 825.503582253896 0 0 1
+ 9603.59077785272 -225.692539640108 978.102521685636 0 0 0.999999999999274
+ 10000 0 2347.01853858817 0 0 1
+ 9999.99999999999 0 445.957391565701 0 0 1
+ 9999.99999999996 0 640.253919136599 0 0 1
+ 9740.48238221153 -78.93955655271 3093.67801895732 0 0 0.999999999740733
+ 9999.99999999999 0 2829.51110329744 0 0 1
+ 8791.47835826173 -594.1360921384 3148.16034290346 0 0 0.999999999964526
+ 10000 0 438.416885452924 0 0 1
+ 9999.99999999996 0 1708.24170698277 0 0 1
+ 8984.03476136327 254.690731029539 1613.17143713963 0 0 0.999999999989282
+ 9999.99999999996 0 229.083906631441 0 0 1
+ 9999.99999999999 0 857.119940071446 0 0 1
+ 10000 0 107.417854691219 0 0 1
+ 9999.99999999996 0 189.725232114054 0 0 1
+ 7730.63462915372 597.564998031211 6334.89186340532 0 0 1.76598492276868
+ 9999.99999999999 0 739.888491241144 0 0 1
+ 10000 0 10000 0 0 10000
+ 10000 0 1224.88566849118 0 0 1
+ 9999.99999999996 0 743.173162546839 0 0 1
+ 10000 0 2686.27009153218 0 0 1
+ 7928.6434019475 1026.32213182485 3145.16553795442 0 0 0.999999999546608
+ 5906.9293491596 -122.773582642447 2846.94013999577 0 0 1.00000000000008
+ 9999.99999999995 0 970.87026044322 0 0 1
+ 9999.99999999995 0 2502.61548221268 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 447.021535525445 0 0 1
+ 9999.99999999999 0 164.291469557267 0 0 1
+ 10000 0 4017.21538395173 0 0 1
+ 6862.75183254846 -945.568645639744 3120.72330138325 0 0 1.00000000005495
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 1049.92080202333 0 0 1
+ 9999.99999999999 0 158.58117777664 0 0 1
+ 9999.99999999995 0 1509.2165081085 0 0 1
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 767.03942886428 0 0 1
+ 10000 0 1268.16165137818 0 0 1
+ 10000 0 3317.31698883415 0 0 1
+ 10000 0 181.57331479993 0 0 1
+ 8322.49409765037 411.702002309216 4862.78369264728 0 0 1.00000000009049
+ 9999.99999999992 0 961.064158017122 0 0 1
+ 9999.99999999999 0 754.91922782362 0 0 1
+ 9999.99999999996 0 403.722082920508 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 499.193945921205 0 0 1
+ 9999.99999999999 0 241.261018761543 0 0 1
+ 9999.99999999996 0 484.640486731758 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 4049.99641874257 0 0 1
+ 6929.102212808 -131.178533947641 2958.06569284526 0 0 0.999999999999454
+ 8347.82359318997 -202.786665996402 1566.46642898173 0 0 1.00000000000504
+ 10000 0 216.302740597851 0 0 1
+ 10000 0 5246.97092440473 0 0 1
+ 10000 0 834.683469170648 0 0 1
+ 8181.20986362863 227.831580223069 1091.75320875482 0 0 0.99999999676038
+ 10000 0 573.872227487784 0 0 1
+ 10000 0 265.378487724849 0 0 1
+ 10000 0 740.879724866655 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 255.45070960463 0 0 1
+ 10000 0 728.644419895146 0 0 1
+ 9999.99999999995 0 216.818313489175 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 285.969871493927 0 0 1
+ 9553.5809407648 40.1523741597939 711.729081085739 0 0 1.00000000000352
+ 10000 0 2199.31111175945 0 0 1
+ 10000 0 3084.35330849814 0 0 1
+ 9999.99999999999 0 1435.66902897641 0 0 1
+ 9999.99999999999 0 684.169457919756 0 0 1
+ 10000 0 183.211442403071 0 0 1
+ 9476.2250715564 -13.6680958535621 1128.49469089274 0 0 1.00000000000047
+ 10000 0 210.897148078728 0 0 1
+ 10000 0 1986.42799937413 0 0 1
+ 9156.95978373293 -236.35531462067 1965.37241007594 0 0 0.999999999999642
+ 10000 0 761.082857604742 0 0 1
+ 9614.75858392351 -100.907061700897 2620.76732415249 0 0 0.999999999997908
+ 9999.99999999999 0 216.754553696954 0 0 1
+ 10000 0 2098.01846560868 0 0 1
+ 10000 0 213.134309099066 0 0 1
+ 10000 0 889.361912938786 0 0 1
+ 9999.99999999999 0 187.919283235494 0 0 1
+ 10000 0 544.938172082898 0 0 1
+ 9999.99999999995 0 1890.10625687542 0 0 3.92118419762768
+ 10000 0 100 0 0 1
+ 9856.04286723982 -62.0913298868528 318.931172196017 0 0 0.999999999923875
+ 9495.77933393295 -841.889266638803 1323.78715165048 0 0 0.999999999991325
+ 9882.27021168658 435.717489481643 6200.28580399707 0 0 3.92118419700378
+ 9999.99999999999 0 550.831685317934 0 0 1
+ 9999.99999999999 0 540.731214405121 0 0 1
+ 7941.90906453174 92.0076711332341 3064.24181159126 0 0 1.00000000000027
+ 10000 0 332.879362611147 0 0 1
+ 9999.99999999999 0 313.126659681961 0 0 1
+ 6787.12911530719 -339.75022405767 6787.54567872903 0 0 1.00000000000162
+ 10000 0 1756.86481570859 0 0 3.92118419762768
+ 9999.99999999999 0 1049.22673183848 0 0 1
+ 9999.99999999999 0 334.808123040964 0 0 1
+ 10000 0 194.925697026183 0 0 1
+ 9999.99999999999 0 430.580699070382 0 0 1
+ 9999.99999999996 0 302.425619550769 0 0 1
+ 10000 0 1340.33530824896 0 0 1
+ 7477.50420872487 -2067.50847851794 4563.50320516011 0 0 0.999999999862272
+ 10000 0 100 0 0 1
+ 10000 0 1845.40361371482 0 0 1
+ 10000 0 951.588879802443 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2258.21461603765 0 0 1
+ 9999.99999999995 0 989.014282528801 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 287.665052225765 0 0 1
+ 9999.99999999999 0 376.902127382725 0 0 1
+ 8281.99115880797 -204.925819046232 1511.67444774822 0 0 0.99999999999962
+ 10000 0 450.108112109435 0 0 1
+ 10000 0 458.352691310047 0 0 1
+ 9999.99999999999 0 1407.63601241358 0 0 1
+ 10000 0 888.147606135274 0 0 1
+ 10000 0 2724.68371488555 0 0 1
+ 9999.99999999999 0 724.237959928109 0 0 1
+ 7548.23263541692 -899.881409043353 5234.09839631962 0 0 1.00000000000043
+ 10000 0 1199.48336002933 0 0 1
+ 8653.67001998132 32.1822478125206 1057.82002727192 0 0 1.00000000000106
+ 10000 0 796.265514789076 0 0 1
+ 9999.99999999999 0 1489.42292395576 0 0 1
+ 10000 0 1020.01201931957 0 0 1.76598492290372
+ 10000 0 2385.91942014838 0 0 1
+ 9999.99999999998 0 4232.32155800289 0 0 1
+ 10000 0 100 0 0 1
+ 10501.75451674 0 963.315725689294 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 393.077944295123 0 0 1
+ 6161.00065051646 684.683142980814 5235.74582729565 0 0 1.00000000000042
+ 9999.99999999995 0 179.047791965729 0 0 1
+ 10000 0 215.366894573399 0 0 1
+ 6526.61391675215 1455.55730358848 4159.762050435 0 0 1.00000000000288
+ 10000 0 251.128391148221 0 0 1
+ 8370.93169547678 -24.2104048418906 1666.16221279078 0 0 1.00000000001052
+ 8241.50816387984 -80.1701667925857 2520.79267365937 0 0 1.00000000010964
+ 9999.99999999999 0 1038.99771279903 0 0 1
+ 10000 0 650.930798217852 0 0 1
+ 9999.99999999995 0 715.415617155358 0 0 1
+ 9999.99999999999 0 2399.77820837859 0 0 1
+ 9999.99999999999 0 129.707466319899 0 0 1
+ 10000 0 100 0 0 1
+ 9335.99515114594 -102.592428880132 798.43897811555 0 0 0.999999999999989
+ 10000 0 730.990041334893 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 136.154673679004 0 0 1
+ 8572.76122180865 -219.812114538207 1946.99724757657 0 0 0.999999999999784
+ 9999.99999999999 0 1270.78915061138 0 0 1
+ 10000 0 740.567135803223 0 0 1
+ 10000 0 102.39518511195 0 0 1
+ 9705.75610732898 235.926359187058 702.69103080872 0 0 0.999999996729742
+ 9999.99999999999 0 1472.07530236126 0 0 1
+ 9999.99999999996 0 293.423340476466 0 0 1
+ 9999.99999999999 0 1423.141101211 0 0 1
+ 9999.99999999999 0 1921.96737126246 0 0 1
+ 10000 0 1141.24444450547 0 0 1
+ 7008.27291605187 1076.45644404926 5576.96702126416 0 0 0.999999999999933
+ 10000 0 113.598415127769 0 0 1
+ 10000 0 1138.44666101458 0 0 1
+ 10000 0 1875.40624620392 0 0 1
+ 10000 0 479.968946489273 0 0 1
+ 10000 0 2801.77631468432 0 0 1
+ 10000 0 3133.38349154468 0 0 1
+ 10000 0 323.718778449509 0 0 1
+ 9999.99999999996 0 747.628363444026 0 0 1
+ 9999.99999999999 0 177.203239948957 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1367.81769509807 0 0 1
+ 10000 0 323.190824161452 0 0 1
+ 9999.99999999999 0 901.453192114667 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2391.30229951562 0 0 1
+ 10000 0 189.726536998011 0 0 1
+ 9999.99999999999 0 3235.1861250433 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1456.05719026102 0 0 1
+ 9999.99999999999 0 677.72173044712 0 0 1
+ 10000 0 104.86128871962 0 0 1
+ 10000 0 1473.22635159593 0 0 1
+ 10000 0 3026.47907882654 0 0 1
+ 9999.99999999999 0 1936.45352143543 0 0 1
+ 9257.35397137321 77.1699287928211 673.278937269135 0 0 0.99999999999985
+ 9117.40429079796 456.252141489531 1185.21830174992 0 0 0.999999999967794
+ 10000 0 306.915734610372 0 0 1
+ 11872.4411114913 0 5690.14460107606 0 0 1
+ 9999.99999999999 0 777.411507506077 0 0 1
+ 9999.99999999999 0 2905.18181221078 0 0 1
+ 10000 0 208.919725217351 0 0 1
+ 10000 0 818.809440686127 0 0 1
+ 9999.99999999999 0 210.166233320954 0 0 1
+ 10000 0 1670.1326989596 0 0 1
+ 9185.17176716565 -162.450485115369 555.807339604742 0 0 0.999999999999539
+ 9999.99999999997 0 2432.95368595953 0 0 3.92118419762768
+ 10000 0 2213.74962468778 0 0 1
+ 9999.99999999999 0 456.426502893117 0 0 1
+ 10000 0 2849.98421570679 0 0 1.76598492290372
+ 9999.99999999995 0 378.778895209846 0 0 1
+ 9999.99999999999 0 819.6354750197 0 0 1
+ 10000 0 100 0 0 1
+ 6386.1869980867 1130.32961594233 2646.13214324863 0 0 0.999999999999628
+ 10000 0 1440.60374249546 0 0 1
+ 9890.06503664876 116.925949044129 2335.50007229257 0 0 0.999999999996817
+ 10000 0 100 0 0 1
+ 10000 0 876.643608955987 0 0 1
+ 10000 0 1741.77289543923 0 0 1
+ 9999.99999999999 0 1399.27438222035 0 0 1
+ 9999.99999999999 0 175.771388071042 0 0 1
+ 9999.99999999999 0 1087.98502762347 0 0 1
+ 7166.33502547723 908.954890212385 5525.89677357548 0 0 0.999999999987894
+ 9999.99999999999 0 798.05276054212 0 0 1
+ 10000 0 393.424134099596 0 0 1
+ 8262.63014692233 -900.332960798405 1127.21659365904 0 0 0.999999998190149
+ 9999.99999999996 0 203.147825005922 0 0 1
+ 9999.99999999999 0 168.989127706524 0 0 1
+ 9999.99999999995 0 2902.60164804346 0 0 1
+ 8342.2551338478 304.002405507188 4894.27394185463 0 0 0.999999997250299
+ 9999.99999999994 0 359.905505577159 0 0 1
+ 8431.35348868484 272.382917543343 3718.14949859782 0 0 0.999999999994353
+ 9999.99999999998 0 348.405922191885 0 0 1
+ 10000 0 1196.95446720926 0 0 1
+ 9999.99999999999 0 957.080977789407 0 0 1
+ 9999.99999999999 0 1092.92781447504 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 915.982856514693 0 0 1
+ 7370.29579789162 1455.06096913376 3143.04899131506 0 0 0.999999999971434
+ 9999.99999999999 0 1963.69161645995 0 0 1
+ 10000 0 347.405931945856 0 0 1
+ 10000 0 1248.26685003963 0 0 1
+ 10000 0 3887.5957501739 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1349.15895860795 0 0 1
+ 9999.99999999999 0 893.641291280568 0 0 1
+ 8151.98947078832 -448.912160125146 1456.96454865662 0 0 0.999999999931137
+ 10000 0 1281.68362780527 0 0 1
+ 9999.99999999994 0 549.212496762019 0 0 1
+ 10000 0 216.59189336084 0 0 1
+ 7544.09438597072 -544.987284488227 3498.90241516555 0 0 1.00000000006546
+ 10000 0 208.203458270802 0 0 1
+ 10000 0 4099.22760256473 0 0 1
+ 9999.99999999996 0 221.221451614727 0 0 1
+ 9999.99999999999 0 3594.90475259506 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 733.203493733947 0 0 1
+ 9999.99999999999 0 1146.05970540811 0 0 1
+ 9999.99999999999 0 532.993937014829 0 0 1
+ 9999.99999999999 0 1037.19573161696 0 0 1
+ 10000 0 1636.45608685335 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 608.619365588565 0 0 1
+ 7994.48913039863 -940.906537795376 2471.42111401768 0 0 0.999999999999658
+ 9999.99999999999 0 588.000074413492 0 0 1
+ 10000 0 506.747911753211 0 0 1
+ 9999.99999999999 0 137.832201770256 0 0 1
+ 7475.01675435502 -471.9840400824 2434.8729939696 0 0 1.00000000000022
+ 9999.99999999999 0 226.792971150722 0 0 1
+ 9999.99999999998 0 458.711337072075 0 0 1
+ 7617.44566516467 251.570797132145 6528.9432642368 0 0 1.76598492319873
+ 10000 0 227.429043382203 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 130.431089853715 0 0 1
+ 10000 0 3610.71794492681 0 0 3.92118419762769
+ 9999.99999999999 0 2164.28687062901 0 0 1
+ 10000 0 2223.95219865767 0 0 1
+ 10000 0 615.852252902475 0 0 1
+ 10000 0 603.122251106214 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 222.148733429959 0 0 1
+ 9999.99999999998 0 2424.79471593951 0 0 1
+ 9999.99999999999 0 699.804715170524 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 323.94589150666 0 0 1
+ 10000 0 829.714306619487 0 0 1
+ 10000 0 1415.78634424627 0 0 3.92118419762769
+ 10000 0 4706.31068068697 0 0 1
+ 9999.99999999995 0 236.07263884983 0 0 1
+ 10000 0 2704.23230348664 0 0 1
+ 9999.99999999999 0 246.373719260606 0 0 1
+ 9999.99999999995 0 875.523433908154 0 0 1
+ 9311.05284547669 -188.045059598868 908.674246214241 0 0 1.00000000000041
+ 10000 0 506.243901740031 0 0 1
+ 10000 0 165.122016226374 0 0 1
+ 10000 0 233.275149605034 0 0 1
+ 9999.99999999995 0 864.873134010398 0 0 1
+ 9999.99999999996 0 309.779582213873 0 0 1
+ 7788.2443759124 672.157641312987 1922.53643664611 0 0 0.999999999999134
+ 8621.5033224518 -286.017421984474 1232.94081831991 0 0 0.99999999965053
+ 9999.99999999995 0 1728.40014357124 0 0 1
+ 9999.99999999996 0 1762.20054321307 0 0 1
+ 10000 0 1812.90631787618 0 0 1
+ 9999.99999999997 0 848.474633564862 0 0 1
+ 10000 0 1149.06826955459 0 0 1
+ 8996.71459827926 711.662340598302 706.464794566032 0 0 0.999999999833689
+ 6105.16513346929 778.596610343409 2733.93023711464 0 0 0.999999999999611
+ 9999.99999999999 0 554.842188352191 0 0 1
+ 9999.99999999996 0 1764.71606113725 0 0 1
+ 9931.77078347039 100.050423046507 2937.96453101083 0 0 1.00000000000015
+ 6329.4484199814 667.19851355483 3208.27664941637 0 0 1.00000000021895
+ 10000 0 1225.40047807629 0 0 1
+ 10000 0 2359.7844383455 0 0 1.76598492290372
+ 9999.99999999999 0 497.399121196766 0 0 1
+ 9999.99999999996 0 274.847267692983 0 0 1
+ 10000 0 663.78493255014 0 0 1
+ 10000 0 200.18902595565 0 0 1
+ 7852.08805340788 -231.872115605323 3019.79409851572 0 0 0.999999999999959
+ 8719.95310219752 -202.484070586149 2155.7326404041 0 0 1.00000000000002
+ 10000 0 100 0 0 1
+ 10000 0 884.846362355622 0 0 1
+ 10000 0 460.39092789024 0 0 1
+ 9999.99999999996 0 1898.3397579995 0 0 1
+ 6341.14322838173 746.597649081358 5222.74740203621 0 0 0.99999999999793
+ 9999.99999999996 0 417.602981167021 0 0 1
+ 10000 0 2494.55229511162 0 0 1
+ 9505.13996238606 15.8412074513464 980.888731054249 0 0 0.999999998206441
+ 9999.99999999999 0 713.434635473601 0 0 1
+ 8361.81308755431 -401.42414597739 2141.52607184086 0 0 0.999999999999574
+ 9999.99999999999 0 1114.06463475128 0 0 1
+ 9999.99999999999 0 704.995216644634 0 0 1
+ 9999.99999999999 0 294.2237089347 0 0 1
+ 9999.99999999999 0 132.618587985158 0 0 1
+ 10000 0 185.754429372634 0 0 1
+ 10000 0 363.839928826375 0 0 1
+ 9999.99999999999 0 826.672186110857 0 0 1
+ 10000 0 4918.77466269694 0 0 1
+ 9053.19455903309 -406.010342998446 3562.58849928677 0 0 0.999999999741456
+ 9999.99999999999 0 286.732098245217 0 0 1
+ 9999.99999999996 0 1139.2453585289 0 0 1
+ 10000 0 189.766415217705 0 0 1
+ 9686.73449521071 458.776554233778 2928.20585649318 0 0 0.999999999973256
+ 8830.72947606912 -567.918395077889 1557.9658792304 0 0 0.999999997673031
+ 8437.07558246229 757.277782498222 2527.69806658551 0 0 0.999999999998907
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 426.231900003313 0 0 1
+ 10000 0 1263.61726342425 0 0 1
+ 9999.99999999995 0 885.105817478564 0 0 1
+ 9999.99999999999 0 300.691230298131 0 0 1
+ 9999.99999999995 0 649.31615017137 0 0 1
+ 10000 0 100 0 0 1
+ 8713.69442385972 623.33674818073 2435.4938176512 0 0 1.00000000000051
+ 9999.99999999998 0 331.903125584422 0 0 1
+ 9999.99999999998 0 581.938314318426 0 0 1
+ 9956.87311548465 -91.2584010550117 764.49931989945 0 0 0.999999999998932
+ 9999.99999999999 0 846.612649085245 0 0 1
+ 8771.17232304159 315.772306422905 2026.26020192535 0 0 0.999999999999171
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 916.190314926472 0 0 1
+ 10000 0 1641.66912005239 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 178.017362541876 0 0 1
+ 9999.99999999994 0 660.97399759322 0 0 1
+ 9999.99999999999 0 666.467176333171 0 0 1
+ 10000 0 1590.47496970362 0 0 1
+ 9999.99999999999 0 588.332527609347 0 0 1
+ 9999.99999999999 0 548.976012985797 0 0 1
+ 9999.99999999994 0 732.926728868033 0 0 1
+ 9999.99999999998 0 235.257151215049 0 0 1
+ 10000 0 5512.37903800181 0 0 1.76598492290372
+ 10000 0 100 0 0 1
+ 9941.07060196184 -317.47927305394 3037.71471781633 0 0 0.999999999999842
+ 10000 0 998.332967454534 0 0 1
+ 10000 0 953.391366045768 0 0 1
+ 9795.09480647144 121.173119940654 1804.71173408253 0 0 1.00000000001851
+ 8348.60120400117 -933.008909590578 2620.75476166252 0 0 0.999999999997191
+ 10000 0 431.115097661825 0 0 1
+ 10000 0 6558.11208002923 0 0 1
+ 10000 0 2157.40471089604 0 0 1
+ 8947.91183840298 -782.47821826952 1574.55562067382 0 0 0.999999999963069
+ 9743.55970097742 43.2778226934415 1538.14562085516 0 0 0.999999999999257
+ 10000 0 2006.30559663922 0 0 1
+ 10000 0 2631.41690886281 0 0 1
+ 7034.04212210932 -71.6942773796492 4035.1197587857 0 0 1.00000000001046
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 323.706447588201 0 0 1
+ 10000 0 317.149512989527 0 0 1
+ 9999.99999999999 0 227.521004337561 0 0 1
+ 9999.99999999998 0 817.81870013183 0 0 1
+ 9999.99999999996 0 1865.64837380831 0 0 1
+ 10000 0 752.497879810004 0 0 1
+ 10000 0 3087.75242023316 0 0 1
+ 9999.99999999999 0 517.345666630795 0 0 1
+ 9126.0589251643 -1148.90689907896 1343.16203143356 0 0 0.999999997719732
+ 9999.99999999999 0 935.4410583594 0 0 1
+ 9999.99999999999 0 740.169460627799 0 0 1
+ 8479.81411987357 -87.9109006202416 713.782997258333 0 0 1.00000000000057
+ 9352.88883478837 -732.957053377105 4683.65497230342 0 0 0.999999999540329
+ 10000 0 2921.92596096674 0 0 1
+ 9999.99999999999 0 512.168185940813 0 0 1
+ 9999.99999999999 0 2370.58435821727 0 0 1
+ 9999.99999999999 0 461.504741147948 0 0 1
+ 9999.99999999999 0 1438.31331737723 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2025.75766649253 0 0 1
+ 9999.99999999995 0 364.705731973054 0 0 1
+ 9999.99999999999 0 691.072375789045 0 0 1
+ 9261.63425515362 303.459475403535 1801.71353390813 0 0 0.999999999252932
+ 9999.99999999996 0 481.416114069475 0 0 1
+ 9999.99999999996 0 1884.1136182767 0 0 1
+ 10000 0 865.19301421246 0 0 1
+ 10000 0 2438.68165941539 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2239.81224662448 0 0 1
+ 9984.18509343057 -48.2216101866158 711.251577903875 0 0 1.00000000000219
+ 10000 0 504.696254417128 0 0 1
+ 10000 0 100 0 0 1
+ 6770.24105620787 1134.36880762895 4839.91549588569 0 0 0.999999999999508
+ 10000 0 107.087722805796 0 0 1
+ 9999.99999999998 0 835.294532274809 0 0 1
+ 10000 0 1200.04314192904 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 771.812720231311 0 0 1
+ 9999.99999999999 0 1681.35889738675 0 0 1
+ 10000 0 2070.37653200653 0 0 1
+ 10000 0 105.349366203726 0 0 1
+ 10000 0 10000 0 0 10000
+ 10000 0 193.508231552779 0 0 1
+ 10000 0 1077.89336682318 0 0 1
+ 9593.87713221146 178.69566866661 998.495287692531 0 0 0.999999999920724
+ 9999.99999999999 0 1509.71573844734 0 0 1
+ 10000 0 2217.70778401704 0 0 1
+ 7895.83577999551 59.8079418456905 7860.36234614594 0 0 3.92118419764045
+ 9999.99999999999 0 493.887549102962 0 0 1
+ 10000 0 292.697500149977 0 0 1
+ 10000 0 101.683972629594 0 0 1
+ 10000 0 1301.45079780122 0 0 1
+ 10000 0 2535.73355751715 0 0 1
+ 7177.83056759736 674.80878923031 3594.2398619599 0 0 0.999999999998416
+ 9999.99999999999 0 2110.83208826673 0 0 1
+ 9429.28597908286 647.910016916832 1139.24226488059 0 0 0.999999997752436
+ 10000 0 100 0 0 1
+ 10000 0 1368.77471794482 0 0 1
+ 10000 0 105.420937744911 0 0 1
+ 10626.3652123383 1077.78075949876 6682.32890880906 0 0 3.92118417644316
+ 10000 0 186.38986102296 0 0 1
+ 9999.99999999998 0 1693.50684282026 0 0 1
+ 8961.81775348449 -205.184909325109 2097.84712958625 0 0 1.00000000000508
+ 7492.60579805416 -1045.34403508674 2239.02424103893 0 0 0.999999998329137
+ 9999.99999999995 0 489.393366591766 0 0 1
+ 10000 0 104.735672425398 0 0 1
+ 10000 0 1035.82149043829 0 0 1
+ 9999.99999999999 0 1941.2987733162 0 0 1
+ 9999.99999999999 0 2215.08833702431 0 0 1
+ 9999.99999999995 0 676.285361725725 0 0 1
+ 9814.20360470598 180.184827076193 552.988537228096 0 0 0.999999997539544
+ 8524.95441875012 121.792378933927 1613.34734904535 0 0 1.00000000001817
+ 9999.99999999999 0 1127.38348998299 0 0 1
+ 10000 0 2063.69929995716 0 0 1
+ 10000 0 275.008288302738 0 0 1
+ 9719.63503277646 23.6147792998603 1848.01755228764 0 0 0.99999999999804
+ 9999.08488715533 -333.544388593712 1013.7940289309 0 0 0.999999999890792
+ 9675.87931266864 -79.229288015345 579.15738385548 0 0 0.999999999995904
+ 9999.99999999999 0 344.695150209415 0 0 1
+ 9999.99999999999 0 699.2913205817 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 502.014104952408 0 0 1
+ 9999.99999999999 0 1629.64086053615 0 0 1
+ 9999.99999999999 0 119.292871627612 0 0 1
+ 10000 0 5837.07667614201 0 0 1
+ 9999.99999999999 0 1074.2876494249 0 0 1
+ 10000 0 100 0 0 1
+ 8668.12671006192 159.877293565215 1426.52847237056 0 0 0.999999999894316
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 991.687192102849 0 0 1
+ 10000 0 3095.20057777374 0 0 1
+ 9999.99999999995 0 516.596136153031 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 450.892514037227 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 5710.9733917296 0 0 3.92118419762768
+ 7666.14804691037 491.122468893397 2656.51949768607 0 0 1.00000000001925
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 598.212520133616 0 0 1
+ 10000 0 1703.0300222582 0 0 1
+ 7901.19824469621 228.959604310914 4270.74977206782 0 0 0.999999999999641
+ 8747.12550448728 1481.0133891141 3350.94399531618 0 0 0.999999999988588
+ 9999.99999999999 0 756.676671026621 0 0 1
+ 9999.99999999998 0 1920.50633192187 0 0 1
+ 9999.99999999999 0 1596.83695996897 0 0 1
+ 10000 0 196.016088764228 0 0 1
+ 10000 0 131.444972824771 0 0 1
+ 10000 0 1773.90121569345 0 0 1
+ 9999.99999999999 0 3340.29998415606 0 0 1
+ 10000 0 113.598415127769 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1641.11372204736 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1453.4016526001 0 0 1
+ 7239.48005251659 369.817753776836 1993.2343873557 0 0 1.00000000000279
+ 9999.99999999999 0 1332.08393893625 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 791.143310904644 0 0 1
+ 6350.5219458341 -148.682460276336 6657.36722899394 0 0 1.00000000000681
+ 9999.99999999999 0 1744.38274536257 0 0 1.76598492290372
+ 10000 0 201.459687711412 0 0 1
+ 10000 0 1526.19029629496 0 0 1
+ 9329.50946463875 -287.688132683129 1300.78755498658 0 0 1.00000000000012
+ 8224.01348381983 781.373567684581 1876.14462157225 0 0 0.999999999974235
+ 10000 0 435.620609456182 0 0 1
+ 10000 0 1648.65174471295 0 0 1
+ 10000 0 1435.28465359329 0 0 1
+ 9999.99999999999 0 758.642433381022 0 0 1
+ 10000 0 418.000456212152 0 0 1
+ 9999.99999999999 0 453.266810255499 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 169.910958233959 0 0 1
+ 9999.99999999996 0 1749.50464372562 0 0 1
+ 9999.99999999999 0 440.278563245917 0 0 1
+ 10000 0 667.700971882628 0 0 1
+ 9999.99999999999 0 813.808357725726 0 0 1
+ 10085.8315317661 0 2623.3996967617 0 0 1
+ 10000 0 798.551326492769 0 0 1
+ 10000 0 100 0 0 1
+ 7265.65204731335 -204.681804479541 3420.10823258129 0 0 0.999999999796898
+ 9999.99999999999 0 106.474342097405 0 0 1
+ 9999.99999999998 0 1508.87141990868 0 0 1.76598492290372
+ 9999.99999999995 0 483.629679136261 0 0 1
+ 9999.99999999999 0 467.599807601129 0 0 1
+ 10000 0 3093.37885474308 0 0 1
+ 10000 0 1563.42237143632 0 0 1
+ 9999.99999999999 0 354.546598709713 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 665.222136594334 0 0 1
+ 9999.99999999999 0 205.030175339051 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2830.7390235702 0 0 1
+ 9631.46170628317 -353.894638993425 1751.40659099768 0 0 0.999999999998924
+ 10000 0 183.978736841637 0 0 1
+ 9999.99999999999 0 1107.26885554251 0 0 1
+ 10000 0 1488.74916498667 0 0 1
+ 9999.99999999999 0 440.09535861321 0 0 1
+ 10000 0 100 0 0 1
+ 9694.35538708677 -105.189913749325 731.836211457588 0 0 1.00000000000247
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 5968.92836564937 0 0 3.92118419762768
+ 10000 0 100 0 0 1
+ 10000 0 1645.1624855895 0 0 1
+ 10000 0 4833.54622446021 0 0 1
+ 10000 0 792.615781223602 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 744.683507283018 0 0 1
+ 10000 0 759.630431756585 0 0 1
+ 9999.99999999999 0 817.985749895919 0 0 1
+ 10000 0 2474.97324336772 0 0 1
+ 10000 0 2164.17818512381 0 0 1
+ 10000 0 1277.7238130743 0 0 1
+ 10000 0 4677.29254831417 0 0 1
+ 10000 0 10000 0 0 10000
+ 9999.99999999995 0 405.348097758425 0 0 1
+ 9518.71796841855 -144.454479650873 2598.71725304879 0 0 0.999999999179394
+ 9907.35626241089 -393.493725745882 4962.57672410625 0 0 1.00000000000047
+ 10000 0 10000 0 0 10000
+ 7010.0787955792 665.072455627971 6290.08414887671 0 0 1.00000000000123
+ 10000 0 10000 0 0 10000
+ 10000 0 10000 0 0 10000
+ 7874.06337587153 487.525818070581 8459.52616250404 0 0 0.999999999999582
+ 10000 0 10000 0 0 10000
+ 8675.68415759252 -2142.00507709871 1645.92824297235 0 0 0.999999999952164
+ 8329.47706523468 -1703.67280430423 4044.73278632157 0 0 0.999999999998817
+ 6656.41507299398 -1802.38037026816 4420.27918189843 0 0 0.999999999998895
+ 8805.60624151401 -668.216614419501 7624.39276078809 0 0 3.92118419762584
+ 10000 0 10000 0 0 10000
+ 9506.80397320872 775.79236315739 5575.54259497431 0 0 0.999999999981563
+ 6446.20036884183 -807.451225561703 5762.00487822021 0 0 0.999999999999098
+ 10000 0 10000 0 0 10000
+ 10000 0 251.726796232616 0 0 1
+ 10000 0 1118.97574855809 0 0 1
+ 7007.83530394795 33.3163714941496 6979.51194666003 0 0 0.99999999999874
+ 9940.72088964638 524.015825996912 506.408467237179 0 0 1.00000000000001
+ 10000 0 100 0 0 1
+ 6854.11214099776 -2144.75373391404 3753.00582568206 0 0 0.999999998602068
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 250.952218952543 0 0 1
+ 7901.37742737555 -2898.66943414099 3488.01617949771 0 0 1.00000000000021
+ 9999.99999999999 0 537.942400252791 0 0 1.3023986520174
+ 9209.74670070084 -1763.72601188491 1194.29598311117 0 0 1.00000000000019
+ 9138.08296345486 -975.893052040229 11362.3020834156 0 0 0.999999998359143
+ 6170.92497656987 -1175.85835881257 6007.79965383095 0 0 1.00000000000035
+ 7766.03242664823 -1818.40756667377 4178.03448357296 0 0 0.99999999999829
+ 10058.7880197654 196.768551795993 1305.47562861894 0 0 0.999999999905742
+ 5376.95061721552 464.658246169752 5348.3585400098 0 0 0.999999999999303
+ 9999.99999999999 0 1223.84745460963 0 0 1
+ 8191.33751922032 2182.95288838073 2623.85030713507 0 0 1.00000000000035
+ 9320.09099159652 1311.57017868511 3265.77482717637 0 0 0.999999999999553
+ 7622.79260427459 2473.06724666943 2477.20739572544 -2.48979005098216e-14 6.18834360956512e-14 0.999999999975293
+ 5981.61530970326 1262.07604515491 4999.55415886747 0 0 0.999999999999973
+ 9521.05188534812 -727.033220550605 5812.21232203384 0 0 0.999999999973926
+ 10000 0 10000 0 0 10000
+ 6001.21244345746 -1353.75732451563 4901.63185055058 0 0 1.00000000000054
+ 10000 0 10000 0 0 10000
+ 10000 0 10000 0 0 10000
+ 9301.38686362186 -969.750060433414 5223.12511080121 0 0 1.00000000000038
+ 10000 0 2466.47558535961 0 0 1
+ 5093.71943222848 -463.141231997965 5006.28056777151 -2.13504423896881e-13 -2.34592091611006e-13 1.00000000000625
+ 6990.96390542989 -650.03457428575 6637.50390390206 0 0 1.00000000064159
+ 9978.89636018127 -272.694637104468 2066.31866913551 0 0 0.999999999972759
+ 9999.99999999998 0 814.031822368049 0 0 1
+ 6292.33516198596 1987.22719470256 5086.20142826267 0 0 1.00000000000041
+ 10000 0 10000 0 0 10000
+ 9320.14301899532 -1322.30416418892 3201.8989682927 0 0 0.999999999999565
+ 10000 0 10000 0 0 10000
+ 7461.76479249549 -2506.12165894027 2735.51103844591 0 0 0.999999999999167
+ 6335.68992158217 -129.174716876814 6260.53601890085 0 0 1.00000000001398
+ 9999.99999999994 0 656.881085233952 0 0 1
+ 5300.03480097102 -1084.04560010636 4799.96519902897 1.13058804162011e-13 1.42029712143095e-13 1.0000000000001
+ 10000 0 523.02407414045 0 0 1
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 493.727160668189 0 0 1
+ 9999.99999999999 0 1283.11664326685 0 0 1
+ 8291.99694134071 424.331952310356 2413.80937980167 0 0 0.999999999487486
+ 9513.6835136424 532.97657241906 6951.92748813181 0 0 0.999999999998181
+ 8996.43920642596 1212.9794902721 4841.71459003133 0 0 0.999999999659232
+ 5531.83284357436 1467.27968927063 4568.16715642565 -2.39453423108965e-14 3.31096091212396e-14 0.999999999998866
+ 8465.08709210945 -1858.06325063549 3311.27843158251 0 0 1.00000000000022
+ 5914.41940423311 -1240.47925597521 4991.17834788643 0 0 0.999999999707405
+ 9992.52221348449 -181.52321262301 831.469080249512 0 0 0.999999999801409
+ 8833.64673206785 191.353381400596 1729.41096090356 0 0 0.999999998984057
+ 6392.52688173584 86.8952679107434 6340.98734630028 0 0 1.00000000000441
+ 5862.52600871465 1833.52262824861 4237.47399128536 -1.52080843483473e-13 2.3380376758431e-13 0.999999999986011
+ 7570.37336129431 1893.57645164624 4086.35611412063 0 0 1.00000000000005
+ 9602.98185509623 1318.48173998914 732.133347274417 0 0 1.00000000000036
+ 9985.10427928508 -258.501942429993 720.135574133626 0 0 0.999999999925106
+ 7123.55890751732 -2316.1910929069 3279.01876289588 0 0 1.00000000000059
+ 9827.51473579711 56.7078191552383 720.166338076515 0 0 0.999999999844859
+ 10000 0 10000 0 0 10000
+ 9485.9866610168 -630.802880248561 6484.9088275303 0 0 0.999999999998804
+ 7895.6340734394 34.7718995923488 4015.33611935168 0 0 1.00000000000221
+ 5913.73050004358 -1372.9360918717 4840.93665286921 0 0 0.999999999999661
+ 10000 0 100 0 0 1
+ 8714.11608038251 -1811.1502051203 2968.26307326584 0 0 0.999999999991216
+ 7332.37890664177 280.054289189039 7595.4739279873 0 0 0.999999999310462
+ 7806.91762977864 2458.8915083871 2293.08237022217 -1.09314265035281e-13 2.86818558379795e-13 0.999999999186235
+ 6454.72579263284 -962.308219803763 6568.00650908058 0 0 1.00000000000036
+ 5221.55575010747 -905.411280930951 4878.44424989254 -3.33920918974724e-13 2.76504652363686e-13 1.00000000000237
+ 9052.93801315066 1719.07151295549 2277.76669782298 0 0 0.999999999999403
+ 9209.93294332532 -1129.27277246638 4696.44174005316 0 0 1.00000000000037
+ 5061.26883750358 235.910489262171 5038.73116249642 1.36708524962896e-13 1.30336239080435e-13 1.00000000000213
+ 5649.3183816195 -1482.04763260977 4795.80139042737 0 0 1.00000000002661
+ 10000 0 100 0 0 1
+ 8425.44118493314 497.513803626267 6683.59999618265 0 0 2.52955428534209
+ 9859.58910496463 -726.838332318907 1678.42181409443 0 0 0.999999985858142
+ 5647.30655266556 -1612.41815849268 4452.69344733453 -1.9024886510935e-13 1.32438436484957e-13 0.999999999911502
+ 9999.99999999999 0 323.6912651405 0 0 1
+ 10000 0 100 0 0 1
+ 8106.73052074637 2405.66302736526 1993.26947925363 -3.78395532814167e-14 1.09314265035204e-13 0.999999999999489
+ 6168.79171556529 1878.23158610076 4236.03312517245 0 0 1.00000000000022
+ 7168.61822786363 2353.8499668969 3165.0859919299 0 0 1.00000000000003
+ 9328.35684868151 -1494.62751310552 2092.85459534072 0 0 0.999999999997093
+ 6813.06487638493 -2370.39519484899 3286.93512361507 -2.26643157675152e-14 -4.51315505283564e-14 1.0000000000001
+ 9446.69892746942 -569.092420526596 1347.44310194124 0 0 0.99999999880907
+ 6260.64006105762 -1277.28308586109 5108.13154818496 0 0 0.999999999948347
+ 10000 0 182.017784078974 0 0 1
+ 6615.57575045593 -1440.33646714018 5008.68575915395 0 0 1.00000000000025
+ 6380.49382299236 -688.04591546375 5843.16178844013 0 0 1.00000000000041
+ 9999.99999999999 0 1159.11434811665 0 0 1
+ 8165.20253938318 1111.15740006265 5860.08193046147 0 0 0.999999999978548
+ 8246.60308631197 -192.364397603941 3082.00838739076 0 0 1.00000000000035
+ 6770.57192896216 594.342661093243 6214.1372954079 0 0 0.999999999437941
+ 7340.39594562251 -2781.66225355753 4522.53793703483 0 0 0.999999999999743
+ 9017.50997440939 -31.027621419862 1966.5906483334 0 0 1.00000000000313
+ 5318.29049628315 -183.408421577589 5285.8406420055 0 0 1.0000000000431
+ 9494.01984211328 227.769329854432 441.650722723511 0 0 0.999999999923642
+ 5329.25192728811 1142.0662858092 4770.74807271189 4.84819276418151e-13 3.80563423887581e-13 0.999999999999795
+ 9999.99999999999 0 1266.75791528353 0 0 1
+ 5755.6328981419 487.098245371195 5625.58834691254 0 0 0.999999999999955
+ 6714.35260578193 -1249.49305111189 5328.79281595196 0 0 0.999999999999282
+ 7734.50897441741 1912.54766829719 3947.98758527127 0 0 0.999999999998082
+ 9874.80993916656 714.497538758354 1242.02713760371 0 0 0.999999948826083
+ 7593.70852348004 1911.88574565828 4029.29374924512 0 0 1.00000000000007
+ 9002.88722506007 1898.5641586365 1560.732128153 0 0 0.999999999999491
+ 10000 0 10000 0 0 10000
+ 8143.64740115204 2396.43493403176 1956.35259884796 -5.27684395369756e-14 1.54248734556886e-13 1.00000000000009
+ 8316.5421335933 -1291.88879404442 5323.41164125318 0 0 0.999999996729367
+ 9999.99999999999 0 770.993165426234 0 0 1
+ 6712.01378715414 1709.84029849211 4587.03603722672 0 0 0.999999999998927
+ 5305.38077154188 1094.94999002648 4794.61922845812 2.97329545402243e-13 -3.7465099368736e-13 1.00000000000031
+ 6401.2064287995 -1746.94619270083 4480.6975930348 0 0 1.00000000000025
+ 10000 0 10000 0 0 10000
+ 8476.68833804259 94.3736456728374 2057.4813350425 0 0 1.00000000000241
+ 9241.19383847946 -608.747050963168 7007.4694040878 0 0 0.999999993923844
+ 9999.99999999999 0 1900.67134014067 0 0 1
+ 7205.35628320351 1220.1482670648 6474.3019487029 0 0 1.0000000000021
+ 10000 0 100 0 0 1
+ 5059.46890964851 -216.290181261926 5040.53109035147 3.10074117167148e-13 -2.96738302382236e-13 1.00000000002261
+ 9223.41133110028 -1449.8257296821 2955.66373819232 0 0 1.00000000000038
+ 9999.99999999999 0 666.76521785745 0 0 1
+ 5545.33214452489 -1485.44275621735 4554.6678554751 2.35511802975484e-14 3.25840597701088e-14 0.999999999999089
+ 7146.83027819901 401.973829987747 2944.87481617823 0 0 1.00000000000006
+ 5548.88457293461 619.50357869096 5292.43282243785 0 0 1.00000000000086
+ 6448.59460626651 116.57087511066 6512.56014329279 0 0 1.00000000040614
+ 5100.48505425604 -477.862763068552 5006.64051685909 0 0 1.00000000000382
+ 9672.30914767321 165.016390266295 1176.50518577894 0 0 0.999999999689409
+ 7694.40613644413 -2067.97146513517 3557.04183674394 0 0 0.999999999995828
+ 6936.88653597361 1934.55803611173 4167.3112841685 0 0 0.999999999093999
+ 9671.15577916528 790.651658834532 4442.09455541285 0 0 0.999999999999859
+ 8763.19339267808 -1043.34126226647 5806.42629960494 0 0 0.999999999999906
+ 9155.88387352158 -1450.29927372683 3251.23349605514 0 0 1.00000000000018
+ 9561.10354857169 618.933292201811 6315.03560064185 0 0 0.999999999916268
+ 8909.69445312873 647.466014715766 4956.58055656705 0 0 0.99999999999987
+ 5536.61885487057 650.911189155553 5272.07596421346 0 0 0.999999999999384
+ 10000 0 10000 0 0 10000
+ 6090.2178877354 145.749699919178 4129.32229001162 0 0 0.999999999755449
+ 9999.99999999998 0 260.016728888914 0 0 1
+ 10000 0 482.772423245189 0 0 1
+ 6389.03716660895 2107.24503710168 3875.1719310402 0 0 1.0000000000001
+ 9036.42430141714 282.988764954836 1065.32549355308 0 0 0.999999995463742
+ 6661.10240059979 2326.31747424313 3500.48272627765 0 0 0.99999999991879
+ 9685.80522863273 11.2251218250569 1033.44303052872 0 0 1.76598492290318
+ 5936.35163001256 -272.438657089633 5879.56843780128 0 0 1.00000000000049
+ 10153.4223419853 0 10153.4223419853 0 0 10153.4223419853
+ 7183.59820152415 1401.0920718993 3146.94834816268 0 0 0.999999999956216
+ 6758.32950666769 -2353.26185424574 3341.67049333398 -7.83725469874624e-14 -1.53788878874755e-13 0.999999998329249
+ 5183.43653978233 -54.0205162685132 5179.38555004475 0 0 1.00000000000046
+ 8052.99261781009 -1520.68363337808 4819.30932979371 0 0 0.999999999928503
+ 9999.99999999996 0 277.223071076526 0 0 1
+ 5253.23056535717 -982.185642240115 4846.76943464282 4.55914062105958e-14 5.59710058954289e-14 0.99999999999977
+ 6171.49409983703 1364.33326003983 4960.09008254596 0 0 0.999999999982501
+ 6232.06540781177 -2110.43719175034 3867.93459218823 1.27018708801422e-13 2.16657720003667e-13 0.999999999999789
+ 9110.64718490752 -1494.62181158731 3200.64547561286 0 0 0.999999999999431
+ 7920.37834349857 2390.28175803665 2352.20757109453 0 0 0.999999995903297
+ 9673.77399231504 -1169.17517003204 1013.90390488692 0 0 1.00000000000047
+ 8870.64418756139 -314.546566657803 851.490973060953 0 0 0.999999999999938
+ 7546.02274015772 -1461.16725852182 8410.81327201961 0 0 1.00000000000368
+ 9496.52908776873 -1131.71176988782 3323.29759141372 0 0 0.999999999589101
+ 8054.47701943111 1458.06349641412 9397.54968890424 0 0 0.999999999793394
+ 9999.99999999999 0 939.520926688345 0 0 1
+ 9999.99999999995 0 204.491893716198 0 0 1
+ 6135.60277478614 971.841724314522 5397.99398514617 0 0 0.999999999997962
+ 9763.47523173488 -1776.0647596879 1770.21777959577 0 0 3.92118419762405
+ 10000 0 10000 0 0 10000
+ 10383.1985582396 568.872910698867 3899.44637876236 0 0 0.999999982012054
+ 9384.26990631481 -1300.00528383299 2967.96219548667 0 0 0.999999999993887
+ 9989.3099458479 15.3128788029406 562.016693436321 0 0 0.99999999891192
+ 5566.04031985979 -1512.64733880206 4533.95968014022 2.42015476195728e-13 3.38191007452662e-13 0.999999999999921
+ 6498.22400405539 2109.72052277521 5319.94871518215 0 0 1.00000000015895
+ 9877.88187629905 745.513678368291 594.149678005956 0 0 0.999999999999985
+ 9806.39711559361 -922.732515076306 777.447851657111 0 0 0.999999999389952
+ 5749.32050608808 557.775520079692 5485.19750752414 0 0 0.999999999999732
+ 6341.22367921577 -1674.33291577006 5932.30587142799 0 0 0.999999999999174
+ 8953.51395824396 3877.75243090218 5771.52760115607 0 0 0.999999999999752
+ 8938.07253208816 1878.64530727262 1943.3161999225 0 0 0.999999989286817
+ 9990.77023597495 210.215500390401 313.893212816147 0 0 0.999999999837042
+ 9393.49138385635 1301.2286249906 2901.38543412453 0 0 0.999999999991103
+ 5135.06643539437 -643.305958911753 4964.93356460563 4.9250543567844e-13 -4.3167309828505e-13 1.00000000000013
+ 7266.33251677019 2307.57552090023 3221.9554133787 0 0 1.00000000000002
+ 8084.36845054621 590.339803004181 8859.10939379824 0 0 0.999999999985358
+ 6065.76415402479 1449.50631970917 4809.99711464563 0 0 0.999999999997438
+ 8188.95875341894 214.619805774732 1948.24874584942 0 0 0.999999999677003
+ 9482.61684562348 -1262.42050719146 2511.05034778213 0 0 0.999999999338847
+ 9848.12269256014 -831.901206227477 576.461105069837 0 0 0.999999988354814
+ 9055.58962742275 -585.378310302848 7215.92775228843 0 0 0.999999999994058
+ 9896.19613824699 695.977979505625 445.029992841909 0 0 1.00000000000052
+ 8509.98935390811 513.861450335273 8024.83985147075 0 0 0.999999999078133
+ 8510.85764959935 -1908.9835752528 3034.39657411413 0 0 0.999999999999778
+ 9541.80920288625 -1367.95595396139 1111.99014319542 0 0 0.999999999999419
+ 10000 0 100 0 0 1
+ 8107.78252807729 -1585.61848762993 4606.01233618787 0 0 0.999999999586094
+ 9915.62965679309 -527.230190250996 2374.23653746296 0 0 1.00000000000036
+ 10000 0 10000 0 0 10000
+ 9758.33601869893 3522.5049480406 5087.04286107718 0 0 0.999999999976686
+ 7729.34271285959 -1720.8189506495 4447.24874971524 0 0 0.999999999999922
+ 6932.4880996474 2176.95902798623 3665.8121065727 0 0 0.999999999999849
+ 7866.30419595173 -1024.61106491863 6055.08851842031 0 0 0.999999999999083
+ 9031.68566156805 3007.11744855168 11756.40236671 0 0 0.999999999929772
+ 8635.32810113465 -2156.52805043959 1709.14843072729 0 0 0.999999999983645
+ 6154.32666081987 2060.79586501448 3945.67333918013 1.05109870226157e-14 -1.76059032628814e-14 0.999999999999932
+ 9932.48764689154 557.245909736935 547.773833562654 0 0 0.999999999999907
+ 9999.99999999995 0 877.580935062332 0 0 1
+ 6141.06208506988 -1375.17214810467 4767.16911825883 0 0 1.00000000000347
+ 9999.99999999999 0 353.391850320637 0 0 1
+ 6468.16953526329 288.42885673317 6267.91347015936 0 0 1.00000000000053
+ 10000 0 10000 0 0 10000
+ 8267.02286599425 2093.46242637635 9880.95126493336 0 0 0.999999999999728
+ 8252.24900437659 -3315.58469479924 4690.28277991986 0 0 0.999999999999767
+ 9213.61883751217 223.94450242329 719.585710257977 0 0 1.00000000007798
+ 6861.38381627304 2384.37382989658 3238.61618372696 -9.26937668056926e-14 1.86767100658103e-13 1.0000000000004
+ 9997.75694623711 -104.250768252436 239.202762450305 0 0 0.999999999596491
+ 10000 0 5876.62320846759 0 0 3.92118419762768
+ 9999.99999999998 0 661.046134817419 0 0 1
+ 6866.50510585751 -1311.19971019185 5284.57511283246 0 0 1.00000000000047
+ 7979.62099386014 1308.12736976738 5398.24255946489 0 0 0.999999999998342
+ 10000 0 10000 0 0 10000
+ 7961.34474006846 1295.36422060208 5433.1109198287 0 0 0.999999999999249
+ 6154.23142386374 2060.73251798417 3945.76857613626 1.68471413871863e-13 -2.81365983861645e-13 0.999999999999662
+ 9999.99999999999 0 157.261429772273 0 0 1
+ 9684.82790949981 1092.25365001039 1579.8425504479 0 0 0.999999999999685
+ 8232.58080336062 -2513.08375407667 2522.92296331655 0 0 0.999999998566163
+ 7282.45766535317 -2397.76779628358 2985.15818463012 0 0 0.999999999999533
+ 6732.20575737992 290.482916119696 6494.11470960201 0 0 0.999999999999809
+ 5668.47744025501 782.726962284101 5268.19620449674 0 0 0.999999999999448
+ 9693.26882756164 -97.870224366385 670.022171015323 0 0 0.99999999999979
+ 9999.99999999999 0 246.6523176975 0 0 1
+ 6489.31072086886 -790.729347467801 5807.58116815053 0 0 0.999999999998361
+ 9999.99999999995 0 336.583258742727 0 0 1
+ 9848.76882647073 792.25387768364 1132.03868498528 0 0 0.999999991012642
+ 7729.01443346248 -2046.34633060961 3589.85470065446 0 0 0.999999999995297
+ 5882.56403749751 -1121.84123704121 5100.35336248573 0 0 0.999999999999688
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 676.318651283301 0 0 1
+ 7418.10575199646 368.745278306418 2387.8312711869 0 0 0.999999992829838
+ 9998.7519423441 -74.8215039543708 725.606811852781 0 0 0.999999999542636
+ 7564.57254658372 -663.892023726094 2867.85992136106 0 0 1.00000000000052
+ 9999.99999999995 0 276.456487583515 0 0 1
+ 9999.99999999998 0 223.633389967039 0 0 1
+ 7447.6009728467 739.820059132628 6438.71724391806 0 0 0.999999999903565
+ 10000 0 100 0 0 1
+ 7290.87259549082 1021.02688945603 7596.11350474922 0 0 1.00000000000077
+ 10000 0 317.619590397711 0 0 1
+ 9999.99999999995 0 310.267625056287 0 0 1
+ 5799.75524326972 1774.58601633583 4300.24475673029 2.50949815164951e-14 -3.77738596125253e-14 0.999999999999998
+ 9748.11278513776 1004.19191285735 1298.83257376352 0 0 0.999999999993207
+ 9957.67993991349 422.780762678718 1070.38930912609 0 0 0.999999999997937
+ 8078.17428564872 -2412.38952279623 2021.82571435128 -3.9317660831472e-14 -1.12500407976434e-13 1.00000000000026
+ 9997.86048602506 -36.103168987739 691.907303634696 0 0 0.999999999771271
+ 6580.70029487238 484.286618977138 3617.13510296495 0 0 0.999999999997914
+ 6263.62176802096 -734.21316849866 6119.35476825142 0 0 1.00000000000106
+ 7023.64667016665 622.514341822946 998.276549273544 0 0 0.999999999267815
+ 9999.99999999999 0 1583.03570437228 0 0 1
+ 9304.41562370169 1653.61740479223 1235.8986669733 0 0 0.999999999997191
+ 8971.47038448269 -1837.22116340991 2015.30757326768 0 0 0.999999999999991
+ 9626.94778701643 -650.536606183725 1760.57122523425 0 0 1.30239865154682
+ 5653.07508350078 1619.1115177738 4446.92491649959 -3.02190876900268e-14 4.34892088060752e-14 0.999999999634354
+ 10000 0 443.877142960664 0 0 1
+ 6949.51821256791 985.200812435909 6025.00162861673 0 0 0.999999999354006
+ 7244.36558664892 -2157.51545945325 3596.6680589845 0 0 1.0000000000004
+ 7297.3404571114 1162.54846969921 5659.63267697467 0 0 0.99999999956003
+ 8788.17997660544 473.276987578163 3287.39324497362 0 0 1.00000000000079
+ 7411.4187812422 -1965.17060651617 3981.46674438772 0 0 1.00000000000071
+ 9999.99999999999 0 1169.54882435674 0 0 1.13626225643042
+ 5818.09610252638 -1105.80754636634 5080.98444113578 0 0 1.00000000000024
+ 9999.99999999999 0 818.36141858802 0 0 1
+ 10000 0 10000 0 0 10000
+ 9647.32842579319 832.845098457679 4319.54119244396 0 0 0.999999999999712
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 5549.08789658535 0 0 3.92118419762769
+ 9272.78513103011 -1118.76434826299 4545.25231541389 0 0 1.00000000000006
+ 9794.29062821111 -793.500604592509 2669.44364491467 0 0 0.999999999944709
+ 9999.05958786059 -65.5270436987614 616.471260907373 0 0 0.999999999523369
+ 9999.99999999998 0 1240.43504600732 0 0 1
+ 9999.99999999995 0 1078.80547765988 0 0 1
+ 10000 0 10000 0 0 10000
+ 8642.03009063581 2208.58977101093 1457.96990936423 -6.30166518840285e-14 2.22800078045016e-13 0.999999999969076
+ 9999.99999999996 0 829.711701268837 0 0 1
+ 7585.87377873157 2455.85239427561 2567.23547314237 0 0 0.999999999989577
+ 7619.33316564127 -2818.19697759829 3689.77028934016 0 0 0.999999999724369
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 205.529983469867 0 0 1
+ 9404.82627468488 220.389678109532 2901.41254102622 0 0 0.999999999999958
+ 9588.98531064962 1118.46769451161 2609.18706619482 0 0 1.0000000000006
+ 5379.23974410703 1233.42528117033 4720.76025589298 -2.43066574897989e-15 -1.83942272895775e-15 0.999999999998732
+ 5534.78001597961 220.242988745892 5559.42475262586 0 0 1.00000000000119
+ 9415.43940460629 1564.02560443146 929.310588665422 0 0 0.999999999667166
+ 5923.82675287477 -1887.29150707813 4176.17324712552 1.26000456933627e-13 1.9714670034295e-13 0.999999999711055
+ 8090.6388469309 1439.13855710176 5022.61509029709 0 0 0.999999999918773
+ 9999.99999999999 0 382.253774458974 0 0 1
+ 9863.26923844828 -1981.16947189476 946.929021239028 0 0 0.999999999999845
+ 5373.17487093841 1222.81381000505 4726.82512906159 -3.26924543237795e-13 4.24512488375893e-13 0.999999999999792
+ 10000 0 2169.30222146669 0 0 1
+ 6093.36080978041 1354.17604209364 4940.52291246143 0 0 0.999999999999796
+ 10000 0 100 0 0 1
+ 8677.45295075107 -2190.31440581143 1422.54704924901 -6.14235804134168e-15 -2.2073072747495e-14 0.999999999926992
+ 6813.78927794779 -272.369248664995 6581.21401609833 0 0 0.999999999999032
+ 10000 0 589.438499789929 0 0 1
+ 10000 0 10000 0 0 10000
+ 12045.0459922999 -2368.26290045128 985.543208492812 0 0 0.999999999999028
+ 6341.05022396489 1516.41432891758 5472.82773569807 0 0 1.0000000000385
+ 7488.76595468215 1184.90201006176 6060.78924125944 0 0 0.999999999999391
+ 9999.99999999999 0 129.263952027592 0 0 1
+ 10000 0 10000 0 0 10000
+ 8409.90196753402 2311.4007674686 1690.09803246598 -8.21170861141855e-16 2.69344042454529e-15 0.999999999999645
+ 8936.41607212237 -1679.62633305209 2913.09078659196 0 0 0.999999997584656
+ 6637.42142648035 1571.15757536581 4894.2034855671 0 0 0.999999999999771
+ 5563.12077790281 -1508.85881311119 4536.87922209719 -8.57630847376554e-14 -1.1982525205782e-13 0.999999999999241
+ 9361.9687242519 -1076.81267075021 4427.59078408479 0 0 1.00000000000043
+ 9710.95380963218 -496.744278250896 2105.58055133369 0 0 0.999999999999851
+ 10000 0 10000 0 0 10000
+ 9999.99999999998 0 949.024416248114 0 0 1
+ 9999.90336291892 21.6266077497758 247.185289136953 0 0 0.99999999946714
+ 9993.21102999916 149.178632633297 2430.43651289815 0 0 0.999999999799602
+ 9999.99999999999 0 643.73966971521 0 0 1
+ 5511.10811211208 -1438.7023541717 4588.89188788793 -2.22701537541671e-14 1.62591830506087e-14 1.00000000000074
+ 6365.12299487196 -1494.79130366623 6207.55898387851 0 0 0.999999999999066
+ 6621.23178672133 1960.62853111187 4135.9972159798 0 0 0.999999999997423
+ 6323.4449086778 -630.135573989067 3587.49879211812 0 0 1.00000000000043
+ 10219.6609740408 1961.30221176465 3642.694670742 0 0 0.999999999870108
+ 9624.58394996751 1195.72073226184 1524.67484757452 0 0 0.99999999999994
+ 7593.48088046056 -2687.48710923861 3178.49357205181 0 0 0.999999999999489
+ 5834.78544547558 -1507.30529588488 4649.19405101975 0 0 0.99999999999987
+ 9109.61701792842 1254.84144628011 4382.36749896122 0 0 0.9999999999995
+ 9987.73200730484 193.259422212581 2775.46376280218 0 0 0.999999999912274
+ 5330.394391928 939.430006742594 4926.84531860335 0 0 0.999999999999928
+ 9999.99999999995 0 801.058289155928 0 0 1
+ 6856.34554123974 -1179.39838488156 7245.38869488892 0 0 1.00000000019567
+ 9782.00689046443 734.835011784684 3556.67906487823 0 0 0.99999999999143
+ 7738.35050358221 -955.466379903468 6876.2212318554 0 0 3.92118419743244
+ 11865.7645895146 -2020.77228823479 1102.58786136762 0 0 0.999999999840902
+ 9982.90504031592 -268.802989012615 1075.28203715528 0 0 0.999999999945603
+ 9678.930629947 -1183.3688603897 781.936286362004 0 0 0.999999999999554
+ 7445.01355178178 1363.43220799473 5302.96800474183 0 0 1.00000000000045
+ 9161.33343681847 1602.09726358624 2408.18945162418 0 0 0.999999999999608
+ 7366.54494825066 -658.239311697187 6520.57703790956 0 0 0.999999999995455
+ 8188.41427682157 -2260.49219373335 2356.95183212183 0 0 0.999999999999644
+ 9830.59591580852 -737.65572784699 2460.77333416121 0 0 0.999999998968788
+ 8821.99602150587 -74.0862694633567 1590.64981363918 0 0 1.0000000000001
+ 9974.38228747466 -283.631388067054 2626.56687283881 0 0 0.9999999999878
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 1077.88359681111 0 0 1
+ 6552.6548948169 63.1822551463762 6546.74750627631 0 0 1.00000000000346
+ 8342.58881403844 -2255.75968810965 2066.73223421475 0 0 1.00000000000005
+ 7773.36667927058 -2462.50664824018 2326.63332072987 8.34966531609357e-14 2.16854801010409e-13 0.99999999955634
+ 6249.20590523793 -1959.46727194523 4118.68791317073 0 0 1.00000000000034
+ 5082.34464150943 -398.823017940818 5017.65535849014 -9.24309921300767e-14 8.52046885521186e-14 1.00000000043812
+ 12715.8983712922 2259.86541159684 1805.2458018727 0 0 0.999999999997406
+ 10000 0 10000 0 0 10000
+ 9638.8520886945 -1072.73912909663 2419.7811213944 0 0 0.999999999999686
+ 9999.99999999998 0 288.644255669603 0 0 1
+ 7029.19973468697 2213.242297849 3555.73981109056 0 0 1.00000000000013
+ 5739.15593126646 1152.94424270488 3627.46942498561 0 0 1.00000000002284
+ 9593.37826097758 -1220.31695804217 1718.22859970168 0 0 1.00000000000046
+ 6674.41555466226 991.302279799492 2807.20710867389 0 0 0.99999999999986
+ 9907.32780969427 -594.402539451806 1625.86235857223 0 0 1.00000000000035
+ 9130.19225177614 -1341.40085662894 3900.93529790893 0 0 0.999999999999298
+ 9746.01740403705 1045.59721935419 2975.45324198699 0 0 1.00000000000015
+ 9999.99999999998 0 804.816471062849 0 0 1
+ 8570.23391377345 246.317890749133 2725.34909167263 0 0 0.999999999999907
+ 9354.64198255109 1468.53290554791 2080.85994084133 0 0 0.99999999999373
+ 8197.68037510543 2056.49806566312 5064.9410238843 0 0 1.00000000000103
+ 9999.99999999999 0 232.158686797559 0 0 1
+ 9936.47519298834 538.980624727932 585.006940002973 0 0 0.999999999999311
+ 9480.28681188136 -1477.79145483579 928.641946772838 0 0 0.999999996353249
+ 8430.66710581041 -1370.41074636387 5011.7554803252 0 0 0.999999999999546
+ 9999.99999999996 0 224.041249631847 0 0 1
+ 5061.39614857685 -237.236302561207 5038.60385142316 -2.81497371199428e-13 -2.95293041666611e-13 1.00000000000123
+ 9790.52669057728 726.163095658436 6410.12061510098 0 0 0.999999999999371
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 502.577335710463 0 0 1
+ 7161.15090743538 -2113.22510398027 3733.23091902924 0 0 0.99999999999999
+ 9997.52594991997 104.01543291291 879.009133814213 0 0 0.99999999961168
+ 8994.52914389701 82.866817251946 1133.77339374513 0 0 0.999999999999935
+ 6769.0708610171 456.294601802158 6652.16196782904 0 0 1.0000000000004
+ 6075.48447347316 593.564290578434 6193.041735385 0 0 1.00000000000094
+ 5336.82305748757 -1156.50623355733 4763.17694251243 2.90168935493086e-13 -2.270373196885e-13 1.00000000000097
+ 9999.99999999995 0 641.622016503113 0 0 1
+ 10000 0 2802.99019843041 0 0 3.92118419762769
+ 8739.91561216288 1992.47239453388 2109.9309899726 0 0 0.999999999909523
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 825.715246984168 0 0 1
+ 6032.20072221034 1974.12646915811 4067.79927778965 -1.09379958704095e-14 1.76059032628814e-14 0.999999999999753
+ 6864.28878573989 -1063.17110200188 5905.8043946443 0 0 0.999999999950769
+ 10000 0 10000 0 0 10000
+ 9999.99999999999 0 279.613475599913 0 0 1
+ 9921.40941282272 -595.020463166715 672.07230675479 0 0 0.999999999999801
+ 6727.25304442612 1218.77263130311 5378.9699492691 0 0 1.00000000000031
+ 5061.86855757007 242.091919140463 5038.13144242993 2.17774512374819e-13 -2.28679661410785e-13 1.00000000000153
+ 10000 0 10000 0 0 10000
+ 10000 0 10000 0 0 10000
+ 10000 0 10000 0 0 10000
+ 9322.63431224323 -1311.995626199 3249.82856614473 0 0 0.999999999999502
+ 9999.99999999998 0 1161.79481028757 0 0 1
+ 9999.99999999999 0 3151.78919090809 0 0 1
+ 10000 0 2998.30782733221 0 0 1
+ 9999.99999999999 0 799.998974576383 0 0 1
+ 9999.99999999999 0 637.935794898017 0 0 1
+ 10265.0457716915 0 4256.54280065498 0 0 1
+ 6495.82185610713 552.375281301143 3097.40890223662 0 0 1.00000000000611
+ 10000 0 2199.6792529604 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 3536.07977091044 0 0 1
+ 8522.49386933395 415.947783289953 3434.94424112021 0 0 1.00000000000006
+ 9999.99999999999 0 199.593685467929 0 0 1
+ 10000 0 1731.09767118014 0 0 1
+ 10000 0 361.693885120002 0 0 1
+ 9999.99999999999 0 2527.99364257545 0 0 1
+ 9999.99999999999 0 773.143599467722 0 0 1
+ 10000 0 6082.13911223265 0 0 1
+ 9999.99999999999 0 4316.04896640573 0 0 1
+ 9999.99999999999 0 1018.53334732659 0 0 1
+ 9999.99999999999 0 1580.2860613191 0 0 1
+ 10000 0 5102.83894185222 0 0 1
+ 9999.99999999996 0 1905.94391530405 0 0 1
+ 9999.99999999999 0 267.323681878355 0 0 1
+ 9999.99999999999 0 1132.16868228806 0 0 1
+ 10000 0 100 0 0 1
+ 7582.51859047708 -1074.29623745378 6346.04771151305 0 0 1.7659849228101
+ 10000 0 2985.75839817492 0 0 1
+ 10000 0 6246.70893866245 0 0 1
+ 10000 0 4093.19634871755 0 0 1
+ 9999.99999999999 0 3921.05445682613 0 0 1
+ 9999.99999999999 0 482.585286645547 0 0 1
+ 10000 0 4077.80025971209 0 0 1
+ 10000 0 162.315693889381 0 0 1
+ 9999.99999999996 0 829.304296146233 0 0 1
+ 7915.59411109965 -269.022440174121 3046.30270748963 0 0 0.9999999999998
+ 9999.99999999994 0 793.501450304064 0 0 1
+ 9291.66522024319 211.961899868227 1999.95501324132 0 0 0.999999999981639
+ 9999.99999999998 0 4534.74053731729 0 0 1
+ 10000 0 3026.6767911085 0 0 1
+ 9999.99999999999 0 166.694106012723 0 0 1
+ 7729.46163234033 -97.8112146078108 2129.46755020789 0 0 1.00000000000031
+ 10000 0 533.933493065692 0 0 1
+ 9999.99999999999 0 247.84081722986 0 0 1
+ 9999.99999999998 0 669.332544542066 0 0 1
+ 9999.99999999996 0 5130.71546246803 0 0 1
+ 9999.99999999999 0 2677.90592875025 0 0 1
+ 8598.57247021057 1895.43677895209 2761.10143535149 0 0 1.00000000000003
+ 10000 0 2100.17533417266 0 0 1
+ 9999.99999999999 0 1048.65992321805 0 0 1
+ 9999.99999999999 0 275.843244009848 0 0 1
+ 8709.29237108331 394.870117432818 4223.60299218857 0 0 0.999999999949039
+ 10000 0 5852.92315935475 0 0 1
+ 10000 0 3396.05259823617 0 0 1
+ 9999.99999999996 0 483.158810685576 0 0 1
+ 9999.99999999999 0 2321.08800741319 0 0 1
+ 10000 0 929.47843994222 0 0 1
+ 9999.99999999999 0 1113.52549096451 0 0 1
+ 9999.99999999999 0 1163.05704638316 0 0 1
+ 9999.99999999999 0 533.981283503204 0 0 1
+ 10000 0 3517.75014517534 0 0 1
+ 10000 0 1905.58375364136 0 0 1
+ 11274.3679978321 0 1709.75624811842 0 0 1
+ 9999.99999999999 0 500.548700035654 0 0 1
+ 9999.99999999999 0 3516.81870905543 0 0 1
+ 9999.99999999999 0 1393.26739758198 0 0 1
+ 10000 0 5432.81836369432 0 0 1
+ 12262.2399150951 0 2740.56985787882 0 0 1
+ 10000 0 4104.78769702457 0 0 1
+ 9999.99999999996 0 744.124535056775 0 0 1
+ 10000 0 718.6975488368 0 0 1
+ 9999.99999999999 0 796.523952884191 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 4071.39304248362 0 0 3.92118419762768
+ 9862.01438161139 -307.527599950313 1911.48557270866 0 0 0.999999999484388
+ 10000 0 7266.81084199542 0 0 1
+ 9999.99999999999 0 678.292869927721 0 0 1
+ 10000 0 4713.6309272752 0 0 1
+ 12069.3456091209 0 3949.2279837201 0 0 1
+ 10000 0 4031.93423659821 0 0 1
+ 8175.57146775961 -503.623330185247 1477.69503806327 0 0 0.999999999702627
+ 11044.7645722504 0 824.383617135806 0 0 1
+ 10000 0 5666.06768513738 0 0 1
+ 9999.99999999999 0 2118.33848482469 0 0 1
+ 10000 0 5817.97024332268 0 0 1
+ 7409.40609027896 -905.630525030452 940.583795128261 0 0 1.00000000000017
+ 9999.99999999999 0 300.675250987816 0 0 1
+ 9999.99999999999 0 270.352713729687 0 0 1
+ 9999.99999999999 0 3475.68183318037 0 0 1
+ 10000 0 3945.12736904864 0 0 1
+ 10000 0 2471.05309469813 0 0 1
+ 9999.99999999995 0 452.795952539334 0 0 1
+ 10000 0 3273.04468973311 0 0 1
+ 9999.99999999999 0 2905.84300332173 0 0 1
+ 9476.31917463614 -14.1155299216129 1091.30638092491 0 0 0.999999999995347
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2479.90564412805 0 0 3.92118419762769
+ 9999.99999999999 0 309.774077227054 0 0 1
+ 7986.58597108341 -1549.65181476027 2724.69021140627 0 0 0.999999999975704
+ 10000 0 2382.37148303215 0 0 1
+ 9999.99999999999 0 596.23721355436 0 0 1
+ 9999.99999999999 0 3078.51887257281 0 0 1
+ 9999.99999999999 0 304.278859851632 0 0 1
+ 7999.89850725756 -495.783016029225 3348.73024522668 0 0 0.999999999999642
+ 9999.99999999999 0 1480.41049870414 0 0 1
+ 10000 0 1763.85272541588 0 0 1
+ 9999.99999999999 0 263.393548114847 0 0 1
+ 9999.99999999999 0 1460.62340191151 0 0 1
+ 10000 0 1093.77224227785 0 0 1
+ 9999.99999999999 0 3680.08569468569 0 0 1
+ 9999.99999999999 0 244.623011258413 0 0 1
+ 9999.99999999995 0 417.090680715522 0 0 1
+ 9999.99999999999 0 2203.0896762721 0 0 1
+ 9999.99999999999 0 1024.76166882999 0 0 1
+ 8407.77805159266 -694.285691500235 1965.32824394638 0 0 0.999999999094601
+ 9625.25554177607 71.7277678758398 1037.41840228544 0 0 0.999999998358262
+ 9999.99999999999 0 2433.09872464746 0 0 1
+ 9999.99999999998 0 350.41358430978 0 0 1
+ 9999.99999999998 0 1101.487589262 0 0 1
+ 9999.99999999994 0 2071.82194653291 0 0 1
+ 9999.99999999998 0 631.331356876127 0 0 1
+ 9999.99999999995 0 147.990746718793 0 0 1
+ 10000 0 2228.4248586292 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2067.47466350563 0 0 1
+ 9638.80275076587 -99.8073395867223 948.070318062494 0 0 1.00000000000772
+ 9999.99999999996 0 5025.00561294823 0 0 1
+ 9603.08370485337 62.4543065084102 810.8889077451 0 0 0.999999999852022
+ 8779.22746929846 -387.869424576436 3827.13215467763 0 0 0.999999999999763
+ 9999.99999999999 0 2087.85606440664 0 0 1
+ 10000 0 1860.79320707468 0 0 1
+ 8340.75986632118 -567.798381448099 2998.57928826516 0 0 0.999999999384893
+ 8326.95188089873 622.204279828142 3050.23126029751 0 0 0.999999999999728
+ 10013.2848558761 0 5276.39845962043 0 0 1
+ 8981.75895827249 -151.2157623718 2294.25772742794 0 0 0.999999999987743
+ 9999.99999999995 0 607.715340197567 0 0 1
+ 9999.99999999999 0 353.870490624652 0 0 1
+ 9999.99999999999 0 113.023084212462 0 0 1
+ 9733.45777073209 0.503245017693719 779.504835181518 0 0 0.999999998539974
+ 10000 0 256.180827374265 0 0 1
+ 9071.73831235912 -78.8371390552498 999.25409151959 0 0 0.999999999998297
+ 10000 0 472.254569301049 0 0 1
+ 9999.99999999999 0 331.222751761326 0 0 1
+ 9999.99999999999 0 1365.59383042373 0 0 1
+ 9999.99999999999 0 279.384107817486 0 0 1
+ 9999.99999999999 0 2252.82690179464 0 0 3.92118419762768
+ 9144.43068066476 132.162949475784 1382.0115549514 0 0 1.00000000000774
+ 6928.327609014 45.1822957592225 6388.77391188857 0 0 1.30239865215328
+ 9999.99999999999 0 710.025164443956 0 0 1
+ 7737.44085708186 -563.858143346083 2064.24914592184 0 0 0.999999999999448
+ 10000 0 147.560067969412 0 0 1
+ 8367.77461718848 -40.5183802828248 769.033436885205 0 0 0.999999999938386
+ 9999.99999999999 0 887.449157959714 0 0 1
+ 8974.14844593643 22.4056029332453 1745.59232547309 0 0 1.00000000000001
+ 9528.36855410109 24.1398105895249 544.519991974399 0 0 0.999999999999369
+ 9999.99999999999 0 797.824577460679 0 0 1
+ 9999.99999999999 0 943.313377288566 0 0 1
+ 9999.99999999999 0 495.049785051016 0 0 1
+ 9999.99999999999 0 194.713866596666 0 0 1
+ 9999.99999999999 0 3131.32614144345 0 0 3.92118419762768
+ 9999.99999999999 0 2245.55300538543 0 0 3.92118419762768
+ 9999.99999999996 0 2009.89831357194 0 0 1
+ 9999.99999999999 0 1924.10326629366 0 0 1
+ 9999.99999999999 0 1929.86579238492 0 0 1
+ 7674.14893723881 -757.457067851221 1984.34437031976 0 0 0.999999999301035
+ 10000 0 238.931202593002 0 0 1
+ 9999.99999999999 0 459.134058543764 0 0 1
+ 9999.99999999999 0 3136.7831018135 0 0 3.92118419762768
+ 9590.97386315187 157.048838596513 1242.0833229442 0 0 0.999999999150666
+ 9999.99999999999 0 1448.62450890434 0 0 3.92118419762768
+ 9999.99999999999 0 3230.87368313503 0 0 3.92118419762768
+ 9999.99999999998 0 743.28559257878 0 0 1
+ 6706.79816813959 267.892372622373 5446.12518421723 0 0 1.30239865191851
+ 9739.88761721529 -57.1313930171723 2086.59862066229 0 0 0.999999999665672
+ 9999.99999999999 0 899.344800044082 0 0 1
+ 9999.99999999996 0 2472.32243719067 0 0 3.92118419762768
+ 9999.99999999999 0 623.468217655801 0 0 1
+ 10000 0 856.487684336529 0 0 1
+ 8145.72287689834 -661.349042705466 1963.22762304074 0 0 1.00000000000001
+ 8462.60006581222 1725.6975221074 2452.47627675789 0 0 0.999999999999744
+ 9999.99999999999 0 867.656349863672 0 0 1
+ 8408.75699423423 873.504617412748 1668.18777860938 0 0 1.00000000000032
+ 9999.99999999999 0 1519.35906104684 0 0 1
+ 10000 0 896.630879705085 0 0 1
+ 9999.99999999996 0 214.790705767797 0 0 1
+ 10000 0 2758.31030602874 0 0 3.92118419762768
+ 9999.99999999999 0 175.773580969951 0 0 1
+ 9999.99999999999 0 1839.0962799862 0 0 1
+ 6650.11078612139 568.93818294215 4137.4586733714 0 0 0.999999999997567
+ 10000 0 1752.8364748343 0 0 1
+ 9999.99999999995 0 1612.98505006903 0 0 1
+ 9999.99999999999 0 182.499527079105 0 0 1
+ 10000 0 263.199805245352 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1013.88002792583 0 0 1
+ 7437.30473784911 318.701378777194 1815.67089423874 0 0 0.999999999999557
+ 7658.15752123768 -1347.19578812479 1954.20628473109 0 0 0.99999999982781
+ 9999.99999999998 0 306.545681671461 0 0 1
+ 8125.3510414931 493.262606220778 2460.80238880401 0 0 0.999999999999734
+ 9999.99999999999 0 359.205992184172 0 0 1
+ 10000 0 679.971807555799 0 0 1
+ 9999.99999999999 0 1386.8695226025 0 0 1
+ 8269.60323051368 -230.542773702266 3747.81449909792 0 0 1.00000000032116
+ 10000 0 100 0 0 1
+ 8268.74093793471 -216.883131105885 3491.65763148774 0 0 1.0000000003208
+ 9999.99999999999 0 2802.62176282541 0 0 1.76598492290372
+ 6911.27159567354 -126.492572815405 2278.24886600104 0 0 1.00000000043828
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 7205.56005836623 -229.32089454955 3589.85945764627 0 0 0.999999999626108
+ 10000 0 100 0 0 1
+ 10000 0 1544.12810385189 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2293.78503427909 0 0 3.92118419762768
+ 9438.45106884587 -271.705221073924 1044.94276365441 0 0 0.999999999999782
+ 10000 0 2764.66839155594 0 0 1
+ 10000 0 2701.5413102299 0 0 3.92118419762768
+ 10000 0 2485.55427560727 0 0 1
+ 9999.99999999999 0 4411.5502231857 0 0 15.0815345461401
+ 6902.20865558005 -111.998328914501 3918.95085634959 0 0 1.00000000000079
+ 6948.06683368553 -228.051253764676 1390.02982504347 0 0 1.00000000000005
+ 6934.63607545173 -149.886868938293 887.148773873257 0 0 1.00000000000187
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 540.261251777756 0 0 1
+ 9999.99999999998 0 1644.55541038726 0 0 1
+ 6969.11915727555 -356.469953161342 2270.31235402064 0 0 1.00000000000007
+ 10000 0 128.687161454011 0 0 1
+ 9999.99999999995 0 730.228178531181 0 0 1
+ 9999.99999999999 0 2170.09841082098 0 0 1
+ 9999.99999999995 0 1041.31249992806 0 0 1
+ 9999.99999999999 0 892.391606471647 0 0 1
+ 9999.99999999999 0 331.545813404337 0 0 1
+ 10000 0 129.04168751108 0 0 1
+ 8270.87994024755 496.061000080028 1617.83005022396 0 0 1.00000000000005
+ 7364.17445037499 -429.760857576716 2218.34139703909 0 0 1.00000000000643
+ 10000 0 2173.85757743921 0 0 1
+ 9999.99999999996 0 771.473032972087 0 0 1
+ 10000 0 268.772127721416 0 0 1
+ 10000 0 315.34698752804 0 0 1
+ 10000 0 744.09672157508 0 0 1
+ 9999.99999999999 0 465.11617755014 0 0 1
+ 9999.99999999999 0 1175.05518371042 0 0 1
+ 9999.99999999998 0 554.531028774915 0 0 1
+ 9999.99999999999 0 553.970140766417 0 0 2.52955428463019
+ 7014.78935220086 413.208541123827 1819.9449113296 0 0 0.999999999999741
+ 7196.18600253096 865.212839268578 3033.9722994596 0 0 0.999999999993006
+ 8105.1502091829 -584.253786794388 1990.28778932361 0 0 1.00000000000011
+ 9999.99999999999 0 435.1177727529 0 0 1
+ 9868.32801403166 -364.49476263048 1649.97587308232 0 0 0.999999992831131
+ 7473.2246278472 160.301181191435 2549.75048384339 0 0 0.99999999749716
+ 10000 0 230.583232281037 0 0 1
+ 10000 0 1183.31239669751 0 0 1
+ 7668.64494215356 -410.654271940668 1909.73690588826 0 0 0.999999999925091
+ 9999.99999999995 0 592.573567589671 0 0 1
+ 7008.49228251417 -23.6508034242707 3413.45619821658 0 0 1.00000000000195
+ 10000 0 100 0 0 1
+ 9780.35011681065 -131.07608342815 1679.01379283787 0 0 0.999999999879911
+ 10000 0 1141.74317254655 0 0 1
+ 9999.99999999996 0 383.747773867587 0 0 1
+ 9999.99999999999 0 122.990935648033 0 0 1
+ 9999.99999999999 0 1637.8525026263 0 0 1
+ 9999.99999999998 0 367.157788759027 0 0 1
+ 6938.48074640089 -223.91940021568 1684.12221357155 0 0 1.00000000000177
+ 9999.99999999995 0 325.118836632153 0 0 1
+ 9999.99999999999 0 396.152528544682 0 0 1
+ 9999.99999999995 0 1066.78252020758 0 0 1
+ 10000 0 906.947023035598 0 0 1
+ 7285.4252759082 -535.761771119115 1510.41447278624 0 0 1.00000000000029
+ 9999.99999999999 0 349.724068508745 0 0 1
+ 9992.87620253027 18.8784033010028 481.320652688185 0 0 1.00000000312319
+ 9834.04566578869 -43.1857571665976 639.476136323536 0 0 0.999999999998026
+ 9999.99999999999 0 2171.29585605464 0 0 1
+ 9688.33476188588 -404.696589954673 1629.24229182401 0 0 0.999999999999925
+ 9886.93797129273 -57.2032613298791 1390.98673049351 0 0 0.999999999939966
+ 7917.71749424126 1032.24776205189 5988.56526708647 0 0 1.76598491979654
+ 7576.27314717903 -159.014026697346 2318.24913986183 0 0 0.999999999926384
+ 10000 0 675.053649099087 0 0 1
+ 9999.99999999999 0 1003.82280750281 0 0 1
+ 10000 0 100 0 0 1
+ 9732.81277849689 -3.17683417249221 404.389475042194 0 0 0.99999999999767
+ 8417.57763035151 291.880647359157 1702.59895741245 0 0 1.00000000001407
+ 10000 0 2195.32049227694 0 0 1
+ 6905.82709466056 -72.7927758078388 2204.94592218708 0 0 1.00000000000062
+ 9999.99999999999 0 722.818990376272 0 0 1
+ 9999.99999999996 0 767.595629963301 0 0 1
+ 7875.70372157768 -531.468455317099 2861.42274147503 0 0 1.00000000000012
+ 10000 0 2163.42414574233 0 0 1
+ 7859.26501066566 -445.687421350789 2339.4758354134 0 0 1.00000000000012
+ 9999.99999999999 0 1297.87060949882 0 0 1
+ 9999.99999999995 0 674.889562034756 0 0 1
+ 7527.48749756125 -42.2547706170758 1681.61903686068 0 0 1.00000000001705
+ 10000 0 1088.28038176508 0 0 1
+ 9999.99999999998 0 710.022180081201 0 0 1
+ 9357.82608098203 -594.016512726521 1444.38808874717 0 0 0.999999999997813
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 5260.10445934606 0 0 1
+ 10000 0 808.211523411797 0 0 1
+ 9999.99999999999 0 797.30575903567 0 0 1
+ 10000 0 3406.21523899244 0 0 3.92118419762768
+ 9627.19614471806 156.690032990716 1748.51616066901 0 0 0.999999999743871
+ 9999.99999999999 0 1016.2349905032 0 0 1
+ 10000 0 637.030168908867 0 0 1
+ 9999.99999999995 0 327.528326701046 0 0 1
+ 10000 0 471.186804898515 0 0 1
+ 10000 0 500.825728628215 0 0 1
+ 10000 0 634.32863462207 0 0 1
+ 9999.99999999999 0 279.747413590601 0 0 1
+ 9460.13286229602 423.055961929606 1256.6783078743 0 0 0.999999999967283
+ 9999.99999999999 0 325.574170162244 0 0 1
+ 9999.99999999996 0 1050.33075108443 0 0 1
+ 10000 0 1282.32476303302 0 0 1
+ 9999.99999999995 0 271.696946567674 0 0 1
+ 9999.99999999997 0 389.067575947048 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 262.715180298829 0 0 1
+ 9999.99999999999 0 1146.3708096456 0 0 1
+ 10000 0 555.866969888407 0 0 3.92118419762768
+ 10000 0 2958.31055854636 0 0 3.92118419762768
+ 10000 0 2750.05178542399 0 0 3.92118419762768
+ 9799.42891108405 43.0371435591739 423.41034457204 0 0 0.999999999850725
+ 9999.99999999999 0 1190.92389423222 0 0 1
+ 10000 0 2000.88893947698 0 0 1
+ 9999.99999999999 0 801.841696366509 0 0 1
+ 9999.99999999998 0 447.31016794981 0 0 1
+ 9999.99999999995 0 892.915974197968 0 0 1
+ 7198.47145313099 -83.4945699550382 2384.80654403122 0 0 1.00000000000023
+ 10000 0 138.848778963861 0 0 1
+ 9999.99999999998 0 217.018530332009 0 0 1
+ 9999.99999999998 0 1087.27180110427 0 0 1
+ 9999.99999999995 0 522.611604845982 0 0 1
+ 7233.32231444567 263.243089480551 1644.91039203819 0 0 0.999999999951182
+ 9999.99999999999 0 1182.10185297073 0 0 1
+ 9999.99999999999 0 1768.45995910595 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 531.314787799783 0 0 1
+ 7422.31548101354 147.357009519951 2502.36734732646 0 0 1.00000000002358
+ 9999.99999999999 0 1118.15648023098 0 0 1
+ 8133.49549166366 122.991571960495 1645.98036253464 0 0 0.999999999999486
+ 9999.99999999999 0 242.039351274497 0 0 1
+ 8936.36763394253 346.586401474304 2983.84524531293 0 0 0.999999999988899
+ 9999.99999999998 0 1188.60868004245 0 0 1
+ 8935.82594699616 -1069.68128133152 6661.18420001273 0 0 3.92177313716117
+ 7095.96665617272 -623.267711867141 2387.49369085804 0 0 1.00000000000012
+ 9999.99999999996 0 373.830074332629 0 0 1
+ 9999.99999999999 0 1986.45709047066 0 0 15.0815345461401
+ 10000 0 711.683638866834 0 0 1
+ 8314.2058476892 -146.270565268877 2335.16993786419 0 0 0.999999999999694
+ 9999.99999999996 0 809.343504280123 0 0 1
+ 10000 0 637.26748717408 0 0 1
+ 10000 0 100 0 0 1
+ 9619.7374990946 -246.133281676663 1703.94736348321 0 0 0.999999999998492
+ 9999.99999999997 0 1012.0197612162 0 0 1
+ 9999.99999999999 0 271.342439566506 0 0 1
+ 10000 0 100 0 0 1
+ 8492.81712428328 -661.762739708125 3234.42005072008 0 0 0.999999999999809
+ 8475.63066647999 -580.556323270294 2780.19681551838 0 0 0.999999999999791
+ 9999.99999999996 0 552.340391480775 0 0 1
+ 9999.99999999995 0 715.552032276641 0 0 1
+ 8690.52908438919 -116.543228899679 1188.96765385427 0 0 0.99999999552207
+ 9999.99999999998 0 534.235727301672 0 0 1
+ 7787.08717797483 284.124244031474 3238.93599702498 0 0 1.00000000000002
+ 9991.32998505104 65.3109609531162 1373.04258859399 0 0 0.999999999917854
+ 9999.99999999995 0 130.161858441586 0 0 1
+ 7359.73312575018 796.749154627455 1742.0517823758 0 0 0.999999999901982
+ 7827.10261797196 -1181.03005228667 2429.41863329792 0 0 0.999999999995778
+ 10000 0 1831.06188841268 0 0 3.92118419762768
+ 10000 0 3133.04619245018 0 0 3.92118419762769
+ 7620.3698820607 838.332568846342 3223.92914652692 0 0 1.00000000007947
+ 10246.2718708264 0 228.807624172909 0 0 1
+ 7003.37861582035 -295.407500563492 1070.3721413178 0 0 0.999999999999665
+ 7040.58724931294 -428.736338949728 1602.76233772684 0 0 0.999999999999664
+ 10000 0 215.904953759436 0 0 1
+ 10000 0 125.334573943534 0 0 1
+ 10000 0 1123.59925077744 0 0 1
+ 9999.99999999999 0 1118.29558502282 0 0 1
+ 10000 0 309.099390319321 0 0 1
+ 9999.99999999999 0 998.192556604086 0 0 1
+ 9999.99999999995 0 206.49276140338 0 0 1
+ 9999.99999999999 0 1190.49220150591 0 0 1
+ 9999.99999999998 0 275.925926649707 0 0 1
+ 9999.99999999999 0 2992.25322444693 0 0 1.76598492290372
+ 9008.65396923868 -1233.1695508337 5907.22854750519 0 0 3.92118419762449
+ 10000 0 6242.24343556738 0 0 3.92118419762768
+ 10076.2731813181 0 5525.96068828502 0 0 3.92177313743669
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 815.753176680622 0 0 1
+ 8321.8867488729 -26.5066444645479 2403.34137212938 0 0 1.00000000000525
+ 10000 0 200.829285299724 0 0 1
+ 9999.99999999996 0 1694.31667479533 0 0 1
+ 10876.0364311102 0 2550.29893953004 0 0 1
+ 10000 0 625.02763311898 0 0 1
+ 10000 0 480.986212262313 0 0 1
+ 10000 0 595.532511406579 0 0 1
+ 9999.99999999999 0 2531.74737852679 0 0 1
+ 9314.17894824463 -488.651186316157 1757.76359235276 0 0 0.999999999999725
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 1078.44692042207 0 0 1
+ 9999.99999999999 0 2110.15734914349 0 0 1
+ 9999.99999999999 0 478.465316912524 0 0 1
+ 9475.75045780291 35.8232635598562 894.791720855046 0 0 1.00000000000003
+ 9317.16048330209 -499.098688716851 1802.3053925244 0 0 0.999999999999717
+ 10000 0 1631.90282463397 0 0 1
+ 9981.45375050709 -223.954750308576 1800.14245517836 0 0 1.00000000000064
+ 10000 0 2631.32315859935 0 0 1
+ 9999.99999999999 0 482.967119014881 0 0 1
+ 7305.48356704124 -98.3988124249654 1912.69971589424 0 0 1.00000000000058
+ 8858.12987344492 386.311974102534 3945.15786653717 0 0 0.999999999896696
+ 9999.99999999995 0 1315.17864703519 0 0 1
+ 9999.99999999996 0 1105.49521810462 0 0 1
+ 10000 0 1220.74532135982 0 0 1
+ 9999.99999999994 0 825.05906406257 0 0 1
+ 10000 0 216.014166482178 0 0 1
+ 10000 0 184.794242908677 0 0 1
+ 9999.99999999999 0 589.190075657275 0 0 1
+ 8680.01470518484 135.225983472034 1153.08223639095 0 0 1.00000000000969
+ 10166.4078595057 184.8765493192 2292.66982892228 0 0 0.999999991006312
+ 10000 0 404.96048195519 0 0 1
+ 9999.99999999998 0 881.934471368547 0 0 1
+ 10000 0 1112.39378120931 0 0 1
+ 8603.40053805105 1517.4799211443 3576.78543994256 0 0 0.999999999999877
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 489.643415765705 0 0 1
+ 7532.56356976971 516.777064500892 1869.17737018176 0 0 1.0000000000795
+ 8493.81886203913 -67.1597718766986 2494.90963473957 0 0 1.00000000000029
+ 9999.99999999999 0 1022.52508828444 0 0 1
+ 9999.99999999999 0 909.804580766397 0 0 1
+ 7718.66142920441 697.793874291063 1429.10295020159 0 0 1.00000000000001
+ 9999.99999999995 0 476.263516366548 0 0 1
+ 7966.20566974134 215.235063019506 2311.47962861852 0 0 1.00000000001584
+ 9999.99999999999 0 2404.2294814383 0 0 1
+ 6998.77389855576 96.4118137611715 3018.11406932665 0 0 1.00000000000191
+ 8642.85727137215 1965.13861047317 2911.02162817643 0 0 1.00000000000004
+ 9999.99999999998 0 440.299386252629 0 0 1
+ 10000 0 541.84450520657 0 0 1
+ 7136.97692418781 651.041829894793 5757.75428900138 0 0 0.999999999958055
+ 9999.99999999999 0 317.626537699591 0 0 1
+ 10000 0 999.279459618547 0 0 1
+ 9999.99999999999 0 2630.97944192006 0 0 1
+ 8740.54713884568 -228.109744827766 3062.45671187626 0 0 0.999999999997693
+ 10000 0 2278.89663734661 0 0 1
+ 9994.84218434658 23.2563076880888 890.818439914775 0 0 0.999999999958961
+ 9494.13632729001 -167.726013195208 3472.60154342821 0 0 0.999999999997567
+ 9999.99999999999 0 938.890812704499 0 0 1
+ 10000 0 4211.9443082965 0 0 3.92118419762768
+ 9999.99999999998 0 556.365850924464 0 0 1
+ 8816.52773881884 476.081583425782 3036.1623583411 0 0 1.00000000016023
+ 7491.71931856945 265.03485298888 500.003299038484 0 0 0.999999999999828
+ 7285.99097540137 226.895195077534 2969.84280580588 0 0 1.00000000000481
+ 8212.14691610663 941.29958748872 5966.61746855692 0 0 0.999999999999533
+ 9999.99999999999 0 1922.65048835971 0 0 1
+ 10000 0 615.180712037268 0 0 1
+ 10000 0 879.564363903684 0 0 1
+ 9999.99999999995 0 417.368797821494 0 0 1
+ 8971.95829659324 352.785119674994 1337.61753929871 0 0 0.999999999999939
+ 9353.0456713443 143.107595385312 1372.98707675935 0 0 0.999999999979463
+ 9495.09779473191 -187.129926323962 3949.6526868213 0 0 0.999999999997031
+ 8582.01184498599 103.743335820163 916.476703711095 0 0 1.00000000002117
+ 8690.46148859347 596.557157510934 1114.3108693854 0 0 1.00000000015595
+ 9028.28067436399 1219.02197917201 2425.69012711849 0 0 1.00000000015304
+ 10000 0 400.900963248492 0 0 1
+ 6785.32952462166 1334.53096338774 5760.28121535703 0 0 0.999999999294555
+ 9999.99999999999 0 276.446307896563 0 0 1
+ 7650.77856936009 -508.005521145326 4067.97103748205 0 0 1.00000000000013
+ 10000 0 740.686464989701 0 0 1
+ 9065.50216077408 229.289554323165 1910.58930334282 0 0 0.999999999999864
+ 5885.98338857039 44.6682418937171 4741.75835370782 0 0 0.999999999924807
+ 10000 0 101.228844956072 0 0 1
+ 7608.01031778674 681.395630874201 3959.97036416476 0 0 0.999999999991251
+ 10000 0 587.234177252189 0 0 1
+ 9407.56253408318 387.673734072485 1496.86770777465 0 0 0.9999999999968
+ 10000 0 100 0 0 1
+ 9512.84808719324 -16.162469844201 604.583884879606 0 0 1.00000000000061
+ 9999.99999999999 0 1084.55968129084 0 0 1
+ 9999.99999999999 0 400.391254426242 0 0 1
+ 10000 0 1085.27219491152 0 0 1
+ 10000 0 139.061840519173 0 0 1
+ 10000 0 1324.83727036667 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2963.21802358202 0 0 1
+ 9999.99999999998 0 251.340757170759 0 0 1
+ 10000 0 137.900095329108 0 0 1
+ 10000 0 158.924405178436 0 0 1
+ 10000 0 100 0 0 1
+ 8133.08962060267 -95.2850562953302 2428.23614244336 0 0 1.00000000000211
+ 9999.99999999999 0 531.552852105026 0 0 1
+ 10000 0 1789.4618371965 0 0 1
+ 8336.57666726269 635.923154884607 1246.96255943258 0 0 0.999999999950483
+ 8258.43651741208 -314.154815032061 4920.23864454262 0 0 1.00000000000243
+ 8320.71467650036 49.3757956455798 2307.0302622491 0 0 1.00000000000831
+ 8132.64701724035 -84.4828934153328 2125.84149011653 0 0 1.00000000000204
+ 7585.81520069366 -514.175015176955 857.152491849452 0 0 1.00000000000017
+ 7770.6812687494 -288.282369143146 3749.5215623196 0 0 1.0000000000004
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 844.39088549419 0 0 1
+ 9999.99999999995 0 1179.52700516105 0 0 1
+ 7922.41158497612 811.307538539134 2744.31325348065 0 0 0.999999999547274
+ 10000 0 1777.61684971047 0 0 1
+ 10000 0 100 0 0 1
+ 9979.67707274124 40.8191179371656 812.787167212021 0 0 0.999999998489326
+ 9048.95002665137 95.546636644097 2811.7855516938 0 0 0.999999999774488
+ 9791.73574690452 254.161745192771 2500.46253038635 0 0 0.999999999999045
+ 10000 0 1521.10109590871 0 0 1
+ 9999.99999999998 0 366.718342758715 0 0 1
+ 8118.63329535142 59.2218682446984 1946.39590573676 0 0 0.999999999999905
+ 10000 0 562.879580585283 0 0 1
+ 8119.95307101118 102.857073678679 3623.85696764469 0 0 1.00000000000007
+ 9999.99999999998 0 1507.38578372438 0 0 1
+ 9999.99999999995 0 1183.45679814284 0 0 1
+ 10000 0 136.188638408732 0 0 1
+ 5963.40155507099 404.581506858435 5844.49987663849 0 0 1.0000000002031
+ 10000 0 1730.58326149532 0 0 1
+ 10000 0 818.995775392124 0 0 1
+ 9999.99999999999 0 533.688498487265 0 0 1
+ 10000 0 827.999227528811 0 0 1
+ 8740.88399125082 -442.533668674596 1653.64273456711 0 0 0.999999999922833
+ 9999.99999999998 0 187.153915639872 0 0 1
+ 10000 0 148.731660234201 0 0 1
+ 9999.99999999996 0 1037.04740929579 0 0 1
+ 9999.99999999998 0 323.264846386168 0 0 1
+ 10000 0 191.074906325251 0 0 1
+ 8420.36968878418 212.397398483163 2367.46599231221 0 0 1.00000000000086
+ 7544.39491550692 181.963213311424 1855.73039608624 0 0 1.00000000003017
+ 9751.70735720923 -3.63172618116326 223.908907496646 0 0 1.0000000000001
+ 8054.93215489814 470.712081218059 1460.61537470695 0 0 0.999999996917828
+ 9999.99999999999 0 910.205870941227 0 0 1
+ 8447.05177556672 1158.79521399987 1800.64073388783 0 0 0.999999999430993
+ 7463.82566356637 205.373670771099 1034.16049539195 0 0 1.00000000004231
+ 7116.79134568598 -703.15911486579 2740.08756766755 0 0 1.00000000000043
+ 6431.22610482395 1652.6968757268 4305.20367691203 0 0 0.999999999999836
+ 9999.99999999998 0 645.824798543147 0 0 1
+ 9999.99999999999 0 288.174325216501 0 0 1
+ 9999.99999999999 0 2756.13200404163 0 0 3.92118419762768
+ 9928.25382729315 -170.564912930403 701.68511967713 0 0 0.99999999999757
+ 10000 0 2123.29836551108 0 0 1
+ 10000 0 1206.30597109126 0 0 1
+ 9476.23353295218 -10.8730017284591 818.289104441251 0 0 0.999999999593004
+ 10000 0 1401.72753818515 0 0 1
+ 9999.99999999999 0 265.80295410149 0 0 1
+ 9999.99999999999 0 481.877647183037 0 0 1
+ 9831.29740250588 505.950264686866 867.006735944007 0 0 0.999999999999783
+ 9167.88911703588 476.309581289332 2251.93639369937 0 0 0.999999999982049
+ 9040.7018448568 -452.917636474035 1359.59252807325 0 0 0.99999999996195
+ 9999.99999999999 0 937.601054460495 0 0 1
+ 9999.99999999995 0 2008.49792753886 0 0 1
+ 10000 0 745.905622889915 0 0 1
+ 9999.99999999999 0 3463.90063873547 0 0 1
+ 9257.43181164301 -798.319937573714 805.475912919681 0 0 1.00000000000001
+ 9999.99999999999 0 281.922438521884 0 0 1
+ 9999.99999999999 0 2482.4430965844 0 0 1.76598492290372
+ 10000 0 132.908897600227 0 0 1
+ 10000 0 4845.46305128821 0 0 6.87987100241871
+ 9999.99999999999 0 1220.93492180049 0 0 1
+ 6821.53602951462 1170.37484650367 2634.74760912825 0 0 0.999999999998652
+ 10000 0 1539.3823414102 0 0 1
+ 9999.99999999995 0 464.134018651719 0 0 1
+ 10000 0 1605.57615744456 0 0 1
+ 7255.7991850801 236.696713414651 3030.60037362218 0 0 1.00000000000043
+ 9999.99999999998 0 547.385492429114 0 0 1
+ 9811.17032706892 115.633994927995 849.797816390164 0 0 0.999999999999662
+ 10000 0 3122.89974853864 0 0 1
+ 7713.85353430789 -831.228424359966 1581.48915981565 0 0 0.999999999862184
+ 9999.99999999999 0 317.919456548094 0 0 1
+ 9999.99999999999 0 1021.44222817547 0 0 1
+ 9999.99999999995 0 1076.72551241049 0 0 1
+ 6802.67115813084 1030.24281596588 2943.71315102548 0 0 1.00000000011903
+ 9999.99999999999 0 1145.37345870087 0 0 1
+ 8419.31754906625 201.17806037809 2229.78827432561 0 0 1.00000000000086
+ 9999.99999999998 0 720.752912484585 0 0 1
+ 10000 0 258.507340664515 0 0 1
+ 7067.53069396288 -620.297123342334 2765.17630051542 0 0 0.999999999999621
+ 7903.97139024745 -1270.17668825698 2325.1187858198 0 0 0.999999999999745
+ 8329.40516261103 526.649849999358 1667.30809329967 0 0 0.999999999973264
+ 8991.85353144267 1268.70352163498 5351.82288908615 0 0 0.999999999943616
+ 9800.71600503935 630.147238200241 2023.61813104786 0 0 0.99999999986712
+ 9616.22738456068 251.409153558729 953.692220283175 0 0 1.00000000000031
+ 9638.08533513121 332.644065761101 1318.13643196853 0 0 0.99999999999999
+ 9999.99999999995 0 2901.31989346489 0 0 3.92118419762768
+ 8805.21273196047 387.915657965245 2137.9496581665 0 0 0.999999999958921
+ 9999.99999999998 0 1042.57977029746 0 0 1
+ 10000 0 3350.22615139505 0 0 1
+ 7382.28269111138 193.005008341131 2685.6240691443 0 0 1.00000000000007
+ 7571.86196200183 657.531146384525 2443.78539164421 0 0 1.00000000007947
+ 9614.47698193787 -272.918624958425 1239.87496751764 0 0 0.999999998506258
+ 10000 0 324.851587405391 0 0 1
+ 10000 0 557.69112301316 0 0 1
+ 9999.99999999995 0 965.138569324 0 0 1
+ 9999.99999999996 0 207.982411566754 0 0 1
+ 9681.30344847763 507.906893291206 2208.66067585804 0 0 1.00000000000024
+ 9785.07857623146 -101.056039032505 876.458137367677 0 0 0.999999999898538
+ 6633.05206732713 -805.387024560835 2798.75117364281 0 0 1.00000000000243
+ 10000 0 1011.51135124954 0 0 1
+ 9609.10322589662 -287.17652642164 1395.49704523813 0 0 0.999999999794412
+ 10000 0 100 0 0 1
+ 10000 0 483.949143097844 0 0 1
+ 9999.99999999995 0 676.651934947371 0 0 1
+ 9999.99999999999 0 4640.06961396673 0 0 3.92118419762769
+ 9999.99999999998 0 512.855076712496 0 0 1
+ 10000 0 1817.77105690425 0 0 1
+ 9461.43168045482 787.012972358524 2101.63125986914 0 0 0.999999999996265
+ 10000 0 100 0 0 1
+ 8516.23564086622 -842.816819965682 2135.20052452434 0 0 0.99999999999636
+ 10567.6358955088 745.188165830272 1070.89528876596 0 0 0.999999999998814
+ 9999.99999999998 0 1398.82042598205 0 0 1
+ 8593.20015711715 194.83398242695 1951.25359500582 0 0 1.76598492290361
+ 9999.99999999999 0 313.568843578036 0 0 1
+ 10000 0 183.499973983388 0 0 1
+ 9044.01259791681 -245.887360477072 1042.6836167651 0 0 0.999999999968399
+ 10000 0 4427.29879784903 0 0 3.92118419762768
+ 8827.09226764145 485.288121871868 1802.21985921202 0 0 0.999999999901097
+ 10000 0 825.256764204143 0 0 1
+ 9769.50116962077 -55.7825490177086 984.493712961445 0 0 1.00000000000551
+ 7273.60847249039 29.4855166976201 1011.03516194438 0 0 1.00000000000059
+ 10000 0 418.392248676658 0 0 1
+ 8148.24711185368 -714.461515839736 1121.45788280204 0 0 0.999999999999823
+ 8783.51064984534 441.75053668874 3030.89932360881 0 0 1.0000000000218
+ 10000 0 427.824932936458 0 0 1
+ 6842.67784560439 -401.373480987039 3054.92139616215 0 0 0.99999999985577
+ 7635.9261169136 96.7951773035793 3123.60783290467 0 0 1.00000000000063
+ 9999.99999999999 0 661.0148746367 0 0 1
+ 7275.11212288539 82.2919802655979 3110.91248593427 0 0 1.00000000008628
+ 10000 0 100 0 0 1
+ 10000 0 1056.49298561731 0 0 1
+ 10000 0 192.832854387276 0 0 1
+ 9999.99999999999 0 653.39391230494 0 0 1
+ 10000 0 428.111650787178 0 0 1
+ 9874.29282984493 14.5311931030158 1342.2080895384 0 0 0.999999999999252
+ 8191.25405265356 567.597933319238 2042.64067505348 0 0 0.999999999978671
+ 9198.52277597379 158.021833106938 4106.03753986427 0 0 0.999999999539401
+ 9999.99999999999 0 229.161114289553 0 0 1
+ 9999.99999999995 0 736.833079176508 0 0 1
+ 9999.99999999998 0 1335.80864389649 0 0 1
+ 9999.99999999998 0 1262.55747066706 0 0 1
+ 9998.74937399324 -23.1018059371812 967.112404662733 0 0 0.999999999859347
+ 9999.99999999995 0 2013.25304798914 0 0 1
+ 6053.38508934194 380.479432435638 3775.08877747448 0 0 0.999999999999202
+ 10000 0 4924.68539669926 0 0 3.92118419762768
+ 9999.99999999999 0 708.156597104114 0 0 1
+ 9999.99999999999 0 1173.5954372668 0 0 1
+ 8098.49070849757 3.45591143702036 1059.23490004456 0 0 0.999999998850065
+ 7669.69031664895 -121.254220366451 5608.28403348685 0 0 0.999999999990165
+ 8288.9158325836 -195.2507854454 1217.57863295963 0 0 0.999999999999832
+ 5873.31624524918 -123.858209168327 3276.50291165792 0 0 1.00000000003393
+ 9197.30408199108 127.999173544856 3219.43406457183 0 0 0.9999999995394
+ 9999.99999999999 0 2090.14747040369 0 0 1
+ 9999.99999999995 0 846.621382223858 0 0 1
+ 9999.99999999996 0 1191.57125442355 0 0 1
+ 7668.89181935014 -326.75060584073 1130.23325606206 0 0 0.999999999999448
+ 10000 0 291.089695219444 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 1502.20408457658 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 3391.00851905564 0 0 1
+ 10000 0 100 0 0 1
+ 8263.91199392652 770.412339903268 1660.8528344369 0 0 0.999999999999876
+ 8098.56081736413 37.5300482876625 1655.04553778045 0 0 0.999999999999156
+ 10000 0 1886.51107486939 0 0 1
+ 8251.0521755036 -13.2714709506669 3059.3384658136 0 0 1.00000000000396
+ 7199.9537535648 426.932452376764 1724.84974840311 0 0 0.99999999999991
+ 10000 0 521.145584115141 0 0 1
+ 9999.99999999998 0 520.278011090542 0 0 1
+ 7442.01308517572 -448.091754643809 532.049129831635 0 0 0.999999999732757
+ 9999.99999999998 0 1116.1056652835 0 0 1
+ 9999.99999999999 0 1407.98011010489 0 0 1
+ 8109.27437552596 213.932412069283 3247.22733207647 0 0 1.00000000005738
+ 9999.99999999999 0 226.881923738709 0 0 1
+ 7569.61206837766 -1403.82733969366 3606.3959185917 0 0 0.999999999994217
+ 7010.73613671267 -463.972216075529 2362.30313638196 0 0 1.00000000000688
+ 9999.99999999999 0 1193.04794250367 0 0 1
+ 7964.11460189533 243.194895396746 3165.06582854735 0 0 0.999999999241688
+ 10000 0 177.714286766028 0 0 1
+ 7632.67753093783 439.387306111631 2381.55149804962 0 0 0.999999999785394
+ 9999.99999999995 0 1106.61711266598 0 0 1
+ 8794.01231303673 462.053452440657 3139.91110034284 0 0 1.00000000000701
+ 8242.47060021312 -78.6852094413069 2050.72520541877 0 0 1.00000000000308
+ 10000 0 100 0 0 1
+ 8576.78388963665 334.809178444588 3068.21959622238 0 0 1.00000000000229
+ 8579.13253167904 841.901596012203 1181.78999631152 0 0 0.999999999935593
+ 9999.99999999994 0 975.425409665557 0 0 1
+ 9999.99999999999 0 739.48794783913 0 0 1
+ 7035.19255560617 -480.037054352164 2069.55647951942 0 0 1.00000000000028
+ 9999.99999999999 0 435.12922818228 0 0 1
+ 7609.42293396124 -215.197041790621 2910.77018667317 0 0 0.999999999998802
+ 9999.99999999999 0 5773.35175349196 0 0 3.92118419762768
+ 10000 0 902.233485555472 0 0 1
+ 6944.24092651131 11.5685446767833 3363.51260464785 0 0 0.999999998984586
+ 9797.3776144099 309.304367863194 3174.8113536117 0 0 0.999999999999062
+ 8492.94645747056 -37.0555652987235 1179.01868988912 0 0 1.00000000000031
+ 9999.99999999999 0 2290.53786197675 0 0 1
+ 6855.54709598972 176.097324774901 3255.09917679054 0 0 0.999999999484543
+ 10000 0 6742.28307662837 0 0 3.92118419762768
+ 10000 0 709.69675538489 0 0 1
+ 8126.84602907421 -392.611513899878 3756.70829388923 0 0 1.00000000011425
+ 6734.23176872689 294.485234202061 3416.25598801387 0 0 1.00000000000601
+ 10000 0 133.938009678239 0 0 1
+ 9999.99999999995 0 1045.34893298843 0 0 1
+ 8505.73400545397 -195.432662960541 3049.38787573912 0 0 0.999999999997731
+ 10000 0 100 0 0 1
+ 6375.82362708026 651.512905611521 4816.58179356201 0 0 0.99999999952496
+ 9999.99999999995 0 1312.24767608561 0 0 1
+ 9283.38364037191 94.6048127147268 3485.60309329803 0 0 1.00000000000865
+ 9999.99999999999 0 130.171624090491 0 0 1
+ 6911.84504375478 -136.716427050969 2485.06420795482 0 0 1.00000000043832
+ 9999.99999999999 0 3101.66698955609 0 0 3.92118419762768
+ 8434.44943560823 167.639075936792 1374.14409704991 0 0 0.999999999230824
+ 10000 0 198.773401168268 0 0 1
+ 9999.99999999999 0 847.450625957357 0 0 1
+ 9999.99999999999 0 1680.42991338595 0 0 1
+ 9999.99999999998 0 1170.05771411412 0 0 1.13626225643042
+ 9999.99999999998 0 384.75160319264 0 0 1
+ 9999.99999999999 0 293.343286630825 0 0 1
+ 9263.66971996465 135.225874410042 2170.19001237644 0 0 0.999999995504502
+ 7740.20708580911 8.74693390852387 2893.93392490666 0 0 0.999999999999481
+ 7178.88775135436 269.277153945209 4600.86922391076 0 0 1.00000000003148
+ 9999.99999999998 0 1200.34423665559 0 0 1
+ 9999.99999999998 0 2088.23660134664 0 0 1
+ 9999.99999999998 0 260.402466476818 0 0 1
+ 7890.36207884535 -592.683471751183 2689.11048868742 0 0 1.00000000000022
+ 9999.99999999999 0 331.061963041343 0 0 1
+ 5615.60007986769 381.548119666635 4546.45063812755 0 0 1.00000000000086
+ 9225.47928551268 259.461401208901 3532.35954782798 0 0 0.9999999999998
+ 10000 0 100 0 0 1
+ 10000 0 1035.24694490879 0 0 1
+ 9999.99999999999 0 191.017594738387 0 0 1
+ 9999.99999999998 0 686.963438133 0 0 1
+ 9999.99999999999 0 413.13724481887 0 0 1
+ 10000 0 100 0 0 1
+ 8860.1275908733 -745.672434484904 2221.35326276404 0 0 1.00000000000011
+ 9999.99999999999 0 1301.78684514742 0 0 1
+ 10000 0 867.171553737136 0 0 1
+ 7110.33492799025 -50.1834184769282 2063.30998212636 0 0 1.00000000002155
+ 10000 0 307.792670163038 0 0 1
+ 9999.99999999995 0 191.667398605217 0 0 1
+ 9999.99999999999 0 1164.22467038962 0 0 1
+ 9999.99999999999 0 408.7781282168 0 0 1
+ 7796.64924177322 268.18137656216 2022.12502040037 0 0 1.00000000010968
+ 9999.99999999998 0 396.493109366822 0 0 1
+ 9999.99999999999 0 1016.15632630881 0 0 1
+ 9999.99999999999 0 1176.14063022718 0 0 1
+ 8712.20537006169 -883.038274327866 2815.43469227751 0 0 0.999999999999788
+ 9999.99999999999 0 1170.42992135088 0 0 1
+ 9999.99999999999 0 718.002951520153 0 0 1
+ 9999.99999999999 0 3637.92962246382 0 0 3.92118419762768
+ 9302.79868706421 740.662691995768 1987.8448982572 0 0 0.999999999999805
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 926.165114135848 0 0 1
+ 7957.49667748004 -269.424324166938 2425.03354399703 0 0 0.999999999842655
+ 8564.7170684118 60.4423503531937 1717.01303997942 0 0 1.00000000001179
+ 9999.99999999999 0 368.613236694446 0 0 1
+ 10000 0 6639.03087236869 0 0 3.92118419762768
+ 9999.99999999999 0 1009.58808995005 0 0 1
+ 10000 0 198.637295908879 0 0 1
+ 9783.94128106398 -646.143484652833 1173.72527722484 0 0 0.999999999694984
+ 9999.99999999995 0 226.972553726908 0 0 1
+ 8021.74657812234 -787.256477001774 962.169407128379 0 0 1.00000000000006
+ 9712.52638991241 -221.252408630206 1832.68633744661 0 0 0.999999999689304
+ 10000 0 3013.74112720591 0 0 3.92118419762768
+ 9999.99999999998 0 1796.30929634113 0 0 1
+ 10000 0 110.97619507742 0 0 1
+ 9999.99999999999 0 1509.09507327223 0 0 1
+ 9999.99999999998 0 516.460101334265 0 0 1
+ 10000 0 561.451782130753 0 0 1
+ 9999.99999999998 0 1788.29471245832 0 0 1
+ 7844.9181579554 -683.366088581028 2386.90491025074 0 0 0.999999999886945
+ 7063.03824532848 -931.381440704961 6601.05787701647 0 0 3.92118419763143
+ 8773.47958613407 848.992907816636 1482.78487632318 0 0 0.999999999921611
+ 10000 0 137.720726255882 0 0 1
+ 10000 0 201.001724693515 0 0 1
+ 10000 0 337.171690439367 0 0 1
+ 10000 0 881.349998335689 0 0 1
+ 10000 0 2877.90303648264 0 0 1
+ 7904.78014492888 918.546002436123 2882.12887118448 0 0 0.9999999999996
+ 10000 0 100 0 0 1
+ 7152.45954351042 -727.385406147723 2518.84885507751 0 0 0.999999999994785
+ 9999.99999999999 0 409.694976907333 0 0 1
+ 9028.78900800128 430.860919441907 3276.83850934818 0 0 1.00000000000033
+ 9887.13886360744 -153.558365204469 905.437138569061 0 0 0.999999999999771
+ 10000 0 100 0 0 1
+ 10000 0 2029.81445264627 0 0 1
+ 10000 0 1445.56235363511 0 0 1
+ 10000 0 726.217486839587 0 0 1
+ 8354.99816406074 -628.648819363222 1556.02495592254 0 0 0.999999999943494
+ 10000 0 100 0 0 1
+ 9411.86591754959 1233.30604363631 1169.3778959978 0 0 0.999999995504878
+ 9999.99999999995 0 1257.14088726122 0 0 1
+ 8290.86934459102 -228.860740998405 1635.38274402514 0 0 0.999999999999823
+ 9557.20773085045 117.834062118921 516.778882821538 0 0 0.999999999999913
+ 8263.18925583487 -132.873126994582 2011.36329355592 0 0 1.0000000003208
+ 10000 0 890.220456909778 0 0 1
+ 10000 0 1148.51428904363 0 0 1
+ 10000 0 256.424340676533 0 0 1
+ 10000 0 716.982886313284 0 0 1
+ 9999.99999999999 0 926.004783043703 0 0 1
+ 9999.99999999998 0 1129.10709866344 0 0 1
+ 7873.80194374135 -173.633121547793 1803.48435782208 0 0 0.999999999999111
+ 9999.99999999996 0 202.00140180383 0 0 1
+ 9999.99999999995 0 314.499943000677 0 0 1
+ 10000 0 1395.43094016337 0 0 1
+ 9999.99999999999 0 458.155573730403 0 0 1
+ 10000 0 1867.90164564564 0 0 1
+ 10000 0 354.851654916238 0 0 1
+ 10000 0 191.771149356816 0 0 1
+ 10000 0 179.605216652042 0 0 1
+ 10000 0 1528.18135060182 0 0 1
+ 10000 0 132.511932524864 0 0 1
+ 9999.99999999995 0 495.412959012287 0 0 1
+ 9999.99999999999 0 305.04511189937 0 0 1
+ 8769.01420779338 -269.810859733299 1196.5238754869 0 0 0.999999999999558
+ 9949.51705887439 -248.465092324323 6827.21796203513 0 0 3.9211841976221
+ 10000 0 1528.60111819906 0 0 1
+ 10000 0 100 0 0 1
+ 9672.96335799831 338.654976729292 1400.84660728458 0 0 0.999999999999771
+ 9999.99999999999 0 3403.18424626034 0 0 1
+ 8506.67655426474 54.9398802741882 2232.64342619573 0 0 0.999999999655394
+ 7129.07988792053 -481.571612044867 2254.49056649819 0 0 1.00000000001356
+ 10000 0 355.432138117505 0 0 1
+ 9363.19846191534 559.174662220151 1808.54885625321 0 0 0.999999999118334
+ 7972.02631645522 -263.290731251353 1816.48863996852 0 0 1.00000000000053
+ 6426.63542291844 553.08669771473 6483.92043654769 0 0 0.999999999999282
+ 10000 0 100 0 0 1
+ 7578.13666988964 274.655729457012 4251.43749317214 0 0 0.999999999999817
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 793.128315235426 0 0 1
+ 9612.98888407476 443.276599589626 1719.2035099322 0 0 0.999999997588862
+ 10076.2731813181 0 890.93382652697 0 0 3.92177313743669
+ 7439.75124565973 -388.066843760098 2882.62082239219 0 0 1.00000000000009
+ 7008.47442101619 -21.1091878639746 2995.42100840095 0 0 1.00000000000023
+ 7732.41974779667 -2443.99030173184 2730.07663627654 0 0 0.999999999282685
+ 10000 0 3427.47624483585 0 0 3.92118419762768
+ 10000 0 1576.5187151594 0 0 1
+ 7706.89373370493 -453.720987893683 2811.13566394333 0 0 0.999999999999533
+ 9999.99999999995 0 552.497278949804 0 0 1
+ 9999.99999999999 0 2072.79105316866 0 0 1
+ 9999.99999999999 0 278.302309035908 0 0 1
+ 10000 0 1860.10020960038 0 0 1
+ 9999.99999999998 0 688.201878473479 0 0 1
+ 8635.35660786308 50.2628540213738 812.70141057009 0 0 1.00000000001499
+ 8447.47392113093 466.348401570775 2894.89111565261 0 0 1.00000000000023
+ 10000 0 1790.31608539321 0 0 3.92118419762768
+ 9999.99999999999 0 1015.40640273126 0 0 1
+ 9999.99999999999 0 459.806034180328 0 0 1
+ 9999.99999999999 0 1764.55614286466 0 0 3.92118419762768
+ 9396.84466277512 620.428130673566 1552.0913443531 0 0 0.999999999996249
+ 9999.99999999999 0 519.88849793243 0 0 1
+ 10000 0 413.344682021919 0 0 1
+ 9999.99999999999 0 1050.91974618867 0 0 1
+ 8324.92743281132 -140.51559898651 1708.84342943477 0 0 0.999999999999837
+ 8994.78216380561 1.32159345150634 459.811553021679 0 0 0.999999994177241
+ 8321.99021206341 -36.1068663359837 3486.29555322296 0 0 1.00000000001932
+ 9999.99999999999 0 380.292983403465 0 0 1
+ 9999.99999999999 0 1111.54189150606 0 0 1
+ 9999.99999999998 0 175.124542644447 0 0 1
+ 9065.52512984997 -99.1848283352673 2248.49050517356 0 0 0.999999998804354
+ 8993.18832744081 -38.0775263034627 1670.78287729848 0 0 0.999999999990491
+ 9999.99999999996 0 282.611740459994 0 0 1
+ 8750.23128867114 182.952394052171 1665.67196942135 0 0 0.999999999655152
+ 5632.91485682909 678.393830948604 2752.23519296182 0 0 0.999999999949033
+ 9399.34162755297 -461.204527054818 1040.00112748913 0 0 0.999999999995721
+ 9999.99999999999 0 295.989996079124 0 0 1
+ 8435.74895346473 385.945550396652 4672.07266699283 0 0 1.00000000000077
+ 9199.68297981264 -496.042658008347 2813.9966122354 0 0 1.00000000000012
+ 9999.99999999996 0 1468.69173707916 0 0 1
+ 9999.99999999995 0 160.588490648643 0 0 1
+ 7950.72221155535 -203.38519046655 3569.55711739314 0 0 0.999999999769676
+ 8436.17933024291 1099.49099664019 3787.49978787673 0 0 1.00000000000036
+ 10000 0 924.039340485981 0 0 1
+ 9999.99999999999 0 559.730950790746 0 0 1
+ 10000 0 517.408518541933 0 0 1
+ 10000 0 183.899726282266 0 0 1
+ 7323.04980404899 223.556627301055 1444.4666469154 0 0 0.999999999830932
+ 7886.5685585198 580.615951868451 2446.28652951156 0 0 0.999999999987899
+ 9999.99999999999 0 228.129445636298 0 0 1
+ 9999.99999999998 0 2925.82336732655 0 0 1
+ 9999.99999999999 0 642.500491464694 0 0 1
+ 10000 0 396.561601701051 0 0 1
+ 10000 0 100 0 0 1
+ 7275.15193498623 83.7819050779362 3175.4089531906 0 0 1.00000000008628
+ 8564.82825752158 63.5815215115795 1825.12357804563 0 0 1.00000000001179
+ 9999.99999999999 0 632.092780382227 0 0 1
+ 9999.99999999998 0 866.880819064118 0 0 1
+ 9999.99999999996 0 1871.56095359055 0 0 1.76598492290372
+ 9999.99999999999 0 640.872230740823 0 0 1
+ 9999.99999999999 0 2027.80491314566 0 0 1
+ 8798.16155615406 489.823316155741 3364.560925533 0 0 1.00000000000701
+ 8830.25460198093 63.3755113116216 3606.53509584244 0 0 0.999999999988806
+ 10000 0 115.99346071675 0 0 1
+ 9999.99999999995 0 426.411639514261 0 0 1
+ 10000 0 196.707530323401 0 0 1
+ 7746.35733688247 972.414628895335 2434.37188600693 0 0 0.999999999999819
+ 10000 0 432.014415188688 0 0 1
+ 10000 0 2773.6241806403 0 0 3.92118419762768
+ 10000 0 1720.74836952067 0 0 3.92118419762768
+ 10000 0 285.245352214604 0 0 1
+ 10000 0 102.387381526039 0 0 1
+ 7111.91694170663 -898.15636456628 1511.40281150606 0 0 0.999999999695012
+ 10000 0 189.333599345745 0 0 1
+ 8847.33138282938 558.505930294672 2113.8031295794 0 0 0.9999999999011
+ 10000 0 100 0 0 1
+ 8292.66463996508 5.22144786428934 1260.68561177973 0 0 0.999999999872141
+ 10000 0 103.353325899991 0 0 1
+ 9999.99999999998 0 1338.4586116251 0 0 1
+ 9999.99999999999 0 1922.17043478158 0 0 1
+ 10000 0 3064.11207095883 0 0 1
+ 9650.93372333933 110.283585663828 628.496428042711 0 0 1.00000000000031
+ 9999.99999999999 0 1002.06550130129 0 0 1
+ 9999.99999999999 0 954.592815081746 0 0 1
+ 9999.99999999998 0 551.954424943838 0 0 1
+ 9999.99999999998 0 706.517633856049 0 0 1
+ 9999.99999999999 0 341.418339250892 0 0 1
+ 9999.99999999995 0 535.785081285298 0 0 1
+ 9999.99999999999 0 255.965495733918 0 0 1
+ 10000 0 263.950395582565 0 0 1
+ 9999.99999999999 0 826.543874528011 0 0 1
+ 10000 0 5606.80653844719 0 0 3.92118419762769
+ 9999.99999999995 0 782.383210888563 0 0 1
+ 9999.99999999995 0 129.977420683628 0 0 1
+ 9999.99999999999 0 531.878055722463 0 0 1
+ 9999.99999999999 0 2278.38773166912 0 0 1
+ 10000 0 655.270165613504 0 0 1
+ 9999.99999999999 0 1435.79843966146 0 0 1
+ 9476.27200672039 -13.8946307732475 1109.66687773369 0 0 1.00000000867394
+ 9999.99999999999 0 472.541473724024 0 0 1
+ 9999.99999999996 0 204.795564417221 0 0 1
+ 7747.57701640847 960.733541583578 5913.628039068 0 0 1.00000000001925
+ 9999.99999999999 0 153.62765261903 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2583.57388157245 0 0 1
+ 8896.08857021247 -1116.81205362569 6429.65721245575 0 0 3.92118419601643
+ 7352.45606268249 596.730951464786 7047.29191965807 0 0 3.92118419762821
+ 9999.99999999999 0 3669.69573426502 0 0 1
+ 9117.69217362459 28.6643411668544 2621.21900309856 0 0 0.999999999975681
+ 9999.99999999999 0 420.821625073777 0 0 1
+ 10000 0 2025.81447725938 0 0 1
+ 9999.99999999998 0 224.133156947596 0 0 1
+ 9451.83759674704 72.9250631028373 3266.08276182158 0 0 0.999999999996346
+ 9999.99999999995 0 1743.10968335366 0 0 1.76598492290372
+ 10000 0 196.498976310289 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 1445.0233485703 0 0 1
+ 10000 0 132.722119567555 0 0 1
+ 10000 0 100 0 0 1
+ 8240.05724905916 -43.2316907952184 1230.81953858947 0 0 1.00000000021914
+ 9999.99999999999 0 382.831922147135 0 0 1
+ 9999.99999999995 0 168.106400494067 0 0 1
+ 7961.25979946583 -1464.9891609206 1314.65221068632 0 0 1.00000000000094
+ 9999.99999999999 0 978.573738732537 0 0 1
+ 10000 0 100 0 0 1
+ 8643.67731807435 -315.976106373066 4222.72127629105 0 0 0.999999999542644
+ 9889.43810680201 104.64684111962 1918.17752384315 0 0 1.00000000000287
+ 9999.99999999999 0 586.464309916727 0 0 1
+ 9999.99999999999 0 526.238450641492 0 0 1
+ 8022.63330707819 -797.017643113142 5860.74579793788 0 0 1.00000000032018
+ 8955.9726789877 271.210904976853 1884.97710047273 0 0 0.999999999971359
+ 9999.99999999999 0 474.495847129674 0 0 1
+ 10000 0 132.30109349744 0 0 1
+ 6768.90952441777 -1272.63498921796 4993.52170717816 0 0 0.999999999894894
+ 10000 0 100 0 0 1
+ 7686.72183722761 602.438397991883 3357.88463640875 0 0 1.00000000001925
+ 10000 0 5341.20799559546 0 0 1
+ 8153.70015245138 -92.9031192909907 2850.50639558075 0 0 0.999999999993607
+ 9557.90932030333 -173.2933434325 1750.54672858052 0 0 1.00000000000069
+ 9999.99999999999 0 1121.26840038095 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 923.013606401414 0 0 1
+ 10000 0 4148.32953197918 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999996 0 376.694592877425 0 0 1
+ 8152.85471977931 2331.98543713688 1963.52685231608 0 0 0.999999997951475
+ 9999.99999999999 0 3853.26037481566 0 0 3.92118419762768
+ 9764.46746620643 1882.79925420765 7339.6418824226 0 0 3.92118419760567
+ 9999.99999999999 0 1659.52099867488 0 0 1
+ 8942.48738902308 1868.38704022425 1895.08765841138 0 0 0.999999999998984
+ 9999.99999999999 0 1323.0091565573 0 0 1
+ 9999.99999999996 0 382.848746614946 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999994 0 2405.27977316213 0 0 1
+ 9999.99999999998 0 1106.05365874726 0 0 1
+ 8004.86291659699 23.0748490873019 3756.35632205071 0 0 1.00000000001645
+ 9347.94408254881 188.278268869818 2310.74421186336 0 0 1.00000000000352
+ 9999.99999999995 0 1217.82386107797 0 0 1
+ 7890.05560456705 -650.46658610621 1426.97072629313 0 0 0.999999972604412
+ 10000 0 100 0 0 1
+ 10000 0 370.226858434448 0 0 1
+ 7123.68937347448 -456.831458075971 2125.48046620769 0 0 1.00000000001307
+ 7785.50800095062 709.585973246716 4120.23891672797 0 0 0.99999999966984
+ 9999.99999999999 0 110.77066051562 0 0 1
+ 7018.95733893458 -1514.07161959347 3978.20255574646 0 0 0.99999999985371
+ 9999.99999999996 0 618.039748465053 0 0 1
+ 7580.05924918487 -387.560416485465 4691.3940659726 0 0 1.00000000048198
+ 9999.99999999999 0 330.134158701614 0 0 1
+ 9999.99999999999 0 843.74427064696 0 0 1
+ 9999.99999999999 0 743.284772064285 0 0 1
+ 7807.39713780963 1064.63616618439 1688.1247223352 0 0 0.999999999993268
+ 9999.99999999999 0 478.956057352721 0 0 1
+ 9999.99999999999 0 2436.507651744 0 0 3.92118419762769
+ 10000 0 1774.34110864407 0 0 3.92118419762768
+ 9999.99999999999 0 423.910544763324 0 0 1
+ 10000 0 5585.01893358054 0 0 15.0815345461401
+ 9999.99999999999 0 616.840540516684 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 413.703898758284 0 0 1
+ 10000 0 3717.96721012171 0 0 3.92118419762768
+ 9965.22228355065 118.182942452601 1302.07167850469 0 0 0.999999996972621
+ 9999.99999999999 0 763.538986384969 0 0 1
+ 9999.99999999999 0 1289.11256181122 0 0 1
+ 8564.04599980261 787.440661908109 7615.06716689619 0 0 3.92118419762813
+ 9999.99999999996 0 684.933239071221 0 0 1
+ 10000 0 924.882559799618 0 0 1
+ 9999.99999999995 0 633.503871351577 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 350.584152020162 0 0 1
+ 9999.99999999999 0 689.289866612611 0 0 1
+ 9999.99999999994 0 960.127639211884 0 0 1
+ 8833.13350901387 -645.673828795224 1076.02060479268 0 0 0.999999999750063
+ 6626.13208600101 -243.881592659642 3362.05971078282 0 0 0.99999999974362
+ 8506.51645435983 -207.358105557968 3264.16038337527 0 0 0.999999999997727
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 2137.33857250228 0 0 1
+ 9999.99999999999 0 173.769225669349 0 0 1
+ 7875.27758825772 1008.67033940829 1317.89734390249 0 0 0.999999997944414
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 502.090808658597 0 0 1
+ 9597.0225722918 130.004017259082 3403.2612062227 0 0 0.999999999999881
+ 9999.99999999999 0 187.312312424706 0 0 1
+ 10000 0 700.153410723569 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 1341.77183331798 0 0 1
+ 8817.12108009204 -284.686566721743 2875.66338126001 0 0 1.7659849228359
+ 9999.99999999995 0 392.869348845568 0 0 1
+ 9999.99999999999 0 1488.36017803641 0 0 1
+ 10000 0 632.095594369846 0 0 1
+ 9999.99999999999 0 221.04657031986 0 0 1
+ 9999.99999999998 0 274.369788646864 0 0 1
+ 9999.99999999999 0 256.934218816168 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 2608.24646949509 0 0 3.92118419762768
+ 9999.99999999995 0 337.541917589955 0 0 1
+ 8474.76633194412 24.8920444047601 1500.73802953379 0 0 1.0000000000003
+ 9999.99999999999 0 412.189011404229 0 0 1
+ 10000 0 212.138374119506 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999995 0 727.964891911906 0 0 1
+ 10000 0 1634.15883870929 0 0 1
+ 9999.99999999998 0 2369.23291529202 0 0 1
+ 8854.70236682679 12.2747454059988 2356.57043198297 0 0 1.00000000006707
+ 9999.99999999999 0 970.180970552922 0 0 1
+ 7931.86136260747 -806.524335510209 2195.35891594338 0 0 0.999999999999995
+ 8494.66309652341 -266.81318842408 2795.57614991366 0 0 0.99999999958984
+ 9999.99999999999 0 1080.42323100791 0 0 1
+ 9999.99999999999 0 1419.85314617832 0 0 1
+ 9999.99999999999 0 247.120104661134 0 0 1
+ 9996.68278716261 55.9619387180426 969.791011328924 0 0 0.999999999770411
+ 8998.04856480647 130.680787971162 1904.05003536547 0 0 1.00000000000004
+ 10000 0 100 0 0 1
+ 10000 0 100 0 0 1
+ 9001.06762241888 -811.73281008673 1513.0218624274 0 0 0.999999999999999
+ 10000 0 4349.42596645087 0 0 1
+ 10000 0 925.392136052652 0 0 1
+ 9999.99999999999 0 261.789406028032 0 0 1
+ 7695.19904017685 1443.27621886627 1962.29781720396 0 0 0.999999999996572
+ 10205.420435542 1504.57181405699 1028.63683115772 0 0 0.999999999999483
+ 9999.99999999999 0 1271.04856061647 0 0 1
+ 9999.99999999999 0 2599.72744502481 0 0 1
+ 9999.99999999999 0 465.209473806786 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 509.933628058367 0 0 1
+ 9999.99999999996 0 526.397025573253 0 0 1
+ 9999.99999999995 0 364.529586379006 0 0 1
+ 9999.99999999995 0 878.619809354589 0 0 1
+ 9999.99999999998 0 1428.04452964975 0 0 1
+ 9999.99999999998 0 304.260873017223 0 0 1
+ 8130.07180535445 -334.442374755362 2870.90721579353 0 0 0.999999999975384
+ 9487.51917773344 -245.756725848287 773.326752460378 0 0 0.999999999669485
+ 7575.20781656479 771.572024417188 3547.09807786529 0 0 1.00000000007341
+ 10000 0 6109.65136611065 0 0 3.92118419762768
+ 9999.99999999995 0 809.113158492554 0 0 1
+ 9999.99999999999 0 2244.53621104503 0 0 1
+ 9999.99999999999 0 1752.05128744795 0 0 1
+ 10000 0 100 0 0 1
+ 10000 0 3335.90789734822 0 0 1.76598492290372
+ 7424.78278470459 189.299986266042 3325.67803318745 0 0 0.999999999999978
+ 10000 0 1504.84323670756 0 0 1
+ 9999.99999999999 0 182.611128936949 0 0 1
+ 8279.37637733956 235.633571491514 3549.52118120705 0 0 1.00000000000103
+ 9802.31171603712 56.7402056097119 373.721070412721 0 0 0.99999999999989
+ 9999.99999999995 0 431.228979211111 0 0 1
+ 9999.99999999999 0 539.01883050743 0 0 1
+ 8235.75006267618 -41.2907279599651 2311.67592316644 0 0 1.0000000000039
+ 9999.99999999999 0 133.293062443337 0 0 1
+ 9999.99999999999 0 1263.01019951048 0 0 1
+ 6493.0004569607 1374.33852398884 3413.05357437035 0 0 0.999999999999972
+ 10000 0 6049.96764397895 0 0 3.92118419762769
+ 8838.09329582496 -98.8593855981032 1908.96581290753 0 0 0.999999999999564
+ 9999.99999999995 0 606.669771663854 0 0 1
+ 10000 0 180.37281900552 0 0 1
+ 10000 0 1163.96814106744 0 0 1
+ 9090.44993134601 -601.344296716137 1890.97332122074 0 0 0.999999999961951
+ 9999.99999999999 0 987.403579877555 0 0 1
+ 10000 0 2035.55336849201 0 0 1
+ 7770.27876228598 1108.43154561831 7135.64691325916 0 0 3.92118419810915
+ 9999.99999999999 0 452.20320947343 0 0 1
+ 9999.99999999994 0 361.107015095517 0 0 1
+ 9999.99999999995 0 359.976600718855 0 0 1
+ 9999.99999999999 0 801.331883205402 0 0 1
+ 9999.99999999999 0 2029.51105070802 0 0 1
+ 9931.54423704019 -190.669108549463 2629.72116038778 0 0 1.00000000000027
+ 10000 0 2372.693921655 0 0 1
+ 10000 0 6242.94334328368 0 0 3.92118419762768
+ 10000 0 6544.76664705093 0 0 3.92118419762768
+ 10000 0 1228.02278859217 0 0 1
+ 7312.88143349181 -264.458648697503 977.45880337946 0 0 1.00000000000017
+ 6593.89399272241 -352.049311844037 3470.9698510456 0 0 0.999999999197235
+ 7339.1657043068 -2515.72377140496 3587.41830517468 0 0 0.99999999930121
+ 9999.99999999999 0 2092.468459855 0 0 1.76598492290372
+ 9442.42193122035 173.682383114217 1261.69978036604 0 0 0.999999999999941
+ 10000 0 7959.85636478197 0 0 3.92118419762768
+ 8168.36342739951 414.440715787435 3667.72621233561 0 0 0.999999999999872
+ 9999.99999999999 0 633.948909880421 0 0 1
+ 9999.99999999995 0 279.736985382598 0 0 1
+ 9999.99999999999 0 1484.01387131938 0 0 1
+ 8350.3779589391 758.027652926847 2634.85750745198 0 0 1.00000000000003
+ 10023.7013655552 96.9653920701786 1282.57122144264 0 0 0.99999999995277
+ 7855.78658528887 -280.040709148233 3757.58819030881 0 0 0.999999999999958
+ 8778.59519323926 1021.89015681007 795.692990802492 0 0 0.999999999316667
+ 9999.99999999995 0 621.042281877048 0 0 1
+ 8244.0273082752 1836.87868039131 2288.44481680322 0 0 1.00000000000158
+ 10000 0 730.576242757102 0 0 3.92118419762768
+ 8343.8057331708 437.525969305738 3712.62355296123 0 0 1.0000000000012
+ 9999.99999999999 0 1675.65886722231 0 0 1
+ 9999.99999999998 0 870.412344702883 0 0 1
+ 6481.53374130179 -1673.18784254989 5122.95060326781 0 0 0.999999999999026
+ 9082.1054991282 -1981.16575701492 2519.95574369323 0 0 3.92118419705998
+ 9999.99999999999 0 5031.65634250558 0 0 1
+ 9532.41051988721 447.805558998292 680.274519199617 0 0 0.999999993459482
+ 10000 0 100 0 0 1
+ 9369.01390614142 -1246.22784242079 1631.91631484812 0 0 0.999999999991443
+ 8128.11529594419 -760.518954897056 1910.38603105252 0 0 0.999999996177434
+ 9064.31983566028 -11.2267625713338 623.66035852905 0 0 0.999999999694751
+ 9875.6352299573 68.5085072818747 1050.95032193301 0 0 0.999999999991139
+ 6919.71611492307 -150.116551093168 1608.49947928088 0 0 0.999999999999783
+ 9235.39690813508 -697.618086335282 4098.11477301768 0 0 1.00000000000111
+ 8946.29701982306 -1504.2476643706 1699.88817228232 0 0 0.999999998746462
+ 10000 0 5179.80715262218 0 0 1
+ 10000 0 1026.4366964457 0 0 3.92118419762768
+ 7463.69899482371 -1428.10662649113 2059.78820095448 0 0 0.999999999934775
+ 6958.18337399054 -374.400338505278 2989.8035087318 0 0 1.00000000000119
+ 7387.31574995271 2469.32493093879 6244.49937022605 0 0 0.999999999964853
+ 9487.86365430258 712.44969766482 1090.71114703625 0 0 1.00000000000039
+ 9999.99999999995 0 632.968891718508 0 0 1
+ 9999.99999999999 0 3660.25297690145 0 0 1
+ 7458.15417165816 -1461.58774275652 5707.92861137347 0 0 0.999999999999419
+ 8794.13561080726 514.236055186906 3629.43910133203 0 0 0.999999999999625
+ 9659.95518077553 472.242457274259 1211.24721589858 0 0 0.999999996970401
+ 10000 0 143.0986908986 0 0 1
+ 10000 0 6493.40530681099 0 0 3.92118419762768
+ 7746.47310670317 -674.92812146378 4473.26619661362 0 0 0.999999999962806
+ 6588.86392078535 921.833925450034 6708.44075581714 0 0 1.00000000003103
+ 9798.48315049165 449.268756740287 729.223090335034 0 0 0.999999999999994
+ 7768.73494812845 -1772.83453697143 2787.25738527595 0 0 0.99999999988694
+ 10000 0 6303.04661103846 0 0 3.92118419762768
+ 9907.97097702392 159.314468542012 888.105737278828 0 0 0.999999999771131
+ 9621.77916145178 -347.350548393187 1742.12681478554 0 0 0.999999999794172
+ 9092.20756323833 67.4145922607769 865.812771126627 0 0 0.999999999998742
+ 7754.92691346028 2142.81498160566 3336.39045345475 0 0 0.999999999952349
+ 9999.99999999999 0 2186.18426854049 0 0 1
+ 6604.77707245065 -6.84085568132824 3990.30886450406 0 0 1.00000000043844
+ 10000 0 2796.64598191164 0 0 3.92118419762768
+ 9999.99999999998 0 885.163764706534 0 0 1
+ 9530.2096896226 55.2935353218369 1400.91770710819 0 0 1.00000000000084
+ 9395.77925717873 -218.377575640519 896.376877774249 0 0 0.999999999991804
+ 9999.99999999996 0 464.661974893533 0 0 1
+ 10000 0 6711.779655943 0 0 3.92118419762768
+ 9999.99999999994 0 1950.14607166046 0 0 1.3023986520174
+ 9639.70976689644 -720.489128569381 6338.14603281992 0 0 3.9211841976163
+ 9999.99999999999 0 466.846314760762 0 0 1
+ 6746.63843107077 604.783252766991 5835.06623093043 0 0 1.00000000011464
+ 9999.99999999999 0 1423.04800713393 0 0 1
+ 9141.51663881162 -422.497525330373 1716.11074942484 0 0 1.00000000000156
+ 9756.99956486408 113.712202850483 1026.46146420261 0 0 0.9999999999973
+ 7731.99372429372 -1757.40600927739 3088.85952651509 0 0 0.999999998189201
+ 9637.92868982452 -805.406989771519 883.952339871731 0 0 0.999999999972694
+ 9999.99999999999 0 525.847591363408 0 0 1
+ 9868.89384976084 -118.802931064878 748.840477579529 0 0 0.999999999923579
+ 10000 0 297.165871053284 0 0 1
+ 10000 0 3663.43922509201 0 0 3.92118419762768
+ 9381.6169276451 792.856492648116 6856.08171266384 0 0 3.92118419939778
+ 10000 0 100 0 0 1
+ 6720.48743604859 -1111.42824689689 4613.1189422631 0 0 0.999999999999957
+ 9999.99999999995 0 1477.83205306323 0 0 1
+ 9512.33541857543 -1516.20863899961 1353.82789766023 0 0 1.76598492290354
+ 10000 0 3907.75577085265 0 0 3.92118419762768
+ 10000 0 2697.96054734092 0 0 3.92118419762768
+ 10000 0 6094.53836496687 0 0 3.92118419762768
+ 9999.99999999995 0 308.114229703987 0 0 1
+ 9999.99999999999 0 1532.19405017367 0 0 1
+ 9999.99999999995 0 409.363743355252 0 0 1
+ 9999.99999999998 0 1104.10274786236 0 0 1
+ 10000 0 635.322738095896 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999994 0 305.892135239794 0 0 1
+ 9999.99999999995 0 2195.0097087368 0 0 1
+ 7831.48230700994 -306.904435467717 1544.1557115617 0 0 1.00000000000012
+ 9999.99999999997 0 617.880723381141 0 0 1
+ 6808.24365428117 -1590.6244756225 4375.80868626945 0 0 0.999999999862288
+ 10000 0 2771.19291614344 0 0 1
+ 9058.77688830283 1994.45534008801 2571.24924504465 0 0 3.92118419738843
+ 9999.99999999999 0 6019.76191792543 0 0 3.92118419762768
+ 9999.99999999999 0 959.485990950066 0 0 1
+ 9999.99999999999 0 2246.42157896468 0 0 1
+ 9477.29887704667 99.5210859034416 652.205611397472 0 0 0.999999997734293
+ 10000 0 6287.64489862009 0 0 3.92118419762769
+ 7807.994357417 714.219563508071 4265.06523282624 0 0 0.999999999788073
+ 6006.44309183413 669.778325413699 4178.77394821889 0 0 1.00000000000007
+ 9773.63599604373 269.474651928299 2446.30864477508 0 0 0.999999999999854
+ 10000 0 5529.98691561794 0 0 1.76598492290372
+ 10000 0 6037.00804026922 0 0 3.92118419762768
+ 9380.66598550508 1156.65519273647 4334.73206286523 0 0 1.76598492280873
+ 9999.99999999999 0 1718.17531378154 0 0 1
+ 9671.74677348674 161.080126351457 1141.45023013971 0 0 0.9999999996894
+ 9999.99999999999 0 2793.91283025233 0 0 1
+ 7702.66060171657 840.734838025284 1110.06107551413 0 0 0.999999999996896
+ 8474.80036321945 28.6479784345046 1823.09633437949 0 0 1.00000000000033
+ 10000 0 556.845467320182 0 0 1
+ 10000 0 7840.30096896717 0 0 55.9000786094856
+ 10000 0 1076.10962030335 0 0 1
+ 9999.99999999995 0 162.166371898872 0 0 1
+ 10000 0 6332.62078289694 0 0 3.92118419762768
+ 9999.99999999999 0 2054.48193603553 0 0 1.13626225643042
+ 9999.99999999999 0 1780.356954179 0 0 1
+ 9999.99999999999 0 2927.76700231116 0 0 1.76598492290372
+ 10000 0 6049.26793386268 0 0 3.92118419762768
+ 9999.99999999999 0 1920.34639289236 0 0 1
+ 9999.99999999998 0 915.598545318178 0 0 1
+ 10000 0 100 0 0 1
+ 9552.63570603819 -123.035454120613 1144.09285887249 0 0 1.00000000000056
+ 10000 0 100 0 0 1
+ 7254.51041117799 583.45715830521 2953.94691432081 0 0 1.00000000000012
+ 9999.99999999999 0 253.244865662139 0 0 1
+ 10000 0 6142.43427679196 0 0 3.92118419762768
+ 10000 0 5351.80891799484 0 0 1
+ 9999.99999999999 0 1185.55369648744 0 0 1
+ 8012.61880791947 465.040945388468 3233.77095523705 0 0 1.00000000000004
+ 9999.99999999995 0 389.092859298262 0 0 1
+ 7080.14547022065 -491.412788210293 3860.69766932469 0 0 0.999999999999846
+ 9999.99999999999 0 423.252801979492 0 0 1
+ 10000 0 2749.5298398462 0 0 1
+ 9999.99999999999 0 3066.00938536556 0 0 1
+ 9999.99999999998 0 710.59110646079 0 0 1
+ 9999.99999999999 0 458.616912305574 0 0 1
+ 9999.99999999999 0 469.721988542388 0 0 1
+ 6996.51367309376 -368.618563146183 3310.3937010116 0 0 0.999999997700726
+ 9999.99999999999 0 1458.89650923144 0 0 1
+ 9999.99999999999 0 825.518641386293 0 0 1
+ 9870.31286241825 23.0200749503637 1649.53112027118 0 0 0.99999999974152
+ 9999.99999999999 0 790.702085112182 0 0 1
+ 10000 0 1198.0343407292 0 0 1
+ 9999.99999999999 0 901.034524237762 0 0 1
+ 10000 0 1362.90422573544 0 0 1
+ 10000 0 5887.35624401416 0 0 3.92118419762768
+ 9999.99999999995 0 357.674934174169 0 0 1
+ 8648.68013151736 -268.367379892981 5456.0965499959 0 0 0.999999991007426
+ 9999.99999999995 0 278.122629412466 0 0 1
+ 9999.99999999995 0 133.17655688573 0 0 1
+ 10000 0 1680.93487433075 0 0 1
+ 9999.99999999994 0 603.602990382902 0 0 1
+ 9999.99999999995 0 2138.86533506303 0 0 1
+ 6079.05136193116 892.098380806297 4032.50532141222 0 0 0.999999999999435
+ 9451.66595686734 65.4084290693087 2845.05987439131 0 0 0.999999999996345
+ 9437.39418603508 -776.371174967611 1328.1203722 0 0 0.999999994175266
+ 9999.99999999999 0 1584.54801802332 0 0 1
+ 9999.99999999996 0 119.500190269644 0 0 1
+ 10000 0 1665.33226985934 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 274.970552366296 0 0 1
+ 9972.35066329439 -86.9715585823709 619.342976420257 0 0 1.00000000000425
+ 7977.78935884644 238.721570576317 1527.18987357833 0 0 1.00000000000035
+ 9999.99999999999 0 3561.44625447414 0 0 1.76598492290372
+ 9999.99999999999 0 978.099603740729 0 0 1
+ 7765.19729777878 -487.13158022096 4080.76616321238 0 0 0.999999999999933
+ 9912.08652490391 22.4502013397197 529.013742549433 0 0 0.999999999922451
+ 6573.52752900436 1619.08585187949 5198.02315152365 0 0 0.999999999999713
+ 10000 0 898.328646366215 0 0 1
+ 7868.59851638385 107.044963419564 3489.25103280853 0 0 0.999999999999842
+ 9999.99999999999 0 739.252068429534 0 0 1
+ 10000 0 1991.54193384444 0 0 3.92118419762768
+ 9217.62248415898 366.799595420224 1244.3641590671 0 0 0.9999999999997
+ 10000 0 3295.62231425089 0 0 3.92118419762768
+ 9999.99999999999 0 350.354680881968 0 0 1
+ 9999.99999999995 0 472.322176483231 0 0 1
+ 10000 0 114.670025092303 0 0 1
+ 7386.46979697056 -1303.03833444625 2921.57571464428 0 0 0.999999999996842
+ 9576.47803839041 736.531790390832 6546.95110093428 0 0 3.92118419762849
+ 9999.99999999999 0 874.042683755957 0 0 1
+ 9999.99999999999 0 409.470927201336 0 0 1
+ 9999.99999999999 0 233.752839618715 0 0 1
+ 10000 0 2063.39241837766 0 0 3.92118419762768
+ 9321.56805633234 -78.0092534393139 1456.65192594476 0 0 1.00000000000001
+ 10000 0 196.343470667881 0 0 1
+ 9999.99999999995 0 167.068632518252 0 0 1
+ 5707.21457104234 819.465298844253 3756.13399254432 0 0 0.999999999959169
+ 10000 0 330.578512396694 0 0 3.92118419762768
+ 9999.99999999998 0 1115.45872061886 0 0 1
+ 10000 0 100 0 0 1
+ 9999.99999999998 0 635.15572613536 0 0 1
+ 7855.28204370986 1164.22829466298 5547.14942498478 0 0 0.999999999829481
+ 9999.99999999999 0 3995.4511582229 0 0 5.09269298023995
+ 8679.10758533574 182.05366681539 1557.9447526213 0 0 1.00000000000076
+ 9999.99999999999 0 635.045321324583 0 0 1
+ 9570.83544934327 -231.078900191578 1177.32792460115 0 0 0.999999999689292
+ 6430.66154590086 -2184.51256589873 4420.29431163426 0 0 0.999999999999994
+ 9999.99999999999 0 165.790134716648 0 0 1
+ 9999.99999999999 0 313.486494337402 0 0 1
+ 10000 0 3858.86987184346 0 0 3.92118419762768
+ 6915.70383630145 245.975838743509 5627.21540387398 0 0 1.00000000000754
+ 9999.99999999995 0 380.504682103964 0 0 1
+ 9999.99999999999 0 866.484426241064 0 0 1
+ 10000 0 963.392057489218 0 0 1
+ 10000 0 1881.42614658952 0 0 3.92118419762768
+ 8985.67634275614 34.1512359560156 1997.98493731454 0 0 1.00000000000004
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 383.744190797068 0 0 1
+ 10000 0 100 0 0 1
+ 6940.68927475598 -1812.01557433901 2082.53422434256 0 0 0.999999999962829
+ 9999.99999999995 0 308.983664771808 0 0 1
+ 9999.99999999995 0 440.917731031287 0 0 1
+ 9999.99999999999 0 409.429871533622 0 0 1
+ 9999.99999999999 0 963.89482348433 0 0 1
+ 7337.48616844413 -145.083203567935 2689.0217212131 0 0 1.00000000000034
+ 10000 0 770.040403751668 0 0 1
+ 9067.90938893652 -64.0782749756291 1690.08017618602 0 0 1.00000000016068
+ 10000 0 100 0 0 1
+ 9999.99999999999 0 1919.14951628988 0 0 1.76598492290372
+ 8628.81209897938 -284.008196392568 1869.42494840873 0 0 0.999999999999906
+ 10000 0 3902.37093688411 0 0 3.92118419762768
+ 8563.00928775915 178.095246498162 1825.10151664303 0 0 0.99999999999974
+ 10000 0 100 0 0 1
+ 10000 0 2615.14184332899 0 0 1
+ 9999.99999999999 0 425.781629222803 0 0 1
+ 10000 0 100 0 0 1
+ 9237.62995006016 103.977783084843 2045.23686902675 0 0 0.999999999999274
+ 9999.99999999999 0 3052.19600836964 0 0 1.76598492290372
+
+
+End
@@ -21,9 +21,9 @@
 ** =============================================================================
 */
 
-#include "mmgcommon_private.h"
+#ifndef MMGCMAKEDEFINEF_H
+#define MMGCMAKEDEFINEF_H
 
-#define MMG_EXTERN
-#define MMG_ASSIGN_NULL =NULL
+#define MMG5F_INT SELECTED_INT_KIND(9) /*!< Integer type for fortran */
 
-#include  "mmgexterns_private.h"
+#endif
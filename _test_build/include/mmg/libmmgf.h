@@ -0,0 +1,42 @@
+!/* =============================================================================
+!**  This file is part of the mmg software package for the tetrahedral
+!**  mesh modification.
+!**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+!**
+!**  mmg is free software: you can redistribute it and/or modify it
+!**  under the terms of the GNU Lesser General Public License as published
+!**  by the Free Software Foundation, either version 3 of the License, or
+!**  (at your option) any later version.
+!**
+!**  mmg is distributed in the hope that it will be useful, but WITHOUT
+!**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+!**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+!**  License for more details.
+!**
+!**  You should have received a copy of the GNU Lesser General Public
+!**  License and of the GNU General Public License along with mmg (in
+!**  files COPYING.LESSER and COPYING). If not, see
+!**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+!**  use this copy of the mmg distribution only if you accept them.
+!** =============================================================================
+!*/
+!
+!/**
+! * \file common/libmmgf.h
+! * \brief Wrapper for include files for the mmg library.
+! * \author Algiane Froehly (Inria / IMB, Université de Bordeaux)
+! * \version 5
+! * \date 01 2014
+! * \copyright GNU Lesser General Public License.
+! * \warning To keep the genheader working, don't break line between the enum
+! * name and the opening brace (it creates errors under windows)
+! */
+
+#ifndef MMGFLIB_H
+#define MMGFLIB_H
+
+#include "mmg/mmg2d/libmmg2df.h"
+#include "mmg/mmgs/libmmgsf.h"
+#include "mmg/mmg3d/libmmg3df.h"
+
+#endif
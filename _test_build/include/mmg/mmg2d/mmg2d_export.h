@@ -0,0 +1,34 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+#ifndef MMG2D_EXPORT_H
+#define MMG2D_EXPORT_H
+
+#include "mmg/common/mmg_export.h"
+#if  defined(libmmg_so_EXPORTS) || defined(libmmg2d_so_EXPORTS)
+#  define LIBMMG2D_EXPORT MMG_DECL_EXPORT
+#else
+#  define LIBMMG2D_EXPORT MMG_DECL_IMPORT
+#endif
+
+#endif
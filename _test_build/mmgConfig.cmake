@@ -0,0 +1,51 @@
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was mmgConfig.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+include(CMakeFindDependencyMacro)
+
+# Allows us to use all .cmake files in this directory
+# required for `find_dependency({SCOTCH,VTK}) to work.
+list(INSERT CMAKE_MODULE_PATH 0 "${CMAKE_CURRENT_LIST_DIR}")
+
+if("FALSE" AND NOT "" MATCHES OFF)
+  find_dependency(SCOTCH)
+endif()
+
+if("0" AND NOT "" MATCHES OFF)
+  find_dependency(VTK)
+endif()
+
+if("TRUE" AND NOT "" MATCHES OFF)
+  find_dependency(OpenMP)
+endif()
+
+if("TRUE" AND NOT "" MATCHES OFF)
+  find_dependency(ZLIB)
+endif()
+
+if (NOT TARGET Mmg::mmg )
+  include(${CMAKE_CURRENT_LIST_DIR}/MmgTargets.cmake)
+endif ()
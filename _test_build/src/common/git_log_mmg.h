@@ -0,0 +1,6 @@
+#ifndef _GIT_LOG_MMG_H
+#define _GIT_LOG_MMG_H
+#define MMG_GIT_BRANCH "master"
+#define MMG_GIT_COMMIT "8f082d182ecf4a686d9049e1526b5cd365af8eff"
+#define MMG_GIT_DATE   "2026-10-18 09:02:51 +0000"
+#endif
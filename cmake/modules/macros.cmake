@@ -171,6 +171,11 @@ MACRO ( ADD_AND_INSTALL_LIBRARY
 
   TARGET_LINK_LIBRARIES ( ${target_name} PRIVATE ${LIBRARIES} )
 
+  IF ( OPENMP_FOUND AND NOT USE_OPENMP MATCHES OFF )
+    # the OpenMP runtime is needed by any code linking a static lib
+    TARGET_LINK_LIBRARIES ( ${target_name} PUBLIC OpenMP::OpenMP_C )
+  ENDIF ( )
+
   IF (NOT CMAKE_INSTALL_LIBDIR)
     SET(CMAKE_INSTALL_LIBDIR lib)
   ENDIF()
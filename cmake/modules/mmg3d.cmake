@@ -238,6 +238,49 @@ IF ( BUILD_TESTING )
 
     ENDIF ( )
 
+    # Compressed files: write a .mesh.gz and a .sol.gz, read them back and
+    # write binary compressed files, then read the binary files
+    SET ( GZ_INPUT_DIR ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a )
+
+    ADD_TEST(NAME mmg3d_gz_ascii_out
+      COMMAND ${EXECUT_MMG3D} -v 5
+      -in ${GZ_INPUT_DIR}/cube.mesh -sol ${GZ_INPUT_DIR}/cube.sol
+      -out ${CTEST_OUTPUT_DIR}/mmg3d_gz-cube.o.mesh.gz
+      )
+    SET_TESTS_PROPERTIES ( mmg3d_gz_ascii_out
+      PROPERTIES FIXTURES_SETUP mmg3d_gz_ascii )
+
+    ADD_TEST(NAME mmg3d_gz_ascii_in
+      COMMAND ${EXECUT_MMG3D} -v 5
+      -in ${CTEST_OUTPUT_DIR}/mmg3d_gz-cube.o.mesh.gz
+      -sol ${CTEST_OUTPUT_DIR}/mmg3d_gz-cube.o.sol.gz
+      -out ${CTEST_OUTPUT_DIR}/mmg3d_gz-cube.o2.meshb.gz
+      )
+    SET_TESTS_PROPERTIES ( mmg3d_gz_ascii_in
+      PROPERTIES FIXTURES_REQUIRED mmg3d_gz_ascii
+      FIXTURES_SETUP mmg3d_gz_binary )
+
+    ADD_TEST(NAME mmg3d_gz_binary_in
+      COMMAND ${EXECUT_MMG3D} -v 5 -noinsert -noswap -nomove
+      -in ${CTEST_OUTPUT_DIR}/mmg3d_gz-cube.o2.meshb.gz
+      -sol ${CTEST_OUTPUT_DIR}/mmg3d_gz-cube.o2.sol.gz
+      -out ${CTEST_OUTPUT_DIR}/mmg3d_gz-cube.o3.meshb
+      )
+    SET_TESTS_PROPERTIES ( mmg3d_gz_binary_in
+      PROPERTIES FIXTURES_REQUIRED mmg3d_gz_binary )
+
+    IF ( (NOT ZLIB_FOUND) OR USE_ZLIB MATCHES OFF OR WIN32 )
+      SET(expr "mmg has been built without zlib support")
+      SET_PROPERTY(
+        TEST mmg3d_gz_ascii_out mmg3d_gz_ascii_in mmg3d_gz_binary_in
+        PROPERTY PASS_REGULAR_EXPRESSION "${expr}")
+    ELSE ( )
+      # the compressed solutions must be read
+      SET_PROPERTY(
+        TEST mmg3d_gz_ascii_in mmg3d_gz_binary_in
+        PROPERTY FAIL_REGULAR_EXPRESSION "NOT FOUND")
+    ENDIF ( )
+
   ENDIF ( MMG3D_CI )
 
 ENDIF ( BUILD_TESTING )
@@ -165,3 +165,79 @@ IF ( VTK_FOUND AND NOT USE_VTK MATCHES OFF)
 
   SET( LIBRARIES ${VTK_LIBRARIES} ${LIBRARIES} )
 ENDIF ( )
+
+############################################################################
+#####
+#####         OpenMP (to run some mesh sweeps on several threads)
+#####
+############################################################################
+# add OpenMP support?
+SET ( USE_OPENMP "" CACHE STRING "Use OpenMP to parallelize mesh sweeps (ON, OFF or <empty>)" )
+SET_PROPERTY(CACHE USE_OPENMP PROPERTY STRINGS "ON" "OFF" "")
+
+IF ( NOT DEFINED USE_OPENMP OR USE_OPENMP STREQUAL "" OR USE_OPENMP MATCHES " +" )
+  # Variable is not provided by user
+  FIND_PACKAGE(OpenMP QUIET)
+
+ELSE ()
+  IF ( USE_OPENMP )
+    # User wants to use OpenMP
+    FIND_PACKAGE(OpenMP)
+    IF ( NOT OPENMP_FOUND )
+      MESSAGE ( FATAL_ERROR "OpenMP not found: your compiler may not support it." )
+    ENDIF ( )
+  ENDIF ( )
+
+ENDIF ( )
+
+IF ( OPENMP_FOUND AND NOT USE_OPENMP MATCHES OFF )
+  add_definitions(-DUSE_OPENMP)
+
+  MESSAGE(STATUS "Compilation with OpenMP")
+
+  IF ( NOT TARGET OpenMP::OpenMP_C )
+    # Imported target is provided by FindOpenMP since CMake 3.9 only
+    ADD_LIBRARY ( OpenMP::OpenMP_C INTERFACE IMPORTED )
+    SET_PROPERTY ( TARGET OpenMP::OpenMP_C PROPERTY
+      INTERFACE_COMPILE_OPTIONS ${OpenMP_C_FLAGS} )
+    SET_PROPERTY ( TARGET OpenMP::OpenMP_C PROPERTY
+      INTERFACE_LINK_LIBRARIES ${OpenMP_C_FLAGS} )
+  ENDIF ( )
+
+  # needed by any target that compiles the sources
+  SET( LIBRARIES OpenMP::OpenMP_C ${LIBRARIES})
+ENDIF()
+
+############################################################################
+#####
+#####         zlib (to read and write gzip-compressed files)
+#####
+############################################################################
+# add zlib support?
+SET ( USE_ZLIB "" CACHE STRING "Use zlib to read and write compressed (.gz) mesh and solution files (ON, OFF or <empty>)" )
+SET_PROPERTY(CACHE USE_ZLIB PROPERTY STRINGS "ON" "OFF" "")
+
+IF ( NOT DEFINED USE_ZLIB OR USE_ZLIB STREQUAL "" OR USE_ZLIB MATCHES " +" )
+  # Variable is not provided by user
+  FIND_PACKAGE(ZLIB QUIET)
+
+ELSE ()
+  IF ( USE_ZLIB )
+    # User wants to use zlib
+    FIND_PACKAGE(ZLIB)
+    IF ( NOT ZLIB_FOUND )
+      MESSAGE ( FATAL_ERROR "zlib library not found: it is needed to read and "
+        "write compressed files. If you have already installed zlib and want to "
+        "use it, please set the CMake variable ZLIB_ROOT to your zlib directory.")
+    ENDIF ( )
+  ENDIF ( )
+
+ENDIF ( )
+
+IF ( ZLIB_FOUND AND NOT USE_ZLIB MATCHES OFF )
+  add_definitions(-DUSE_ZLIB)
+  INCLUDE_DIRECTORIES(${ZLIB_INCLUDE_DIRS})
+
+  MESSAGE(STATUS "Compilation with zlib: ${ZLIB_LIBRARIES}")
+  SET( LIBRARIES ${ZLIB_LIBRARIES} ${LIBRARIES})
+ENDIF()
@@ -0,0 +1,295 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * Test of the ASCII tokenizer: write structured meshes in ASCII Medit files
+ * with comments, with LF or CRLF ends of line, with the Vertices keyword cut
+ * by the end of the read buffer of the tokenizer, and with a Vertices section
+ * large enough to be parsed by blocks on several threads, then check the
+ * entities read by MMG3D_loadMesh and that the memory counter of the mesh is
+ * the one of the binary read of the same mesh.
+ *
+ * Usage: ascii-tokenizer dir where dir is the directory of the written files.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Include the mmg3d library hader file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+#include "libmmg3d_private.h"
+
+/* Index of vertex (i,j,k) of the grid */
+#define TOK_IDX(i,j,k) ( 1 + (i) + (n+1)*((j) + (n+1)*(k)) )
+
+/* Kuhn decomposition of a cube along its diagonal 0-7 */
+static const int kuhn[6][4] = { {0,1,3,7}, {0,3,2,7}, {0,2,6,7},
+                                {0,6,4,7}, {0,4,5,7}, {0,5,1,7} };
+
+/**
+ * \param inm pointer to the file.
+ * \param eol end of line.
+ * \param pad offset of the next keyword.
+ *
+ * Write comment lines until the offset \a pad of the file (nothing is done if
+ * \a pad is smaller than the current offset plus 8).
+ */
+static void tok_pad(FILE *inm,const char *eol,long pad) {
+  long rem,len,l;
+
+  rem = pad - ftell(inm);
+  if ( rem < 8 ) return;
+
+  while ( rem > 0 ) {
+    len = rem <= 64 ? rem : ( rem < 72 ? 32 : 64 );
+    fputc('#',inm);
+    for ( l=0; l<len-1-(long)strlen(eol); ++l ) {
+      fputc(l%8 ? 'x' : ' ',inm);
+    }
+    fputs(eol,inm);
+    rem -= len;
+  }
+}
+
+/**
+ * \param name name of the file.
+ * \param n number of cells per side of the grid.
+ * \param nt number of cells per side of the meshed part of the grid.
+ * \param eol end of line.
+ * \param pad offset of the Vertices keyword (0 if no padding).
+ * \return 1 if success, 0 otherwise.
+ *
+ * Write the vertices of a grid of \a n cells per side of step 1/8 and the
+ * tetrahedra of the Kuhn decomposition of its first \a nt cells per side.
+ */
+static int tok_write(const char *name,MMG5_int n,MMG5_int nt,const char *eol,
+                     long pad) {
+  FILE     *inm;
+  MMG5_int i,j,k,l,v[8];
+
+  inm = fopen(name,"wb");
+  if ( !inm ) {
+    fprintf(stderr,"  ## Error: unable to open %s.\n",name);
+    return 0;
+  }
+
+  fprintf(inm,"MeshVersionFormatted 2%s",eol);
+  fprintf(inm,"# comment with keywords and numbers: Vertices 12 Tetrahedra 3.5%s%s",
+          eol,eol);
+  fprintf(inm,"Dimension 3%s",eol);
+  tok_pad(inm,eol,pad);
+
+  fprintf(inm,"Vertices%s%" MMG5_PRId "%s",eol,(n+1)*(n+1)*(n+1),eol);
+  for (k=0; k<=n; k++) {
+    for (j=0; j<=n; j++) {
+      for (i=0; i<=n; i++) {
+        fprintf(inm,"%.3f %.3f %.3f %" MMG5_PRId "%s",i/8.,j/8.,k/8.,
+                (i+j+k)%5,eol);
+      }
+    }
+  }
+
+  fprintf(inm,"%s# Kuhn decomposition%s",eol,eol);
+  fprintf(inm,"Tetrahedra%s%" MMG5_PRId "%s",eol,6*nt*nt*nt,eol);
+  for (k=0; k<nt; k++) {
+    for (j=0; j<nt; j++) {
+      for (i=0; i<nt; i++) {
+        for (l=0; l<8; l++) {
+          v[l] = TOK_IDX(i+(l&1),j+((l>>1)&1),k+((l>>2)&1));
+        }
+        for (l=0; l<6; l++) {
+          fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId
+                  " %" MMG5_PRId "%s",v[kuhn[l][0]],v[kuhn[l][1]],
+                  v[kuhn[l][2]],v[kuhn[l][3]],l,eol);
+        }
+      }
+    }
+  }
+  fprintf(inm,"%sEnd%s",eol,eol);
+
+  fclose(inm);
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param n number of cells per side of the grid.
+ * \param nt number of cells per side of the meshed part of the grid.
+ * \return 1 if the mesh is the one written by \ref tok_write, 0 otherwise.
+ */
+static int tok_check(MMG5_pMesh mesh,MMG5_int n,MMG5_int nt) {
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  MMG5_int    i,j,k,l,m,v[8],ne;
+
+  if ( mesh->np != (n+1)*(n+1)*(n+1) || mesh->ne != 6*nt*nt*nt ) {
+    fprintf(stderr,"  ## Error: %" MMG5_PRId " vertices and %" MMG5_PRId
+            " tetrahedra read.\n",mesh->np,mesh->ne);
+    return 0;
+  }
+
+  for (k=0; k<=n; k++) {
+    for (j=0; j<=n; j++) {
+      for (i=0; i<=n; i++) {
+        ppt = &mesh->point[TOK_IDX(i,j,k)];
+        if ( ppt->c[0] != i/8. || ppt->c[1] != j/8. || ppt->c[2] != k/8. ||
+             ppt->ref != (i+j+k)%5 ) {
+          fprintf(stderr,"  ## Error: wrong vertex %" MMG5_PRId ".\n",
+                  TOK_IDX(i,j,k));
+          return 0;
+        }
+      }
+    }
+  }
+
+  /* The tetrahedra may have been reoriented */
+  ne = 0;
+  for (k=0; k<nt; k++) {
+    for (j=0; j<nt; j++) {
+      for (i=0; i<nt; i++) {
+        for (l=0; l<8; l++) {
+          v[l] = TOK_IDX(i+(l&1),j+((l>>1)&1),k+((l>>2)&1));
+        }
+        for (l=0; l<6; l++) {
+          pt = &mesh->tetra[++ne];
+          for (m=0; m<4; m++) {
+            if ( pt->v[0] != v[kuhn[l][m]] && pt->v[1] != v[kuhn[l][m]] &&
+                 pt->v[2] != v[kuhn[l][m]] && pt->v[3] != v[kuhn[l][m]] ) break;
+          }
+          if ( m < 4 || pt->ref != l ) {
+            fprintf(stderr,"  ## Error: wrong tetrahedron %" MMG5_PRId ".\n",ne);
+            return 0;
+          }
+        }
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * \param dir directory of the files.
+ * \param n number of cells per side of the grid.
+ * \param nt number of cells per side of the meshed part of the grid.
+ * \param eol end of line.
+ * \param pad offset of the Vertices keyword (0 if no padding).
+ * \param nthreads number of threads used to read the file.
+ * \return 1 if success, 0 otherwise.
+ *
+ * Write the ASCII file, read it and check the mesh and the memory counter.
+ */
+static int tok_test(const char *dir,MMG5_int n,MMG5_int nt,const char *eol,
+                    long pad,int nthreads) {
+  MMG5_pMesh mmgMesh[2];
+  MMG5_pSol  mmgSol[2];
+  char       *name;
+  int        i,ier;
+
+  name = (char*)malloc(strlen(dir)+32);
+  if ( !name )  return 0;
+
+  ier = 0;
+  for (i=0; i<2; i++) {
+    mmgMesh[i] = NULL;
+    mmgSol[i]  = NULL;
+    MMG3D_Init_mesh(MMG5_ARG_start,
+                    MMG5_ARG_ppMesh,&mmgMesh[i],MMG5_ARG_ppMet,&mmgSol[i],
+                    MMG5_ARG_end);
+    if ( !MMG3D_Set_iparameter(mmgMesh[i],mmgSol[i],MMG3D_IPARAM_verbose,-1) )
+      goto end;
+    if ( !MMG3D_Set_iparameter(mmgMesh[i],mmgSol[i],MMG3D_IPARAM_threads,
+                               nthreads) )
+      goto end;
+  }
+
+  /** 1) Read the ASCII file */
+  sprintf(name,"%s/ascii-tokenizer.mesh",dir);
+  if ( !tok_write(name,n,nt,eol,pad) )  goto end;
+
+  if ( MMG3D_loadMesh(mmgMesh[0],name) != 1 || !tok_check(mmgMesh[0],n,nt) ) {
+    fprintf(stderr,"  ## Error: wrong read of the file with %s ends of line,"
+            " padding %ld and %d thread(s).\n",strlen(eol)>1 ? "CRLF" : "LF",
+            pad,nthreads);
+    goto end;
+  }
+
+  /** 2) The tokenizer buffers are released from the memory counter: it is the
+   * one of the binary read */
+  sprintf(name,"%s/ascii-tokenizer.meshb",dir);
+  if ( MMG3D_saveMesh(mmgMesh[0],name) != 1 )  goto end;
+  if ( MMG3D_loadMesh(mmgMesh[1],name) != 1 )  goto end;
+
+  if ( mmgMesh[0]->memCur != mmgMesh[1]->memCur ) {
+    fprintf(stderr,"  ## Error: memory counter of %zu bytes after the ASCII"
+            " read instead of %zu.\n",mmgMesh[0]->memCur,mmgMesh[1]->memCur);
+    goto end;
+  }
+  ier = 1;
+
+end:
+  for (i=0; i<2; i++) {
+    MMG3D_Free_all(MMG5_ARG_start,
+                   MMG5_ARG_ppMesh,&mmgMesh[i],MMG5_ARG_ppMet,&mmgSol[i],
+                   MMG5_ARG_end);
+  }
+  free(name);
+
+  return ier;
+}
+
+int main(int argc,char *argv[]) {
+  const char *eol[2] = { "\n", "\r\n" };
+  long       s;
+  int        i;
+
+  fprintf(stdout,"  -- TEST OF THE ASCII TOKENIZER \n");
+
+  if ( argc != 2 ) {
+    printf(" Usage: %s dir\n",argv[0]);
+    return(1);
+  }
+
+  for (i=0; i<2; i++) {
+    /** 1) Comments and small mesh */
+    if ( !tok_test(argv[1],2,2,eol[i],0,1) )  return EXIT_FAILURE;
+
+    /** 2) Vertices keyword, number of vertices and first coordinates cut by
+     * the end of the read buffer */
+    for (s=-16; s<=4; s++) {
+      if ( !tok_test(argv[1],2,2,eol[i],MMG5_TXTBUF_LGTH+s,1) )
+        return EXIT_FAILURE;
+    }
+
+    /** 3) Vertices section parsed in parallel by several blocks */
+    if ( !tok_test(argv[1],80,2,eol[i],0,2) )  return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,150 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * Benchmark of the tetra adjacency builders: build the adjacency of a
+ * structured cube with 1, 2, 4... threads (the hash table is used on 1 thread
+ * and the parallel sort otherwise), print the time of each build and check
+ * that all the builds give the adjacency of the serial one.
+ *
+ * Usage: hash-tetra-bench [n [nthreads]] where n is the number of cells per
+ * side of the cube (6n^3 tetra) and nthreads the maximal number of threads.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Include the mmg3d library hader file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+#include "libmmg3d_private.h"
+
+/* Index of vertex (i,j,k) of the cube */
+#define BENCH_IDX(i,j,k) ( 1 + (i) + (n+1)*((j) + (n+1)*(k)) )
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mmgMesh;
+  MMG5_pSol       mmgSol;
+  MMG5_int        *ref,n,np,ne,i,j,k,l,v[8];
+  double          t;
+  int             nt,ntmax,ier;
+  /* Kuhn decomposition of a cube along its diagonal 0-7 */
+  static const int kuhn[6][4] = { {0,1,3,7}, {0,3,2,7}, {0,2,6,7},
+                                  {0,6,4,7}, {0,4,5,7}, {0,5,1,7} };
+
+  fprintf(stdout,"  -- BENCHMARK OF THE TETRA ADJACENCY BUILDERS \n");
+
+  if ( argc > 3 ) {
+    printf(" Usage: %s [n [nthreads]]\n",argv[0]);
+    return(1);
+  }
+
+  n     = argc > 1 ? atoi(argv[1]) : 20;
+  ntmax = argc > 2 ? atoi(argv[2]) : 4;
+  if ( n < 1 || ntmax < 1 ) {
+    printf(" Usage: %s [n [nthreads]]\n",argv[0]);
+    return(1);
+  }
+
+  mmgMesh = NULL;
+  mmgSol  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                  MMG5_ARG_end);
+
+  if ( !MMG3D_Set_iparameter(mmgMesh,mmgSol,MMG3D_IPARAM_verbose,-1) )
+    return EXIT_FAILURE;
+
+  /** 1) Build the structured cube */
+  np = (n+1)*(n+1)*(n+1);
+  ne = 6*n*n*n;
+  if ( MMG3D_Set_meshSize(mmgMesh,np,ne,0,0,0,0) != 1 )  return EXIT_FAILURE;
+
+  for (k=0; k<=n; k++) {
+    for (j=0; j<=n; j++) {
+      for (i=0; i<=n; i++) {
+        if ( MMG3D_Set_vertex(mmgMesh,(double)i/n,(double)j/n,(double)k/n,
+                              0,BENCH_IDX(i,j,k)) != 1 )
+          return EXIT_FAILURE;
+      }
+    }
+  }
+
+  ne = 0;
+  for (k=0; k<n; k++) {
+    for (j=0; j<n; j++) {
+      for (i=0; i<n; i++) {
+        for (l=0; l<8; l++) {
+          v[l] = BENCH_IDX(i+(l&1),j+((l>>1)&1),k+((l>>2)&1));
+        }
+        for (l=0; l<6; l++) {
+          if ( MMG3D_Set_tetrahedron(mmgMesh,v[kuhn[l][0]],v[kuhn[l][1]],
+                                     v[kuhn[l][2]],v[kuhn[l][3]],0,++ne) != 1 )
+            return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  /** 2) Build the adjacency with an increasing number of threads */
+  ref = (MMG5_int*)malloc((4*ne+5)*sizeof(MMG5_int));
+  if ( !ref )  return EXIT_FAILURE;
+
+  ier = EXIT_SUCCESS;
+  for (nt=1; nt<=ntmax; nt*=2) {
+    if ( !MMG3D_Set_iparameter(mmgMesh,mmgSol,MMG3D_IPARAM_threads,nt) )
+      return EXIT_FAILURE;
+
+    MMG5_DEL_MEM(mmgMesh,mmgMesh->adja);
+
+    t = MMG5_walltime();
+    if ( !MMG3D_hashTetra(mmgMesh,0) )  return EXIT_FAILURE;
+    t = MMG5_walltime() - t;
+
+    fprintf(stdout,"  %d thread(s) (%d used): %" MMG5_PRId " tetra in %.3f s"
+            " (%.1f Mtet/s)\n",nt,MMG5_nthreads(mmgMesh,ne),ne,t,
+            t > 0. ? 1.e-6*ne/t : 0.);
+
+    if ( nt == 1 ) {
+      memcpy(ref,mmgMesh->adja,(4*ne+5)*sizeof(MMG5_int));
+    }
+    else if ( memcmp(ref,mmgMesh->adja,(4*ne+5)*sizeof(MMG5_int)) ) {
+      fprintf(stderr,"  ## Error: adjacency built with %d threads differs from"
+              " the serial one.\n",nt);
+      ier = EXIT_FAILURE;
+    }
+  }
+  free(ref);
+
+  MMG3D_Free_all(MMG5_ARG_start,
+                 MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                 MMG5_ARG_end);
+
+  return ier;
+}
@@ -0,0 +1,264 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * Benchmark of the PROctree: fill a PROctree with half of the vertices of a
+ * jittered grid, filter the other half (MMG3D_PROctreein_iso), move and delete
+ * the stored vertices, print the rate of each operation and check the filter
+ * answers against a brute force search among the neighbouring grid vertices.
+ *
+ * Usage: proctree-bench [n [nv]] where n is the number of vertices per side
+ * of the grid and nv the maximal number of vertices per PROctree cell.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Include the mmg3d library hader file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+#include "libmmg3d_private.h"
+
+/* Index of vertex (i,j,k) of the grid */
+#define BENCH_IDX(i,j,k) ( 1 + (i) + n*((j) + n*(k)) )
+
+/* Filter threshold: vertices closer than BENCH_LMAX/n are rejected */
+#define BENCH_LMAX 0.9
+
+/* Deterministic pseudo-random number in [-0.5,0.5[ */
+static double bench_rand(unsigned int *seed) {
+  *seed = 1103515245u * (*seed) + 12345u;
+  return (double)((*seed >> 8) & 0xffff) / 65536. - 0.5;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param n number of vertices per side of the grid.
+ * \param ip index of the vertex to check.
+ * \return 1 if no stored vertex (even index) lies closer than BENCH_LMAX/n to
+ * \a ip, 0 otherwise.
+ *
+ * Brute force filter: the jitter of the vertices being smaller than a quarter
+ * of the grid step, the close vertices are in the neighbouring grid cells.
+ */
+static int bench_filter(MMG5_pMesh mesh,MMG5_int n,MMG5_int ip) {
+  MMG5_pPoint ppt,pp1;
+  MMG5_int    i,j,k,i1,j1,k1,ip1;
+  double      d2,ux,uy,uz,h2;
+
+  ppt = &mesh->point[ip];
+  h2  = BENCH_LMAX*BENCH_LMAX/(double)(n*n);
+
+  i = (ip-1) % n;
+  j = ((ip-1) / n) % n;
+  k = (ip-1) / (n*n);
+
+  for (k1=MG_MAX(k-1,0); k1<=MG_MIN(k+1,n-1); k1++) {
+    for (j1=MG_MAX(j-1,0); j1<=MG_MIN(j+1,n-1); j1++) {
+      for (i1=MG_MAX(i-1,0); i1<=MG_MIN(i+1,n-1); i1++) {
+        ip1 = BENCH_IDX(i1,j1,k1);
+        if ( ip1 % 2 ) continue;
+
+        pp1 = &mesh->point[ip1];
+        ux  = pp1->c[0] - ppt->c[0];
+        uy  = pp1->c[1] - ppt->c[1];
+        uz  = pp1->c[2] - ppt->c[2];
+        d2  = ux*ux + uy*uy + uz*uz;
+        if ( d2 < h2 ) return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param q pointer to the PROctree.
+ * \param n number of vertices per side of the grid.
+ * \param nacc number of accepted vertices.
+ * \return the time of the filter, -1 if it differs from the brute force one.
+ *
+ * Filter the vertices of odd index with the PROctree.
+ */
+static double bench_filterAll(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree q,
+                              MMG5_int n,MMG5_int *nacc) {
+  MMG5_int ip;
+  double   t;
+  char     *acc;
+
+  acc = (char*)malloc(mesh->np+1);
+  if ( !acc ) return -1.;
+
+  t = MMG5_walltime();
+  for (ip=1; ip<=mesh->np; ip+=2) {
+    acc[ip] = (char)MMG3D_PROctreein_iso(mesh,met,q,ip,BENCH_LMAX);
+  }
+  t = MMG5_walltime() - t;
+
+  *nacc = 0;
+  for (ip=1; ip<=mesh->np; ip+=2) {
+    if ( acc[ip] != bench_filter(mesh,n,ip) ) {
+      fprintf(stderr,"  ## Error: PROctree filter of vertex %" MMG5_PRId
+              " differs from the brute force one.\n",ip);
+      free(acc);
+      return -1.;
+    }
+    *nacc += acc[ip];
+  }
+  free(acc);
+
+  return t;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mmgMesh;
+  MMG5_pSol       mmgSol;
+  MMG5_pPoint     ppt;
+  MMG3D_pPROctree q;
+  MMG5_int        n,np,nq,nacc,ip,i,j,k;
+  double          t,c[3];
+  unsigned int    seed;
+  int             nv;
+
+  fprintf(stdout,"  -- BENCHMARK OF THE PROCTREE \n");
+
+  if ( argc > 3 ) {
+    printf(" Usage: %s [n [nv]]\n",argv[0]);
+    return(1);
+  }
+
+  n  = argc > 1 ? atoi(argv[1]) : 40;
+  nv = argc > 2 ? atoi(argv[2]) : MMG5_PROCTREE;
+  if ( n < 2 || nv < 1 ) {
+    printf(" Usage: %s [n [nv]]\n",argv[0]);
+    return(1);
+  }
+
+  mmgMesh = NULL;
+  mmgSol  = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                  MMG5_ARG_end);
+
+  if ( !MMG3D_Set_iparameter(mmgMesh,mmgSol,MMG3D_IPARAM_verbose,-1) )
+    return EXIT_FAILURE;
+
+  /** 1) Jittered grid of [0,1]^3 (coherent numbering) and constant size */
+  np = n*n*n;
+  if ( MMG3D_Set_meshSize(mmgMesh,np,0,0,0,0,0) != 1 )  return EXIT_FAILURE;
+  if ( MMG3D_Set_solSize(mmgMesh,mmgSol,MMG5_Vertex,np,MMG5_Scalar) != 1 )
+    return EXIT_FAILURE;
+
+  seed = 1;
+  for (k=0; k<n; k++) {
+    for (j=0; j<n; j++) {
+      for (i=0; i<n; i++) {
+        ip = BENCH_IDX(i,j,k);
+        if ( MMG3D_Set_vertex(mmgMesh,
+                              (i+0.5+0.4*bench_rand(&seed))/n,
+                              (j+0.5+0.4*bench_rand(&seed))/n,
+                              (k+0.5+0.4*bench_rand(&seed))/n,0,ip) != 1 )
+          return EXIT_FAILURE;
+        if ( MMG3D_Set_scalarSol(mmgSol,1./n,ip) != 1 )  return EXIT_FAILURE;
+      }
+    }
+  }
+
+  /** 2) Store the vertices of even index: the other ones are hidden */
+  nq = 0;
+  for (ip=1; ip<=np; ip++) {
+    mmgMesh->point[ip].tag = (ip % 2) ? MG_NUL : 0;
+    nq += (ip % 2) ? 0 : 1;
+  }
+
+  t = MMG5_walltime();
+  if ( !MMG3D_initPROctree(mmgMesh,&q,nv) )  return EXIT_FAILURE;
+  t = MMG5_walltime() - t;
+
+  for (ip=1; ip<=np; ip+=2) {
+    mmgMesh->point[ip].tag = 0;
+  }
+
+  if ( q->cell[0].nbVer != nq ) {
+    fprintf(stderr,"  ## Error: %d vertices in the PROctree instead of %"
+            MMG5_PRId ".\n",q->cell[0].nbVer,nq);
+    return EXIT_FAILURE;
+  }
+  fprintf(stdout,"  add    : %" MMG5_PRId " vertices in %.3f s (%.1f Mpt/s)\n",
+          nq,t,t > 0. ? 1.e-6*nq/t : 0.);
+
+  /** 3) Filter the vertices of odd index */
+  t = bench_filterAll(mmgMesh,mmgSol,q,n,&nacc);
+  if ( t < 0. )  return EXIT_FAILURE;
+  fprintf(stdout,"  filter : %" MMG5_PRId " queries in %.3f s (%.1f Mq/s),"
+          " %" MMG5_PRId " accepted\n",np-nq,t,t > 0. ? 1.e-6*(np-nq)/t : 0.,nacc);
+
+  /** 4) Move the stored vertices and filter again */
+  t = 0.;
+  for (ip=2; ip<=np; ip+=2) {
+    ppt  = &mmgMesh->point[ip];
+    c[0] = ppt->c[0] + 0.1*bench_rand(&seed)/n;
+    c[1] = ppt->c[1] + 0.1*bench_rand(&seed)/n;
+    c[2] = ppt->c[2] + 0.1*bench_rand(&seed)/n;
+
+    t -= MMG5_walltime();
+    if ( !MMG3D_movePROctree(mmgMesh,q,ip,c,ppt->c) )  return EXIT_FAILURE;
+    t += MMG5_walltime();
+
+    memcpy(ppt->c,c,3*sizeof(double));
+  }
+  fprintf(stdout,"  move   : %" MMG5_PRId " vertices in %.3f s (%.1f Mpt/s)\n",
+          nq,t,t > 0. ? 1.e-6*nq/t : 0.);
+
+  if ( bench_filterAll(mmgMesh,mmgSol,q,n,&nacc) < 0. )  return EXIT_FAILURE;
+
+  /** 5) Delete the stored vertices */
+  t = MMG5_walltime();
+  for (ip=2; ip<=np; ip+=2) {
+    if ( !MMG3D_delPROctree(mmgMesh,q,ip) )  return EXIT_FAILURE;
+  }
+  t = MMG5_walltime() - t;
+
+  if ( q->cell[0].nbVer ) {
+    fprintf(stderr,"  ## Error: %d vertices left in the PROctree.\n",
+            q->cell[0].nbVer);
+    return EXIT_FAILURE;
+  }
+  fprintf(stdout,"  delete : %" MMG5_PRId " vertices in %.3f s (%.1f Mpt/s)\n",
+          nq,t,t > 0. ? 1.e-6*nq/t : 0.);
+
+  MMG3D_freePROctree(mmgMesh,&q);
+
+  MMG3D_Free_all(MMG5_ARG_start,
+                 MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                 MMG5_ARG_end);
+
+  return EXIT_SUCCESS;
+}
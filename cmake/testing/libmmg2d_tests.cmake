@@ -148,7 +148,6 @@ SET ( src_test_met2d
   ${PROJECT_SOURCE_DIR}/src/common/anisosiz.c
   ${PROJECT_SOURCE_DIR}/src/common/isosiz.c
   ${PROJECT_SOURCE_DIR}/src/common/tools.c
-  ${PROJECT_SOURCE_DIR}/src/common/mmgexterns.c
   ${PROJECT_SOURCE_DIR}/cmake/testing/code/test_met2d.c
   )
 ADD_LIBRARY_TEST ( test_met2d "${src_test_met2d}" copy_2d_headers ${lib_name} ${lib_type})
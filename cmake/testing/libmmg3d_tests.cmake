@@ -40,6 +40,9 @@ SET ( MMG3D_LIB_TESTS
   libmmg3d_lsAndMetric_hsiz
   libmmg3d_lsAndMetric
   libmmg3d_generic_io
+  libmmg3d_threaded
+  libmmg3d_update
+  libmmg3d_region
   )
 
 # Additional tests that needs to download ci meshes
@@ -71,6 +74,9 @@ SET ( MMG3D_LIB_TESTS_MAIN_PATH
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/IsosurfDiscretization_lsAndMetric/main_hsiz.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/IsosurfDiscretization_lsAndMetric/main.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/io_generic_and_get_adja/genericIO.c
+  ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/threaded_remeshing/main.c
+  ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/warm_start_remeshing/main.c
+  ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/region_remeshing/main.c
   )
 
 # Additional library tests that needs to download ci meshes to be run
@@ -161,17 +167,42 @@ SET ( src_test_met3d
   ${PROJECT_SOURCE_DIR}/src/common/anisosiz.c
   ${PROJECT_SOURCE_DIR}/src/common/isosiz.c
   ${PROJECT_SOURCE_DIR}/src/common/tools.c
-  ${PROJECT_SOURCE_DIR}/src/common/mmgexterns.c
   ${PROJECT_SOURCE_DIR}/cmake/testing/code/test_met3d.c
   )
 ADD_LIBRARY_TEST ( test_met3d "${src_test_met3d}" copy_3d_headers ${lib_name} ${lib_type})
 TARGET_LINK_LIBRARIES ( test_met3d PRIVATE ${M_LIB} )
 
+# Benchmark of the adjacency builders (uses non exported symbols)
+SET ( src_hash_tetra_bench
+  ${PROJECT_SOURCE_DIR}/src/common/chrono.c
+  ${PROJECT_SOURCE_DIR}/src/common/tools.c
+  ${PROJECT_SOURCE_DIR}/src/mmg3d/hash_3d.c
+  ${PROJECT_SOURCE_DIR}/cmake/testing/code/hash-tetra-bench.c
+  )
+ADD_LIBRARY_TEST ( hash_tetra_bench "${src_hash_tetra_bench}"
+  copy_3d_headers ${lib_name} ${lib_type})
+
+# Benchmark of the PROctree (uses non exported symbols)
+SET ( src_proctree_bench
+  ${PROJECT_SOURCE_DIR}/src/common/chrono.c
+  ${PROJECT_SOURCE_DIR}/src/mmg3d/PRoctree_3d.c
+  ${PROJECT_SOURCE_DIR}/cmake/testing/code/proctree-bench.c
+  )
+ADD_LIBRARY_TEST ( proctree_bench "${src_proctree_bench}"
+  copy_3d_headers ${lib_name} ${lib_type})
+
+# Test of the ASCII tokenizer (uses the size of its read buffer)
+SET ( src_ascii_tokenizer
+  ${PROJECT_SOURCE_DIR}/src/common/inout.c
+  ${PROJECT_SOURCE_DIR}/cmake/testing/code/ascii-tokenizer.c
+  )
+ADD_LIBRARY_TEST ( ascii_tokenizer "${src_ascii_tokenizer}"
+  copy_3d_headers ${lib_name} ${lib_type})
+
 IF ( MMG3D_CI AND NOT ONLY_VERY_SHORT_TESTS )
   SET ( src_test_ridge_preservation_in_ls_mode
     ${PROJECT_SOURCE_DIR}/src/common/boulep.c
     ${PROJECT_SOURCE_DIR}/src/common/hash.c
-    ${PROJECT_SOURCE_DIR}/src/common/mmgexterns.c
     ${PROJECT_SOURCE_DIR}/src/common/mmg2.c
     ${PROJECT_SOURCE_DIR}/src/common/tools.c
     ${PROJECT_SOURCE_DIR}/src/mmg3d/bezier_3d.c
@@ -247,6 +278,30 @@ ADD_TEST(NAME libmmg3d_lsAndMetric
   "${CTEST_OUTPUT_DIR}/libmmg3d_lsAndMetric_multimat.o"
   )
 ADD_TEST(NAME test_met3d  COMMAND  ${EXECUTABLE_OUTPUT_PATH}/test_met3d)
+ADD_TEST(NAME libmmg3d_threaded
+  COMMAND ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_threaded
+  "${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh"
+  "${CTEST_OUTPUT_DIR}/libmmg3d_threaded-cube.o.mesh" 2
+  )
+ADD_TEST(NAME libmmg3d_update
+  COMMAND ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_update
+  "${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh"
+  "${CTEST_OUTPUT_DIR}/libmmg3d_update-cube.o.mesh"
+  )
+# the updates must reuse the data of the previous call
+SET_PROPERTY(TEST libmmg3d_update
+  PROPERTY FAIL_REGULAR_EXPRESSION "warm start unavailable")
+ADD_TEST(NAME libmmg3d_region
+  COMMAND ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_region
+  "${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a/cube.mesh"
+  "${CTEST_OUTPUT_DIR}/libmmg3d_region-cube.o.mesh"
+  )
+ADD_TEST(NAME hash_tetra_bench
+  COMMAND ${EXECUTABLE_OUTPUT_PATH}/hash_tetra_bench 20 4)
+ADD_TEST(NAME proctree_bench
+  COMMAND ${EXECUTABLE_OUTPUT_PATH}/proctree_bench 30)
+ADD_TEST(NAME ascii_tokenizer
+  COMMAND ${EXECUTABLE_OUTPUT_PATH}/ascii_tokenizer ${CTEST_OUTPUT_DIR})
 
 ADD_TEST(NAME libmmg3d_generic_io_msh
   COMMAND ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_generic_io
@@ -48,6 +48,20 @@ ADD_TEST(NAME mmg2d_memOption
   ${MMG2D_CI_TESTS}/Circle/cercle
   -out ${CTEST_OUTPUT_DIR}/mmg2d_memOption.o.meshb)
 
+ADD_TEST(NAME mmg2d_tbudgetOption
+  COMMAND ${EXECUT_MMG2D} -v 5 -hsiz 0.01 -tbudget 1e-6
+  ${MMG2D_CI_TESTS}/Circle/cercle
+  -out ${CTEST_OUTPUT_DIR}/mmg2d_tbudgetOption.o.meshb)
+SET_PROPERTY(TEST mmg2d_tbudgetOption
+  PROPERTY PASS_REGULAR_EXPRESSION "time budget of .* exhausted")
+
+ADD_TEST(NAME mmg2d_convOption
+  COMMAND ${EXECUT_MMG2D} -v 5 -hsiz 0.01 -conv 0.1
+  ${MMG2D_CI_TESTS}/Circle/cercle
+  -out ${CTEST_OUTPUT_DIR}/mmg2d_convOption.o.meshb)
+SET_PROPERTY(TEST mmg2d_convOption
+  PROPERTY PASS_REGULAR_EXPRESSION "waves converged")
+
 ADD_TEST(NAME mmg2d_val
   COMMAND ${EXECUT_MMG2D} -v val
   ${MMG2D_CI_TESTS}/Circle/cercle
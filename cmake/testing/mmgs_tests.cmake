@@ -55,6 +55,20 @@ ADD_TEST(NAME mmgs_memOption
   ${MMGS_CI_TESTS}/Teapot/teapot
   -out ${CTEST_OUTPUT_DIR}/mmgs_memOption.o.meshb)
 
+ADD_TEST(NAME mmgs_tbudgetOption
+  COMMAND ${EXECUT_MMGS} -v 5 -tbudget 1e-6 ${common_args}
+  ${MMGS_CI_TESTS}/Teapot/teapot
+  -out ${CTEST_OUTPUT_DIR}/mmgs_tbudgetOption.o.meshb)
+SET_PROPERTY(TEST mmgs_tbudgetOption
+  PROPERTY PASS_REGULAR_EXPRESSION "time budget of .* exhausted")
+
+ADD_TEST(NAME mmgs_convOption
+  COMMAND ${EXECUT_MMGS} -v 5 -conv 0.1 ${common_args}
+  ${MMGS_CI_TESTS}/Teapot/teapot
+  -out ${CTEST_OUTPUT_DIR}/mmgs_convOption.o.meshb)
+SET_PROPERTY(TEST mmgs_convOption
+  PROPERTY PASS_REGULAR_EXPRESSION "waves converged")
+
 ADD_TEST(NAME mmgs_val
   COMMAND ${EXECUT_MMGS} -val
   ${MMGS_CI_TESTS}/Teapot/teapot
@@ -0,0 +1,413 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+**
+*/
+
+/**
+ * Example of use of the mmg3d library: remeshing of regions of a mesh given by
+ * a list of tetrahedra, a box or a ball (MMG3D_mmg3dlib_region,
+ * MMG3D_mmg3dlib_box and MMG3D_mmg3dlib_ball) and check of the validity of the
+ * output meshes.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>   /** BEGIN_EXAMPLE (this line is used by Doxygen) */
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <float.h>
+
+/** Include the mmg3d library header file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vol expected volume of the mesh.
+ * \return 1 if the mesh is valid, 0 otherwise.
+ *
+ * Check that the tetrahedra are positively oriented, that they fill the
+ * expected volume and that the adjacency relations are symmetric.
+ */
+static int checkMesh(MMG5_pMesh mesh,double vol) {
+  double   *vert,*a,*b,*c,*d,v,tvol;
+  MMG5_int *tetra,np,ne,nprism,nt,nquad,na,k,kk,adj[4],adj1[4];
+  int      i,j,ier;
+
+  if ( MMG3D_Get_meshSize(mesh,&np,&ne,&nprism,&nt,&nquad,&na) != 1 )
+    return 0;
+
+  vert  = (double*)calloc(3*np,sizeof(double));
+  tetra = (MMG5_int*)calloc(4*ne,sizeof(MMG5_int));
+  if ( !vert || !tetra ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+
+  ier = 0;
+  if ( MMG3D_Get_vertices(mesh,vert,NULL,NULL,NULL) != 1 )  goto end;
+  if ( MMG3D_Get_tetrahedra(mesh,tetra,NULL,NULL) != 1 )    goto end;
+
+  /* Orientation and volume of the tetrahedra */
+  tvol = 0.;
+  for ( k=0; k<ne; ++k ) {
+    a = &vert[3*(tetra[4*k  ]-1)];
+    b = &vert[3*(tetra[4*k+1]-1)];
+    c = &vert[3*(tetra[4*k+2]-1)];
+    d = &vert[3*(tetra[4*k+3]-1)];
+    v = ( (b[0]-a[0])*((c[1]-a[1])*(d[2]-a[2]) - (c[2]-a[2])*(d[1]-a[1]))
+        - (b[1]-a[1])*((c[0]-a[0])*(d[2]-a[2]) - (c[2]-a[2])*(d[0]-a[0]))
+        + (b[2]-a[2])*((c[0]-a[0])*(d[1]-a[1]) - (c[1]-a[1])*(d[0]-a[0])) )/6.;
+    if ( v <= 0. ) {
+      fprintf(stderr,"  ## Error: tetrahedron %" MMG5_PRId " has a non"
+              " positive volume (%e).\n",k+1,v);
+      goto end;
+    }
+    tvol += v;
+  }
+  if ( fabs(tvol-vol) > 1.e-6*vol ) {
+    fprintf(stderr,"  ## Error: volume of the mesh %e instead of %e.\n",tvol,vol);
+    goto end;
+  }
+
+  /* Symmetry of the adjacency */
+  for ( k=1; k<=ne; ++k ) {
+    if ( MMG3D_Get_adjaTet(mesh,k,adj) != 1 )  goto end;
+    for ( i=0; i<4; ++i ) {
+      kk = adj[i];
+      if ( !kk ) continue;
+      if ( MMG3D_Get_adjaTet(mesh,kk,adj1) != 1 )  goto end;
+      for ( j=0; j<4; ++j ) {
+        if ( adj1[j] == k ) break;
+      }
+      if ( j == 4 ) {
+        fprintf(stderr,"  ## Error: tetrahedron %" MMG5_PRId " is adjacent to %"
+                MMG5_PRId " but not the contrary.\n",k,kk);
+        goto end;
+      }
+    }
+  }
+  ier = 1;
+
+end:
+  free(vert);
+  free(tetra);
+
+  return ier;
+}
+
+/**
+ * \param c coordinates of a point.
+ * \param min lower corner of the box.
+ * \param max upper corner of the box.
+ * \return the distance of \a c to the box.
+ */
+static double boxDist(double c[3],double min[3],double max[3]) {
+  double d,u;
+  int    i;
+
+  d = 0.;
+  for ( i=0; i<3; ++i ) {
+    u  = c[i] < min[i] ? min[i]-c[i] : ( c[i] > max[i] ? c[i]-max[i] : 0. );
+    d += u*u;
+  }
+  return sqrt(d);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param min lower corner of the box.
+ * \param max upper corner of the box.
+ * \param hin size inside the box.
+ * \param hout size outside the box.
+ * \return 1 if success, 0 otherwise.
+ *
+ * Give a size \a hin at the vertices inside the box and a size \a hout at the
+ * other vertices.
+ */
+static int setBoxSize(MMG5_pMesh mesh,MMG5_pSol met,double min[3],
+                      double max[3],double hin,double hout) {
+  double   c[3];
+  MMG5_int np,k;
+
+  if ( MMG3D_Get_meshSize(mesh,&np,NULL,NULL,NULL,NULL,NULL) != 1 )
+    return 0;
+  if ( MMG3D_Set_solSize(mesh,met,MMG5_Vertex,np,MMG5_Scalar) != 1 )
+    return 0;
+
+  for ( k=1; k<=np; ++k ) {
+    if ( MMG3D_GetByIdx_vertex(mesh,&c[0],&c[1],&c[2],NULL,NULL,NULL,k) != 1 )
+      return 0;
+    if ( MMG3D_Set_scalarSol(met,boxDist(c,min,max) > 0. ? hout : hin,k) != 1 )
+      return 0;
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vert pointer to the array of the vertex coordinates (allocated here).
+ * \param tetra pointer to the array of the tetrahedron vertices (allocated
+ * here).
+ * \param np number of vertices.
+ * \param ne number of tetrahedra.
+ * \return 1 if success, 0 otherwise.
+ *
+ * Get the vertices and the tetrahedra of the mesh.
+ */
+static int getMesh(MMG5_pMesh mesh,double **vert,MMG5_int **tetra,
+                   MMG5_int *np,MMG5_int *ne) {
+
+  if ( MMG3D_Get_meshSize(mesh,np,ne,NULL,NULL,NULL,NULL) != 1 )
+    return 0;
+
+  *vert  = (double*)calloc(3*(*np),sizeof(double));
+  *tetra = (MMG5_int*)calloc(4*(*ne),sizeof(MMG5_int));
+  if ( !*vert || !*tetra ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+
+  if ( MMG3D_Get_vertices(mesh,*vert,NULL,NULL,NULL) != 1 )  return 0;
+  if ( MMG3D_Get_tetrahedra(mesh,*tetra,NULL,NULL) != 1 )    return 0;
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param min lower corner of the box.
+ * \param max upper corner of the box.
+ * \param dist minimal distance to the box.
+ * \param nfar number of tetrahedra whose vertices are farther than \a dist
+ * from the box.
+ * \return the volume of these tetrahedra.
+ *
+ * Number and volume of the tetrahedra far from a remeshed region: they must
+ * not be modified by the remeshing of the region.
+ */
+static double farVolume(MMG5_pMesh mesh,double min[3],double max[3],
+                        double dist,MMG5_int *nfar) {
+  double   *vert,*a,*b,*c,*d,v,vol;
+  MMG5_int *tetra,np,ne,k;
+  int      i;
+
+  if ( !getMesh(mesh,&vert,&tetra,&np,&ne) )  exit(EXIT_FAILURE);
+
+  vol   = 0.;
+  *nfar = 0;
+  for ( k=0; k<ne; ++k ) {
+    for ( i=0; i<4; ++i ) {
+      if ( boxDist(&vert[3*(tetra[4*k+i]-1)],min,max) <= dist ) break;
+    }
+    if ( i < 4 ) continue;
+
+    a = &vert[3*(tetra[4*k  ]-1)];
+    b = &vert[3*(tetra[4*k+1]-1)];
+    c = &vert[3*(tetra[4*k+2]-1)];
+    d = &vert[3*(tetra[4*k+3]-1)];
+    v = ( (b[0]-a[0])*((c[1]-a[1])*(d[2]-a[2]) - (c[2]-a[2])*(d[1]-a[1]))
+        - (b[1]-a[1])*((c[0]-a[0])*(d[2]-a[2]) - (c[2]-a[2])*(d[0]-a[0]))
+        + (b[2]-a[2])*((c[0]-a[0])*(d[1]-a[1]) - (c[1]-a[1])*(d[0]-a[0])) )/6.;
+    vol += v;
+    ++(*nfar);
+  }
+  free(vert);
+  free(tetra);
+
+  return vol;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mmgMesh;
+  MMG5_pSol       mmgSol;
+  MMG5_int        *list,*tetra,np,np0,ne,k,nlist,nfar,nfar0;
+  double          *vert,min[3],max[3],c[3],vfar,vfar0,x;
+  int             ier,i,step;
+  char            *filename, *fileout;
+
+  fprintf(stdout,"  -- TEST MMG3DLIB_REGION \n");
+
+  if ( argc != 3 ) {
+    printf(" Usage: %s filein fileout\n",argv[0]);
+    return(1);
+  }
+
+  /* Name and path of the mesh file */
+  filename = (char *) calloc(strlen(argv[1]) + 1, sizeof(char));
+  if ( filename == NULL ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+  strcpy(filename,argv[1]);
+
+  fileout = (char *) calloc(strlen(argv[2]) + 1, sizeof(char));
+  if ( fileout == NULL ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+  strcpy(fileout,argv[2]);
+
+  /** ------------------------------ STEP   I -------------------------- */
+  /** 1) Initialisation of mesh and sol structures */
+  mmgMesh = NULL;
+  mmgSol  = NULL;
+
+  MMG3D_Init_mesh(MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                  MMG5_ARG_end);
+
+  /** 2) Read the mesh of the unit cube */
+  if ( MMG3D_loadMesh(mmgMesh,filename) != 1 )  exit(EXIT_FAILURE);
+
+  /** 3) First (complete) remeshing with a constant size */
+  min[0] = min[1] = min[2] = max[0] = max[1] = max[2] = 2.;
+  if ( !setBoxSize(mmgMesh,mmgSol,min,max,0.1,0.1) )  exit(EXIT_FAILURE);
+
+  ier = MMG3D_mmg3dlib(mmgMesh,mmgSol);
+  if ( ier != MMG5_SUCCESS ) {
+    fprintf(stdout,"BAD ENDING OF MMG3DLIB\n");
+    return(ier);
+  }
+
+  /** ------------------------------ STEP  II -------------------------- */
+  /** Refine successively a ball, a box and a list of tetrahedra (those whose
+   * barycenter has a x coordinate larger than 0.8) */
+  for ( step=0; step<3; ++step ) {
+    if ( step == 0 ) {
+      c[0] = c[1] = c[2] = 0.5;
+      for ( i=0; i<3; ++i ) {
+        min[i] = c[i] - 0.25;
+        max[i] = c[i] + 0.25;
+      }
+    }
+    else if ( step == 1 ) {
+      min[0] = min[1] = min[2] = 0.;
+      max[0] = max[1] = max[2] = 0.3;
+    }
+    else {
+      min[0] = 0.8; min[1] = min[2] = 0.;
+      max[0] = max[1] = max[2] = 1.;
+    }
+
+    /* The tetrahedra farther than 3 times the initial size from the region
+     * (a layer of tetrahedra is added around the region) must not change */
+    if ( !setBoxSize(mmgMesh,mmgSol,min,max,0.05,0.1) )  exit(EXIT_FAILURE);
+    vfar0 = farVolume(mmgMesh,min,max,0.35,&nfar0);
+    if ( MMG3D_Get_meshSize(mmgMesh,&np0,&ne,NULL,NULL,NULL,NULL) != 1 )
+      exit(EXIT_FAILURE);
+
+    if ( step == 0 ) {
+      ier = MMG3D_mmg3dlib_ball(mmgMesh,mmgSol,c,0.25,1);
+    }
+    else if ( step == 1 ) {
+      ier = MMG3D_mmg3dlib_box(mmgMesh,mmgSol,min,max,1);
+    }
+    else {
+      if ( !getMesh(mmgMesh,&vert,&tetra,&np0,&ne) )  exit(EXIT_FAILURE);
+      list = (MMG5_int*)calloc(ne,sizeof(MMG5_int));
+      if ( !list ) {
+        perror("  ## Memory problem: calloc");
+        exit(EXIT_FAILURE);
+      }
+      nlist = 0;
+      for ( k=0; k<ne; ++k ) {
+        x = 0.;
+        for ( i=0; i<4; ++i ) {
+          x += 0.25*vert[3*(tetra[4*k+i]-1)];
+        }
+        if ( x > min[0] ) list[nlist++] = k+1;
+      }
+      free(vert);
+      free(tetra);
+
+      ier = MMG3D_mmg3dlib_region(mmgMesh,mmgSol,list,nlist,1);
+      free(list);
+    }
+    if ( ier != MMG5_SUCCESS ) {
+      fprintf(stdout,"BAD ENDING OF MMG3DLIB_REGION (STEP %d)\n",step);
+      return(ier);
+    }
+
+    /* Check the mesh */
+    if ( !checkMesh(mmgMesh,1.) ) {
+      fprintf(stdout,"INVALID MESH (STEP %d)\n",step);
+      return(MMG5_STRONGFAILURE);
+    }
+    if ( MMG3D_Get_meshSize(mmgMesh,&np,NULL,NULL,NULL,NULL,NULL) != 1 )
+      exit(EXIT_FAILURE);
+    if ( np <= np0 ) {
+      fprintf(stdout,"REGION NOT REFINED (STEP %d)\n",step);
+      return(MMG5_STRONGFAILURE);
+    }
+    vfar = farVolume(mmgMesh,min,max,0.35,&nfar);
+    if ( nfar != nfar0 || fabs(vfar-vfar0) > 1.e-10 ) {
+      fprintf(stdout,"MESH MODIFIED OUT OF THE REGION (STEP %d): %" MMG5_PRId
+              " tetra instead of %" MMG5_PRId "\n",step,nfar,nfar0);
+      return(MMG5_STRONGFAILURE);
+    }
+  }
+
+  /** ------------------------------ STEP III -------------------------- */
+  /** 1) The boundary data are not kept by the region remeshing: this update is
+   * a complete remeshing */
+  min[0] = min[1] = min[2] = 0.7;
+  max[0] = max[1] = max[2] = 1.;
+  if ( !setBoxSize(mmgMesh,mmgSol,min,max,0.05,0.1) )  exit(EXIT_FAILURE);
+
+  ier = MMG3D_mmg3dlib_update(mmgMesh,mmgSol);
+  if ( ier != MMG5_SUCCESS ) {
+    fprintf(stdout,"BAD ENDING OF MMG3DLIB_UPDATE\n");
+    return(ier);
+  }
+  if ( !checkMesh(mmgMesh,1.) ) {
+    fprintf(stdout,"INVALID MESH\n");
+    return(MMG5_STRONGFAILURE);
+  }
+
+  /** 2) Save the mesh */
+  if ( MMG3D_saveMesh(mmgMesh,fileout) != 1 ) {
+    fprintf(stdout,"UNABLE TO SAVE MESH\n");
+    return(MMG5_STRONGFAILURE);
+  }
+
+  /** 3) Free the MMG3D5 structures */
+  MMG3D_Free_all(MMG5_ARG_start,
+                 MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                 MMG5_ARG_end);
+
+  free(filename);
+  filename = NULL;
+
+  free(fileout);
+  fileout = NULL;
+
+  return(ier);
+}   /** END_EXAMPLE (this line is used by Doxygen) */
@@ -0,0 +1,237 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+**
+*/
+
+/**
+ * Example of use of the mmg3d library: remeshing on several threads
+ * (MMG3D_mmg3dlib_threaded) and check of the validity of the output mesh.
+ *
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>   /** BEGIN_EXAMPLE (this line is used by Doxygen) */
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <float.h>
+
+/** Include the mmg3d library header file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vol expected volume of the mesh.
+ * \return 1 if the mesh is valid, 0 otherwise.
+ *
+ * Check that the tetrahedra are positively oriented, that they fill the
+ * expected volume and that the adjacency relations are symmetric.
+ */
+static int checkMesh(MMG5_pMesh mesh,double vol) {
+  double   *vert,*a,*b,*c,*d,v,tvol;
+  MMG5_int *tetra,np,ne,nprism,nt,nquad,na,k,kk,l,adj[4],adj1[4];
+  int      i,j,ier;
+
+  if ( MMG3D_Get_meshSize(mesh,&np,&ne,&nprism,&nt,&nquad,&na) != 1 )
+    return 0;
+
+  vert  = (double*)calloc(3*np,sizeof(double));
+  tetra = (MMG5_int*)calloc(4*ne,sizeof(MMG5_int));
+  if ( !vert || !tetra ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+
+  ier = 0;
+  if ( MMG3D_Get_vertices(mesh,vert,NULL,NULL,NULL) != 1 )  goto end;
+  if ( MMG3D_Get_tetrahedra(mesh,tetra,NULL,NULL) != 1 )    goto end;
+
+  /* Orientation and volume of the tetrahedra */
+  tvol = 0.;
+  for ( k=0; k<ne; ++k ) {
+    a = &vert[3*(tetra[4*k  ]-1)];
+    b = &vert[3*(tetra[4*k+1]-1)];
+    c = &vert[3*(tetra[4*k+2]-1)];
+    d = &vert[3*(tetra[4*k+3]-1)];
+    v = ( (b[0]-a[0])*((c[1]-a[1])*(d[2]-a[2]) - (c[2]-a[2])*(d[1]-a[1]))
+        - (b[1]-a[1])*((c[0]-a[0])*(d[2]-a[2]) - (c[2]-a[2])*(d[0]-a[0]))
+        + (b[2]-a[2])*((c[0]-a[0])*(d[1]-a[1]) - (c[1]-a[1])*(d[0]-a[0])) )/6.;
+    if ( v <= 0. ) {
+      fprintf(stderr,"  ## Error: tetrahedron %" MMG5_PRId " has a non"
+              " positive volume (%e).\n",k+1,v);
+      goto end;
+    }
+    tvol += v;
+  }
+  if ( fabs(tvol-vol) > 1.e-6*vol ) {
+    fprintf(stderr,"  ## Error: volume of the mesh %e instead of %e.\n",tvol,vol);
+    goto end;
+  }
+
+  /* Symmetry of the adjacency */
+  for ( k=1; k<=ne; ++k ) {
+    if ( MMG3D_Get_adjaTet(mesh,k,adj) != 1 )  goto end;
+    for ( i=0; i<4; ++i ) {
+      kk = adj[i];
+      if ( !kk ) continue;
+      if ( MMG3D_Get_adjaTet(mesh,kk,adj1) != 1 )  goto end;
+      for ( j=0; j<4; ++j ) {
+        if ( adj1[j] == k ) break;
+      }
+      if ( j == 4 ) {
+        fprintf(stderr,"  ## Error: tetrahedron %" MMG5_PRId " is adjacent to %"
+                MMG5_PRId " but not the contrary.\n",k,kk);
+        goto end;
+      }
+      /* The shared face has the same vertices */
+      for ( l=0; l<4; ++l ) {
+        if ( l == i ) continue;
+        if ( tetra[4*(kk-1)] != tetra[4*(k-1)+l] && tetra[4*(kk-1)+1] != tetra[4*(k-1)+l] &&
+             tetra[4*(kk-1)+2] != tetra[4*(k-1)+l] && tetra[4*(kk-1)+3] != tetra[4*(k-1)+l] ) {
+          fprintf(stderr,"  ## Error: tetrahedra %" MMG5_PRId " and %" MMG5_PRId
+                  " don't share a face.\n",k,kk);
+          goto end;
+        }
+      }
+    }
+  }
+  ier = 1;
+
+end:
+  free(vert);
+  free(tetra);
+
+  return ier;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mmgMesh;
+  MMG5_pSol       mmgSol;
+  MMG5_int        np,k;
+  int             ier,nthreads;
+  char            *filename, *fileout;
+
+  fprintf(stdout,"  -- TEST MMG3DLIB_THREADED \n");
+
+  if ( argc != 3 && argc != 4 ) {
+    printf(" Usage: %s filein fileout [nthreads]\n",argv[0]);
+    return(1);
+  }
+
+  /* Name and path of the mesh file */
+  filename = (char *) calloc(strlen(argv[1]) + 1, sizeof(char));
+  if ( filename == NULL ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+  strcpy(filename,argv[1]);
+
+  fileout = (char *) calloc(strlen(argv[2]) + 1, sizeof(char));
+  if ( fileout == NULL ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+  strcpy(fileout,argv[2]);
+
+  nthreads = argc > 3 ? atoi(argv[3]) : 2;
+
+  /** ------------------------------ STEP   I -------------------------- */
+  /** 1) Initialisation of mesh and sol structures */
+  mmgMesh = NULL;
+  mmgSol  = NULL;
+
+  MMG3D_Init_mesh(MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                  MMG5_ARG_end);
+
+  /** 2) Read the mesh of the unit cube */
+  if ( MMG3D_loadMesh(mmgMesh,filename) != 1 )  exit(EXIT_FAILURE);
+
+  /** 3) Give a constant size: the input mesh is too coarse to be partitioned
+   * so we give a size small enough for the remeshed mesh to be split */
+  if ( MMG3D_Get_meshSize(mmgMesh,&np,NULL,NULL,NULL,NULL,NULL) != 1 )
+    exit(EXIT_FAILURE);
+  if ( MMG3D_Set_solSize(mmgMesh,mmgSol,MMG5_Vertex,np,MMG5_Scalar) != 1 )
+    exit(EXIT_FAILURE);
+  for ( k=1; k<=np; ++k ) {
+    if ( MMG3D_Set_scalarSol(mmgSol,0.1,k) != 1 ) exit(EXIT_FAILURE);
+  }
+
+  if ( MMG3D_Chk_meshData(mmgMesh,mmgSol) != 1 ) exit(EXIT_FAILURE);
+
+  /** ------------------------------ STEP  II -------------------------- */
+  /** 1) First (sequential) remeshing to obtain a mesh large enough */
+  ier = MMG3D_mmg3dlib(mmgMesh,mmgSol);
+  if ( ier != MMG5_SUCCESS ) {
+    fprintf(stdout,"BAD ENDING OF MMG3DLIB\n");
+    return(ier);
+  }
+
+  /** 2) Remeshing with a finer size on several threads */
+  if ( MMG3D_Set_iparameter(mmgMesh,mmgSol,MMG3D_IPARAM_threads,nthreads) != 1 )
+    exit(EXIT_FAILURE);
+
+  if ( MMG3D_Get_meshSize(mmgMesh,&np,NULL,NULL,NULL,NULL,NULL) != 1 )
+    exit(EXIT_FAILURE);
+  for ( k=1; k<=np; ++k ) {
+    if ( MMG3D_Set_scalarSol(mmgSol,0.08,k) != 1 ) exit(EXIT_FAILURE);
+  }
+
+  ier = MMG3D_mmg3dlib_threaded(mmgMesh,mmgSol);
+  if ( ier != MMG5_SUCCESS ) {
+    fprintf(stdout,"BAD ENDING OF MMG3DLIB_THREADED\n");
+    return(ier);
+  }
+
+  /** ------------------------------ STEP III -------------------------- */
+  /** 1) Check the validity of the mesh */
+  if ( !checkMesh(mmgMesh,1.) ) {
+    fprintf(stdout,"INVALID MESH\n");
+    return(MMG5_STRONGFAILURE);
+  }
+
+  /** 2) Save the mesh */
+  if ( MMG3D_saveMesh(mmgMesh,fileout) != 1 ) {
+    fprintf(stdout,"UNABLE TO SAVE MESH\n");
+    return(MMG5_STRONGFAILURE);
+  }
+
+  /** 3) Free the MMG3D5 structures */
+  MMG3D_Free_all(MMG5_ARG_start,
+                 MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                 MMG5_ARG_end);
+
+  free(filename);
+  filename = NULL;
+
+  free(fileout);
+  fileout = NULL;
+
+  return(ier);
+}   /** END_EXAMPLE (this line is used by Doxygen) */
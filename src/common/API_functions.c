@@ -79,6 +79,8 @@ void MMG5_Init_parameters(MMG5_pMesh mesh) {
   mesh->info.rmc      =  MMG5_NONSET;
   /* [0/1]    ,avoid/allow  */
   mesh->info.nosizreq =  MMG5_OFF;
+  /* [n]      ,number of threads used by parallel mesh sweeps */
+  mesh->info.nthreads =  1;
 
 
   /* default values for doubles */
@@ -205,8 +207,8 @@ int MMG5_Set_inputSolName(MMG5_pMesh mesh,MMG5_pSol sol, const char* solin) {
       MMG5_SAFE_CALLOC(sol->namein,mesh_len,char,return 0);
       strcpy(sol->namein,mesh->namein);
 
-      /* Get last dot character to avoid issues with <basename>.mesh.mesh files */
-      char *dot = strrchr(sol->namein,'.');
+      /* Get last extension to avoid issues with <basename>.mesh.mesh files */
+      char *dot = MMG5_Get_filenameExt(sol->namein);
       ptr = NULL;
       if ( dot) {
         ptr = strstr(dot,".mesh");
@@ -215,6 +217,10 @@ int MMG5_Set_inputSolName(MMG5_pMesh mesh,MMG5_pSol sol, const char* solin) {
         /* the sol file is renamed concatening the mesh basename and the sol extension */
         *ptr = '\0';
       }
+      else if ( strlen(dot) > 3 && !strcmp(dot+strlen(dot)-3,".gz") ) {
+        /* compressed file of another format: drop the compression extension */
+        dot[strlen(dot)-3] = '\0';
+      }
       MMG5_SAFE_REALLOC(sol->namein,mesh_len,(strlen(sol->namein)+5),char,
                         "input sol name",return 0);
 
@@ -271,14 +277,14 @@ int MMG5_Set_inputParamName(MMG5_pMesh mesh, const char* fparamin) {
  *
  */
 int MMG5_Set_outputMeshName(MMG5_pMesh mesh, const char* meshout) {
-  int  fmt = MMG5_FMT_MeditASCII,fmtin;
+  int  fmt = MMG5_FMT_MeditASCII,fmtin,gz;
   char *ptr,*ptrin;
 
   if ( mesh->nameout )
     MMG5_DEL_MEM(mesh,mesh->nameout);
 
   if ( meshout && strlen(meshout) ) {
-    ptr   = strrchr(meshout, '.');
+    ptr   = MMG5_Get_filenameExt((char*)meshout);
 
     MMG5_ADD_MEM(mesh,(strlen(meshout)+7)*sizeof(char),"output mesh name",
                   fprintf(stderr,"  Exit program.\n");
@@ -323,14 +329,16 @@ int MMG5_Set_outputMeshName(MMG5_pMesh mesh, const char* meshout) {
   }
   else {
     if ( mesh->namein && strlen(mesh->namein) ) {
-      MMG5_ADD_MEM(mesh,(strlen(mesh->namein)+9)*sizeof(char),"output mesh name",
+      MMG5_ADD_MEM(mesh,(strlen(mesh->namein)+12)*sizeof(char),"output mesh name",
                     fprintf(stderr,"  Exit program.\n");
                     return 0);
-      MMG5_SAFE_CALLOC(mesh->nameout,strlen(mesh->namein)+9,char,return 0);
+      MMG5_SAFE_CALLOC(mesh->nameout,strlen(mesh->namein)+12,char,return 0);
       strcpy(mesh->nameout,mesh->namein);
 
       ptr   = MMG5_Get_filenameExt(mesh->nameout);
       fmt   = MMG5_Get_format(ptr,MMG5_FMT_MeditASCII);
+      /* a compressed input gives a compressed output */
+      gz    = ( strlen(ptr) > 3 && !strcmp(ptr+strlen(ptr)-3,".gz") );
 
       if ( ptr ) *ptr = '\0';
 
@@ -358,6 +366,10 @@ int MMG5_Set_outputMeshName(MMG5_pMesh mesh, const char* meshout) {
         strcat(mesh->nameout,".o.mesh");
         break;
       }
+      if ( gz && fmt != MMG5_FMT_VtkVtu && fmt != MMG5_FMT_VtkVtp
+           && fmt != MMG5_FMT_VtkVtk ) {
+        strcat(mesh->nameout,".gz");
+      }
     }
     else {
       MMG5_ADD_MEM(mesh,12*sizeof(char),"output mesh name",
@@ -387,7 +399,7 @@ int MMG5_Set_outputMeshName(MMG5_pMesh mesh, const char* meshout) {
  */
 int MMG5_Set_outputSolName(MMG5_pMesh mesh,MMG5_pSol sol, const char* solout) {
   char *ptr;
-  int oldsize;
+  int oldsize,gz;
 
   if ( sol->nameout )
     MMG5_DEL_MEM(mesh,sol->nameout);
@@ -401,12 +413,14 @@ int MMG5_Set_outputSolName(MMG5_pMesh mesh,MMG5_pSol sol, const char* solout) {
   }
   else {
     if ( mesh->nameout && strlen(mesh->nameout) ) {
-      /* Get last dot character to avoid issues with <basename>.mesh.mesh files */
-      char *dot = strrchr(mesh->nameout,'.');
+      /* Get last extension to avoid issues with <basename>.mesh.mesh files */
+      char *dot = MMG5_Get_filenameExt(mesh->nameout);
       ptr = NULL;
       if ( dot) {
         ptr = strstr(dot,".mesh");
       }
+      /* a compressed mesh gives a compressed solution */
+      gz = ( ptr && !strcmp(dot+strlen(dot)-3,".gz") ) ? 3 : 0;
       if ( ptr ) {
         MMG5_SAFE_CALLOC(sol->nameout,strlen(mesh->nameout)+1,char,return 0);
         oldsize = strlen(mesh->nameout)+1;
@@ -416,7 +430,7 @@ int MMG5_Set_outputSolName(MMG5_pMesh mesh,MMG5_pSol sol, const char* solout) {
         oldsize = strlen(mesh->nameout)+6;
       }
       strcpy(sol->nameout,mesh->nameout);
-      dot = strrchr(sol->nameout,'.');
+      dot = MMG5_Get_filenameExt(sol->nameout);
       ptr = NULL;
       if ( dot) {
         ptr = strstr(dot,".mesh");
@@ -425,12 +439,12 @@ int MMG5_Set_outputSolName(MMG5_pMesh mesh,MMG5_pSol sol, const char* solout) {
         /* the sol file is renamed with the meshfile basename and .sol ext */
         *ptr = '\0';
 
-      MMG5_ADD_MEM(mesh,(strlen(sol->nameout)+5)*sizeof(char),"output sol name",
+      MMG5_ADD_MEM(mesh,(strlen(sol->nameout)+5+gz)*sizeof(char),"output sol name",
                     fprintf(stderr,"  Exit program.\n");
                     return 0);
-      MMG5_SAFE_REALLOC(sol->nameout,oldsize,(strlen(sol->nameout)+5),char,
+      MMG5_SAFE_REALLOC(sol->nameout,oldsize,(strlen(sol->nameout)+5+gz),char,
                          "output sol name",return 0);
-      strcat(sol->nameout,".sol");
+      strcat(sol->nameout,gz ? ".sol.gz" : ".sol");
 
     }
     else {
@@ -907,11 +921,12 @@ const char* MMG5_Get_formatName(enum MMG5_Format fmt)
  * if no extension have been founded
  *
  * Get the extension of the filename string. Do not consider '.o' as an extension.
+ * For compressed files, the extension includes the format one (".mesh.gz").
  *
  */
 char *MMG5_Get_filenameExt( char *filename ) {
   const char pathsep='/';
-  char       *dot,*lastpath;
+  char       *dot,*ext,*lastpath;
 
   if ( !filename ) {
     return NULL;
@@ -925,6 +940,12 @@ char *MMG5_Get_filenameExt( char *filename ) {
     return filename + strlen(filename);
   }
 
+  if ( !strcmp(dot,".gz") ) {
+    /* Compressed file: the extension includes the format one (.mesh.gz) */
+    for ( ext=dot-1; ext>filename && ext>lastpath && *ext!='.'; --ext ) ;
+    if ( *ext == '.' && ext != filename && ext > lastpath )  return ext;
+  }
+
   return dot;
 }
 
@@ -51,7 +51,7 @@ double MMG5_surf(MMG5_pMesh mesh,double m[3][6],MMG5_pTria ptt) {
   MMG5_Bezier    b;
   double         surf,dens,J[3][2],mJ[3][2],tJmJ[2][2];
   int8_t         i,nullDens;
-  static int8_t  mmgErr=0;
+  static MMG5_THREADLOCAL int8_t  mmgErr=0;
 
   surf = 0.0;
 
@@ -438,7 +438,7 @@ int MMG5_solveDefmetregSys( MMG5_pMesh mesh, double r[3][3], double c[3],
                              double isqhmin, double isqhmax, double hausd)
 {
   double intm[3], kappa[2], vp[2][2], b0[3], b1[3], b2[3];
-  static int mmgWarn0=0;
+  static MMG5_THREADLOCAL int mmgWarn0=0;
 
   memset(intm,0x0,3*sizeof(double));
 
@@ -544,7 +544,7 @@ int MMG5_solveDefmetrefSys( MMG5_pMesh mesh, MMG5_pPoint p0, MMG5_int ipref[2],
   double        intm[3], kappa[2], vp[2][2], b0[3], b1[3], b2[3], kappacur;
   double        gammasec[3],tau[2], ux, uy, uz, ps1, l, ll, *t, *t1;
   int           i;
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 
   (void)hausd;
 
@@ -1328,7 +1328,7 @@ int MMG5_simred2d(MMG5_pMesh mesh,double *m,double *n,double dm[2],
 
   double         det,lambda[2],imn[4];
   int            order;
-  static int8_t  mmgWarn0=0;
+  static MMG5_THREADLOCAL int8_t  mmgWarn0=0;
 
   /* Compute imn = M^{-1}N */
   det = m[0]*m[2] - m[1]*m[1];
@@ -1418,7 +1418,7 @@ int MMG5_simred3d(MMG5_pMesh mesh,double *m,double *n,double dm[3],
 
   double        lambda[3],im[6],imn[9];
   int           order;
-  static int8_t mmgWarn0=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0=0;
 
   /* Compute imn = M^{-1}N */
   if ( !MMG5_invmat ( m,im ) ) {
@@ -111,6 +111,60 @@ void  chrono(int cmode,mytime *ptt) {
 }
 
 
+/**
+ * \return the wall-clock time in seconds (from an arbitrary origin).
+ *
+ * Wall-clock time used to check the time budget of the remeshing.
+ *
+ */
+double MMG5_walltime(void) {
+#ifdef MMG_POSIX
+  struct timeval tv;
+
+  gettimeofday(&tv,NULL);
+  return (double)tv.tv_sec + (double)tv.tv_usec * BIG1;
+#else
+  return (double)GetTickCount64() * 1.e-3;
+#endif
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ *
+ * Start the time budget of the remeshing (to call at the beginning of the
+ * library functions).
+ *
+ */
+void MMG5_startTimeBudget(MMG5_pMesh mesh) {
+  mesh->info.tini = MMG5_walltime();
+  mesh->info.tout = 0;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \return 1 if the time budget of the remeshing (\a info.tbudget) is
+ * exhausted, 0 otherwise (or if no budget is given).
+ *
+ * Once the budget is exhausted, the remeshing loops stop after their current
+ * wave and the remaining optimization waves are skipped: the mesh is valid
+ * between two waves so it can be returned as is.
+ *
+ */
+int MMG5_outOfTime(MMG5_pMesh mesh) {
+
+  if ( mesh->info.tbudget <= 0. )  return 0;
+  if ( mesh->info.tout )  return 1;
+
+  if ( MMG5_walltime() - mesh->info.tini < mesh->info.tbudget )  return 0;
+
+  mesh->info.tout = 1;
+  if ( mesh->info.imprim > 0 ) {
+    fprintf(stdout,"\n  ## Warning: time budget of %gs exhausted,"
+            " remaining waves skipped.\n",mesh->info.tbudget);
+  }
+  return 1;
+}
+
 /**
  * \fn void  tminit(mytime *t,int maxtim)
  * \brief Initialize mytime object.
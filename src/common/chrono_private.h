@@ -77,6 +77,7 @@ typedef struct mytime {
 LIBMMG_CORE_EXPORT void   chrono(int cmode,mytime *ptt);
 LIBMMG_CORE_EXPORT void   tminit(mytime *t,int maxtim);
 LIBMMG_CORE_EXPORT void   printim(double ,char *);
+LIBMMG_CORE_EXPORT double MMG5_walltime(void);
 
 #ifdef __cplusplus
 }
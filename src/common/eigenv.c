@@ -88,7 +88,7 @@ static int newton3(double p[4],double x[3]) {
   double      delta,fx,dfx,dxx;
   double      fdx0,fdx1,dx0,dx1,x1,x2,tmp,epsA,epsB;
   int         it,it2,n;
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 
   /* coeffs polynomial, a=1 */
   if ( p[3] != 1. ) {
@@ -779,7 +779,7 @@ int MMG5_eigenv3d(int symmat,double *mat,double lambda[3],double v[3][3]) {
  */
 int MMG5_eigenv2d(int symmat,double *mat,double lambda[2],double vp[2][2]) {
   double dd,sqDelta,trmat,vnorm;
-  static int8_t  mmgWarn0=0;
+  static MMG5_THREADLOCAL int8_t  mmgWarn0=0;
 
   /* wrapper function if symmetric matrix */
   if( symmat )
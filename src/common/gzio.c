@@ -0,0 +1,548 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file common/gzio.c
+ * \brief Transparent input/output of gzip-compressed files.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * A compressed file is opened through zlib and wrapped in a FILE stream, so
+ * the Medit and Gmsh readers and writers (and the buffered tokenizer and
+ * writer) decompress and compress on the fly, without any temporary file nor
+ * copy of the whole file in memory.
+ */
+
+/* fopencookie is a GNU extension */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "mmgcommon_private.h"
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+
+#if defined(__GLIBC__)
+#define MMG5_GZ_COOKIE
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+#define MMG5_GZ_FUNOPEN
+#endif
+
+#endif
+
+/** Size of the buffers of a compressed file */
+#define MMG5_GZBUF_LGTH  1048576
+
+/** Distance (in the uncompressed data) between two access points of a
+ * compressed file */
+#define MMG5_GZPT_LGTH   16777216
+
+/** Compression level of the written files (fast compression) */
+#define MMG5_GZ_LEVEL    "1"
+
+/**
+ * \param name file name.
+ * \return 1 if the name has the ".gz" extension, 0 otherwise.
+ */
+static inline
+int MMG5_isGzName(const char *name) {
+  size_t len = strlen(name);
+
+  return ( len > 3 && !strcmp(name+len-3,".gz") );
+}
+
+#if defined(MMG5_GZ_COOKIE) || defined(MMG5_GZ_FUNOPEN)
+
+/**
+ * \struct MMG5_GzPoint
+ * \brief Access point of a compressed file: copy of the decompressor state at
+ * a given offset of the uncompressed data.
+ */
+typedef struct {
+  z_stream strm; /*!< decompressor state */
+  long     in; /*!< offset in the compressed file of the next byte to inflate */
+} MMG5_GzPoint;
+typedef MMG5_GzPoint * MMG5_pGzPoint;
+
+/**
+ * \struct MMG5_GzIn
+ * \brief Compressed file opened for reading.
+ *
+ * The readers move backward in the file to parse each section after the
+ * header: to avoid a decompression from the beginning of the file at each
+ * backward move, the state of the decompressor is saved every \ref
+ * MMG5_GZPT_LGTH bytes of uncompressed data (it costs about 40 kB per access
+ * point).
+ */
+typedef struct {
+  FILE          *in; /*!< compressed file */
+  unsigned char *buf; /*!< buffer of compressed data */
+  long          inoff; /*!< offset in the compressed file of the buffer end */
+  int64_t       pos; /*!< offset in the uncompressed data */
+  int           end; /*!< 1 at the end of the compressed data */
+  z_stream      strm; /*!< decompressor */
+  MMG5_GzPoint  *pt; /*!< access points (the i^th at offset i*MMG5_GZPT_LGTH) */
+  int           npt; /*!< number of access points */
+  int           nptmax; /*!< size of the array of access points */
+} MMG5_GzIn;
+typedef MMG5_GzIn * MMG5_pGzIn;
+
+/**
+ * \param gi pointer to the compressed file.
+ * \return 1 if compressed data have been read, 0 at the end of the file.
+ *
+ * Fill the buffer of compressed data.
+ *
+ */
+static
+int MMG5_gzFill(MMG5_pGzIn gi) {
+  size_t n;
+
+  n = fread(gi->buf,1,MMG5_GZBUF_LGTH,gi->in);
+  gi->inoff         += (long)n;
+  gi->strm.next_in   = gi->buf;
+  gi->strm.avail_in  = (uInt)n;
+
+  return n > 0;
+}
+
+/**
+ * \param gi pointer to the compressed file.
+ * \return 1 if success, 0 if fail.
+ *
+ * Save the decompressor state at the current offset.
+ *
+ */
+static
+int MMG5_gzAddPoint(MMG5_pGzIn gi) {
+  MMG5_pGzPoint pt;
+
+  if ( gi->npt == gi->nptmax ) {
+    MMG5_SAFE_REALLOC(gi->pt,gi->nptmax,gi->nptmax+64,MMG5_GzPoint,
+                      "access points",gi->npt = gi->nptmax = 0;return 0);
+    gi->nptmax += 64;
+  }
+  pt = &gi->pt[gi->npt];
+
+  if ( inflateCopy(&pt->strm,&gi->strm) != Z_OK )  return 0;
+  pt->in = gi->inoff - (long)gi->strm.avail_in;
+  ++gi->npt;
+
+  return 1;
+}
+
+/**
+ * \param gi pointer to the compressed file.
+ * \param buf buffer to fill.
+ * \param size number of bytes to read.
+ * \return the number of bytes read, -1 if fail.
+ *
+ * Read and decompress bytes from a compressed file (the next members of a
+ * multi-member file are read too). An access point is saved each time the
+ * offset reaches a multiple of \ref MMG5_GZPT_LGTH for the first time.
+ *
+ */
+static
+long MMG5_gzRead(MMG5_pGzIn gi,unsigned char *buf,size_t size) {
+  size_t done,lim;
+  int    ret;
+
+  done = 0;
+  while ( done < size && !gi->end ) {
+    if ( gi->pos == (int64_t)gi->npt * MMG5_GZPT_LGTH ) {
+      if ( !MMG5_gzAddPoint(gi) )  return -1;
+    }
+    if ( !gi->strm.avail_in && !MMG5_gzFill(gi) ) {
+      fprintf(stderr,"\n  ## Error: %s: unexpected end of the compressed"
+              " file.\n",__func__);
+      return -1;
+    }
+
+    /* Stop at the next access point */
+    lim = MG_MIN(size-done,(size_t)((int64_t)gi->npt*MMG5_GZPT_LGTH-gi->pos));
+    lim = MG_MIN(lim,(size_t)UINT_MAX);
+
+    gi->strm.next_out  = buf+done;
+    gi->strm.avail_out = (uInt)lim;
+    ret = inflate(&gi->strm,Z_NO_FLUSH);
+
+    lim     -= gi->strm.avail_out;
+    done    += lim;
+    gi->pos += (int64_t)lim;
+
+    if ( ret == Z_STREAM_END ) {
+      /* Next member of the file (trailing garbage is ignored) */
+      if ( !gi->strm.avail_in )  MMG5_gzFill(gi);
+      if ( gi->strm.avail_in && gi->strm.next_in[0] == 0x1f ) {
+        inflateReset(&gi->strm);
+      }
+      else {
+        gi->end = 1;
+      }
+    }
+    else if ( ret != Z_OK && ret != Z_BUF_ERROR ) {
+      fprintf(stderr,"\n  ## Error: %s: corrupted compressed file.\n",__func__);
+      return -1;
+    }
+  }
+  return (long)done;
+}
+
+/**
+ * \param gi pointer to the compressed file.
+ * \param target offset in the uncompressed data.
+ * \return 1 if success, 0 if fail.
+ *
+ * Move to the offset \a target: the decompression restarts from the last
+ * access point before \a target if we move backward or beyond this point, and
+ * continues from the current offset otherwise.
+ *
+ */
+static
+int MMG5_gzSeek(MMG5_pGzIn gi,int64_t target) {
+  unsigned char skip[16384];
+  MMG5_pGzPoint pt;
+  int64_t       ip;
+  long          n;
+
+  if ( target < 0 )  return 0;
+
+  ip = MG_MIN(target/MMG5_GZPT_LGTH,(int64_t)gi->npt-1);
+  if ( ip >= 0 && ( target < gi->pos || ip*MMG5_GZPT_LGTH > gi->pos ) ) {
+    pt = &gi->pt[ip];
+
+    inflateEnd(&gi->strm);
+    if ( inflateCopy(&gi->strm,&pt->strm) != Z_OK )  return 0;
+    if ( fseek(gi->in,pt->in,SEEK_SET) )  return 0;
+
+    gi->inoff         = pt->in;
+    gi->strm.avail_in = 0;
+    gi->pos           = ip*MMG5_GZPT_LGTH;
+    gi->end           = 0;
+  }
+
+  while ( gi->pos < target ) {
+    n = MMG5_gzRead(gi,skip,(size_t)MG_MIN(target-gi->pos,(int64_t)sizeof(skip)));
+    if ( n <= 0 )  return 0;
+  }
+  return 1;
+}
+
+/**
+ * \param gi pointer to the compressed file.
+ * \return 1 if success, 0 if fail.
+ *
+ * Close a compressed file opened for reading and free its buffers.
+ *
+ */
+static
+int MMG5_gzClose(MMG5_pGzIn gi) {
+  int i,ier;
+
+  for ( i=0; i<gi->npt; ++i ) {
+    inflateEnd(&gi->pt[i].strm);
+  }
+  inflateEnd(&gi->strm);
+  ier = !fclose(gi->in);
+
+  if ( gi->pt ) {
+    MMG5_SAFE_FREE(gi->pt);
+  }
+  MMG5_SAFE_FREE(gi->buf);
+  MMG5_SAFE_FREE(gi);
+
+  return ier;
+}
+
+/**
+ * \param gz compressed file.
+ * \param buf bytes to write.
+ * \param size number of bytes to write.
+ * \return the number of bytes written, 0 if fail.
+ *
+ * Compress and write bytes into a compressed file.
+ *
+ */
+static
+long MMG5_gzWrite(gzFile gz,const char *buf,size_t size) {
+  size_t done;
+  int    n;
+
+  done = 0;
+  while ( done < size ) {
+    n = gzwrite(gz,buf+done,(unsigned)MG_MIN(size-done,(size_t)INT_MAX));
+    if ( n <= 0 )  break;
+    done += (size_t)n;
+  }
+  return (long)done;
+}
+
+#endif
+
+#ifdef MMG5_GZ_COOKIE
+
+static ssize_t MMG5_gzCookieRead(void *cookie,char *buf,size_t size) {
+  return MMG5_gzRead((MMG5_pGzIn)cookie,(unsigned char*)buf,size);
+}
+
+static int MMG5_gzCookieSeek(void *cookie,off64_t *pos,int whence) {
+  MMG5_pGzIn gi = (MMG5_pGzIn)cookie;
+
+  /* The size of the uncompressed file is unknown */
+  if ( whence == SEEK_END )  return -1;
+
+  if ( !MMG5_gzSeek(gi,( whence == SEEK_CUR ) ? gi->pos + *pos : *pos) )
+    return -1;
+
+  *pos = gi->pos;
+  return 0;
+}
+
+static int MMG5_gzCookieClose(void *cookie) {
+  return MMG5_gzClose((MMG5_pGzIn)cookie) ? 0 : EOF;
+}
+
+static ssize_t MMG5_gzCookieWrite(void *cookie,const char *buf,size_t size) {
+  return MMG5_gzWrite((gzFile)cookie,buf,size);
+}
+
+static int MMG5_gzCookieWSeek(void *cookie,off64_t *pos,int whence) {
+  z_off_t off;
+
+  if ( whence == SEEK_END )  return -1;
+
+  off = gzseek((gzFile)cookie,(z_off_t)*pos,whence);
+  if ( off < 0 )  return -1;
+
+  *pos = off;
+  return 0;
+}
+
+static int MMG5_gzCookieWClose(void *cookie) {
+  return ( gzclose((gzFile)cookie) == Z_OK ) ? 0 : EOF;
+}
+
+#elif defined(MMG5_GZ_FUNOPEN)
+
+static int MMG5_gzFunRead(void *cookie,char *buf,int size) {
+  return (int)MMG5_gzRead((MMG5_pGzIn)cookie,(unsigned char*)buf,(size_t)size);
+}
+
+static fpos_t MMG5_gzFunSeek(void *cookie,fpos_t pos,int whence) {
+  MMG5_pGzIn gi = (MMG5_pGzIn)cookie;
+
+  /* The size of the uncompressed file is unknown */
+  if ( whence == SEEK_END )  return -1;
+
+  if ( !MMG5_gzSeek(gi,( whence == SEEK_CUR ) ? gi->pos + pos : pos) )
+    return -1;
+
+  return (fpos_t)gi->pos;
+}
+
+static int MMG5_gzFunClose(void *cookie) {
+  return MMG5_gzClose((MMG5_pGzIn)cookie) ? 0 : EOF;
+}
+
+static int MMG5_gzFunWrite(void *cookie,const char *buf,int size) {
+  return (int)MMG5_gzWrite((gzFile)cookie,buf,(size_t)size);
+}
+
+static fpos_t MMG5_gzFunWSeek(void *cookie,fpos_t pos,int whence) {
+
+  if ( whence == SEEK_END )  return -1;
+
+  return (fpos_t)gzseek((gzFile)cookie,(z_off_t)pos,whence);
+}
+
+static int MMG5_gzFunWClose(void *cookie) {
+  return ( gzclose((gzFile)cookie) == Z_OK ) ? 0 : EOF;
+}
+
+#endif
+
+#if defined(MMG5_GZ_COOKIE) || defined(MMG5_GZ_FUNOPEN)
+
+/**
+ * \param name name of the compressed file.
+ * \return a stream on the uncompressed data, NULL if fail.
+ *
+ * Open a compressed file for reading (a file that is not compressed is opened
+ * as is).
+ *
+ */
+static
+FILE *MMG5_gzOpenIn(const char *name) {
+  MMG5_pGzIn gi;
+  FILE       *in,*f;
+  int        c0,c1;
+
+  in = fopen(name,"rb");
+  if ( !in )  return NULL;
+
+  c0 = getc(in);
+  c1 = getc(in);
+  rewind(in);
+  if ( c0 != 0x1f || c1 != 0x8b )  return in;
+
+  MMG5_SAFE_CALLOC(gi,1,MMG5_GzIn,fclose(in);return NULL);
+  gi->in = in;
+  MMG5_SAFE_MALLOC(gi->buf,MMG5_GZBUF_LGTH,unsigned char,
+                   fclose(in);MMG5_SAFE_FREE(gi);return NULL);
+
+  /* gzip decoding */
+  if ( inflateInit2(&gi->strm,15+16) != Z_OK ) {
+    MMG5_gzClose(gi);
+    return NULL;
+  }
+
+#ifdef MMG5_GZ_COOKIE
+  {
+    cookie_io_functions_t fn;
+
+    fn.read  = MMG5_gzCookieRead;
+    fn.write = NULL;
+    fn.seek  = MMG5_gzCookieSeek;
+    fn.close = MMG5_gzCookieClose;
+    f = fopencookie(gi,"r",fn);
+  }
+#else
+  f = funopen(gi,MMG5_gzFunRead,NULL,MMG5_gzFunSeek,MMG5_gzFunClose);
+#endif
+
+  if ( !f )  MMG5_gzClose(gi);
+
+  return f;
+}
+
+/**
+ * \param name name of the compressed file.
+ * \param append 1 to append the data to the file (as a new member).
+ * \return a stream compressing the written data, NULL if fail.
+ *
+ * Open a compressed file for writing.
+ *
+ */
+static
+FILE *MMG5_gzOpenOut(const char *name,int append) {
+  gzFile gz;
+  FILE   *f;
+
+  gz = gzopen(name,append ? "ab" MMG5_GZ_LEVEL : "wb" MMG5_GZ_LEVEL);
+  if ( !gz )  return NULL;
+  gzbuffer(gz,MMG5_GZBUF_LGTH);
+
+#ifdef MMG5_GZ_COOKIE
+  {
+    cookie_io_functions_t fn;
+
+    fn.read  = NULL;
+    fn.write = MMG5_gzCookieWrite;
+    fn.seek  = MMG5_gzCookieWSeek;
+    fn.close = MMG5_gzCookieWClose;
+    f = fopencookie(gz,"w",fn);
+  }
+#else
+  f = funopen(gz,NULL,MMG5_gzFunWrite,MMG5_gzFunWSeek,MMG5_gzFunWClose);
+#endif
+
+  if ( !f )  gzclose(gz);
+
+  return f;
+}
+
+#endif
+
+/**
+ * \param name name of the compressed file.
+ * \param mode opening mode ("r" or "w", with or without "b").
+ * \return a stream on the uncompressed data, NULL if fail.
+ *
+ * Open a gzip-compressed file as a stream: the data read from the stream are
+ * decompressed and the data written into it are compressed on the fly. The
+ * stream supports the offsets given by ftell but not the seeks from the end of
+ * the file.
+ *
+ */
+static
+FILE *MMG5_gzOpen(const char *name,const char *mode) {
+#if defined(MMG5_GZ_COOKIE) || defined(MMG5_GZ_FUNOPEN)
+
+  if ( strchr(mode,'+') ) {
+    fprintf(stderr,"\n  ## Error: %s: compressed file %s can't be opened in"
+            " update mode.\n",__func__,name);
+    return NULL;
+  }
+
+  if ( strchr(mode,'w') || strchr(mode,'a') ) {
+    return MMG5_gzOpenOut(name,strchr(mode,'a') != NULL);
+  }
+  return MMG5_gzOpenIn(name);
+
+#else
+  fprintf(stderr,"\n  ## Error: %s: unable to open the compressed file %s:"
+          " mmg has been built without zlib support.\n",__func__,name);
+  return NULL;
+#endif
+}
+
+/**
+ * \param name name of the file.
+ * \param mode opening mode (as for fopen).
+ * \return the opened file, NULL if fail.
+ *
+ * Open a mesh or solution file: a file with the ".gz" extension is opened as a
+ * compressed stream (see \ref MMG5_gzOpen) and read or written as the
+ * uncompressed file. If a file to read doesn't exist, its compressed version
+ * (same name with the ".gz" extension) is opened if it exists.
+ *
+ */
+FILE *MMG5_fopen(const char *name,const char *mode) {
+  FILE *f;
+
+  if ( MMG5_isGzName(name) ) {
+    return MMG5_gzOpen(name,mode);
+  }
+
+  f = fopen(name,mode);
+
+#if defined(MMG5_GZ_COOKIE) || defined(MMG5_GZ_FUNOPEN)
+  if ( !f && mode[0] == 'r' && !strchr(mode,'+') ) {
+    char *gzname;
+
+    MMG5_SAFE_MALLOC(gzname,strlen(name)+4,char,return NULL);
+    strcpy(gzname,name);
+    strcat(gzname,".gz");
+
+    f = fopen(gzname,mode);
+    if ( f ) {
+      fclose(f);
+      f = MMG5_gzOpen(gzname,mode);
+    }
+    MMG5_SAFE_FREE(gzname);
+  }
+#endif
+
+  return f;
+}
@@ -58,21 +58,12 @@
 int MMG5_mmgHashTria(MMG5_pMesh mesh, MMG5_int *adjt, MMG5_Hash *hash, int chkISO) {
   MMG5_pTria     pt,pt1,pt2;
   MMG5_hedge     *ph;
-  MMG5_int       kk;
   MMG5_int       *adja,hmax,k,ia,ib,jel,lel,dup,nmf;
   int8_t         i,i1,i2,j,l;
-  MMG5_int       key;
 
   /* adjust hash table params */
   hmax =(MMG5_int)(3.71*mesh->np);
-  hash->siz  = mesh->np;
-  hash->max  = hmax + 1;
-  hash->nxt  = hash->siz;
-  MMG5_ADD_MEM(mesh,(hash->max+1)*sizeof(MMG5_hedge),"hash table",return 0);
-  MMG5_SAFE_CALLOC(hash->item,hash->max+1,MMG5_hedge,return 0);
-
-  for (k=hash->siz; k<hash->max; k++)
-    hash->item[k].nxt = k+1;
+  if ( !MMG5_hashNew(mesh,hash,mesh->np,hmax) ) return 0;
 
   if ( mesh->info.ddebug )  fprintf(stdout,"  h- stage 1: init\n");
 
@@ -99,99 +90,64 @@ int MMG5_mmgHashTria(MMG5_pMesh mesh, MMG5_int *adjt, MMG5_Hash *hash, int chkIS
       i1 = MMG5_inxt2[i];
       i2 = MMG5_iprv2[i];
 
-      /* compute key */
+      /* find edge */
       ia  = MG_MIN(pt->v[i1],pt->v[i2]);
       ib  = MG_MAX(pt->v[i1],pt->v[i2]);
-      key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-      ph  = &hash->item[key];
+      ph  = MMG5_hashProbe(hash,ia,ib);
 
       /* store edge */
       if ( ph->a == 0 ) {
+        if ( hash->nitem >= hash->max ) {
+          if ( mesh->info.ddebug ) {
+            fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
+                    " %" MMG5_PRId "\n",__func__,hash->max);
+          }
+          if ( !MMG5_hashGrow(mesh,hash) ) {
+            MMG5_DEL_MEM(mesh,hash->item);
+            return 0;
+          }
+          ph = MMG5_hashProbe(hash,ia,ib);
+        }
         ph->a = ia;
         ph->b = ib;
         ph->k = 3*k + i;
-        ph->nxt = 0;
         ++ph->s;
+        ++hash->nitem;
         continue;
       }
-      /* update info about adjacent */
-#ifndef NDEBUG
-      int8_t ok = 0;
-#endif
-      while ( ph->a ) {
-        if ( ph->a == ia && ph->b == ib ) {
-          jel = ph->k / 3;
-          j   = ph->k % 3;
-          pt1 = &mesh->tria[jel];
-          /* discard duplicate face */
-          if ( pt1->v[j] == pt->v[i] ) {
-            pt->v[0] = 0;
-            dup++;
-          }
-          /* update adjacent */
-          else if ( !adjt[3*(jel-1)+1+j] ) {
-            adja[i] = 3*jel + j;
-            adjt[3*(jel-1)+1+j] = 3*k + i;
-            ++ph->s;
-          }
-          /* non-manifold case */
-          else if ( adja[i] != 3*jel+j ) {
-            lel = adjt[3*(jel-1)+1+j]/3;
-            l   = adjt[3*(jel-1)+1+j]%3;
-            pt2 = &mesh->tria[lel];
-
-            if ( chkISO && ( (pt->ref == mesh->info.isoref) || (pt->ref < 0)) ) {
-              adjt[3*(lel-1)+1+l] = 0;
-              adja[i] = 3*jel+j;
-              adjt[3*(jel-1)+1+j] = 3*k + i;
-            }
-            pt->tag[i] |= MG_NOM;
-            pt1->tag[j] |= MG_NOM;
-            pt2->tag[l] |= MG_NOM;
-            nmf++;
-            ++ph->s;
-          }
-#ifndef NDEBUG
-          ok = 1;
-#endif
-          break;
-        }
-        else if ( !ph->nxt ) {
-          ph->nxt = hash->nxt;
-          ph = &hash->item[ph->nxt];
-          assert(ph);
-
-          if ( hash->nxt >= hash->max-1 ) {
-            if ( mesh->info.ddebug ) {
-              fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
-                      " %" MMG5_PRId "\n",__func__,hash->max);
-            }
-            MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,MMG5_GAP,MMG5_hedge,
-                               "MMG5_edge",
-                               MMG5_DEL_MEM(mesh,hash->item);
-                               return 0);
-
-            ph = &hash->item[hash->nxt];
-
-            for (kk=ph->nxt; kk<hash->max; kk++)
-              hash->item[kk].nxt = kk+1;
-          }
 
-          hash->nxt = ph->nxt;
-          ph->a = ia;
-          ph->b = ib;
-          ph->k = 3*k + i;
-          ph->nxt = 0;
-          ++ph->s;
-#ifndef NDEBUG
-          ok = 1;
-#endif
-          break;
+      /* update info about adjacent */
+      jel = ph->k / 3;
+      j   = ph->k % 3;
+      pt1 = &mesh->tria[jel];
+      /* discard duplicate face */
+      if ( pt1->v[j] == pt->v[i] ) {
+        pt->v[0] = 0;
+        dup++;
+      }
+      /* update adjacent */
+      else if ( !adjt[3*(jel-1)+1+j] ) {
+        adja[i] = 3*jel + j;
+        adjt[3*(jel-1)+1+j] = 3*k + i;
+        ++ph->s;
+      }
+      /* non-manifold case */
+      else if ( adja[i] != 3*jel+j ) {
+        lel = adjt[3*(jel-1)+1+j]/3;
+        l   = adjt[3*(jel-1)+1+j]%3;
+        pt2 = &mesh->tria[lel];
+
+        if ( chkISO && ( (pt->ref == mesh->info.isoref) || (pt->ref < 0)) ) {
+          adjt[3*(lel-1)+1+l] = 0;
+          adja[i] = 3*jel+j;
+          adjt[3*(jel-1)+1+j] = 3*k + i;
         }
-        else
-          ph = &hash->item[ph->nxt];
+        pt->tag[i] |= MG_NOM;
+        pt1->tag[j] |= MG_NOM;
+        pt2->tag[l] |= MG_NOM;
+        nmf++;
+        ++ph->s;
       }
-      assert(ok);
     }
   }
 
@@ -214,36 +170,27 @@ int MMG5_mmgHashTria(MMG5_pMesh mesh, MMG5_int *adjt, MMG5_Hash *hash, int chkIS
       i1 = MMG5_inxt2[i];
       i2 = MMG5_iprv2[i];
 
-      /* compute key */
+      /* find edge */
       ia  = MG_MIN(pt->v[i1],pt->v[i2]);
       ib  = MG_MAX(pt->v[i1],pt->v[i2]);
-      key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-      ph  = &hash->item[key];
+      ph  = MMG5_hashProbe(hash,ia,ib);
 
       if ( ph->a == 0 )  continue;
-      while( ph->a ) {
-        if ( ph->a == ia && ph->b == ib ) {
-          jel = ph->k / 3;
-          j   = ph->k % 3;
-          pt1 = &mesh->tria[jel];
-          pt1->tag[j] |= MG_BDY + MG_PARBDYBDY;
-          mesh->point[ia].tag |= MG_PARBDYBDY;
-          mesh->point[ib].tag |= MG_PARBDYBDY;
-          /* update adjacent */
-          lel = adjt[3*(jel-1)+1+j]/3;
-          l   = adjt[3*(jel-1)+1+j]%3;
-          if( lel ) {
-            pt2 = &mesh->tria[lel];
-            pt2->tag[l] |= MG_BDY + MG_PARBDYBDY;
-            mesh->point[ia].tag |= MG_PARBDYBDY;
-            mesh->point[ib].tag |= MG_PARBDYBDY;
-          }
-          break;
-        } else if ( !ph->nxt ) {
-          break;
-        } else {
-          ph = &hash->item[ph->nxt];
-        }
+
+      jel = ph->k / 3;
+      j   = ph->k % 3;
+      pt1 = &mesh->tria[jel];
+      pt1->tag[j] |= MG_BDY + MG_PARBDYBDY;
+      mesh->point[ia].tag |= MG_PARBDYBDY;
+      mesh->point[ib].tag |= MG_PARBDYBDY;
+      /* update adjacent */
+      lel = adjt[3*(jel-1)+1+j]/3;
+      l   = adjt[3*(jel-1)+1+j]%3;
+      if( lel ) {
+        pt2 = &mesh->tria[lel];
+        pt2->tag[l] |= MG_BDY + MG_PARBDYBDY;
+        mesh->point[ia].tag |= MG_PARBDYBDY;
+        mesh->point[ib].tag |= MG_PARBDYBDY;
       }
     }
   }
@@ -285,40 +232,18 @@ int MMG5_mmgHashTria(MMG5_pMesh mesh, MMG5_int *adjt, MMG5_Hash *hash, int chkIS
  **/
 MMG5_int MMG5_hashFace(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int ia,MMG5_int ib,MMG5_int ic,MMG5_int k) {
   MMG5_hedge     *ph;
-  MMG5_int       key;
-  MMG5_int       mins,maxs,sum,j;
+  MMG5_int       mins,maxs,sum;
 
   mins = MG_MIN(ia,MG_MIN(ib,ic));
   maxs = MG_MAX(ia,MG_MAX(ib,ic));
+  sum  = ia + ib + ic;
 
-  /* compute key */
-  sum = ia + ib + ic;
-  key = (MMG5_KA*(int64_t)mins + MMG5_KB*(int64_t)maxs) % hash->siz;
-  ph  = &hash->item[key];
+  ph = MMG5_hashProbeFace(hash,mins,maxs,sum);
+  if ( ph->a )  return ph->k;
 
-  if ( ph->a ) {
-    if ( ph->a == mins && ph->b == maxs && ph->s == sum )
-      return ph->k;
-    else {
-      while ( ph->nxt && ph->nxt < hash->max ) {
-        ph = &hash->item[ph->nxt];
-        if ( ph->a == mins && ph->b == maxs && ph->s == sum )  return ph->k;
-      }
-    }
-    ph->nxt = hash->nxt;
-    ph      = &hash->item[hash->nxt];
-    ph->a   = mins;
-    ph->b   = maxs;
-    ph->s   = sum;
-    ph->k   = k;
-    hash->nxt = ph->nxt;
-    ph->nxt = 0;
-
-    if ( hash->nxt >= hash->max ) {
-      MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,MMG5_GAP,MMG5_hedge,"face",return 0;);
-      for (j=hash->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
-    }
-    return -1;
+  if ( hash->nitem >= hash->max ) {
+    if ( !MMG5_hashGrow(mesh,hash) ) return 0;
+    ph = MMG5_hashProbeFace(hash,mins,maxs,sum);
   }
 
   /* insert new face */
@@ -326,7 +251,7 @@ MMG5_int MMG5_hashFace(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int ia,MMG5_int ib,M
   ph->b = maxs;
   ph->s = sum;
   ph->k = k;
-  ph->nxt = 0;
+  ++hash->nitem;
 
   return -1;
 }
@@ -345,49 +270,33 @@ MMG5_int MMG5_hashFace(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int ia,MMG5_int ib,M
  */
 int MMG5_hashEdge(MMG5_pMesh mesh,MMG5_Hash *hash, MMG5_int a,MMG5_int b,MMG5_int k) {
   MMG5_hedge  *ph;
-  MMG5_int     key;
-  MMG5_int    ia,ib,j;
+  MMG5_int    ia,ib;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-  ph  = &hash->item[key];
-
-  if ( ph->a == ia && ph->b == ib )
-    return 1;
-  else if ( ph->a ) {
-    while ( ph->nxt && ph->nxt < hash->max ) {
-      ph = &hash->item[ph->nxt];
-      if ( ph->a == ia && ph->b == ib )  return 1;
-    }
-    ph->nxt   = hash->nxt;
-    ph        = &hash->item[hash->nxt];
+  ph  = MMG5_hashProbe(hash,ia,ib);
 
-    if ( hash->nxt >= hash->max-1 ) {
-      if ( mesh->info.ddebug )
-        fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
-                " %" MMG5_PRId "\n",__func__,hash->max);
+  if ( ph->a )  return 1;
 
-      MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,MMG5_GAP,MMG5_hedge,
-                         "MMG5_edge",return 0);
-      /* ph pointer may be false after realloc */
-      ph        = &hash->item[hash->nxt];
+  if ( hash->nitem >= hash->max ) {
+    if ( mesh->info.ddebug )
+      fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
+              " %" MMG5_PRId "\n",__func__,hash->max);
 
-      for (j=ph->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
-    }
-    hash->nxt = ph->nxt;
+    if ( !MMG5_hashGrow(mesh,hash) ) return 0;
+    /* ph pointer is false after realloc */
+    ph = MMG5_hashProbe(hash,ia,ib);
   }
 
   /* insert new edge */
   ph->a = ia;
   ph->b = ib;
   ph->k = k;
-  ph->nxt = 0;
+  ++hash->nitem;
 
   return 2;
 }
 
-
 /**
  * \param mesh pointer to the mesh structure.
  * \param hash pointer to the hash table of edges.
@@ -403,27 +312,16 @@ int MMG5_hashEdge(MMG5_pMesh mesh,MMG5_Hash *hash, MMG5_int a,MMG5_int b,MMG5_in
  */
 int MMG5_hashUpdate(MMG5_Hash *hash, MMG5_int a,MMG5_int b,MMG5_int k) {
   MMG5_hedge  *ph;
-  MMG5_int     key;
   MMG5_int    ia,ib;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-  ph  = &hash->item[key];
-
-  while ( ph->a ) {
-    if ( ph->a == ia && ph->b == ib ) {
-      ph->k = k;
-      return 1;
-    }
-
-    if ( !ph->nxt ) return 0;
-
-    ph = &hash->item[ph->nxt];
+  ph  = MMG5_hashProbe(hash,ia,ib);
 
-  }
+  if ( !ph->a ) return 0;
 
-  return 0;
+  ph->k = k;
+  return 1;
 }
 
 /**
@@ -440,49 +338,27 @@ int MMG5_hashUpdate(MMG5_Hash *hash, MMG5_int a,MMG5_int b,MMG5_int k) {
  */
 int MMG5_hashEdgeTag(MMG5_pMesh mesh,MMG5_Hash *hash, MMG5_int a,MMG5_int b,uint16_t tag) {
   MMG5_hedge  *ph;
-  MMG5_int     key;
-  MMG5_int    ia,ib,j;
+  MMG5_int    ia,ib;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-  ph  = &hash->item[key];
+  ph  = MMG5_hashProbe(hash,ia,ib);
 
   if ( ph->a ) {
-    if ( ph->a == ia && ph->b == ib ) {
-      ph->k |= tag;
-      return ph->k;
-    }
-    else {
-      while ( ph->nxt && ph->nxt < hash->max ) {
-        ph = &hash->item[ph->nxt];
-        if ( ph->a == ia && ph->b == ib )  {
-          ph->k |= tag;
-          return ph->k;
-        }
-      }
-    }
-    ph->nxt   = hash->nxt;
-    ph        = &hash->item[hash->nxt];
-    ph->a     = ia;
-    ph->b     = ib;
-    ph->k     = tag;
-    hash->nxt = ph->nxt;
-    ph->nxt   = 0;
-
-    if ( hash->nxt >= hash->max ) {
-      MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,mesh->gap,MMG5_hedge,
-                        "edge hash table",return 0);
-      for (j=hash->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
-    }
-    return tag;
+    ph->k |= tag;
+    return ph->k;
+  }
+
+  if ( hash->nitem >= hash->max ) {
+    if ( !MMG5_hashGrow(mesh,hash) ) return 0;
+    ph = MMG5_hashProbe(hash,ia,ib);
   }
 
   /* insert new edge */
   ph->a     = ia;
   ph->b     = ib;
   ph->k     = tag;
-  ph->nxt   = 0;
+  ++hash->nitem;
 
   return tag;
 }
@@ -500,23 +376,15 @@ int MMG5_hashEdgeTag(MMG5_pMesh mesh,MMG5_Hash *hash, MMG5_int a,MMG5_int b,uint
  */
 MMG5_int MMG5_hashGet(MMG5_Hash *hash,MMG5_int a,MMG5_int b) {
   MMG5_hedge  *ph;
-  MMG5_int    key;
   MMG5_int    ia,ib;
 
   if ( !hash->item ) return 0;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-  ph  = &hash->item[key];
-
-  if ( !ph->a )  return 0;
-  if ( ph->a == ia && ph->b == ib )  return ph->k;
-  while ( ph->nxt ) {
-    ph = &hash->item[ph->nxt];
-    if ( ph->a == ia && ph->b == ib )  return ph->k;
-  }
-  return 0;
+  ph  = MMG5_hashProbe(hash,ia,ib);
+
+  return ph->a ? ph->k : 0;
 }
 
 /**
@@ -526,23 +394,65 @@ MMG5_int MMG5_hashGet(MMG5_Hash *hash,MMG5_int a,MMG5_int b) {
  * \param hmax maximal size of hash table.
  * \return 1 if success, 0 if fail.
  *
- * Hash edges or faces.
+ * Hash edges or faces: allocate a table of at least \a hmax slots. The table
+ * is enlarged when its load factor exceeds \ref MMG5_HASHLOAD.
  *
  */
 int MMG5_hashNew(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int hsiz,MMG5_int hmax) {
-  MMG5_int   k;
+  MMG5_int   siz;
 
-  /* adjust hash table params */
-  hash->siz  = hsiz+1;
-  hash->max  = hmax + 2;
-  hash->nxt  = hash->siz;
+  /* power of 2 number of slots */
+  siz = 16;
+  while ( siz < hsiz || siz < hmax ) {
+    siz *= 2;
+  }
+
+  hash->siz  = siz;
+  hash->max  = (MMG5_int)(MMG5_HASHLOAD*siz);
+  hash->nitem  = 0;
 
-  MMG5_ADD_MEM(mesh,(hash->max+1)*sizeof(MMG5_hedge),"hash table",
+  MMG5_ADD_MEM(mesh,hash->siz*sizeof(MMG5_hedge),"hash table",
                 return 0);
-  MMG5_SAFE_CALLOC(hash->item,(hash->max+1),MMG5_hedge,return 0);
+  MMG5_SAFE_CALLOC(hash->item,hash->siz,MMG5_hedge,return 0);
 
-  for (k=hash->siz; k<hash->max; k++)
-    hash->item[k].nxt = k+1;
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param hash pointer to the hash table of edges.
+ * \return 1 if success, 0 if fail.
+ *
+ * Double the number of slots of the hash table and reinsert the stored items.
+ *
+ */
+int MMG5_hashGrow(MMG5_pMesh mesh,MMG5_Hash *hash) {
+  MMG5_hedge *old,*ph;
+  MMG5_int   k,oldsiz,key;
+
+  old    = hash->item;
+  oldsiz = hash->siz;
+
+  MMG5_ADD_MEM(mesh,2*oldsiz*sizeof(MMG5_hedge),"hash table",
+                return 0);
+  MMG5_SAFE_CALLOC(hash->item,2*oldsiz,MMG5_hedge,
+                   hash->item = old;return 0);
+
+  hash->siz = 2*oldsiz;
+  hash->max = (MMG5_int)(MMG5_HASHLOAD*hash->siz);
+
+  /* the stored items are distinct: insert them in the first free slot */
+  for (k=0; k<oldsiz; k++) {
+    if ( !old[k].a ) continue;
+    key = MMG5_hashKey(hash,old[k].a,old[k].b);
+    ph  = &hash->item[key];
+    while ( ph->a ) {
+      key = (key+1) & (hash->siz-1);
+      ph  = &hash->item[key];
+    }
+    *ph = old[k];
+  }
+  MMG5_DEL_MEM(mesh,old);
 
   return 1;
 }
@@ -55,7 +55,7 @@ double MMG5_lenEdg(MMG5_pMesh mesh,MMG5_int np0,MMG5_int np1,
                     double *m0,double *m1,int8_t isedg) {
   MMG5_pPoint   p0,p1;
   double        gammaprim0[3],gammaprim1[3],t[3],*n1,*n2,ux,uy,uz,ps1,ps2,l0,l1;
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 
   p0 = &mesh->point[np0];
   p1 = &mesh->point[np1];
@@ -199,7 +199,7 @@ static inline
 double MMG5_lenSurfEdg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np0,MMG5_int np1,int8_t isedg) {
   MMG5_pPoint   p0,p1;
   double        *m0,*m1,met0[6],met1[6],ux,uy,uz,rbasis[3][3];
-  static int8_t mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn = 0;
 
   p0 = &mesh->point[np0];
   p1 = &mesh->point[np1];
@@ -35,6 +35,11 @@
 
 #include "mmgcommon_private.h"
 
+#ifdef MMG_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 /**
  * swap bytes if needed (conversion from big/little endian toward little/big
  * endian)
@@ -109,6 +114,1051 @@ double MMG5_swapd(double sbin)
   return out;
 }
 
+/**
+ * \param inm pointer to the file unit of a binary Medit file, opened at the
+ * beginning of the file.
+ * \param mb pointer to the mapped file (to fill).
+ * \return 1 if the file has been mapped, 0 otherwise.
+ *
+ * Map a binary Medit file in memory and read its keyword table, following
+ * the offset of the next keyword stored in each keyword header instead of
+ * seeking in the file. Only the files of version 1 and 2 (32 bits integers and
+ * offsets) are mapped. If the file can't be mapped (no POSIX system, file
+ * that is not a regular file, unknown version or corrupted table), \a mb->buf
+ * is NULL and the file has to be read through \a inm.
+ *
+ */
+int MMG5_mapMeshb(FILE *inm,MMG5_pMeshbMap mb) {
+#ifdef MMG_POSIX
+  struct stat st;
+  const char  *cur;
+  void        *buf;
+  long        pos,next;
+  int         fd,code;
+
+  memset(mb,0,sizeof(MMG5_MeshbMap));
+
+  fd = fileno(inm);
+  if ( fd < 0 || fstat(fd,&st) || !S_ISREG(st.st_mode) ) return 0;
+  if ( st.st_size < 3*MMG5_SW || (uintmax_t)st.st_size > SIZE_MAX ) return 0;
+
+  buf = mmap(NULL,(size_t)st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+  if ( buf == MAP_FAILED ) return 0;
+
+  mb->buf  = (const char*)buf;
+  mb->size = (size_t)st.st_size;
+
+  /* Encoding and version */
+  memcpy(&code,mb->buf,MMG5_SW);
+  if ( code == 16777216 ) {
+    mb->iswp = 1;
+  }
+  else if ( code != 1 ) {
+    MMG5_unmapMeshb(mb);
+    return 0;
+  }
+  cur = mb->buf + MMG5_SW;
+  mb->ver = MMG5_mapInt(mb,&cur);
+  if ( mb->ver != 1 && mb->ver != 2 ) {
+    MMG5_unmapMeshb(mb);
+    return 0;
+  }
+
+  /* Keyword table */
+  pos = 2*MMG5_SW;
+  while ( (size_t)pos + 2*MMG5_SW <= mb->size ) {
+    cur  = mb->buf + pos;
+    code = MMG5_mapInt(mb,&cur);
+    if ( code == 54 ) break; //End
+    next = MMG5_mapInt(mb,&cur);
+
+    if ( code > 0 && code < MMG5_NKWD ) {
+      if ( (size_t)pos + 3*MMG5_SW > mb->size ) {
+        MMG5_unmapMeshb(mb);
+        return 0;
+      }
+      if ( code == 3 ) { //Dimension
+        if ( !mb->dim ) mb->dim = MMG5_mapInt(mb,&cur);
+      }
+      else if ( !mb->pos[code] ) {
+        mb->num[code] = MMG5_mapInt(mb,&cur);
+        mb->pos[code] = pos + 3*MMG5_SW;
+      }
+    }
+    /* Offsets are increasing: a null or backward offset ends the table */
+    if ( next <= pos ) break;
+    pos = next;
+  }
+
+  return 1;
+#else
+  memset(mb,0,sizeof(MMG5_MeshbMap));
+  return 0;
+#endif
+}
+
+/**
+ * \param mb pointer to the mapped file.
+ *
+ * Unmap a binary Medit file mapped by \ref MMG5_mapMeshb (nothing is done if
+ * the file is not mapped).
+ *
+ */
+void MMG5_unmapMeshb(MMG5_pMeshbMap mb) {
+#ifdef MMG_POSIX
+  if ( mb->buf ) {
+    munmap((void*)mb->buf,mb->size);
+  }
+#endif
+  mb->buf  = NULL;
+  mb->size = 0;
+}
+
+/** Exact powers of ten in double precision */
+static const double MMG5_txtPow10[23] = {
+  1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,1e11,1e12,1e13,1e14,1e15,
+  1e16,1e17,1e18,1e19,1e20,1e21,1e22 };
+
+/** Exact powers of ten in single precision */
+static const float MMG5_txtPow10f[11] = {
+  1e0f,1e1f,1e2f,1e3f,1e4f,1e5f,1e6f,1e7f,1e8f,1e9f,1e10f };
+
+/**
+ * \param c character.
+ * \return 1 if \a c is a blank character (same set as isspace in the C
+ * locale), 0 otherwise.
+ */
+static inline
+int MMG5_txtIsSpace(char c) {
+  return c==' ' || c=='\n' || c=='\t' || c=='\r' || c=='\v' || c=='\f';
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \return 1 if some bytes remain in the buffer, 0 otherwise.
+ *
+ * Move the unread bytes at the beginning of the buffer and complete the
+ * buffer with the next bytes of the file.
+ *
+ */
+static
+int MMG5_txtFill(MMG5_pTxtBuf tb) {
+  size_t rem,n;
+
+  rem = tb->len - tb->cur;
+  if ( !tb->eof ) {
+    if ( rem ) memmove(tb->buf,tb->buf+tb->cur,rem);
+    tb->off += (long)tb->cur;
+    tb->cur  = 0;
+    n = fread(tb->buf+rem,1,MMG5_TXTBUF_LGTH-rem,tb->inm);
+    if ( n < MMG5_TXTBUF_LGTH-rem ) tb->eof = 1;
+    tb->len  = rem + n;
+    tb->buf[tb->len] = '\0';
+  }
+  return tb->len > tb->cur;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \return 1 if a token is available, 0 at the end of the file.
+ *
+ * Skip the blank characters until the beginning of the next token. The buffer
+ * is ended by a null character so the token can be parsed without bound
+ * checks.
+ *
+ */
+static inline
+int MMG5_txtStart(MMG5_pTxtBuf tb) {
+
+  while ( 1 ) {
+    while ( tb->cur < tb->len && MMG5_txtIsSpace(tb->buf[tb->cur]) ) ++tb->cur;
+    if ( tb->cur < tb->len ) return 1;
+    if ( !MMG5_txtFill(tb) ) return 0;
+  }
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param p end of the parsed part of the current token.
+ * \return 1 if the token is cut by the end of the buffer (in this case, the
+ * buffer is completed and the token has to be parsed again), 0 otherwise.
+ *
+ */
+static inline
+int MMG5_txtCut(MMG5_pTxtBuf tb,const char *p) {
+
+  while ( *p && !MMG5_txtIsSpace(*p) ) ++p;
+  if ( p < tb->buf + tb->len || tb->eof ) return 0;
+  MMG5_txtFill(tb);
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param inm pointer to the file unit of an ASCII file.
+ * \param tb pointer to the tokenizer (to fill).
+ * \return 1 if success, 0 if fail.
+ *
+ * Initialize a tokenizer that reads \a inm from its current position. The
+ * read buffer is counted in the memory used by \a mesh.
+ *
+ */
+int MMG5_txtInit(MMG5_pMesh mesh,FILE *inm,MMG5_pTxtBuf tb) {
+
+  tb->mesh = mesh;
+  tb->inm = inm;
+  tb->len = tb->cur = 0;
+  tb->eof = 0;
+  tb->strict = 0;
+  tb->off = ftell(inm);
+  if ( tb->off < 0 ) tb->off = 0;
+
+  MMG5_ADD_MEM(mesh,(MMG5_TXTBUF_LGTH+1)*sizeof(char),"read buffer",
+               tb->buf = NULL;return 0);
+  MMG5_SAFE_MALLOC(tb->buf,MMG5_TXTBUF_LGTH+1,char,
+                   mesh->memCur -= (MMG5_TXTBUF_LGTH+1)*sizeof(char);return 0);
+  tb->buf[0] = '\0';
+
+  return 1;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ *
+ * Free the buffer of a tokenizer (nothing is done if the tokenizer is not
+ * initialized).
+ *
+ */
+void MMG5_txtFree(MMG5_pTxtBuf tb) {
+  if ( tb->buf ) {
+    MMG5_DEL_MEM(tb->mesh,tb->buf);
+  }
+  tb->len = tb->cur = 0;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \return the offset in the file of the next character to read.
+ */
+long MMG5_txtTell(MMG5_pTxtBuf tb) {
+  return tb->off + (long)tb->cur;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param pos offset in the file (given by \ref MMG5_txtTell).
+ * \return 1 if success, 0 if fail.
+ *
+ * Move the tokenizer at the offset \a pos of the file. The file is read again
+ * only if \a pos is not inside the buffer. The position of the file unit is
+ * set back after the buffer, so the file unit may have been moved by the
+ * caller in between.
+ *
+ */
+int MMG5_txtSeek(MMG5_pTxtBuf tb,long pos) {
+
+  if ( pos >= tb->off && pos <= tb->off + (long)tb->len ) {
+    if ( fseek(tb->inm,tb->off+(long)tb->len,SEEK_SET) ) return 0;
+    tb->cur = (size_t)(pos - tb->off);
+    return 1;
+  }
+  if ( fseek(tb->inm,pos,SEEK_SET) ) return 0;
+
+  tb->off = pos;
+  tb->len = tb->cur = 0;
+  tb->eof = 0;
+  tb->buf[0] = '\0';
+
+  return 1;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param s string to fill.
+ * \param lg size of \a s.
+ * \return 1 if success, 0 at the end of the file.
+ *
+ * Read the next word (at most \a lg-1 characters), as fscanf with the "%s"
+ * conversion.
+ *
+ */
+int MMG5_txtWord(MMG5_pTxtBuf tb,char *s,int lg) {
+  const char *p;
+  int        n;
+
+  if ( !MMG5_txtStart(tb) ) return 0;
+
+  do {
+    p = tb->buf + tb->cur;
+    for ( n=0; n<lg-1 && *p && !MMG5_txtIsSpace(*p); ++n ) {
+      s[n] = *p++;
+    }
+  } while ( n < lg-1 && MMG5_txtCut(tb,p) );
+  s[n]    = '\0';
+
+  /* Null character in the file: skip it */
+  if ( !n ) ++p;
+  tb->cur = (size_t)(p - tb->buf);
+
+  return 1;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param s string to fill.
+ * \param lg size of \a s.
+ * \return 1 if success, 0 at the end of the file.
+ *
+ * Read the next word that is not a number (at most \a lg-1 characters). The
+ * numbers are skipped without being copied nor parsed, so it is the fast way
+ * to look for the keywords of a file.
+ *
+ */
+int MMG5_txtKeyword(MMG5_pTxtBuf tb,char *s,int lg) {
+  const char *p;
+  char       c;
+
+  while ( MMG5_txtStart(tb) ) {
+    c = tb->buf[tb->cur];
+    if ( !((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.') ) {
+      return MMG5_txtWord(tb,s,lg);
+    }
+    /* skip the number, that may be cut by the end of the buffer */
+    do {
+      p = tb->buf + tb->cur;
+      while ( *p && !MMG5_txtIsSpace(*p) ) ++p;
+      tb->cur = (size_t)(p - tb->buf);
+    } while ( tb->cur == tb->len && MMG5_txtFill(tb) );
+  }
+
+  return 0;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \return 1.
+ *
+ * Skip the end of the current line (end of line character included).
+ *
+ */
+int MMG5_txtSkipLine(MMG5_pTxtBuf tb) {
+  const char *p;
+
+  while ( 1 ) {
+    p = memchr(tb->buf+tb->cur,'\n',tb->len-tb->cur);
+    if ( p ) {
+      tb->cur = (size_t)(p - tb->buf) + 1;
+      return 1;
+    }
+    tb->cur = tb->len;
+    if ( !MMG5_txtFill(tb) ) return 1;
+  }
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param val integer to fill.
+ * \return 1 if success, 0 if the next token is not an integer.
+ *
+ * Read the next integer, as fscanf with the "%d" conversion.
+ *
+ */
+int MMG5_txtInt(MMG5_pTxtBuf tb,MMG5_int *val) {
+  const char *p,*q;
+  int64_t    v;
+  int        neg;
+
+  if ( !MMG5_txtStart(tb) ) return 0;
+
+  do {
+    p   = tb->buf + tb->cur;
+    neg = 0;
+    if ( *p == '-' ) { neg = 1; ++p; }
+    else if ( *p == '+' ) ++p;
+
+    v = 0;
+    for ( q=p; *q >= '0' && *q <= '9'; ++q ) {
+      v = 10*v + (*q - '0');
+    }
+  } while ( MMG5_txtCut(tb,q) );
+  if ( q == p ) return 0;
+  if ( tb->strict && *q && !MMG5_txtIsSpace(*q) ) return 0;
+
+  *val    = (MMG5_int)(neg ? -v : v);
+  tb->cur = (size_t)(q - tb->buf);
+
+  return 1;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param val integer to fill.
+ * \return 1 if success, 0 if the next token is not an integer.
+ *
+ * Read the next integer in an int variable.
+ *
+ */
+int MMG5_txtInt32(MMG5_pTxtBuf tb,int *val) {
+  MMG5_int v;
+
+  if ( !MMG5_txtInt(tb,&v) ) return 0;
+  *val = (int)v;
+
+  return 1;
+}
+
+/**
+ * \param p beginning of the token (after the blank characters).
+ * \param m mantissa of the number (to fill).
+ * \param e decimal exponent of the number (to fill).
+ * \param neg 1 if the number is negative (to fill).
+ * \return pointer toward the end of the number, NULL if the number can't be
+ * exactly represented by \a m and \a e.
+ *
+ * Decompose a decimal number with at most 19 significant digits into \f$ \pm m
+ * 10^e \f$. Other numbers (longer mantissa, hexadecimal numbers, inf, nan...)
+ * are left to strtod.
+ *
+ */
+static inline
+const char *MMG5_txtDecimal(const char *p,uint64_t *m,int *e,int *neg) {
+  int nd,ex,exneg,any;
+
+  *neg = 0;
+  if ( *p == '-' ) { *neg = 1; ++p; }
+  else if ( *p == '+' ) ++p;
+
+  *m = 0;
+  *e = 0;
+  nd = any = 0;
+  while ( *p == '0' ) { ++p; any = 1; }
+  while ( *p >= '0' && *p <= '9' ) {
+    if ( ++nd > 19 ) return NULL;
+    *m = 10*(*m) + (uint64_t)(*p++ - '0');
+    any = 1;
+  }
+  if ( *p == '.' ) {
+    ++p;
+    if ( !nd ) {
+      while ( *p == '0' ) { ++p; --(*e); any = 1; }
+    }
+    while ( *p >= '0' && *p <= '9' ) {
+      if ( ++nd > 19 ) return NULL;
+      *m = 10*(*m) + (uint64_t)(*p++ - '0');
+      --(*e);
+      any = 1;
+    }
+  }
+  if ( !any ) return NULL;
+
+  if ( *p == 'e' || *p == 'E' ) {
+    ++p;
+    exneg = 0;
+    if ( *p == '-' ) { exneg = 1; ++p; }
+    else if ( *p == '+' ) ++p;
+    if ( !(*p >= '0' && *p <= '9') ) return NULL;
+    ex = 0;
+    while ( *p >= '0' && *p <= '9' ) {
+      if ( ex > 10000 ) return NULL;
+      ex = 10*ex + (*p++ - '0');
+    }
+    *e += exneg ? -ex : ex;
+  }
+
+  /* Let strtod deal with the tokens that are not plain decimal numbers */
+  if ( (*p >= '0' && *p <= '9') || (*p >= 'a' && *p <= 'z') ||
+       (*p >= 'A' && *p <= 'Z') || *p == '.' ) return NULL;
+
+  return p;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param val real to fill.
+ * \return 1 if success, 0 if the next token is not a real.
+ *
+ * Read the next real, as fscanf with the "%lf" conversion. When the mantissa
+ * and the power of ten are both exact doubles, the value is computed by one
+ * correctly rounded product or division; otherwise strtod is called, so the
+ * result is always the one of strtod.
+ *
+ */
+int MMG5_txtDouble(MMG5_pTxtBuf tb,double *val) {
+  const char *s,*p;
+  char       *end;
+  uint64_t   m;
+  double     d;
+  int        e,neg,slow;
+
+  if ( !MMG5_txtStart(tb) ) return 0;
+
+  do {
+    s    = tb->buf + tb->cur;
+    p    = MMG5_txtDecimal(s,&m,&e,&neg);
+    slow = !p || m > ((uint64_t)1<<53) || e < -22 || e > 22;
+    if ( slow ) {
+      d = strtod(s,&end);
+      p = end;
+    }
+  } while ( MMG5_txtCut(tb,p) );
+
+  if ( p == s ) return 0;
+  if ( tb->strict && *p && !MMG5_txtIsSpace(*p) ) return 0;
+
+  if ( !slow ) {
+    d = (double)m;
+    d = ( e < 0 ) ? d / MMG5_txtPow10[-e] : d * MMG5_txtPow10[e];
+    if ( neg ) d = -d;
+  }
+  *val    = d;
+  tb->cur = (size_t)(p - tb->buf);
+
+  return 1;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param val real to fill.
+ * \return 1 if success, 0 if the next token is not a real.
+ *
+ * Read the next real in single precision, as fscanf with the "%f" conversion
+ * (same exactness rule as \ref MMG5_txtDouble, with strtof).
+ *
+ */
+int MMG5_txtFloat(MMG5_pTxtBuf tb,float *val) {
+  const char *s,*p;
+  char       *end;
+  uint64_t   m;
+  float      f;
+  int        e,neg,slow;
+
+  if ( !MMG5_txtStart(tb) ) return 0;
+
+  do {
+    s    = tb->buf + tb->cur;
+    p    = MMG5_txtDecimal(s,&m,&e,&neg);
+    slow = !p || m > ((uint64_t)1<<24) || e < -10 || e > 10;
+    if ( slow ) {
+      f = strtof(s,&end);
+      p = end;
+    }
+  } while ( MMG5_txtCut(tb,p) );
+
+  if ( p == s ) return 0;
+  if ( tb->strict && *p && !MMG5_txtIsSpace(*p) ) return 0;
+
+  if ( !slow ) {
+    f = (float)m;
+    f = ( e < 0 ) ? f / MMG5_txtPow10f[-e] : f * MMG5_txtPow10f[e];
+    if ( neg ) f = -f;
+  }
+  *val    = f;
+  tb->cur = (size_t)(p - tb->buf);
+
+  return 1;
+}
+
+/** Part of a block of an ASCII file parsed by one thread */
+typedef struct {
+  size_t   beg;   /*!< first byte of the part in the block */
+  size_t   stop;  /*!< end of the last record parsed in the part */
+  int64_t  ntok;  /*!< number of tokens beginning in the part */
+  MMG5_int first; /*!< first record beginning in the part (from the block) */
+  int      skip;  /*!< number of tokens of the previous record in the part */
+  int      ok;    /*!< 0 if a record of the part can't be parsed */
+} MMG5_TxtPart;
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param nc number of threads.
+ * \param nrec number of records to read.
+ * \param ntok number of tokens per record.
+ * \param fn reader of one record.
+ * \param data data passed to \a fn.
+ * \return the number of records read, -1 if the tokenizer can't be placed
+ * after the last record.
+ *
+ * Parallel part of \ref MMG5_txtRecords. The file is read by blocks of \a nc
+ * times \ref MMG5_TXTPAR_LGTH bytes. A block is ended at a blank character and
+ * split into \a nc parts at blank characters. The tokens of the parts are
+ * counted in parallel, which gives the first record beginning in each part,
+ * then each thread parses the records beginning in its part. The records that
+ * are not complete in the block are parsed with the next block.
+ *
+ * The numbers must end at a blank character (see \ref MMG5_TxtBuf::strict) so
+ * each record has exactly \a ntok tokens. If a record of a block can't be
+ * parsed this way, the tokenizer is left at the beginning of this block: the
+ * caller reads the remaining records sequentially and gets the values (or the
+ * error) of a sequential read.
+ *
+ * The blocks are counted in the memory used by the mesh: if they don't fit in
+ * the authorized memory, no record is read here.
+ *
+ */
+static
+MMG5_int MMG5_txtRecordsPar(MMG5_pTxtBuf tb,int nc,MMG5_int nrec,int ntok,
+                            MMG5_txtRecord fn,void *data) {
+  MMG5_TxtPart *part;
+  char         *chunk;
+  int64_t      ntot;
+  size_t       cap,mem,len,end,n,b;
+  long         pos;
+  MMG5_int     k,navail;
+  int          c,eof,ok;
+
+  pos = MMG5_txtTell(tb);
+  if ( fseek(tb->inm,pos,SEEK_SET) ) return 0;
+
+  /* The blocks don't fit in the authorized memory: the records are read
+   * sequentially */
+  cap = (size_t)nc * MMG5_TXTPAR_LGTH;
+  mem = (cap+1)*sizeof(char) + (nc+1)*sizeof(MMG5_TxtPart);
+  if ( tb->mesh->memCur + mem > tb->mesh->memMax ) return 0;
+
+  MMG5_ADD_MEM(tb->mesh,mem,"parallel read buffer",return 0);
+  MMG5_SAFE_MALLOC(chunk,cap+1,char,tb->mesh->memCur -= mem;return 0);
+  MMG5_SAFE_MALLOC(part,nc+1,MMG5_TxtPart,MMG5_DEL_MEM(tb->mesh,chunk);
+                   tb->mesh->memCur -= (nc+1)*sizeof(MMG5_TxtPart);return 0);
+
+  k   = 0;
+  len = 0;
+  eof = 0;
+  while ( k < nrec ) {
+    /* Complete the block */
+    if ( !eof ) {
+      n    = fread(chunk+len,1,cap-len,tb->inm);
+      eof  = ( n < cap-len );
+      len += n;
+    }
+    chunk[len] = '\0';
+
+    /* End the block at a blank character: the last token may be cut */
+    end = len;
+    if ( !eof ) {
+      while ( end && !MMG5_txtIsSpace(chunk[end-1]) ) --end;
+    }
+
+    /* Split the block into parts that begin at a blank character */
+    part[0].beg  = 0;
+    part[nc].beg = end;
+    for ( c=1; c<nc; ++c ) {
+      b = MG_MAX(part[c-1].beg,end/nc*c);
+      while ( b < end && !MMG5_txtIsSpace(chunk[b]) ) ++b;
+      part[c].beg = b;
+    }
+
+    /* Count the tokens beginning in each part */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nc)
+#endif
+    for ( c=0; c<nc; ++c ) {
+      int64_t nt;
+      size_t  i;
+      int     blank,sp;
+
+      nt    = 0;
+      blank = 1;
+      for ( i=part[c].beg; i<part[c+1].beg; ++i ) {
+        sp     = MMG5_txtIsSpace(chunk[i]);
+        nt    += ( blank && !sp );
+        blank  = sp;
+      }
+      part[c].ntok = nt;
+    }
+
+    /* First record beginning in each part */
+    ntot = 0;
+    for ( c=0; c<nc; ++c ) {
+      part[c].first = (MMG5_int)((ntot + ntok - 1) / ntok);
+      part[c].skip  = (int)((int64_t)part[c].first*ntok - ntot);
+      ntot         += part[c].ntok;
+    }
+    navail = (MMG5_int)MG_MIN((int64_t)(nrec-k),ntot/ntok);
+    if ( !navail ) break;
+
+    part[nc].first = navail;
+    for ( c=0; c<nc; ++c ) {
+      part[c].first = MG_MIN(part[c].first,navail);
+    }
+
+    /* Parse the records */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nc) schedule(dynamic,1)
+#endif
+    for ( c=0; c<nc; ++c ) {
+      MMG5_TxtBuf view;
+      MMG5_int    r;
+      int         s;
+
+      part[c].ok = 1;
+      if ( part[c].first >= part[c+1].first ) continue;
+
+      view.mesh   = NULL;
+      view.inm    = NULL;
+      view.buf    = chunk + part[c].beg;
+      view.len    = end - part[c].beg;
+      view.cur    = 0;
+      view.off    = 0;
+      view.eof    = 1;
+      view.strict = 1;
+
+      /* Skip the end of the record begun in the previous part */
+      for ( s=0; s<part[c].skip; ++s ) {
+        while ( view.cur < view.len &&  MMG5_txtIsSpace(view.buf[view.cur]) )
+          ++view.cur;
+        while ( view.cur < view.len && !MMG5_txtIsSpace(view.buf[view.cur]) )
+          ++view.cur;
+      }
+      for ( r=part[c].first; r<part[c+1].first; ++r ) {
+        if ( !fn(&view,k+r,data) ) {
+          part[c].ok = 0;
+          break;
+        }
+      }
+      part[c].stop = part[c].beg + view.cur;
+    }
+
+    ok = 1;
+    b  = 0;
+    for ( c=0; c<nc; ++c ) {
+      if ( !part[c].ok ) ok = 0;
+      if ( part[c].first < part[c+1].first ) b = part[c].stop;
+    }
+    if ( !ok ) break;
+
+    /* Keep the bytes that follow the last record for the next block */
+    k   += navail;
+    pos += (long)b;
+    len -= b;
+    memmove(chunk,chunk+b,len);
+  }
+
+  MMG5_DEL_MEM(tb->mesh,part);
+  MMG5_DEL_MEM(tb->mesh,chunk);
+
+  /* Place the tokenizer after the last record read */
+  if ( !MMG5_txtSeek(tb,pos) ) return -1;
+
+  return k;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param tb pointer to the tokenizer, placed before the first record.
+ * \param nrec number of records.
+ * \param ntok number of tokens of a record.
+ * \param fn reader of one record.
+ * \param data data passed to \a fn.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the \a nrec records of a section of an ASCII file (vertices, elements,
+ * solution values...). When the section is large enough to use several
+ * threads (see \ref MMG5_nthreads), it is parsed in parallel by blocks (see
+ * \ref MMG5_txtRecordsPar), otherwise the records are read one after the
+ * other. The values read and the errors are the same in both cases.
+ *
+ */
+int MMG5_txtRecords(MMG5_pMesh mesh,MMG5_pTxtBuf tb,MMG5_int nrec,int ntok,
+                    MMG5_txtRecord fn,void *data) {
+  MMG5_int k;
+  int      nc;
+
+  k  = 0;
+  nc = MMG5_nthreads(mesh,nrec);
+  if ( nc > 1 && ntok > 0 ) {
+    k = MMG5_txtRecordsPar(tb,nc,nrec,ntok,fn,data);
+    if ( k < 0 ) return 0;
+  }
+  for ( ; k<nrec; ++k ) {
+    if ( !fn(tb,k,data) ) return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param k index of the record (from 0).
+ * \param data pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the coordinates and the reference of the vertex \a k+1 from the
+ * Vertices section of a 3D mesh (reader of \ref MMG5_txtRecords). The
+ * coordinates are in single precision in files of version 1.
+ *
+ */
+int MMG5_txtPoint(MMG5_pTxtBuf tb,MMG5_int k,void *data) {
+  MMG5_pMesh  mesh = (MMG5_pMesh)data;
+  MMG5_pPoint ppt;
+  float       fc;
+  int         i;
+
+  ppt = &mesh->point[k+1];
+  if ( mesh->ver < 2 ) {
+    for ( i=0; i<3; i++ ) {
+      if ( !MMG5_txtFloat(tb,&fc) ) return 0;
+      ppt->c[i] = (double)fc;
+    }
+    return MMG5_txtInt(tb,&ppt->ref);
+  }
+  return MMG5_txtDouble(tb,&ppt->c[0]) && MMG5_txtDouble(tb,&ppt->c[1]) &&
+    MMG5_txtDouble(tb,&ppt->c[2]) && MMG5_txtInt(tb,&ppt->ref);
+}
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param k index of the record (from 0).
+ * \param data pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the vertices and the reference of the triangle \a k+1 from the
+ * Triangles section of a mesh (reader of \ref MMG5_txtRecords).
+ *
+ */
+int MMG5_txtTria(MMG5_pTxtBuf tb,MMG5_int k,void *data) {
+  MMG5_pMesh mesh = (MMG5_pMesh)data;
+  MMG5_pTria pt;
+
+  pt = &mesh->tria[k+1];
+  return MMG5_txtInt(tb,&pt->v[0]) && MMG5_txtInt(tb,&pt->v[1]) &&
+    MMG5_txtInt(tb,&pt->v[2]) && MMG5_txtInt(tb,&pt->ref);
+}
+
+/** Solutions read by \ref MMG5_txtSol */
+typedef struct {
+  MMG5_pSol sol;   /*!< array of solutions */
+  int       nsols; /*!< number of solutions */
+} MMG5_TxtSols;
+
+/**
+ * \param tb pointer to the tokenizer.
+ * \param k index of the record (from 0).
+ * \param data pointer toward a \ref MMG5_TxtSols structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the values of each solution at the vertex \a k+1 (reader of \ref
+ * MMG5_txtRecords). Values are in single precision if the version of the
+ * first solution is 1 and the 3rd and 4th values of the 3D tensors are
+ * swapped (Medit storage).
+ *
+ */
+static
+int MMG5_txtSol(MMG5_pTxtBuf tb,MMG5_int k,void *data) {
+  MMG5_TxtSols *ts = (MMG5_TxtSols*)data;
+  MMG5_pSol    psl;
+  double       dbuf[6],tmpd;
+  float        fbuf;
+  int          i,j;
+
+  for ( j=0; j<ts->nsols; ++j ) {
+    psl = ts->sol + j;
+    for ( i=0; i<psl->size; ++i ) {
+      if ( ts->sol[0].ver == 1 ) {
+        if ( !MMG5_txtFloat(tb,&fbuf) ) return 0;
+        dbuf[i] = (double)fbuf;
+      }
+      else if ( !MMG5_txtDouble(tb,&dbuf[i]) ) return 0;
+    }
+    if ( psl->size == 6 ) {
+      tmpd    = dbuf[2];
+      dbuf[2] = dbuf[3];
+      dbuf[3] = tmpd;
+    }
+    for ( i=0; i<psl->size; ++i ) {
+      psl->m[psl->size*(k+1)+i] = dbuf[i];
+    }
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param tb pointer to the tokenizer, placed before the first value.
+ * \param sol array of solutions.
+ * \param nsols number of solutions.
+ * \param np number of vertices.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the values of \a nsols solutions at \a np vertices from an ASCII
+ * solution file (in parallel if possible, see \ref MMG5_txtRecords).
+ *
+ */
+int MMG5_txtSols(MMG5_pMesh mesh,MMG5_pTxtBuf tb,MMG5_pSol sol,int nsols,
+                 MMG5_int np) {
+  MMG5_TxtSols ts;
+  int          j,ntok;
+
+  ts.sol   = sol;
+  ts.nsols = nsols;
+
+  ntok = 0;
+  for ( j=0; j<nsols; ++j ) {
+    ntok += sol[j].size;
+  }
+
+  return MMG5_txtRecords(mesh,tb,np,ntok,MMG5_txtSol,&ts);
+}
+
+/**
+ * \param out pointer to the file to write.
+ * \param ob pointer to the output buffer to initialize.
+ * \return 1 if success, 0 if fail.
+ *
+ * Initialize a buffered writer on a file opened for writing.
+ *
+ */
+int MMG5_outInit(FILE *out,MMG5_pOutBuf ob) {
+
+  ob->out = out;
+  ob->len = 0;
+  ob->err = 0;
+
+  MMG5_SAFE_MALLOC(ob->buf,MMG5_OUTBUF_LGTH,char,return 0);
+
+  return 1;
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \return 1 if success, 0 if a write has failed.
+ *
+ * Write the content of an output buffer into the file and empty the buffer.
+ *
+ */
+int MMG5_outFlush(MMG5_pOutBuf ob) {
+
+  if ( ob->len && fwrite(ob->buf,1,ob->len,ob->out) != ob->len ) {
+    ob->err = 1;
+  }
+  ob->len = 0;
+
+  return !ob->err;
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \return 1 if success, 0 if a write has failed.
+ *
+ * Flush and free an output buffer (the file is not closed).
+ *
+ */
+int MMG5_outFree(MMG5_pOutBuf ob) {
+
+  MMG5_outFlush(ob);
+  MMG5_SAFE_FREE(ob->buf);
+
+  return !ob->err;
+}
+
+/**
+ * \param s string in which the real is written (at least \ref
+ * MMG5_OUTTOK_LGTH characters).
+ * \param x real to write.
+ * \param prec number of significant digits (at most 15).
+ * \return a pointer to the end of the written string (not null-terminated).
+ *
+ * Write a real with the same characters than the "%.<prec>g" format of printf.
+ * The mantissa is computed by an exact scaling by a power of ten in extended
+ * precision and the characters are written by hand; reals too large or too
+ * small for this scaling and those whose rounding is ambiguous in extended
+ * precision are written by sprintf.
+ *
+ */
+char *MMG5_outFormat(char *s,double x,int prec) {
+#if LDBL_MANT_DIG >= 64
+  static const long double p10[28] = {
+    1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L,
+    1e10L,1e11L,1e12L,1e13L,1e14L,1e15L,1e16L,1e17L,1e18L,1e19L,
+    1e20L,1e21L,1e22L,1e23L,1e24L,1e25L,1e26L,1e27L};
+  long double y,r;
+  double      d;
+  uint64_t    m,lo,hi;
+  char        dig[16];
+  int         e,p,i,n,it;
+
+  d = fabs(x);
+  if ( d == 0. ) {
+    if ( signbit(x) )  *s++ = '-';
+    *s++ = '0';
+    return s;
+  }
+  if ( !isfinite(d) || prec < 1 || prec > 15 )  goto fallback;
+
+  lo = (uint64_t)p10[prec-1];
+  hi = (uint64_t)p10[prec];
+
+  /* Decimal exponent of the real (log10 may be wrong by one) */
+  e = (int)floor(log10(d));
+  for ( it=0; it<3; ++it ) {
+    p = prec-1-e;
+    if ( p > 27 || p < -27 )  goto fallback;
+
+    /* The power of ten is exact so y is the exactly rounded scaling of d */
+    y = ( p >= 0 ) ? (long double)d * p10[p] : (long double)d / p10[-p];
+
+    if ( y >= (long double)hi )      ++e;
+    else if ( y < (long double)lo )  --e;
+    else break;
+  }
+  if ( it == 3 )  goto fallback;
+
+  /* Round the mantissa to prec digits */
+  m = (uint64_t)y;
+  r = y - (long double)m;
+  if ( fabsl(r - 0.5L) < 1e-3L )  goto fallback;
+  if ( r > 0.5L )  ++m;
+  if ( m == hi ) {
+    m = lo;
+    ++e;
+  }
+
+  /* Significant digits without the trailing zeros */
+  for ( i=prec-1; i>=0; --i ) {
+    dig[i] = (char)('0' + m%10);
+    m /= 10;
+  }
+  n = prec;
+  while ( n > 1 && dig[n-1] == '0' )  --n;
+
+  if ( x < 0. )  *s++ = '-';
+
+  if ( e < -4 || e >= prec ) {
+    /* Exponential notation */
+    *s++ = dig[0];
+    if ( n > 1 ) {
+      *s++ = '.';
+      for ( i=1; i<n; ++i )  *s++ = dig[i];
+    }
+    *s++ = 'e';
+    *s++ = ( e < 0 ) ? '-' : '+';
+    if ( e < 0 )  e = -e;
+    if ( e >= 100 )  *s++ = (char)('0' + e/100);
+    *s++ = (char)('0' + (e/10)%10);
+    *s++ = (char)('0' + e%10);
+  }
+  else if ( e >= 0 ) {
+    /* Fixed notation, real greater than 1 */
+    for ( i=0; i<=e; ++i )  *s++ = ( i < n ) ? dig[i] : '0';
+    if ( n > e+1 ) {
+      *s++ = '.';
+      for ( i=e+1; i<n; ++i )  *s++ = dig[i];
+    }
+  }
+  else {
+    /* Fixed notation, real smaller than 1 */
+    *s++ = '0';
+    *s++ = '.';
+    for ( i=1; i<-e; ++i )  *s++ = '0';
+    for ( i=0; i<n; ++i )  *s++ = dig[i];
+  }
+  return s;
+
+fallback:
+#endif
+  return s + sprintf(s,"%.*g",prec,x);
+}
+
 /**
  * \param inm pointer to file unit
  * \param nelts number of elements
@@ -129,7 +1179,7 @@ int MMG5_countBinaryElts(FILE **inm, const int nelts,const int iswp,
 {
   int         typ,tagNum,i,l;
   int         k,num,idx;
-  static char mmgWarn = 0;
+  static MMG5_THREADLOCAL char mmgWarn = 0;
 
   k = 0;
 
@@ -280,6 +1330,7 @@ int MMG5_loadMshMesh_part1(MMG5_pMesh mesh,const char *filename,
                            long *posNodes, long *posElts,
                            long **posNodeData, int *bin, int *iswp,
                            MMG5_int *nelts,int *nsols) {
+  MMG5_TxtBuf tb;
   double      dbuf[9];
   float       fbuf[9];
   int         ver,oneBin,i;
@@ -310,11 +1361,11 @@ int MMG5_loadMshMesh_part1(MMG5_pMesh mesh,const char *filename,
   if ( !ptr ) {
     /* data contains the filename without extension */
     strcat(data,".mshb");
-    if (!(*inm = fopen(data,"rb")) ) {
+    if (!(*inm = MMG5_fopen(data,"rb")) ) {
       ptr  = strstr(data,".msh");
       *ptr = '\0';
       strcat(data,".msh");
-      if( !((*inm) = fopen(data,"rb")) ) {
+      if( !((*inm) = MMG5_fopen(data,"rb")) ) {
         MMG5_SAFE_FREE(data);
         MMG5_SAFE_FREE(*posNodeData);
         return 0;
@@ -322,7 +1373,7 @@ int MMG5_loadMshMesh_part1(MMG5_pMesh mesh,const char *filename,
     }
   }
   else {
-    if( !((*inm) = fopen(data,"rb")) ) {
+    if( !((*inm) = MMG5_fopen(data,"rb")) ) {
       MMG5_SAFE_FREE(data);
       MMG5_SAFE_FREE(*posNodeData);
       return 0;
@@ -358,7 +1409,16 @@ int MMG5_loadMshMesh_part1(MMG5_pMesh mesh,const char *filename,
     } else if(!strncmp(chaine,"$Nodes",strlen("$Nodes"))) {
       MMG_FSCANF((*inm),"%" MMG5_PRId " ",&mesh->npi);
       *posNodes = ftell((*inm));
-      if ( *bin ) {
+      if ( !*bin ) {
+        /* Skip the ASCII nodes data (one node per line) */
+        if ( !MMG5_txtInit(mesh,*inm,&tb) ) return -1;
+        for ( k=1; k<=mesh->npi; ++k ) {
+          MMG5_txtSkipLine(&tb);
+        }
+        fseek((*inm),MMG5_txtTell(&tb),SEEK_SET);
+        MMG5_txtFree(&tb);
+      }
+      else {
         /* Skip the binary nodes data */
         if ( mesh->ver==1 ) {
           for ( k=1; k<=mesh->npi; ++k ) {
@@ -436,8 +1496,9 @@ int MMG5_loadMshMesh_part1(MMG5_pMesh mesh,const char *filename,
 
       /* Count the elements */
       if ( !*bin ) {
+        if ( !MMG5_txtInit(mesh,*inm,&tb) ) return -1;
         for ( k=0; k<*nelts; ++k) {
-          MMG_FSCANF((*inm),"%d %d ",&i,&typ);
+          MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i) && MMG5_txtInt32(&tb,&typ));
           switch (typ) {
           case 1:
             /* Edge */
@@ -464,11 +1525,11 @@ int MMG5_loadMshMesh_part1(MMG5_pMesh mesh,const char *filename,
             ++np;
             break;
           }
-          if ( 0 != fscanf((*inm),"%*[^\n]%*c") ) {
-            fputs ( "Reading error", stderr );
-            return -1;
-          }
+          MMG5_txtSkipLine(&tb);
         }
+        /* Resume the reading of the file after the elements */
+        fseek((*inm),MMG5_txtTell(&tb),SEEK_SET);
+        MMG5_txtFree(&tb);
       }
       else {
         if ( !MMG5_countBinaryElts(inm,*nelts,*iswp,&np,&na,&nt,&nq,&ne,&npr) ) {
@@ -672,6 +1733,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
   MMG5_pEdge    pa;
   MMG5_pPoint   ppt;
   MMG5_pSol     psl;
+  MMG5_TxtBuf   tb;
   double        dbuf[9];
   float         fbuf[9],fc;
   int           i,ier;
@@ -680,20 +1742,22 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
   int           isol;
   int8_t        metricData;
   char          chaine[MMG5_FILESTR_LGTH],*ptr;
-  static int8_t mmgWarn=0, mmgWarn1=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0, mmgWarn1=0;
 
   /** Second step: read the nodes and elements */
   rewind((*inm));
   fseek((*inm),posNodes,SEEK_SET);
+  tb.buf = NULL;
+  if ( !bin && !MMG5_txtInit(mesh,*inm,&tb) ) return -1;
 
   if ( mesh->ver < 2 ) {
     for ( k=0; k< mesh->np; ++k)
     {
       if ( !bin ) {
-        MMG_FSCANF((*inm),"%d ",&idx);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&idx));
         ppt = &mesh->point[idx];
         for (i=0 ; i<mesh->dim ; i++) {
-          MMG_FSCANF((*inm),"%f ",&fc);
+          MMG5_TXT_READ(&tb,MMG5_txtFloat(&tb,&fc));
           ppt->c[i] = (double) fc;
         }
       }
@@ -716,9 +1780,10 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
     for ( k=0; k< mesh->np; ++k)
     {
       if ( !bin ) {
-        MMG_FSCANF((*inm),"%d ",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
         ppt = &mesh->point[i];
-        MMG_FSCANF((*inm),"%lf %lf %lf ",&ppt->c[0],&ppt->c[1],&ppt->c[2]);
+        MMG5_TXT_READ(&tb,MMG5_txtDouble(&tb,&ppt->c[0]) && MMG5_txtDouble(&tb,&ppt->c[1]) &&
+                          MMG5_txtDouble(&tb,&ppt->c[2]));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,(*inm));
@@ -737,6 +1802,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
 
   rewind((*inm));
   fseek((*inm),posElts,SEEK_SET);
+  if ( tb.buf ) MMG5_txtSeek(&tb,posElts);
 
   nbl_a = nbl_t = nt = na = nq = ne = npr = 0;
   nref = 0;
@@ -744,16 +1810,18 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
   if ( !bin ) {
     for ( k=0; k<nelts; ++k)
     {
-      MMG_FSCANF((*inm),"%d %d %d ",&i,&typ, &tagNum);
+      MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i) && MMG5_txtInt32(&tb,&typ) &&
+                        MMG5_txtInt32(&tb,&tagNum));
       if ( tagNum < 2 ) {
         fprintf(stderr,"\n  ## Error: %s: elt %d (type %d): Expected at least 2 tags (%d given).\n",
                 __func__,k,typ,tagNum);
+        MMG5_txtFree(&tb);
         fclose(*inm);
         return -1;
       }
-      MMG_FSCANF((*inm),"%d %d ",&ref,&i);
+      MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&ref) && MMG5_txtInt32(&tb,&i));
       for ( l=2; l<tagNum; ++l ) {
-        MMG_FSCANF((*inm),"%d ",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
 
       switch (typ) {
@@ -763,12 +1831,12 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
         if ( mesh->info.iso && MMG5_abs(ref)== mesh->info.isoref ) {
           /* Skip this edge but advance the file pointer */
           pa = &mesh->edge[0];
-          MMG_FSCANF((*inm),"%" MMG5_PRId " %" MMG5_PRId " ",&pa->a,&pa->b);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pa->a) && MMG5_txtInt(&tb,&pa->b));
           ++nbl_a;
         }
         else {
           pa = &mesh->edge[++na];
-          MMG_FSCANF((*inm),"%" MMG5_PRId " %" MMG5_PRId " ",&pa->a,&pa->b);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pa->a) && MMG5_txtInt(&tb,&pa->b));
           pa->ref = ref;
           if ( pa->ref < 0 ) {
             pa->ref = -pa->ref;
@@ -784,12 +1852,14 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
         if ( mesh->info.iso && MMG5_abs(ref)== mesh->info.isoref && mesh->dim == 3 ) {
           /* Skip this triangle but advance the file pointer */
           ptt = &mesh->tria[0];
-          MMG_FSCANF((*inm),"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&ptt->v[0],&ptt->v[1],&ptt->v[2]);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ptt->v[0]) && MMG5_txtInt(&tb,&ptt->v[1]) &&
+                            MMG5_txtInt(&tb,&ptt->v[2]));
           ++nbl_t;
         }
         else {
           ptt = &mesh->tria[++nt];
-          MMG_FSCANF((*inm),"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " ",&ptt->v[0],&ptt->v[1],&ptt->v[2]);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ptt->v[0]) && MMG5_txtInt(&tb,&ptt->v[1]) &&
+                            MMG5_txtInt(&tb,&ptt->v[2]));
           ptt->ref = ref;
           if ( ptt->ref < 0 ) {
             ptt->ref = -ptt->ref;
@@ -801,7 +1871,8 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
       case 3:
         /* Quad */
         pq1 = &mesh->quadra[++nq];
-        MMG_FSCANF((*inm),"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " ",&pq1->v[0],&pq1->v[1],&pq1->v[2],&pq1->v[3]);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pq1->v[0]) && MMG5_txtInt(&tb,&pq1->v[1]) &&
+                          MMG5_txtInt(&tb,&pq1->v[2]) && MMG5_txtInt(&tb,&pq1->v[3]));
         pq1->ref = ref;
         if ( pq1->ref < 0 ) {
           pq1->ref = -pq1->ref;
@@ -813,10 +1884,12 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
         /* Tetra for mmg3d */
         if ( mesh->ne ) {
           pt = &mesh->tetra[++ne];
-          MMG_FSCANF((*inm),"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " ",&pt->v[0],&pt->v[1],&pt->v[2],&pt->v[3]);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pt->v[0]) && MMG5_txtInt(&tb,&pt->v[1]) &&
+                            MMG5_txtInt(&tb,&pt->v[2]) && MMG5_txtInt(&tb,&pt->v[3]));
           pt->ref = MMG5_abs(ref);
         } else { /*skip tetra*/
-          MMG_FSCANF((*inm),"%d %d %d %d ",&v[0],&v[1],&v[2],&v[3]);
+          MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&v[0]) && MMG5_txtInt32(&tb,&v[1]) &&
+                            MMG5_txtInt32(&tb,&v[2]) && MMG5_txtInt32(&tb,&v[3]));
         }
 
         if(ref < 0) {
@@ -830,8 +1903,9 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
         if ( mesh->nprism )
         {
           pp = &mesh->prism[++npr];
-          MMG_FSCANF((*inm),"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " ",&pp->v[0],&pp->v[1],&pp->v[2],
-                     &pp->v[3],&pp->v[4],&pp->v[5]);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pp->v[0]) && MMG5_txtInt(&tb,&pp->v[1]) &&
+                            MMG5_txtInt(&tb,&pp->v[2]) && MMG5_txtInt(&tb,&pp->v[3]) &&
+                            MMG5_txtInt(&tb,&pp->v[4]) && MMG5_txtInt(&tb,&pp->v[5]));
           pp->ref = MMG5_abs(ref);
         }
         if(ref < 0) {
@@ -841,7 +1915,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
         break;
       case 15:
         /* Node */
-        MMG_FSCANF((*inm),"%d ",&l);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&l));
         ppt = &mesh->point[l];
         ppt->ref = ref;
         if ( ppt->ref < 0 ) {
@@ -858,6 +1932,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
         }
       }
     }
+    MMG5_txtFree(&tb);
   }
   else {
     k = 0;
@@ -1569,6 +2644,47 @@ void  MMG5_build3DMetric(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,
   }
 }
 
+/**
+ * \param ob pointer to the output buffer.
+ * \param bin 1 if the file is a binary.
+ * \param nelts index of the element.
+ * \param typ type of the element.
+ * \param ref reference of the element.
+ * \param idx indices of the vertices of the element.
+ * \param nv number of vertices of the element.
+ *
+ * Write an element at MSH file format: "idx type 2 ref ref v0 v1...".
+ *
+ */
+static inline
+void MMG5_outMshElt(MMG5_pOutBuf ob,int bin,MMG5_int nelts,int typ,
+                    MMG5_int ref,const MMG5_int *idx,int nv) {
+  int i;
+
+  if ( !bin ) {
+    MMG5_outInt(ob,nelts);
+    MMG5_outChar(ob,' ');
+    MMG5_outInt(ob,typ);
+    MMG5_outStr(ob," 2 ");
+    MMG5_outInt(ob,ref);
+    MMG5_outChar(ob,' ');
+    MMG5_outInt(ob,ref);
+    for ( i=0; i<nv; ++i ) {
+      MMG5_outChar(ob,' ');
+      MMG5_outInt(ob,idx[i]);
+    }
+    MMG5_outChar(ob,'\n');
+  }
+  else {
+    MMG5_outBin(ob,&nelts,MMG5_SW);
+    MMG5_outBin(ob,&ref,MMG5_SW);
+    MMG5_outBin(ob,&ref,MMG5_SW);
+    for ( i=0; i<nv; ++i ) {
+      MMG5_outBin(ob,&idx[i],MMG5_SW);
+    }
+  }
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param sol pointer to an array of solutions.
@@ -1590,12 +2706,13 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
   MMG5_pQuad  pq;
   MMG5_pEdge  pa;
   MMG5_pSol   psl;
-  double      dbuf[6];
+  MMG5_OutBuf ob;
+  double      dbuf[6],ten[9];
   int         bin,i,typ;
-  MMG5_int    header[3],nq,ne,npr,np,nt,na,k,iadr,nelts,word;
+  MMG5_int    header[3],nq,ne,npr,np,nt,na,k,iadr,nelts,idx[6];
   int         isol,nsols;
   char        *ptr,*data;
-  static char mmgWarn = 0;
+  static MMG5_THREADLOCAL char mmgWarn = 0;
 
   bin = 0;
 
@@ -1606,11 +2723,11 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
   if ( !ptr ) {
     /* data contains the filename without extension */
     strcat(data,".mshb");
-    if (!(inm = fopen(data,"wb")) ) {
+    if (!(inm = MMG5_fopen(data,"wb")) ) {
       ptr  = strstr(data,".msh");
       *ptr = '\0';
       strcat(data,".msh");
-      if( !(inm = fopen(data,"wb")) ) {
+      if( !(inm = MMG5_fopen(data,"wb")) ) {
         fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
         MMG5_SAFE_FREE(data);
         return 0;
@@ -1621,7 +2738,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
   else {
     ptr = strstr(data,".mshb");
     if ( ptr ) bin = 1;
-    if( !(inm = fopen(data,"wb")) ) {
+    if( !(inm = MMG5_fopen(data,"wb")) ) {
       fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
       MMG5_SAFE_FREE(data);
       return 0;
@@ -1632,12 +2749,17 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     fprintf(stdout,"  %%%% %s OPENED\n",data);
   MMG5_SAFE_FREE(data);
 
+  if ( !MMG5_outInit(inm,&ob) ) {
+    fclose(inm);
+    return 0;
+  }
+
   /* Entete fichier*/
   fprintf(inm,"$MeshFormat\n");
   fprintf(inm,"2.2 %d %d\n",bin,8);
   if ( bin ) {
-    word = 1;
-    fwrite(&word,MMG5_SW,1,inm);
+    idx[0] = 1;
+    fwrite(&idx[0],MMG5_SW,1,inm);
     fprintf(inm,"\n");
   }
   fprintf(inm,"$EndMeshFormat\n");
@@ -1658,16 +2780,20 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     ppt = &mesh->point[k];
     if ( MG_VOK(ppt) ) {
       if(!bin) {
-        fprintf(inm," %" MMG5_PRId "",ppt->tmp);
-        for ( i=0; i<3; ++i )
-          fprintf(inm," %.15lg",ppt->c[i]);
-        fprintf(inm,"\n");
+        MMG5_outChar(&ob,' ');
+        MMG5_outInt(&ob,ppt->tmp);
+        for ( i=0; i<3; ++i ) {
+          MMG5_outChar(&ob,' ');
+          MMG5_outReal(&ob,ppt->c[i]);
+        }
+        MMG5_outChar(&ob,'\n');
       } else {
-        fwrite(&ppt->tmp,MMG5_SW,1,inm);
-        fwrite(&ppt->c[0],MMG5_SD,3,inm);
+        MMG5_outBin(&ob,&ppt->tmp,MMG5_SW);
+        MMG5_outBin(&ob,ppt->c,3*MMG5_SD);
       }
     }
   }
+  MMG5_outFlush(&ob);
   if ( bin )  fprintf(inm,"\n");
   fprintf(inm,"$EndNodes\n");
 
@@ -1716,7 +2842,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     header[0] = 15;// Node keyword
     header[1] = np;
     header[2] = 2; // 2 tags per node
-    fwrite(header, MMG5_SW, 3, inm);
+    MMG5_outBin(&ob,header,3*MMG5_SW);
   }
 
   for ( k=1; k<= mesh->np; ++k)
@@ -1725,15 +2851,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     if ( !MG_VOK(ppt) ) continue;
     ++nelts;
 
-    if ( !bin ) fprintf(inm,"%" MMG5_PRId " 15 2 %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,MMG5_abs(ppt->ref),
-                        MMG5_abs(ppt->ref),ppt->tmp);
-    else {
-      fwrite(&nelts,MMG5_SW,1,inm);
-      word = MMG5_abs(ppt->ref);
-      fwrite(&word,MMG5_SW,1,inm);
-      fwrite(&word,MMG5_SW,1,inm);
-      fwrite(&ppt->tmp,MMG5_SW,1,inm);
-    }
+    MMG5_outMshElt(&ob,bin,nelts,15,MMG5_abs(ppt->ref),&ppt->tmp,1);
   }
 
   /* Edges */
@@ -1741,7 +2859,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     header[0] = 1;// Edge keyword
     header[1] = na;
     header[2] = 2; // 2 tags per edge
-    fwrite(header, MMG5_SW, 3, inm);
+    MMG5_outBin(&ob,header,3*MMG5_SW);
   }
 
   for (k=1; k<=mesh->na; ++k) {
@@ -1750,16 +2868,9 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     if ( !pa || !pa->a ) continue;
     ++nelts;
 
-    if(!bin)
-      fprintf(inm,"%" MMG5_PRId " 1 2 %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pa->ref,pa->ref,
-              mesh->point[pa->a].tmp,mesh->point[pa->b].tmp);
-    else {
-      fwrite(&nelts,MMG5_SW,1,inm);
-      fwrite(&pa->ref,MMG5_SW,1,inm);
-      fwrite(&pa->ref,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pa->a].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pa->b].tmp,MMG5_SW,1,inm);
-    }
+    idx[0] = mesh->point[pa->a].tmp;
+    idx[1] = mesh->point[pa->b].tmp;
+    MMG5_outMshElt(&ob,bin,nelts,1,pa->ref,idx,2);
   }
 
   /* Triangles */
@@ -1767,7 +2878,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     header[0] = 2;// Tria keyword
     header[1] = nt;
     header[2] = 2; // 2 tags per tria
-    fwrite(header, MMG5_SW, 3, inm);
+    MMG5_outBin(&ob,header,3*MMG5_SW);
   }
 
   for (k=1; k<=mesh->nt; ++k) {
@@ -1776,18 +2887,8 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     if ( !MG_EOK(ptt) ) continue;
     ++nelts;
 
-    if(!bin)
-      fprintf(inm,"%" MMG5_PRId " 2 2 %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,ptt->ref,ptt->ref,
-              mesh->point[ptt->v[0]].tmp,mesh->point[ptt->v[1]].tmp,
-              mesh->point[ptt->v[2]].tmp);
-    else {
-      fwrite(&nelts,MMG5_SW,1,inm);
-      fwrite(&ptt->ref,MMG5_SW,1,inm);
-      fwrite(&ptt->ref,MMG5_SW,1,inm);
-      fwrite(&mesh->point[ptt->v[0]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[ptt->v[1]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[ptt->v[2]].tmp,MMG5_SW,1,inm);
-    }
+    for ( i=0; i<3; ++i )  idx[i] = mesh->point[ptt->v[i]].tmp;
+    MMG5_outMshElt(&ob,bin,nelts,2,ptt->ref,idx,3);
   }
 
   /* Quads */
@@ -1795,7 +2896,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     header[0] = 3;// Quad keyword
     header[1] = nq;
     header[2] = 2; // 2 tags per quad
-    fwrite(header, MMG5_SW, 3, inm);
+    MMG5_outBin(&ob,header,3*MMG5_SW);
   }
 
   for (k=1; k<=mesh->nquad; ++k) {
@@ -1803,19 +2904,8 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     if ( !MG_EOK(pq) ) continue;
     ++nelts;
 
-    if(!bin)
-      fprintf(inm,"%" MMG5_PRId " 3 2 %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pq->ref,pq->ref,
-              mesh->point[pq->v[0]].tmp,mesh->point[pq->v[1]].tmp,
-              mesh->point[pq->v[2]].tmp,mesh->point[pq->v[3]].tmp);
-    else {
-      fwrite(&nelts,MMG5_SW,1,inm);
-      fwrite(&pq->ref,MMG5_SW,1,inm);
-      fwrite(&pq->ref,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pq->v[0]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pq->v[1]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pq->v[2]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pq->v[3]].tmp,MMG5_SW,1,inm);
-    }
+    for ( i=0; i<4; ++i )  idx[i] = mesh->point[pq->v[i]].tmp;
+    MMG5_outMshElt(&ob,bin,nelts,3,pq->ref,idx,4);
   }
 
   /* Tetra */
@@ -1823,7 +2913,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     header[0] = 4;// Tetra keyword
     header[1] = ne;
     header[2] = 2; // 2 tags per quad
-    fwrite(header, MMG5_SW, 3, inm);
+    MMG5_outBin(&ob,header,3*MMG5_SW);
   }
 
   for (k=1; k<=mesh->ne; ++k) {
@@ -1831,19 +2921,8 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     if ( !MG_EOK(pt) ) continue;
     ++nelts;
 
-    if(!bin)
-      fprintf(inm,"%" MMG5_PRId " 4 2 %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pt->ref,pt->ref,
-              mesh->point[pt->v[0]].tmp,mesh->point[pt->v[1]].tmp,
-              mesh->point[pt->v[2]].tmp,mesh->point[pt->v[3]].tmp);
-    else {
-      fwrite(&nelts,MMG5_SW,1,inm);
-      fwrite(&pt->ref,MMG5_SW,1,inm);
-      fwrite(&pt->ref,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pt->v[0]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pt->v[1]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pt->v[2]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pt->v[3]].tmp,MMG5_SW,1,inm);
-    }
+    for ( i=0; i<4; ++i )  idx[i] = mesh->point[pt->v[i]].tmp;
+    MMG5_outMshElt(&ob,bin,nelts,4,pt->ref,idx,4);
   }
 
   /* Prisms */
@@ -1851,7 +2930,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     header[0] = 6;// Prism keyword
     header[1] = npr;
     header[2] = 2; // 2 tags per prism
-    fwrite(header, MMG5_SW, 3, inm);
+    MMG5_outBin(&ob,header,3*MMG5_SW);
   }
 
   for (k=1; k<=mesh->nprism; ++k) {
@@ -1859,23 +2938,10 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     if ( !MG_EOK(pp) ) continue;
     ++nelts;
 
-    if(!bin)
-      fprintf(inm,"%" MMG5_PRId " 6 2 %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pp->ref,pp->ref,
-              mesh->point[pp->v[0]].tmp,mesh->point[pp->v[1]].tmp,
-              mesh->point[pp->v[2]].tmp,mesh->point[pp->v[3]].tmp,
-              mesh->point[pp->v[4]].tmp,mesh->point[pp->v[5]].tmp);
-    else {
-      fwrite(&nelts,MMG5_SW,1,inm);
-      fwrite(&pp->ref,MMG5_SW,1,inm);
-      fwrite(&pp->ref,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pp->v[0]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pp->v[1]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pp->v[2]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pp->v[3]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pp->v[4]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pp->v[5]].tmp,MMG5_SW,1,inm);
-    }
+    for ( i=0; i<6; ++i )  idx[i] = mesh->point[pp->v[i]].tmp;
+    MMG5_outMshElt(&ob,bin,nelts,6,pp->ref,idx,6);
   }
+  MMG5_outFlush(&ob);
   if ( bin )  fprintf(inm,"\n");
   fprintf(inm,"$EndElements\n");
 
@@ -1985,14 +3051,16 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
           dbuf[i] = psl->m[iadr+i];
 
         if ( !bin ) {
-          fprintf(inm,"%" MMG5_PRId "",ppt->tmp);
-          for ( i=0; i<typ; ++i )
-            fprintf(inm," %lg",dbuf[i]);
-          fprintf(inm,"\n");
+          MMG5_outInt(&ob,ppt->tmp);
+          for ( i=0; i<typ; ++i ) {
+            MMG5_outChar(&ob,' ');
+            MMG5_outRealPrec(&ob,dbuf[i],6);
+          }
+          MMG5_outChar(&ob,'\n');
         }
         else {
-          fwrite(&ppt->tmp,MMG5_SW,1,inm);
-          fwrite(&dbuf,MMG5_SD,typ,inm);
+          MMG5_outBin(&ob,&ppt->tmp,MMG5_SW);
+          MMG5_outBin(&ob,dbuf,typ*MMG5_SD);
         }
       }
     }
@@ -2012,43 +3080,56 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
         }
 
         if(!bin) {
-          fprintf(inm,"%" MMG5_PRId "",ppt->tmp);
+          MMG5_outInt(&ob,ppt->tmp);
           if ( psl->dim==2 ) {
             iadr = k*psl->size;
-            fprintf(inm," %.15lg %.15lg %.15lg %.15lg %.15lg %.15lg"
-                    " %.15lg %.15lg %.15lg \n",
-                    psl->m[iadr],psl->m[iadr+1],0.,psl->m[iadr+1],psl->m[iadr+2],0.,0.,0.,1.);
+            ten[0] = psl->m[iadr];   ten[1] = psl->m[iadr+1]; ten[2] = 0.;
+            ten[3] = psl->m[iadr+1]; ten[4] = psl->m[iadr+2]; ten[5] = 0.;
+            ten[6] = 0.;             ten[7] = 0.;             ten[8] = 1.;
           }
           else {
-            fprintf(inm," %.15lg %.15lg %.15lg %.15lg %.15lg %.15lg"
-                    " %.15lg %.15lg %.15lg \n", dbuf[0],dbuf[1],dbuf[2],
-                    dbuf[1],dbuf[3],dbuf[4],dbuf[2],dbuf[4],dbuf[5]);
+            ten[0] = dbuf[0]; ten[1] = dbuf[1]; ten[2] = dbuf[2];
+            ten[3] = dbuf[1]; ten[4] = dbuf[3]; ten[5] = dbuf[4];
+            ten[6] = dbuf[2]; ten[7] = dbuf[4]; ten[8] = dbuf[5];
+          }
+          for ( i=0; i<9; ++i ) {
+            MMG5_outChar(&ob,' ');
+            MMG5_outReal(&ob,ten[i]);
           }
+          MMG5_outStr(&ob," \n");
         }
         else {
-          fwrite(&ppt->tmp,MMG5_SW,1,inm);
+          MMG5_outBin(&ob,&ppt->tmp,MMG5_SW);
           if ( psl->dim==2 ) {
             iadr = k*psl->size;
-            fwrite(&psl->m[iadr],MMG5_SD,2,inm);
+            MMG5_outBin(&ob,&psl->m[iadr],2*MMG5_SD);
             dbuf[0] = dbuf[1] = dbuf[2] = 0.;
             dbuf[3] = 1.;
-            fwrite(&dbuf,MMG5_SD,1,inm);
-            fwrite(&psl->m[iadr+1],MMG5_SD,2,inm);
-            fwrite(&dbuf,MMG5_SD,4,inm);
+            MMG5_outBin(&ob,dbuf,MMG5_SD);
+            MMG5_outBin(&ob,&psl->m[iadr+1],2*MMG5_SD);
+            MMG5_outBin(&ob,dbuf,4*MMG5_SD);
           }
           else {
-            fwrite(&dbuf[0],MMG5_SD,3,inm);
-            fwrite(&dbuf[1],MMG5_SD,1,inm);
-            fwrite(&dbuf[3],MMG5_SD,2,inm);
-            fwrite(&dbuf[2],MMG5_SD,1,inm);
-            fwrite(&dbuf[4],MMG5_SD,2,inm);
+            MMG5_outBin(&ob,&dbuf[0],3*MMG5_SD);
+            MMG5_outBin(&ob,&dbuf[1],MMG5_SD);
+            MMG5_outBin(&ob,&dbuf[3],2*MMG5_SD);
+            MMG5_outBin(&ob,&dbuf[2],MMG5_SD);
+            MMG5_outBin(&ob,&dbuf[4],2*MMG5_SD);
           }
         }
       }
     }
+    MMG5_outFlush(&ob);
     if ( bin ) fprintf(inm,"\n");
     fprintf(inm,"$EndNodeData\n");
   }
+
+  if ( !MMG5_outFree(&ob) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write the mesh file.\n",
+            __func__);
+    fclose(inm);
+    return 0;
+  }
   fclose(inm);
 
   return 1;
@@ -2088,8 +3169,8 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
   MMG5_SAFE_CALLOC(data,strlen(filename)+6,char,return -1);
   strcpy(data,filename);
 
-  /* Get last dot character to avoid issues with <basename>.mesh.mesh files */
-  char *dot = strrchr(data,'.');
+  /* Get last extension to avoid issues with <basename>.mesh.mesh files */
+  char *dot = MMG5_Get_filenameExt(data);
 
   ptr = NULL;
   if ( dot) {
@@ -2102,12 +3183,12 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
   if ( !ptr ) {
     /* data contains the filename without extension */
     strcat(data,".solb");
-    if (!(*inm = fopen(data,"rb"))  ) {
+    if (!(*inm = MMG5_fopen(data,"rb"))  ) {
       /* our file is not a .solb file, try with .sol ext */
       ptr  = strstr(data,".solb");
       *ptr = '\0';
       strcat(data,".sol");
-      if (!(*inm = fopen(data,"rb"))  ) {
+      if (!(*inm = MMG5_fopen(data,"rb"))  ) {
         if ( imprim >= 0 )
           fprintf(stderr,"  ** %s  NOT FOUND. USE DEFAULT METRIC.\n",data);
         MMG5_SAFE_FREE(data);
@@ -2121,7 +3202,7 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
     ptr = strstr(data,".solb");
     if ( ptr )  *bin = 1;
 
-    if (!(*inm = fopen(data,"rb")) ) {
+    if (!(*inm = MMG5_fopen(data,"rb")) ) {
       if ( imprim >= 0 )
         fprintf(stderr,"  ** %s  NOT FOUND. USE DEFAULT METRIC.\n",data);
       MMG5_SAFE_FREE(data);
@@ -2210,16 +3291,16 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
 /**
  * \param sol pointer to an allocatable sol structure.
  * \param inm pointer to the solution file
- * \param bin 1 if binary file
  * \param iswp Endianess
  * \param index of the readed solution
  *
  * \return 1 if success, -1 if fail
  *
- * Read the solution value for vertex of index pos in floating precision.
+ * Read the solution value for vertex of index pos in floating precision from a
+ * binary file (ASCII files are read by \ref MMG5_txtSols).
  *
  */
-int MMG5_readFloatSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
+int MMG5_readFloatSol3D(MMG5_pSol sol,FILE *inm,int iswp,int pos) {
   float       fbuf[6],tmpf;
   int         i;
 
@@ -2227,25 +3308,16 @@ int MMG5_readFloatSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
   case 1: case 3:
     /* scalar or vector solution */
     for (i=0; i<sol->size; i++) {
-      if(!bin){
-        MMG_FSCANF(inm,"%f",&fbuf[0]);
-      } else {
-        MMG_FREAD(&fbuf[0],MMG5_SW,1,inm);
-        if(iswp) fbuf[0]=MMG5_swapf(fbuf[0]);
-      }
+      MMG_FREAD(&fbuf[0],MMG5_SW,1,inm);
+      if(iswp) fbuf[0]=MMG5_swapf(fbuf[0]);
       sol->m[sol->size*pos+i] = fbuf[0];
     }
     break;
   case 6 :
     /* Tensor solution */
-    if(!bin){
-      for(i=0 ; i<sol->size ; i++)
-        MMG_FSCANF(inm,"%f",&fbuf[i]);
-    } else {
-      for(i=0 ; i<sol->size ; i++) {
-        MMG_FREAD(&fbuf[i],MMG5_SW,1,inm);
-        if(iswp) fbuf[i]=MMG5_swapf(fbuf[i]);
-      }
+    for(i=0 ; i<sol->size ; i++) {
+      MMG_FREAD(&fbuf[i],MMG5_SW,1,inm);
+      if(iswp) fbuf[i]=MMG5_swapf(fbuf[i]);
     }
     tmpf    = fbuf[2];
     fbuf[2] = fbuf[3];
@@ -2259,16 +3331,16 @@ int MMG5_readFloatSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
 /**
  * \param sol pointer to an allocatable sol structure.
  * \param inm pointer to the solution file
- * \param bin 1 if binary file
  * \param iswp Endianess
  * \param index of the readed solution
  *
  * \return 1 if success, -1 if fail
  *
- * Read the solution value for vertex of index pos in double precision.
+ * Read the solution value for vertex of index pos in double precision from a
+ * binary file (ASCII files are read by \ref MMG5_txtSols).
  *
  */
-int MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
+int MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int iswp,MMG5_int pos) {
   double      dbuf[6],tmpd;
   int         i;
 
@@ -2276,26 +3348,17 @@ int MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos)
   case 1: case 3:
     /* scalar or vector solution */
     for (i=0; i<sol->size; i++) {
-      if(!bin){
-        MMG_FSCANF(inm,"%lf",&dbuf[i]);
-      } else {
-        MMG_FREAD(&dbuf[i],MMG5_SD,1,inm);
-        if(iswp) dbuf[i]=MMG5_swapd(dbuf[i]);
-      }
+      MMG_FREAD(&dbuf[i],MMG5_SD,1,inm);
+      if(iswp) dbuf[i]=MMG5_swapd(dbuf[i]);
       sol->m[sol->size*pos+i] = dbuf[i];
     }
     break;
 
   case 6 :
     /* tensor solution */
-    if(!bin){
-      for(i=0 ; i<sol->size ; i++)
-        MMG_FSCANF(inm,"%lf",&dbuf[i]);
-    } else {
-      for(i=0 ; i<sol->size ; i++) {
-        MMG_FREAD(&dbuf[i],MMG5_SD,1,inm);
-        if(iswp) dbuf[i]=MMG5_swapd(dbuf[i]);
-      }
+    for(i=0 ; i<sol->size ; i++) {
+      MMG_FREAD(&dbuf[i],MMG5_SD,1,inm);
+      if(iswp) dbuf[i]=MMG5_swapd(dbuf[i]);
     }
     tmpd    = dbuf[2];
     dbuf[2] = dbuf[3];
@@ -2309,7 +3372,7 @@ int MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos)
 /**
  * \param mesh pointer to the mesh structure
  * \param sol pointer to an allocatable sol structure.
- * \param inm pointer to the solution file
+ * \param ob pointer to the output buffer of the solution file
  * \param bin 1 if binary file
  * \param pos of the writted solution
  * \param metricData 1 if the data saved is a metric (if only 1 data)
@@ -2317,23 +3380,21 @@ int MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos)
  * Write the solution value for vertex of index pos in double precision.
  *
  */
-void MMG5_writeDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,FILE *inm,int bin,
-                           MMG5_int pos,int metricData) {
+void MMG5_writeDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pOutBuf ob,
+                           int bin,MMG5_int pos,int metricData) {
   double      dbuf[6],tmp;
   int         i;
 
   switch ( sol->size ) {
   case 1: case 3:
-    /* scalar or vector solution */
-    for (i=0; i<sol->size; i++) {
-      for (i=0; i<sol->size; i++) dbuf[i] = sol->m[sol->size*pos+i];
-      if(!bin){
-        for (i=0; i<sol->size; i++)
-          fprintf(inm," %.15lg",dbuf[i]);
-      } else {
-        for(i=0; i<sol->size; i++)
-          fwrite((unsigned char*)&dbuf[i],MMG5_SD,1,inm);
+    /* scalar or vector solution: written from the solution array */
+    if(!bin){
+      for (i=0; i<sol->size; i++) {
+        MMG5_outChar(ob,' ');
+        MMG5_outReal(ob,sol->m[sol->size*pos+i]);
       }
+    } else {
+      MMG5_outBin(ob,&sol->m[sol->size*pos],sol->size*MMG5_SD);
     }
     break;
 
@@ -2356,11 +3417,12 @@ void MMG5_writeDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,FILE *inm,int bin,
     dbuf[3] = tmp;
 
     if(!bin) {
-      for(i=0; i<sol->size; i++)
-        fprintf(inm," %.15lg",dbuf[i]);
+      for(i=0; i<sol->size; i++) {
+        MMG5_outChar(ob,' ');
+        MMG5_outReal(ob,dbuf[i]);
+      }
     } else {
-      for(i=0; i<sol->size; i++)
-        fwrite((unsigned char*)&dbuf[i],MMG5_SD,1,inm);
+      MMG5_outBin(ob,dbuf,sol->size*MMG5_SD);
     }
     break;
   }
@@ -2405,7 +3467,7 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
 
     if ( ptr )  *bin = 1;
 
-    if( !(*inm = fopen(data,"wb")) ) {
+    if( !(*inm = MMG5_fopen(data,"wb")) ) {
       fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
       MMG5_SAFE_FREE(data);
       return 0;
@@ -2417,12 +3479,16 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
     ptr = strstr(data,".mesh");
     if ( ptr ) *ptr = '\0';
 
-    strcat(data,".sol");
-    if (!(*inm = fopen(data,"wb")) ) {
+    // a compressed mesh gives a compressed solution
+    if ( ptr && !strcmp(filename+strlen(filename)-3,".gz") )
+      strcat(data,".sol.gz");
+    else
+      strcat(data,".sol");
+    if (!(*inm = MMG5_fopen(data,"wb")) ) {
       ptr  = strstr(data,".solb");
       *ptr = '\0';
       strcat(data,".sol");
-      if (!(*inm = fopen(data,"wb")) ) {
+      if (!(*inm = MMG5_fopen(data,"wb")) ) {
         fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
         MMG5_SAFE_FREE(data);
         return 0;
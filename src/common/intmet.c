@@ -51,7 +51,7 @@ int MMG5_mmgIntmet33_ani(double *m,double *n,double *mr,double s) {
   int     order;
   double  lambda[3],vp[3][3],mu[3],is[6],isnis[6],mt[9],P[9],dd;
   int8_t  i;
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 
   /* Compute inverse of square root of matrix M : is =
    * P*diag(1/sqrt(lambda))*{^t}P */
@@ -511,7 +511,7 @@ int MMG5_interpreg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt,int8_t i,
   int            nstep,l;
   MMG5_int       ip1,ip2;
   int8_t         i1,i2;
-  static int     warn=0,warnnorm=0;
+  static MMG5_THREADLOCAL int     warn=0,warnnorm=0;
 
   /* Number of steps for parallel transport */
   nstep = 4;
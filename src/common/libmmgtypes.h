@@ -561,6 +561,16 @@ typedef struct {
 
   MMG5_pMat     mat;
   MMG5_InvMat   invmat;
+
+  /* Fields appended at the end of the structure so that the offsets of the
+   * previous ones are unchanged */
+  double        tbudget; /*!< wall-clock budget of the remeshing in seconds (0 for no limit) */
+  double        conv; /*!< fraction of modified elements under which the remeshing waves stop (0 to disable) */
+  double        tini; /*!< wall-clock time at the beginning of the remeshing (internal) */
+  int           nthreads; /*!< number of threads used by parallel mesh sweeps */
+  int8_t        batchins; /*!< process the elements along a space-filling curve in the insertion waves */
+  int8_t        tout; /*!< 1 if the time budget has been exhausted (internal) */
+  int8_t        update; /*!< 1 during a warm-start remeshing (internal) */
 } MMG5_Info;
 
 /**
@@ -588,29 +598,69 @@ typedef struct {
 /**
  * \struct MMG5_hedge
  * \brief Used to hash edges (memory economy compared to \ref MMG5_hgeom).
+ *
+ * \warning API change in the 5.9 release: the \a nxt field (next item of the
+ * chain) has been removed since the items are stored by open addressing in
+ * \ref MMG5_Hash.
  */
 typedef struct {
-  MMG5_int   a,b,nxt;
+  MMG5_int   a,b; /*!< extremities of the edge (a=0 for an empty slot) */
   MMG5_int   k; /*!< k = point along edge a b or triangle index */
   MMG5_int   s;
 } MMG5_hedge;
 
 /**
  * \struct MMG5_Hash
- * \brief Identic as \ref MMG5_HGeom but use \ref MMG5_hedge to store edges
- * instead of \ref MMG5_hgeom (memory economy).
+ * \brief Open addressing hash table (with linear probing) of edges or faces
+ * stored in \ref MMG5_hedge (memory economy compared to \ref MMG5_HGeom).
+ *
+ * \warning API change in the 5.9 release: the table is no longer chained.
+ * \a siz is the number of slots of \a item (indexed from 0) instead of the
+ * size of its first part, \a max is the number of items above which the table
+ * is enlarged instead of the size of \a item, and the \a nxt field (first free
+ * chain slot) has been replaced by \a nitem (number of stored items). The
+ * tables have to be filled and read with the hash functions of the library.
  */
 typedef struct {
-  MMG5_int     siz,max,nxt;
+  MMG5_int     siz; /*!< number of slots (power of 2) */
+  MMG5_int     max; /*!< number of items above which the table is enlarged */
+  MMG5_int     nitem; /*!< number of stored items */
   MMG5_hedge   *item;
 } MMG5_Hash;
 
+/**
+ * \struct MMG5_DelWork
+ * \brief Workspace of the Delaunay insertion kernel. It is allocated at the
+ * first insertion and grows only when a ball larger than the previous ones is
+ * created, so the insertion of a vertex does not allocate memory.
+ *
+ * \warning Internal use only.
+ */
+typedef struct {
+  MMG5_Hash  hash;   /*!< hash table of the internal faces of the new ball (\a siz is the number of slots in use) */
+  MMG5_int   hcap;   /*!< number of allocated slots of the hash table */
+  MMG5_int   *ielnum; /*!< indices of the new elements */
+  MMG5_int   ielmax; /*!< size of the \a ielnum array */
+  size_t     nins;   /*!< number of insertions using the workspace */
+  size_t     nalloc; /*!< number of allocations of the workspace */
+} MMG5_DelWork;
+
+/* Operators table of a mesh (internal, see mmgcommon_private.h) */
+struct MMG5_Ops_s;
+
 /**
  * \struct MMG5_Mesh
  * \brief MMG mesh structure.
+ *
+ * \warning Since the 5.9 release, new fields have been appended at the end of
+ * the \ref MMG5_Info structure: the size of \a info grows, which changes the
+ * offsets of the fields of the mesh that follow it (\a namein, \a nameout). A
+ * code that accesses these fields has to be recompiled with the new headers.
+ * The internal fields are appended at the end of the structure.
+ *
  * \todo try to remove nc1;
  */
-typedef struct {
+typedef struct MMG5_Mesh_s {
   size_t    memMax; /*!< Maximum memory available */
   size_t    memCur; /*!< Current memory used */
   double    gap; /*!< Gap for table reallocation */
@@ -660,6 +710,12 @@ typedef struct {
   char           *namein; /*!< Input mesh name */
   char           *nameout; /*!< Output mesh name */
 
+  /* Internal fields, appended at the end of the structure */
+  MMG5_int       markmin; /*!< Elements with a smaller mark are frozen
+                            (restricted remeshing) */
+  struct MMG5_Ops_s *ops; /*!< table of operators (internal use only) */
+  MMG5_DelWork   delw; /*!< \ref MMG5_DelWork workspace of the Delaunay insertion */
+
 } MMG5_Mesh;
 typedef MMG5_Mesh  * MMG5_pMesh;
 
@@ -668,7 +724,7 @@ typedef MMG5_Mesh  * MMG5_pMesh;
  * \brief MMG Solution structure (for solution or metric).
  *
  */
-typedef struct {
+typedef struct MMG5_Sol_s {
   int       ver; /* Version of the solution file */
   int       dim; /* Dimension of the solution file*/
   MMG5_int  np; /* Number of points of the solution */
@@ -34,10 +34,10 @@
 #include "mmgcommon_private.h"
 #include "mmgexterns_private.h"
 
-#ifdef USE_SCOTCH
-
 #include "librnbg_private.h"
 
+#ifdef USE_SCOTCH
+
 /**
  * \param graf pointer to the input graph structure.
  * \param vertNbr the number of vertices.
@@ -140,6 +140,7 @@ int MMG5_kPartBoxCompute(SCOTCH_Graph *graf, MMG5_int vertNbr, MMG5_int boxVertN
 
   return 0;
 }
+#endif
 
 /**
  * \param mesh pointer to the mesh
@@ -213,7 +214,6 @@ void MMG5_swapNod(MMG5_pMesh mesh,MMG5_pPoint points, double* sols,
   perm[ind2] = perm[ind1];
   perm[ind1] = tmp;
 }
-#endif
 
 /**
  * \param mesh pointer to the mesh structure.
@@ -225,19 +225,21 @@ void MMG5_swapNod(MMG5_pMesh mesh,MMG5_pPoint points, double* sols,
  * (renumerotation success of renumerotation fail but the mesh is still
  *  conformal).
  *
- * Call scotch renumbering.
+ * Call scotch renumbering (or the renumbering function of the operators table
+ * of the mesh if mmg is built without scotch).
  *
  **/
 int MMG5_scotchCall(MMG5_pMesh mesh, MMG5_pSol met,
                     MMG5_pSol fields, MMG5_int *permNodGlob)
 {
-
-#ifdef USE_SCOTCH
-  static int8_t mmgWarn  = 0;
-  static int8_t mmgError = 0;
+  static MMG5_THREADLOCAL int8_t mmgError = 0;
 
   /*check enough vertex to renum*/
-  if ( mesh->info.renum && (mesh->np/2. > MMG5_BOXSIZE) ) {
+  if ( mesh->info.renum && mesh->ops->renumbering
+       && (mesh->np/2. > MMG5_BOXSIZE) ) {
+
+#ifdef USE_SCOTCH
+    static MMG5_THREADLOCAL int8_t mmgWarn  = 0;
 
     if ( (SCOTCH_5 && SCOTCH_6 && SCOTCH_7 ) || ( (!SCOTCH_5) && (!SCOTCH_6) && (!SCOTCH_7) ) ) {
       if ( !mmgWarn ) {
@@ -247,6 +249,7 @@ int MMG5_scotchCall(MMG5_pMesh mesh, MMG5_pSol met,
       }
       return 1;
     }
+#endif
 
     /* renumbering begin */
     if ( mesh->info.imprim > 5 )
@@ -273,7 +276,4 @@ int MMG5_scotchCall(MMG5_pMesh mesh, MMG5_pSol met,
     /* renumbering end */
   }
   return 1;
-#else
-  return 1;
-#endif
 }
@@ -28,11 +28,13 @@
  * \copyright GNU Lesser General Public License.
  */
 
-#ifdef USE_SCOTCH
-
 #ifndef __RENUM__
 #define __RENUM__
 
+void   MMG5_swapNod(MMG5_pMesh,MMG5_pPoint, double*, MMG5_pSol,MMG5_int*, MMG5_int, MMG5_int, int);
+
+#ifdef USE_SCOTCH
+
 #include <scotch.h>
 
 #define HASHPRIME 37
@@ -51,7 +53,6 @@
 
 int    _SCOTCHintSort2asc1(SCOTCH_Num * sortPartTb, MMG5_int vertNbr);
 int    MMG5_kPartBoxCompute(SCOTCH_Graph*, MMG5_int, MMG5_int, SCOTCH_Num*,MMG5_pMesh);
-void   MMG5_swapNod(MMG5_pMesh,MMG5_pPoint, double*, MMG5_pSol,MMG5_int*, MMG5_int, MMG5_int, int);
 
-#endif /* __RENUM__ */
 #endif
+#endif /* __RENUM__ */
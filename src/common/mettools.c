@@ -814,7 +814,7 @@ int MMG5_buildridmetnor(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np0,double nt[3],
 int MMG5_intersecmet22(MMG5_pMesh mesh, double *m,double *n,double *mr) {
   double        det,imn[4],lambda[2],vp[2][2],dm[2],dn[2],d0,d1,ip[4];
   double        isqhmin,isqhmax;
-  static int8_t mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0;
   int           order;
 
   isqhmin  = 1.0 / (mesh->info.hmin*mesh->info.hmin);
@@ -1145,7 +1145,7 @@ int MMG5_mmgIntextmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np,double me[6],
   double              *m,*n1,*n2,*t,r[3][3],mrot[6],mr[3],mtan[3],metan[3];
   int                 order;
   int8_t              i;
-  static int8_t       mmgWarn=0, mmgWarn1=0, mmgWarn2=0;
+  static MMG5_THREADLOCAL int8_t       mmgWarn=0, mmgWarn1=0, mmgWarn2=0;
 
   isqhmin = 1.0 / (mesh->info.hmin*mesh->info.hmin);
   isqhmax = 1.0 / (mesh->info.hmax*mesh->info.hmax);
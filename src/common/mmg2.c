@@ -625,7 +625,7 @@ int MMG5_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int start, int8_t istar
   double           v1, v2;
   MMG5_int         refstart,*adja,k,ip1,ip2,end1;
   int8_t           i,i1,smsgn;
-  static int8_t    mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t    mmgWarn=0;
 
   k = start;
   refstart = mesh->tria[k].ref;
@@ -1426,7 +1426,7 @@ int MMG5_chkmanimesh(MMG5_pMesh mesh) {
   MMG5_int        *adja,k;
   MMG5_int        cnt,iel;
   int8_t          i,i1;
-  static int8_t   mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t   mmgWarn = 0;
 
   /** First check: check whether one triangle in the mesh has 3 boundary faces */
   for (k=1; k<=mesh->nt; k++) {
@@ -44,6 +44,15 @@
 #include <windows.h>
 #endif
 
+#ifdef USE_OPENMP
+#include <omp.h>
+#define MMG5_THREAD_NUM()  omp_get_thread_num()
+#define MMG5_NUM_THREADS() omp_get_num_threads()
+#else
+#define MMG5_THREAD_NUM()  0
+#define MMG5_NUM_THREADS() 1
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -72,6 +81,27 @@ extern "C" {
 /** size of box for renumbering with scotch. */
 #define MMG5_BOXSIZE 500
 
+/** minimal number of entities processed by each thread of a parallel sweep */
+#define MMG5_THREADS_MINWORK 2048
+
+/** Storage class of the flags used to print a warning only once: they are
+ * private to each thread so concurrent remeshings don't race on them */
+#if defined(_MSC_VER)
+#define MMG5_THREADLOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define MMG5_THREADLOCAL __thread
+#else
+#define MMG5_THREADLOCAL
+#endif
+
+/** Range \a kmin..kmax of the chunk \a c among \a nc chunks of entities 1..n.
+ * Chunks are contiguous and ordered so that merging the results of the chunks
+ * in increasing order reproduces the sequential traversal. */
+#define MMG5_CHUNK_RANGE(n,c,nc,kmin,kmax) do {                         \
+    (kmin) = 1 + (MMG5_int)(((int64_t)(n)*(c))/(nc));                  \
+    (kmax) = (MMG5_int)(((int64_t)(n)*((c)+1))/(nc));                  \
+  }while(0)
+
 /** Maximal memory used if available memory compitation fail. */
 #define MMG5_MEMMAX  800        /**< Default mem if unable to compute memMax */
 #define MMG5_BITWIZE_MB_TO_B 20 /**< Bitwise convertion from Mo to O */
@@ -183,6 +213,7 @@ extern "C" {
 
 #define MMG5_KA 7 /*!< Key for hash tables. */
 #define MMG5_KB 11  /*!< Key for hash tables. */
+#define MMG5_HASHLOAD 0.7 /*!< Maximal load factor of the \ref MMG5_Hash tables. */
 
 /* file reading */
 #define MMG5_SW 4
@@ -448,6 +479,19 @@ size_t myfree(void *ptr) {
     }                                                   \
   } while(0);
 
+/**
+ * check the return value of a read through a \ref MMG5_TxtBuf tokenizer
+ * (\a call), free the tokenizer and return -1 if the value can't be read.
+ */
+#define MMG5_TXT_READ(tb,call) do                                        \
+  {                                                                     \
+    if ( !(call) ) {                                                    \
+      fprintf (stderr, "Reading error: unexpected token or end of file\n"); \
+      MMG5_txtFree(tb);                                                 \
+      return -1;                                                        \
+    }                                                                   \
+  } while(0)
+
 /** macro to help to count the number of variadic arguments */
 #define CV_VA_NUM_ARGS_HELPER(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, N, ...)    N
 
@@ -520,20 +564,6 @@ void MMG5_excfun(int sigid) {
   exit(EXIT_FAILURE);
 }
 
-/**
- * \param fproto function prototype
- *
- * Expand automatically prototype of function pointer in .h/.c files depending
- * on the definition of the MMG_EXTERN and MMG_ASSIGN_NULL preprocessor
- * variables:
- *   - MMG_EXTERN is setted to "extern" in the .h file and empty in the .c one;
- *   - MMG_ASSIGN_NULL is empty in .h file and setted to =NULL in .c one.
- */
-#define FUNCTION_POINTER(fproto)\
-  MMG_EXTERN fproto MMG_ASSIGN_NULL
-
-
-
 /* Macro for fortran function generation */
 /**
  * \def FORTRAN_NAME(nu,nl,pl,pc)
@@ -608,7 +638,7 @@ void MMG5_excfun(int sigid) {
  * \endverbatim
  *
  */
-typedef struct {
+typedef struct MMG5_Bezier_s {
   double       b[10][3];/*!< Bezier basis functions */
   double       n[6][3]; /*!< Normals at points */
   double       t[6][3]; /*!< Tangents at points */
@@ -616,6 +646,61 @@ typedef struct {
 } MMG5_Bezier;
 typedef MMG5_Bezier * MMG5_pBezier;
 
+struct MMG3D_PROctree;
+
+/**
+ * \struct MMG5_Ops
+ * \brief Table of the operators that depend on the library in use (mmg2d,
+ * mmgs or mmg3d) and on the metric type (iso or aniso).
+ *
+ * The common operators are filled by the MMG*_Init_mesh functions, the metric
+ * dependent ones by the MMG*_setfunc functions and the level-set ones at the
+ * beginning of the level-set discretization. Storing them in the mesh instead
+ * of in global function pointers allows to remesh several meshes concurrently.
+ * The table is allocated with the mesh by the MMG*_Init_mesh functions.
+ */
+typedef struct MMG5_Ops_s {
+  /* Operators shared by all the libraries */
+  int      (*chkmsh)(struct MMG5_Mesh_s*,int,MMG5_int);
+  int      (*bezierCP)(struct MMG5_Mesh_s*,MMG5_Tria*,struct MMG5_Bezier_s*,int8_t);
+  double   (*lenSurfEdg)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_int,MMG5_int,int8_t);
+  MMG5_int (*indElt)(struct MMG5_Mesh_s*,MMG5_int);
+  MMG5_int (*indPt)(struct MMG5_Mesh_s*,MMG5_int);
+  MMG5_int (*grad2met_ani)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_pTria,MMG5_int,MMG5_int);
+  int      (*grad2metreq_ani)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_pTria,MMG5_int,MMG5_int);
+  int      (*compute_meanMetricAtMarkedPoints)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  int      (*solTruncature_ani)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  int      (*renumbering)(int,struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG5_Sol_s*,MMG5_int*);
+  int      (*doSol)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  int      (*defsiz)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  int      (*gradsiz)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  int      (*gradsizreq)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  int      (*intmet)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_int,int8_t,MMG5_int,double);
+  double   (*caltri)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_pTria);
+  int      (*resetRef)(struct MMG5_Mesh_s*);
+  int      (*setref)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  int      (*snpval)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*);
+  /* mmg2d operators */
+  double   (*lencurv)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_int,MMG5_int);
+  /* mmgs operators */
+  int      (*movintpt_s)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_int*,int);
+  int      (*movridpt_s)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_int*,int);
+  /* mmg3d operators */
+  double   (*caltet)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_pTetra);
+  double   (*lenedg)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,int,MMG5_pTetra);
+  double   (*lenedgspl)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,int,MMG5_pTetra);
+  int      (*interp4bar)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_int,MMG5_int,double*);
+  int      (*movintpt)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG3D_PROctree*,int64_t*,int,int);
+  int      (*movintpt_par)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,int64_t*,int,int);
+  int      (*movbdyregpt)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG3D_PROctree*,int64_t*,int,MMG5_int*,int,int,int);
+  int      (*movbdyrefpt)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG3D_PROctree*,int64_t*,int,MMG5_int*,int,int);
+  int      (*movbdynompt)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG3D_PROctree*,int64_t*,int,MMG5_int*,int,int);
+  int      (*movbdyridpt)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG3D_PROctree*,int64_t*,int,MMG5_int*,int,int);
+  int      (*cavity)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,MMG5_int,int,int64_t*,int,double);
+  int      (*PROctreein)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG3D_PROctree*,MMG5_int,double);
+  int      (*cuttet)(struct MMG5_Mesh_s*,struct MMG5_Sol_s*,struct MMG5_Sol_s*);
+} MMG5_Ops;
+
 /**
  * \struct MMG5_iNode
  * \brief Cell for linked list of integer value.
@@ -625,6 +710,90 @@ typedef struct MMG5_iNode_s {
   struct MMG5_iNode_s *nxt;
 } MMG5_iNode;
 
+/** Number of keyword codes located by the mapped reader of binary Medit files */
+#define MMG5_NKWD  64
+
+/**
+ * \struct MMG5_MeshbMap
+ * \brief Binary Medit file mapped in memory (see \ref MMG5_mapMeshb).
+ *
+ * The keyword table is read once: for each keyword code, \a pos is the offset
+ * of the first entity of the first section with this code and \a num the
+ * number of entities of the section. The entities are then decoded from the
+ * mapping without any copy (see \ref MMG5_mapInt and \ref MMG5_mapReal).
+ */
+typedef struct {
+  const char *buf; /*!< mapped file (NULL if the file is not mapped) */
+  size_t     size; /*!< size of the file in bytes */
+  int        iswp; /*!< 1 if the bytes have to be swapped */
+  int        ver;  /*!< file version (1: float reals, 2: double reals) */
+  int        dim;  /*!< mesh dimension (0 if not given) */
+  long       pos[MMG5_NKWD]; /*!< offset of the entities of each keyword (0 if missing) */
+  MMG5_int   num[MMG5_NKWD]; /*!< number of entities of each keyword */
+} MMG5_MeshbMap;
+typedef MMG5_MeshbMap * MMG5_pMeshbMap;
+
+/** Size of the read buffer of the ASCII tokenizer */
+#define MMG5_TXTBUF_LGTH  1048576
+
+/**
+ * \struct MMG5_TxtBuf
+ * \brief Buffered tokenizer for ASCII input files (see \ref MMG5_txtInit).
+ *
+ * The file is read by large blocks and the integers and reals are parsed from
+ * the buffer without any call to fscanf. The positions returned by
+ * \ref MMG5_txtTell are offsets in the file, so sections located during a
+ * first scan can be reached back with \ref MMG5_txtSeek (inside the buffer if
+ * possible).
+ */
+typedef struct {
+  MMG5_pMesh mesh; /*!< mesh whose memory counter accounts for the buffer */
+  FILE   *inm; /*!< file being read */
+  char   *buf; /*!< read buffer (NULL if the tokenizer is not initialized) */
+  size_t len;  /*!< number of bytes stored in the buffer */
+  size_t cur;  /*!< current position in the buffer */
+  long   off;  /*!< offset in the file of the first byte of the buffer */
+  int    eof;  /*!< 1 if the end of the file has been read */
+  int    strict; /*!< 1 if a number must end at a blank character (blocks
+                  * parsed in parallel by \ref MMG5_txtRecords) */
+} MMG5_TxtBuf;
+typedef MMG5_TxtBuf * MMG5_pTxtBuf;
+
+/** Size of the part of an ASCII file parsed by each thread in a round of
+ * \ref MMG5_txtRecords */
+#define MMG5_TXTPAR_LGTH  4194304
+
+/**
+ * Reader of the record \a k (numbered from 0) of an ASCII section, called by
+ * \ref MMG5_txtRecords. It has to read a fixed number of tokens from \a tb
+ * and to store them in \a data without any other side effect, and it returns
+ * 1 if success, 0 if fail.
+ */
+typedef int (*MMG5_txtRecord)(MMG5_pTxtBuf tb,MMG5_int k,void *data);
+
+/** Size of the write buffer of the output layer */
+#define MMG5_OUTBUF_LGTH  1048576
+
+/** Maximal length of an integer or a real formatted by the output layer */
+#define MMG5_OUTTOK_LGTH  32
+
+/**
+ * \struct MMG5_OutBuf
+ * \brief Buffered writer for output files (see \ref MMG5_outInit).
+ *
+ * Integers and reals are formatted by hand in a large buffer that is written
+ * to the file by blocks, and binary values are copied in the buffer without
+ * any call to fprintf or fwrite per value. The buffer has to be flushed
+ * (\ref MMG5_outFlush) before writing directly into the file.
+ */
+typedef struct {
+  FILE   *out; /*!< file being written */
+  char   *buf; /*!< write buffer */
+  size_t len;  /*!< number of bytes stored in the buffer */
+  int    err;  /*!< 1 if a write has failed */
+} MMG5_OutBuf;
+typedef MMG5_OutBuf * MMG5_pOutBuf;
+
 /* Functions declarations */
  void          MMG5_version(MMG5_pMesh,char*);
  extern void MMG5_nsort(int8_t ,double *,int8_t *);
@@ -680,6 +849,7 @@ typedef struct MMG5_iNode_s {
  int           MMG5_hashEdgeTag(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int a,MMG5_int b,uint16_t k);
  MMG5_int      MMG5_hashGet(MMG5_Hash *hash,MMG5_int a,MMG5_int b);
  int           MMG5_hashNew(MMG5_pMesh mesh, MMG5_Hash *hash,MMG5_int hsiz,MMG5_int hmax);
+ int           MMG5_hashGrow(MMG5_pMesh mesh, MMG5_Hash *hash);
  int           MMG5_intmetsavedir(MMG5_pMesh mesh, double *m,double *n,double *mr);
  int           MMG5_intridmet(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int,double,double*,double*);
  int           MMG5_mmgIntmet33_ani(double*,double*,double*,double);
@@ -749,15 +919,15 @@ int             MMG5_saveDisp(MMG5_pMesh ,MMG5_pSol );
 int             MMG5_loadSolHeader(const char*,int,FILE**,int*,int*,int*,MMG5_int*,
                                    int*,int*,int**,long*,int);
 int             MMG5_chkMetricType(MMG5_pMesh mesh,int *type,int*, FILE *inm);
-int             MMG5_readFloatSol3D(MMG5_pSol,FILE*,int,int,int);
-int             MMG5_readDoubleSol3D(MMG5_pSol,FILE*,int,int,MMG5_int);
+int             MMG5_readFloatSol3D(MMG5_pSol,FILE*,int,int);
+int             MMG5_readDoubleSol3D(MMG5_pSol,FILE*,int,MMG5_int);
 int             MMG5_saveSolHeader( MMG5_pMesh,const char*,FILE**,int,int*,MMG5_int*,MMG5_int,
                                     int,int,int*,int*,int*);
 int             MMG5_saveSolAtTrianglesHeader( MMG5_pMesh,FILE *,int,int,MMG5_int*,int,
                                                int,int*,int*,int*);
 int             MMG5_saveSolAtTetrahedraHeader( MMG5_pMesh,FILE *,int,int,MMG5_int*,int,
                                                 int,int*,int*,int*);
-void            MMG5_writeDoubleSol3D(MMG5_pMesh,MMG5_pSol,FILE*,int,MMG5_int,int);
+void            MMG5_writeDoubleSol3D(MMG5_pMesh,MMG5_pSol,MMG5_pOutBuf,int,MMG5_int,int);
 void            MMG5_printMetStats(MMG5_pMesh mesh,MMG5_pSol met);
 void            MMG5_printSolStats(MMG5_pMesh mesh,MMG5_pSol *sol);
 
@@ -783,6 +953,30 @@ int    MMG5_swapbin(int sbin);
 MMG5_int    MMG5_swapbin_int(MMG5_int sbin);
 float  MMG5_swapf(float sbin);
 double MMG5_swapd(double sbin);
+FILE  *MMG5_fopen(const char *name,const char *mode);
+int    MMG5_mapMeshb(FILE *inm,MMG5_pMeshbMap mb);
+void   MMG5_unmapMeshb(MMG5_pMeshbMap mb);
+int    MMG5_txtInit(MMG5_pMesh mesh,FILE *inm,MMG5_pTxtBuf tb);
+void   MMG5_txtFree(MMG5_pTxtBuf tb);
+long   MMG5_txtTell(MMG5_pTxtBuf tb);
+int    MMG5_txtSeek(MMG5_pTxtBuf tb,long pos);
+int    MMG5_txtWord(MMG5_pTxtBuf tb,char *s,int lg);
+int    MMG5_txtKeyword(MMG5_pTxtBuf tb,char *s,int lg);
+int    MMG5_txtSkipLine(MMG5_pTxtBuf tb);
+int    MMG5_txtInt(MMG5_pTxtBuf tb,MMG5_int *val);
+int    MMG5_txtInt32(MMG5_pTxtBuf tb,int *val);
+int    MMG5_txtDouble(MMG5_pTxtBuf tb,double *val);
+int    MMG5_txtFloat(MMG5_pTxtBuf tb,float *val);
+int    MMG5_txtRecords(MMG5_pMesh mesh,MMG5_pTxtBuf tb,MMG5_int nrec,int ntok,
+                       MMG5_txtRecord fn,void *data);
+int    MMG5_txtPoint(MMG5_pTxtBuf tb,MMG5_int k,void *data);
+int    MMG5_txtTria(MMG5_pTxtBuf tb,MMG5_int k,void *data);
+int    MMG5_txtSols(MMG5_pMesh mesh,MMG5_pTxtBuf tb,MMG5_pSol sol,int nsols,
+                    MMG5_int np);
+int    MMG5_outInit(FILE *out,MMG5_pOutBuf ob);
+int    MMG5_outFlush(MMG5_pOutBuf ob);
+int    MMG5_outFree(MMG5_pOutBuf ob);
+char  *MMG5_outFormat(char *s,double x,int prec);
 int MMG5_MultiMat_init(MMG5_pMesh);
 int MMG5_isLevelSet(MMG5_pMesh,MMG5_int,MMG5_int);
 int MMG5_isSplit(MMG5_pMesh ,MMG5_int ,MMG5_int *,MMG5_int *);
@@ -827,9 +1021,252 @@ int MMG5_test_intersecmet33(MMG5_pMesh mesh);
 void MMG5_mark_verticesAsUnused ( MMG5_pMesh mesh );
 void MMG5_mark_usedVertices ( MMG5_pMesh mesh,void (*delPt)(MMG5_pMesh,MMG5_int) );
 void MMG5_keep_subdomainElts ( MMG5_pMesh,int,int (*delElt)(MMG5_pMesh,MMG5_int) );
+int  MMG5_nthreads ( MMG5_pMesh mesh,MMG5_int nwork );
+void MMG5_startTimeBudget ( MMG5_pMesh mesh );
+int  MMG5_outOfTime ( MMG5_pMesh mesh );
+int  MMG5_converged ( MMG5_pMesh mesh,MMG5_int nmod,MMG5_int nelt );
 
 void   MMG5_Set_commonFunc(void);
 
+/**
+ * \param hash pointer to the hash table.
+ * \param a smallest extremity of the edge.
+ * \param b largest extremity of the edge.
+ * \return the first slot to probe for the edge \f$[a;b]\f$.
+ *
+ * The key is linear in the edge extremities so that the edges of close
+ * vertices lie in close slots (a renumbered mesh is then hashed with few cache
+ * misses).
+ *
+ */
+static inline
+MMG5_int MMG5_hashKey(MMG5_Hash *hash,MMG5_int a,MMG5_int b) {
+  return (MMG5_int)((MMG5_KA*(uint64_t)a + MMG5_KB*(uint64_t)b)
+                    & (uint64_t)(hash->siz-1));
+}
+
+/**
+ * \param hash pointer to the hash table.
+ * \param a smallest extremity of the edge.
+ * \param b largest extremity of the edge.
+ * \return the slot storing the edge \f$[a;b]\f$ or the empty slot in which it
+ * must be inserted.
+ *
+ */
+static inline
+MMG5_hedge *MMG5_hashProbe(MMG5_Hash *hash,MMG5_int a,MMG5_int b) {
+  MMG5_hedge *ph;
+  MMG5_int   key;
+
+  key = MMG5_hashKey(hash,a,b);
+  ph  = &hash->item[key];
+  while ( ph->a && (ph->a != a || ph->b != b) ) {
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
+  }
+  return ph;
+}
+
+/**
+ * \param hash pointer to the hash table.
+ * \param a smallest vertex of the face.
+ * \param b largest vertex of the face.
+ * \param s sum of the vertices of the face.
+ * \return the slot storing the face or the empty slot in which it must be
+ * inserted.
+ *
+ */
+static inline
+MMG5_hedge *MMG5_hashProbeFace(MMG5_Hash *hash,MMG5_int a,MMG5_int b,MMG5_int s) {
+  MMG5_hedge *ph;
+  MMG5_int   key;
+
+  key = MMG5_hashKey(hash,a,b);
+  ph  = &hash->item[key];
+  while ( ph->a && (ph->a != a || ph->b != b || ph->s != s) ) {
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
+  }
+  return ph;
+}
+
+/**
+ * \param mb pointer to the mapped file.
+ * \param cur pointer to the current position in the file (moved after the
+ * value).
+ * \return the integer stored at position \a cur.
+ *
+ * Decode an integer from a mapped binary Medit file.
+ *
+ */
+static inline
+MMG5_int MMG5_mapInt(MMG5_pMeshbMap mb,const char **cur) {
+  int i;
+
+  memcpy(&i,*cur,MMG5_SW);
+  *cur += MMG5_SW;
+
+  return mb->iswp ? MMG5_swapbin(i) : i;
+}
+
+/**
+ * \param mb pointer to the mapped file.
+ * \param cur pointer to the current position in the file (moved after the
+ * value).
+ * \return the real stored at position \a cur.
+ *
+ * Decode a real (simple precision for a file of version 1, double precision
+ * otherwise) from a mapped binary Medit file.
+ *
+ */
+static inline
+double MMG5_mapReal(MMG5_pMeshbMap mb,const char **cur) {
+  double d;
+  float  f;
+
+  if ( mb->ver < 2 ) {
+    memcpy(&f,*cur,MMG5_SW);
+    *cur += MMG5_SW;
+    return mb->iswp ? (double)MMG5_swapf(f) : (double)f;
+  }
+  memcpy(&d,*cur,MMG5_SD);
+  *cur += MMG5_SD;
+
+  return mb->iswp ? MMG5_swapd(d) : d;
+}
+
+/**
+ * \param mb pointer to the mapped file.
+ * \param pos offset of the first entity of a section.
+ * \param n number of entities of the section.
+ * \param nint number of integers per entity.
+ * \param nreal number of reals per entity.
+ * \return 1 if the section fits in the file (or is empty), 0 otherwise.
+ *
+ * Check that a section of a mapped binary Medit file can be decoded.
+ *
+ */
+static inline
+int MMG5_mapFits(MMG5_pMeshbMap mb,long pos,MMG5_int n,int nint,int nreal) {
+  size_t siz;
+
+  if ( !n ) return 1;
+
+  siz = nint*MMG5_SW + nreal*(mb->ver < 2 ? MMG5_SW : MMG5_SD);
+  return ( pos > 0 && n >= 0 && (size_t)pos <= mb->size &&
+           (size_t)n <= (mb->size - (size_t)pos) / siz );
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \param ptr pointer to the bytes to write.
+ * \param n number of bytes to write.
+ *
+ * Copy \a n bytes (binary values or a string) in an output buffer. A block
+ * larger than the buffer is written directly into the file.
+ *
+ */
+static inline
+void MMG5_outBin(MMG5_pOutBuf ob,const void *ptr,size_t n) {
+
+  if ( ob->len + n > MMG5_OUTBUF_LGTH ) {
+    MMG5_outFlush(ob);
+    if ( n > MMG5_OUTBUF_LGTH ) {
+      if ( fwrite(ptr,1,n,ob->out) != n )  ob->err = 1;
+      return;
+    }
+  }
+  memcpy(ob->buf+ob->len,ptr,n);
+  ob->len += n;
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \param str string to write.
+ *
+ * Write a string in an output buffer.
+ *
+ */
+static inline
+void MMG5_outStr(MMG5_pOutBuf ob,const char *str) {
+  MMG5_outBin(ob,str,strlen(str));
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \param c character to write.
+ *
+ * Write a character in an output buffer.
+ *
+ */
+static inline
+void MMG5_outChar(MMG5_pOutBuf ob,char c) {
+
+  if ( ob->len >= MMG5_OUTBUF_LGTH )  MMG5_outFlush(ob);
+  ob->buf[ob->len++] = c;
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \param i integer to write.
+ *
+ * Write an integer in an output buffer (same output than the "%" MMG5_PRId
+ * format of printf).
+ *
+ */
+static inline
+void MMG5_outInt(MMG5_pOutBuf ob,MMG5_int i) {
+  char     dig[MMG5_OUTTOK_LGTH],*s;
+  uint64_t u;
+  int      n;
+
+  if ( ob->len + MMG5_OUTTOK_LGTH > MMG5_OUTBUF_LGTH )  MMG5_outFlush(ob);
+
+  s = ob->buf + ob->len;
+  u = (uint64_t)i;
+  if ( i < 0 ) {
+    *s++ = '-';
+    u = 0 - u;
+  }
+  n = 0;
+  do {
+    dig[n++] = (char)('0' + u%10);
+    u /= 10;
+  } while ( u );
+  while ( n )  *s++ = dig[--n];
+
+  ob->len = s - ob->buf;
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \param x real to write.
+ * \param prec number of significant digits (at most 15).
+ *
+ * Write a real in an output buffer (same output than the "%.<prec>lg" format
+ * of printf).
+ *
+ */
+static inline
+void MMG5_outRealPrec(MMG5_pOutBuf ob,double x,int prec) {
+
+  if ( ob->len + MMG5_OUTTOK_LGTH > MMG5_OUTBUF_LGTH )  MMG5_outFlush(ob);
+  ob->len = MMG5_outFormat(ob->buf+ob->len,x,prec) - ob->buf;
+}
+
+/**
+ * \param ob pointer to the output buffer.
+ * \param x real to write.
+ *
+ * Write a real in an output buffer (same output than the "%.15lg" format of
+ * printf).
+ *
+ */
+static inline
+void MMG5_outReal(MMG5_pOutBuf ob,double x) {
+  MMG5_outRealPrec(ob,x,15);
+}
+
 #ifdef __cplusplus
 }
 #endif
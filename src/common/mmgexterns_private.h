@@ -26,29 +26,23 @@
 
 #include "mmgcommon_private.h"
 
-#ifndef MMG_EXTERN
-#define MMG_EXTERN extern
-#define MMG_ASSIGN_NULL
-#endif
-
-FUNCTION_POINTER ( int  (*MMG5_chkmsh)(MMG5_pMesh,int,MMG5_int) );
-FUNCTION_POINTER ( int  (*MMG5_bezierCP)(MMG5_pMesh ,MMG5_Tria *,MMG5_pBezier ,int8_t ) );
-FUNCTION_POINTER ( double (*MMG5_lenSurfEdg)(MMG5_pMesh mesh,MMG5_pSol sol ,MMG5_int ,MMG5_int, int8_t ) );
-FUNCTION_POINTER ( MMG5_int  (*MMG5_indElt)(MMG5_pMesh mesh,MMG5_int kel) );
-FUNCTION_POINTER ( MMG5_int  (*MMG5_indPt)(MMG5_pMesh mesh,MMG5_int kp) );
-FUNCTION_POINTER ( MMG5_int  (*MMG5_grad2met_ani)(MMG5_pMesh,MMG5_pSol,MMG5_pTria,MMG5_int,MMG5_int) );
-FUNCTION_POINTER ( int (*MMG5_grad2metreq_ani)(MMG5_pMesh,MMG5_pSol,MMG5_pTria,MMG5_int,MMG5_int) );
-FUNCTION_POINTER ( int (*MMG5_compute_meanMetricAtMarkedPoints)( MMG5_pMesh,MMG5_pSol) );
-FUNCTION_POINTER ( int (*MMG5_solTruncature_ani)(MMG5_pMesh mesh, MMG5_pSol met) );
-FUNCTION_POINTER ( int (*MMG5_resetRef)(MMG5_pMesh) );
-FUNCTION_POINTER ( int (*MMG5_setref)(MMG5_pMesh,MMG5_pSol) );
-FUNCTION_POINTER ( int (*MMG5_snpval)(MMG5_pMesh,MMG5_pSol));
-
-#ifdef USE_SCOTCH
-FUNCTION_POINTER ( int  (*MMG5_renumbering)(int,MMG5_pMesh,MMG5_pSol,MMG5_pSol,MMG5_int*) );
-#endif
-
-#undef MMG_EXTERN
-#undef MMG_ASSIGN_NULL
+/**
+ * Operators of the \ref MMG5_Ops table of the mesh that are shared by the
+ * mmg2d, mmgs and mmg3d libraries (filled by the MMG*_Init_mesh and
+ * MMG*_setfunc functions).
+ */
+#define MMG5_chkmsh(mesh,...)                             (mesh)->ops->chkmsh(mesh,__VA_ARGS__)
+#define MMG5_bezierCP(mesh,...)                           (mesh)->ops->bezierCP(mesh,__VA_ARGS__)
+#define MMG5_lenSurfEdg(mesh,...)                         (mesh)->ops->lenSurfEdg(mesh,__VA_ARGS__)
+#define MMG5_indElt(mesh,...)                             (mesh)->ops->indElt(mesh,__VA_ARGS__)
+#define MMG5_indPt(mesh,...)                              (mesh)->ops->indPt(mesh,__VA_ARGS__)
+#define MMG5_grad2met_ani(mesh,...)                       (mesh)->ops->grad2met_ani(mesh,__VA_ARGS__)
+#define MMG5_grad2metreq_ani(mesh,...)                    (mesh)->ops->grad2metreq_ani(mesh,__VA_ARGS__)
+#define MMG5_compute_meanMetricAtMarkedPoints(mesh,...)   (mesh)->ops->compute_meanMetricAtMarkedPoints(mesh,__VA_ARGS__)
+#define MMG5_solTruncature_ani(mesh,...)                  (mesh)->ops->solTruncature_ani(mesh,__VA_ARGS__)
+#define MMG5_resetRef(mesh)                               (mesh)->ops->resetRef(mesh)
+#define MMG5_setref(mesh,...)                             (mesh)->ops->setref(mesh,__VA_ARGS__)
+#define MMG5_snpval(mesh,...)                             (mesh)->ops->snpval(mesh,__VA_ARGS__)
+#define MMG5_renumbering(boxVertNbr,mesh,...)             (mesh)->ops->renumbering(boxVertNbr,mesh,__VA_ARGS__)
 
 #endif
@@ -148,7 +148,7 @@ int MMG5_check_setted_hminhmax(MMG5_pMesh mesh) {
 int MMG5_truncate_met3d(MMG5_pSol met, MMG5_int ip, double isqhmin, double isqhmax) {
   double        v[3][3],lambda[3],*m;
   int           i;
-  static int8_t mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn = 0;
 
   m = &met->m[(MMG5_int)met->size*ip];
 
@@ -206,7 +206,7 @@ int MMG5_truncate_met3d(MMG5_pSol met, MMG5_int ip, double isqhmin, double isqhm
 int MMG5_scale_scalarMetric(MMG5_pMesh mesh, MMG5_pSol met, double dd) {
   MMG5_int      k;
   int           ier;
-  static int8_t mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0;
 
   ++mesh->base;
 
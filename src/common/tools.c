@@ -985,6 +985,58 @@ double MMG2D_quickarea(double a[2],double b[2],double c[2]) {
   return aire;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param nwork number of entities to process.
+ * \return the number of threads to use for a sweep over \a nwork entities.
+ *
+ * Number of threads asked by the user (\a info.nthreads, 0 meaning the OpenMP
+ * default), limited so that each thread has at least \ref MMG5_THREADS_MINWORK
+ * entities to process. Always 1 without OpenMP support.
+ *
+ */
+int MMG5_nthreads ( MMG5_pMesh mesh,MMG5_int nwork ) {
+  int nt;
+
+#ifdef USE_OPENMP
+  nt = mesh->info.nthreads;
+  if ( nt <= 0 ) {
+    nt = omp_get_max_threads();
+  }
+  if ( (MMG5_int)nt > nwork / MMG5_THREADS_MINWORK ) {
+    nt = (int)(nwork / MMG5_THREADS_MINWORK);
+  }
+  nt = MG_MAX(1,nt);
+#else
+  nt = 1;
+#endif
+
+  return nt;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param nmod number of modifications performed by the last wave.
+ * \param nelt number of elements of the mesh.
+ * \return 1 if the last wave modified less than a fraction \a info.conv of the
+ * elements, 0 otherwise (or if no convergence criterion is given).
+ *
+ * The caller stops its remeshing waves when 1 is returned.
+ *
+ */
+int MMG5_converged ( MMG5_pMesh mesh,MMG5_int nmod,MMG5_int nelt ) {
+
+  if ( mesh->info.conv <= 0. )  return 0;
+
+  if ( (double)nmod >= mesh->info.conv * (double)nelt )  return 0;
+
+  if ( abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     waves converged: %8" MMG5_PRId " modifications for %8"
+            MMG5_PRId " elements (-conv %g).\n",nmod,nelt,mesh->info.conv);
+  }
+  return 1;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  *
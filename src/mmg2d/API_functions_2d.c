@@ -271,6 +271,23 @@ int MMG2D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, MMG5_int va
   case MMG2D_IPARAM_anisosize :
     mesh->info.ani = val;
     break;
+  case MMG2D_IPARAM_threads :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of threads must be positive"
+              " (0 to use the OpenMP default).\n",__func__);
+      return 0;
+    }
+#ifdef USE_OPENMP
+    mesh->info.nthreads = val;
+#else
+    if ( val > 1 ) {
+      fprintf(stderr,"\n  ## Warning: %s: multithreading unavailable:"
+              " set the USE_OPENMP CMake's flag to ON when compiling the mmg2d"
+              " library to enable this feature.\n",__func__);
+    }
+    mesh->info.nthreads = 1;
+#endif
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
@@ -369,6 +386,22 @@ int MMG2D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val)
       mesh->info.rmc      = val;
     }
     break;
+  case MMG2D_DPARAM_timeBudget :
+    if ( val < 0.0 ) {
+      fprintf(stderr,"\n  ## Error: %s: time budget must be positive"
+              " (0 for no limit).\n",__func__);
+      return 0;
+    }
+    mesh->info.tbudget  = val;
+    break;
+  case MMG2D_DPARAM_convergence :
+    if ( val < 0.0 || val >= 1.0 ) {
+      fprintf(stderr,"\n  ## Error: %s: convergence threshold must be comprised"
+              " between 0 and 1.\n",__func__);
+      return 0;
+    }
+    mesh->info.conv     = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",
             __func__);
@@ -24,6 +24,41 @@
 #include "libmmg2d.h"
 #include "libmmg2d_private.h"
 
+/**
+ * \param tb pointer to the tokenizer.
+ * \param k index of the record (from 0).
+ * \param data pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the coordinates and the reference of the vertex \a k+1 from the
+ * Vertices section of a mesh (reader of \ref MMG5_txtRecords). The third
+ * coordinate of the vertices of a mesh saved in 3D is skipped.
+ *
+ */
+static
+int MMG2D_txtPoint(MMG5_pTxtBuf tb,MMG5_int k,void *data) {
+  MMG5_pMesh  mesh = (MMG5_pMesh)data;
+  MMG5_pPoint ppt;
+  double      dtmp;
+  float       fc;
+  int         i;
+
+  ppt = &mesh->point[k+1];
+  if ( mesh->ver < 2 ) {
+    for ( i=0; i<2; i++ ) {
+      if ( !MMG5_txtFloat(tb,&fc) ) return 0;
+      ppt->c[i] = (double)fc;
+    }
+    if ( mesh->info.renum >= 2 && !MMG5_txtFloat(tb,&fc) ) return 0;
+  }
+  else {
+    if ( !(MMG5_txtDouble(tb,&ppt->c[0]) && MMG5_txtDouble(tb,&ppt->c[1])) )
+      return 0;
+    if ( mesh->info.renum >= 2 && !MMG5_txtDouble(tb,&dtmp) ) return 0;
+  }
+  return MMG5_txtInt(tb,&ppt->ref);
+}
+
 /* read mesh data */
 int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   FILE        *inm;
@@ -31,15 +66,18 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   MMG5_pEdge   ped;
   MMG5_pTria   pt;
   MMG5_pQuad   pq1;
+  MMG5_MeshbMap mb;
+  MMG5_TxtBuf  tb;
+  const char   *cur;
   float        fc;
   long         posnp,posnt,posncor,posned,posnq,posreq,posreqed,posntreq,posnqreq;
   MMG5_int     k,tmp,ncor,norient,nreq,ntreq,nreqed,nqreq,nref;
   int          bin,iswp;
-  double       air,dtmp;
+  double       air;
   int          bdim,binch,bpos;
   MMG5_int     ref,i;
   char         *ptr,*data;
-  char         chaine[MMG5_FILESTR_LGTH],strskip[MMG5_FILESTR_LGTH];
+  char         chaine[MMG5_FILESTR_LGTH];
 
   posnp = posnt = posncor = posned = posnq = posreq = posreqed = posntreq = posnqreq = 0;
   ncor = nreq = nreqed = ntreq = nqreq = 0;
@@ -48,17 +86,20 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   bpos = 0;
   mesh->np = mesh->nt = mesh->na = mesh->xp = 0;
   nref = 0;
+  mb.buf = NULL;
+  tb.buf = NULL;
+  cur = NULL;
 
   MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,return -1);
   strcpy(data,filename);
   ptr = strstr(data,".mesh");
   if ( !ptr ) {
     strcat(data,".meshb");
-    if (!(inm = fopen(data,"rb")) ) {
+    if (!(inm = MMG5_fopen(data,"rb")) ) {
       ptr  = strstr(data,".mesh");
       *ptr = '\0';
       strcat(data,".mesh");
-      if (!(inm = fopen(data,"rb")) ) {
+      if (!(inm = MMG5_fopen(data,"rb")) ) {
         MMG5_SAFE_FREE(data);
         return 0;
       }
@@ -70,7 +111,7 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
 
     if ( ptr )  bin = 1;
 
-    if( !(inm = fopen(data,"rb")) ) {
+    if( !(inm = MMG5_fopen(data,"rb")) ) {
       MMG5_SAFE_FREE(data);
       return 0;
     }
@@ -81,83 +122,121 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   MMG5_SAFE_FREE(data);
 
   if (!bin) {
+    if ( !MMG5_txtInit(mesh,inm,&tb) ) return -1;
     strcpy(chaine,"D");
-    while(fscanf(inm,"%127s",&chaine[0])!=EOF && strncmp(chaine,"End",strlen("End")) ) {
+    while(MMG5_txtKeyword(&tb,chaine,MMG5_FILESTR_LGTH) && strncmp(chaine,"End",strlen("End")) ) {
       if ( chaine[0] == '#' ) {
-        while(1){           // skip until end of line or file
-          char *s = fgets(strskip,MMG5_FILESTR_LGTH,inm);
-          if(!s) break;     // nothing could be read
-          if(s[strlen(s)-1]=='\n') break;   // end of line
-        }
+        // skip until end of line or file
+        MMG5_txtSkipLine(&tb);
         continue;
       }
 
       if(!strncmp(chaine,"MeshVersionFormatted",strlen("MeshVersionFormatted"))) {
-        MMG_FSCANF(inm,"%d",&mesh->ver);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&mesh->ver));
         continue;
       }
       else if(!strncmp(chaine,"Dimension",strlen("Dimension"))) {
-        MMG_FSCANF(inm,"%d",&mesh->dim);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&mesh->dim));
         if ( mesh->info.renum >= 2) {
           if(mesh->dim!=3) {
             fprintf(stdout,"WRONG USE OF 3dMedit option \n");
+            MMG5_txtFree(&tb);
             return -1;
           }
           mesh->dim = 2;
         }
         if(mesh->dim!=2) {
           fprintf(stdout,"BAD DIMENSION : %d\n",mesh->dim);
+          MMG5_txtFree(&tb);
           return -1;
         }
         continue;
       }
       else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->np);
-        posnp = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->np));
+        posnp = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nt);
-        posnt = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nt));
+        posnt = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nquad);
-        posnq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nquad));
+        posnq = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"RequiredQuadrilaterals",strlen("RequiredQuadrilaterals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nqreq);
-        posnqreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nqreq));
+        posnqreq = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ncor);
-        posncor = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ncor));
+        posncor = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nreq);
-        posreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nreq));
+        posreq = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->na);
-        posned = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->na));
+        posned = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nreqed);
-        posreqed = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nreqed));
+        posreqed = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"RequiredTriangles",strlen("RequiredTriangles"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ntreq);
-        posntreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ntreq));
+        posntreq = MMG5_txtTell(&tb);
         continue;
       }
     }
   }
+  else if ( MMG5_mapMeshb(inm,&mb) ) {
+    /* binary file mapped in memory: sections are located from the keyword
+     * table */
+    iswp      = mb.iswp;
+    mesh->ver = mb.ver;
+    if ( mb.dim ) {
+      mesh->dim = mb.dim;
+      if(mesh->dim!=2) {
+        fprintf(stdout,"BAD MESH DIMENSION : %d\n",mesh->dim);
+        MMG5_unmapMeshb(&mb);
+        return -1;
+      }
+    }
+    if ( mesh->ver < 2 && mesh->info.renum >= 2 ) {
+      fprintf(stderr,"  ## Warning: %s: binary not available with"
+              " -msh option.\n",__func__);
+      MMG5_unmapMeshb(&mb);
+      return -1;
+    }
+    mesh->np    = mb.num[4];  posnp    = mb.pos[4];  //Vertices
+    mesh->nt    = mb.num[6];  posnt    = mb.pos[6];  //Triangles
+    ntreq       = mb.num[17]; posntreq = mb.pos[17]; //RequiredTriangles
+    mesh->nquad = mb.num[7];  posnq    = mb.pos[7];  //Quadrilaterals
+    nqreq       = mb.num[18]; posnqreq = mb.pos[18]; //RequiredQuadrilaterals
+    ncor        = mb.num[13]; posncor  = mb.pos[13]; //Corners
+    mesh->na    = mb.num[5];  posned   = mb.pos[5];  //Edges
+    nreqed      = mb.num[16]; posreqed = mb.pos[16]; //RequiredEdges
+    nreq        = mb.num[15]; posreq   = mb.pos[15]; //RequiredVertices
+
+    if ( !(MMG5_mapFits(&mb,posnp,mesh->np,1,2)    &&
+           MMG5_mapFits(&mb,posnt,mesh->nt,4,0)    &&
+           MMG5_mapFits(&mb,posnq,mesh->nquad,5,0) &&
+           MMG5_mapFits(&mb,posned,mesh->na,3,0)) ) {
+      fputs ( "Reading error", stderr );
+      MMG5_unmapMeshb(&mb);
+      return -1;
+    }
+  }
   else {
     bdim = 0;
     MMG_FREAD(&mesh->ver,MMG5_SW,1,inm);
@@ -279,6 +358,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
 
   if ( !mesh->np  ) {
     fprintf(stdout,"  ** MISSING DATA : no point\n");
+    MMG5_unmapMeshb(&mb);
+    MMG5_txtFree(&tb);
     return -1;
   }
 
@@ -291,29 +372,31 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   }
 
   /* Memory allocation */
-  if ( !MMG2D_zaldy(mesh) )  return -1;
+  if ( !MMG2D_zaldy(mesh) ) {
+    MMG5_unmapMeshb(&mb);
+    MMG5_txtFree(&tb);
+    return -1;
+  }
 
   /* Read vertices */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  if ( tb.buf ) {
+    MMG5_txtSeek(&tb,posnp);
+    MMG5_TXT_READ(&tb,MMG5_txtRecords(mesh,&tb,mesh->np,mesh->info.renum>=2 ? 4 : 3,
+                                      MMG2D_txtPoint,mesh));
+  }
+  if ( mb.buf ) cur = mb.buf + posnp;
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
-        if ( mesh->info.renum >=2 ) {
-          for (i=0 ; i<3 ; i++) {
-            MMG_FSCANF(inm,"%f",&fc);
-            if(i==2) break;
-            ppt->c[i] = (double) fc;
-          }
-        } else {
-          for (i=0 ; i<2 ; i++) {
-            MMG_FSCANF(inm,"%f",&fc);
-            ppt->c[i] = (double) fc;
-          }
-        }
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ppt->ref);
-      } else {
+    if ( mb.buf ) {
+      for (i=0 ; i<2 ; i++) {
+        ppt->c[i] = MMG5_mapReal(&mb,&cur);
+      }
+      ppt->ref = MMG5_mapInt(&mb,&cur);
+    }
+    else if ( bin ) {
+      if (mesh->ver < 2) { /*float*/
         if ( mesh->info.renum >= 2 ) {
           fprintf(stderr,"  ## Warning: %s: binary not available with"
                   " -msh option.\n",__func__);
@@ -324,25 +407,15 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
           if(iswp) fc=MMG5_swapf(fc);
           ppt->c[i] = (double) fc;
         }
-        MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
-        if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
-      }
-    } else {
-      if (!bin) {
-        if ( mesh->info.renum >= 2 ) {
-          MMG_FSCANF(inm,"%lf %lf %lf %" MMG5_PRId "",&ppt->c[0],&ppt->c[1],&dtmp,&ppt->ref);
-        } else {
-          MMG_FSCANF(inm,"%lf %lf %" MMG5_PRId "",&ppt->c[0],&ppt->c[1],&ppt->ref);
-        }
       }
       else {
         for (i=0 ; i<2 ; i++) {
           MMG_FREAD(&ppt->c[i],MMG5_SD,1,inm);
           if(iswp) ppt->c[i]=MMG5_swapd(ppt->c[i]);
         }
-        MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
-        if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
       }
+      MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
+      if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
     }
     if ( ppt->ref < 0 ) {
       ppt->ref = -ppt->ref;
@@ -354,10 +427,18 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   /* Read edges */
   rewind(inm);
   fseek(inm,posned,SEEK_SET);
+  if ( tb.buf ) MMG5_txtSeek(&tb,posned);
+  if ( mb.buf ) cur = mb.buf + posned;
   for (k=1; k<=mesh->na; k++) {
     ped = &mesh->edge[k];
     if (!bin) {
-      MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&ped->a,&ped->b,&ped->ref);
+      MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ped->a) && MMG5_txtInt(&tb,&ped->b) &&
+                        MMG5_txtInt(&tb,&ped->ref));
+    }
+    else if ( mb.buf ) {
+      ped->a   = MMG5_mapInt(&mb,&cur);
+      ped->b   = MMG5_mapInt(&mb,&cur);
+      ped->ref = MMG5_mapInt(&mb,&cur);
     }
     else {
       MMG_FREAD(&ped->a,MMG5_SW,1,inm);
@@ -378,13 +459,21 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   if ( mesh->nt ) {
     rewind(inm);
     fseek(inm,posnt,SEEK_SET);
+    if ( tb.buf ) {
+      MMG5_txtSeek(&tb,posnt);
+      MMG5_TXT_READ(&tb,MMG5_txtRecords(mesh,&tb,mesh->nt,4,MMG5_txtTria,mesh));
+    }
+    if ( mb.buf ) cur = mb.buf + posnt;
     norient = 0;
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
-      if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pt->v[0],&pt->v[1],&pt->v[2],&pt->ref);
+      if ( mb.buf ) {
+        for (i=0 ; i<3 ; i++) {
+          pt->v[i] = MMG5_mapInt(&mb,&cur);
+        }
+        pt->ref = MMG5_mapInt(&mb,&cur);
       }
-      else {
+      else if ( bin ) {
         for (i=0 ; i<3 ; i++) {
           MMG_FREAD(&pt->v[i],MMG5_SW,1,inm);
           if(iswp) pt->v[i]=MMG5_swapbin(pt->v[i]);
@@ -424,9 +513,10 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     if ( ntreq ) {
       rewind(inm);
       fseek(inm,posntreq,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posntreq);
       for (k=1; k<=ntreq; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId "",&i);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&i));
         }
         else {
           MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -455,12 +545,21 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   if ( mesh->nquad ) {
     rewind(inm);
     fseek(inm,posnq,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnq);
+    if ( mb.buf ) cur = mb.buf + posnq;
 
     for (k=1; k<=mesh->nquad; k++) {
       pq1 = &mesh->quadra[k];
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pq1->v[0],&pq1->v[1],&pq1->v[2],
-               &pq1->v[3],&pq1->ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pq1->v[0]) && MMG5_txtInt(&tb,&pq1->v[1]) &&
+                          MMG5_txtInt(&tb,&pq1->v[2]) && MMG5_txtInt(&tb,&pq1->v[3]) &&
+                          MMG5_txtInt(&tb,&pq1->ref));
+      }
+      else if ( mb.buf ) {
+        for (i=0 ; i<4 ; i++) {
+          pq1->v[i] = MMG5_mapInt(&mb,&cur);
+        }
+        pq1->ref = MMG5_mapInt(&mb,&cur);
       }
       else {
         for (i=0 ; i<4 ; i++) {
@@ -484,9 +583,10 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     if(nqreq) {
       rewind(inm);
       fseek(inm,posnqreq,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnqreq);
       for (k=1; k<=nqreq; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId "",&i);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&i));
         }
         else {
           MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -510,9 +610,10 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   if ( ncor ) {
     rewind(inm);
     fseek(inm,posncor,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posncor);
     for (k=1; k<=ncor; k++) {
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ref));
       }
       else {
         MMG_FREAD(&ref,MMG5_SW,1,inm);
@@ -527,9 +628,10 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   if (nreq) {
     rewind(inm);
     fseek(inm,posreq,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posreq);
     for (k=1; k<=nreq; k++) {
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ref));
       }
       else {
         MMG_FREAD(&ref,MMG5_SW,1,inm);
@@ -545,9 +647,10 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   if (nreqed) {
     rewind(inm);
     fseek(inm,posreqed,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posreqed);
     for (k=1; k<=nreqed; k++) {
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ref));
       }
       else {
         MMG_FREAD(&ref,MMG5_SW,1,inm);
@@ -558,6 +661,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     }
   }
 
+  MMG5_unmapMeshb(&mb);
+  MMG5_txtFree(&tb);
   fclose(inm);
 
   if ( nref ) {
@@ -834,30 +939,24 @@ int MMG2D_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
 /**
  * \param sol pointer to an allocatable sol structure.
  * \param inm pointer to the solution file
- * \param bin 1 if binary file
  * \param iswp Endianess
  * \param index of the readed solution
  *
  * \return 1 if success, -1 if fail
  *
- * Read the solution value for vertex of index pos in floating precision.
+ * Read the solution value for vertex of index pos in floating precision from a
+ * binary file (ASCII files are read by \ref MMG5_txtSols).
  *
  */
 static inline
-int MMG2D_readFloatSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
+int MMG2D_readFloatSol(MMG5_pSol sol,FILE *inm,int iswp,MMG5_int pos) {
   float       fbuf;
   int         i;
 
   for (i=0; i<sol->size; i++) {
-    if ( !bin ) {
-      MMG_FSCANF(inm,"%f",&fbuf);
-      sol->m[sol->size*pos+i] = (double)fbuf;
-    }
-    else {
-      MMG_FREAD(&fbuf,MMG5_SW,1,inm);
-      if ( iswp ) fbuf=MMG5_swapf(fbuf);
-      sol->m[sol->size*pos+i] = (double)fbuf;
-    }
+    MMG_FREAD(&fbuf,MMG5_SW,1,inm);
+    if ( iswp ) fbuf=MMG5_swapf(fbuf);
+    sol->m[sol->size*pos+i] = (double)fbuf;
   }
   return 1;
 }
@@ -865,30 +964,24 @@ int MMG2D_readFloatSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
 /**
  * \param sol pointer to an allocatable sol structure.
  * \param inm pointer to the solution file
- * \param bin 1 if binary file
  * \param iswp Endianess
  * \param index of the readed solution
  *
  * \return 1 if success, -1 if fail
  *
- * Read the solution value for vertex of index pos in double precision.
+ * Read the solution value for vertex of index pos in double precision from a
+ * binary file (ASCII files are read by \ref MMG5_txtSols).
  *
  */
 static inline
-int MMG2D_readDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
+int MMG2D_readDoubleSol(MMG5_pSol sol,FILE *inm,int iswp,MMG5_int pos) {
   double       dbuf;
   int          i;
 
   for (i=0; i<sol->size; i++) {
-    if ( !bin ) {
-      MMG_FSCANF(inm,"%lf",&dbuf);
-      sol->m[sol->size*pos+i] = (double)dbuf;
-    }
-    else {
-      MMG_FREAD(&dbuf,MMG5_SD,1,inm);
-      if ( iswp ) dbuf=MMG5_swapf(dbuf);
-      sol->m[sol->size*pos+i] = (double)dbuf;
-    }
+    MMG_FREAD(&dbuf,MMG5_SD,1,inm);
+    if ( iswp ) dbuf=MMG5_swapf(dbuf);
+    sol->m[sol->size*pos+i] = (double)dbuf;
   }
   return 1;
 }
@@ -904,6 +997,7 @@ int MMG2D_readDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
  */
 int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
   FILE       *inm;
+  MMG5_TxtBuf tb;
   long        posnp;
   int         iswp,ier,meshDim,*type,nsols,dim;
   int         ver,bin;
@@ -962,20 +1056,29 @@ int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
   /* Read mesh solutions */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  tb.buf = NULL;
+  if ( !bin && !MMG5_txtInit(mesh,inm,&tb) ) {
+    fclose(inm);
+    return -1;
+  }
 
-  if ( sol->ver == 1 ) {
+  if ( !bin ) {
+    MMG5_TXT_READ(&tb,MMG5_txtSols(mesh,&tb,sol,1,sol->np));
+  }
+  else if ( sol->ver == 1 ) {
     /* Single precision */
     for (k=1; k<=sol->np; k++) {
-      if ( MMG2D_readFloatSol(sol,inm,bin,iswp,k) < 0 ) return -1;
+      if ( MMG2D_readFloatSol(sol,inm,iswp,k) < 0 ) return -1;
     }
   }
   else {
     for (k=1; k<=sol->np; k++) {
       /* Double precision */
-      if ( MMG2D_readDoubleSol(sol,inm,bin,iswp,k) < 0 ) return -1;
+      if ( MMG2D_readDoubleSol(sol,inm,iswp,k) < 0 ) return -1;
     }
   }
 
+  MMG5_txtFree(&tb);
   fclose(inm);
 
   /* stats */
@@ -996,6 +1099,7 @@ int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
 int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol   psl;
   FILE       *inm;
+  MMG5_TxtBuf tb;
   long        posnp;
   int         iswp,ier,meshDim,nsols,*type;
   MMG5_int    k,np;
@@ -1071,13 +1175,21 @@ int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   /* read mesh solutions */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  tb.buf = NULL;
+  if ( !bin && !MMG5_txtInit(mesh,inm,&tb) ) {
+    fclose(inm);
+    return -1;
+  }
 
-  if ( (*sol)[0].ver == 1 ) {
+  if ( !bin ) {
+    MMG5_TXT_READ(&tb,MMG5_txtSols(mesh,&tb,*sol,nsols,mesh->np));
+  }
+  else if ( (*sol)[0].ver == 1 ) {
     /* Single precision */
     for (k=1; k<=mesh->np; k++) {
       for ( j=0; j<nsols; ++j ) {
         psl = *sol+j;
-        if ( MMG2D_readFloatSol(psl,inm,bin,iswp,k) < 0 ) return -1;
+        if ( MMG2D_readFloatSol(psl,inm,iswp,k) < 0 ) return -1;
       }
     }
   }
@@ -1086,10 +1198,11 @@ int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
     for (k=1; k<=mesh->np; k++) {
       for ( j=0; j<nsols; ++j ) {
         psl = *sol+j;
-        if ( MMG2D_readDoubleSol(psl,inm,bin,iswp,k) < 0 ) return -1;
+        if ( MMG2D_readDoubleSol(psl,inm,iswp,k) < 0 ) return -1;
       }
     }
   }
+  MMG5_txtFree(&tb);
   fclose(inm);
 
   /* stats */
@@ -1120,11 +1233,11 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
   ptr = strstr(data,".mesh");
   if ( !ptr ) {
     strcat(data,".meshb");
-    if( !(inm = fopen(data,"wb")) ) {
+    if( !(inm = MMG5_fopen(data,"wb")) ) {
       ptr  = strstr(data,".mesh");
       *ptr = '\0';
       strcat(data,".mesh");
-      if( !(inm = fopen(data,"wb")) ) {
+      if( !(inm = MMG5_fopen(data,"wb")) ) {
         MMG5_SAFE_FREE(data);
         return 0;
       }
@@ -1136,7 +1249,7 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
   else {
     ptr = strstr(data,".meshb");
     if( ptr )  bin = 1;
-    if( !(inm = fopen(data,"wb")) ) {
+    if( !(inm = MMG5_fopen(data,"wb")) ) {
       fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
       MMG5_SAFE_FREE(data);
       return 0;
@@ -45,21 +45,31 @@
     _LIBMMG5_RETURN(mesh,met,sol,val);            \
   }while(0)
 
- /**
- * Set common pointer functions between mmgs and mmg2d to the matching mmg2d
- * functions.
+/**
+ * \param mesh pointer to the mesh structure.
+ *
+ * Set the operators shared between mmgs and mmg2d to the matching mmg2d
+ * functions in the operators table of the mesh.
  */
-void MMG2D_Set_commonFunc(void) {
-    MMG5_chkmsh = MMG5_mmg2dChkmsh;
-    MMG5_grad2met_ani = MMG2D_grad2met_ani;
-    MMG5_grad2metreq_ani = MMG2D_grad2metreq_ani;
-    MMG5_solTruncature_ani = MMG5_2dSolTruncature_ani;
-    MMG5_indPt = MMG2D_indPt;
-    MMG5_indElt = MMG2D_indElt;
+void MMG2D_Set_commonOps(MMG5_pMesh mesh) {
+    mesh->ops->chkmsh            = MMG5_mmg2dChkmsh;
+    mesh->ops->grad2met_ani      = MMG2D_grad2met_ani;
+    mesh->ops->grad2metreq_ani   = MMG2D_grad2metreq_ani;
+    mesh->ops->solTruncature_ani = MMG5_2dSolTruncature_ani;
+    mesh->ops->indPt             = MMG2D_indPt;
+    mesh->ops->indElt            = MMG2D_indElt;
 
     return;
 }
 
+/**
+ * Deprecated: the common functions are now stored in the operators table of
+ * each mesh (see MMG2D_Set_commonOps).
+ */
+void MMG2D_Set_commonFunc(void) {
+  return;
+}
+
 int MMG2D_mmg2dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pSol sol=NULL; // unused
   mytime    ctim[TIMEMAX];
@@ -85,6 +95,7 @@ int MMG2D_mmg2dlib(MMG5_pMesh mesh,MMG5_pSol met) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   /* Check options */
   if ( !mesh->nt ) {
@@ -150,7 +161,7 @@ int MMG2D_mmg2dlib(MMG5_pMesh mesh,MMG5_pSol met) {
 
   /* Set function pointers */
   MMG2D_setfunc(mesh,met);
-  MMG2D_Set_commonFunc();
+  MMG2D_Set_commonOps(mesh);
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug ) {
     fprintf(stdout,"  MAXIMUM NUMBER OF POINTS    (NPMAX) : %8" MMG5_PRId "\n",mesh->npmax);
@@ -176,7 +187,7 @@ int MMG2D_mmg2dlib(MMG5_pMesh mesh,MMG5_pSol met) {
 
   /* Specific meshing */
   if ( mesh->info.optim ) {
-    if ( !MMG2D_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( !MMG5_unscaleMesh(mesh,met,NULL) ) _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
       _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
     }
@@ -326,6 +337,7 @@ int MMG2D_mmg2dmesh(MMG5_pMesh mesh,MMG5_pSol met) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   /* Check options */
   if ( mesh->nt ) {
@@ -387,7 +399,7 @@ int MMG2D_mmg2dmesh(MMG5_pMesh mesh,MMG5_pSol met) {
 
   /* Create function pointers */
   MMG2D_setfunc(mesh,met);
-  MMG2D_Set_commonFunc();
+  MMG2D_Set_commonOps(mesh);
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug ) {
     fprintf(stdout,"  MAXIMUM NUMBER OF POINTS    (NPMAX) : %8" MMG5_PRId "\n",mesh->npmax);
@@ -441,7 +453,7 @@ int MMG2D_mmg2dmesh(MMG5_pMesh mesh,MMG5_pSol met) {
 
   /* specific meshing */
   if ( mesh->info.optim ) {
-    if ( !MMG2D_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( !MMG5_unscaleMesh(mesh,met,NULL) )
         _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
       MMG2D_RETURN_AND_PACK(mesh,met,sol,MMG5_LOWFAILURE);
@@ -561,6 +573,7 @@ int MMG2D_mmg2dls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   /* Check options */
   if ( mesh->info.lag >= 0 ) {
@@ -639,7 +652,7 @@ int MMG2D_mmg2dls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet) {
 
   /* Set pointers */
   MMG2D_setfunc(mesh,met);
-  MMG2D_Set_commonFunc();
+  MMG2D_Set_commonOps(mesh);
 
   if ( mesh->info.imprim > 0 )
     fprintf(stdout,"\n  -- PHASE 1 : ISOSURFACE DISCRETIZATION\n");
@@ -689,7 +702,7 @@ int MMG2D_mmg2dls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet) {
   /* Specific meshing: compute optim option here because after isovalue
    * discretization mesh elements have too bad qualities */
   if ( mesh->info.optim ) {
-    if ( !MMG2D_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( mettofree ) {
         MMG5_DEL_MEM(mesh,met->m);
         MMG5_SAFE_FREE (met);
@@ -844,6 +857,7 @@ int MMG2D_mmg2dmov(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   /* Check data compatibility */
   if ( mesh->info.imprim > 0 ) fprintf(stdout,"\n  -- MMG2DMOV: INPUT DATA\n");
@@ -899,7 +913,7 @@ int MMG2D_mmg2dmov(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
 
   /* Set pointers */
   MMG2D_setfunc(mesh,met);
-  MMG2D_Set_commonFunc();
+  MMG2D_Set_commonOps(mesh);
 
   chrono(ON,&ctim[2]);
 
@@ -143,6 +143,9 @@ extern "C" {
     MMG2D_DPARAM_rmc,               /*!< [-1/val], Remove small disconnected components in level-set mode */
     MMG2D_IPARAM_nofem,             /*!< [1/0], Do not attempt to make the mesh suitable for finite-element computations */
     MMG2D_IPARAM_isoref,            /*!< [0/n], Iso-surface boundary material reference */
+    MMG2D_IPARAM_threads,           /*!< [n], Number of threads used to read the ASCII files (0 for the OpenMP default) */
+    MMG2D_DPARAM_timeBudget,        /*!< [val], Wall-clock budget of the remeshing in seconds (0 for no limit) */
+    MMG2D_DPARAM_convergence,       /*!< [val], Stop the remeshing waves when they modify less than this fraction of the elements (0 to disable) */
   };
 
 /*----------------------------- function headers -----------------------------*/
@@ -2419,6 +2422,9 @@ LIBMMG2D_EXPORT int MMG2D_Free_all(const int starter,...);
  * \param met pointer to the sol structure
  * \return 1 on success
  *
+ * This pointer is not modified by the library: it calls the function matching
+ * the metric type of \a mesh (see \ref MMG2D_setfunc).
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_DOSOL(mesh,met,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT)     :: mesh,met\n
@@ -2727,8 +2733,9 @@ LIBMMG2D_EXPORT int MMG2D_Free_all(const int starter,...);
 
 
 /**
- * \brief Set common function pointers between mmgs and mmg2d to the matching mmg2d
- * functions.
+ * \deprecated The common functions between mmgs and mmg2d are now stored in
+ * the operators table of each mesh and set by \ref MMG2D_Init_mesh. This
+ * function does nothing and is kept for compatibility.
  */
   LIBMMG2D_EXPORT void MMG2D_Set_commonFunc(void);
 
@@ -218,6 +218,7 @@ MMG5_int MMG2D_isInTriangle(MMG5_pMesh ,MMG5_int,double c[2]);
 int MMG2D_cutEdge(MMG5_pMesh ,MMG5_pTria ,MMG5_pPoint ,MMG5_pPoint );
 int MMG2D_cutEdgeTriangle(MMG5_pMesh ,MMG5_int ,MMG5_int ,MMG5_int );
 MMG5_int MMG2D_findTria(MMG5_pMesh ,MMG5_int );
+MMG5_int MMG2D_walkTria(MMG5_pMesh ,MMG5_int ,MMG5_int );
 int MMG2D_locateEdge(MMG5_pMesh ,MMG5_int ,MMG5_int ,MMG5_int* ,MMG5_int* ) ;
 int MMG2D_bdryenforcement(MMG5_pMesh ,MMG5_pSol);
 int MMG2D_settagtriangles(MMG5_pMesh ,MMG5_pSol );
@@ -301,6 +302,7 @@ void MMG2D_keep_only1Subdomain ( MMG5_pMesh mesh,int nsd );
 /* useful functions to debug */
 MMG5_int  MMG2D_indElt(MMG5_pMesh mesh,MMG5_int kel);
 MMG5_int  MMG2D_indPt(MMG5_pMesh mesh,MMG5_int kp);
+void      MMG2D_Set_commonOps(MMG5_pMesh mesh);
 
 /* Management of local parameters */
 int MMG2D_freeLocalPar(MMG5_pMesh );
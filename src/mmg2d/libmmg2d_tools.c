@@ -43,24 +43,24 @@ void MMG2D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
     mesh->info.ani = 1;
 
     /* Set pointers */
-    MMG2D_lencurv    = MMG2D_lencurv_ani;
-    MMG5_compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_ani;
-    MMG2D_defsiz     = MMG2D_defsiz_ani;
-    MMG2D_gradsiz    = lissmet_ani;
-    MMG2D_gradsizreq = MMG5_gradsizreq_ani;
-    MMG2D_caltri     = MMG2D_caltri_ani;
-    MMG2D_intmet     = MMG2D_intmet_ani;
-    MMG2D_doSol      = MMG2D_doSol_ani;
+    mesh->ops->lencurv    = MMG2D_lencurv_ani;
+    mesh->ops->compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_ani;
+    mesh->ops->defsiz     = MMG2D_defsiz_ani;
+    mesh->ops->gradsiz    = lissmet_ani;
+    mesh->ops->gradsizreq = MMG5_gradsizreq_ani;
+    mesh->ops->caltri     = MMG2D_caltri_ani;
+    mesh->ops->intmet     = MMG2D_intmet_ani;
+    mesh->ops->doSol      = MMG2D_doSol_ani;
   }
   else {
-    MMG2D_lencurv    = MMG2D_lencurv_iso;
-    MMG5_compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_iso;
-    MMG2D_defsiz     = MMG2D_defsiz_iso;
-    MMG2D_gradsiz    = MMG5_gradsiz_iso;
-    MMG2D_gradsizreq = MMG5_gradsizreq_iso;
-    MMG2D_caltri     = MMG2D_caltri_iso;
-    MMG2D_intmet     = MMG2D_intmet_iso;
-    MMG2D_doSol      = MMG2D_doSol_iso;
+    mesh->ops->lencurv    = MMG2D_lencurv_iso;
+    mesh->ops->compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_iso;
+    mesh->ops->defsiz     = MMG2D_defsiz_iso;
+    mesh->ops->gradsiz    = MMG5_gradsiz_iso;
+    mesh->ops->gradsizreq = MMG5_gradsizreq_iso;
+    mesh->ops->caltri     = MMG2D_caltri_iso;
+    mesh->ops->intmet     = MMG2D_intmet_iso;
+    mesh->ops->doSol      = MMG2D_doSol_iso;
   }
   return;
 }
@@ -81,6 +81,12 @@ int MMG2D_usage(char *name) {
 
   /* Specific parameters */
   fprintf(stdout,"-3dMedit val read and write for gmsh visu: output only if val=1, input and output if val=2, input if val=3\n");
+#ifdef USE_OPENMP
+  fprintf(stdout,"-nt val      number of threads to read ASCII files (0: OpenMP default)\n");
+#endif
+  fprintf(stdout,"-tbudget val wall-clock budget of the remeshing in seconds\n");
+  fprintf(stdout,"-conv    val stop the remeshing waves when they modify less than\n"
+          "             this fraction of the elements\n");
   fprintf(stdout,"\n");
 
   fprintf(stdout,"-nofem       do not force Mmg to create a finite element mesh \n");
@@ -148,6 +154,20 @@ int MMG2D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol s
         if ( !MMG2D_Set_solSize(mesh,met,MMG5_Vertex,0,MMG5_Tensor) )
           return 0;
         break;
+      case 'c':
+        if ( !strcmp(argv[i],"-conv") ) {
+          if ( ++i < argc ) {
+            val = strtof(argv[i],&endptr);
+          }
+          if ( i >= argc || endptr != &(argv[i][strlen(argv[i])]) ) {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            MMG2D_usage(argv[0]);
+            return 0;
+          }
+          if ( !MMG2D_Set_dparameter(mesh,met,MMG2D_DPARAM_convergence,val) )
+            return 0;
+        }
+        break;
       case 'd':
         if ( !strcmp(argv[i],"-default") ) {
           mesh->mark=1;
@@ -331,7 +351,21 @@ int MMG2D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol s
             MMG2D_usage(argv[0]);
             return 0;
           }
-        } else if ( !strcmp(argv[i],"-noswap") ) {
+        }
+#ifdef USE_OPENMP
+        else if ( !strcmp(argv[i],"-nt") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG2D_Set_iparameter(mesh,met,MMG2D_IPARAM_threads,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            MMG2D_usage(argv[0]);
+            return 0;
+          }
+        }
+#endif
+        else if ( !strcmp(argv[i],"-noswap") ) {
           if ( !MMG2D_Set_iparameter(mesh,met,MMG2D_IPARAM_noswap,1) )
             return 0;
         }
@@ -404,6 +438,20 @@ int MMG2D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol s
           }
         }
         break;
+      case 't':
+        if ( !strcmp(argv[i],"-tbudget") ) {
+          if ( ++i < argc ) {
+            val = strtof(argv[i],&endptr);
+          }
+          if ( i >= argc || endptr != &(argv[i][strlen(argv[i])]) ) {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            MMG2D_usage(argv[0]);
+            return 0;
+          }
+          if ( !MMG2D_Set_dparameter(mesh,met,MMG2D_DPARAM_timeBudget,val) )
+            return 0;
+        }
+        break;
       case 'v':
         if ( ++i < argc ) {
           if ( argv[i][0] == '-' || isdigit(argv[i][0]) ) {
@@ -530,6 +578,16 @@ int MMG2D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol s
 int MMG2D_defaultValues(MMG5_pMesh mesh) {
 
   MMG5_mmgDefaultValues(mesh);
+#ifdef USE_OPENMP
+  fprintf(stdout,"Number of threads (-nt)             : %d\n",
+          mesh->info.nthreads);
+#endif
+  fprintf(stdout,"Time budget (-tbudget)              : ");
+  if ( mesh->info.tbudget > 0. )
+    fprintf(stdout,"%gs\n",mesh->info.tbudget);
+  else
+    fprintf(stdout,"none\n");
+  fprintf(stdout,"Convergence threshold (-conv)       : %g\n",mesh->info.conv);
 
   fprintf(stdout,"\n\n");
 
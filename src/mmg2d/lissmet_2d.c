@@ -110,87 +110,81 @@ int lissmet_ani(MMG5_pMesh mesh,MMG5_pSol sol) {
     nc = 0;
     for (k=0; k<edgeTable.siz; k++) {
       pht = &edgeTable.item[k];
-      /* analyze linked list */
-      while ( pht ) {
-        if ( !pht->a )  break;
-        a  = pht->a;
-        b  = pht->b;
-        p1 = &mesh->point[a];
-        p2 = &mesh->point[b];
-        iadr = a*sol->size;
-        ma   = &sol->m[iadr];
-        iadr = b*sol->size;
-        mb   = &sol->m[iadr];
+      if ( !pht->a )  continue;
+      a  = pht->a;
+      b  = pht->b;
+      p1 = &mesh->point[a];
+      p2 = &mesh->point[b];
+      iadr = a*sol->size;
+      ma   = &sol->m[iadr];
+      iadr = b*sol->size;
+      mb   = &sol->m[iadr];
+
+      if ( (p1->tagdel < mesh->base) && (p2->tagdel < mesh->base) ) {
+        continue;
+      }
 
-        if ( (p1->tagdel < mesh->base) && (p2->tagdel < mesh->base) ) {
-          pht = pht->nxt ? &edgeTable.item[pht->nxt] : 0;
-          continue;
-        }
+      /* compute edge lengths */
+      ux = p2->c[0] - p1->c[0];
+      uy = p2->c[1] - p1->c[1];
+
+      d1 = ma[0]*ux*ux + ma[2]*uy*uy + 2.0*ma[1]*ux*uy;
+      assert(d1 >=0);
+      if ( d1 < 0.0 )  d1 = 0.0;
+      dd1 = M_MAX(MMG2D_EPSD,sqrt(d1));
+
+      d2 = mb[0]*ux*ux + mb[2]*uy*uy+ 2.0*mb[1]*ux*uy;
+      assert(d2 >=0);
+      if ( d2 < 0.0 )  d2 = 0.0;
+      dd2 = M_MAX(MMG2D_EPSD,sqrt(d2));
+
+      /* swap vertices */
+      if ( dd1 > dd2 ) {
+        p1   = &mesh->point[b];
+        p2   = &mesh->point[a];
+        mb   = ma;
+        iadr = b*sol->size;
+        ma   = &sol->m[iadr];
+        dd   = dd1;
+        dd1  = dd2;
+        dd2  = dd;
+      }
+      rap = dd2 / dd1;
+      dh = rap - 1.0;
+      if ( fabs(dh) > MMG2D_EPSD ) {
+        // Edge length in the metric
+        tail = (dd1+dd2+4*sqrt(0.5*(d1+d2))) / 6.0;
+        coef = log(rap) / tail;
+        p1->tagdel = mesh->base+1;
+        p2->tagdel = mesh->base+1;
+
+        /* update sizes */
+        if ( coef > logs ) {
+          coef      = exp(tail*logh);
+          p1->tagdel = mesh->base;
+          p2->tagdel = mesh->base;
+
+          /* metric intersection */
+          coef = 1.0 / (coef*coef);
+          for (i=0; i<3; i++) {
+            ma1[i] = coef * ma[i];
+            mb1[i] = coef * mb[i];
+          }
 
-        /* compute edge lengths */
-        ux = p2->c[0] - p1->c[0];
-        uy = p2->c[1] - p1->c[1];
-
-        d1 = ma[0]*ux*ux + ma[2]*uy*uy + 2.0*ma[1]*ux*uy;
-        assert(d1 >=0);
-        if ( d1 < 0.0 )  d1 = 0.0;
-        dd1 = M_MAX(MMG2D_EPSD,sqrt(d1));
-
-        d2 = mb[0]*ux*ux + mb[2]*uy*uy+ 2.0*mb[1]*ux*uy;
-        assert(d2 >=0);
-        if ( d2 < 0.0 )  d2 = 0.0;
-        dd2 = M_MAX(MMG2D_EPSD,sqrt(d2));
-
-        /* swap vertices */
-        if ( dd1 > dd2 ) {
-          p1   = &mesh->point[b];
-          p2   = &mesh->point[a];
-          mb   = ma;
-          iadr = b*sol->size;
-          ma   = &sol->m[iadr];
-          dd   = dd1;
-          dd1  = dd2;
-          dd2  = dd;
-        }
-        rap = dd2 / dd1;
-        dh = rap - 1.0;
-        if ( fabs(dh) > MMG2D_EPSD ) {
-          // Edge length in the metric
-          tail = (dd1+dd2+4*sqrt(0.5*(d1+d2))) / 6.0;
-          coef = log(rap) / tail;
-          p1->tagdel = mesh->base+1;
-          p2->tagdel = mesh->base+1;
-
-          /* update sizes */
-          if ( coef > logs ) {
-            coef      = exp(tail*logh);
-            p1->tagdel = mesh->base;
-            p2->tagdel = mesh->base;
-
-            /* metric intersection */
-            coef = 1.0 / (coef*coef);
-            for (i=0; i<3; i++) {
-              ma1[i] = coef * ma[i];
-              mb1[i] = coef * mb[i];
-            }
-
-            if ( MMG5_intersecmet22(mesh,ma,mb1,m) ) {
-              for (i=0; i<3; i++)  ma[i] = m[i];
-            }
-            else {
-              for (i=0; i<3; i++)  ma[i]  = SQRT3DIV2 * (ma[i]+mb1[i]);
-            }
-            if ( MMG5_intersecmet22(mesh,ma1,mb,m) ) {
-              for (i=0; i<3; i++)  mb[i] = m[i];
-            }
-            else {
-              for (i=0; i<3; i++)  mb[i] = SQRT3DIV2 * (mb[i]+ma1[i]);
-            }
-            nc++;
+          if ( MMG5_intersecmet22(mesh,ma,mb1,m) ) {
+            for (i=0; i<3; i++)  ma[i] = m[i];
+          }
+          else {
+            for (i=0; i<3; i++)  ma[i]  = SQRT3DIV2 * (ma[i]+mb1[i]);
+          }
+          if ( MMG5_intersecmet22(mesh,ma1,mb,m) ) {
+            for (i=0; i<3; i++)  mb[i] = m[i];
+          }
+          else {
+            for (i=0; i<3; i++)  mb[i] = SQRT3DIV2 * (mb[i]+ma1[i]);
           }
+          nc++;
         }
-        /* next edge */
-        pht = pht->nxt ? &edgeTable.item[pht->nxt] : 0;
       }
     }
     ncor += nc;
@@ -219,6 +219,22 @@ int MMG2D_cutEdgeTriangle(MMG5_pMesh mesh,MMG5_int k,MMG5_int ia,MMG5_int ib) {
  * Return the index of one triangle containing k.
  */
 MMG5_int MMG2D_findTria(MMG5_pMesh mesh,MMG5_int ip) {
+  return MMG2D_walkTria(mesh,ip,1);
+}
+
+/**
+ * \param mesh pointer to mesh
+ * \param ip point index
+ * \param kdep index of the triangle from which we start the walk
+ * \return index of one elt containing k or 0 (if no elt is found)
+ *
+ * Return the index of one triangle containing k by walking through the
+ * adjacencies from \a kdep. The walk length is proportional to the distance
+ * between \a kdep and \a ip, so \a kdep should be a triangle close to \a ip
+ * when available (if \a kdep is not a valid triangle, the walk starts from the
+ * next valid one).
+ */
+MMG5_int MMG2D_walkTria(MMG5_pMesh mesh,MMG5_int ip,MMG5_int kdep) {
   MMG5_pTria    pt,pt1;
   MMG5_int      iel,base,iadr,*adja,iter,ier;
   int           mvDir[3],jel,i;
@@ -228,7 +244,7 @@ MMG5_int MMG2D_findTria(MMG5_pMesh mesh,MMG5_int ip) {
   ++mesh->base;
   base = ++mesh->base;
   iter = 0;
-  iel  = 1;
+  iel  = ( kdep > 0 && kdep <= mesh->nt ) ? kdep : 1;
   do {
     mvDir[0] = mvDir[1] = mvDir[2] = 0;
     iter++;
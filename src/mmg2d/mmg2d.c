@@ -234,7 +234,7 @@ int MMG2D_defaultOption(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol) {
   /* analysis */
   chrono(ON,&(ctim[2]));
   MMG2D_setfunc(mesh,met);
-  MMG2D_Set_commonFunc();
+  MMG2D_Set_commonOps(mesh);
 
   if ( mesh->info.imprim > 0 ) {
     fprintf(stdout,"\n  -- DEFAULT PARAMETERS COMPUTATION\n");
@@ -245,7 +245,7 @@ int MMG2D_defaultOption(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol) {
 
   /* specific meshing + update hmin/hmax */
   if ( mesh->info.optim ) {
-    if ( !MMG2D_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( !MMG5_unscaleMesh(mesh,met,sol) )
         _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
       _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
@@ -293,7 +293,6 @@ int main(int argc,char *argv[]) {
   /* Print timer at exit */
   atexit(MMG5_endcod);
 
-  MMG2D_Set_commonFunc();
   tminit(MMG5_ctim,TIMEMAX);
   chrono(ON,&MMG5_ctim[0]);
 
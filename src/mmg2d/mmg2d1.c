@@ -607,11 +607,17 @@ int MMG2D_adptri(MMG5_pMesh mesh,MMG5_pSol met) {
       fprintf(stdout,"     %8" MMG5_PRId " splitted, %8" MMG5_PRId " collapsed, %8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",ns,nc,nsw,nm);
     if ( ns < 10 && MMG5_abs(nc-ns) < 3 )  break;
     else if ( it > 3 && MMG5_abs(nc-ns) < 0.3 * MG_MAX(nc,ns) )  break;
+
+    /* time budget exhausted or few modified elements (the relocation moves
+     * almost every vertex at each wave so it is not counted) */
+    if ( MMG5_outOfTime(mesh) || MMG5_converged(mesh,ns+nc+nsw,mesh->nt) )
+      break;
   }
   while( ++it < maxit && (nc+ns+nsw+nm > 0) );
 
-  /* Last iterations of vertex relocation only */
-  if ( !mesh->info.nomove ) {
+  /* Last iterations of vertex relocation only (skipped if the time budget is
+   * exhausted) */
+  if ( !mesh->info.nomove && !MMG5_outOfTime(mesh) ) {
     nm = MMG2D_movtri(mesh,met,5,1);
     if ( nm < 0 ) {
       fprintf(stderr,"  ## Problem in function movtri. Unable to complete mesh."
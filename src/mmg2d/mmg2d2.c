@@ -157,18 +157,19 @@ MMG5_int MMG2D_findtrianglestate(MMG5_pMesh mesh,MMG5_int k,MMG5_int ip1,MMG5_in
 /**
  * \param mesh pointer to mesh
  * \param k point index
+ * \param kdep index of the triangle from which we start the search
  * \return index of one elt containing k or 0 (if no elt is found)
  *
  * Return the index of one triangle containing k (performing exhausting search
  * if needed).
  */
 static inline
-MMG5_int MMG2D_findTria_exhaust(MMG5_pMesh mesh,MMG5_int k) {
+MMG5_int MMG2D_findTria_exhaust(MMG5_pMesh mesh,MMG5_int k,MMG5_int kdep) {
   MMG5_pPoint ppt = &mesh->point[k];
   static int8_t mmgWarn0=0;
 
   /* Find the triangle lel of the mesh containing ppt */
-  MMG5_int lel = MMG2D_findTria(mesh,k);
+  MMG5_int lel = MMG2D_walkTria(mesh,k,kdep);
 
   /* Exhaustive search if not found */
   if ( !lel ) {
@@ -195,6 +196,148 @@ MMG5_int MMG2D_findTria_exhaust(MMG5_pMesh mesh,MMG5_int k) {
 }
 
 
+/** Number of bits per direction of the Hilbert keys of the insertion order */
+#define MMG2D_HILBERT_BITS 20
+
+/** Maximal number of BRIO rounds */
+#define MMG2D_BRIO_MAXROUND 16
+
+/**
+ * \param x first integer coordinate (in \f$[0,2^{MMG2D\_HILBERT\_BITS}[\f$)
+ * \param y second integer coordinate
+ * \return the index of the cell \a (x,y) along the Hilbert curve.
+ *
+ */
+static inline
+uint64_t MMG2D_hilbertKey(uint32_t x,uint32_t y) {
+  uint64_t key;
+  uint32_t s,rx,ry,t;
+
+  key = 0;
+  for ( s=1u<<(MMG2D_HILBERT_BITS-1); s>0; s>>=1 ) {
+    rx = (x & s) > 0;
+    ry = (y & s) > 0;
+    key += (uint64_t)s * s * ((3*rx) ^ ry);
+    /* Rotate the quadrant */
+    if ( !ry ) {
+      if ( rx ) {
+        x = s-1 - (x & (s-1));
+        y = s-1 - (y & (s-1));
+      }
+      t = x; x = y; y = t;
+    }
+  }
+  return key;
+}
+
+/** Sort key of a vertex to insert */
+typedef struct {
+  uint64_t key; /*!< BRIO round (high bits) and Hilbert index (low bits) */
+  MMG5_int k;   /*!< vertex index */
+} MMG2D_InsKey;
+
+static int MMG2D_cmpInsKey(const void *a,const void *b) {
+  const MMG2D_InsKey *ka = (const MMG2D_InsKey*)a;
+  const MMG2D_InsKey *kb = (const MMG2D_InsKey*)b;
+
+  if ( ka->key < kb->key ) return -1;
+  if ( ka->key > kb->key ) return  1;
+  return 0;
+}
+
+/**
+ * \param mesh pointer to the mesh structure
+ * \param np number of vertices to insert (vertices 1 to \a np)
+ * \param perm allocated array of size \a np filled by the insertion order
+ * \return 1 if success, 0 if fail.
+ *
+ * Compute a Biased Randomized Insertion Order of the vertices: the vertices are
+ * distributed in rounds whose size doubles from one round to the next (the
+ * round of a vertex is drawn from a hash of its index so the order is
+ * reproducible) and the vertices of each round are sorted along a Hilbert
+ * curve. Thus two successive vertices are close to each other and the walk
+ * that locates the next vertex is short.
+ *
+ */
+static
+int MMG2D_brioOrder(MMG5_pMesh mesh,MMG5_int np,MMG5_int *perm) {
+  MMG2D_InsKey *key;
+  MMG5_pPoint  ppt;
+  double       min[2],max[2],dd;
+  uint64_t     h;
+  uint32_t     x[2];
+  MMG5_int     k;
+  int          i,r;
+
+  for ( i=0; i<2; ++i ) {
+    min[i] =  DBL_MAX;
+    max[i] = -DBL_MAX;
+  }
+  for ( k=1; k<=np; ++k ) {
+    ppt = &mesh->point[k];
+    for ( i=0; i<2; ++i ) {
+      min[i] = MG_MIN(min[i],ppt->c[i]);
+      max[i] = MG_MAX(max[i],ppt->c[i]);
+    }
+  }
+  dd = MG_MAX(max[0]-min[0],max[1]-min[1]);
+  dd = ( dd > 0. ) ? ((double)(1u<<MMG2D_HILBERT_BITS) - 1.) / dd : 0.;
+
+  MMG5_ADD_MEM(mesh,np*sizeof(MMG2D_InsKey),"insertion keys",return 0);
+  MMG5_SAFE_MALLOC(key,np,MMG2D_InsKey,
+                   mesh->memCur -= np*sizeof(MMG2D_InsKey);return 0);
+
+  for ( k=1; k<=np; ++k ) {
+    ppt = &mesh->point[k];
+    for ( i=0; i<2; ++i ) {
+      x[i] = (uint32_t)((ppt->c[i]-min[i])*dd);
+    }
+
+    /* Round of the vertex: round r (from the last one) holds 1/2^(r+1) of the
+     * vertices */
+    h = (uint64_t)k * UINT64_C(0x9E3779B97F4A7C15);
+    h ^= h >> 29;
+    for ( r=0; r<MMG2D_BRIO_MAXROUND && (h & (UINT64_C(1)<<(63-r))); ++r ) ;
+
+    key[k-1].key = (uint64_t)(MMG2D_BRIO_MAXROUND-r) << (2*MMG2D_HILBERT_BITS)
+      | MMG2D_hilbertKey(x[0],x[1]);
+    key[k-1].k   = k;
+  }
+  qsort(key,np,sizeof(MMG2D_InsKey),MMG2D_cmpInsKey);
+
+  for ( k=0; k<np; ++k ) perm[k] = key[k].k;
+
+  MMG5_DEL_MEM(mesh,key);
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure
+ * \param list cavity of a vertex (triangles of the cavity are marked by
+ * mesh->base)
+ * \param lon number of triangles in the cavity
+ * \return index of a triangle outside the cavity and adjacent to it, 0 if
+ * not found.
+ *
+ * Return a triangle that remains valid after the insertion of a vertex in the
+ * cavity \a list, to start the location of the next vertex.
+ *
+ */
+static inline
+MMG5_int MMG2D_cavityNeighbour(MMG5_pMesh mesh,MMG5_int *list,int lon) {
+  MMG5_int *adja,jel;
+  int      k,i;
+
+  for ( k=0; k<lon; ++k ) {
+    adja = &mesh->adja[3*(list[k]-1)+1];
+    for ( i=0; i<3; ++i ) {
+      jel = adja[i]/3;
+      if ( jel && mesh->tria[jel].base != mesh->base ) return jel;
+    }
+  }
+  return 0;
+}
+
 /**
  * \param mesh pointer to the mesh structure
  * \param sol pointer to the solution structure
@@ -207,32 +350,46 @@ MMG5_int MMG2D_findTria_exhaust(MMG5_pMesh mesh,MMG5_int k) {
 int MMG2D_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pPoint   ppt;
   int           lon;
-  MMG5_int      k,kk,ns,nus,nu,nud;
+  MMG5_int      k,kk,ns,nus,nu,nud,np,kdep,jel,*perm;
   int           iter,maxiter;
   static int8_t mmgWarn0=0,mmgWarn1=0,mmgWarn2=0;
   MMG5_int      list[MMG5_TRIA_LMAX];
   const int flag=-10;
 
-  for(k=1; k<=mesh->np-4; k++) {
+  np = mesh->np-4;
+  for(k=1; k<=np; k++) {
     ppt = &mesh->point[k];
     ppt->flag	= flag;
   }
   iter = 0;
   maxiter = 10;
 
+  /* Insertion order: each vertex is located starting from a triangle close to
+   * the previously inserted one */
+  MMG5_ADD_MEM(mesh,(np+1)*sizeof(MMG5_int),"insertion order",return 0);
+  MMG5_SAFE_MALLOC(perm,np+1,MMG5_int,
+                   mesh->memCur -= (np+1)*sizeof(MMG5_int);return 0);
+  if ( !MMG2D_brioOrder(mesh,np,perm) ) {
+    for(k=0; k<np; k++) perm[k] = k+1;
+  }
+  kdep = 1;
+
 	do {
     ns = nus = 0;
     nu = nud = 0;
     mmgWarn1 = mmgWarn2 = 0;
-    for(k=1; k<=mesh->np-4; k++) {
+    for(kk=0; kk<np; kk++) {
+      k   = perm[kk];
       ppt = &mesh->point[k];
 		  if(ppt->flag != flag) continue;
 			nus++;
 
-      list[0] = MMG2D_findTria_exhaust(mesh,k);
+      list[0] = MMG2D_findTria_exhaust(mesh,k,kdep);
       if ( !list[0] ) {
+        MMG5_DEL_MEM(mesh,perm);
         return 0;
       }
+      kdep = list[0];
 
       /* Create the cavity of point k starting from list[0] */
       lon = MMG2D_cavity(mesh,sol,k,list);
@@ -247,6 +404,7 @@ int MMG2D_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
         }
         continue;
       } else {
+        jel = MMG2D_cavityNeighbour(mesh,list,lon);
 				if(!MMG2D_delone(mesh,sol,k,list,lon)) {
 			    if ( abs(mesh->info.imprim) > 4) {
             nud++;
@@ -260,6 +418,7 @@ int MMG2D_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
         } else {
           ppt->flag = 0;
           ns++;
+          if ( jel ) kdep = jel;
         }
       }
     }
@@ -279,15 +438,18 @@ int MMG2D_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
     mmgWarn2 = 0;
     nus = ns = 0;
     /*try to insert using splitbar*/
-    for(k=1; k<=mesh->np-4; k++) {
+    for(kk=0; kk<np; kk++) {
+      k   = perm[kk];
       ppt = &mesh->point[k];
 		  if(ppt->flag != flag) continue;
 			nus++;
 
-      list[0] = MMG2D_findTria_exhaust(mesh,k);
+      list[0] = MMG2D_findTria_exhaust(mesh,k,kdep);
       if ( !list[0] ) {
+        MMG5_DEL_MEM(mesh,perm);
         return 0;
       }
+      kdep = list[0];
 
       if(!MMG2D_splitbar(mesh,list[0],k)) {
         if ( !mmgWarn2 ) {
@@ -303,9 +465,11 @@ int MMG2D_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
     if ( MMG5_abs(nus-ns) ) {
       fprintf(stderr,"  ## Warning: %s: %" MMG5_PRId " point(s) not "
             "inserted. Check your output mesh\n",__func__,MMG5_abs(nus-ns));
+      MMG5_DEL_MEM(mesh,perm);
       return 0;
     }
   }
+  MMG5_DEL_MEM(mesh,perm);
 	return 1;
 }
 
@@ -322,17 +486,34 @@ int MMG2D_markSD(MMG5_pMesh mesh) {
   MMG5_pEdge   ped;
   MMG5_pPoint  ppt;
   MMG5_int     k,l,iadr,*adja,ped0,ped1,ipil,ncurc,nref;
-  MMG5_int     kinit,nt,nsd,ip1,ip2,ip3,ip4,ned,iel;
+  MMG5_int     kinit,kcur,nt,nsd,ip1,ip2,ip3,ip4,ned,iel;
   int          voy;
   int8_t       i,i1,i2;
   MMG5_int     *list;
+  MMG5_Hash    hash;
 
   /* Reset flag field for triangles */
   for(k=1 ; k<=mesh->nt ; k++)
     mesh->tria[k].flag = mesh->mark;
 
-  MMG5_SAFE_CALLOC(list,mesh->nt,MMG5_int,return 0);
+  /* Hash the boundary edges to detect the subdomain interfaces */
+  if ( !MMG5_hashNew(mesh,&hash,mesh->na,3*mesh->na) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to allocate edge hash table.\n",
+            __func__);
+    return 0;
+  }
+  for(l=1; l<=mesh->na; l++) {
+    ped = &mesh->edge[l];
+    if ( !ped->a ) continue;
+    if ( !MMG5_hashEdge(mesh,&hash,ped->a,ped->b,l) ) {
+      MMG5_DEL_MEM(mesh,hash.item);
+      return 0;
+    }
+  }
+
+  MMG5_SAFE_CALLOC(list,mesh->nt,MMG5_int,MMG5_DEL_MEM(mesh,hash.item);return 0);
   kinit = 0;
+  kcur  = 1;
   nref  = 0;
   ip1   =  mesh->np;
 
@@ -368,12 +549,7 @@ int MMG2D_markSD(MMG5_pMesh mesh) {
         ped0 = pt->v[i1];
         ped1 = pt->v[i2];
 
-        /* WARNING: exhaustive search among edges, to be optimized with a hashing structure */
-        for(l=1; l<=mesh->na; l++) {
-          ped = &mesh->edge[l];
-          if( ( ped->a == ped0 && ped->b == ped1 ) || ( ped->b == ped0 && ped->a == ped1 ) ) break;
-        }
-        if ( l <= mesh->na ) continue;
+        if ( MMG5_hashGet(&hash,ped0,ped1) ) continue;
 
         pt1->ref = nref;
         list[++ncurc] = iel;
@@ -382,13 +558,15 @@ int MMG2D_markSD(MMG5_pMesh mesh) {
     }
     while ( ipil <= ncurc );
 
-    kinit = 0;
-    for(k=1; k<=mesh->nt; k++) {
+    /* References are never reset so the triangles before the previous
+     * unreferenced one have all been referenced */
+    for(k=kcur; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
       if ( !MG_EOK(pt) ) continue;
-      pt->flag = mesh->mark;
-      if ( !kinit && !(mesh->tria[k].ref) ) kinit = k;
+      if ( !pt->ref ) break;
     }
+    kcur  = k;
+    kinit = ( k<=mesh->nt ) ? k : 0;
   }
   while ( kinit );
 
@@ -398,6 +576,7 @@ int MMG2D_markSD(MMG5_pMesh mesh) {
   }
 
   MMG5_SAFE_FREE(list);
+  MMG5_DEL_MEM(mesh,hash.item);
 
   /* Remove BB triangles and vertices */
   /*BB vertex*/
@@ -213,14 +213,14 @@ int MMG2D_mmg2d6(MMG5_pMesh mesh, MMG5_pSol sol,MMG5_pSol met) {
   if ( mesh->info.isosurf ) {
     strcat(str,"(BOUNDARY PART)");
 
-    MMG5_snpval   = MMG5_snpval_lssurf;
-    MMG5_resetRef = MMG5_resetRef_lssurf;
-    MMG5_setref   = MMG5_setref_lssurf;
+    mesh->ops->snpval     = MMG5_snpval_lssurf;
+    mesh->ops->resetRef   = MMG5_resetRef_lssurf;
+    mesh->ops->setref     = MMG5_setref_lssurf;
   }
   else {
-    MMG5_snpval   = MMG5_snpval_ls;
-    MMG5_resetRef = MMG5_resetRef_ls;
-    MMG5_setref   = MMG5_setref_ls;
+    mesh->ops->snpval     = MMG5_snpval_ls;
+    mesh->ops->resetRef   = MMG5_resetRef_ls;
+    mesh->ops->setref     = MMG5_setref_ls;
   }
 
   if ( abs(mesh->info.imprim) > 3 ) {
@@ -1,9 +1,20 @@
-#include "libmmgtypes.h"
+#include "libmmg2d.h"
+#include "libmmg2d_private.h"
 #include "mmg2d_export.h"
 
-#define MMG_EXTERN
-#define MMG_ASSIGN_NULL =NULL
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Compute the size map with the function of the operators table of the mesh
+ * (the table is filled if \ref MMG2D_setfunc has not been called).
+ *
+ */
+static int MMG2D_doSol_mesh(MMG5_pMesh mesh,MMG5_pSol met) {
+  if ( !mesh->ops->doSol ) MMG2D_setfunc(mesh,met);
+  return mesh->ops->doSol(mesh,met);
+}
 
-#include  "mmg2dexterns_private.h"
-
-LIBMMG2D_EXPORT int    (*MMG2D_doSol)(MMG5_pMesh ,MMG5_pSol )=NULL;
+/* Legacy pointer: it is set once here and never modified by the library */
+LIBMMG2D_EXPORT int    (*MMG2D_doSol)(MMG5_pMesh ,MMG5_pSol )=MMG2D_doSol_mesh;
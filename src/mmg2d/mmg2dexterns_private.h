@@ -4,19 +4,15 @@
 #include "libmmgtypes.h"
 #include "mmgcommon_private.h"
 
-#ifndef MMG_EXTERN
-#define MMG_EXTERN extern
-#define MMG_ASSIGN_NULL
-#endif
-
-FUNCTION_POINTER ( int   (*MMG2D_defsiz)(MMG5_pMesh ,MMG5_pSol ) );
-FUNCTION_POINTER ( int   (*MMG2D_intmet)(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,int8_t ,MMG5_int ,double ) );
-FUNCTION_POINTER ( double(*MMG2D_lencurv)(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int ) );
-FUNCTION_POINTER ( int   (*MMG2D_gradsizreq)(MMG5_pMesh ,MMG5_pSol ) );
-FUNCTION_POINTER ( double(*MMG2D_caltri)(MMG5_pMesh ,MMG5_pSol ,MMG5_pTria ) );
-FUNCTION_POINTER ( int   (*MMG2D_gradsiz)(MMG5_pMesh ,MMG5_pSol ) );
-
-#undef MMG_EXTERN
-#undef MMG_ASSIGN_NULL
+/**
+ * Operators of the \ref MMG5_Ops table of the mesh that are used by mmg2d
+ * (filled by MMG2D_setfunc).
+ */
+#define MMG2D_defsiz(mesh,...)       (mesh)->ops->defsiz(mesh,__VA_ARGS__)
+#define MMG2D_intmet(mesh,...)       (mesh)->ops->intmet(mesh,__VA_ARGS__)
+#define MMG2D_lencurv(mesh,...)      (mesh)->ops->lencurv(mesh,__VA_ARGS__)
+#define MMG2D_gradsizreq(mesh,...)   (mesh)->ops->gradsizreq(mesh,__VA_ARGS__)
+#define MMG2D_caltri(mesh,...)       (mesh)->ops->caltri(mesh,__VA_ARGS__)
+#define MMG2D_gradsiz(mesh,...)      (mesh)->ops->gradsiz(mesh,__VA_ARGS__)
 
 #endif
@@ -78,7 +78,7 @@ int MMG2D_solTruncatureForOptim(MMG5_pMesh mesh, MMG5_pSol met, int ani) {
     ier = MMG5_solTruncature_iso(mesh,met);
   }
   else {
-    MMG5_solTruncature_ani = MMG5_2dSolTruncature_ani;
+    mesh->ops->solTruncature_ani = MMG5_2dSolTruncature_ani;
     ier = MMG5_solTruncature_ani(mesh,met);
   }
 
@@ -153,7 +153,7 @@ int MMG2D_doSol_iso(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG2D_solTruncatureForOptim(mesh,sol,0);
 
   /* compute quality */
-  if ( MMG2D_caltri ) {
+  if ( mesh->ops->caltri ) {
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
       pt->qual = MMG2D_caltri_iso(mesh,sol,pt);
@@ -267,7 +267,7 @@ int MMG2D_doSol_ani(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG2D_solTruncatureForOptim(mesh,sol,1);
 
   /* compute quality */
-  if ( MMG2D_caltri ) {
+  if ( mesh->ops->caltri ) {
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
       pt->qual = MMG2D_caltri_ani(mesh,sol,pt);
@@ -57,8 +57,12 @@ int MMG2D_Alloc_mesh(MMG5_pMesh *mesh, MMG5_pSol *met, MMG5_pSol *ls,
                      MMG5_pSol *disp) {
 
   /* mesh allocation */
-  if ( *mesh )  MMG5_SAFE_FREE(*mesh);
+  if ( *mesh ) {
+    MMG5_SAFE_FREE((*mesh)->ops);
+    MMG5_SAFE_FREE(*mesh);
+  }
   MMG5_SAFE_CALLOC(*mesh,1,MMG5_Mesh,return 0);
+  MMG5_SAFE_CALLOC((*mesh)->ops,1,MMG5_Ops,MMG5_SAFE_FREE(*mesh);return 0);
 
   /* metric allocation */
   if ( met ) {
@@ -95,9 +99,9 @@ int MMG2D_Alloc_mesh(MMG5_pMesh *mesh, MMG5_pSol *met, MMG5_pSol *ls,
 static inline
 void MMG2D_Init_woalloc_mesh(MMG5_pMesh *mesh, MMG5_pSol *met,MMG5_pSol *ls,MMG5_pSol *disp) {
 
-  MMG2D_Set_commonFunc();
-
   assert(mesh);
+  MMG2D_Set_commonOps(*mesh);
+
   (*mesh)->dim   = 2;
   (*mesh)->ver   = 2;
   (*mesh)->nsols = 0;
@@ -334,6 +338,7 @@ int MMG2D_Free_all_var(va_list argptr)
     MMG5_DEL_MEM(*mesh,*sols);
   }
 
+  MMG5_SAFE_FREE((*mesh)->ops);
   MMG5_SAFE_FREE(*mesh);
 
   return ier;
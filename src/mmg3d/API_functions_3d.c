@@ -100,7 +100,7 @@ void MMG3D_Init_parameters(MMG5_pMesh mesh) {
    /* [1/0]    , Turn on/off the renumbering using SCOTCH */
   mesh->info.renum    = MMG5_ON;
 #else
-   /* [0]    , Turn on/off the renumbering using SCOTCH */
+   /* [0/1]    , Turn off/on the renumbering along a space-filling curve */
   mesh->info.renum    = MMG5_OFF;
 #endif
 
@@ -2168,6 +2168,26 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,MMG5_int val
   case MMG3D_IPARAM_isoref :
     mesh->info.isoref   = val;
     break;
+  case MMG3D_IPARAM_threads :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of threads must be positive"
+              " (0 to use the OpenMP default).\n",__func__);
+      return 0;
+    }
+#ifdef USE_OPENMP
+    mesh->info.nthreads = val;
+#else
+    if ( val > 1 ) {
+      fprintf(stderr,"\n  ## Warning: %s: multithreading unavailable:"
+              " set the USE_OPENMP CMake's flag to ON when compiling the mmg3d"
+              " library to enable this feature.\n",__func__);
+    }
+    mesh->info.nthreads = 1;
+#endif
+    break;
+  case MMG3D_IPARAM_batchins :
+    mesh->info.batchins = val ? 1 : 0;
+    break;
   case MMG3D_IPARAM_isosurf :
     mesh->info.isosurf = val;
     break;
@@ -2277,11 +2297,9 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,MMG5_int val
 
     break;
 
-#ifdef USE_SCOTCH
   case MMG3D_IPARAM_renum :
     mesh->info.renum    = val;
     break;
-#endif
   case MMG3D_IPARAM_anisosize :
     mesh->info.ani = val;
     break;
@@ -2312,6 +2330,12 @@ int MMG3D_Get_iparameter(MMG5_pMesh mesh, MMG5_int iparam) {
   case MMG3D_IPARAM_debug :
     return  mesh->info.ddebug;
     break;
+  case MMG3D_IPARAM_threads :
+    return  mesh->info.nthreads;
+    break;
+  case MMG3D_IPARAM_batchins :
+    return  mesh->info.batchins;
+    break;
   case MMG3D_IPARAM_angle :
     if ( mesh->info.dhd <= 0. ) {
       return  0;
@@ -2350,11 +2374,9 @@ int MMG3D_Get_iparameter(MMG5_pMesh mesh, MMG5_int iparam) {
   case MMG3D_IPARAM_numberOfMat :
     return  mesh->info.nmat;
     break;
-#ifdef USE_SCOTCH
   case MMG3D_IPARAM_renum :
     return  mesh->info.renum;
     break;
-#endif
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
@@ -2434,6 +2456,22 @@ int MMG3D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val)
       mesh->info.rmc      = val;
     }
     break;
+  case MMG3D_DPARAM_timeBudget :
+    if ( val < 0.0 ) {
+      fprintf(stderr,"\n  ## Error: %s: time budget must be positive"
+              " (0 for no limit).\n",__func__);
+      return 0;
+    }
+    mesh->info.tbudget  = val;
+    break;
+  case MMG3D_DPARAM_convergence :
+    if ( val < 0.0 || val >= 1.0 ) {
+      fprintf(stderr,"\n  ## Error: %s: convergence threshold must be comprised"
+              " between 0 and 1.\n",__func__);
+      return 0;
+    }
+    mesh->info.conv     = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n", __func__);
     return 0;
@@ -32,6 +32,10 @@
  * This helps deciding if a position is too close to other nodes to refine
  * with an insertion of a new node.
  *
+ * The PROctree is linear: cells and vertex lists are stored in pooled arrays
+ * and the path of a vertex is given by the Morton key of its integer
+ * coordinates.
+ *
  */
 
 #include "libmmgtypes.h"
@@ -40,926 +44,496 @@
 #include <stdio.h>
 
 /**
- * \param q pointer to the PROctree cell
- *
- * Initialisation of the PROctree cell.
- *
- */
-void MMG3D_initPROctree_s( MMG3D_PROctree_s* q)
-{
-  q->nbVer = 0;
-  q->depth = 0;
-  q->v = NULL;
-  q->branches = NULL;
-}
-
-/**
- * \param mesh pointer to the mesh structure.
- * \param q pointer to the global PROctree
- * \param nv maximum number of vertices in each cell before subdivision
- * \return 1 if ok 0 if memory saturated
+ * \param x coordinate of a point (in the [0;1] PROctree box).
+ * \return the integer coordinate of the cell of maximal depth containing \a x.
  *
- * Initialisation of the PROctree cell.
+ * Points lying on the boundary of two cells belong to the lower one, points
+ * outside the box belong to the closest boundary cell.
  *
  */
-int MMG3D_initPROctree(MMG5_pMesh mesh,MMG3D_pPROctree* q, int nv)
-{
-  MMG5_int i;
+static inline
+int64_t MMG3D_PROctreeInt(double x) {
+  double s;
 
-  MMG5_ADD_MEM(mesh,sizeof(MMG3D_PROctree),"PROctree structure",
-                return 0);
-  MMG5_SAFE_MALLOC(*q,1, MMG3D_PROctree, return 0);
+  s = x*(double)(1<<MMG3D_PROCTREE_DMAX);
+  if ( !(s > 0.) ) return 0;
+  if ( s >= (double)(1<<MMG3D_PROCTREE_DMAX) ) return (1<<MMG3D_PROCTREE_DMAX)-1;
 
-
-  // set nv to the next power of 2
-  nv--;
-  nv |= nv >> 1;
-  nv |= nv >> 2;
-  nv |= nv >> 4;
-  nv |= nv >> 8;
-  nv |= nv >> 16;
-  nv++;
-  (*q)->nv = nv;
-
-  // Number maximum of cells listed for the zone search
-  (*q)->nc = MG_MAX(2048/nv,16);
-
-  MMG5_ADD_MEM(mesh,sizeof(MMG3D_PROctree_s),"initial PROctree cell",
-                return 0);
-
-  MMG5_SAFE_MALLOC((*q)->q0,1, MMG3D_PROctree_s, return 0);
-  MMG3D_initPROctree_s((*q)->q0);
-
-  for (i=1;i<=mesh->np; ++i)
-  {
-    if ( !MG_VOK(&mesh->point[i]) )  continue;
-    if (mesh->point[i].tag & MG_BDY) continue;
-
-    if(!MMG3D_addPROctree(mesh, (*q), i))
-      return 0;
-
-  }
-  return 1;
+  return (int64_t)ceil(s)-1;
 }
 
 /**
- * \param mesh pointer to the mesh structure.
- * \param q pointer to the PROctree cell
- * \param nv number of vertices in the cell subtree
- *
- * Free the PROctree cell.
+ * \param x integer coordinate.
+ * \return \a x with its bits spread to every third bit.
  *
  */
-void MMG3D_freePROctree_s(MMG5_pMesh mesh,MMG3D_PROctree_s* q, int nv)
-{
-  int nbBitsInt,depthMax,dim,i,sizBr,nvTemp;
-
-  dim       = mesh->dim;
-  sizBr     = 1<<dim;
-  nbBitsInt = sizeof(int64_t)*8;
-  depthMax  = nbBitsInt/dim - 1;
-
-  if (q->nbVer>nv && q->depth < depthMax )
-  {
-    for ( i = 0; i<sizBr; i++)
-    {
-      MMG3D_freePROctree_s(mesh,&(q->branches[i]), nv);
-    }
-    MMG5_DEL_MEM(mesh,q->branches);
-    q->branches = NULL;
-  }
-  else if (q->nbVer>0)
-  {
-    if ( q->nbVer<= nv )
-    {
-      nvTemp = q->nbVer;
-      nvTemp--;
-      nvTemp |= nvTemp >> 1;
-      nvTemp |= nvTemp >> 2;
-      nvTemp |= nvTemp >> 4;
-      nvTemp |= nvTemp >> 8;
-      nvTemp |= nvTemp >> 16;
-      nvTemp++;
-
-      MMG5_DEL_MEM(mesh,q->v);
-      q->v = NULL;
-      q->nbVer = 0;
-    }else
-    {
-      assert(q->v);
-      MMG5_DEL_MEM(mesh,q->v);
-      q->v = NULL;
-      q->nbVer = 0;
-    }
-  }
+static inline
+int64_t MMG3D_PROctreeSpread(int64_t x) {
+  x &= 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffLL;
+  x = (x | x << 16) & 0x1f0000ff0000ffLL;
+  x = (x | x << 8)  & 0x100f00f00f00f00fLL;
+  x = (x | x << 4)  & 0x10c30c30c30c30c3LL;
+  x = (x | x << 2)  & 0x1249249249249249LL;
+  return x;
 }
 
 /**
- * \param mesh pointer to the mesh structure.
- * \param q pointer to a pointer to the global PROctree.
- *
- * Free the global PROctree structure.
+ * \param key Morton key of a point.
+ * \param depth depth of a cell of the path of the point.
+ * \return the index of the child of the cell that contains the point.
  *
  */
-void MMG3D_freePROctree(MMG5_pMesh mesh,MMG3D_pPROctree *q)
-{
-  MMG3D_freePROctree_s(mesh,(*q)->q0, (*q)->nv);
-  MMG5_DEL_MEM(mesh,(*q)->q0);
-  (*q)->q0 = NULL;
-  MMG5_DEL_MEM(mesh,*q);
-  *q = NULL;
+static inline
+int MMG3D_PROctreeChild(int64_t key,int depth) {
+  return (int)((key >> 3*(MMG3D_PROCTREE_DMAX-1-depth)) & 7);
 }
 
-
 /**
  * \param q pointer to the global PROctree.
  * \param ver coordinates of the point.
  * \param dim space dimension (should be 3).
- * \return the integer containing the coordinates
+ * \return the Morton key of the cell of maximal depth containing the point.
  *
  * Get the integer containing the coordinates
  *
  */
 int64_t MMG3D_getPROctreeCoordinate(MMG3D_pPROctree q, double* ver, int dim)
 {
-  int64_t s    = 1<<20;
-  double  prec = 1./(1<<30);
-  int place = 0;
-  int ix = (int)floor((ver[0]-prec)*s);
-  int iy = (int)floor((ver[1]-prec)*s);
-  int iz = (int)floor((ver[2]-prec)*s);
-  ix = (ix > 0) ? ix:0;
-  iy = (iy > 0) ? iy:0;
-  iz = (iz > 0) ? iz:0;
-  int64_t i=0;
-  int j;
-  for(j=19; j>=0; j--)
-  {
-    s=s>>1;
-    i += ((ix & s) >> j)<<place;
-    place++;
-    i += ((iy & s) >> j)<<place;
-    place++;
-    i += ((iz & s) >> j)<<place;
-    place++;
-  }
-  return i;
+  return    MMG3D_PROctreeSpread(MMG3D_PROctreeInt(ver[0]))
+    | (MMG3D_PROctreeSpread(MMG3D_PROctreeInt(ver[1])) << 1)
+    | (MMG3D_PROctreeSpread(MMG3D_PROctreeInt(ver[2])) << 2);
 }
 
-
-
 /**
  * \param mesh pointer to the mesh structure.
  * \param q pointer to the global PROctree.
- * \param no index of the moved point.
- * \param newVer new coordinates for the moved point.
- * \param oldVer old coordinates for the moved point.
- * \return 1 if ok 0 if memory saturated
+ * \return the index of the first cell of a free group of 8 cells, 0 if fail.
  *
- * Move one point in the PROctree structure. /!\ the vertex of index \a no
- * can have either the new or the old coordinates in the mesh but all
- * other vertice should have the same coordinates as when they were inserted
- * into the PROctree. (ie: one move at a time in the mesh and the PROctree)
+ * Get a group of 8 contiguous cells (the cell array may be reallocated).
  *
  */
-int MMG3D_movePROctree(MMG5_pMesh mesh, MMG3D_pPROctree q, MMG5_int no, double* newVer, double* oldVer)
-{
-  int64_t oldCoor, newCoor;
-  double  pt[3];
-  int     dim;
-
-  dim = mesh->dim;
-
-  memcpy(&pt, oldVer ,dim*sizeof(double));
-  oldCoor = MMG3D_getPROctreeCoordinate(q, oldVer, dim);
-  memcpy(&pt, newVer ,dim*sizeof(double));
-  newCoor = MMG3D_getPROctreeCoordinate(q, mesh->point[no].c, dim);
-
-  if (newCoor == oldCoor) {
-    return 1;
+static
+MMG5_int MMG3D_newPROctreeCells(MMG5_pMesh mesh,MMG3D_pPROctree q) {
+  MMG5_int c,nmax;
+
+  if ( q->cellfree ) {
+    c = q->cellfree;
+    q->cellfree = q->cell[c].child;
+    return c;
   }
-  else // it could be possible to combine delPROctree and addPROctree to keep it local...
-  {
-    /* delPROctree */
-    memcpy(&pt, oldVer ,dim*sizeof(double));
-    if (!MMG3D_delPROctreeRec(mesh, q->q0, pt , no, q->nv))
-      return 0;
 
-    /* addPROctree */
-    memcpy(&pt, newVer ,dim*sizeof(double));
-    if(!MMG3D_addPROctreeRec(mesh, q->q0, pt , no, q->nv))
-      return 0;
+  if ( q->ncell+8 > q->ncellmax ) {
+    nmax = q->ncellmax + MG_MAX(q->ncellmax/2,8);
+    MMG5_ADD_MEM(mesh,(nmax-q->ncellmax)*sizeof(MMG3D_PROctree_s),
+                 "PROctree cells",return 0);
+    MMG5_SAFE_REALLOC(q->cell,q->ncellmax,nmax,MMG3D_PROctree_s,
+                      "PROctree cells",return 0);
+    q->ncellmax = nmax;
   }
-  return 1;
+  c = q->ncell;
+  q->ncell += 8;
+
+  return c;
 }
 
 /**
+ * \param mesh pointer to the mesh structure.
+ * \param q pointer to the global PROctree.
+ * \return the index of a free vertex block, 0 if fail.
  *
- * \param cellCenter 3 coordinates of the center of the PROctree cell to test.
- * \param l size of the cell
- * \param zoneCenter 3 coordinates of the center of the search zone
- * \param radius of the search zone
- * \return wether the cell is included in the search zone.
+ * Get a free vertex block (the block arrays may be reallocated).
  *
  */
-int MMG3D_isCellIncluded(double* cellCenter, double l, double* zoneCenter, double l0)
-{
-  double x,y,z,r1;//r2,rmax;
-
-  x = cellCenter[0]-zoneCenter[0];
-  y = cellCenter[1]-zoneCenter[1];
-  z = cellCenter[2]-zoneCenter[2];
-
-  r1 = sqrt(x*x+y*y+z*z);
+static
+MMG5_int MMG3D_newPROctreeBlock(MMG5_pMesh mesh,MMG3D_pPROctree q) {
+  MMG5_int b,nmax;
+
+  if ( q->blkfree ) {
+    b = q->blkfree;
+    q->blkfree = q->blknxt[b];
+    return b;
+  }
 
-  // to avoid sqrt :
-  //~ r1 = x*x+y*y+z*z;
-  //~ r2 = 3*l*l;
-  //~ rmax = MG_MAX(r1,r2);
-  //sqrt(3)=1.7320508...
-  //~ return (r1+r2+2*rmax<l0*l0);
+  if ( q->nblk+1 > q->nblkmax ) {
+    nmax = q->nblkmax + MG_MAX(q->nblkmax/2,8);
+    MMG5_ADD_MEM(mesh,(nmax-q->nblkmax)*((size_t)q->nv+1)*sizeof(MMG5_int),
+                 "PROctree vertex blocks",return 0);
+    MMG5_SAFE_REALLOC(q->v,(size_t)q->nv*q->nblkmax,(size_t)q->nv*nmax,MMG5_int,
+                      "PROctree vertex blocks",return 0);
+    MMG5_SAFE_REALLOC(q->blknxt,q->nblkmax+1,nmax+1,MMG5_int,
+                      "PROctree vertex blocks",return 0);
+    q->nblkmax = nmax;
+  }
+  b = ++q->nblk;
 
-  return (r1+1.732051*l<l0);
+  return b;
 }
 
-
 /**
- * \param distList list of values.
- * \param dist value to insert in the list.
- * \param index position of the element before the place where \a dist
- * should be inserted.
- * \param size size of the list before insertion.
- *
- * Insert the value \a dist in the list \a distList at position \a index+1.
- * Moves other data so nothing is lost. No memory check performed, this
- * function should be called with coherent parameters.
+ * \param q pointer to the global PROctree.
+ * \param b index of the vertex block.
+ * \return pointer toward the first vertex of the block \a b.
  *
-*/
-void MMG3D_placeInListDouble(double* distList, double dist, int index, int size)
-{
-  memmove(&(distList[index+2]),&(distList[index+1]),(size-(index+1))*sizeof(double));
-  distList[index+1] = dist;
+ */
+static inline
+MMG5_int* MMG3D_PROctreeBlock(MMG3D_pPROctree q,MMG5_int b) {
+  return &q->v[(size_t)q->nv*(b-1)];
 }
 
 /**
- * \param qList list of pointer on PROctree.
- * \param q pointer on PROctree to be inserted in the list.
- * \param index position of the element before the place where \a q
- * should be inserted.
- * \param size size of the list before insertion.
+ * \param mesh pointer to the mesh structure.
+ * \param q pointer to the global PROctree.
+ * \param c index of a leaf.
+ * \param no index of the vertex to add.
+ * \return 1 if ok 0 if memory saturated
  *
- * Insert the pointer \a q in the list \a qList at position \a index+1.
- * Moves other data so nothing is lost. No memory check performed, this
- * function should be called with coherent parameters.
+ * Append the vertex \a no to the list of the leaf \a c. The first block of the
+ * list is the only one that may be partially filled.
  *
  */
-void MMG3D_placeInListPROctree(MMG3D_PROctree_s** qlist, MMG3D_PROctree_s* q, int index, int size)
-{
-  memmove(&(qlist[index+2]),&(qlist[index+1]),(size-(index+1))*sizeof(MMG3D_PROctree_s*));
-  #ifdef DEBUG
-  if (index+2+(size-(index+1))>61 || index+1<0)
-    fprintf(stderr, "\n  ## Error: %s: index"
-            " too large %i > 61\n",__func__, index+2+(size-(index+1));
-  #endif
-  qlist[index+1] = q;
+static
+int MMG3D_leafAddPROctree(MMG5_pMesh mesh,MMG3D_pPROctree q,MMG5_int c,MMG5_int no) {
+  MMG5_int b;
+  int      i;
+
+  i = q->cell[c].nbVer % q->nv;
+  if ( !i ) {
+    b = MMG3D_newPROctreeBlock(mesh,q);
+    if ( !b ) return 0;
+    q->blknxt[b]   = q->cell[c].blk;
+    q->cell[c].blk = b;
+  }
+  MMG3D_PROctreeBlock(q,q->cell[c].blk)[i] = no;
+  ++q->cell[c].nbVer;
+
+  return 1;
 }
 
 /**
- * \param distList ordered list of value from smallest to largest.
- * \param dist value to be compared to elements in the list.
- * \param indexMin minimum index of the list.
- * \param indexMax maximum index of the list.
+ * \param q pointer to the global PROctree.
+ * \param c index of a leaf.
+ * \param no index of the vertex to delete.
+ * \return 1 if the vertex has been deleted, 0 if it is not in the leaf.
  *
- * \return Index of the biggest value of disList that is strictly
- * smaller than dist. Only search in the bounds of indexMin and indexMax.
+ * Delete the vertex \a no from the list of the leaf \a c (the last vertex of
+ * the list takes its place).
  *
  */
-int MMG3D_seekIndex (double* distList, double dist, int indexMin, int indexMax)
-{
-  int indexMed;
-
-  if (indexMin > indexMax)
-    MMG3D_seekIndex(distList, dist, indexMax, indexMin);
-  else if (indexMax - indexMin <2)
-  {
-    #ifdef DEBUG
-      if (indexMin >= 60 || indexMax>=60)
-        fprintf(stderr,"\n  ## Error: %s: index should not be that large %i %i.\n",
-                __func__,indexMin, indexMax);
-    #endif
-    if (dist > distList[indexMax])
-      return indexMax;
-    else
-      return indexMin;
-  }
-  else
-  {
-    indexMed = (indexMin + indexMax)/2;
-
-    #ifdef DEBUG
-      if (indexMed >= 60 || indexMed < 0)
-        fprintf(stderr,"\n  ## Error: %s: index should not be that large %i.\n",
-                __func__,indexMed);
-    #endif
-
-    if (dist > distList[indexMed])
-      MMG3D_seekIndex(distList, dist, indexMed, indexMax);
-    else
-      MMG3D_seekIndex(distList, dist, indexMin, indexMed);
+static
+int MMG3D_leafDelPROctree(MMG3D_pPROctree q,MMG5_int c,MMG5_int no) {
+  MMG3D_PROctree_s *cell;
+  MMG5_int         b,*v,*vh;
+  int              i,n,last;
+
+  cell = &q->cell[c];
+  if ( !cell->nbVer ) return 0;
+
+  last = (cell->nbVer-1) % q->nv;
+  vh   = MMG3D_PROctreeBlock(q,cell->blk);
+
+  n = last+1;
+  for ( b=cell->blk; b; b=q->blknxt[b] ) {
+    v = MMG3D_PROctreeBlock(q,b);
+    for ( i=0; i<n; ++i ) {
+      if ( v[i] != no ) continue;
+
+      v[i] = vh[last];
+      --cell->nbVer;
+      if ( !last ) {
+        b              = cell->blk;
+        cell->blk      = q->blknxt[b];
+        q->blknxt[b]   = q->blkfree;
+        q->blkfree     = b;
+      }
+      return 1;
+    }
+    n = q->nv;
   }
-  return 1;
+  return 0;
 }
 
 /**
- * \param rectin rectangle to intersect, is not modified.
- * \param rectinout rectangle to intersect, is set to the intersection.
+ * \param mesh pointer to the mesh structure.
+ * \param q pointer to the global PROctree.
+ * \param c index of the leaf to subdivide.
+ * \return 1 if ok 0 if memory saturated
  *
- * \return 1 if \a rectinout intersect \a rectin, 0 otherwise (possible because
- * the surface reconstruction may leads to point outside the [0;1]x[0;1]x[0;1]
- * bounding box)
+ * Subdivide the full leaf \a c and relocate its vertices in the children.
  *
- * Set rectinout to the intersection of the two rectangles.
- *  Rectangles are defined by: the coordinates of the lower left corner
- * of the rectange and the length of the rectangle in each dimension.
-*/
-int MMG3D_intersectRect(double *rectin, double *rectinout)
-{
-  double rect1Temp[6], rect2Temp[6];
-
-  rect1Temp[0] = rectin[0];
-  rect1Temp[1] = rectin[1];
-  rect1Temp[2] = rectin[2];
-  rect1Temp[3] = rectin[3]+rectin[0];
-  rect1Temp[4] = rectin[4]+rectin[1];
-  rect1Temp[5] = rectin[5]+rectin[2];
-
-  rect2Temp[0] = rectinout[0];
-  rect2Temp[1] = rectinout[1];
-  rect2Temp[2] = rectinout[2];
-  rect2Temp[3] = rectinout[3]+rectinout[0];
-  rect2Temp[4] = rectinout[4]+rectinout[1];
-  rect2Temp[5] = rectinout[5]+rectinout[2];
-
-  rectinout[0] = rect1Temp[0]>rect2Temp[0] ? rect1Temp[0]:rect2Temp[0];
-  rectinout[1] = rect1Temp[1]>rect2Temp[1] ? rect1Temp[1]:rect2Temp[1];
-  rectinout[2] = rect1Temp[2]>rect2Temp[2] ? rect1Temp[2]:rect2Temp[2];
-  rectinout[3] = rect1Temp[3]<rect2Temp[3] ? rect1Temp[3]:rect2Temp[3];
-  rectinout[4] = rect1Temp[4]<rect2Temp[4] ? rect1Temp[4]:rect2Temp[4];
-  rectinout[5] = rect1Temp[5]<rect2Temp[5] ? rect1Temp[5]:rect2Temp[5];
-
-  rectinout[3] = rectinout[3] - rectinout[0];
-  rectinout[4] = rectinout[4] - rectinout[1];
-  rectinout[5] = rectinout[5] - rectinout[2];
-
-  if ( rectinout[3]<=0 || rectinout[4]<=0 || rectinout[5]<=0 ) return 0;
+ */
+static
+int MMG3D_splitPROctree(MMG5_pMesh mesh,MMG3D_pPROctree q,MMG5_int c) {
+  MMG5_int g,b,no;
+  int      i,depth;
+  int64_t  key;
+
+  g = MMG3D_newPROctreeCells(mesh,q);
+  if ( !g ) return 0;
+
+  depth = q->cell[c].depth;
+  for ( i=0; i<8; ++i ) {
+    q->cell[g+i].child = 0;
+    q->cell[g+i].blk   = 0;
+    q->cell[g+i].nbVer = 0;
+    q->cell[g+i].depth = depth+1;
+  }
+
+  /* a leaf is subdivided when it is full so its list has 1 block */
+  assert ( q->cell[c].nbVer == q->nv );
+  b = q->cell[c].blk;
+  for ( i=0; i<q->nv; ++i ) {
+    no  = MMG3D_PROctreeBlock(q,b)[i];
+    key = MMG3D_getPROctreeCoordinate(q,mesh->point[no].c,mesh->dim);
+    if ( !MMG3D_leafAddPROctree(mesh,q,g+MMG3D_PROctreeChild(key,depth),no) )
+      return 0;
+  }
+  q->blknxt[b]     = q->blkfree;
+  q->blkfree       = b;
+  q->cell[c].blk   = 0;
+  q->cell[c].child = g;
 
   return 1;
 }
 
 /**
- * \param q pointer to the PROctree cell.
- * \param center coordinates of the centre of the current subtree.
- * \param rect rectangle that we want to intersect with the subtree. We define
- * it given: the coordinates of one corner of the rectange and the length of
- * the rectangle in each dimension.
- * \param qlist pointer to the list of pointer over the sub PROctrees that
- *  intersect \a rect.
- * \param dist pointer to the list of distances between center of
- * the PROctree cells in qlist and the last 3 elements are the coordinates
- * of the center of the whole recangle.
- * \param ani metric of the point.
- * \param l0 radius of the search zone.
- * \param nc number max of cell in the list +3 (the three last.
- * \param dim dimension =3.
- * \param index number of PROctree cells that intersect \a rect
- *
- * \return 0 if the rectangle doesn't intersect the PROctree (possible due to the
- * surface reconstruction), 1 otherwise.
+ * \param mesh pointer to the mesh structure.
+ * \param q pointer to the global PROctree.
+ * \param c index of a cell.
+ * \param b vertex block in which the vertices of the subtree are gathered.
+ * \param n number of vertices already stored in \a b.
+ * \return the number of vertices stored in \a b.
  *
- * List the number of PROctree cells that intersect the rectangle
- * \a rect. To avoid counting of the cells, a maximum is set.
+ * Move the vertices of the subtree of \a c into the block \a b and free the
+ * cells and blocks of the subtree.
  *
  */
-int MMG3D_getListSquareRec(MMG3D_PROctree_s* q, double* center, double* rect,
-                            MMG3D_PROctree_s*** qlist, double* dist, double* ani,
-                           double l0, int nc, int dim, int* index)
-{
-  double recttemp[6];
-  double centertemp[3];
-  int    recCenter[6];
-  double l = 1./(1<<(q->depth+1));
-  double distTemp;
-  double x,y,z;
-  int indexTemp,i,j,k,nBranch;
-
-  // number max of PROctree cells listed for one search
-  if ((*index)>nc-4)
-    return 1;
-
-  // check if the current cell is included in the search zone, can avoid
-  // the loop over the vertices. Never occured in tests unless nc==4, in that
-  // case, there is no gain in computing time.
-  //~ if (q->nbVer>0 && MMG3D_isCellIncluded(center, l, &(dist[nc-3]), l0))
-  //~ {
-    //~ (*index)=nc-3;
-    //~ fprintf(stdout,"Included cell found\n");
-    //~ return;
-  //~ }
-
-  assert ( nc>= 3 );
-  if (q->branches==NULL && q->v != NULL)
-  {
-    // the vector dist is of size nc whereas qlist allows nc-3 inputs
-    // so the 3 last values can contain the coordinates of the center
-    // of the search volume.
-    x = dist[nc-3] - center[0];
-    y = dist[nc-2] - center[1];
-    z = dist[nc-1] - center[2];
-
-    // Should be replaced with distance in metric?
-    distTemp = x*x+y*y+z*z;
-
-    // Here the anisotropic distance not tested (not so important, this only
-    // reorders the cells)
-    //~ distTemp = ani[0]*x*x+ani[3]*y*y+ani[5]*z*z+
-                //~ 2*(ani[1]*x*y+ani[2]*x*z+ani[4]*y*z);
-    if (*index > 0)
-    {
-      indexTemp = MMG3D_seekIndex(dist,distTemp,0, *index-1);
-      if (indexTemp+1<*index)
-      {
-        MMG3D_placeInListDouble(dist, distTemp, indexTemp, *index);
-        MMG3D_placeInListPROctree((*qlist), q, indexTemp, *index);
-      }else
-      {
-        dist[*index]=distTemp;
-        (*qlist)[*index]=q;
-      }
-    }
-    else
-    {
-      dist[*index]=distTemp;
-      (*qlist)[*index]=q;
-    }
-
-    (*index)++;
-
-  }else if (q->branches!=NULL)
-  {
-
-    // check the position of the search zone in the current cell
-    for (i=0;i<3;i++)
-    {
-      recCenter[i] = (rect[i]>center[i]);
-      recCenter[i+3] = ((rect[i]+rect[i+3])>center[i]);
-    }
-
-    // three loop describing the 8 branches in binary (k,j,i):(0,0,0),(0,0,1)....(1,1,1)
-    for(i=0;i<2;i++)
-    {
-      for(j=0;j<2;j++)
-      {
-        for(k=0;k<2;k++)
-        {
-          // test if that branch intersects the rectangle
-          if (((i && recCenter[3]) || (!i && !recCenter[0])) &&
-              ((j && recCenter[4]) || (!j && !recCenter[1]))&&
-              ((k && recCenter[5]) || (!k && !recCenter[2])))
-          {
-            // set the branch number
-            nBranch = i+2*j+4*k;
-
-            // set recttemp to the cell size of the branch nBranch
-            recttemp[0] = center[0]-l*(1-i);
-            recttemp[1] = center[1]-l*(1-j);
-            recttemp[2] = center[2]-l*(1-k);
-            recttemp[3] = recttemp[4] = recttemp[5] = l;
-            // intersect the rectangle and the cell and store it in recttemp
-            if ( !MMG3D_intersectRect(rect,recttemp) ) return 0;
-
-            // set the new center
-            centertemp[0] = center[0]-l/2+i*l;
-            centertemp[1] = center[1]-l/2+j*l;
-            centertemp[2] = center[2]-l/2+k*l;
-
-            // recursive call in the branch
-            if ( !MMG3D_getListSquareRec(&(q->branches[nBranch]),
-                                          centertemp, recttemp, qlist, dist,
-                                          ani, l0, nc, dim, index) )
-              return 0;
-          }
-        }
-      }
+static
+int MMG3D_gatherPROctree(MMG3D_pPROctree q,MMG5_int c,MMG5_int b,int n) {
+  MMG3D_PROctree_s *cell;
+  MMG5_int         bb;
+  int              i;
+
+  cell = &q->cell[c];
+  if ( cell->child ) {
+    for ( i=0; i<8; ++i ) {
+      n = MMG3D_gatherPROctree(q,cell->child+i,b,n);
     }
+    q->cell[cell->child].child = q->cellfree;
+    q->cellfree = cell->child;
+    cell->child = 0;
   }
-  return 1;
+  else if ( cell->nbVer ) {
+    /* a leaf of a subtree of less than nv vertices has only 1 block */
+    bb = cell->blk;
+    memcpy(MMG3D_PROctreeBlock(q,b)+n,MMG3D_PROctreeBlock(q,bb),
+           cell->nbVer*sizeof(MMG5_int));
+    n += cell->nbVer;
+    q->blknxt[bb] = q->blkfree;
+    q->blkfree    = bb;
+    cell->blk     = 0;
+  }
+  return n;
 }
 
 /**
- * \param mesh pointer to the mesh structure
- * \param ani metric to use for the cell ordering from closest to farthest
- * \param q pointer to the global PROctree structure.
- * \param rect rectangle that we want to intersect with the subtree. We define
- * it given: the coordinates of one corner of the rectangle and the length of
- * the rectangle in each dimension.
- * \param qlist pointer to the list of pointer over the sub PROctrees that
- *  intersect \a rect.
- *
- * \return index, the number of subtrees in the list
- * \return  -1 if fail due to lack of memory.
+ * \param mesh pointer to the mesh structure.
+ * \param q pointer to the global PROctree.
+ * \param c index of the cell to merge.
+ * \return 1 if ok 0 if memory saturated
  *
- * List the number of PROctree cells that intersect the rectangle \a rect.
+ * Merge the subtree of the cell \a c (that counts no more than nv vertices)
+ * into a leaf.
  *
  */
-int MMG3D_getListSquare(MMG5_pMesh mesh, double* ani, MMG3D_pPROctree q, double* rect,
-                         MMG3D_PROctree_s*** qlist)
-{
-  double rect2[6], center[3], *dist;
-  double l0;
-  int    i,index,dim;
-
-  dim = mesh->dim;
-  index = 0;
+static
+int MMG3D_mergePROctree(MMG5_pMesh mesh,MMG3D_pPROctree q,MMG5_int c) {
+  MMG5_int b;
+  int      n;
 
-  memcpy(&rect2, rect, sizeof(double)*dim*2);
+  assert ( q->cell[c].nbVer <= q->nv );
 
-  //instead of counting exactly the number of cells to be listed, the
-  //maximum size is set to nc-3 (so the list dist can have nc-3 values + 3 coordinates of
-  //the center of the rectangle)
-  assert(q->nc>=3);
-  index = q->nc-3;
+  b = MMG3D_newPROctreeBlock(mesh,q);
+  if ( !b ) return 0;
 
-  MMG5_ADD_MEM(mesh,index*sizeof(MMG3D_PROctree_s*),"PROctree cell",return -1);
-  MMG5_SAFE_MALLOC(*qlist,index,MMG3D_PROctree_s*, return -1);
+  n = MMG3D_gatherPROctree(q,c,b,0);
+  assert ( n == q->cell[c].nbVer );
 
-  MMG5_ADD_MEM(mesh,q->nc*sizeof(double),"dist array",return -1);
-  MMG5_SAFE_MALLOC(dist,q->nc,double,return -1);
-
-  // Set the center of the zone search
-  dist[q->nc-3] = rect[0]+rect[3]/2;
-  dist[q->nc-2] = rect[1]+rect[4]/2;
-  dist[q->nc-1] = rect[2]+rect[5]/2;
-
-  // Set the radius of the zone search (used for cell inclusion test if activated)
-  l0 = rect[3]/2;
-
-  // Initialization of the PROctree cell list
-  for (i = 0; i<index; i++)
-    (*qlist)[i] = NULL;
-
-  index = 0;
-
-  // Set center of the first PROctree cell
-  for (i = 0; i < dim; ++i)
-    center[i] = 0.5;
-
-  // Avoid modification of input parameter rect
-  memcpy(&rect2, rect, sizeof(double)*dim*2);
-
-  if ( !MMG3D_getListSquareRec(q->q0, center, rect2, qlist, dist, ani, l0,
-                                q->nc, dim, &index) ) {
-    MMG5_DEL_MEM(mesh,dist);
-    return 0;
+  if ( n ) {
+    q->blknxt[b]   = 0;
+    q->cell[c].blk = b;
   }
-
-
-  if (index>q->nc-4)
-  {
-    MMG5_DEL_MEM(mesh,dist);
-    return 0;
+  else {
+    q->blknxt[b] = q->blkfree;
+    q->blkfree   = b;
   }
-
-  MMG5_DEL_MEM(mesh,dist);
-
-  return index;
+  return 1;
 }
 
 /**
  * \param mesh pointer to the mesh structure.
- * \param q pointer to an PROctree cell.
- * \param ver vertex coordinates scaled such that the quadrant is [0;1]x[0;1]x[0;1]
- * \param no vertex index in the mesh.
- * \param nv maximum number of points in an PROctree cell.
+ * \param q pointer to the global PROctree
+ * \param nv maximum number of vertices in each cell before subdivision
  * \return 1 if ok 0 if memory saturated
  *
- * Add vertex in the suitable quadrant of the PROctree. This function is
- * recursively called until we reach the last one. At each step, the vertex
- * coordinates are scaled such as the quadrant is the [0;1]x[0;1]x[0;1] box.
+ * Initialisation of the PROctree cell.
  *
  */
-int MMG3D_addPROctreeRec(MMG5_pMesh mesh, MMG3D_PROctree_s* q, double* ver,
-                         const MMG5_int no, int nv)
+int MMG3D_initPROctree(MMG5_pMesh mesh,MMG3D_pPROctree* q, int nv)
 {
-  double   pt[3],quadrant;
-  int      dim, nbBitsInt,depthMax,i,j,k;
-  int      sizBr;
-  int      sizeRealloc;
-
-  nbBitsInt = sizeof(int64_t)*8;
-  dim       = mesh->dim;
-  depthMax  = nbBitsInt/dim - 1; // maximum depth is to allow integer coordinates
-  sizBr     = 1<<dim;
+  MMG5_int i,nc,nb;
 
-  if ( q->depth < depthMax ) // not at the maximum depth of the tree
-  {
-    if (q->nbVer < nv)  // not at the maximum number of vertice in the cell
-    {
-
-      if(q->nbVer == 0)  // first vertex list allocation
-      {
-        MMG5_ADD_MEM(mesh,sizeof(MMG5_int),"PROctree vertice table", return 0);
-        MMG5_SAFE_MALLOC(q->v,1,MMG5_int,return 0);
-      }
-      else if(!(q->nbVer & (q->nbVer - 1))) //is a power of 2 -> reallocation of the vertex list
-      {
-        sizeRealloc = q->nbVer;
-        sizeRealloc<<=1;
-        MMG5_ADD_MEM(mesh,(sizeRealloc-sizeRealloc/2)*sizeof(MMG5_int),"PROctree realloc",
-                      return 0);
-        MMG5_SAFE_REALLOC(q->v,q->nbVer,sizeRealloc,MMG5_int,"PROctree",return 0);
-      }
-
-      q->v[q->nbVer] = no;
-      q->nbVer++;
-      return 1;
-    }
-    else if (q->nbVer == nv && q->branches==NULL)  //vertex list at maximum -> cell subdivision
-    {
-      /* creation of sub-branch and relocation of vertices in the sub-branches */
-      MMG5_ADD_MEM(mesh,sizBr*sizeof(MMG3D_PROctree_s),"PROctree branches",
-                    return 0);
-      MMG5_SAFE_MALLOC(q->branches,sizBr,MMG3D_PROctree_s,return 0);
+  MMG5_ADD_MEM(mesh,sizeof(MMG3D_PROctree),"PROctree structure",
+                return 0);
+  MMG5_SAFE_CALLOC(*q,1, MMG3D_PROctree, return 0);
 
-      for ( i = 0; i<sizBr; i++)
-      {
-        MMG3D_initPROctree_s(&(q->branches[i]));
-        q->branches[i].depth = q->depth+1;
-      }
-      q->nbVer++;
-      for (i = 0; i<nv; i++)
-      {
 
-        memcpy(&pt, mesh->point[q->v[i]].c ,dim*sizeof(double));
-        for ( j =0; j < q->depth; j++)
-        {
-          for (k = 0; k<dim; k++)
-          {
-            pt[k] -= ((double) (pt[k]>0.5))*0.5;
-            pt[k] *= 2;
-          }
-        }
-        if (!MMG3D_addPROctreeRec(mesh, q, pt, q->v[i],nv))
-          return 0;
-        q->nbVer--;
-      }
-      if (!MMG3D_addPROctreeRec(mesh, q, ver, no, nv))
-        return 0;
-      q->nbVer--;
-      MMG5_DEL_MEM(mesh,q->v);
+  // set nv to the next power of 2
+  nv--;
+  nv |= nv >> 1;
+  nv |= nv >> 2;
+  nv |= nv >> 4;
+  nv |= nv >> 8;
+  nv |= nv >> 16;
+  nv++;
+  (*q)->nv = nv;
 
-    }else // Recursive call in the corresponding sub cell
-    {
-      quadrant = 0.;
-      for ( i = 0; i<dim; i++)
-      {
-        quadrant += ((double) (ver[i]>0.5))*(1<<i);
-        ver[i] -= ((double) (ver[i]>0.5))*0.5;
-        ver[i] *= 2;
-      }
+  // Number maximum of cells listed for the zone search
+  (*q)->nc = MG_MAX(2048/nv,16);
 
-      q->nbVer++;
-      if (!MMG3D_addPROctreeRec(mesh, &(q->branches[(int)quadrant]), ver, no, nv))
-        return 0;
-    }
-  }else // maximum PROctree depth reached
-  {
-    if (q->nbVer < nv)
-    {
-      if(q->nbVer == 0) // first allocation
-      {
-        MMG5_ADD_MEM(mesh,sizeof(MMG5_int),"PROctree vertices table",
-                      return 0);
-        MMG5_SAFE_MALLOC(q->v,1,MMG5_int,return 0);
-      }
-      else if(!(q->nbVer & (q->nbVer - 1))) //is a power of 2 -> normal reallocation
-      {
-        sizeRealloc = q->nbVer;
-        sizeRealloc <<= 1;
-        MMG5_ADD_MEM(mesh,(sizeRealloc-sizeRealloc/2)*sizeof(MMG5_int),"PROctree realloc",
-                      return 0);
-        MMG5_SAFE_REALLOC(q->v,q->nbVer,sizeRealloc,MMG5_int,"PROctree",return 0);
-      }
-    }
-    else if (q->nbVer%nv == 0) // special reallocation of the vertex list because it is at maximum depth
-    {
-      MMG5_ADD_MEM(mesh,nv*sizeof(MMG5_int),"PROctree realloc",
-                    return 0);
-      MMG5_SAFE_REALLOC(q->v,q->nbVer,q->nbVer+nv,MMG5_int,"PROctree",return 0);
-    }
+  MMG5_ADD_MEM(mesh,(*q)->nc*(sizeof(MMG5_int)+sizeof(double)),
+               "PROctree search workspace",return 0);
+  MMG5_SAFE_MALLOC((*q)->lst,(*q)->nc,MMG5_int,return 0);
+  MMG5_SAFE_MALLOC((*q)->dist,(*q)->nc,double,return 0);
 
-    q->v[q->nbVer] = no;
-    q->nbVer++;
-  }
+  /* leaves are filled at about nv/2 vertices */
+  nb = 2*(mesh->np/nv) + 8;
+  nc = 2*nb + 1;
 
-  return 1;
-}
+  MMG5_ADD_MEM(mesh,nc*sizeof(MMG3D_PROctree_s),"PROctree cells",
+                return 0);
+  MMG5_SAFE_MALLOC((*q)->cell,nc, MMG3D_PROctree_s, return 0);
+  (*q)->ncellmax = nc;
+  (*q)->ncell    = 1;
+  (*q)->cellfree = 0;
+  memset(&(*q)->cell[0],0,sizeof(MMG3D_PROctree_s));
 
-/**
- * \param pointer to the mesh structure
- * \param q pointer to the global PROctree structure
- * \param no index of the point to add to the PROctree
- *
- * Add the vertex of index \a no to the PROctree.
- *
- */
-int MMG3D_addPROctree(MMG5_pMesh mesh, MMG3D_pPROctree q, const MMG5_int no)
-{
-  double    pt[3];
-  int       dim;
+  MMG5_ADD_MEM(mesh,nb*((size_t)nv+1)*sizeof(MMG5_int),"PROctree vertex blocks",
+                return 0);
+  MMG5_SAFE_MALLOC((*q)->v,(size_t)nv*nb,MMG5_int,return 0);
+  MMG5_SAFE_MALLOC((*q)->blknxt,nb+1,MMG5_int,return 0);
+  (*q)->nblkmax = nb;
+  (*q)->nblk    = 0;
+  (*q)->blkfree = 0;
 
-  dim = mesh->dim;
-  assert(no<=mesh->np);
-  memcpy(&pt, mesh->point[no].c ,dim*sizeof(double));
-  if (!MMG3D_addPROctreeRec(mesh, q->q0, pt , no, q->nv))
+  for (i=1;i<=mesh->np; ++i)
   {
-    return 0;
-  }
-
-  return 1;
-}
+    if ( !MG_VOK(&mesh->point[i]) )  continue;
+    if (mesh->point[i].tag & MG_BDY) continue;
 
-/**
- * \param q pointer to a terminal PROctree cell (containing vertex)
- * \param no index of the point to delete from the PROctree
- * \return 1 if ok 0 if memory saturated
- *
- * Delete the vertex of index \a no from the terminal PROctree cell, merge
- * the cells if necessary.
- *
- */
-int MMG3D_delPROctreeVertex(MMG5_pMesh mesh, MMG3D_PROctree_s* q, MMG5_int indNo)
-{
-  MMG5_int* vTemp;
-  int i;
-
-  assert(q->v);
-  assert(q->nbVer>indNo);
-  for(i=0; i<q->nbVer; ++i)
-    assert(q->v[i]>0);
-  memmove(&q->v[indNo],&q->v[indNo+1], (q->nbVer-indNo-1)*sizeof(MMG5_int));
-  --(q->nbVer);
-  if (!(q->nbVer & (q->nbVer - 1)) && q->nbVer > 0) // is a power of 2
-  {
-    MMG5_ADD_MEM(mesh,q->nbVer*sizeof(MMG5_int),"PROctree index",
-                  return 0);
-    MMG5_SAFE_MALLOC(vTemp,q->nbVer,MMG5_int,return 0);
-    memcpy(vTemp, q->v,q->nbVer*sizeof(MMG5_int));
-    MMG5_DEL_MEM(mesh,q->v);
+    if(!MMG3D_addPROctree(mesh, (*q), i))
+      return 0;
 
-    q->v = vTemp;
   }
   return 1;
 }
 
 /**
- * \param q0 pointer to an PROctree cell.
- * \param q pointer to an PROctree cell.
- * \param dim dimension of the space (=3).
- * \param nv maximum number of points in an PROctree cell.
- * \param index next index in the array to be filled.
+ * \param mesh pointer to the mesh structure.
+ * \param q pointer to a pointer to the global PROctree.
  *
- * Merge sub-branches \a q of \a q0, in their parent \a q0. \a q0 should
- * contain no more than nv vertices.
+ * Free the global PROctree structure.
  *
  */
-void MMG3D_mergeBranchesRec(MMG3D_PROctree_s* q0, MMG3D_PROctree_s* q, int dim, int nv, int* index)
+void MMG3D_freePROctree(MMG5_pMesh mesh,MMG3D_pPROctree *q)
 {
-  int i;
-
-  if (q->v != NULL)
-  {
-
-    assert(*index+q->nbVer<=nv);
-
-    memcpy(&(q0->v[*index]), q->v, q->nbVer*sizeof(MMG5_int));
-    (*index)+= q->nbVer;
-    for(i = 0; i<(*index); ++i)
-      assert(q0->v[i]>0);
-  }else if (q->branches != NULL)
-  {
-    for (i = 0; i<(1<<dim); ++i)
-      MMG3D_mergeBranchesRec(q0, &(q->branches[i]), dim, nv, index);
+  if ( (*q)->cell ) {
+    MMG5_DEL_MEM(mesh,(*q)->cell);
+  }
+  if ( (*q)->v ) {
+    MMG5_DEL_MEM(mesh,(*q)->v);
+  }
+  if ( (*q)->blknxt ) {
+    MMG5_DEL_MEM(mesh,(*q)->blknxt);
+  }
+  if ( (*q)->lst ) {
+    MMG5_DEL_MEM(mesh,(*q)->lst);
   }
+  if ( (*q)->dist ) {
+    MMG5_DEL_MEM(mesh,(*q)->dist);
+  }
+  MMG5_DEL_MEM(mesh,*q);
+  *q = NULL;
 }
 
 /**
  * \param mesh pointer to the mesh structure.
- * \param q pointer to an PROctree cell.
- * \param dim dimension of the space (=3)
- * \param nv maximum number of points in an PROctree cell.
+ * \param q pointer to the global PROctree.
+ * \param no index of the vertex to add.
+ * \param key Morton key of the vertex.
+ * \return 1 if ok 0 if memory saturated
  *
- * Merge branches that have a parent counting less than nv vertices.
+ * Add the vertex \a no in the leaf of the PROctree that contains \a key,
+ * subdividing the full leaves on the way.
  *
  */
-void MMG3D_mergeBranches(MMG5_pMesh mesh,MMG3D_PROctree_s* q, int dim, int nv)
-{
-  int index;
-  int i;
-
-  index = 0;
-  assert(q->v);
-  assert(q->branches);
-  assert(q->nbVer==nv);
-
-  for (i = 0; i<(1<<dim); ++i)
-  {
-    MMG3D_mergeBranchesRec(q, &(q->branches[i]), dim, nv, &index);
-    MMG3D_freePROctree_s(mesh,&(q->branches[i]), nv);
+static
+int MMG3D_addPROctreeKey(MMG5_pMesh mesh,MMG3D_pPROctree q,const MMG5_int no,
+                          int64_t key) {
+  MMG3D_PROctree_s *cell;
+  MMG5_int         c;
+
+  c = 0;
+  while ( 1 ) {
+    cell = &q->cell[c];
+    if ( !cell->child ) {
+      if ( cell->nbVer < q->nv || cell->depth >= MMG3D_PROCTREE_DMAX ) {
+        return MMG3D_leafAddPROctree(mesh,q,c,no);
+      }
+      /* vertex list at maximum: cell subdivision */
+      if ( !MMG3D_splitPROctree(mesh,q,c) ) return 0;
+      cell = &q->cell[c];
+    }
+    ++cell->nbVer;
+    c = cell->child + MMG3D_PROctreeChild(key,cell->depth);
   }
-  MMG5_DEL_MEM(mesh,q->branches);
+  return 1;
 }
 
 /**
  * \param mesh pointer to the mesh structure.
- * \param q pointer to an PROctree cell.
- * \param ver vertex coordinates scaled such that the quadrant is [0;1]x[0;1]x[0;1]
- * \param no vertex index in the mesh.
- * \param nv maximum number of points in an PROctree cell.
+ * \param q pointer to the global PROctree.
+ * \param no index of the vertex to delete.
+ * \param key Morton key of the vertex.
  * \return 1 if ok 0 if memory saturated
  *
- * Delete vertex \a no from the PROctree. This function is recursively
- * called until we reach the terminal PROctree cell containing the vertex
- * \a no. At each step, the vertex coordinates are scaled such as the
- * quadrant is the [0;1]x[0;1]x[0;1] box.
+ * Delete the vertex \a no from the leaf of the PROctree that contains \a key
+ * and merge the highest cell of its path that counts no more than nv vertices.
  *
  */
-int MMG3D_delPROctreeRec(MMG5_pMesh mesh, MMG3D_PROctree_s* q, double* ver, const MMG5_int no, const int nv)
-{
-  double quadrant;
-  int i;
-  int dim = mesh->dim;
-  int nbVerTemp;
-
-  if (q->v)
-  {
-    for ( i = 0; i<q->nbVer; ++i)
-    {
-      if (q->v[i] == no)
-      {
-        if (!MMG3D_delPROctreeVertex(mesh, q, i))
-          return 0;
-        if ( q->nbVer == 0)
-        {
-          MMG5_DEL_MEM(mesh,q->v);
-        }
-        break;
-      }
-    }
-
-  }else if ( q->nbVer == nv+1)
-  {
-    quadrant = 0.;
-    for ( i = 0; i<dim; ++i)
-    {
-      quadrant += ((double) (ver[i]>0.5))*(1<<i);
-      ver[i] -= ((double) (ver[i]>0.5))*0.5;
-      ver[i] *= 2;
-    }
-    --q->nbVer;
-    nbVerTemp = q->branches[(int)quadrant].nbVer;
+static
+int MMG3D_delPROctreeKey(MMG5_pMesh mesh,MMG3D_pPROctree q,const MMG5_int no,
+                          int64_t key) {
+  MMG3D_PROctree_s *cell;
+  MMG5_int         c,path[MMG3D_PROCTREE_DMAX+1];
+  int              i,n;
+
+  c = 0;
+  n = 0;
+  while ( q->cell[c].child ) {
+    cell      = &q->cell[c];
+    path[n++] = c;
+    c = cell->child + MMG3D_PROctreeChild(key,cell->depth);
+  }
 
-    // warning: calling recursively here is not optimal
-    if(!MMG3D_delPROctreeRec(mesh, &(q->branches[(int)quadrant]), ver, no, nv))
-      return 0;
+  if ( !MMG3D_leafDelPROctree(q,c,no) ) return 1;
 
-    if (nbVerTemp > q->branches[(int)quadrant].nbVer)
-    {
-      MMG5_ADD_MEM(mesh,nv*sizeof(MMG5_int),"PROctree vertices table",
-                    return 0);
-      MMG5_SAFE_MALLOC(q->v,nv,MMG5_int,return 0);
-      MMG3D_mergeBranches(mesh,q,dim,nv);
-    }else
-    {
-      ++q->nbVer;
-    }
-
-  }else if (q->branches != NULL)
-  {
-    quadrant = 0.;
-    for ( i = 0; i<dim; ++i)
-    {
-      quadrant += ((double) (ver[i]>0.5))*(1<<i);
-      ver[i] -= ((double) (ver[i]>0.5))*0.5;
-      ver[i] *= 2;
-    }
-
-    --q->nbVer;
-    nbVerTemp = q->branches[(int)quadrant].nbVer;
-    if(!MMG3D_delPROctreeRec(mesh, &(q->branches[(int)quadrant]), ver, no, nv))
-      return 0;
-    if (nbVerTemp <= q->branches[(int)quadrant].nbVer) // test if deletion worked
-    {
-      ++q->nbVer;
+  for ( i=0; i<n; ++i ) {
+    --q->cell[path[i]].nbVer;
+  }
+  for ( i=0; i<n; ++i ) {
+    if ( q->cell[path[i]].nbVer <= q->nv ) {
+      return MMG3D_mergePROctree(mesh,q,path[i]);
     }
   }
   return 1;
@@ -968,162 +542,170 @@ int MMG3D_delPROctreeRec(MMG5_pMesh mesh, MMG3D_PROctree_s* q, double* ver, cons
 /**
  * \param mesh pointer to the mesh structure.
  * \param q pointer to the global PROctree.
- * \param no reference of the vertex to be deleted.
+ * \param no index of the moved point.
+ * \param newVer new coordinates for the moved point.
+ * \param oldVer old coordinates for the moved point.
  * \return 1 if ok 0 if memory saturated
  *
- * Delete the vertex \a no from the PROctree structure.
+ * Move one point in the PROctree structure. /!\ the vertex of index \a no
+ * can have either the new or the old coordinates in the mesh but all
+ * other vertice should have the same coordinates as when they were inserted
+ * into the PROctree. (ie: one move at a time in the mesh and the PROctree)
  *
  */
-int MMG3D_delPROctree(MMG5_pMesh mesh, MMG3D_pPROctree q, const int no)
+int MMG3D_movePROctree(MMG5_pMesh mesh, MMG3D_pPROctree q, MMG5_int no, double* newVer, double* oldVer)
 {
-  double pt[3];
-  int    dim;
+  int64_t oldCoor, newCoor;
+  int     dim;
 
   dim = mesh->dim;
 
-  assert(MG_VOK(&mesh->point[no]));
+  oldCoor = MMG3D_getPROctreeCoordinate(q, oldVer, dim);
+  newCoor = MMG3D_getPROctreeCoordinate(q, newVer, dim);
 
-  memcpy(&pt, mesh->point[no].c ,dim*sizeof(double));
-  if(!MMG3D_delPROctreeRec(mesh, q->q0, pt , no, q->nv))
-  {
-    return 0;
+  if (newCoor == oldCoor) {
+    return 1;
   }
-  return 1;
-}
 
+  if ( !MMG3D_delPROctreeKey(mesh,q,no,oldCoor) )
+    return 0;
+
+  return MMG3D_addPROctreeKey(mesh,q,no,newCoor);
+}
 
 /**
- * \param q pointer to an PROctree cell
- * \param depth depth of the subtree
- * \param nv number of vertices in the subtree
- * \param dim dimension in which we work
+ * \param mesh pointer to the mesh structure (unused).
+ * \param q pointer to the global PROctree structure.
+ * \param rect rectangle that we want to intersect with the subtree. We define
+ * it given: the coordinates of one corner of the rectangle and the length of
+ * the rectangle in each dimension.
  *
- * Print the depth \a depth of the subtree of \a q.
+ * \return index, the number of non empty leaves in the list \a q->lst, 0 if
+ * the rectangle doesn't intersect the PROctree (possible due to the surface
+ * reconstruction) or if it intersects too many leaves.
+ *
+ * List the non empty leaves of the PROctree that intersect the rectangle \a
+ * rect, sorted from the closest to the farthest of the rectangle center.
  *
- * \warning debug function, not safe
  */
-void MMG3D_printArbreDepth(MMG3D_PROctree_s* q, int depth, int nv, int dim)
+int MMG3D_getListSquare(MMG5_pMesh mesh, MMG3D_pPROctree q, double* rect)
 {
-  int i;
-  if ( q->depth < depth && q->nbVer > nv)
-  {
+  MMG3D_PROctree_s *cell;
+  MMG5_int         c,stack[8*(MMG3D_PROCTREE_DMAX+1)];
+  int64_t          lo[3],hi[3],org[3*8*(MMG3D_PROCTREE_DMAX+1)],o[3],co[3],len,h;
+  double           ctr[3],d,x,y,z,scal;
+  int              i,j,n,index,nmax;
+
+  (void)mesh;
+
+  // the search zone is out of the PROctree
+  if ( q->cell[0].child ) {
+    for ( i=0; i<3; ++i ) {
+      if ( rect[i+3] <= 0. || rect[i]+rect[i+3] <= 0. || rect[i] >= 1. ) return 0;
+    }
+  }
 
-    for (i = 0; i < (1<<dim); i++)
-    {
-      MMG3D_printArbreDepth(&(q->branches[i]),depth, nv, dim);
+  for ( i=0; i<3; ++i ) {
+    lo[i]  = MMG3D_PROctreeInt(rect[i]);
+    hi[i]  = MMG3D_PROctreeInt(rect[i]+rect[i+3]);
+    ctr[i] = rect[i]+rect[i+3]/2;
+  }
+
+  scal  = 1./(double)(1<<MMG3D_PROCTREE_DMAX);
+  nmax  = q->nc-3;
+  index = 0;
+
+  n = 0;
+  stack[n] = 0;
+  org[0] = org[1] = org[2] = 0;
+  ++n;
+
+  while ( n ) {
+    --n;
+    c    = stack[n];
+    cell = &q->cell[c];
+    o[0] = org[3*n];
+    o[1] = org[3*n+1];
+    o[2] = org[3*n+2];
+    len  = (int64_t)1 << (MMG3D_PROCTREE_DMAX-cell->depth);
+
+    if ( !cell->child ) {
+      if ( !cell->nbVer ) continue;
+
+      // number max of PROctree cells listed for one search
+      if ( index == nmax-1 ) return 0;
+
+      x = (o[0]+0.5*len)*scal - ctr[0];
+      y = (o[1]+0.5*len)*scal - ctr[1];
+      z = (o[2]+0.5*len)*scal - ctr[2];
+      d = x*x+y*y+z*z;
+
+      // insertion in the list sorted by increasing distances
+      for ( j=index; j>0 && q->dist[j-1] > d; --j ) {
+        q->dist[j] = q->dist[j-1];
+        q->lst[j]  = q->lst[j-1];
+      }
+      q->dist[j] = d;
+      q->lst[j]  = c;
+      ++index;
+      continue;
+    }
+
+    // push the children that intersect the rectangle
+    h = len >> 1;
+    for ( i=0; i<8; ++i ) {
+      for ( j=0; j<3; ++j ) {
+        co[j] = o[j] + ((i>>j)&1)*h;
+        if ( co[j] > hi[j] || co[j]+h-1 < lo[j] ) break;
+      }
+      if ( j<3 ) continue;
+
+      stack[n]     = cell->child+i;
+      org[3*n]     = co[0];
+      org[3*n+1]   = co[1];
+      org[3*n+2]   = co[2];
+      ++n;
     }
-  }else if (q->depth == depth)
-  {
-    fprintf(stdout,"%i ",q->nbVer);
   }
+  return index;
 }
 
 /**
+ * \param pointer to the mesh structure
  * \param q pointer to the global PROctree structure
+ * \param no index of the point to add to the PROctree
  *
- * Print the PROctree.
- *
- * \warning debug function, not safe
+ * Add the vertex of index \a no to the PROctree.
  *
  */
-void MMG3D_printArbre(MMG3D_pPROctree q)
+int MMG3D_addPROctree(MMG5_pMesh mesh, MMG3D_pPROctree q, const MMG5_int no)
 {
-  int dim;
+  int64_t key;
 
-  dim = 3;
-  int i;
-  for (i = 0; i<(int)sizeof(int)*8/dim; i++)
-  {
-    fprintf(stdout,"\n depth %i \n", i);
-    MMG3D_printArbreDepth(q->q0, i, q->nv, dim);
+  assert(no<=mesh->np);
+  key = MMG3D_getPROctreeCoordinate(q,mesh->point[no].c,mesh->dim);
 
-  }
-  fprintf(stdout,"\n end \n");
+  return MMG3D_addPROctreeKey(mesh,q,no,key);
 }
 
 /**
- * \param q pointer to an PROctree cell
- * \param nv maximum number of vertices in an PROctree leaf
- * \param dim spacial dimension
- *
- * Print the PROctree.
+ * \param mesh pointer to the mesh structure.
+ * \param q pointer to the global PROctree.
+ * \param no reference of the vertex to be deleted.
+ * \return 1 if ok 0 if memory saturated
  *
- * \warning debug function, not safe
+ * Delete the vertex \a no from the PROctree structure.
  *
  */
-void MMG3D_printSubArbre(MMG3D_PROctree_s* q, int nv, int dim)
+int MMG3D_delPROctree(MMG5_pMesh mesh, MMG3D_pPROctree q, const int no)
 {
-  int i;
-  for (i = 0; i<(int)sizeof(int)*8/dim; i++)
-  {
-    fprintf(stdout,"\n depth %i \n", i);
-    MMG3D_printArbreDepth(q, i, nv, dim);
+  int64_t key;
 
-  }
-  fprintf(stdout,"\n end \n");
-}
+  assert(MG_VOK(&mesh->point[no]));
 
+  key = MMG3D_getPROctreeCoordinate(q,mesh->point[no].c,mesh->dim);
 
-/**
- * \param q pointer to an PROctree cell
- * \param nv maximum number of vertices in an PROctree leaf
- * \param dim dimension in which we work
- * \param s size of the PROctree
- *
- * Print the memory size of the PROctree.
- *
- * \warning debug function, not safe
- */
-void MMG3D_sizeArbreRec(MMG3D_PROctree_s* q, int nv, int dim,int* s1, int* s2)
-{
-  int i;
-  int nVer;
-  if (q->branches != NULL)
-  {
-    for (i= 0; i <(1<<dim); i++)
-    {
-      MMG3D_sizeArbreRec(&(q->branches[i]),nv,dim, s1, s2);
-      (*s1) +=(int)( sizeof(MMG3D_PROctree_s)+(1<<dim)*sizeof(MMG3D_PROctree_s*));
-    }
-  }else if(q->v != NULL)
-  {
-    // rounding up to the next higher power of 2
-    nVer = q->nbVer;
-    nVer--;
-    nVer |= nVer >> 1;
-    nVer |= nVer >> 2;
-    nVer |= nVer >> 4;
-    nVer |= nVer >> 8;
-    nVer |= nVer >> 16;
-    nVer++;
-    nVer = (nVer < nv) ? nVer : (int)(((q->nbVer-0.1)/nv+1)*nv);
-    (*s2) += nVer*sizeof(MMG5_int);
-    (*s1) += sizeof(MMG3D_PROctree_s);
-  }else
-  {
-    (*s1) += sizeof(MMG3D_PROctree_s);
-  }
-}
-
-/**
- * \param q pointer to the global PROctree structure
- * \param dim dimension in which we work
- *
- * \return the size of the tree or NULL pointer if fail
- *
- * Print the PROctree memory size.
- *
- * \warning debug function, not safe
- *
- */
-int* MMG3D_sizeArbre(MMG3D_pPROctree q,int dim)
-{
-  int *s;
-  MMG5_SAFE_MALLOC(s,2, int,return 0);
-  s[0] = 0;
-  s[1] = 0;
-  MMG3D_sizeArbreRec(q->q0, q->nv, dim, &s[0], &s[1]);
-  return s;
+  return MMG3D_delPROctreeKey(mesh,q,no,key);
 }
 
 /**
@@ -1133,8 +715,7 @@ int* MMG3D_sizeArbre(MMG3D_pPROctree q,int dim)
  * \param ip index of point to check.
  * \param lmax threshold to check minimal distance between points.
  *
- * \return 1 if we can insert \a ip, 0 if we cannot insert the point
- * \return -1 if fail because of memory.
+ * \return 1 if we can insert \a ip, 0 if we cannot insert the point.
  *
  * Check if the vertex \a ip is not too close from another one (for an isotropic
  * metric).
@@ -1142,22 +723,13 @@ int* MMG3D_sizeArbre(MMG3D_pPROctree q,int dim)
  */
 int MMG3D_PROctreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,MMG3D_pPROctree PROctree,MMG5_int ip,double lmax) {
   MMG5_pPoint      ppt,pp1;
-  MMG3D_PROctree_s **lococ;
+  MMG3D_PROctree_s *cell;
   double           d2,ux,uy,uz,hpi,hp1,hpi2,methalo[6];
-  int              i,j;
-  MMG5_int         ip1;
+  int              i,j,n;
+  MMG5_int         ip1,b,*v;
   int              ncells;
-  double           ani[6];
   //double          dmax;
 
-  ani[0] = sol->m[ip];
-  ani[3] = sol->m[ip];
-  ani[5] = sol->m[ip];
-  ani[1] = 0;
-  ani[2] = 0;
-  ani[4] = 0;
-
-  lococ = NULL;
   ppt = &mesh->point[ip];
   // dmax = MG_MAX(0.1,2-lmax);
   //hpi = dmax*sol->m[ip];
@@ -1172,39 +744,38 @@ int MMG3D_PROctreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,MMG3D_pPROctree PROctree,
   methalo[2] = ppt->c[2] - hpi;
   methalo[3] = methalo[4] = methalo[5] = 2.*hpi;
 
-  ncells = MMG3D_getListSquare(mesh, ani, PROctree, methalo, &lococ);
-  if (ncells < 0)
-  {
-    if ( lococ )
-      MMG5_DEL_MEM(mesh,lococ);
-    return -1;
-  }
+  ncells = MMG3D_getListSquare(mesh, PROctree, methalo);
+
   /* Check the PROctree cells */
   for ( i=0; i<ncells; ++i )
   {
-    for (j=0; j<lococ[i]->nbVer; ++j)
+    cell = &PROctree->cell[PROctree->lst[i]];
+    n    = (cell->nbVer-1) % PROctree->nv + 1;
+    for ( b=cell->blk; b; b=PROctree->blknxt[b] )
     {
+      v = &PROctree->v[(size_t)PROctree->nv*(b-1)];
+      for (j=0; j<n; ++j)
+      {
+        ip1  = v[j];
+        pp1  = &mesh->point[ip1];
 
-      ip1  = lococ[i]->v[j];
-      pp1  = &mesh->point[ip1];
-
-      hpi2 = lmax * sol->m[ip1];
-      //hpi2 = dmax * sol->m[ip1];
+        hpi2 = lmax * sol->m[ip1];
+        //hpi2 = dmax * sol->m[ip1];
 
-      ux = pp1->c[0] - ppt->c[0];
-      uy = pp1->c[1] - ppt->c[1];
-      uz = pp1->c[2] - ppt->c[2];
+        ux = pp1->c[0] - ppt->c[0];
+        uy = pp1->c[1] - ppt->c[1];
+        uz = pp1->c[2] - ppt->c[2];
 
-      d2 = ux*ux + uy*uy + uz*uz;
+        d2 = ux*ux + uy*uy + uz*uz;
 
-      if ( d2 < hp1 || d2 < hpi2*hpi2 )
-      {
-        MMG5_DEL_MEM(mesh,lococ);
-        return 0;
+        if ( d2 < hp1 || d2 < hpi2*hpi2 )
+        {
+          return 0;
+        }
       }
+      n = PROctree->nv;
     }
   }
-  MMG5_DEL_MEM(mesh,lococ);
   return 1;
 }
 
@@ -1216,7 +787,6 @@ int MMG3D_PROctreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,MMG3D_pPROctree PROctree,
  * \param lmax threshold to check minimal distance between points.
  *
  * \return 1 if we can insert \a ip, 0 otherwise
- * \return -1 if fail due to lack of memory.
  *
  * Check if the vertex \a ip is not too close from another one (for an
  * anisotropic metric).
@@ -1224,15 +794,14 @@ int MMG3D_PROctreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,MMG3D_pPROctree PROctree,
  */
 int MMG3D_PROctreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,MMG3D_pPROctree PROctree,MMG5_int ip,double lmax) {
   MMG5_pPoint      ppt,pp1;
-  MMG3D_PROctree_s **lococ;
+  MMG3D_PROctree_s *cell;
   double           d2,ux,uy,uz,methalo[6];
   double           det,dmi, *ma, *mb,m1,m2,m3,dx,dy,dz;
-  int              i,j;
-  MMG5_int         ip1,iadr;
+  int              i,j,n;
+  MMG5_int         ip1,iadr,b,*v;
   int              ncells;
   // double          dmax;
 
-  lococ = NULL;
   ppt = &mesh->point[ip];
 
   iadr = ip*sol->size;
@@ -1273,46 +842,45 @@ int MMG3D_PROctreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,MMG3D_pPROctree PROctree,
   methalo[4] = 2*dy;
   methalo[5] = 2*dz;
 
-  // this function allocates lococ, it has to be deleted after the call
-  ncells = MMG3D_getListSquare(mesh,ma,PROctree, methalo, &lococ);
-  if (ncells < 0)
-  {
-    MMG5_DEL_MEM(mesh,lococ);
-    return -1;
-  }
+  ncells = MMG3D_getListSquare(mesh,PROctree, methalo);
+
   /* Check the PROctree cells */
   for ( i=0; i<ncells; ++i )
   {
-    for (j=0; j<lococ[i]->nbVer; ++j)
+    cell = &PROctree->cell[PROctree->lst[i]];
+    n    = (cell->nbVer-1) % PROctree->nv + 1;
+    for ( b=cell->blk; b; b=PROctree->blknxt[b] )
     {
-      ip1  = lococ[i]->v[j];
-      pp1  = &mesh->point[ip1];
+      v = &PROctree->v[(size_t)PROctree->nv*(b-1)];
+      for (j=0; j<n; ++j)
+      {
+        ip1  = v[j];
+        pp1  = &mesh->point[ip1];
 
-      ux = pp1->c[0] - ppt->c[0];
-      uy = pp1->c[1] - ppt->c[1];
-      uz = pp1->c[2] - ppt->c[2];
+        ux = pp1->c[0] - ppt->c[0];
+        uy = pp1->c[1] - ppt->c[1];
+        uz = pp1->c[2] - ppt->c[2];
 
-      d2 = ma[0]*ux*ux + ma[3]*uy*uy + ma[5]*uz*uz
-        + 2.0*(ma[1]*ux*uy + ma[2]*ux*uz + ma[4]*uy*uz);
-      if ( d2 < dmi )
-      {
-        MMG5_DEL_MEM(mesh,lococ);
-        return 0;
-      }
-      else
-      {
-        iadr = ip1*sol->size;
-        mb   = &sol->m[iadr];
-        d2   = mb[0]*ux*ux + mb[3]*uy*uy + mb[5]*uz*uz
-          + 2.0*(mb[1]*ux*uy + mb[2]*ux*uz + mb[4]*uy*uz);
-        if ( d2 < dmi ) {
-          MMG5_DEL_MEM(mesh,lococ);
+        d2 = ma[0]*ux*ux + ma[3]*uy*uy + ma[5]*uz*uz
+          + 2.0*(ma[1]*ux*uy + ma[2]*ux*uz + ma[4]*uy*uz);
+        if ( d2 < dmi )
+        {
           return 0;
         }
+        else
+        {
+          iadr = ip1*sol->size;
+          mb   = &sol->m[iadr];
+          d2   = mb[0]*ux*ux + mb[3]*uy*uy + mb[5]*uz*uz
+            + 2.0*(mb[1]*ux*uy + mb[2]*ux*uz + mb[4]*uy*uz);
+          if ( d2 < dmi ) {
+            return 0;
+          }
+        }
       }
+      n = PROctree->nv;
     }
   }
 
-  MMG5_DEL_MEM(mesh,lococ);
   return 1;
 }
@@ -26,15 +26,19 @@
 
 #include "libmmgtypes.h"
 
+#define MMG3D_PROCTREE_DMAX 20 /*!< Maximal depth of the PROctree (bits per coordinate of the cell keys) */
+
 /**
  * PROctree cell: cellule for point region octree (to speed-up the research of
- * the closest point to another one).
+ * the closest point to another one). The cells are stored in the cell array of
+ * the global PROctree and the 8 children of a cell are contiguous in this
+ * array.
  *
  */
 typedef struct MMG3D_PROctree_s
 {
-  struct MMG3D_PROctree_s* branches; /*!< pointer to the subtrees of the current PROctree */
-  MMG5_int* v;      /*!< vertex index */
+  MMG5_int child; /*!< index of the first child of the cell (0 for a leaf) */
+  MMG5_int blk;   /*!< first block of the vertex list of a leaf (0 if empty) */
   int  nbVer;  /*!< number of vertices in the sub tree */
   int  depth; /*!< sub tree depth */
 } MMG3D_PROctree_s;
@@ -42,39 +46,41 @@ typedef struct MMG3D_PROctree_s
 /**
  * PROctree global structure (enriched by global variables) for point region
  * octree (to speed-up the research of the closest point to another one).
+ *
+ * The vertices of a leaf are stored in blocks of \a nv indices of the \a v
+ * array (only the leaves of maximal depth use more than one block). A vertex
+ * with integer coordinates \f$(i,j,k)\f$ lies in the child
+ * \f$ i_d + 2 j_d + 4 k_d \f$ of the cell of depth \f$d\f$ of its path, where
+ * \f$i_d\f$ is the bit of \f$i\f$ of weight \f$2^{19-d}\f$.
+ *
+ * \remark the search workspace is owned by the PROctree: queries on a same
+ * PROctree can't be run concurrently.
+ *
  */
-typedef struct
+typedef struct MMG3D_PROctree
 {
   int nv;  /*!< Max number of points per PROctree cell */
   int nc; /*!< Max number of cells listed per local search in the PROctree (-3)*/
-  MMG3D_PROctree_s* q0; /*!<  Pointer toward the first PROctree cell */
+  MMG3D_PROctree_s* cell; /*!< array of cells (the root is the cell 0) */
+  MMG5_int ncell; /*!< number of used cells */
+  MMG5_int ncellmax; /*!< size of the cell array */
+  MMG5_int cellfree; /*!< first free group of 8 cells (chained by the child field) */
+  MMG5_int *v; /*!< vertex blocks (block \a b is \a v[nv*(b-1)..nv*b-1]) */
+  MMG5_int *blknxt; /*!< next block of a vertex list or of the free blocks */
+  MMG5_int nblk; /*!< number of used blocks */
+  MMG5_int nblkmax; /*!< number of allocated blocks */
+  MMG5_int blkfree; /*!< first free block */
+  MMG5_int *lst; /*!< search workspace: leaves intersecting the search zone */
+  double   *dist; /*!< search workspace: distances of the listed leaves */
 } MMG3D_PROctree;
 typedef MMG3D_PROctree * MMG3D_pPROctree;
 
-void MMG3D_initPROctree_s( MMG3D_PROctree_s* q);
 int MMG3D_initPROctree(MMG5_pMesh,MMG3D_pPROctree* q, int nv);
-void MMG3D_freePROctree_s(MMG5_pMesh,MMG3D_PROctree_s* q, int nv);
 void MMG3D_freePROctree(MMG5_pMesh,MMG3D_PROctree** q);
-int MMG3D_isCellIncluded(double* cellCenter, double l, double* zoneCenter, double l0);
-void MMG3D_placeInListDouble(double*, double, int, int);
-void MMG3D_placeInListPROctree(MMG3D_PROctree_s**, MMG3D_PROctree_s*, int, int);
-int MMG3D_seekIndex (double* distList, double dist, int indexMin, int indexMax);
-int MMG3D_intersectRect(double *rectin, double *rectinout);
-int MMG3D_getListSquareRec(MMG3D_PROctree_s*,double*,double*,
-                            MMG3D_PROctree_s***,double*,double*,double, int, int, int*);
-int  MMG3D_getListSquare(MMG5_pMesh,double*,MMG3D_PROctree*,double*,MMG3D_PROctree_s***);
-int MMG3D_addPROctreeRec(MMG5_pMesh,MMG3D_PROctree_s*,double*, const MMG5_int, int);
+int  MMG3D_getListSquare(MMG5_pMesh,MMG3D_PROctree*,double*);
 int MMG3D_addPROctree(MMG5_pMesh mesh, MMG3D_PROctree* q, const MMG5_int no);
-int MMG3D_delPROctreeVertex(MMG5_pMesh,MMG3D_PROctree_s* q, MMG5_int no);
 int MMG3D_movePROctree(MMG5_pMesh, MMG3D_pPROctree,MMG5_int, double*, double*);
-void MMG3D_mergeBranchesRec(MMG3D_PROctree_s*, MMG3D_PROctree_s*, int, int , int*);
-void MMG3D_mergeBranches(MMG5_pMesh mesh,MMG3D_PROctree_s* q, int dim, int nv);
-int MMG3D_delPROctreeRec(MMG5_pMesh,MMG3D_PROctree_s*,double*, const MMG5_int,const int);
 int MMG3D_delPROctree(MMG5_pMesh mesh, MMG3D_pPROctree q, const int no);
-void MMG3D_printArbreDepth(MMG3D_PROctree_s* q, int depth, int nv, int dim);
-void MMG3D_printArbre(MMG3D_PROctree* q);
-void  MMG3D_sizeArbreRec(MMG3D_PROctree_s* q, int nv, int dim, int*,int*);
-int*  MMG3D_sizeArbre(MMG3D_PROctree* q, int dim);
 int  MMG3D_PROctreein_iso(MMG5_pMesh,MMG5_pSol,MMG3D_pPROctree,MMG5_int,double);
 int  MMG3D_PROctreein_ani(MMG5_pMesh,MMG5_pSol,MMG3D_pPROctree,MMG5_int,double);
 int64_t MMG3D_getPROctreeCoordinate(MMG3D_pPROctree q, double* ver, int dim);
@@ -312,7 +312,7 @@ int MMG5_setdhd(MMG5_pMesh mesh) {
   double        n1[3],n2[3],dhd;
   MMG5_int      *adja,k,kk,ne,nr,nrrm;
   int8_t        i,ii,i1,i2;
-  static int8_t warn=0;
+  static MMG5_THREADLOCAL int8_t warn=0;
 
   /** Step 1: check input ridges provided by the user to remove those ones
    * between triangles belonging to the same plane. This step has to be done
@@ -477,7 +477,7 @@ int MMG5_chkVertexConnectedDomains(MMG5_pMesh mesh){
   int           ilists,ilistv;
   int           i0,ier;
   int8_t        i,j;
-  static int8_t mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn = 0;
 
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
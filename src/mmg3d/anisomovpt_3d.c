@@ -204,8 +204,8 @@ int MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, MMG3D_pPROctree PROctre
   MMG5_int          k,kel,iel,ip0,nxp;
   int               ier,l;
   uint8_t           i0,iface,i;
-  static int        warn = 0;
-  static int8_t     mmgErr0=0;
+  static MMG5_THREADLOCAL int        warn = 0;
+  static MMG5_THREADLOCAL int8_t     mmgErr0=0;
 
   step = 0.1;
   if ( ilists < 2 )      return 0;
@@ -147,7 +147,7 @@ inline int MMG5_moymet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,double *m1)
   double        dd;
   int           i,k,n;
   int8_t        ddebug = 0;
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 
   n = 0;
   for (k=0; k<6; ++k) mm[k] = 0.;
@@ -176,6 +176,7 @@ inline int MMG5_moymet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,double *m1)
 
 /**
  * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark the tetra in the mesh).
  * \param met pointer to the metric structure.
  * \param kel index of the tetra in which we work.
  * \param iface face of the tetra on which we work.
@@ -188,7 +189,7 @@ inline int MMG5_moymet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,double *m1)
  * \f$=\alpha*Id\f$, \f$\alpha =\f$ size.
  *
  */
-static int MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface, int ip) {
+static int MMG5_defmetsin(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_pSol met,MMG5_int kel, int iface, int ip) {
   MMG5_pTetra        pt;
   MMG5_pxTetra       pxt;
   MMG5_pPoint        p0;
@@ -201,7 +202,7 @@ static int MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
   int                k,ilist,ifac,isloc,init_s,ilists,ilistv;
   MMG5_int           idp,iel;
   uint8_t            i,i0,i1,i2;
-  static int8_t      mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t      mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -215,8 +216,8 @@ static int MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
   isloc   = 0;
 
   if ( mesh->adja[4*(kel-1)+iface+1] ) return 0;
-  ilist = MMG5_boulesurfvolp(mesh,kel,ip,iface,
-                              listv,&ilistv,lists,&ilists,(p0->tag & MG_NOM));
+  ilist = MMG5_boulesurfvolp_visit(mesh,vis,kel,ip,iface,
+                                   listv,&ilistv,lists,&ilists,(p0->tag & MG_NOM));
 
   if ( ilist!=1 ) {
     if ( !mmgWarn ) {
@@ -372,6 +373,7 @@ static int MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
 
 /**
  * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark the tetra in the mesh).
  * \param met pointer to the metric structure.
  * \param kel index of the tetra in which we work.
  * \param iface face of the tetra on which we work.
@@ -387,7 +389,7 @@ static int MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
  * and at each time, metric tensor has to be recomputed, depending on the side.
  *
  */
-static int MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,
+static int MMG5_defmetrid(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_pSol met,MMG5_int kel,
                            int iface, MMG5_int ip)
 {
   MMG5_pTetra    pt;
@@ -404,7 +406,7 @@ static int MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,
   double         r[3][3],lispoi[3*MMG3D_LMAX+1];
   double         detg,detd;
   int            i,i0,i1,i2,ifac,isloc;
-  static int8_t  mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t  mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -461,8 +463,8 @@ static int MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,
   m[4] = isqhmax;
 
   // Call bouletrid that construct the surfacic ball
-  ier = MMG5_bouletrid(mesh,kel,iface,ip,&ilist1,list1,&ilist2,list2,
-                        &iprid[0],&iprid[1] );
+  ier = MMG5_bouletrid_visit(mesh,vis,kel,iface,ip,&ilist1,list1,&ilist2,list2,
+                             &iprid[0],&iprid[1] );
   if ( !ier ) {
     if ( !mmgWarn ) {
       fprintf(stderr,"\n  ## Warning: %s: at least 1 metric not computed:"
@@ -592,6 +594,7 @@ static int MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,
 
 /**
  * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark the tetra in the mesh).
  * \param met pointer to the metric structure.
  * \param kel index of the triangle in which we work.
  * \param iface face of the tetra on which we work.
@@ -603,7 +606,7 @@ static int MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,
  * geometric approx of the surface.
  *
  */
-static int MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface, int ip) {
+static int MMG5_defmetref(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_pSol met,MMG5_int kel, int iface, int ip) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
   MMG5_Tria     ptt;
@@ -620,7 +623,7 @@ static int MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
   double        ux,uy,uz,det2d,c[3];
   double        tAA[6],tAb[3], hausd;
   uint8_t       i1,i2,itri1,itri2,i;
-  static int8_t mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0=0,mmgWarn1=0;
 
   ipref[0] = ipref[1] = 0;
   pt  = &mesh->tetra[kel];
@@ -634,7 +637,7 @@ static int MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
   isqhmax = mesh->info.hmax;
   isloc = 0;
 
-  ilist = MMG5_boulesurfvolp(mesh,kel,ip,iface,listv,&ilistv,lists,&ilists,0);
+  ilist = MMG5_boulesurfvolp_visit(mesh,vis,kel,ip,iface,listv,&ilistv,lists,&ilists,0);
 
   if ( ilist!=1 ) {
     if ( !mmgWarn0 ) {
@@ -861,6 +864,7 @@ static int MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
 
 /**
  * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark the tetra in the mesh).
  * \param met pointer to the metric structure.
  * \param kel index of the triangle in which we work.
  * \param iface working face.
@@ -872,7 +876,7 @@ static int MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface,
  * the geometric approx of the surface.
  *
  */
-static int MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,int iface, int ip) {
+static int MMG5_defmetreg(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_pSol met,MMG5_int kel,int iface, int ip) {
   MMG5_pTetra    pt;
   MMG5_pxTetra   pxt;
   MMG5_Tria      ptt;
@@ -889,7 +893,7 @@ static int MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,int iface,
   double         det2d,c[3],isqhmin,isqhmax;
   double         tAA[6],tAb[3],hausd;
   uint8_t        i1,i;
-  static int8_t  mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t  mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -901,7 +905,7 @@ static int MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,int iface,
   isqhmax = mesh->info.hmax;
   isloc     = 0;
 
-  ilist = MMG5_boulesurfvolp(mesh,kel,ip,iface,listv,&ilistv,lists,&ilists,0);
+  ilist = MMG5_boulesurfvolp_visit(mesh,vis,kel,ip,iface,listv,&ilistv,lists,&ilists,0);
 
   if ( ilist!=1 ) {
     if ( !mmgWarn ) {
@@ -1292,6 +1296,50 @@ int MMG3D_intextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6]) {
 
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark the tetra in the mesh).
+ * \param met pointer to the metric structure.
+ * \param k tetra from which the point is reached.
+ * \param l boundary face of the tetra.
+ * \param iploc local index of the point in the tetra.
+ * \param ismet 1 if a metric is provided by the user.
+ * \return 1 if success, 0 if the metric can't be computed from this face, -1
+ * if the surface and physical metrics can't be intersected.
+ *
+ * Define the metric at a boundary point depending on its type and intersect
+ * it with the physical metric if provided. Only the metric of the point is
+ * modified.
+ *
+ */
+static int MMG3D_defmetbdy_pt(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_pSol met,
+                              MMG5_int k,int8_t l,int8_t iploc,int8_t ismet) {
+  MMG5_pPoint ppt;
+  double      mm[6];
+  MMG5_int    ip;
+
+  ip  = mesh->tetra[k].v[iploc];
+  ppt = &mesh->point[ip];
+
+  if ( ismet )  memcpy(mm,&met->m[6*ip],6*sizeof(double));
+
+  if ( MG_SIN_OR_NOM(ppt->tag) ) {
+    if ( !MMG5_defmetsin(mesh,vis,met,k,l,iploc) )  return 0;
+  }
+  else if ( ppt->tag & MG_GEO ) {
+    if ( !MMG5_defmetrid(mesh,vis,met,k,l,iploc))  return 0;
+  }
+  else if ( ppt->tag & MG_REF ) {
+    if ( !MMG5_defmetref(mesh,vis,met,k,l,iploc) )  return 0;
+  } else {
+    if ( !MMG5_defmetreg(mesh,vis,met,k,l,iploc) )  return 0;
+  }
+  if ( ismet ) {
+    if ( !MMG3D_intextmet(mesh,met,ip,mm) )  return -1;
+  }
+  return 1;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric stucture.
@@ -1308,15 +1356,16 @@ int MMG3D_intextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6]) {
  *    plane, but it is forced to be aligned to the normal direction.
  */
 int MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
-  MMG5_pTetra   pt;
-  MMG5_pxTetra  pxt;
-  MMG5_pPoint   ppt;
-  double        mm[6];
-  MMG5_int      k,l;
-  int           iploc;
-  int8_t        ismet;
-  int8_t        i;
-  static int8_t mmgErr = 0;
+  MMG5_pTetra    pt;
+  MMG5_pxTetra   pxt;
+  MMG5_pPoint    ppt;
+  MMG3D_pBdyCand cand;
+  MMG3D_pVisit   *vis;
+  MMG5_int       k,l,c,ncand,nfail,ip;
+  int            iploc,nc,ier;
+  int8_t         ismet;
+  int8_t         i;
+  static MMG5_THREADLOCAL int8_t  mmgErr = 0;
 
   if ( !MMG5_defsiz_startingMessage (mesh,met,__func__) ) {
     return 0;
@@ -1336,11 +1385,10 @@ int MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
       return 0;
     }
 
-    MMG5_caltet         = MMG5_caltet_ani;
-    MMG5_caltri         = MMG5_caltri_ani;
-    MMG5_lenedg         = MMG5_lenedg_ani;
-    MMG3D_lenedgCoor    = MMG5_lenedgCoor_ani;
-    MMG5_lenSurfEdg     = MMG5_lenSurfEdg_ani;
+    mesh->ops->caltet     = MMG5_caltet_ani;
+    mesh->ops->caltri     = MMG5_caltri_ani;
+    mesh->ops->lenedg     = MMG5_lenedg_ani;
+    mesh->ops->lenSurfEdg = MMG5_lenSurfEdg_ani;
   }
   else {
     ismet = 1;
@@ -1359,42 +1407,67 @@ int MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( !MMG5_defmetvol(mesh,met,ismet) )  return 0;
 
   /* Step 3: metric definition at boundary points */
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    // Warning: why are we skipped the tetra with negative refs ?
-    if ( !MG_EOK(pt) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
-    else if ( !pt->xt )  continue;
+  /* Metrics are computed independently at each point from the face from which
+   * the serial sweep reaches it first, so the result doesn't depend on the
+   * number of threads */
+  nc = MMG3D_Init_bdyCand(mesh,0,&cand,&ncand,&vis);
+  nfail = 0;
+  if ( nc > 1 ) {
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nc) schedule(dynamic,64)
+#endif
+    for ( c=0; c<ncand; ++c ) {
+      cand[c].ok = MMG3D_defmetbdy_pt(mesh,vis[MMG5_THREAD_NUM()],met,cand[c].k,
+                                      cand[c].i,cand[c].i0,ismet);
+    }
 
-    pxt = &mesh->xtetra[pt->xt];
-    for (l=0; l<4; l++) {
-      if ( !(pxt->ftag[l] & MG_BDY) ) continue;
-      // In multidomain case, acces the face through a tetra for which it is
-      // well oriented.
-      if ( !(MG_GET(pxt->ori,l)) ) continue;
+    for ( c=0; c<ncand; ++c ) {
+      ip = mesh->tetra[cand[c].k].v[cand[c].i0];
+      if ( cand[c].ok < 0 ) {
+        if ( !mmgErr ) {
+          fprintf(stderr,"\n  ## Error: %s: unable to intersect metrics"
+                  " at point %" MMG5_PRId ".\n",__func__,
+                  MMG3D_indPt(mesh,ip));
+          mmgErr = 1;
+        }
+        MMG3D_Free_bdyCand(mesh,nc,&cand,&vis);
+        return 0;
+      }
+      else if ( !cand[c].ok ) {
+        /* Metric not computed from this face: the point will be treated by
+         * the serial sweep from the next faces to which it belongs */
+        mesh->point[ip].flag = cand[c].flag;
+        ++nfail;
+      }
+    }
+    MMG3D_Free_bdyCand(mesh,nc,&cand,&vis);
+  }
 
-      for (i=0; i<3; i++) {
-        iploc = MMG5_idir[l][i];
-        ppt   = &mesh->point[pt->v[iploc]];
+  if ( nc == 1 || nfail ) {
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      // Warning: why are we skipped the tetra with negative refs ?
+      if ( !MG_EOK(pt) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
+      else if ( !pt->xt )  continue;
 
-        if ( !MG_VOK(ppt) )  continue;
+      pxt = &mesh->xtetra[pt->xt];
+      for (l=0; l<4; l++) {
+        if ( !(pxt->ftag[l] & MG_BDY) ) continue;
+        // In multidomain case, acces the face through a tetra for which it is
+        // well oriented.
+        if ( !(MG_GET(pxt->ori,l)) ) continue;
 
-        if ( ppt->flag > 1 ) continue;
+        for (i=0; i<3; i++) {
+          iploc = MMG5_idir[l][i];
+          ppt   = &mesh->point[pt->v[iploc]];
 
-        if ( ismet )  memcpy(mm,&met->m[6*(pt->v[iploc])],6*sizeof(double));
+          if ( !MG_VOK(ppt) )  continue;
 
-        if ( MG_SIN_OR_NOM(ppt->tag) ) {
-          if ( !MMG5_defmetsin(mesh,met,k,l,iploc) )  continue;
-        }
-        else if ( ppt->tag & MG_GEO ) {
-          if ( !MMG5_defmetrid(mesh,met,k,l,iploc))  continue;
-        }
-        else if ( ppt->tag & MG_REF ) {
-          if ( !MMG5_defmetref(mesh,met,k,l,iploc) )  continue;
-        } else {
-          if ( !MMG5_defmetreg(mesh,met,k,l,iploc) )  continue;
-        }
-        if ( ismet ) {
-          if ( !MMG3D_intextmet(mesh,met,pt->v[iploc],mm) ) {
+          if ( ppt->flag > 1 ) continue;
+
+          ier = MMG3D_defmetbdy_pt(mesh,NULL,met,k,l,iploc,ismet);
+          if ( !ier )  continue;
+          else if ( ier < 0 ) {
             if ( !mmgErr ) {
               fprintf(stderr,"\n  ## Error: %s: unable to intersect metrics"
                       " at point %" MMG5_PRId ".\n",__func__,
@@ -1403,8 +1476,8 @@ int MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
             }
             return 0;
           }
+          ppt->flag = 2;
         }
-        ppt->flag = 2;
       }
     }
   }
@@ -2077,8 +2150,8 @@ int MMG3D_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint   p0,p1;
   double        *m,mv;
   int           i,itv,maxit,ier;
-  MMG5_int      k,np0,np1,nu,nupv;
-  static int    mmgWarn = 0;
+  MMG5_int      k,np0,np1,nu,nupv,ned,*edg;
+  static MMG5_THREADLOCAL int    mmgWarn = 0;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Anisotropic mesh gradation\n");
@@ -2130,6 +2203,36 @@ int MMG3D_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
     }
   }
 
+  /* Store the edges in the order of the hash table traversal so each pass
+   * reads a contiguous array. The third entry of an edge is the index of the
+   * first edge of the next cluster of occupied slots. */
+  ned = edgeTable.nitem;
+
+  MMG5_ADD_MEM(mesh,3*(ned+1)*sizeof(MMG5_int),"edge array",
+               MMG5_DEL_MEM(mesh,edgeTable.item);return 0);
+  MMG5_SAFE_MALLOC(edg,3*(ned+1),MMG5_int,
+                   mesh->memCur -= 3*(ned+1)*sizeof(MMG5_int);
+                   MMG5_DEL_MEM(mesh,edgeTable.item);return 0);
+
+  ned = 0;
+  np0 = 0;
+  for (k=0; k<edgeTable.siz; k++) {
+    pht = &edgeTable.item[k];
+    if ( !pht->a ) {
+      for ( ; np0<ned; ++np0 ) {
+        edg[3*np0+2] = ned;
+      }
+      continue;
+    }
+    edg[3*ned]   = pht->a;
+    edg[3*ned+1] = pht->b;
+    ++ned;
+  }
+  for ( ; np0<ned; ++np0 ) {
+    edg[3*np0+2] = ned;
+  }
+  MMG5_DEL_MEM(mesh,edgeTable.item);
+
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = mesh->base;
 
@@ -2137,56 +2240,54 @@ int MMG3D_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   maxit = 500;
   mmgWarn = 0;
 
-  /* analyze mesh edges via hash table */
+  /* analyze mesh edges */
   do {
     ++mesh->base;
     nu = 0;
-    for (k=0; k<edgeTable.siz; k++) {
-      pht = &edgeTable.item[k];
-      /* analyze linked list */
-      while ( pht ) {
-        if ( !pht->a )  break;
-        np0  = pht->a;
-        np1  = pht->b;
-        p0 = &mesh->point[np0];
-        p1 = &mesh->point[np1];
-
-        /* Skip edge if both nodes have been updated more than 1 iteration ago */
-        if ( (p0->flag < mesh->base-1) && (p1->flag < mesh->base-1) ) {
-          pht = pht->nxt ? &edgeTable.item[pht->nxt] : 0;
-          continue;
-        }
+    k  = 0;
+    while ( k<ned ) {
+      np0  = edg[3*k];
+      np1  = edg[3*k+1];
+      p0 = &mesh->point[np0];
+      p1 = &mesh->point[np1];
+
+      /* Skip edge if both nodes have been updated more than 1 iteration ago */
+      if ( (p0->flag < mesh->base-1) && (p1->flag < mesh->base-1) ) {
+        ++k;
+        continue;
+      }
 
-        /* Skip points belonging to a required edge */
-        if ( p0->s || p1->s ) {
-          pht = pht->nxt ? &edgeTable.item[pht->nxt] : 0;
-          continue;
-        }
+      /* Skip points belonging to a required edge */
+      if ( p0->s || p1->s ) {
+        ++k;
+        continue;
+      }
 
-        ier = MMG5_grad2metVol(mesh,met,np0,np1);
-        if( ier == -1 ) {
-          break;
-        } else {
-          if ( ier & 1 ) {
-            p0->flag = mesh->base;
-            nu++;
-          }
-          if ( ier & 2 ) {
-            p1->flag = mesh->base;
-            nu++;
-          }
-          if ( !mmgWarn && (ier & 4) ) {
-            mmgWarn = itv;
-          }
+      ier = MMG5_grad2metVol(mesh,met,np0,np1);
+      if( ier == -1 ) {
+        /* skip the end of the cluster */
+        k = edg[3*k+2];
+        continue;
+      } else {
+        if ( ier & 1 ) {
+          p0->flag = mesh->base;
+          nu++;
+        }
+        if ( ier & 2 ) {
+          p1->flag = mesh->base;
+          nu++;
+        }
+        if ( !mmgWarn && (ier & 4) ) {
+          mmgWarn = itv;
         }
-
-        /* next edge */
-        pht = pht->nxt ? &edgeTable.item[pht->nxt] : 0;
       }
+
+      /* next edge */
+      ++k;
     }
     nupv += nu;
   } while ( ++itv < maxit && nu > 0 );
-  MMG5_SAFE_FREE(edgeTable.item);
+  MMG5_DEL_MEM(mesh,edg);
 
   if ( abs(mesh->info.imprim) > 3 ) {
     if( mmgWarn ) {
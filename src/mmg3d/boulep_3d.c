@@ -38,11 +38,117 @@
 
 extern MMG5_Info  info;
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis pointer to the traversal context to allocate.
+ * \return 1 if success, 0 if fail.
+ *
+ * Allocate and initialize a traversal context. Memory accounting is not
+ * thread-safe: contexts must be allocated before entering a parallel region.
+ *
+ */
+int MMG3D_Init_visit(MMG5_pMesh mesh,MMG3D_pVisit *vis) {
+
+  MMG5_ADD_MEM(mesh,sizeof(MMG3D_Visit),"traversal context",return 0);
+  MMG5_SAFE_CALLOC(*vis,1,MMG3D_Visit,return 0);
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis pointer to the traversal context to free.
+ *
+ * Free a traversal context allocated by \ref MMG3D_Init_visit.
+ *
+ */
+void MMG3D_Free_visit(MMG5_pMesh mesh,MMG3D_pVisit *vis) {
+  MMG5_DEL_MEM(mesh,*vis);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark tetra in the mesh).
+ * \return the stamp of the new traversal.
+ *
+ * Start a new traversal: without context, increment the mesh base, otherwise
+ * open a new epoch in the context (the stamps are reset when the epoch counter
+ * overflows).
+ *
+ */
+static inline
+MMG5_int MMG3D_newVisit(MMG5_pMesh mesh,MMG3D_pVisit vis) {
+
+  if ( !vis ) return ++mesh->base;
+
+  if ( vis->base == INT_MAX ) {
+    memset(vis->stamp,0,MMG3D_VISITSIZ*sizeof(int));
+    vis->base = 0;
+  }
+  vis->nvis = 0;
+
+  return ++vis->base;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark tetra in the mesh).
+ * \param base stamp of the current traversal.
+ * \param k index of the tetra to mark.
+ * \return 1 if \a k was already visited during the current traversal, 0
+ * otherwise (in this case, \a k is marked as visited), -1 if the context is
+ * full (the traversal has to be stopped and the ball rejected as too large).
+ *
+ */
+static inline
+int MMG3D_markVisit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int base,MMG5_int k) {
+  MMG5_pTetra pt;
+  int         h;
+
+  if ( !vis ) {
+    pt = &mesh->tetra[k];
+    if ( pt->flag == base ) return 1;
+    pt->flag = base;
+    return 0;
+  }
+
+  h = (int)((MMG5_KA*(int64_t)k) & (MMG3D_VISITSIZ-1));
+  while ( vis->stamp[h] == base ) {
+    if ( vis->key[h] == k ) return 1;
+    h = (h+1) & (MMG3D_VISITSIZ-1);
+  }
+
+  if ( vis->nvis >= MMG3D_VISITSIZ/2 ) return -1;
+
+  vis->stamp[h] = base;
+  vis->key[h]   = k;
+  ++vis->nvis;
+
+  return 0;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param start index of the starting tetrahedra.
+ * \param ip local index of the point in the tetrahedra \a start.
+ * \param list pointer to the list of the tetra in the volumic ball of
+ * \a ip.
+ * \return 0 if fail and the number of the tetra in the ball otherwise.
+ *
+ * Fill the volumic ball of point \a ip in tetra \a start (see \ref
+ * MMG5_boulevolp_visit). Visited tetra are marked in the mesh.
+ *
+ */
+int MMG5_boulevolp (MMG5_pMesh mesh, MMG5_int start, int ip, int64_t * list){
+  return MMG5_boulevolp_visit(mesh,NULL,start,ip,list);
+}
+
 /**
  * \brief Given a vertex and a tetrahedron, find all tetrahedra in the ball of
  * this vertex.
  *
  * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark visited tetra in the mesh).
  * \param start index of the starting tetrahedra.
  * \param ip local index of the point in the tetrahedra \a start.
  * \param list pointer to the list of the tetra in the volumic ball of
@@ -54,19 +160,20 @@ extern MMG5_Info  info;
  * of tetrahedra, jel = local index of p within kel.
  *
  */
-int MMG5_boulevolp (MMG5_pMesh mesh, MMG5_int start, int ip, int64_t * list){
+int MMG5_boulevolp_visit (MMG5_pMesh mesh, MMG3D_pVisit vis, MMG5_int start,
+                          int ip, int64_t * list){
   MMG5_pTetra  pt,pt1;
   MMG5_int     base,*adja,nump,k,k1;
-  int          ilist,cur;
+  int          ilist,cur,vst;
   int8_t       j,l,i;
 
-  base = ++mesh->base;
+  base = MMG3D_newVisit(mesh,vis);
   pt   = &mesh->tetra[start];
   assert( 0<=ip && ip<4 && "unexpected local index for vertex");
   nump = pt->v[ip];
 
   /* Store initial tetrahedron */
-  pt->flag = base;
+  MMG3D_markVisit(mesh,vis,base,start);
   list[0] = 4*start + ip;
   ilist=1;
 
@@ -82,9 +189,10 @@ int MMG5_boulevolp (MMG5_pMesh mesh, MMG5_int start, int ip, int64_t * list){
       k1 = adja[i];
       if ( !k1 )  continue;
       k1 /= 4;
+      vst = MMG3D_markVisit(mesh,vis,base,k1);
+      if ( vst < 0 )  return 0;
+      if ( vst )  continue;
       pt1 = &mesh->tetra[k1];
-      if ( pt1->flag == base )  continue;
-      pt1->flag = base;
       for (j=0; j<4; j++)
         if ( pt1->v[j] == nump )  break;
       assert(j<4);
@@ -198,6 +306,25 @@ void MMG3D_compute_tangent(MMG5_pMesh mesh,int nump,int ip0,int ip1,double t[3])
  */
 int MMG5_boulenm(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
                   double n[3],double t[3]) {
+  return MMG5_boulenm_visit(mesh,NULL,start,ip,iface,n,t);
+}
+
+/**
+ * \param mesh pointer to the mesh  structure.
+ * \param vis traversal context (NULL to mark visited tetra in the mesh).
+ * \param start tetra index.
+ * \param ip point index.
+ * \param iface face index.
+ * \param n computed normal vector.
+ * \param t computed tangent vector.
+ * \return 0 if point is singular, 1 otherwise.
+ *
+ * Define normal and tangent vectors at a non manifold point (\a ip in \a start,
+ * supported by face \a iface), enumerating its (outer)surfacic ball.
+ *
+ */
+int MMG5_boulenm_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,
+                       int iface,double n[3],double t[3]) {
   MMG5_pTetra   pt;
   double        dd,nt[3];
   int           nr,nnm;
@@ -206,7 +333,7 @@ int MMG5_boulenm(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
   int8_t        iopp,ipiv,indb,inda,i,isface;
   int8_t        indedg[4][4] = { {-1,0,1,2}, {0,-1,3,4}, {1,3,-1,5}, {2,4,5,-1} };
 
-  base = ++mesh->base;
+  base = MMG3D_newVisit(mesh,vis);
   nr  = nnm = 0;
   ip0 = ip1 = 0;
 
@@ -266,12 +393,9 @@ int MMG5_boulenm(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
       k = adj;
       pt = &mesh->tetra[k];
       adja = &mesh->adja[4*(k-1)+1];
-      if ( pt->flag != base ) {
-        for (i=0; i<4; i++)
-          if ( pt->v[i] == nump )  break;
-        assert(i<4);
-        pt->flag = base;
-      }
+      /* Marks are not read by this traversal: they are only kept when working
+       * on the mesh */
+      if ( !vis )  pt->flag = base;
 
       /* identification of edge number in tetra k */
       if ( !MMG3D_findEdge(mesh,pt,k,na,nb,1,NULL,&i) ) return -1;
@@ -343,14 +467,31 @@ int MMG5_boulenm(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
  * or normal.
  */
 int MMG5_boulenmInt(MMG5_pMesh mesh,MMG5_int start,int ip,double t[3]) {
+  return MMG5_boulenmInt_visit(mesh,NULL,start,ip,t);
+}
+
+/**
+ * \param mesh pointer to the mesh  structure.
+ * \param vis traversal context (NULL to mark visited tetra in the mesh).
+ * \param start tetra index.
+ * \param ip point index.
+ * \param t computed tangent vector.
+ * \return 0 when more than two NOM points are attached to ip, 1 if sucess.
+ *
+ * Travel the ball of the internal non manifold point ip in tetra start
+ * and calculate the tangent vector to the underlying curve.
+ *
+ */
+int MMG5_boulenmInt_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,
+                          double t[3]) {
   MMG5_pTetra    pt,pt1;
   MMG5_pxTetra   pxt;
   double         dd;
   MMG5_int       base,k,kk,ip0,ip1,nump,na,nb,list[MMG3D_LMAX+2],*adja;
-  int            cur,ilist;
+  int            cur,ilist,vst;
   int8_t         i,j,ii,ie;
 
-  base = ++mesh->base;
+  base = MMG3D_newVisit(mesh,vis);
   ip0 = ip1 = 0;
   cur = ilist = 0;
 
@@ -358,7 +499,7 @@ int MMG5_boulenmInt(MMG5_pMesh mesh,MMG5_int start,int ip,double t[3]) {
   pt = &mesh->tetra[start];
   nump = pt->v[ip];
   list[0] = 4*start+ip;
-  pt->flag = base;
+  MMG3D_markVisit(mesh,vis,base,start);
   ilist++;
 
   while ( cur < ilist ) {
@@ -411,15 +552,16 @@ int MMG5_boulenmInt(MMG5_pMesh mesh,MMG5_int start,int ip,double t[3]) {
         return 0;
       }
 
+      vst = MMG3D_markVisit(mesh,vis,base,kk);
+      if ( vst < 0 ) return 0;
+      if ( vst ) continue;
       pt1 = &mesh->tetra[kk];
-      if ( pt1->flag == base ) continue;
 
       for (ii=0; ii<4; ii++)
         if ( pt1->v[ii] == nump ) break;
       assert ( ii < 4 );
 
       list[ilist] = 4*kk+ii;
-      pt1->flag = base;
       if ( ilist > MMG3D_LMAX-3 )  return 0;
       ilist++;
     }
@@ -456,34 +598,48 @@ int MMG5_boulenmInt(MMG5_pMesh mesh,MMG5_int start,int ip,double t[3]) {
  *
  */
 int MMG5_boulernm(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int start,int ip,MMG5_int *ng,MMG5_int *nr,MMG5_int *nm){
+  return MMG5_boulernm_visit(mesh,NULL,hash,start,ip,ng,nr,nm);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark visited tetra in the mesh).
+ * \param hash pointer to an allocated hash table.
+ * \param start index of the starting tetrahedra.
+ * \param ip local index of the point in the tetrahedra \a start.
+ * \param ng pointer to the number of ridges.
+ * \param nr pointer to the number of reference edges.
+ * \param nm pointer to the number of non-manifold edges.
+ * \return ns the number of special edges passing through ip, -1 if fail.
+ *
+ * Count the numer of ridges and reference edges incident to
+ * the vertex \a ip when ip is non-manifold.
+ *
+ * \remark the hash table is owned by the caller: concurrent calls must use
+ * distinct tables.
+ *
+ */
+int MMG5_boulernm_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_Hash *hash,MMG5_int start,
+                        int ip,MMG5_int *ng,MMG5_int *nr,MMG5_int *nm){
   MMG5_pTetra    pt,pt1;
   MMG5_pxTetra   pxt;
   MMG5_hedge    *ph;
   MMG5_int       *adja,nump,k,k1;
-  int            ns,ilist,cur;
-  MMG5_int       list[MMG3D_LMAX+2],base,ia,ib,a,b,key,jj;
+  int            ns,ilist,cur,vst;
+  MMG5_int       list[MMG3D_LMAX+2],base,ia,ib,a,b;
   int8_t         j,l,i;
   uint8_t        ie;
 
   /* reset the hash table */
-  for ( k=0;  k<=hash->max; ++k ) {
-    hash->item[k].a = 0;
-    hash->item[k].b = 0;
-  }
+  memset(hash->item,0,hash->siz*sizeof(MMG5_hedge));
+  hash->nitem = 0;
 
-  for ( k=0;  k<=hash->siz; ++k ) {
-    hash->item[k].nxt = 0;
-  }
-  for (k=hash->siz; k<hash->max; k++) {
-    hash->item[k].nxt = k+1;
-  }
-
-  base = ++mesh->base;
+  base = MMG3D_newVisit(mesh,vis);
   pt   = &mesh->tetra[start];
   nump = pt->v[ip];
 
   /* Store initial tetrahedron */
-  pt->flag = base;
+  MMG3D_markVisit(mesh,vis,base,start);
   list[0] = 4*start + ip;
   ilist = 1;
 
@@ -509,37 +665,24 @@ int MMG5_boulernm(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int start,int ip,MMG5_int
           b = pt->v[MMG5_iare[ie][1]];
           ia  = MG_MIN(a,b);
           ib  = MG_MAX(a,b);
-          key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-          ph  = &hash->item[key];
+          ph  = MMG5_hashProbe(hash,ia,ib);
 
-          if ( ph->a == ia && ph->b == ib )
+          if ( ph->a )
             continue;
-          else if ( ph->a ) {
-            while ( ph->nxt && ph->nxt < hash->max ) {
-              ph = &hash->item[ph->nxt];
-              if ( ph->a == ia && ph->b == ib )  continue;
-            }
-            ph->nxt   = hash->nxt;
-            ph        = &hash->item[hash->nxt];
-
-            if ( hash->nxt >= hash->max-1 ) {
-              if ( mesh->info.ddebug )
-                fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
-                        " %" MMG5_PRId "\n",__func__,hash->max);
-              MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,MMG5_GAP,MMG5_hedge,
-                                 "MMG5_edge",return -1);
-              /* ph pointer may be false after realloc */
-              ph        = &hash->item[hash->nxt];
-
-              for (jj=ph->nxt; jj<hash->max; jj++)  hash->item[jj].nxt = jj+1;
-            }
-            hash->nxt = ph->nxt;
+
+          if ( hash->nitem >= hash->max ) {
+            if ( mesh->info.ddebug )
+              fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
+                      " %" MMG5_PRId "\n",__func__,hash->max);
+            if ( !MMG5_hashGrow(mesh,hash) ) return -1;
+            /* ph pointer is false after realloc */
+            ph = MMG5_hashProbe(hash,ia,ib);
           }
 
           /* insert new edge */
           ph->a = ia;
           ph->b = ib;
-          ph->nxt = 0;
+          ++hash->nitem;
 
           /* Order of following tests impacts the ridge and non-manifold edges
            * count (an edge that has both tags pass only in first test) but
@@ -567,9 +710,10 @@ int MMG5_boulernm(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int start,int ip,MMG5_int
       k1 = adja[i];
       if ( !k1 )  continue;
       k1 /= 4;
+      vst = MMG3D_markVisit(mesh,vis,base,k1);
+      if ( vst < 0 )  return 0;
+      if ( vst )  continue;
       pt1 = &mesh->tetra[k1];
-      if ( pt1->flag == base )  continue;
-      pt1->flag = base;
       for (j=0; j<4; j++)
         if ( pt1->v[j] == nump )  break;
       assert(j<4);
@@ -609,16 +753,42 @@ int MMG5_boulernm(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int start,int ip,MMG5_int
  */
 int MMG5_boulesurfvolp(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
                         int64_t *listv,int *ilistv,MMG5_int *lists,int*ilists, int isnm)
+{
+  return MMG5_boulesurfvolp_visit(mesh,NULL,start,ip,iface,listv,ilistv,
+                                  lists,ilists,isnm);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark visited tetra in the mesh).
+ * \param start index of the starting tetra.
+ * \param ip index in \a start of the looked point.
+ * \param iface index in \a start of the starting face.
+ * \param listv pointer to the computed volumic ball.
+ * \param ilistv pointer to the computed volumic ball size.
+ * \param lists pointer to the computed surfacic ball.
+ * \param ilists pointer to the computed surfacic ball size.
+ * \param isnm 1 if \a ip is non-manifold, 0 otherwise.
+ * \return -1 if fail, 1 otherwise.
+ *
+ * Compute the volumic and surfacic balls of a SURFACE point (see \ref
+ * MMG5_boulesurfvolp) using the traversal context \a vis.
+ *
+ */
+int MMG5_boulesurfvolp_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,
+                             int iface,int64_t *listv,int *ilistv,MMG5_int *lists,
+                             int*ilists, int isnm)
 {
   MMG5_pTetra   pt,pt1;
   MMG5_pxTetra  pxt;
   MMG5_int      k,*adja,nump,k1,fstart,piv,na,nb,adj,nvstart,aux,cur,base;
+  int           vst;
   int8_t        iopp,ipiv,i,j,l,isface;
-  static int8_t mmgErr0=0, mmgErr1=0, mmgErr2=0;
+  static MMG5_THREADLOCAL int8_t mmgErr0=0, mmgErr1=0, mmgErr2=0;
 
   if ( isnm ) assert(!mesh->adja[4*(start-1)+iface+1]);
 
-  base = ++mesh->base;
+  base = MMG3D_newVisit(mesh,vis);
   *ilists = 0;
   *ilistv = 0;
 
@@ -665,13 +835,14 @@ int MMG5_boulesurfvolp(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
       k = adj;
       pt = &mesh->tetra[k];
       adja = &mesh->adja[4*(k-1)+1];
-      if ( pt->flag != base ) {
+      vst = MMG3D_markVisit(mesh,vis,base,k);
+      if ( vst < 0 )  return -1;
+      if ( !vst ) {
         for (i=0; i<4; i++)
           if ( pt->v[i] == nump )  break;
         assert(i<4);
         listv[(*ilistv)] = 4*k+i;
         (*ilistv)++;
-        pt->flag = base;
       }
 
       /* identification of edge number in tetra k */
@@ -717,9 +888,10 @@ int MMG5_boulesurfvolp(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
       k1 = adja[i];
       if ( !k1 )  continue;
       k1/=4;
+      vst = MMG3D_markVisit(mesh,vis,base,k1);
+      if ( vst < 0 )  return -1;
+      if ( vst )  continue;
       pt1 = &mesh->tetra[k1];
-      if ( pt1->flag == base )  continue;
-      pt1->flag = base;
 
       for (j=0; j<4; j++)
         if ( pt1->v[j] == nump )  break;
@@ -780,16 +952,46 @@ int MMG5_boulesurfvolp(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
 int MMG5_boulesurfvolpNom(MMG5_pMesh mesh, MMG5_int start, int ip, int iface,
                           int64_t *listv, int *ilistv, MMG5_int *lists, int *ilists,
                           MMG5_int *refmin, MMG5_int *refplus, int isnm)
+{
+  return MMG5_boulesurfvolpNom_visit(mesh,NULL,start,ip,iface,listv,ilistv,
+                                     lists,ilists,refmin,refplus,isnm);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark visited tetra in the mesh).
+ * \param start index of the starting tetrahedron.
+ * \param ip index in \a start of the desired vertex.
+ * \param iface index in \a start of the starting face.
+ * \param listv pointer to the computed volumic ball.
+ * \param ilistv pointer to the computed volumic ball size.
+ * \param lists pointer to the computed surfacic ball.
+ * \param ilists pointer to the computed surfacic ball size.
+ * \param refmin return the reference of one of the two subdomains in presence
+ * \param refplus return the reference of the other subdomain in presence
+ * \param isnm is the vertex non-manifold?
+ * \return 1 if succesful, a negative value if the ball cannot be computed (see
+ * \ref MMG5_boulesurfvolpNom).
+ *
+ * Compute the volumic and surfacic balls of a SURFACE point and the references
+ * of the subdomains in presence, using the traversal context \a vis.
+ *
+ */
+int MMG5_boulesurfvolpNom_visit(MMG5_pMesh mesh, MMG3D_pVisit vis, MMG5_int start,
+                                int ip, int iface, int64_t *listv, int *ilistv,
+                                MMG5_int *lists, int *ilists, MMG5_int *refmin,
+                                MMG5_int *refplus, int isnm)
 {
   MMG5_pTetra   pt, pt1;
   MMG5_pxTetra  pxt;
   MMG5_int      k, k1, nump, *adja, piv, na, nb, adj, cur, nvstart, fstart, aux, base;
+  int           vst;
   int8_t        iopp, ipiv, i, j, l, isface;
-  static int8_t mmgErr0=0, mmgErr1=0, mmgErr2=0;
+  static MMG5_THREADLOCAL int8_t mmgErr0=0, mmgErr1=0, mmgErr2=0;
 
   if ( isnm ) assert(!mesh->adja[4*(start-1)+iface+1]);
 
-  base = ++mesh->base;
+  base = MMG3D_newVisit(mesh,vis);
   *ilists  = 0;
   *ilistv  = 0;
   *refmin  = -1;
@@ -834,7 +1036,9 @@ int MMG5_boulesurfvolpNom(MMG5_pMesh mesh, MMG5_int start, int ip, int iface,
       k = adj;
       pt = &mesh->tetra[k];
       adja = &mesh->adja[4*(k-1)+1];
-      if ( pt->flag != base ) {
+      vst = MMG3D_markVisit(mesh,vis,base,k);
+      if ( vst < 0 )  return -1;
+      if ( !vst ) {
         for (i=0; i<4; i++)
           if ( pt->v[i] == nump )  break;
         assert(i<4);
@@ -850,7 +1054,6 @@ int MMG5_boulesurfvolpNom(MMG5_pMesh mesh, MMG5_int start, int ip, int iface,
           }
           else if ( pt->ref != *refmin && pt->ref != *refplus ) return -2;
         }
-        pt->flag = base;
       }
 
       /* identification of edge number in tetra k */
@@ -896,9 +1099,10 @@ int MMG5_boulesurfvolpNom(MMG5_pMesh mesh, MMG5_int start, int ip, int iface,
       k1 = adja[i];
       if ( !k1 )  continue;
       k1/=4;
+      vst = MMG3D_markVisit(mesh,vis,base,k1);
+      if ( vst < 0 )  return -1;
+      if ( vst )  continue;
       pt1 = &mesh->tetra[k1];
-      if ( pt1->flag == base )  continue;
-      pt1->flag = base;
 
       for (j=0; j<4; j++)
         if ( pt1->v[j] == nump )  break;
@@ -959,6 +1163,31 @@ int MMG5_boulesurfvolpNom(MMG5_pMesh mesh, MMG5_int start, int ip, int iface,
  */
 int MMG5_bouletrid(MMG5_pMesh mesh,MMG5_int start,int iface,int ip,int *il1,MMG5_int *l1,
                     int *il2,MMG5_int *l2,MMG5_int *ip0,MMG5_int *ip1)
+{
+  return MMG5_bouletrid_visit(mesh,NULL,start,iface,ip,il1,l1,il2,l2,ip0,ip1);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark visited tetra in the mesh).
+ * \param start index of the starting tetrahedron.
+ * \param ip index of the looked ridge point.
+ * \param iface index in \a start of the starting face.
+ * \param il1 pointer to the first ball size.
+ * \param l1 pointer to the first computed ball.
+ * \param il2 pointer to the second ball size.
+ * \param l2 pointer to the second computed ball.
+ * \param ip0 index of the first extremity of the ridge.
+ * \param ip1 index of the second extremity of the ridge.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Computation of the two surface balls of a ridge point (see \ref
+ * MMG5_bouletrid). The mesh is not modified if \a vis is provided.
+ *
+ */
+int MMG5_bouletrid_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int iface,
+                         int ip,int *il1,MMG5_int *l1,int *il2,MMG5_int *l2,
+                         MMG5_int *ip0,MMG5_int *ip1)
 {
   MMG5_pTetra          pt;
   MMG5_pxTetra         pxt;
@@ -970,7 +1199,7 @@ int MMG5_bouletrid(MMG5_pMesh mesh,MMG5_int start,int iface,int ip,int *il1,MMG5
   int                  ifac,idx,idx2,idx_tmp,i1,isface;
   double               *n1,*n2,nt[3],ps1,ps2;
   int8_t               i;
-  static int8_t        mmgErr0=0,mmgErr1=0;
+  static MMG5_THREADLOCAL int8_t        mmgErr0=0,mmgErr1=0;
 
   pt = &mesh->tetra[start];
   if ( !MG_EOK(pt) )  return 0;
@@ -997,7 +1226,7 @@ int MMG5_bouletrid(MMG5_pMesh mesh,MMG5_int start,int iface,int ip,int *il1,MMG5
   iopp = iface;
   fstart = 4*k+iopp;
 
-  base = ++mesh->base;
+  base = MMG3D_newVisit(mesh,vis);
 
   /* Set pointers on lists il1 and il2 to have il1 associated to the normal of
      the face iface.*/
@@ -1053,7 +1282,9 @@ int MMG5_bouletrid(MMG5_pMesh mesh,MMG5_int start,int iface,int ip,int *il1,MMG5
       k = adj;
       pt = &mesh->tetra[k];
       adja = &mesh->adja[4*(k-1)+1];
-      pt->flag = base;
+      /* Marks are not read by this traversal: they are only kept when working
+       * on the mesh */
+      if ( !vis )  pt->flag = base;
 
       /* identification of edge number in tetra k */
       if ( !MMG3D_findEdge(mesh,pt,k,na,nb,0,&mmgErr1,&i) ) return -1;
@@ -1408,7 +1639,7 @@ int MMG5_coquil(MMG5_pMesh mesh,MMG5_int start,int ia,int64_t*list,int8_t *isbdy
   MMG5_int      *adja,piv,na,nb,adj;
   int           ilist;
   int8_t        i;
-  static int8_t mmgErr0=0, mmgErr1=0;
+  static MMG5_THREADLOCAL int8_t mmgErr0=0, mmgErr1=0;
 
   assert ( start >= 1 );
   pt = &mesh->tetra[start];
@@ -1616,7 +1847,7 @@ int MMG5_srcbdy(MMG5_pMesh mesh,MMG5_int start,int ia) {
  void MMG5_coquilFaceErrorMessage(MMG5_pMesh mesh, MMG5_int k1, MMG5_int k2) {
   MMG5_pTetra   pt;
   MMG5_int      kel1, kel2;
-  static int8_t mmgErr0;
+  static MMG5_THREADLOCAL int8_t mmgErr0;
 
   if ( mmgErr0 ) return;
 
@@ -1694,7 +1925,7 @@ int MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,MMG5_int start,MMG5_int na,MMG5_in
   MMG5_int      pradj,*adja;
   int           pri,ier,ifar_idx;
   int8_t        i;
-  static int8_t mmgErr0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgErr0 = 0;
 
 #ifndef NDEBUG
   MMG5_pxTetra  pxt;
@@ -1849,7 +2080,7 @@ int MMG5_coquilface(MMG5_pMesh mesh,MMG5_int start,int8_t iface,int ia,int64_t *
   MMG5_int      piv,adj,na,nb,pradj;
   int           ier,nbdy,ilist;
   int8_t        hasadja,i;
-  static int8_t mmgErr0=0,mmgErr1=0,mmgWarn0=0;
+  static MMG5_THREADLOCAL int8_t mmgErr0=0,mmgErr1=0,mmgWarn0=0;
 
   pt = &mesh->tetra[start];
 
@@ -512,7 +512,7 @@ int MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,MMG5_int base) {
   MMG5_int        a0,a1,a2,b0,b1,b2;
   int             i;
   uint8_t         voy,voy1;
-  static int8_t   mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
+  static MMG5_THREADLOCAL int8_t   mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
 
   /* Check edge tag consistency (between xtetra) */
   MMG3D_chkmeshedgestags(mesh);
@@ -716,7 +716,7 @@ int MMG5_chkptonbdy(MMG5_pMesh mesh,MMG5_int np){
   MMG5_pPoint      p0;
   MMG5_int         k;
   int8_t           i,j,ip;
-  static int8_t    mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREADLOCAL int8_t    mmgWarn0=0,mmgWarn1=0;
 
   for(k=1;k<=mesh->np;k++)
     mesh->point[k].flag = 0;
@@ -778,7 +778,7 @@ int MMG5_cntbdypt(MMG5_pMesh mesh, MMG5_int nump){
   MMG5_int      k,v0,v1,v2;
   int           nf;
   int8_t        i,j,ip;
-  static int8_t mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0;
 
   nf = 0;
 
@@ -910,7 +910,7 @@ int srcface(MMG5_pMesh mesh,MMG5_int n0,MMG5_int n1,MMG5_int n2) {
   MMG5_int      ref,minn,maxn,sn,k,ip0,ip1,ip2,mins,maxs,sum;
   uint16_t      tag;
   int8_t        i;
-  static int8_t mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0;
 
   minn = MG_MIN(n0,MG_MIN(n1,n2));
   maxn = MG_MAX(n0,MG_MAX(n1,n2));
@@ -47,17 +47,13 @@
 // int MMG_cas;
 // extern int MMG_npuiss,MMG_nvol,MMG_npres;
 
-#define MMG3D_KTA     7
-#define MMG3D_KTB    11
-#define MMG3D_KTC    13
-
 /* hash mesh edge v[0],v[1] (face i of iel) */
 int MMG5_hashEdgeDelone(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int iel,int i,MMG5_int *v) {
-  MMG5_int       key,*adja,iadr,jel,mins,maxs;
+  MMG5_int       *adja,iadr,jel,mins,maxs;
   int            j;
   MMG5_hedge     *ha;
 
-  /* compute key */
+  /* find edge */
   if ( v[0] < v[1] ) {
     mins = v[0];
     maxs = v[1];
@@ -66,65 +62,115 @@ int MMG5_hashEdgeDelone(MMG5_pMesh mesh,MMG5_Hash *hash,MMG5_int iel,int i,MMG5_
     mins = v[1];
     maxs = v[0];
   }
-  key = (MMG3D_KTA*(int64_t)mins + MMG3D_KTB*(int64_t)maxs)%hash->siz;
-  ha  = &hash->item[key];
+  ha = MMG5_hashProbe(hash,mins,maxs);
 
   if ( ha->a ) {
     /* identical face */
-    if ( ha->a == mins && ha->b == maxs ) {
-      iadr = (iel-1)*4 + 1;
-      adja = &mesh->adja[iadr];
-      adja[i] = ha->k;
+    iadr = (iel-1)*4 + 1;
+    adja = &mesh->adja[iadr];
+    adja[i] = ha->k;
 
-      jel  = ha->k >> 2;
-      j    = ha->k % 4;
-      iadr = (jel-1)*4 + 1;
-      adja = &mesh->adja[iadr];
-      adja[j] = iel*4 + (MMG5_int)i;
-      return 1;
-    }
-    else {
-      while ( ha->nxt && ha->nxt < hash->max ) {
-        ha = &hash->item[ha->nxt];
-        if ( ha->a == mins && ha->b == maxs ) {
-          iadr = (iel-1)*4 + 1;
-          adja = &mesh->adja[iadr];
-          adja[i] = ha->k;
-
-          jel  = ha->k >> 2;
-          j    = ha->k % 4;
-          iadr = (jel-1)*4 + 1;
-          adja = &mesh->adja[iadr];
-          adja[j] = iel*4 + (MMG5_int)i;
-          return 1;
-        }
-      }
-    }
-    ha->nxt   = hash->nxt;
-    ha        = &hash->item[hash->nxt];
-    ha->a     = mins;
-    ha->b     = maxs;
-    ha->k     = iel*4 + (MMG5_int)i;
-    hash->nxt = ha->nxt;
-    ha->nxt   = 0;
-
-    if ( hash->nxt >= hash->max ) {
-      MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,MMG5_GAP,MMG5_hedge,"face",
-                         return 0;);
-      for (j=hash->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
-    }
+    jel  = ha->k >> 2;
+    j    = ha->k % 4;
+    iadr = (jel-1)*4 + 1;
+    adja = &mesh->adja[iadr];
+    adja[j] = iel*4 + (MMG5_int)i;
     return 1;
   }
 
+  if ( hash->nitem >= hash->max ) {
+    if ( !MMG5_hashGrow(mesh,hash) ) return 0;
+    ha = MMG5_hashProbe(hash,mins,maxs);
+  }
+
   /* insert */
   ha->a = mins;
   ha->b = maxs;
   ha->k = iel*4 + (MMG5_int)i;
-  ha->nxt = 0;
+  ++hash->nitem;
 
   return 1;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param size number of elements of the ball to create.
+ * \return 1 if success, 0 if fail.
+ *
+ * Prepare the workspace of the insertion of a vertex whose ball has \a size
+ * elements. The arrays are enlarged only if the ball is larger than all the
+ * previous ones and only the slots of the hash table needed by this ball are
+ * emptied.
+ *
+ */
+static inline
+int MMG5_deloneWork(MMG5_pMesh mesh,int size) {
+  MMG5_DelWork *ws;
+  MMG5_int     siz;
+
+  ws = &mesh->delw;
+
+  /* new elements (ielnum[0] stores the number of new elements) */
+  if ( size >= ws->ielmax ) {
+    siz = MG_MAX(2*ws->ielmax,size+1);
+    if ( ws->ielnum ) {
+      MMG5_DEL_MEM(mesh,ws->ielnum);
+    }
+    ws->ielmax = 0;
+    MMG5_ADD_MEM(mesh,siz*sizeof(MMG5_int),"delaunay workspace",return 0);
+    MMG5_SAFE_MALLOC(ws->ielnum,siz,MMG5_int,
+                     mesh->memCur -= siz*sizeof(MMG5_int);return 0);
+    ws->ielmax = siz;
+    ++ws->nalloc;
+  }
+
+  /* internal faces: same number of slots than a table created by
+   * MMG5_hashNew(mesh,hash,size,3*size). The ball has 3*size/2 internal faces
+   * so the table is never enlarged by MMG5_hashEdgeDelone. */
+  siz = 16;
+  while ( siz < 3*size ) {
+    siz *= 2;
+  }
+  if ( siz > ws->hcap ) {
+    if ( ws->hash.item ) {
+      MMG5_DEL_MEM(mesh,ws->hash.item);
+    }
+    ws->hcap = 0;
+    MMG5_ADD_MEM(mesh,siz*sizeof(MMG5_hedge),"delaunay workspace",return 0);
+    MMG5_SAFE_MALLOC(ws->hash.item,siz,MMG5_hedge,
+                     mesh->memCur -= siz*sizeof(MMG5_hedge);return 0);
+    ws->hcap = siz;
+    ++ws->nalloc;
+  }
+  memset(ws->hash.item,0,siz*sizeof(MMG5_hedge));
+  ws->hash.siz = siz;
+  ws->hash.max = (MMG5_int)(MMG5_HASHLOAD*siz);
+  ws->hash.nitem = 0;
+
+  ++ws->nins;
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ *
+ * Release the workspace of the Delaunay insertion.
+ *
+ */
+void MMG5_freeDeloneWork(MMG5_pMesh mesh) {
+  MMG5_DelWork *ws;
+
+  ws = &mesh->delw;
+  if ( ws->hash.item ) {
+    MMG5_DEL_MEM(mesh,ws->hash.item);
+  }
+  if ( ws->ielnum ) {
+    MMG5_DEL_MEM(mesh,ws->ielnum);
+  }
+  memset(ws,0,sizeof(MMG5_DelWork));
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param sol pointer to the solution structure.
@@ -144,11 +190,11 @@ int MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,int64_t *list,int ilis
   MMG5_pxTetra  pxt0;
   MMG5_int      base,*adja,*adjb,iel,jel,old,v[3],iadr;
   int           i,j,k,l,m,size;
-  MMG5_int      vois[4],iadrold,ielnum[3*MMG3D_LONMAX+1];
+  MMG5_int      vois[4],iadrold,*ielnum;
   short         i1;
   char          alert;
   int           isused = 0,ixt;
-  MMG5_Hash     hedg;
+  MMG5_Hash     *hedg;
 #ifndef NDEBUG
   MMG5_int      tref;
 #endif
@@ -199,10 +245,12 @@ int MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,int64_t *list,int ilis
   if ( alert )  {return 0;}
   /* hash table params */
   if ( size > 3*MMG3D_LONMAX )  return 0;
-  if ( !MMG5_hashNew(mesh,&hedg,size,3*size) ) { /*3*size suffit */
+  if ( !MMG5_deloneWork(mesh,size) ) {
     fprintf(stderr,"\n  ## Error: %s: unable to complete mesh.\n",__func__);
     return -1;
   }
+  hedg   = &mesh->delw.hash;
+  ielnum = mesh->delw.ielnum;
 
   /*tetra allocation : we create "size" tetra*/
   ielnum[0] = size;
@@ -313,13 +361,15 @@ int MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,int64_t *list,int ilis
                 v[m] = pt1->v[ MMG5_idir[j][l] ];
                 m++;
               }
-            MMG5_hashEdgeDelone(mesh,&hedg,iel,j,v);
+            MMG5_hashEdgeDelone(mesh,hedg,iel,j,v);
           }
         }
       }
     }
   }
 
+  assert ( hedg->siz <= mesh->delw.hcap && hedg->nitem <= hedg->max );
+
   /* remove old tetra */
 #ifndef NDEBUG
   tref = mesh->tetra[list[0]].ref;
@@ -331,7 +381,6 @@ int MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,int64_t *list,int ilis
 
   // ppt = &mesh->point[ip];
   // ppt->flag = mesh->flag;
-  MMG5_DEL_MEM(mesh,hedg.item);
   return 1;
 }
 
@@ -83,31 +83,253 @@ int MMG5_paktet(MMG5_pMesh mesh) {
 /** return index of triangle ia ib ic */
 MMG5_int MMG5_hashGetFace(MMG5_Hash *hash,MMG5_int ia,MMG5_int ib,MMG5_int ic) {
   MMG5_hedge  *ph;
-  MMG5_int    key;
   MMG5_int    mins,maxs,sum;
 
   if ( !hash->item )  return 0;
 
   mins = MG_MIN(ia,MG_MIN(ib,ic));
   maxs = MG_MAX(ia,MG_MAX(ib,ic));
+  sum  = ia + ib + ic;
+
+  ph = MMG5_hashProbeFace(hash,mins,maxs,sum);
+
+  return ph->a ? ph->k : 0;
+}
+
+/**
+ * \struct MMG3D_FaceKey
+ * \brief Key of an element face in its bucket (the bucket of a face is its
+ * smallest vertex index).
+ */
+typedef struct {
+  MMG5_int b; /*!< second smallest vertex index of the face */
+  MMG5_int c; /*!< largest vertex index of the face */
+  MMG5_int l; /*!< index of the face in the adjacency table */
+} MMG3D_FaceKey;
+
+/** Compute the key of face \a i of element \a k: return its smallest vertex
+ * index (0 if the element is unused) and fill the \a b and \a c fields */
+typedef MMG5_int (*MMG3D_pFaceKey)(MMG5_pMesh,MMG5_int,int,MMG5_int*,MMG5_int*);
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param k index of the tetra.
+ * \param i index of the face in the tetra.
+ * \param b pointer to the second smallest vertex index of the face.
+ * \param c pointer to the largest vertex index of the face.
+ * \return the smallest vertex index of the face, 0 if the tetra is unused.
+ *
+ * Key of a tetra face.
+ *
+ */
+static MMG5_int MMG3D_tetFaceKey(MMG5_pMesh mesh,MMG5_int k,int i,
+                                 MMG5_int *b,MMG5_int *c) {
+  MMG5_pTetra pt;
+  MMG5_int    v0,v1,v2,min01,max01;
+
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) )  return 0;
+
+  v0 = pt->v[MMG5_idir[i][0]];
+  v1 = pt->v[MMG5_idir[i][1]];
+  v2 = pt->v[MMG5_idir[i][2]];
+
+  min01 = MG_MIN(v0,v1);
+  max01 = MG_MAX(v0,v1);
+
+  *b = MG_MAX(min01,MG_MIN(max01,v2));
+  *c = MG_MAX(max01,v2);
+
+  return MG_MIN(min01,v2);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param k index of the prism.
+ * \param i index of the face in the prism.
+ * \param b pointer to the second smallest vertex index of the face.
+ * \param c pointer to the largest vertex index of the face.
+ * \return the smallest vertex index of the face.
+ *
+ * Key of a prism face (triangular or quadrilateral).
+ *
+ */
+static MMG5_int MMG3D_priFaceKey(MMG5_pMesh mesh,MMG5_int k,int i,
+                                 MMG5_int *b,MMG5_int *c) {
+  MMG5_pPrism pp;
+  MMG5_int    min12,max12,min34,max34;
+
+  pp = &mesh->prism[k];
+
+  min12 = MG_MIN(pp->v[MMG5_idir_pr[i][0]],pp->v[MMG5_idir_pr[i][1]]);
+  max12 = MG_MAX(pp->v[MMG5_idir_pr[i][0]],pp->v[MMG5_idir_pr[i][1]]);
 
-  /* compute key */
-  sum = ia + ib + ic;
-  key = (MMG5_KA*(int64_t)mins + MMG5_KB*(int64_t)maxs) % hash->siz;
-  ph  = &hash->item[key];
+  if ( i < 2 ) {
+    /* Triangular face */
+    *b = MG_MAX(min12,MG_MIN(max12,pp->v[MMG5_idir_pr[i][2]]));
+    *c = MG_MAX(max12,pp->v[MMG5_idir_pr[i][2]]);
+    return MG_MIN(min12,pp->v[MMG5_idir_pr[i][2]]);
+  }
+
+  /* Quadrilateral face */
+  min34 = MG_MIN(pp->v[MMG5_idir_pr[i][2]],pp->v[MMG5_idir_pr[i][3]]);
+  max34 = MG_MAX(pp->v[MMG5_idir_pr[i][2]],pp->v[MMG5_idir_pr[i][3]]);
+
+  *b = MG_MIN( MG_MIN(max12,max34),MG_MAX(min12,min34));
+  *c = MG_MAX(max12,max34);
+  return MG_MIN(min12,min34);
+}
+
+/**
+ * \param a pointer to the first face key.
+ * \param b pointer to the second face key.
+ * \return -1, 0 or 1 if \a a is lower, equal or greater than \a b.
+ *
+ * Compare two face keys of a bucket, then the indices of the faces.
+ *
+ */
+static int MMG3D_cmpFaceKey(const void *a,const void *b) {
+  const MMG3D_FaceKey *fa = (const MMG3D_FaceKey*)a;
+  const MMG3D_FaceKey *fb = (const MMG3D_FaceKey*)b;
+
+  if ( fa->b != fb->b ) return fa->b < fb->b ? -1 : 1;
+  if ( fa->c != fb->c ) return fa->c < fb->c ? -1 : 1;
+  if ( fa->l != fb->l ) return fa->l < fb->l ? -1 : 1;
+  return 0;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param nelt number of elements.
+ * \param nfac number of faces per element.
+ * \param faceKey function that computes the key of a face.
+ * \param link adjacency table to fill (allocated and set to 0).
+ * \param nc number of threads.
+ * \return 1 if success, 0 if the work arrays can't be allocated.
+ *
+ * Build the face adjacency by sorting the face keys instead of hashing them.
+ * Face \a i of element \a k is stored at index \a nfac*(k-1)+1+i of \a link.
+ * Its neighbour is encoded as \a nfac*kk+ii. Face keys are first bucketed by
+ * smallest vertex (counting sort). Each bucket is then sorted by the two other
+ * vertex indices and by face index, so identical faces are contiguous. The
+ * buckets are independent and processed in parallel.
+ *
+ * On a single thread, the scattered writes of the bucket fill make it slower
+ * than the hash table, so it is only used when several threads are available.
+ *
+ * When more than 2 faces share the same key, they are paired by decreasing
+ * index, as in the hash-based builders, so the adjacency doesn't depend on
+ * the builder nor on the number of threads.
+ *
+ */
+static int MMG3D_hashFaces_sort(MMG5_pMesh mesh,MMG5_int nelt,int nfac,
+                                MMG3D_pFaceKey faceKey,MMG5_int *link,int nc) {
+  MMG3D_FaceKey *keys;
+  MMG5_int      *head,nf,k,v,b,c,pos;
+  size_t        siz;
+  int           i;
+
+  nf = nfac*nelt;
+
+  /* Quiet fall back on the hash tables if the work arrays don't fit in the
+   * authorized memory */
+  siz = (mesh->np+3)*sizeof(MMG5_int) + (nf+1)*sizeof(MMG3D_FaceKey);
+  if ( mesh->memCur + siz > mesh->memMax ) return 0;
+
+  mesh->memCur += (mesh->np+3)*sizeof(MMG5_int);
+  MMG5_SAFE_CALLOC(head,mesh->np+3,MMG5_int,
+                   mesh->memCur -= (mesh->np+3)*sizeof(MMG5_int);return 0);
+
+  mesh->memCur += (nf+1)*sizeof(MMG3D_FaceKey);
+  MMG5_SAFE_MALLOC(keys,nf+1,MMG3D_FaceKey,
+                   mesh->memCur -= (nf+1)*sizeof(MMG3D_FaceKey);
+                   MMG5_DEL_MEM(mesh,head);return 0);
+
+  /* Number of faces per bucket */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nc) private(i,v,b,c)
+#endif
+  for (k=1; k<=nelt; k++) {
+    for (i=0; i<nfac; i++) {
+      v = faceKey(mesh,k,i,&b,&c);
+      if ( !v ) continue;
+#ifdef USE_OPENMP
+#pragma omp atomic
+#endif
+      ++head[v+2];
+    }
+  }
+
+  /* head[v+1] is the first face of bucket v */
+  for (v=1; v<=mesh->np; v++) {
+    head[v+2] += head[v+1];
+  }
+
+  /* Fill the buckets: at the end, head[v] is the first face of bucket v and
+   * head[v+1] the first face of bucket v+1 */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nc) private(i,v,b,c,pos)
+#endif
+  for (k=1; k<=nelt; k++) {
+    for (i=0; i<nfac; i++) {
+      v = faceKey(mesh,k,i,&b,&c);
+      if ( !v ) continue;
+#ifdef USE_OPENMP
+#pragma omp atomic capture
+#endif
+      pos = head[v+1]++;
+
+      keys[pos].b = b;
+      keys[pos].c = c;
+      keys[pos].l = nfac*(k-1)+1+i;
+    }
+  }
 
-  if ( ph->a ) {
-    if ( ph->a == mins && ph->b == maxs && ph->s == sum )
-      return ph->k;
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nc) schedule(dynamic,1024)
+#endif
+  for (v=1; v<=mesh->np; v++) {
+    MMG3D_FaceKey *fk,tmp;
+    MMG5_int      n,j,jj,s,e,la,lb;
+
+    fk = &keys[head[v]];
+    n  = head[v+1]-head[v];
+    if ( n < 2 ) continue;
+
+    /* Sort the bucket (faces are not ordered after a parallel fill) */
+    if ( n <= 32 ) {
+      for (j=1; j<n; j++) {
+        tmp = fk[j];
+        for (jj=j; jj>0 && MMG3D_cmpFaceKey(&fk[jj-1],&tmp)>0; jj--) {
+          fk[jj] = fk[jj-1];
+        }
+        fk[jj] = tmp;
+      }
+    }
     else {
-      while ( ph->nxt ) {
-        ph = &hash->item[ph->nxt];
-        if ( ph->a == mins && ph->b == maxs && ph->s == sum )  return ph->k;
+      qsort(fk,n,sizeof(MMG3D_FaceKey),MMG3D_cmpFaceKey);
+    }
+
+    /* Pair identical faces by decreasing index */
+    e = n;
+    while ( e > 0 ) {
+      s = e-1;
+      while ( s > 0 && fk[s-1].b == fk[e-1].b && fk[s-1].c == fk[e-1].c ) --s;
+
+      for (j=e-1; j>s; j-=2) {
+        la = fk[j].l;
+        lb = fk[j-1].l;
+        link[la] = lb + nfac-1;
+        link[lb] = la + nfac-1;
       }
+      e = s;
     }
   }
 
-  return 0;
+  MMG5_DEL_MEM(mesh,keys);
+  MMG5_DEL_MEM(mesh,head);
+
+  return 1;
 }
 
 /**
@@ -124,6 +346,7 @@ int MMG3D_hashTetra(MMG5_pMesh mesh, int pack) {
   MMG5_int       key;
   MMG5_int       k,kk,pp,l,ll,mins,mins1,maxs,maxs1,sum,sum1,iadr;
   MMG5_int       *hcode,*link,hsize,inival;
+  int            nc;
   uint8_t        i,ii,i1,i2,i3;
 
   /* default */
@@ -144,6 +367,14 @@ int MMG3D_hashTetra(MMG5_pMesh mesh, int pack) {
                 fprintf(stderr,"  Exit program.\n");
                 return 0);
   MMG5_SAFE_CALLOC(mesh->adja,4*mesh->nemax+5,MMG5_int,return 0);
+
+  /* Several threads: sort the faces in parallel if memory allows it */
+  nc = MMG5_nthreads(mesh,mesh->ne);
+  if ( nc > 1 && MMG3D_hashFaces_sort(mesh,mesh->ne,4,MMG3D_tetFaceKey,
+                                      mesh->adja,nc) ) {
+    return 1;
+  }
+
   MMG5_SAFE_CALLOC(hcode,mesh->ne+5,MMG5_int,return 0);
 
   link  = mesh->adja;
@@ -244,6 +475,7 @@ int MMG3D_hashPrism(MMG5_pMesh mesh) {
   MMG5_int       max12,min12,max34,min34,mins,mins1,mins_b, mins_b1,maxs,maxs1;
   MMG5_int       iadr;
   MMG5_int       *hcode,*link,hsize,inival;
+  int            nc;
   uint8_t        i,ii,i1,i2,i3,i4;
 
   if ( !mesh->nprism ) return 1;
@@ -265,6 +497,14 @@ int MMG3D_hashPrism(MMG5_pMesh mesh) {
                 printf("  Exit program.\n");
                 return 0);
   MMG5_SAFE_CALLOC(mesh->adjapr,5*mesh->nprism+6,MMG5_int,return 0);
+
+  /* Several threads: sort the faces in parallel if memory allows it */
+  nc = MMG5_nthreads(mesh,mesh->nprism);
+  if ( nc > 1 && MMG3D_hashFaces_sort(mesh,mesh->nprism,5,MMG3D_priFaceKey,
+                                      mesh->adjapr,nc) ) {
+    return 1;
+  }
+
   MMG5_SAFE_CALLOC(hcode,mesh->nprism+6,MMG5_int,return 0);
 
   link  = mesh->adjapr;
@@ -464,12 +704,11 @@ int MMG5_setEdgeNmTag(MMG5_pMesh mesh, MMG5_Hash *hash) {
   MMG5_hedge          *ph;
   MMG5_int            adj,pradj,piv;
   int64_t             list[MMG3D_LMAX+2];
-  MMG5_int            key;
   MMG5_int            k,l,i1,i2,na,nb,ia,it1,it2, nr;
   MMG5_int            start;
   int                 ilist,nbdy,ipa,ipb;
   int8_t              iface,hasadja,i;
-  static int8_t       mmgWarn0=0,mmgWarn1=0;
+  static MMG5_THREADLOCAL int8_t       mmgWarn0=0,mmgWarn1=0;
 
   nr = 0;
 
@@ -489,18 +728,12 @@ int MMG5_setEdgeNmTag(MMG5_pMesh mesh, MMG5_Hash *hash) {
         i1 = MMG5_inxt2[l];
         i2 = MMG5_iprv2[l];
 
-        /* compute key */
+        /* find edge */
         na  = MG_MIN(ptt->v[i1],ptt->v[i2]);
         nb  = MG_MAX(ptt->v[i1],ptt->v[i2]);
-        key = (MMG5_KA*na + MMG5_KB*nb) % hash->siz;
-        ph  = &hash->item[key];
+        ph  = MMG5_hashProbe(hash,na,nb);
 
         assert(ph->a);
-        while ( ph->a ) {
-          if ( ph->a == na && ph->b == nb ) break;
-          assert(ph->nxt);
-          ph = &hash->item[ph->nxt];
-        }
         /* Set edge tag and point tags to MG_REQ if the non-manifold edge shared
          * separated domains */
         if ( ph->s > 3 ) {
@@ -848,54 +1081,33 @@ int MMG3D_hashTria(MMG5_pMesh mesh, MMG5_Hash *hash) {
 
 /** remove edge from hash table */
 int MMG5_hashPop(MMG5_Hash *hash,MMG5_int a,MMG5_int b) {
-  MMG5_hedge  *ph,*php;
-  MMG5_int    key;
-  MMG5_int    ia,ib,iph,iphp;
+  MMG5_hedge  *ph;
+  MMG5_int    ia,ib,i,j,key,msk;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (MMG5_KA*(int64_t)ia + MMG5_KB*(int64_t)ib) % hash->siz;
-  ph  = &hash->item[key];
+  ph  = MMG5_hashProbe(hash,ia,ib);
 
   if ( !ph->a ) return 0;
-  else if ( ph->a == ia && ph->b == ib ) {
-    if ( !ph->nxt ) {
-      memset(ph,0,sizeof(MMG5_hedge));
-      return 1;
-    }
-    else {
-      iph = ph->nxt;
-      php = ph;
-      ph  = &hash->item[ph->nxt];
-      memcpy(php,ph,sizeof(MMG5_hedge));
-      memset(ph,0,sizeof(MMG5_hedge));
-      ph->nxt   = hash->nxt;
-      hash->nxt = iph;
-      return 1;
-    }
-  }
-  while ( ph->nxt ) {
-    php = ph;
-    ph  = &hash->item[ph->nxt];
-    if ( ph->a == ia && ph->b == ib ) {
-      if ( !ph->nxt ) {
-        memset(ph,0,sizeof(MMG5_hedge));
-        ph->nxt   = hash->nxt;
-        hash->nxt = php->nxt;
-        php->nxt  = 0;
-      }
-      else {
-        iph  = ph->nxt;
-        iphp = php->nxt;
-        php->nxt = iph;
-        memset(ph,0,sizeof(MMG5_hedge));
-        ph->nxt   = hash->nxt;
-        hash->nxt = iphp;
-      }
-      return 1;
-    }
+
+  /* backward shift: move back the next items of the cluster that may not be
+   * reached anymore from their home slot */
+  msk = hash->siz-1;
+  i   = ph - hash->item;
+  j   = i;
+  while ( 1 ) {
+    j = (j+1) & msk;
+    if ( !hash->item[j].a ) break;
+    key = MMG5_hashKey(hash,hash->item[j].a,hash->item[j].b);
+    /* item j stays in place if its home slot lies cyclically in ]i;j] */
+    if ( ((j-key) & msk) < ((j-i) & msk) ) continue;
+    hash->item[i] = hash->item[j];
+    i = j;
   }
-  return 0;
+  memset(&hash->item[i],0,sizeof(MMG5_hedge));
+  --hash->nitem;
+
+  return 1;
 }
 
 
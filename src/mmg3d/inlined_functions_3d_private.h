@@ -248,6 +248,34 @@ inline double MMG5_lenedg_iso(MMG5_pMesh mesh,MMG5_pSol met,int ia,
   return MMG5_lenSurfEdg_iso(mesh,met,ip1,ip2,0);
 }
 
+/**
+ * \param hp compact copy of the points (see \ref MMG3D_hotPoints).
+ * \param ia index of edge in tetra \a pt .
+ * \param pt pointer to the tetra from which we come.
+ * \return length of edge according to the prescribed iso metric.
+ *
+ * Same as \ref MMG5_lenedg_iso but reading the coordinates and sizes from the
+ * compact copy of the points (the result is identical).
+ *
+ */
+static
+inline double MMG3D_lenedg_iso_hot(MMG3D_pHotPoint hp,int ia,MMG5_pTetra pt) {
+  MMG3D_pHotPoint p1,p2;
+  double          h1,h2,l,r,len;
+
+  p1 = &hp[pt->v[MMG5_iare[ia][0]]];
+  p2 = &hp[pt->v[MMG5_iare[ia][1]]];
+  h1 = p1->h;
+  h2 = p2->h;
+  l = (p2->c[0]-p1->c[0])*(p2->c[0]-p1->c[0]) + (p2->c[1]-p1->c[1])*(p2->c[1]-p1->c[1]) \
+    + (p2->c[2]-p1->c[2])*(p2->c[2]-p1->c[2]);
+  l = sqrt(l);
+  r = h2 / h1 - 1.0;
+  len = fabs(r) < MMG5_EPS ? l / h1 : l / (h2-h1) * log1p(r);
+
+  return len;
+}
+
 static
 inline double MMG5_lenedgspl_iso(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
                                   MMG5_pTetra pt) {
@@ -414,6 +442,22 @@ inline double MMG5_caltet_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra  pt) {
 
 }
 
+/**
+ * \param hp compact copy of the points (see \ref MMG3D_hotPoints).
+ * \param pt pointer to a tetrahedra.
+ * \return The isotropic quality of the tet.
+ *
+ * Same as \ref MMG5_caltet_iso but reading the coordinates from the compact
+ * copy of the points.
+ *
+ */
+static
+inline double MMG3D_caltet_iso_hot(MMG3D_pHotPoint hp,MMG5_pTetra pt) {
+
+  return MMG5_caltet_iso_4pt(hp[pt->v[0]].c,hp[pt->v[1]].c,
+                             hp[pt->v[2]].c,hp[pt->v[3]].c);
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the meric structure.
@@ -67,12 +67,12 @@ int MMG3D_openMesh(int imprim,const char *filename,FILE **inm,int *bin,
   if ( !ptr ) {
     /* data contains the filename without extension */
     strcat(data,".meshb");
-    if( !(*inm = fopen(data,modeBIN)) ) {
+    if( !(*inm = MMG5_fopen(data,modeBIN)) ) {
       /* our file is not a .meshb file, try with .mesh ext */
       ptr = strstr(data,".mesh");
       *ptr = '\0';
       strcat(data,".mesh");
-      if( !(*inm = fopen(data,modeASCII)) ) {
+      if( !(*inm = MMG5_fopen(data,modeASCII)) ) {
         MMG5_SAFE_FREE(data);
         return 0;
       }
@@ -83,7 +83,7 @@ int MMG3D_openMesh(int imprim,const char *filename,FILE **inm,int *bin,
     ptr = strstr(data,".meshb");
     if ( ptr ) {
       *bin = 1;
-      if( !(*inm = fopen(data,modeBIN)) ) {
+      if( !(*inm = MMG5_fopen(data,modeBIN)) ) {
         if ( out ) {
           fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
         }
@@ -92,7 +92,7 @@ int MMG3D_openMesh(int imprim,const char *filename,FILE **inm,int *bin,
       }
     }
     else {
-      if( !(*inm = fopen(data,modeASCII)) ) {
+      if( !(*inm = MMG5_fopen(data,modeASCII)) ) {
         if ( out ) {
           fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
         }
@@ -110,6 +110,28 @@ int MMG3D_openMesh(int imprim,const char *filename,FILE **inm,int *bin,
  return 1;
 }
 
+/**
+ * \param tb pointer to the tokenizer.
+ * \param k index of the record (from 0).
+ * \param data pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the vertices and the reference of the tetrahedron \a k+1 from the
+ * Tetrahedra section of a mesh (reader of \ref MMG5_txtRecords). The
+ * reference is stored as read, its sign is processed by the caller.
+ *
+ */
+static
+int MMG3D_txtTetra(MMG5_pTxtBuf tb,MMG5_int k,void *data) {
+  MMG5_pMesh  mesh = (MMG5_pMesh)data;
+  MMG5_pTetra pt;
+
+  pt = &mesh->tetra[k+1];
+  return MMG5_txtInt(tb,&pt->v[0]) && MMG5_txtInt(tb,&pt->v[1]) &&
+    MMG5_txtInt(tb,&pt->v[2]) && MMG5_txtInt(tb,&pt->v[3]) &&
+    MMG5_txtInt(tb,&pt->ref);
+}
+
 int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   MMG5_pTetra pt;
   MMG5_pPrism pp;
@@ -117,6 +139,9 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   MMG5_pQuad  pq1;
   MMG5_pEdge  pa;
   MMG5_pPoint ppt;
+  MMG5_MeshbMap mb;
+  MMG5_TxtBuf tb;
+  const char  *cur;
   double      *norm,*n,dd;
   float       fc;
   long        posnp,posnt,posne,posned,posncor,posnpreq,posntreq,posnereq,posnedreq;
@@ -127,7 +152,7 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   MMG5_int    k,ip,idn;
   int         i,bdim,binch,iswp,bpos;
   MMG5_int    na,nr,ia,aux,nref,ref;
-  char        chaine[MMG5_FILESTR_LGTH],strskip[MMG5_FILESTR_LGTH];
+  char        chaine[MMG5_FILESTR_LGTH];
 
   posnp = posnt = posne = posncor = 0;
   posnpreq = posntreq = posnereq = posnqreq = posned = posnedreq = posnr = 0;
@@ -139,116 +164,158 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   bpos = ia = idn = ip = 0;
   mesh->np = mesh->nt = mesh->ne = 0;
   nref = 0;
+  mb.buf = NULL;
+  tb.buf = NULL;
+  cur = NULL;
 
 
   if (!bin) {
+    if ( !MMG5_txtInit(mesh,inm,&tb) ) return -1;
     strcpy(chaine,"D");
-    while(fscanf(inm,"%127s",&chaine[0])!=EOF && strncmp(chaine,"End",strlen("End")) ) {
+    while(MMG5_txtKeyword(&tb,chaine,MMG5_FILESTR_LGTH) && strncmp(chaine,"End",strlen("End")) ) {
       if ( chaine[0] == '#' ) {
-        while(1){           // skip until end of line or file
-          char *s = fgets(strskip,MMG5_FILESTR_LGTH,inm);
-          if(!s) break;     // nothing could be read
-          if(s[strlen(s)-1]=='\n') break;   // end of line
-        }
+        // skip until end of line or file
+        MMG5_txtSkipLine(&tb);
         continue;
       }
 
       if(!strncmp(chaine,"MeshVersionFormatted",strlen("MeshVersionFormatted"))) {
-        MMG_FSCANF(inm,"%d",&mesh->ver);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&mesh->ver));
         continue;
       } else if(!strncmp(chaine,"Dimension",strlen("Dimension"))) {
-        MMG_FSCANF(inm,"%d",&mesh->dim);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&mesh->dim));
         if(mesh->dim!=3) {
           fprintf(stderr,"BAD DIMENSION : %d\n",mesh->dim);
+          MMG5_txtFree(&tb);
           return -1;
         }
         continue;
       } else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->npi);
-        posnp = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->npi));
+        posnp = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&npreq);
-        posnpreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&npreq));
+        posnpreq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"ParallelVertices",strlen("ParallelVertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nppar);
-        posnppar = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nppar));
+        posnppar = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
         if ( !strncmp(chaine,"TrianglesP",strlen("TrianglesP")) ) continue;
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nti);
-        posnt = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nti));
+        posnt = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"RequiredTriangles",strlen("RequiredTriangles"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ntreq);
-        posntreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ntreq));
+        posntreq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"ParallelTriangles",strlen("ParallelTriangles"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ntpar);
-        posntpar = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ntpar));
+        posntpar = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nquad);
-        posnq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nquad));
+        posnq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"RequiredQuadrilaterals",strlen("RequiredQuadrilaterals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nqreq);
-        posnqreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nqreq));
+        posnqreq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"ParallelQuadrilaterals",strlen("ParallelQuadrilaterals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nqpar);
-        posnqpar = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nqpar));
+        posnqpar = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Tetrahedra",strlen("Tetrahedra"))) {
         if ( !strncmp(chaine,"TetrahedraP",strlen("TetrahedraP")) ) continue;
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nei);
-        posne = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nei));
+        posne = MMG5_txtTell(&tb);
         continue;
       } else if((!strncmp(chaine,"Prisms",strlen("Prisms")))||
                 (!strncmp(chaine,"Pentahedra",strlen("Pentahedra")))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nprism);
-        posnprism = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nprism));
+        posnprism = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"RequiredTetrahedra",strlen("RequiredTetrahedra"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nereq);
-        posnereq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nereq));
+        posnereq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"ParallelTetrahedra",strlen("ParallelTetrahedra"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nepar);
-        posnepar = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nepar));
+        posnepar = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ncor);
-        posncor = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ncor));
+        posncor = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nai);
-        posned = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nai));
+        posned = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nedreq);
-        posnedreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nedreq));
+        posnedreq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"ParallelEdges",strlen("ParallelEdges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nedpar);
-        posnedpar = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nedpar));
+        posnedpar = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Ridges",strlen("Ridges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nr);
-        posnr = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nr));
+        posnr = MMG5_txtTell(&tb);
         continue;
       } else if(!ng && !strncmp(chaine,"Normals",strlen("Normals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ng);
-        posnormal = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ng));
+        posnormal = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"NormalAtVertices",strlen("NormalAtVertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nc1);
-        posnc1 = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nc1));
+        posnc1 = MMG5_txtTell(&tb);
         continue;
       }
     }
+  } else if ( MMG5_mapMeshb(inm,&mb) ) {
+    /* binary file mapped in memory: sections are located from the keyword
+     * table */
+    iswp      = mb.iswp;
+    mesh->ver = mb.ver;
+    if ( mb.dim ) {
+      mesh->dim = mb.dim;
+      if(mesh->dim!=3) {
+        fprintf(stderr,"BAD MESH DIMENSION : %d\n",mesh->dim);
+        fprintf(stderr," Exit program.\n");
+        MMG5_unmapMeshb(&mb);
+        return -1;
+      }
+    }
+    mesh->npi    = mb.num[4];  posnp     = mb.pos[4];  //Vertices
+    npreq        = mb.num[15]; posnpreq  = mb.pos[15]; //RequiredVertices
+    mesh->nti    = mb.num[6];  posnt     = mb.pos[6];  //Triangles
+    ntreq        = mb.num[17]; posntreq  = mb.pos[17]; //RequiredTriangles
+    mesh->nquad  = mb.num[7];  posnq     = mb.pos[7];  //Quadrilaterals
+    nqreq        = mb.num[18]; posnqreq  = mb.pos[18]; //RequiredQuadrilaterals
+    mesh->nei    = mb.num[8];  posne     = mb.pos[8];  //Tetra
+    mesh->nprism = mb.num[9];  posnprism = mb.pos[9];  //Prism
+    nereq        = mb.num[12]; posnereq  = mb.pos[12]; //RequiredTetra
+    ncor         = mb.num[13]; posncor   = mb.pos[13]; //Corners
+    mesh->nai    = mb.num[5];  posned    = mb.pos[5];  //Edges
+    nedreq       = mb.num[16]; posnedreq = mb.pos[16]; //RequiredEdges
+    nr           = mb.num[14]; posnr     = mb.pos[14]; //Ridges
+    ng           = mb.num[60]; posnormal = mb.pos[60]; //Normals
+    mesh->nc1    = mb.num[20]; posnc1    = mb.pos[20]; //NormalAtVertices
+
+    if ( !(MMG5_mapFits(&mb,posnp,mesh->npi,1,3)     &&
+           MMG5_mapFits(&mb,posnt,mesh->nti,4,0)     &&
+           MMG5_mapFits(&mb,posnq,mesh->nquad,5,0)   &&
+           MMG5_mapFits(&mb,posne,mesh->nei,5,0)     &&
+           MMG5_mapFits(&mb,posnprism,mesh->nprism,7,0) &&
+           MMG5_mapFits(&mb,posned,mesh->nai,3,0)) ) {
+      fputs ( "Reading error", stderr );
+      MMG5_unmapMeshb(&mb);
+      return -1;
+    }
   } else { //binary file
     bdim = 0;
     MMG_FREAD(&mesh->ver,MMG5_SW,1,inm);
@@ -425,6 +492,8 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     fprintf(stderr,"  ** MISSING DATA.\n");
     fprintf(stderr," Check that your mesh contains points and tetrahedra.\n");
     fprintf(stderr," Exit program.\n");
+    MMG5_unmapMeshb(&mb);
+    MMG5_txtFree(&tb);
     return -1;
   }
   /* memory allocation */
@@ -432,43 +501,48 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   mesh->nt = mesh->nti;
   mesh->ne = mesh->nei;
   mesh->na = mesh->nai;
-  if ( !MMG3D_zaldy(mesh) )  return 0;
+  if ( !MMG3D_zaldy(mesh) ) {
+    MMG5_unmapMeshb(&mb);
+    MMG5_txtFree(&tb);
+    return 0;
+  }
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt || mesh->nemax < mesh->ne) {
+    MMG5_unmapMeshb(&mb);
+    MMG5_txtFree(&tb);
     return -1;
   }
 
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  if ( tb.buf ) {
+    MMG5_txtSeek(&tb,posnp);
+    MMG5_TXT_READ(&tb,MMG5_txtRecords(mesh,&tb,mesh->np,4,MMG5_txtPoint,mesh));
+  }
+  if ( mb.buf ) cur = mb.buf + posnp;
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
-        for (i=0 ; i<3 ; i++) {
-          MMG_FSCANF(inm,"%f",&fc);
-          ppt->c[i] = (double) fc;
-        }
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ppt->ref);
-      } else {
+    if ( mb.buf ) {
+      for (i=0 ; i<3 ; i++) {
+        ppt->c[i] = MMG5_mapReal(&mb,&cur);
+      }
+      ppt->ref = MMG5_mapInt(&mb,&cur);
+    }
+    else if ( bin ) {
+      if (mesh->ver < 2) { /*float*/
         for (i=0 ; i<3 ; i++) {
           MMG_FREAD(&fc,MMG5_SW,1,inm);
           if(iswp) fc=MMG5_swapf(fc);
           ppt->c[i] = (double) fc;
         }
-        MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
-        if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
-      }
-    } else {
-      if (!bin) {
-        MMG_FSCANF(inm,"%lf %lf %lf %" MMG5_PRId "",&ppt->c[0],&ppt->c[1],&ppt->c[2],&ppt->ref);
       }
       else {
         for (i=0 ; i<3 ; i++) {
           MMG_FREAD(&ppt->c[i],MMG5_SD,1,inm);
           if(iswp) ppt->c[i]=MMG5_swapd(ppt->c[i]);
         }
-        MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
-        if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
       }
+      MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
+      if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
     }
 
     if ( ppt->ref < 0 ) {
@@ -483,9 +557,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   if(npreq) {
     rewind(inm);
     fseek(inm,posnpreq,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnpreq);
     for (k=1; k<=npreq; k++) {
       if(!bin) {
-        MMG_FSCANF(inm,"%d",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -505,9 +580,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   if(nppar) {
     rewind(inm);
     fseek(inm,posnppar,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnppar);
     for (k=1; k<=nppar; k++) {
       if(!bin) {
-        MMG_FSCANF(inm,"%d",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -528,9 +604,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   if(ncor) {
     rewind(inm);
     fseek(inm,posncor,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posncor);
     for (k=1; k<=ncor; k++) {
       if(!bin) {
-        MMG_FSCANF(inm,"%d",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -550,13 +627,21 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   if ( mesh->nt ) {
     rewind(inm);
     fseek(inm,posnt,SEEK_SET);
+    if ( tb.buf ) {
+      MMG5_txtSeek(&tb,posnt);
+      MMG5_TXT_READ(&tb,MMG5_txtRecords(mesh,&tb,mesh->nt,4,MMG5_txtTria,mesh));
+    }
+    if ( mb.buf ) cur = mb.buf + posnt;
     /* Skip triangles with mesh->info.isoref refs */
     for (k=1; k<=mesh->nt; k++) {
       pt1 = &mesh->tria[k];
-      if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
+      if ( mb.buf ) {
+        for (i=0 ; i<3 ; i++) {
+          pt1->v[i] = MMG5_mapInt(&mb,&cur);
+        }
+        pt1->ref = MMG5_mapInt(&mb,&cur);
       }
-      else {
+      else if ( bin ) {
         for (i=0 ; i<3 ; i++) {
           MMG_FREAD(&pt1->v[i],MMG5_SW,1,inm);
           if(iswp) pt1->v[i]=MMG5_swapbin(pt1->v[i]);
@@ -573,9 +658,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     if(ntreq) {
       rewind(inm);
       fseek(inm,posntreq,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posntreq);
       for (k=1; k<=ntreq; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%d",&i);
+          MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
         }
         else {
           MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -596,9 +682,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     if(ntpar) {
       rewind(inm);
       fseek(inm,posntpar,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posntpar);
       for (k=1; k<=ntpar; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%d",&i);
+          MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
         }
         else {
           MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -621,12 +708,21 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   if ( mesh->nquad ) {
     rewind(inm);
     fseek(inm,posnq,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnq);
+    if ( mb.buf ) cur = mb.buf + posnq;
 
     for (k=1; k<=mesh->nquad; k++) {
       pq1 = &mesh->quadra[k];
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pq1->v[0],&pq1->v[1],&pq1->v[2],
-                   &pq1->v[3],&pq1->ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pq1->v[0]) && MMG5_txtInt(&tb,&pq1->v[1]) &&
+                          MMG5_txtInt(&tb,&pq1->v[2]) && MMG5_txtInt(&tb,&pq1->v[3]) &&
+                          MMG5_txtInt(&tb,&pq1->ref));
+      }
+      else if ( mb.buf ) {
+        for (i=0 ; i<4 ; i++) {
+          pq1->v[i] = MMG5_mapInt(&mb,&cur);
+        }
+        pq1->ref = MMG5_mapInt(&mb,&cur);
       }
       else {
         for (i=0 ; i<4 ; i++) {
@@ -646,9 +742,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     if(nqreq) {
       rewind(inm);
       fseek(inm,posnqreq,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnqreq);
       for (k=1; k<=nqreq; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%d",&i);
+          MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
         }
         else {
           MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -671,9 +768,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     if(nqpar) {
       rewind(inm);
       fseek(inm,posnqpar,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnqpar);
       for (k=1; k<=nqpar; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%d",&i);
+          MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
         }
         else {
           MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -699,11 +797,19 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
 
     rewind(inm);
     fseek(inm,posned,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posned);
+    if ( mb.buf ) cur = mb.buf + posned;
 
     for (k=1; k<=na; k++) {
       pa = &mesh->edge[k];
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pa->a,&pa->b,&pa->ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pa->a) && MMG5_txtInt(&tb,&pa->b) &&
+                          MMG5_txtInt(&tb,&pa->ref));
+      }
+      else if ( mb.buf ) {
+        pa->a   = MMG5_mapInt(&mb,&cur);
+        pa->b   = MMG5_mapInt(&mb,&cur);
+        pa->ref = MMG5_mapInt(&mb,&cur);
       }
       else {
         MMG_FREAD(&pa->a,MMG5_SW,1,inm);
@@ -724,9 +830,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     if ( nr ) {
       rewind(inm);
       fseek(inm,posnr,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnr);
       for (k=1; k<=nr; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId "",&ia);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ia));
         }
         else {
           MMG_FREAD(&ia,MMG5_SW,1,inm);
@@ -745,9 +852,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     if ( nedreq ) {
       rewind(inm);
       fseek(inm,posnedreq,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnedreq);
       for (k=1; k<=nedreq; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId "",&ia);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ia));
         }
         else {
           MMG_FREAD(&ia,MMG5_SW,1,inm);
@@ -766,9 +874,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     if ( nedpar ) {
       rewind(inm);
       fseek(inm,posnedpar,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnedpar);
       for (k=1; k<=nedpar; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId "",&ia);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ia));
         }
         else {
           MMG_FREAD(&ia,MMG5_SW,1,inm);
@@ -788,11 +897,22 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   /* read mesh tetrahedra */
   rewind(inm);
   fseek(inm,posne,SEEK_SET);
+  if ( tb.buf ) {
+    MMG5_txtSeek(&tb,posne);
+    MMG5_TXT_READ(&tb,MMG5_txtRecords(mesh,&tb,mesh->ne,5,MMG3D_txtTetra,mesh));
+  }
+  if ( mb.buf ) cur = mb.buf + posne;
   mesh->xt = 0;
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
-    if (!bin) {
-      MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pt->v[0],&pt->v[1],&pt->v[2],&pt->v[3],&ref);
+    if ( !bin ) {
+      ref = pt->ref;
+    }
+    else if ( mb.buf ) {
+      for (i=0 ; i<4 ; i++) {
+        pt->v[i] = MMG5_mapInt(&mb,&cur);
+      }
+      ref = MMG5_mapInt(&mb,&cur);
     }
     else {
       for (i=0 ; i<4 ; i++) {
@@ -830,9 +950,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   if(nereq) {
     rewind(inm);
     fseek(inm,posnereq,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnereq);
     for (k=1; k<=nereq; k++) {
       if(!bin) {
-        MMG_FSCANF(inm,"%d",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -851,9 +972,10 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   if(nepar) {
     rewind(inm);
     fseek(inm,posnepar,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnepar);
     for (k=1; k<=nepar; k++) {
       if(!bin) {
-        MMG_FSCANF(inm,"%d",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -871,11 +993,21 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
   /* read mesh prisms */
   rewind(inm);
   fseek(inm,posnprism,SEEK_SET);
+  if ( tb.buf ) MMG5_txtSeek(&tb,posnprism);
+  if ( mb.buf ) cur = mb.buf + posnprism;
   for (k=1; k<=mesh->nprism; k++) {
     pp = &mesh->prism[k];
     if (!bin) {
-      MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pp->v[0],&pp->v[1],&pp->v[2],
-             &pp->v[3],&pp->v[4],&pp->v[5],&ref);
+      MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pp->v[0]) && MMG5_txtInt(&tb,&pp->v[1]) &&
+                        MMG5_txtInt(&tb,&pp->v[2]) && MMG5_txtInt(&tb,&pp->v[3]) &&
+                        MMG5_txtInt(&tb,&pp->v[4]) && MMG5_txtInt(&tb,&pp->v[5]) &&
+                        MMG5_txtInt(&tb,&ref));
+    }
+    else if ( mb.buf ) {
+      for (i=0 ; i<6 ; i++) {
+        pp->v[i] = MMG5_mapInt(&mb,&cur);
+      }
+      ref = MMG5_mapInt(&mb,&cur);
     }
     else {
       for (i=0 ; i<6 ; i++) {
@@ -916,12 +1048,13 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
 
       rewind(inm);
       fseek(inm,posnormal,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnormal);
       for (k=1; k<=ng; k++) {
         n = &norm[3*(k-1)+1];
         if ( mesh->ver == 1 ) {
           if (!bin) {
             for (i=0 ; i<3 ; i++) {
-              MMG_FSCANF(inm,"%f",&fc);
+              MMG5_TXT_READ(&tb,MMG5_txtFloat(&tb,&fc));
               n[i] = (double) fc;
             }
           } else {
@@ -934,7 +1067,8 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
         }
         else {
           if (!bin) {
-            MMG_FSCANF(inm,"%lf %lf %lf",&n[0],&n[1],&n[2]);
+            MMG5_TXT_READ(&tb,MMG5_txtDouble(&tb,&n[0]) && MMG5_txtDouble(&tb,&n[1]) &&
+                              MMG5_txtDouble(&tb,&n[2]));
           }
           else {
             for (i=0 ; i<3 ; i++) {
@@ -954,10 +1088,11 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
 
       rewind(inm);
       fseek(inm,posnc1,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnc1);
 
       for (k=1; k<=mesh->nc1; k++) {
         if (!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId "",&ip,&idn);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ip) && MMG5_txtInt(&tb,&idn));
         }
         else {
           MMG_FREAD(&ip,MMG5_SW,1,inm);
@@ -1033,6 +1168,8 @@ int MMG3D_loadMesh_opened(MMG5_pMesh mesh,FILE *inm,int bin) {
     }
   }
 
+  MMG5_unmapMeshb(&mb);
+  MMG5_txtFree(&tb);
   return 1;
 }
 
@@ -1278,11 +1415,12 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
   MMG5_pTria    ptt;
   MMG5_pQuad    pq;
   MMG5_xPoint   *pxp;
+  MMG5_OutBuf   ob;
   MMG5_int      k,na,nc,np,ne,nn,nr,nre,npar,nedreq,nedpar,ntreq,ntpar,nt,nereq,nepar;
   MMG5_int      npr,nq,nqreq,nqpar,bpos;
-  int           bin,binch;
+  int           i,bin,binch;
   char          chaine[MMG5_FILESTR_LGTH];
-  static int8_t parWarn = 0;
+  static MMG5_THREADLOCAL int8_t parWarn = 0;
 
   mesh->ver = 2;
 
@@ -1320,6 +1458,10 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     return 0;
   }
 
+  if ( !MMG5_outInit(inm,&ob) ) {
+    fclose(inm);
+    return 0;
+  }
 
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
@@ -1347,17 +1489,22 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     ppt = &mesh->point[k];
     if ( MG_VOK(ppt) ) {
       if(!bin) {
-        fprintf(inm,"%.15lg %.15lg %.15lg %" MMG5_PRId "\n",
-                ppt->c[0],ppt->c[1],ppt->c[2],MMG5_abs(ppt->ref));
+        MMG5_outReal(&ob,ppt->c[0]);
+        MMG5_outChar(&ob,' ');
+        MMG5_outReal(&ob,ppt->c[1]);
+        MMG5_outChar(&ob,' ');
+        MMG5_outReal(&ob,ppt->c[2]);
+        MMG5_outChar(&ob,' ');
+        MMG5_outInt(&ob,MMG5_abs(ppt->ref));
+        MMG5_outChar(&ob,'\n');
       } else {
-        fwrite((unsigned char*)&ppt->c[0],MMG5_SD,1,inm);
-        fwrite((unsigned char*)&ppt->c[1],MMG5_SD,1,inm);
-        fwrite((unsigned char*)&ppt->c[2],MMG5_SD,1,inm);
+        MMG5_outBin(&ob,ppt->c,3*MMG5_SD);
         ppt->ref = MMG5_abs(ppt->ref);
-        fwrite((unsigned char*)&ppt->ref,MMG5_SW,1,inm);
+        MMG5_outBin(&ob,&ppt->ref,MMG5_SW);
       }
     }
   }
+  MMG5_outFlush(&ob);
 
   /* corners+required */
   if ( nc ) {
@@ -1479,16 +1626,20 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     mesh->point[pt->v[3]].flag = 1;
 
     if(!bin) {
-      fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",mesh->point[pt->v[0]].tmp,mesh->point[pt->v[1]].tmp
-              ,mesh->point[pt->v[2]].tmp,mesh->point[pt->v[3]].tmp,pt->ref);
+      for ( i=0; i<4; ++i ) {
+        MMG5_outInt(&ob,mesh->point[pt->v[i]].tmp);
+        MMG5_outChar(&ob,' ');
+      }
+      MMG5_outInt(&ob,pt->ref);
+      MMG5_outChar(&ob,'\n');
     } else {
-      fwrite(&mesh->point[pt->v[0]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pt->v[1]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pt->v[2]].tmp,MMG5_SW,1,inm);
-      fwrite(&mesh->point[pt->v[3]].tmp,MMG5_SW,1,inm);
-      fwrite(&pt->ref,MMG5_SW,1,inm);
+      for ( i=0; i<4; ++i ) {
+        MMG5_outBin(&ob,&mesh->point[pt->v[i]].tmp,MMG5_SW);
+      }
+      MMG5_outBin(&ob,&pt->ref,MMG5_SW);
     }
   }
+  MMG5_outFlush(&ob);
 
   if ( nereq ) {
     if(!bin) {
@@ -1569,20 +1720,20 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if ( !MG_EOK(pp) ) continue;
 
       if(!bin) {
-        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n"
-                ,mesh->point[pp->v[0]].tmp,mesh->point[pp->v[1]].tmp
-                ,mesh->point[pp->v[2]].tmp,mesh->point[pp->v[3]].tmp
-                ,mesh->point[pp->v[4]].tmp,mesh->point[pp->v[5]].tmp,pp->ref);
+        for ( i=0; i<6; ++i ) {
+          MMG5_outInt(&ob,mesh->point[pp->v[i]].tmp);
+          MMG5_outChar(&ob,' ');
+        }
+        MMG5_outInt(&ob,pp->ref);
+        MMG5_outChar(&ob,'\n');
       } else {
-        fwrite(&mesh->point[pp->v[0]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pp->v[1]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pp->v[2]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pp->v[3]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pp->v[4]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pp->v[5]].tmp,MMG5_SW,1,inm);
-        fwrite(&pp->ref,MMG5_SW,1,inm);
+        for ( i=0; i<6; ++i ) {
+          MMG5_outBin(&ob,&mesh->point[pp->v[i]].tmp,MMG5_SW);
+        }
+        MMG5_outBin(&ob,&pp->ref,MMG5_SW);
       }
     }
+    MMG5_outFlush(&ob);
   }
 
 
@@ -1629,14 +1780,17 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
                 && (!(ppt->tag & MG_GEO) || (ppt->tag & MG_NOM)) ) {
         pxp = &mesh->xpoint[ppt->xp];
         if(!bin) {
-          fprintf(inm,"%.15lg %.15lg %.15lg \n",pxp->n1[0],pxp->n1[1],pxp->n1[2]);
+          for ( i=0; i<3; ++i ) {
+            MMG5_outReal(&ob,pxp->n1[i]);
+            MMG5_outChar(&ob,' ');
+          }
+          MMG5_outChar(&ob,'\n');
         } else {
-          fwrite((unsigned char*)&pxp->n1[0],MMG5_SD,1,inm);
-          fwrite((unsigned char*)&pxp->n1[1],MMG5_SD,1,inm);
-          fwrite((unsigned char*)&pxp->n1[2],MMG5_SD,1,inm);
+          MMG5_outBin(&ob,pxp->n1,3*MMG5_SD);
         }
       }
     }
+    MMG5_outFlush(&ob);
 
     if(!bin) {
       strcpy(&chaine[0],"\n\nNormalAtVertices\n");
@@ -1657,15 +1811,19 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       }
       else if ( (ppt->tag & MG_BDY)
                 && (!(ppt->tag & MG_GEO) || (ppt->tag & MG_NOM) ) ) {
+        ++nn;
         if(!bin) {
-          fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId "\n",ppt->tmp,++nn);
+          MMG5_outInt(&ob,ppt->tmp);
+          MMG5_outChar(&ob,' ');
+          MMG5_outInt(&ob,nn);
+          MMG5_outChar(&ob,'\n');
         } else {
-          fwrite(&ppt->tmp,MMG5_SW,1,inm);
-          ++nn;
-          fwrite(&nn,MMG5_SW,1,inm);
+          MMG5_outBin(&ob,&ppt->tmp,MMG5_SW);
+          MMG5_outBin(&ob,&nn,MMG5_SW);
         }
       }
     }
+    MMG5_outFlush(&ob);
 
     if ( nt ) {
       /* Write tangents */
@@ -1688,14 +1846,17 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         }
         else if ( MG_EDG_OR_NOM(ppt->tag) ) {
           if(!bin) {
-            fprintf(inm,"%.15lg %.15lg %.15lg \n",ppt->n[0],ppt->n[1],ppt->n[2]);
+            for ( i=0; i<3; ++i ) {
+              MMG5_outReal(&ob,ppt->n[i]);
+              MMG5_outChar(&ob,' ');
+            }
+            MMG5_outChar(&ob,'\n');
           } else {
-            fwrite((unsigned char*)&ppt->n[0],MMG5_SD,1,inm);
-            fwrite((unsigned char*)&ppt->n[1],MMG5_SD,1,inm);
-            fwrite((unsigned char*)&ppt->n[2],MMG5_SD,1,inm);
+            MMG5_outBin(&ob,ppt->n,3*MMG5_SD);
           }
         }
       }
+      MMG5_outFlush(&ob);
 
 
       if(!bin) {
@@ -1716,15 +1877,19 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
           continue;
         }
         else if ( MG_EDG_OR_NOM(ppt->tag) ) {
+          ++nt;
           if(!bin) {
-            fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId "\n",ppt->tmp,++nt);
+            MMG5_outInt(&ob,ppt->tmp);
+            MMG5_outChar(&ob,' ');
+            MMG5_outInt(&ob,nt);
+            MMG5_outChar(&ob,'\n');
           } else {
-            fwrite(&ppt->tmp,MMG5_SW,1,inm);
-            ++nt;
-            fwrite(&(nn),MMG5_SW,1,inm);
+            MMG5_outBin(&ob,&ppt->tmp,MMG5_SW);
+            MMG5_outBin(&ob,&nn,MMG5_SW);
           }
         }
       }
+      MMG5_outFlush(&ob);
     }
   }
 
@@ -1753,15 +1918,20 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         ntpar++;
       }
       if(!bin) {
-        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",mesh->point[ptt->v[0]].tmp,mesh->point[ptt->v[1]].tmp
-                ,mesh->point[ptt->v[2]].tmp,ptt->ref);
+        for ( i=0; i<3; ++i ) {
+          MMG5_outInt(&ob,mesh->point[ptt->v[i]].tmp);
+          MMG5_outChar(&ob,' ');
+        }
+        MMG5_outInt(&ob,ptt->ref);
+        MMG5_outChar(&ob,'\n');
       } else {
-        fwrite(&mesh->point[ptt->v[0]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[ptt->v[1]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[ptt->v[2]].tmp,MMG5_SW,1,inm);
-        fwrite(&ptt->ref,MMG5_SW,1,inm);
+        for ( i=0; i<3; ++i ) {
+          MMG5_outBin(&ob,&mesh->point[ptt->v[i]].tmp,MMG5_SW);
+        }
+        MMG5_outBin(&ob,&ptt->ref,MMG5_SW);
       }
     }
+    MMG5_outFlush(&ob);
     if ( ntreq ) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredTriangles\n");
@@ -1850,17 +2020,20 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if ( !MG_EOK(pq) ) continue;
 
       if(!bin) {
-        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",mesh->point[pq->v[0]].tmp,
-                mesh->point[pq->v[1]].tmp,mesh->point[pq->v[2]].tmp,
-                mesh->point[pq->v[3]].tmp, pq->ref);
+        for ( i=0; i<4; ++i ) {
+          MMG5_outInt(&ob,mesh->point[pq->v[i]].tmp);
+          MMG5_outChar(&ob,' ');
+        }
+        MMG5_outInt(&ob,pq->ref);
+        MMG5_outChar(&ob,'\n');
       } else {
-        fwrite(&mesh->point[pq->v[0]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pq->v[1]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pq->v[2]].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[pq->v[3]].tmp,MMG5_SW,1,inm);
-        fwrite(&pq->ref,MMG5_SW,1,inm);
+        for ( i=0; i<4; ++i ) {
+          MMG5_outBin(&ob,&mesh->point[pq->v[i]].tmp,MMG5_SW);
+        }
+        MMG5_outBin(&ob,&pq->ref,MMG5_SW);
       }
     }
+    MMG5_outFlush(&ob);
     if ( nqreq ) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredQuadrilaterals\n");
@@ -1925,17 +2098,22 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     }
     for (k=1; k<=mesh->na; k++) {
       if(!bin) {
-        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",mesh->point[mesh->edge[k].a].tmp,
-                mesh->point[mesh->edge[k].b].tmp,mesh->edge[k].ref);
+        MMG5_outInt(&ob,mesh->point[mesh->edge[k].a].tmp);
+        MMG5_outChar(&ob,' ');
+        MMG5_outInt(&ob,mesh->point[mesh->edge[k].b].tmp);
+        MMG5_outChar(&ob,' ');
+        MMG5_outInt(&ob,mesh->edge[k].ref);
+        MMG5_outChar(&ob,'\n');
       } else {
-        fwrite(&mesh->point[mesh->edge[k].a].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->point[mesh->edge[k].b].tmp,MMG5_SW,1,inm);
-        fwrite(&mesh->edge[k].ref,MMG5_SW,1,inm);
+        MMG5_outBin(&ob,&mesh->point[mesh->edge[k].a].tmp,MMG5_SW);
+        MMG5_outBin(&ob,&mesh->point[mesh->edge[k].b].tmp,MMG5_SW);
+        MMG5_outBin(&ob,&mesh->edge[k].ref,MMG5_SW);
       }
       if ( mesh->edge[k].tag & MG_GEO ) nr++;
       if ( mesh->edge[k].tag & MG_REQ ) nedreq++;
       if ( mesh->edge[k].tag & MG_PARBDY ) nedpar++;
     }
+    MMG5_outFlush(&ob);
 
     if ( nr ) {
       if(!bin) {
@@ -2055,6 +2233,12 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     bpos += 2*MMG5_SW; //bpos + End key
     fwrite(&bpos,MMG5_SW,1,inm);
   }
+  if ( !MMG5_outFree(&ob) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write the mesh file.\n",
+            __func__);
+    fclose(inm);
+    return 0;
+  }
   fclose(inm);
   return 1;
 }
@@ -2142,6 +2326,7 @@ int MMG3D_saveMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
 
 int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE       *inm;
+  MMG5_TxtBuf tb;
   long       posnp;
   int        iswp,ier,ver,bin,*type,nsols,dim;
   MMG5_int   k,np;
@@ -2191,20 +2376,29 @@ int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   /* Read mesh solutions */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  tb.buf = NULL;
+  if ( !bin && !MMG5_txtInit(mesh,inm,&tb) ) {
+    fclose(inm);
+    return -1;
+  }
 
-  if ( met->ver == 1 ) {
+  if ( !bin ) {
+    MMG5_TXT_READ(&tb,MMG5_txtSols(mesh,&tb,met,1,mesh->np));
+  }
+  else if ( met->ver == 1 ) {
     /* Single precision */
     for (k=1; k<=mesh->np; k++) {
-      if ( MMG5_readFloatSol3D(met,inm,bin,iswp,k) < 0 ) return -1;
+      if ( MMG5_readFloatSol3D(met,inm,iswp,k) < 0 ) return -1;
     }
   }
   else {
     /* Double precision */
     for (k=1; k<=mesh->np; k++) {
-      if ( MMG5_readDoubleSol3D(met,inm,bin,iswp,k) < 0 ) return -1;
+      if ( MMG5_readDoubleSol3D(met,inm,iswp,k) < 0 ) return -1;
     }
   }
 
+  MMG5_txtFree(&tb);
   fclose(inm);
 
   /* stats */
@@ -2216,11 +2410,12 @@ int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol   psl;
   FILE        *inm;
+  MMG5_TxtBuf tb;
   long        posnp;
   int         iswp,ier,ver,bin,*type,nsols,dim;
   MMG5_int    j,k,np;
   char        data[16];
-  static char mmgWarn = 0;
+  static MMG5_THREADLOCAL char mmgWarn = 0;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,3,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -2284,13 +2479,21 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   /* read mesh solutions */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  tb.buf = NULL;
+  if ( !bin && !MMG5_txtInit(mesh,inm,&tb) ) {
+    fclose(inm);
+    return -1;
+  }
 
-  if ( (*sol)[0].ver == 1 ) {
+  if ( !bin ) {
+    MMG5_TXT_READ(&tb,MMG5_txtSols(mesh,&tb,*sol,nsols,mesh->np));
+  }
+  else if ( (*sol)[0].ver == 1 ) {
     /* Single precision */
     for (k=1; k<=mesh->np; k++) {
       for ( j=0; j<nsols; ++j ) {
         psl = *sol + j;
-        if ( MMG5_readFloatSol3D(psl,inm,bin,iswp,k) < 0 ) return -1;
+        if ( MMG5_readFloatSol3D(psl,inm,iswp,k) < 0 ) return -1;
       }
     }
   }
@@ -2299,10 +2502,11 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
     for (k=1; k<=mesh->np; k++) {
       for ( j=0; j<nsols; ++j ) {
         psl = *sol + j;
-        if ( MMG5_readDoubleSol3D(psl,inm,bin,iswp,k) < 0 ) return -1;
+        if ( MMG5_readDoubleSol3D(psl,inm,iswp,k) < 0 ) return -1;
       }
     }
   }
+  MMG5_txtFree(&tb);
   fclose(inm);
 
   /* stats */
@@ -2313,6 +2517,7 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
 int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE*        inm;
+  MMG5_OutBuf  ob;
   MMG5_pPoint  ppt;
   int          binch,bin,ier;
   MMG5_int     k,bpos;
@@ -2330,12 +2535,24 @@ int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
+  if ( !MMG5_outInit(inm,&ob) ) {
+    fclose(inm);
+    return 0;
+  }
+
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
     if ( !MG_VOK(ppt) ) continue;
 
-    MMG5_writeDoubleSol3D(mesh,met,inm,bin,k,1);
-    fprintf(inm,"\n");
+    MMG5_writeDoubleSol3D(mesh,met,&ob,bin,k,1);
+    MMG5_outChar(&ob,'\n');
+  }
+
+  if ( !MMG5_outFree(&ob) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write the solution file.\n",
+            __func__);
+    fclose(inm);
+    return 0;
   }
 
   /* End file */
@@ -2352,6 +2569,7 @@ int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol    psl;
   FILE*        inm;
+  MMG5_OutBuf  ob;
   MMG5_pPoint  ppt;
   MMG5_pTetra  pt;
   int          binch,bin,ier,npointSols,ncellSols;
@@ -2392,6 +2610,14 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
+  if ( !MMG5_outInit(inm,&ob) ) {
+    MMG5_SAFE_FREE(type);
+    MMG5_SAFE_FREE(size);
+    MMG5_SAFE_FREE(entities);
+    fclose(inm);
+    return 0;
+  }
+
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
     if ( !MG_VOK(ppt) ) continue;
@@ -2400,12 +2626,14 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
       psl = *sol+j;
 
       if ( (psl->entities==MMG5_Noentity) || (psl->entities==MMG5_Vertex) ) {
-        MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+        MMG5_writeDoubleSol3D(mesh,psl,&ob,bin,k,0);
       }
     }
-    fprintf(inm,"\n");
+    MMG5_outChar(&ob,'\n');
   }
 
+  MMG5_outFlush(&ob);
+
   MMG5_saveSolAtTetrahedraHeader( mesh,inm,(*sol)[0].ver,bin,&bpos,mesh->nsols,
                                   ncellSols,entities,type,size );
 
@@ -2416,10 +2644,10 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
     for ( j=0; j<mesh->nsols; ++j ) {
       psl = *sol+j;
       if ( psl->entities==MMG5_Tetrahedron ) {
-        MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+        MMG5_writeDoubleSol3D(mesh,psl,&ob,bin,k,0);
       }
     }
-    fprintf(inm,"\n");
+    MMG5_outChar(&ob,'\n');
   }
 
 
@@ -2427,6 +2655,13 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_SAFE_FREE(size);
   MMG5_SAFE_FREE(entities);
 
+  if ( !MMG5_outFree(&ob) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write the solution file.\n",
+            __func__);
+    fclose(inm);
+    return 0;
+  }
+
   /* End file */
   if(!bin) {
     fprintf(inm,"\n\nEnd\n");
@@ -275,7 +275,7 @@ static inline int
 MMG5_intregvolmet(double *ma,double *mb,double *mp,double t) {
   double        dma[6],dmb[6],mai[6],mbi[6],mi[6];
   int           i;
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 
   for (i=0; i<6; i++) {
     dma[i] = ma[i];
@@ -409,7 +409,7 @@ int MMG5_interp4barintern(MMG5_pSol met,MMG5_int ip,double cb[4],double dm0[6],
                            double dm1[6],double dm2[6],double dm3[6]) {
   double        m0i[6],m1i[6],m2i[6],m3i[6],mi[6];
   int           i;
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 
  if ( !MMG5_invmat(dm0,m0i) || !MMG5_invmat(dm1,m1i) ||
        !MMG5_invmat(dm2,m2i) || !MMG5_invmat(dm3,m3i) ) {
@@ -101,7 +101,7 @@ MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int nump,MMG5_int *lists,
   double        kappa[2],vp[2][2];
   MMG5_int      k,na,nb,ntempa,ntempb,iel,ip0;
   int8_t        iface,i,j,i0;
-  static int8_t mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
 
   p0 = &mesh->point[nump];
 
@@ -458,6 +458,12 @@ MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int nump,MMG5_int *lists,
       hnm = MG_MIN(hnm,isqhmin);
       hnm = MG_MAX(hnm,isqhmax);
       hnm = 1.0 / sqrt(hnm);
+
+      /* The ball of a non-manifold point may be shared by several threads:
+       * the min operation doesn't depend on the update order */
+#ifdef USE_OPENMP
+#pragma omp critical (MMG3D_defsizreg)
+#endif
       met->m[ip0] = MG_MIN(met->m[ip0],hnm);
     }
   }
@@ -649,6 +655,173 @@ int MMG3D_set_metricAtPointsOnReqEdges ( MMG5_pMesh mesh,MMG5_pSol met,int8_t is
   return 1;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param regonly 1 to select only the regular surface points, 0 to select all
+ * the boundary points.
+ * \param cand pointer to the array of candidates (allocated here).
+ * \param ncand pointer to the number of candidates.
+ * \param vis pointer to the array of traversal contexts (one per thread,
+ * allocated here).
+ * \return the number of threads on which the sizes at the candidates can be
+ * computed, 1 if the serial sweep over the boundary faces must be used.
+ *
+ * Travel the boundary faces in the same order as the serial sweep of \ref
+ * MMG3D_defsiz_iso and \ref MMG3D_defsiz_ani and store, for each point whose
+ * size has to be computed, the face from which the point is reached first.
+ * The flag of the selected points is set to 2 and its previous value is saved
+ * in the candidate.
+ *
+ */
+int MMG3D_Init_bdyCand(MMG5_pMesh mesh,int8_t regonly,MMG3D_pBdyCand *cand,
+                       MMG5_int *ncand,MMG3D_pVisit **vis) {
+  MMG5_pTetra    pt;
+  MMG5_pxTetra   pxt;
+  MMG5_pPoint    ppt;
+  MMG3D_pBdyCand pc;
+  MMG5_int       k,nbdy;
+  int            nc,c;
+  int8_t         i,j,i0;
+
+  *cand  = NULL;
+  *vis   = NULL;
+  *ncand = 0;
+
+  nbdy = 0;
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( MG_VOK(ppt) && (ppt->tag & MG_BDY) && ppt->flag <= 1 ) ++nbdy;
+  }
+
+  nc = MMG5_nthreads(mesh,nbdy);
+  if ( nc == 1 ) return 1;
+
+  MMG5_ADD_MEM(mesh,nbdy*sizeof(MMG3D_BdyCand),"boundary candidates",return 1);
+  MMG5_SAFE_CALLOC(*cand,nbdy,MMG3D_BdyCand,
+                   mesh->memCur -= nbdy*sizeof(MMG3D_BdyCand);return 1);
+
+  MMG5_ADD_MEM(mesh,nc*sizeof(MMG3D_pVisit),"traversal contexts",
+               MMG5_DEL_MEM(mesh,*cand);return 1);
+  MMG5_SAFE_CALLOC(*vis,nc,MMG3D_pVisit,
+                   mesh->memCur -= nc*sizeof(MMG3D_pVisit);
+                   MMG5_DEL_MEM(mesh,*cand);return 1);
+  for ( c=0; c<nc; ++c ) {
+    if ( !MMG3D_Init_visit(mesh,&(*vis)[c]) ) {
+      MMG3D_Free_bdyCand(mesh,c,cand,vis);
+      return 1;
+    }
+  }
+
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
+    else if ( !pt->xt )  continue;
+
+    pxt = &mesh->xtetra[pt->xt];
+    for (i=0; i<4; i++) {
+      if ( !(pxt->ftag[i] & MG_BDY) ) continue;
+      if ( !MG_GET(pxt->ori,i) ) continue;
+
+      for (j=0; j<3; j++) {
+        i0  = MMG5_idir[i][j];
+        ppt = &mesh->point[pt->v[i0]];
+
+        if ( !MG_VOK(ppt) || ppt->flag > 1 )  continue;
+
+        if ( regonly && (MG_SIN_OR_NOM(ppt->tag) || MG_EDG(ppt->tag)) )
+          continue;
+
+        if ( *ncand == nbdy ) {
+          /* Point not tagged as boundary: restore the flags and fall back on
+           * the serial sweep */
+          for ( ; *ncand>0; --(*ncand) ) {
+            pc = &(*cand)[*ncand-1];
+            mesh->point[mesh->tetra[pc->k].v[pc->i0]].flag = pc->flag;
+          }
+          MMG3D_Free_bdyCand(mesh,nc,cand,vis);
+          return 1;
+        }
+        pc       = &(*cand)[(*ncand)++];
+        pc->k    = k;
+        pc->i    = i;
+        pc->i0   = i0;
+        pc->flag = ppt->flag;
+        pc->ok   = 0;
+
+        ppt->flag = 2;
+      }
+    }
+  }
+
+  return nc;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param nc number of traversal contexts.
+ * \param cand pointer to the array of candidates.
+ * \param vis pointer to the array of traversal contexts.
+ *
+ * Free the candidates and contexts allocated by \ref MMG3D_Init_bdyCand.
+ *
+ */
+void MMG3D_Free_bdyCand(MMG5_pMesh mesh,int nc,MMG3D_pBdyCand *cand,
+                        MMG3D_pVisit **vis) {
+  int c;
+
+  if ( *vis ) {
+    for ( c=0; c<nc; ++c ) {
+      MMG3D_Free_visit(mesh,&(*vis)[c]);
+    }
+    MMG5_DEL_MEM(mesh,*vis);
+  }
+  if ( *cand ) {
+    MMG5_DEL_MEM(mesh,*cand);
+  }
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param vis traversal context (NULL to mark the tetra in the mesh).
+ * \param met pointer to the metric structure.
+ * \param k tetra from which the point is reached.
+ * \param i boundary face of the tetra.
+ * \param i0 local index of the point in the tetra.
+ * \param hp pointer to the computed size.
+ * \return 1 if success, 0 if the ball of the point can't be computed.
+ *
+ * Compute the size at a regular surface point from its ball and the local
+ * parameters. The metric of the non-singular non-manifold points of the
+ * surfacic ball is updated.
+ *
+ */
+static int MMG3D_defsizreg_pt(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_pSol met,
+                              MMG5_int k,int8_t i,int8_t i0,double *hp) {
+  double   hausd,hmin,hmax;
+  MMG5_int lists[MMG3D_LMAX+2];
+  int64_t  listv[MMG3D_LMAX+2];
+  int      ilists,ilistv;
+
+  /** First step: search for local parameters */
+  if ( MMG5_boulesurfvolp_visit(mesh,vis,k,i0,i,listv,&ilistv,lists,&ilists,0) != 1 )
+    return 0;
+
+  if ( !MMG3D_localParamReg(mesh,mesh->tetra[k].v[i0],listv,ilistv,lists,ilists,
+                             &hausd,&hmin,&hmax) ) {
+    hmin = mesh->info.hmin;
+    hmax = mesh->info.hmax;
+    hausd = mesh->info.hausd;
+  }
+
+  /** Second step: compute the size */
+  /* Define size coming from the hausdorff approximation at regular
+   * surface point and update metric at non-singular non-manifold points
+   * of surfacic ball*/
+  *hp = MMG5_defsizreg(mesh,met,mesh->tetra[k].v[i0],lists,ilists,hmin,hmax,hausd);
+
+  return 1;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -666,13 +839,16 @@ int MMG3D_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint    p0,p1;
   double         hp,v[3],b0[3],b1[3],b0p0[3],b1b0[3],p1b1[3],hausd,hmin,hmax;
   double         secder0[3],secder1[3],kappa,tau[3],gammasec[3],ntau2,intau,ps,lm;
-  MMG5_int       lists[MMG3D_LMAX+2],k,ip0,ip1;
+  MMG5_int       k,ip0,ip1;
   int64_t        listv[MMG3D_LMAX+2];
-  int            ilists,ilistv,l;
-  int            kk,isloc;
+  int            ilistv,l;
+  MMG5_int       c,ncand,nfail;
+  int            kk,isloc,nc;
   int8_t         ismet;
   int8_t         i,j,ia,ised,i0,i1;
   MMG5_pPar      par;
+  MMG3D_pBdyCand cand;
+  MMG3D_pVisit   *vis;
 
   if ( !MMG5_defsiz_startingMessage (mesh,met,__func__) ) {
     return 0;
@@ -888,46 +1064,63 @@ int MMG3D_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   }
 
   /** Step 3: size at regular surface points */
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    // Warning: why are we skipped the tetra with negative refs ?
-    if ( !MG_EOK(pt) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
-    else if ( !pt->xt )  continue;
+  /* Sizes are computed independently at each point from the face from which
+   * the serial sweep reaches it first, so the result doesn't depend on the
+   * number of threads */
+  nc = MMG3D_Init_bdyCand(mesh,1,&cand,&ncand,&vis);
+  nfail = 0;
+  if ( nc > 1 ) {
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nc) schedule(dynamic,64)
+#endif
+    for ( c=0; c<ncand; ++c ) {
+      cand[c].ok = MMG3D_defsizreg_pt(mesh,vis[MMG5_THREAD_NUM()],met,cand[c].k,
+                                      cand[c].i,cand[c].i0,&cand[c].h);
+    }
 
-    pxt = &mesh->xtetra[pt->xt];
-    for (i=0; i<4; i++) {
-      if ( !(pxt->ftag[i] & MG_BDY) ) continue;
-      if ( !MG_GET(mesh->xtetra[mesh->tetra[k].xt].ori,i) ) continue;
+    for ( c=0; c<ncand; ++c ) {
+      ip0 = mesh->tetra[cand[c].k].v[cand[c].i0];
+      if ( cand[c].ok ) {
+        met->m[ip0] = MG_MIN(met->m[ip0],cand[c].h);
+      }
+      else {
+        /* Ball not computed from this face: the point will be treated by the
+         * serial sweep from the next faces to which it belongs */
+        mesh->point[ip0].flag = cand[c].flag;
+        ++nfail;
+      }
+    }
+    MMG3D_Free_bdyCand(mesh,nc,&cand,&vis);
+  }
 
-      for (j=0; j<3; j++) {
-        i0  = MMG5_idir[i][j];
-        ip0 = pt->v[i0];
-        p0  = &mesh->point[ip0];
+  if ( nc == 1 || nfail ) {
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      // Warning: why are we skipped the tetra with negative refs ?
+      if ( !MG_EOK(pt) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
+      else if ( !pt->xt )  continue;
 
-        if ( p0->flag>1 ) continue;
+      pxt = &mesh->xtetra[pt->xt];
+      for (i=0; i<4; i++) {
+        if ( !(pxt->ftag[i] & MG_BDY) ) continue;
+        if ( !MG_GET(mesh->xtetra[mesh->tetra[k].xt].ori,i) ) continue;
 
-        if ( MG_SIN_OR_NOM(p0->tag) || MG_EDG(p0->tag) )
-          continue;
+        for (j=0; j<3; j++) {
+          i0  = MMG5_idir[i][j];
+          ip0 = pt->v[i0];
+          p0  = &mesh->point[ip0];
 
-        /** First step: search for local parameters */
-        if ( MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0) != 1 )
-          continue;
+          if ( p0->flag>1 ) continue;
 
-        if ( !MMG3D_localParamReg(mesh,ip0,listv,ilistv,lists,ilists,
-                                   &hausd,&hmin,&hmax) ) {
-          hmin = mesh->info.hmin;
-          hmax = mesh->info.hmax;
-          hausd = mesh->info.hausd;
-        }
+          if ( MG_SIN_OR_NOM(p0->tag) || MG_EDG(p0->tag) )
+            continue;
 
-        /** Second step: set the metric */
-        /* Define size coming from the hausdorff approximation at regular
-         * surface point and update metric at non-singular non-manifold points
-         * of surfacic ball*/
-        hp  = MMG5_defsizreg(mesh,met,ip0,lists,ilists,hmin,hmax,hausd);
+          if ( !MMG3D_defsizreg_pt(mesh,NULL,met,k,i,i0,&hp) )
+            continue;
 
-        met->m[ip0] = MG_MIN(met->m[ip0],hp);
-        p0->flag = 2;
+          met->m[ip0] = MG_MIN(met->m[ip0],hp);
+          p0->flag = 2;
+        }
       }
     }
   }
@@ -1072,6 +1265,214 @@ void MMG3D_mark_pointsOnReqEdge_fromTetra (  MMG5_pMesh mesh ) {
   }
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param xadj pointer to the index of the first neighbour of each point.
+ * \param adj pointer to the neighbours of the points.
+ * \return 1 if success, 0 if fail.
+ *
+ * Build the graph of the edges along which the size map is graded: edges of
+ * the non-required tetra whose extremities don't belong to a required edge.
+ * The neighbours of point \a k are stored in \a adj from \a xadj[k] to \a
+ * xadj[k+1]-1 (\a xadj has \a np+3 entries).
+ *
+ */
+static int MMG3D_gradsiz_graph(MMG5_pMesh mesh,MMG5_int **xadj,MMG5_int **adj) {
+  MMG5_pTetra  pt;
+  MMG5_Hash    hash;
+  MMG5_hedge   *ph;
+  MMG5_int     k,ip0,ip1,nedg;
+  int8_t       ia;
+
+  if ( !MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) )  return 0;
+
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
+
+    for (ia=0; ia<6; ia++) {
+      ip0 = pt->v[MMG5_iare[ia][0]];
+      ip1 = pt->v[MMG5_iare[ia][1]];
+
+      /* Skip points belonging to a required edge */
+      if ( mesh->point[ip0].s || mesh->point[ip1].s ) continue;
+
+      if ( !MMG5_hashEdge(mesh,&hash,ip0,ip1,k) ) {
+        MMG5_DEL_MEM(mesh,hash.item);
+        return 0;
+      }
+    }
+  }
+
+  /* Count the neighbours of each point */
+  MMG5_ADD_MEM(mesh,(mesh->np+3)*sizeof(MMG5_int),"gradation graph",
+               MMG5_DEL_MEM(mesh,hash.item);return 0);
+  MMG5_SAFE_CALLOC(*xadj,mesh->np+3,MMG5_int,
+                   mesh->memCur -= (mesh->np+3)*sizeof(MMG5_int);
+                   MMG5_DEL_MEM(mesh,hash.item);return 0);
+
+  for (k=0; k<hash.siz; k++) {
+    ph = &hash.item[k];
+    if ( !ph->a ) continue;
+    ++(*xadj)[ph->a+2];
+    ++(*xadj)[ph->b+2];
+  }
+  for (k=2; k<=mesh->np+2; k++) {
+    (*xadj)[k] += (*xadj)[k-1];
+  }
+  nedg = (*xadj)[mesh->np+2];
+
+  MMG5_ADD_MEM(mesh,(nedg+1)*sizeof(MMG5_int),"gradation graph",
+               MMG5_DEL_MEM(mesh,*xadj);MMG5_DEL_MEM(mesh,hash.item);return 0);
+  MMG5_SAFE_CALLOC(*adj,nedg+1,MMG5_int,
+                   mesh->memCur -= (nedg+1)*sizeof(MMG5_int);
+                   MMG5_DEL_MEM(mesh,*xadj);MMG5_DEL_MEM(mesh,hash.item);return 0);
+
+  /* Fill the neighbours: xadj[k+1] is the insertion index of point k and
+   * becomes the index of the first neighbour of point k+1 */
+  for (k=0; k<hash.siz; k++) {
+    ph = &hash.item[k];
+    if ( !ph->a ) continue;
+    (*adj)[(*xadj)[ph->a+1]++] = ph->b;
+    (*adj)[(*xadj)[ph->b+1]++] = ph->a;
+  }
+  MMG5_DEL_MEM(mesh,hash.item);
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param nup pointer to the number of updated sizes.
+ * \param it pointer to the number of passes.
+ * \return 1 if success, 0 if the gradation graph can't be allocated.
+ *
+ * Enforce mesh gradation with a worklist: a pass only recomputes the sizes at
+ * the neighbours of the points updated by the previous pass (points whose flag
+ * is mesh->base-1). The new sizes are computed from the sizes of the previous
+ * pass (Jacobi updates), so the points of a pass are processed in parallel.
+ *
+ * Sizes are decreased until no edge violates the gradation. As the updates are
+ * monotonic, the limit doesn't depend on the order in which the edges are
+ * processed: it is the size map computed by the serial sweep. As for the serial
+ * sweep, the number of passes is limited to 100.
+ *
+ */
+static int MMG3D_gradsiz_iso_worklist(MMG5_pMesh mesh,MMG5_pSol met,
+                                      MMG5_int *nup,int *it) {
+  MMG5_pPoint  ppt;
+  double       *hnew;
+  MMG5_int     *xadj,*adj,*list,*work,*mark;
+  MMG5_int     k,c,ip,nl,nw;
+  int          maxit;
+
+  if ( !MMG3D_gradsiz_graph(mesh,&xadj,&adj) )  return 0;
+
+  /* Points to update (list), points updated by the pass (work) and stamps to
+   * build the list without duplicates (mark) */
+  MMG5_ADD_MEM(mesh,3*(mesh->np+1)*sizeof(MMG5_int),"gradation worklist",
+               MMG5_DEL_MEM(mesh,adj);MMG5_DEL_MEM(mesh,xadj);return 0);
+  MMG5_SAFE_CALLOC(list,3*(mesh->np+1),MMG5_int,
+                   mesh->memCur -= 3*(mesh->np+1)*sizeof(MMG5_int);
+                   MMG5_DEL_MEM(mesh,adj);MMG5_DEL_MEM(mesh,xadj);return 0);
+  work = &list[mesh->np+1];
+  mark = &list[2*(mesh->np+1)];
+
+  MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(double),"gradation worklist",
+               MMG5_DEL_MEM(mesh,list);
+               MMG5_DEL_MEM(mesh,adj);MMG5_DEL_MEM(mesh,xadj);return 0);
+  MMG5_SAFE_CALLOC(hnew,mesh->np+1,double,
+                   mesh->memCur -= (mesh->np+1)*sizeof(double);
+                   MMG5_DEL_MEM(mesh,list);
+                   MMG5_DEL_MEM(mesh,adj);MMG5_DEL_MEM(mesh,xadj);return 0);
+
+  /* At first pass, all the points are updated from all their neighbours */
+  nl = 0;
+  for (k=1; k<=mesh->np; k++) {
+    mesh->point[k].flag = mesh->base;
+    if ( xadj[k+1] > xadj[k] ) {
+      list[nl++] = k;
+    }
+  }
+
+  *it   = 0;
+  *nup  = 0;
+  maxit = 100;
+  while ( nl && *it < maxit ) {
+    ++mesh->base;
+
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(MMG5_nthreads(mesh,nl)) private(k,ip,ppt)
+#endif
+    for (c=0; c<nl; c++) {
+      MMG5_pPoint p1;
+      double      h,hn,l,ux,uy,uz;
+      MMG5_int    ip1;
+
+      ip  = list[c];
+      ppt = &mesh->point[ip];
+      h   = met->m[ip];
+
+      for (k=xadj[ip]; k<xadj[ip+1]; k++) {
+        ip1 = adj[k];
+        p1  = &mesh->point[ip1];
+
+        /* The gradation from the other neighbours is already enforced */
+        if ( p1->flag < mesh->base-1 )  continue;
+        if ( met->m[ip1] < MMG5_EPSD )  continue;
+
+        ux = ppt->c[0]-p1->c[0];
+        uy = ppt->c[1]-p1->c[1];
+        uz = ppt->c[2]-p1->c[2];
+
+        l = ux*ux + uy*uy + uz*uz;
+        l = sqrt(l);
+
+        hn = met->m[ip1] + mesh->info.hgrad*l;
+        h  = MG_MIN(h,hn);
+      }
+      hnew[c] = h;
+    }
+
+    /* Apply the new sizes */
+    nw = 0;
+    for (c=0; c<nl; c++) {
+      ip = list[c];
+      if ( hnew[c] < met->m[ip] ) {
+        met->m[ip] = hnew[c];
+        mesh->point[ip].flag = mesh->base;
+        work[nw++] = ip;
+      }
+    }
+    *nup += nw;
+    ++(*it);
+
+    /* Next pass: neighbours of the updated points */
+    nl = 0;
+    for (c=0; c<nw; c++) {
+      ip = work[c];
+      for (k=xadj[ip]; k<xadj[ip+1]; k++) {
+        if ( mark[adj[k]] == *it ) continue;
+        mark[adj[k]] = *it;
+        list[nl++]   = adj[k];
+      }
+    }
+  }
+
+  if ( nl ) {
+    fprintf(stderr,"\n  ## Warning: %s: gradation not converged after %d"
+            " passes (%" MMG5_PRId " sizes still to update).\n",__func__,*it,nl);
+  }
+
+  MMG5_DEL_MEM(mesh,hnew);
+  MMG5_DEL_MEM(mesh,list);
+  MMG5_DEL_MEM(mesh,adj);
+  MMG5_DEL_MEM(mesh,xadj);
+
+  return 1;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -1093,6 +1494,13 @@ int MMG3D_gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
 
   MMG3D_mark_pointsOnReqEdge_fromTetra ( mesh );
 
+  if ( MMG3D_gradsiz_iso_worklist(mesh,met,&nup,&it) ) {
+    if ( abs(mesh->info.imprim) > 4 )
+      fprintf(stdout,"     gradation: %7" MMG5_PRId " updated, %d iter.\n",nup,it);
+    return 1;
+  }
+
+  /* Unable to allocate the worklist: sweep over all the edges of the mesh */
   for (k=1; k<=mesh->np; k++) {
     mesh->point[k].flag = mesh->base;
   }
@@ -63,6 +63,29 @@
     _LIBMMG5_RETURN(mesh,met,sol,val);            \
   }while(0)
 
+/** Same as \ref _LIBMMG5_RETURN but the signals are left to the caller (see
+ * \ref MMG3D_mmg3dlib_int) */
+#define MMG3D_RETURN_INT(mesh,met,sol,val)do     \
+  {                                              \
+    mesh->npi = mesh->np;                        \
+    mesh->nti = mesh->nt;                        \
+    mesh->nai = mesh->na;                        \
+    mesh->nei = mesh->ne;                        \
+    mesh->xt  = 0;                               \
+    if ( met ) { met->npi  = met->np; }          \
+    if ( sol ) { sol->npi  = sol->np; }          \
+    return val;                                  \
+  }while(0)
+
+/** Same as \ref MMG5_RETURN_AND_PACK but the signals are left to the caller */
+#define MMG3D_RETURN_AND_PACK_INT(mesh,met,sol,val)do \
+  {                                                   \
+    if ( !MMG3D_packMesh(mesh,met,sol) )  {           \
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE); \
+    }                                                 \
+    MMG3D_RETURN_INT(mesh,met,sol,val);               \
+  }while(0)
+
 /** Free adja, xtetra and xpoint tables */
 void MMG3D_Free_topoTables(MMG5_pMesh mesh) {
   MMG5_int k;
@@ -88,6 +111,65 @@ void MMG3D_Free_topoTables(MMG5_pMesh mesh) {
   return;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Prepare the topologic tables (adja, xpoint, xtetra) of a mesh packed at the
+ * end of a previous run for a warm-start remeshing: release the boundary
+ * entities rebuilt by the packing (as done at the end of the analysis) and
+ * compact the xtetra and xpoint arrays (the entries of the deleted entities
+ * are never released by the remeshing).
+ *
+ */
+static int MMG3D_reuse_topoTables(MMG5_pMesh mesh) {
+  MMG5_pTetra  pt;
+  MMG5_pPoint  ppt;
+  MMG5_pxTetra xtetra;
+  MMG5_pxPoint xpoint;
+  MMG5_int     k,n;
+
+  if ( mesh->tria )       MMG5_DEL_MEM(mesh,mesh->tria);
+  if ( mesh->adjt )       MMG5_DEL_MEM(mesh,mesh->adjt);
+  if ( mesh->edge )       MMG5_DEL_MEM(mesh,mesh->edge);
+  if ( mesh->htab.geom )  MMG5_DEL_MEM(mesh,mesh->htab.geom);
+  mesh->nt = mesh->na = 0;
+
+  /* The remeshing operators expect the entities above mesh->xt (resp.
+   * mesh->xp) to be zeroed: copy the used entities in new arrays */
+  MMG5_ADD_MEM(mesh,(mesh->xtmax+1)*sizeof(MMG5_xTetra),"boundary tetrahedra",
+               return 0);
+  MMG5_SAFE_CALLOC(xtetra,mesh->xtmax+1,MMG5_xTetra,return 0);
+
+  n = 0;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || !pt->xt ) continue;
+    xtetra[++n] = mesh->xtetra[pt->xt];
+    pt->xt      = n;
+  }
+  MMG5_DEL_MEM(mesh,mesh->xtetra);
+  mesh->xtetra = xtetra;
+  mesh->xt     = n;
+
+  MMG5_ADD_MEM(mesh,(mesh->xpmax+1)*sizeof(MMG5_xPoint),"boundary points",
+               return 0);
+  MMG5_SAFE_CALLOC(xpoint,mesh->xpmax+1,MMG5_xPoint,return 0);
+
+  n = 0;
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) || !ppt->xp ) continue;
+    xpoint[++n] = mesh->xpoint[ppt->xp];
+    ppt->xp     = n;
+  }
+  MMG5_DEL_MEM(mesh,mesh->xpoint);
+  mesh->xpoint = xpoint;
+  mesh->xp     = n;
+
+  return 1;
+}
+
 /**
  * \param mesh pointer to the mesh structure (unused).
  * \return -1 if fail, the number of detected ridges otherwise
@@ -972,54 +1054,55 @@ int MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol met) {
   return 1;
 }
 
-int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but a
+ * conform mesh is saved or \ref MMG5_STRONGFAILURE if fail and we can't save
+ * the mesh.
+ *
+ * Remeshing of \ref MMG3D_mmg3dlib without the signal handling: only the given
+ * mesh and metric are modified, so several meshes can be remeshed concurrently
+ * (see \ref MMG3D_mmg3dlib_threaded).
+ *
+ */
+int MMG3D_mmg3dlib_int(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pSol sol=NULL; // unused
   mytime    ctim[TIMEMAX];
   char      stim[32];
 
-  /** In debug mode, check that all structures are allocated */
-  assert ( mesh );
-  assert ( met );
-  assert ( mesh->point );
-  assert ( mesh->tetra );
-
-  MMG5_version(mesh,"3D");
-
-  MMG3D_Set_commonFunc();
+  MMG3D_Set_commonOps(mesh);
 
 
   MMG5_warnOrientation(mesh);
 
   /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
-   * run */
-  MMG3D_Free_topoTables(mesh);
-
-  signal(SIGABRT,MMG5_excfun);
-  signal(SIGFPE,MMG5_excfun);
-  signal(SIGILL,MMG5_excfun);
-  signal(SIGSEGV,MMG5_excfun);
-  signal(SIGTERM,MMG5_excfun);
-  signal(SIGINT,MMG5_excfun);
+   * run (reused by a warm-start remeshing) */
+  if ( !mesh->info.update ) {
+    MMG3D_Free_topoTables(mesh);
+    mesh->markmin = 0;
+  }
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   /* Check options */
   if ( mesh->info.lag > -1 ) {
     fprintf(stderr,"\n  ## ERROR: LAGRANGIAN MODE UNAVAILABLE (MMG3D_IPARAM_lag):\n"
             "            YOU MUST CALL THE MMG3D_MMG3DMOV FUNCTION TO MOVE A RIGIDBODY.\n");
-    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
   }
   else if ( mesh->info.iso || mesh->info.isosurf ) {
     fprintf(stderr,"\n  ## ERROR: LEVEL-SET DISCRETISATION UNAVAILABLE"
             " (MMG3D_IPARAM_iso or MMG3D_IARAM_isosurf ):\n"
             "          YOU MUST CALL THE MMG3D_MMG3DMOV FUNCTION TO USE THIS OPTION.\n");
-    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
   }
   else if ( mesh->info.optimLES && met->size==6 ) {
     fprintf(stdout,"\n  ## ERROR: STRONG MESH OPTIMIZATION FOR LES METHODS"
             " UNAVAILABLE (MMG3D_IPARAM_optimLES) WITH AN ANISOTROPIC METRIC.\n");
-    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
   }
 
   if ( mesh->info.imprim > 0 ) fprintf(stdout,"\n  -- MMG3DLIB: INPUT DATA\n");
@@ -1034,7 +1117,7 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   }
   else if ( met->size!=1 && met->size!=6 ) {
     fprintf(stderr,"\n  ## ERROR: WRONG DATA TYPE.\n");
-    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
   }
 
   /* specific meshing */
@@ -1042,20 +1125,20 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
     if ( mesh->info.optim ) {
       printf("\n  ## ERROR: MISMATCH OPTIONS: OPTIM OPTION CAN NOT BE USED"
              " WITH AN INPUT METRIC.\n");
-      _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
     }
 
     if ( mesh->info.hsiz>0. ) {
       printf("\n  ## ERROR: MISMATCH OPTIONS: HSIZ OPTION CAN NOT BE USED"
              " WITH AN INPUT METRIC.\n");
-      _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
     }
   }
 
   if ( mesh->info.optim &&  mesh->info.hsiz>0. ) {
     printf("\n  ## ERROR: MISMATCH OPTIONS: HSIZ AND OPTIM OPTIONS CAN NOT BE USED"
            " TOGETHER.\n");
-    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
   }
 
 #ifdef USE_SCOTCH
@@ -1077,38 +1160,44 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   mesh->info.fem = mesh->info.setfem;
 
   /* scaling mesh */
-  if ( !MMG5_scaleMesh(mesh,met,NULL) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+  if ( !MMG5_scaleMesh(mesh,met,NULL) )   MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
 
   MMG3D_setfunc(mesh,met);
 
   /* specific meshing */
   if ( mesh->info.optim ) {
-    if ( !MMG3D_doSol(mesh,met) ) {
-      if ( !MMG5_unscaleMesh(mesh,met,NULL) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-      _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
+    if ( !mesh->ops->doSol(mesh,met) ) {
+      if ( !MMG5_unscaleMesh(mesh,met,NULL) )   MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_LOWFAILURE);
     }
   }
 
   if ( mesh->info.hsiz > 0. ) {
     if ( !MMG3D_Set_constantSize(mesh,met) ) {
-      if ( !MMG5_unscaleMesh(mesh,met,NULL) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-      _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+      if ( !MMG5_unscaleMesh(mesh,met,NULL) )   MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
     }
   }
 
-  if ( !MMG3D_tetraQual(mesh,met,0) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
+  if ( !MMG3D_tetraQual(mesh,met,0) )   MMG3D_RETURN_INT(mesh,met,sol,MMG5_LOWFAILURE);
 
   if ( mesh->info.imprim > 0  ||  mesh->info.imprim < -1 ) {
     if ( !MMG3D_inqua(mesh,met) ) {
-      if ( !MMG5_unscaleMesh(mesh,met,NULL) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-      _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
+      if ( !MMG5_unscaleMesh(mesh,met,NULL) )   MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_LOWFAILURE);
     }
   }
 
-  /* mesh analysis */
-  if ( !MMG3D_analys(mesh) ) {
-    if ( !MMG5_unscaleMesh(mesh,met,NULL) )    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-    _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
+  /* mesh analysis (already done by the previous run for a warm start) */
+  if ( mesh->info.update ) {
+    if ( !MMG3D_reuse_topoTables(mesh) ) {
+      if ( !MMG5_unscaleMesh(mesh,met,NULL) )  MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_LOWFAILURE);
+    }
+  }
+  else if ( !MMG3D_analys(mesh) ) {
+    if ( !MMG5_unscaleMesh(mesh,met,NULL) )    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_INT(mesh,met,sol,MMG5_LOWFAILURE);
   }
 
   if ( mesh->info.imprim > 1 && met->m ) MMG3D_prilen(mesh,met,0);
@@ -1127,27 +1216,27 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   /* renumerotation if available */
   if ( !MMG5_scotchCall(mesh,met,NULL,NULL) )
   {
-    if ( !MMG5_unscaleMesh(mesh,met,NULL) ) _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-    MMG5_RETURN_AND_PACK(mesh,met,sol,MMG5_LOWFAILURE);
+    if ( !MMG5_unscaleMesh(mesh,met,NULL) ) MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_AND_PACK_INT(mesh,met,sol,MMG5_LOWFAILURE);
   }
 
 #ifdef MMG_PATTERN
   if ( !MMG5_mmg3d1_pattern(mesh,met,NULL) ) {
     if ( !(mesh->adja) && !MMG3D_hashTetra(mesh,1) ) {
       fprintf(stderr,"\n  ## Hashing problem. Invalid mesh.\n");
-      _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
     }
-    if ( !MMG5_unscaleMesh(mesh,met,NULL) )    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-    MMG5_RETURN_AND_PACK(mesh,met,sol,MMG5_LOWFAILURE);
+    if ( !MMG5_unscaleMesh(mesh,met,NULL) )    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_AND_PACK_INT(mesh,met,sol,MMG5_LOWFAILURE);
   }
 #else
   if ( !MMG5_mmg3d1_delone(mesh,met,NULL) ) {
     if ( (!mesh->adja) && !MMG3D_hashTetra(mesh,1) ) {
       fprintf(stderr,"\n  ## Hashing problem. Invalid mesh.\n");
-      _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+      MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
     }
-    if ( !MMG5_unscaleMesh(mesh,met,NULL) )    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-    MMG5_RETURN_AND_PACK(mesh,met,sol,MMG5_LOWFAILURE);
+    if ( !MMG5_unscaleMesh(mesh,met,NULL) )    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_AND_PACK_INT(mesh,met,sol,MMG5_LOWFAILURE);
   }
 #endif
 
@@ -1160,14 +1249,14 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
   /* last renum to give back a good numbering to the user */
   if ( !MMG5_scotchCall(mesh,met,NULL,NULL) )
   {
-    if ( !MMG5_unscaleMesh(mesh,met,NULL) ) _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-    MMG5_RETURN_AND_PACK(mesh,met,sol,MMG5_LOWFAILURE);
+    if ( !MMG5_unscaleMesh(mesh,met,NULL) ) MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_AND_PACK_INT(mesh,met,sol,MMG5_LOWFAILURE);
   }
 
   /* save file */
   if ( !MMG3D_outqua(mesh,met) ) {
-    if ( !MMG5_unscaleMesh(mesh,met,NULL) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-    MMG5_RETURN_AND_PACK(mesh,met,sol,MMG5_LOWFAILURE);
+    if ( !MMG5_unscaleMesh(mesh,met,NULL) )   MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+    MMG3D_RETURN_AND_PACK_INT(mesh,met,sol,MMG5_LOWFAILURE);
   }
 
   if ( mesh->info.imprim > 4 && met->m )
@@ -1175,8 +1264,8 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
 
   chrono(ON,&(ctim[1]));
   if ( mesh->info.imprim > 0 )  fprintf(stdout,"\n  -- MESH PACKED UP\n");
-  if ( !MMG5_unscaleMesh(mesh,met,NULL) )    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
-  if ( !MMG3D_packMesh(mesh,met,sol) )       _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+  if ( !MMG5_unscaleMesh(mesh,met,NULL) )    MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
+  if ( !MMG3D_packMesh(mesh,met,sol) )       MMG3D_RETURN_INT(mesh,met,sol,MMG5_STRONGFAILURE);
   chrono(OFF,&(ctim[1]));
 
   chrono(OFF,&ctim[0]);
@@ -1185,7 +1274,57 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"\n   MMG3DLIB: ELAPSED TIME  %s\n",stim);
     fprintf(stdout,"\n  %s\n   END OF MODULE MMG3D\n  %s\n\n",MG_STR,MG_STR);
   }
-  _LIBMMG5_RETURN(mesh,met,sol,MMG5_SUCCESS);
+  MMG3D_RETURN_INT(mesh,met,sol,MMG5_SUCCESS);
+}
+
+int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
+  MMG5_pSol sol=NULL; // unused
+  int       ier;
+
+  /** In debug mode, check that all structures are allocated */
+  assert ( mesh );
+  assert ( met );
+  assert ( mesh->point );
+  assert ( mesh->tetra );
+
+  MMG5_version(mesh,"3D");
+
+  signal(SIGABRT,MMG5_excfun);
+  signal(SIGFPE,MMG5_excfun);
+  signal(SIGILL,MMG5_excfun);
+  signal(SIGSEGV,MMG5_excfun);
+  signal(SIGTERM,MMG5_excfun);
+  signal(SIGINT,MMG5_excfun);
+
+  ier = MMG3D_mmg3dlib_int(mesh,met);
+
+  _LIBMMG5_RETURN(mesh,met,sol,ier);
+}
+
+int MMG3D_mmg3dlib_update(MMG5_pMesh mesh,MMG5_pSol met) {
+  int ier;
+
+  assert ( mesh );
+  assert ( met );
+
+#ifndef MMG_PATTERN
+  if ( mesh->adja && mesh->xtetra && mesh->xpoint && met->m
+       && met->np == mesh->np && !mesh->nprism && !mesh->info.nosurf ) {
+    mesh->info.update = 1;
+    ier = MMG3D_mmg3dlib(mesh,met);
+    mesh->info.update = 0;
+    mesh->markmin     = 0;
+    return ier;
+  }
+#endif
+
+  if ( mesh->info.imprim > 0 ) {
+    fprintf(stdout,"\n  ## Warning: %s: warm start unavailable for this"
+            " mesh. Complete remeshing.\n",__func__);
+  }
+  ier = MMG3D_mmg3dlib(mesh,met);
+
+  return ier;
 }
 
 /* Level set function discretization and remeshing mode */
@@ -1216,7 +1355,7 @@ int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet) {
     met = umet;
   }
 
-  MMG3D_Set_commonFunc();
+  MMG3D_Set_commonOps(mesh);
 
   signal(SIGABRT,MMG5_excfun);
   signal(SIGFPE,MMG5_excfun);
@@ -1227,6 +1366,7 @@ int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   /* Check options */
   if ( mesh->info.lag > -1 ) {
@@ -1347,7 +1487,7 @@ int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet) {
   /* Specific meshing: compute optim option here because after isovalue
    * discretization mesh elements have too bad qualities */
   if ( mesh->info.optim ) {
-    if ( !MMG3D_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( mettofree ) { MMG5_DEL_MEM(mesh,met->m);MMG5_SAFE_FREE (met); }
       if ( !MMG5_unscaleMesh(mesh,met,sol) ) {
         _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE); }
@@ -1487,7 +1627,7 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
 
   MMG5_version(mesh,"3D");
 
-  MMG3D_Set_commonFunc();
+  MMG3D_Set_commonOps(mesh);
 
   signal(SIGABRT,MMG5_excfun);
   signal(SIGFPE,MMG5_excfun);
@@ -1498,6 +1638,7 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   /* Check options */
   if ( mesh->info.iso || mesh->info.isosurf ) {
@@ -1643,7 +1784,7 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
   disp->npi = disp->np;
 
   if ( (ier > 0) && mesh->info.optim ) {
-    if ( !MMG3D_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( !MMG5_unscaleMesh(mesh,met,disp) )    _LIBMMG5_RETURN(mesh,met,disp,MMG5_STRONGFAILURE);
       MMG5_RETURN_AND_PACK(mesh,met,disp,MMG5_LOWFAILURE);
     }
@@ -1739,19 +1880,31 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
 }
 
 /**
-* Set common pointer functions between mmgs and mmg3d to the matching mmg3d
-* functions.
-*/
-void MMG3D_Set_commonFunc(void) {
-    MMG5_bezierCP = MMG5_mmg3dBezierCP;
-    MMG5_chkmsh = MMG5_mmg3dChkmsh;
-    MMG5_indPt = MMG3D_indPt;
-    MMG5_indElt = MMG3D_indElt;
-    MMG5_grad2met_ani = MMG5_grad2metSurf;
-    MMG5_grad2metreq_ani = MMG5_grad2metSurfreq;
-    MMG5_solTruncature_ani = MMG5_3dSolTruncature_ani;
+ * \param mesh pointer to the mesh structure.
+ *
+ * Set the operators shared between mmgs and mmg3d to the matching mmg3d
+ * functions in the operators table of the mesh.
+ */
+void MMG3D_Set_commonOps(MMG5_pMesh mesh) {
+    mesh->ops->bezierCP          = MMG5_mmg3dBezierCP;
+    mesh->ops->chkmsh            = MMG5_mmg3dChkmsh;
+    mesh->ops->indPt             = MMG3D_indPt;
+    mesh->ops->indElt            = MMG3D_indElt;
+    mesh->ops->grad2met_ani      = MMG5_grad2metSurf;
+    mesh->ops->grad2metreq_ani   = MMG5_grad2metSurfreq;
+    mesh->ops->solTruncature_ani = MMG5_3dSolTruncature_ani;
 
 #ifdef USE_SCOTCH
-    MMG5_renumbering = MMG5_mmg3dRenumbering;
+    mesh->ops->renumbering = MMG5_mmg3dRenumbering;
+#else
+    mesh->ops->renumbering = MMG3D_sfcRenumbering;
 #endif
 }
+
+/**
+ * Deprecated: the common functions are now stored in the operators table of
+ * each mesh (see MMG3D_Set_commonOps).
+ */
+void MMG3D_Set_commonFunc(void) {
+  return;
+}
@@ -162,11 +162,13 @@ enum MMG3D_Param {
   MMG3D_IPARAM_numberOfLSBaseReferences,  /*!< [n], Number of base references for bubble removal (requires \ref MMG3D_DPARAM_rmc) */
   MMG3D_IPARAM_numberOfMat,               /*!< [n], Number of materials in level-set mode */
   MMG3D_IPARAM_numsubdomain,              /*!< [0/n], Save only the subdomain (reference) n (0==all subdomains) */
-  MMG3D_IPARAM_renum,                     /*!< [1/0], Turn on/off renumbering with Scotch */
+  MMG3D_IPARAM_renum,                     /*!< [1/0], Turn on/off renumbering (with Scotch or along a space-filling curve) */
   MMG3D_IPARAM_anisosize,                 /*!< [1/0], Turn on/off anisotropic metric creation when no metric is provided */
   MMG3D_IPARAM_octree,                    /*!< [n], Max number of vertices per PROctree cell (DELAUNAY) */
   MMG3D_IPARAM_nosizreq,                  /*!< [0/1], Allow/avoid overwriting of sizes at required vertices (advanced usage) */
   MMG3D_IPARAM_isoref,                    /*!< [0/n], Isosurface boundary material reference */
+  MMG3D_IPARAM_threads,                   /*!< [n], Number of threads used by parallel mesh sweeps (0 for the OpenMP default). With more than 1 thread, internal points are smoothed by waves: the output mesh is the same for any number of threads greater than 1 but differs from the serial one */
+  MMG3D_IPARAM_batchins,                  /*!< [1/0], Turn on/off the processing of the elements of each split/collapse wave along a space-filling curve (DELAUNAY, off by default). Only the processing order changes: the candidates are still filtered one by one by the PROctree */
   MMG3D_DPARAM_angleDetection,            /*!< [val], Value for angle detection (degrees) */
   MMG3D_DPARAM_hmin,                      /*!< [val], Minimal edge length */
   MMG3D_DPARAM_hmax,                      /*!< [val], Maximal edge length */
@@ -177,6 +179,8 @@ enum MMG3D_Param {
   MMG3D_DPARAM_ls,                        /*!< [val], Function value where the level set is to be discretized */
   MMG3D_DPARAM_xreg,                      /*!< [val], Relaxation parameter for boundary regularization (0<val<1) */
   MMG3D_DPARAM_rmc,                       /*!< [-1/val], Remove small disconnected components in level-set mode */
+  MMG3D_DPARAM_timeBudget,                /*!< [val], Wall-clock budget of the remeshing in seconds (0 for no limit) */
+  MMG3D_DPARAM_convergence,               /*!< [val], Stop the remeshing waves when they modify less than this fraction of the elements (0 to disable) */
   MMG3D_PARAM_size,                       /*!< [n], Number of parameters */
 };
 
@@ -2936,6 +2940,171 @@ LIBMMG3D_EXPORT int MMG3D_loadVtuMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol
  */
   LIBMMG3D_EXPORT int  MMG3D_mmg3dmov(MMG5_pMesh mesh, MMG5_pSol met, MMG5_pSol disp );
 
+/**
+ * \brief Main "program" for the mesh adaptation library using several threads.
+ *
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol (metric) structure.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but a
+ * conform mesh is saved or \ref MMG5_STRONGFAILURE if fail and we can't save
+ * the mesh.
+ *
+ * Remesh the mesh as \ref MMG3D_mmg3dlib but on the number of threads given by
+ * the \ref MMG3D_IPARAM_threads parameter: the mesh is partitioned into
+ * subdomains that are remeshed concurrently with frozen interfaces, then
+ * merged. The partitioning, remeshing and merging is repeated with moved
+ * interfaces so that the whole mesh is adapted.
+ *
+ * Only the isotropic remeshing of a tetrahedral mesh is run in parallel: for
+ * other modes (anisotropic metric, prisms, open boundaries, subdomain
+ * selection...), without OpenMP support or if the mesh is too small, it simply
+ * calls \ref MMG3D_mmg3dlib. The output mesh is not renumbered by scotch.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_MMG3DLIB_THREADED(mesh,met,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh,met\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  LIBMMG3D_EXPORT int  MMG3D_mmg3dlib_threaded(MMG5_pMesh mesh, MMG5_pSol met );
+
+/**
+ * \brief Warm-start remeshing of a mesh adapted by a previous library call.
+ *
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol (new metric) structure.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but a
+ * conform mesh is saved or \ref MMG5_STRONGFAILURE if fail and we can't save
+ * the mesh.
+ *
+ * Remesh the mesh returned by a previous call to \ref MMG3D_mmg3dlib (or to
+ * this function) according to the new metric \a met, given at the vertices of
+ * this mesh. The mesh itself must not have been modified since the previous
+ * call. The boundary analysis, the boundary entities and the adjacency of the
+ * previous call are reused and only the elements having an edge too long or
+ * too short in the new metric (and one layer of elements around them) are
+ * remeshed, which is much cheaper than a complete call when the metric
+ * changes in a small part of the domain (moving front for example).
+ *
+ * If the previous topological data are not available (mesh not obtained by
+ * the library), if the metric size doesn't match the mesh, with the nosurf
+ * option or with prisms, it simply calls \ref MMG3D_mmg3dlib. It is the case
+ * after a call to \ref MMG3D_mmg3dlib_region (or \ref MMG3D_mmg3dlib_box,
+ * \ref MMG3D_mmg3dlib_ball), that releases the boundary entities of the mesh:
+ * the next call to this function performs a complete remeshing.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_MMG3DLIB_UPDATE(mesh,met,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: mesh,met\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  LIBMMG3D_EXPORT int  MMG3D_mmg3dlib_update(MMG5_pMesh mesh, MMG5_pSol met );
+
+/**
+ * \brief Remeshing of a region of the mesh given by a list of tetrahedra.
+ *
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol (metric) structure.
+ * \param list indices of the tetrahedra of the region.
+ * \param nlist number of tetrahedra in \a list.
+ * \param nlayer number of layers of tetrahedra (sharing a vertex) added around
+ * the region.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but a
+ * conform mesh is saved or \ref MMG5_STRONGFAILURE if fail and we can't save
+ * the mesh.
+ *
+ * Remesh only the given tetrahedra and \a nlayer layers of tetrahedra around
+ * them. The region is copied into a separate mesh whose faces in contact with
+ * the rest of the mesh are frozen, then the analysis, the metric processing
+ * and the remeshing operators are applied to this mesh only and the result is
+ * merged back in place. The work thus depends on the size of the region and
+ * not on the size of the mesh: this function is suited to repeated local
+ * modifications of a large mesh. The adjacency built by a previous library
+ * call is reused (and updated), the mesh must not have been modified since.
+ *
+ * An isotropic metric must be given at the vertices of the whole mesh (the
+ * other vertices keep their metric). Anisotropic metrics, prisms, open
+ * boundaries, subdomain selection and level-set or lagrangian modes are not
+ * supported: in this case the mesh is returned unchanged with
+ * \ref MMG5_LOWFAILURE. The indices of the tetrahedra and points may change.
+ *
+ * \warning The boundary entities (xtetra and xpoint tables) of the mesh are
+ * released: a following call to \ref MMG3D_mmg3dlib_update can't reuse them
+ * and performs a complete remeshing.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_MMG3DLIB_REGION(mesh,met,list,nlist,nlayer,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT)  :: mesh,met\n
+ * >     INTEGER(MMG5F_INT),DIMENSION(*), INTENT(IN) :: list\n
+ * >     INTEGER(MMG5F_INT), INTENT(IN)  :: nlist\n
+ * >     INTEGER, INTENT(IN)             :: nlayer\n
+ * >     INTEGER, INTENT(OUT)            :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  LIBMMG3D_EXPORT int  MMG3D_mmg3dlib_region(MMG5_pMesh mesh, MMG5_pSol met,
+                                             MMG5_int *list, MMG5_int nlist,
+                                             int nlayer );
+
+/**
+ * \brief Remeshing of the tetrahedra of the mesh lying in a box.
+ *
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol (metric) structure.
+ * \param min lower corner of the box.
+ * \param max upper corner of the box.
+ * \param nlayer number of layers of tetrahedra added around the region.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but a
+ * conform mesh is saved or \ref MMG5_STRONGFAILURE if fail and we can't save
+ * the mesh.
+ *
+ * Call \ref MMG3D_mmg3dlib_region on the tetrahedra whose barycenter is
+ * inside the box.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_MMG3DLIB_BOX(mesh,met,min,max,nlayer,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT)  :: mesh,met\n
+ * >     REAL(KIND=8),DIMENSION(3), INTENT(IN) :: min,max\n
+ * >     INTEGER, INTENT(IN)             :: nlayer\n
+ * >     INTEGER, INTENT(OUT)            :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  LIBMMG3D_EXPORT int  MMG3D_mmg3dlib_box(MMG5_pMesh mesh, MMG5_pSol met,
+                                          double min[3], double max[3],
+                                          int nlayer );
+
+/**
+ * \brief Remeshing of the tetrahedra of the mesh lying in a ball.
+ *
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol (metric) structure.
+ * \param c center of the ball.
+ * \param r radius of the ball.
+ * \param nlayer number of layers of tetrahedra added around the region.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but a
+ * conform mesh is saved or \ref MMG5_STRONGFAILURE if fail and we can't save
+ * the mesh.
+ *
+ * Call \ref MMG3D_mmg3dlib_region on the tetrahedra whose barycenter is
+ * inside the ball.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE MMG3D_MMG3DLIB_BALL(mesh,met,c,r,nlayer,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT)  :: mesh,met\n
+ * >     REAL(KIND=8),DIMENSION(3), INTENT(IN) :: c\n
+ * >     REAL(KIND=8), INTENT(IN)        :: r\n
+ * >     INTEGER, INTENT(IN)             :: nlayer\n
+ * >     INTEGER, INTENT(OUT)            :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  LIBMMG3D_EXPORT int  MMG3D_mmg3dlib_ball(MMG5_pMesh mesh, MMG5_pSol met,
+                                           double c[3], double r, int nlayer );
+
 /** Tools for the library */
 /**
  * \brief Print the default parameters values.
@@ -3157,6 +3326,10 @@ LIBMMG3D_EXPORT int MMG3D_loadVtuMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol
  * coordinates of edge endpoints) according to the size
  * prescription.
  *
+ * \deprecated This pointer is not modified by the library (so it can be read
+ * while several meshes are remeshed): it always computes the length for an
+ * isotropic size prescription.
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_LENEDGCOOR(ca,cb,sa,sb,retval)\n
  * >     REAL(KIND=8), INTENT(IN)           :: ca,cb,sa,sb\n
@@ -3194,6 +3367,9 @@ LIBMMG3D_EXPORT int MMG3D_loadVtuMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol
  * \param met pointer to the sol structure
  * \return 1 if success
  *
+ * This pointer is not modified by the library: it calls the function matching
+ * the metric type of \a mesh (see \ref MMG3D_setfunc).
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_DOSOL(mesh,met,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT)     :: mesh,met\n
@@ -3248,8 +3424,12 @@ LIBMMG3D_EXPORT int MMG3D_loadVtuMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol
  * \brief Set function pointers for caltet, lenedg, lenedgCoor defsiz, gradsiz...
  * depending if the metric that was read is anisotropic or isotropic
  *
- * \param mesh pointer to the mesh structure (unused).
- * \param met pointer to the sol structure (unused).
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol structure.
+ *
+ * The functions are stored in the operators table of \a mesh so meshes with
+ * different metric types can be processed concurrently. The \ref
+ * MMG3D_lenedgCoor and \ref MMG3D_doSol global pointers are not modified.
  *
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SETFUNC(mesh,met)\n
@@ -3433,8 +3613,9 @@ LIBMMG3D_EXPORT int MMG3D_loadVtuMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol
 
 
  /**
-  * Set common pointer functions between mmgs and mmg3d to the matching mmg3d
-  * functions.
+  * \deprecated The common functions between mmgs and mmg3d are now stored in
+  * the operators table of each mesh and set by \ref MMG3D_Init_mesh. This
+  * function does nothing and is kept for compatibility.
   */
   LIBMMG3D_EXPORT void MMG3D_Set_commonFunc(void);
 #ifdef __cplusplus
@@ -160,6 +160,63 @@ extern "C" {
 #define MMG3D_VOLFRAC      1.e-5
 #define MMG3D_MOVSTEP 0.1
 
+/** Size of the visited set of a traversal context (power of 2 and larger than
+ * 3*MMG3D_LMAX so the table stays sparse for any accepted ball) */
+#define MMG3D_VISITSIZ  32768
+
+/**
+ * \struct MMG3D_Visit
+ * \brief Traversal context for ball queries.
+ *
+ * Stores the tetrahedra visited by a ball traversal in an open-addressing table
+ * whose slots are valid only if their stamp matches the current epoch \a base.
+ * Starting a new traversal thus only increments \a base. When a context is
+ * given to a ball function, the mesh (\a mesh->base and tetra flags) is not
+ * modified, so several threads, each with its own context, can query the same
+ * mesh concurrently.
+ */
+typedef struct {
+  MMG5_int key[MMG3D_VISITSIZ]; /*!< indices of visited tetra */
+  int      stamp[MMG3D_VISITSIZ]; /*!< epoch at which a slot has been filled */
+  int      base; /*!< current epoch */
+  int      nvis; /*!< number of tetra visited during the current epoch */
+} MMG3D_Visit;
+typedef MMG3D_Visit * MMG3D_pVisit;
+
+/**
+ * \struct MMG3D_BdyCand
+ * \brief Boundary point at which the size map has to be defined.
+ *
+ * Stores the boundary face from which the serial sweep over the tetra reaches
+ * the point for the first time, so the size can be computed independently for
+ * each point (and in parallel) from the same ball as in the serial sweep.
+ */
+typedef struct {
+  MMG5_int k;    /*!< tetra from which the point is reached */
+  int8_t   i;    /*!< boundary face of the tetra */
+  int8_t   i0;   /*!< local index of the point in the tetra */
+  int8_t   flag; /*!< point flag before the selection of the candidates */
+  int8_t   ok;   /*!< 1 if the size has been computed from this candidate */
+  double   h;    /*!< computed size (isotropic case only) */
+} MMG3D_BdyCand;
+typedef MMG3D_BdyCand * MMG3D_pBdyCand;
+
+/**
+ * \struct MMG3D_HotPoint
+ * \brief Compact copy of the point fields read by the isotropic quality and
+ * length kernels (see \ref MMG3D_hotPoints).
+ *
+ * A point record spans about 100 bytes of which the sweeps over the tetra only
+ * read the coordinates, and the isotropic size is stored in another array. Two
+ * copies fit in a cache line, so a gather over the vertices of a tetra loads
+ * between 2 and 3 times less memory than from the point and metric arrays.
+ */
+typedef struct {
+  double c[3]; /*!< coordinates of the point */
+  double h;    /*!< isotropic size at the point (0 if no metric) */
+} MMG3D_HotPoint;
+typedef MMG3D_HotPoint * MMG3D_pHotPoint;
+
 /** Copies the contents of fromV[fromC] to toV[toC] and updates toC */
 #define MMG_ARGV_APPEND(fromV,toV,fromC,toC,on_failure)   do {  \
     MMG5_SAFE_MALLOC(toV[ toC ], strlen( fromV[ fromC ] ) + 1, char,    \
@@ -217,6 +274,8 @@ static const uint8_t MMG5_permedge[12][6] = {
 
 /* prototypes */
 int  MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,int8_t metRidTyp);
+MMG3D_pHotPoint MMG3D_hotPoints(MMG5_pMesh mesh,MMG5_pSol met);
+void MMG3D_freeHotPoints(MMG5_pMesh mesh,MMG3D_pHotPoint *hp);
 extern int MMG5_directsurfball(MMG5_pMesh mesh, MMG5_int ip, MMG5_int *list, int ilist, double n[3]);
 
 int  MMG3D_Init_mesh_var( va_list argptr );
@@ -232,6 +291,7 @@ int  MMG3D_zaldy(MMG5_pMesh mesh);
 void MMG5_freeXTets(MMG5_pMesh mesh);
 void MMG5_freeXPrisms(MMG5_pMesh mesh);
 void MMG3D_Free_topoTables(MMG5_pMesh mesh);
+int  MMG3D_mmg3dlib_int(MMG5_pMesh mesh,MMG5_pSol met);
 int  MMG5_chkBdryTria(MMG5_pMesh mesh);
 int  MMG5_chkBdryTria_countBoundaries(MMG5_pMesh mesh, MMG5_int *ntmesh, MMG5_int *ntpres);
 int  MMG5_chkBdryTria_hashBoundaries(MMG5_pMesh mesh, MMG5_int ntmesh, MMG5_Hash *hashElt);
@@ -258,6 +318,21 @@ int  MMG5_boulesurfvolpNom(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,int64
 int  MMG5_boulesurfvolp(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,int64_t *listv,
                          int *ilistv,MMG5_int *lists,int*ilists, int isnm);
 int  MMG5_bouletrid(MMG5_pMesh,MMG5_int,int,int,int *,MMG5_int *,int *,MMG5_int *,MMG5_int *,MMG5_int *);
+int  MMG3D_Init_visit(MMG5_pMesh mesh,MMG3D_pVisit *vis);
+void MMG3D_Free_visit(MMG5_pMesh mesh,MMG3D_pVisit *vis);
+int  MMG5_boulernm_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_Hash *hash,MMG5_int start,int ip,
+                         MMG5_int *ng,MMG5_int *nr,MMG5_int *nm);
+int  MMG5_boulenm_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,int iface,
+                        double n[3],double t[3]);
+int  MMG5_boulenmInt_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,double t[3]);
+int  MMG5_boulevolp_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,int64_t *list);
+int  MMG5_boulesurfvolpNom_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,int iface,
+                                 int64_t *listv,int *ilistv,MMG5_int *lists,int*ilists,
+                                 MMG5_int*refmin,MMG5_int*refplus,int isnm);
+int  MMG5_boulesurfvolp_visit(MMG5_pMesh mesh,MMG3D_pVisit vis,MMG5_int start,int ip,int iface,
+                              int64_t *listv,int *ilistv,MMG5_int *lists,int*ilists, int isnm);
+int  MMG5_bouletrid_visit(MMG5_pMesh,MMG3D_pVisit,MMG5_int,int,int,int *,MMG5_int *,int *,
+                          MMG5_int *,MMG5_int *,MMG5_int *);
 int  MMG5_startedgsurfball(MMG5_pMesh mesh,MMG5_int nump,MMG5_int numq,MMG5_int *list,int ilist);
 int  MMG5_srcbdy(MMG5_pMesh mesh,MMG5_int start,int ia);
 int  MMG5_coquil(MMG5_pMesh mesh, MMG5_int start, int ia, int64_t * list,int8_t*);
@@ -360,6 +435,7 @@ MMG5_int  MMG5_split4bar(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int8_t);
 int  MMG3D_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, int64_t *list, int ilist,MMG5_int);
 int  MMG3D_optlap(MMG5_pMesh ,MMG5_pSol );
 int  MMG5_movintpt_iso(MMG5_pMesh ,MMG5_pSol,MMG3D_pPROctree,int64_t *, int , int);
+int  MMG3D_movintpt_iso_par(MMG5_pMesh ,MMG5_pSol,int64_t *,int ,int);
 int  MMG3D_movnormal_iso(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,int );
 int  MMG5_movintptLES_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree,MMG5_int *,int,int);
 int  MMG5_movintpt_ani(MMG5_pMesh ,MMG5_pSol,MMG3D_pPROctree,int64_t *,int ,int);
@@ -464,6 +540,7 @@ void MMG3D_keep_only1Subdomain ( MMG5_pMesh mesh,int nsd );
 /* useful functions to debug */
 MMG5_int  MMG3D_indElt(MMG5_pMesh mesh,MMG5_int kel);
 MMG5_int  MMG3D_indPt(MMG5_pMesh mesh,MMG5_int kp);
+void      MMG3D_Set_commonOps(MMG5_pMesh mesh);
 void MMG5_printTetra(MMG5_pMesh mesh,char* fileName);
 void MMG3D_chkpointtag(MMG5_pMesh mesh);
 void MMG3D_chkmeshedgestags(MMG5_pMesh mesh);
@@ -473,6 +550,8 @@ int MMG3D_chk_shellEdgeTag(MMG5_pMesh  mesh,MMG5_int start, int8_t ia,uint16_t t
 #ifdef USE_SCOTCH
 int MMG5_mmg3dRenumbering(int,MMG5_pMesh,MMG5_pSol,MMG5_pSol,MMG5_int*);
 #endif
+int MMG3D_sfcRenumbering(int,MMG5_pMesh,MMG5_pSol,MMG5_pSol,MMG5_int*);
+MMG5_int MMG3D_sfcSortTetra(MMG5_pMesh,MMG5_int,MMG5_int*);
 
 int    MMG5_meancur(MMG5_pMesh mesh,MMG5_int np,double c[3],int ilist,MMG5_int *list,double h[3]);
 double MMG5_surftri(MMG5_pMesh,int,int);
@@ -488,6 +567,7 @@ int  MMG5_velextLS(MMG5_pMesh ,MMG5_pSol );
 
 /* Delaunay functions*/
 int MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,int64_t *list,int ilist);
+void MMG5_freeDeloneWork(MMG5_pMesh mesh);
 int MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int iel,int ip,int64_t *list,int lon,double volmin);
 int MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int iel,int ip,int64_t *list,int lon,double volmin);
 int MMG5_cenrad_iso(MMG5_pMesh mesh,double *ct,double *c,double *rad);
@@ -512,7 +592,8 @@ int  MMG5_anatet(MMG5_pMesh mesh,MMG5_pSol met, int8_t typchk, int patternMode)
 MMG5_int  MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree PROctree,
                       double clickSurf,double clickVol,int moveVol,int improveSurf,int improveVolSurf,
                       int improveVol,int maxit,MMG5_int testmark);
-MMG5_int  MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree PROctree, int);
+MMG5_int  MMG3D_setActiveRegion(MMG5_pMesh mesh,int nlayer);
+MMG5_int  MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree PROctree, int,MMG5_int);
 MMG5_int  MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double,double,MMG3D_pPROctree, int,MMG5_int);
 
 /* libmmg3d_tools.c */
@@ -545,6 +626,8 @@ double     MMG5_meansizreg_iso(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int*,int,doubl
 int        MMG3D_chk4ridVertices(MMG5_pMesh mesh,MMG5_pTetra pt);
 extern int MMG5_moymet(MMG5_pMesh ,MMG5_pSol ,MMG5_pTetra ,double *);
 int    MMG3D_set_metricAtPointsOnReqEdges (MMG5_pMesh,MMG5_pSol,int8_t);
+int    MMG3D_Init_bdyCand(MMG5_pMesh,int8_t,MMG3D_pBdyCand*,MMG5_int*,MMG3D_pVisit**);
+void   MMG3D_Free_bdyCand(MMG5_pMesh,int,MMG3D_pBdyCand*,MMG3D_pVisit**);
 void MMG3D_mark_pointsOnReqEdge_fromTetra (  MMG5_pMesh mesh );
 
 /* input */
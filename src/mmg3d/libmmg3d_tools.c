@@ -54,23 +54,21 @@ void MMG3D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
     mesh->info.ani = 1;
 
     if ( (!met->m) && (!mesh->info.optim) && mesh->info.hsiz<=0. ) {
-      MMG5_caltet          = MMG5_caltet_iso;
-      MMG5_caltri          = MMG5_caltri_iso;
-      MMG3D_doSol          = MMG3D_doSol_iso;
+      mesh->ops->caltet     = MMG5_caltet_iso;
+      mesh->ops->caltri     = MMG5_caltri_iso;
+      mesh->ops->doSol      = MMG3D_doSol_iso;
       // same as MMG5_lenSurfEdg_iso for iso metric. The edge can be boundary or
       // intenal but the test relies on the MG_BDY tag that may be missing along
       // boundary edges (it doesn't matter in iso mode as we always compute the
       // "straight" edge length). It starts from tetra pointer and edge index.
-      MMG5_lenedg          = MMG5_lenedg_iso;
-      // has to be used to compute "straight" edge length from coordinates
-      MMG3D_lenedgCoor     = MMG5_lenedgCoor_iso;
+      mesh->ops->lenedg     = MMG5_lenedg_iso;
       // Straight edge length (edge is guessed to be a surface edge) from point indices
-      MMG5_lenSurfEdg      = MMG5_lenSurfEdg_iso;
+      mesh->ops->lenSurfEdg = MMG5_lenSurfEdg_iso;
     }
     else {
-      MMG5_caltet          = MMG5_caltet_ani;
-      MMG5_caltri          = MMG5_caltri_ani;
-      MMG3D_doSol          = MMG3D_doSol_ani;
+      mesh->ops->caltet     = MMG5_caltet_ani;
+      mesh->ops->caltri     = MMG5_caltri_ani;
+      mesh->ops->doSol      = MMG3D_doSol_ani;
       // lenedg is meant to compute the curve length along boundary edges
       // and the straight length for internal edges (from
       // tetra pointer and an edge index) but it relies
@@ -78,69 +76,67 @@ void MMG3D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
       // edges. Moreover, it seems that the "straight" length is computed in iso
       // mode - the origin and effect of computing curve lengths along boudary
       // edges should be investigated...
-      MMG5_lenedg          = MMG5_lenedg_ani;
-      // lenedgCoor has to be used to compute "straight" edge length from
-      // coordinates
-      MMG3D_lenedgCoor     = MMG5_lenedgCoor_ani;
+      mesh->ops->lenedg     = MMG5_lenedg_ani;
       // lenSurfEdg can be called only from a boundary edge: curve length for
       // aniso metric from point indices
-      MMG5_lenSurfEdg      = MMG5_lenSurfEdg_ani;
+      mesh->ops->lenSurfEdg = MMG5_lenSurfEdg_ani;
     }
-    MMG5_intmet          = MMG5_intmet_ani;
+    mesh->ops->intmet     = MMG5_intmet_ani;
     // warning the lenedg_ani function we may erroneously approximate the length
     // of a curve boundary edge by the length of the straight edge if the
     // "MG_BDY" tag is missing along the edge.
-    MMG5_lenedgspl       = MMG5_lenedg_ani;
-    MMG5_movintpt        = MMG5_movintpt_ani;
-    MMG5_movbdyregpt     = MMG5_movbdyregpt_ani;
-    MMG5_movbdyrefpt     = MMG5_movbdyrefpt_ani;
-    MMG5_movbdynompt     = MMG5_movbdynompt_ani;
-    MMG5_movbdyridpt     = MMG5_movbdyridpt_ani;
-    MMG5_interp4bar      = MMG5_interp4bar_ani;
-    MMG5_compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_ani;
-    MMG3D_defsiz         = MMG3D_defsiz_ani;
-    MMG3D_gradsiz        = MMG3D_gradsiz_ani;
-    MMG3D_gradsizreq     = MMG3D_gradsizreq_ani;
+    mesh->ops->lenedgspl   = MMG5_lenedg_ani;
+    mesh->ops->movintpt    = MMG5_movintpt_ani;
+    mesh->ops->movintpt_par = NULL;
+    mesh->ops->movbdyregpt = MMG5_movbdyregpt_ani;
+    mesh->ops->movbdyrefpt = MMG5_movbdyrefpt_ani;
+    mesh->ops->movbdynompt = MMG5_movbdynompt_ani;
+    mesh->ops->movbdyridpt = MMG5_movbdyridpt_ani;
+    mesh->ops->interp4bar  = MMG5_interp4bar_ani;
+    mesh->ops->compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_ani;
+    mesh->ops->defsiz      = MMG3D_defsiz_ani;
+    mesh->ops->gradsiz     = MMG3D_gradsiz_ani;
+    mesh->ops->gradsizreq  = MMG3D_gradsizreq_ani;
 #ifndef MMG_PATTERN
-    MMG5_cavity          = MMG5_cavity_ani;
-    MMG3D_PROctreein     = MMG3D_PROctreein_ani;
+    mesh->ops->cavity     = MMG5_cavity_ani;
+    mesh->ops->PROctreein = MMG3D_PROctreein_ani;
 #endif
   }
   else {
     if ( mesh->info.optimLES ) {
-      MMG5_caltet          = MMG3D_caltetLES_iso;
-      MMG5_movintpt        = MMG5_movintpt_iso;
+      mesh->ops->caltet     = MMG3D_caltetLES_iso;
+      mesh->ops->movintpt   = MMG5_movintpt_iso;
+      mesh->ops->movintpt_par = NULL;
     }
     else {
-      MMG5_caltet          = MMG5_caltet_iso;
-      MMG5_movintpt        = MMG5_movintpt_iso;
+      mesh->ops->caltet     = MMG5_caltet_iso;
+      mesh->ops->movintpt   = MMG5_movintpt_iso;
+      mesh->ops->movintpt_par = MMG3D_movintpt_iso_par;
     }
-    MMG5_caltri          = MMG5_caltri_iso;
-    MMG3D_doSol          = MMG3D_doSol_iso;
+    mesh->ops->caltri     = MMG5_caltri_iso;
+    mesh->ops->doSol      = MMG3D_doSol_iso;
     // same as MMG5_lenSurfEdg_iso for iso metric. The edge can be boundary or
     // intenal but the test relies on the MG_BDY tag that may be missing along
     // boundary edges (it doesn't matter in iso mode as we always compute the
     // "straight" edge length). It starts from tetra pointer and edge index.
-    MMG5_lenedg          = MMG5_lenedg_iso;
-    // lenedgCoor has to be used to compute "straight" edge length from coordinates
-    MMG3D_lenedgCoor     = MMG5_lenedgCoor_iso;
+    mesh->ops->lenedg     = MMG5_lenedg_iso;
     // Straight edge length (edge is guessed to be a surface edge) from point indices
-    MMG5_lenSurfEdg      = MMG5_lenSurfEdg_iso;
-    MMG5_intmet          = MMG5_intmet_iso;
-    MMG5_lenedgspl       = MMG5_lenedg_iso;
-    MMG5_movbdyregpt     = MMG5_movbdyregpt_iso;
-    MMG5_movbdyrefpt     = MMG5_movbdyrefpt_iso;
-    MMG5_movbdynompt     = MMG5_movbdynompt_iso;
-    MMG5_movbdyridpt     = MMG5_movbdyridpt_iso;
-    MMG5_interp4bar      = MMG5_interp4bar_iso;
-    MMG5_compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_iso;
-    MMG3D_defsiz         = MMG3D_defsiz_iso;
-    MMG3D_gradsiz        = MMG3D_gradsiz_iso;
-    MMG3D_gradsizreq     = MMG3D_gradsizreq_iso;
+    mesh->ops->lenSurfEdg  = MMG5_lenSurfEdg_iso;
+    mesh->ops->intmet      = MMG5_intmet_iso;
+    mesh->ops->lenedgspl   = MMG5_lenedg_iso;
+    mesh->ops->movbdyregpt = MMG5_movbdyregpt_iso;
+    mesh->ops->movbdyrefpt = MMG5_movbdyrefpt_iso;
+    mesh->ops->movbdynompt = MMG5_movbdynompt_iso;
+    mesh->ops->movbdyridpt = MMG5_movbdyridpt_iso;
+    mesh->ops->interp4bar  = MMG5_interp4bar_iso;
+    mesh->ops->compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_iso;
+    mesh->ops->defsiz      = MMG3D_defsiz_iso;
+    mesh->ops->gradsiz     = MMG3D_gradsiz_iso;
+    mesh->ops->gradsizreq  = MMG3D_gradsizreq_iso;
 
 #ifndef MMG_PATTERN
-    MMG5_cavity          = MMG5_cavity_iso;
-    MMG3D_PROctreein     = MMG3D_PROctreein_iso;
+    mesh->ops->cavity     = MMG5_cavity_iso;
+    mesh->ops->PROctreein = MMG3D_PROctreein_iso;
 #endif
   }
 }
@@ -181,7 +177,20 @@ int MMG3D_usage(char *prog) {
 #endif
 #ifdef USE_SCOTCH
   fprintf(stdout,"-rn [n]      turn on or off the renumbering using SCOTCH [1/0] \n");
+#else
+  fprintf(stdout,"-rn [n]      turn on or off the space-filling curve renumbering [0/1] \n");
+#endif
+#ifdef USE_OPENMP
+  fprintf(stdout,"-nt val      number of threads for parallel mesh sweeps (0: OpenMP default)\n");
+  fprintf(stdout,"             (output differs between 1 and more threads)\n");
+#endif
+#ifndef MMG_PATTERN
+  fprintf(stdout,"-batchins    process the elements of the insertion waves along a\n"
+          "             space-filling curve\n");
 #endif
+  fprintf(stdout,"-tbudget val wall-clock budget of the remeshing in seconds\n");
+  fprintf(stdout,"-conv    val stop the remeshing waves when they modify less than\n"
+          "             this fraction of the elements\n");
   fprintf(stdout,"\n");
 
   fprintf(stdout,"-nofem       do not force Mmg to create a finite element mesh \n");
@@ -214,7 +223,23 @@ int MMG3D_defaultValues(MMG5_pMesh mesh) {
   fprintf(stdout,"SCOTCH renumbering                  : enabled\n");
 #else
   fprintf(stdout,"SCOTCH renumbering                  : disabled\n");
+  fprintf(stdout,"Space-filling curve renumbering (-rn): %s\n",
+          mesh->info.renum ? "enabled" : "disabled");
+#endif
+#ifdef USE_OPENMP
+  fprintf(stdout,"Number of threads (-nt)             : %d\n",
+          mesh->info.nthreads);
+#endif
+#ifndef MMG_PATTERN
+  fprintf(stdout,"Sorted insertion waves (-batchins)  : %s\n",
+          mesh->info.batchins ? "enabled" : "disabled");
 #endif
+  fprintf(stdout,"Time budget (-tbudget)              : ");
+  if ( mesh->info.tbudget > 0. )
+    fprintf(stdout,"%gs\n",mesh->info.tbudget);
+  else
+    fprintf(stdout,"none\n");
+  fprintf(stdout,"Convergence threshold (-conv)       : %g\n",mesh->info.conv);
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -282,6 +307,35 @@ int MMG3D_storeknownar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,
           MMG_ARGV_APPEND(argv, mmgArgv, i, *mmgArgc,return 0);
         }
         break;
+#ifndef MMG_PATTERN
+      case 'b':
+        if ( !strcmp(argv[i],"-batchins") ) {
+          if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_batchins,1) )
+            return 0;
+        }
+        else {
+          /* Arg unknown by Mmg: arg starts with -b but is not known */
+          MMG_ARGV_APPEND(argv, mmgArgv, i, *mmgArgc,return 0);
+        }
+        break;
+#endif
+      case 'c':
+        if ( !strcmp(argv[i],"-conv") && ++i < argc ) {
+          val = strtof(argv[i],&endptr);
+          if ( endptr == &(argv[i][strlen(argv[i])]) ) {
+            if ( !MMG3D_Set_dparameter(mesh,met,MMG3D_DPARAM_convergence,val) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            return 0;
+          }
+        }
+        else {
+          /* Arg unknown by Mmg: arg starts with -c but is not known */
+          MMG_ARGV_APPEND(argv, mmgArgv, i, *mmgArgc,return 0);
+        }
+        break;
       case 'd':
         if ( !strcmp(argv[i],"-default") ) {
           mesh->mark=1;
@@ -480,6 +534,18 @@ int MMG3D_storeknownar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,
             return 0;
           }
         }
+#ifdef USE_OPENMP
+        else if ( !strcmp(argv[i],"-nt") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_threads,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            return 0;
+          }
+        }
+#endif
         else if ( !strcmp(argv[i],"-noswap") ) {
           if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_noswap,1) )
             return 0;
@@ -553,7 +619,6 @@ int MMG3D_storeknownar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,
             }
           }
         }
-#ifdef USE_SCOTCH
         else if ( !strcmp(argv[i],"-rn") ) {
           if ( ++i < argc ) {
             if ( isdigit(argv[i][0]) ) {
@@ -570,7 +635,6 @@ int MMG3D_storeknownar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,
             return 0;
           }
         }
-#endif
         else {
           /* Arg unknown by Mmg: arg starts with -r but is not known */
           MMG_ARGV_APPEND(argv, mmgArgv, i, *mmgArgc,return 0);
@@ -596,6 +660,23 @@ int MMG3D_storeknownar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,
           MMG_ARGV_APPEND(argv, mmgArgv, i, *mmgArgc,return 0);
         }
         break;
+      case 't':
+        if ( !strcmp(argv[i],"-tbudget") && ++i < argc ) {
+          val = strtof(argv[i],&endptr);
+          if ( endptr == &(argv[i][strlen(argv[i])]) ) {
+            if ( !MMG3D_Set_dparameter(mesh,met,MMG3D_DPARAM_timeBudget,val) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            return 0;
+          }
+        }
+        else {
+          /* Arg unknown by Mmg: arg starts with -t but is not known */
+          MMG_ARGV_APPEND(argv, mmgArgv, i, *mmgArgc,return 0);
+        }
+        break;
       case 'v':
         if ( !strcmp(argv[i],"-v") ) {
           if ( ++i < argc ) {
@@ -1200,7 +1281,7 @@ int MMG3D_mmg3dcheck(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,double critmin,
   int       ier;
   char      stim[32];
 
-  MMG3D_Set_commonFunc();
+  MMG3D_Set_commonOps(mesh);
 
   /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
    * run */
@@ -1494,7 +1575,7 @@ int MMG3D_solTruncatureForOptim(MMG5_pMesh mesh, MMG5_pSol met,int ani) {
     ier = MMG5_solTruncature_iso(mesh,met);
   }
   else {
-    MMG5_solTruncature_ani = MMG5_3dSolTruncature_ani;
+    mesh->ops->solTruncature_ani = MMG5_3dSolTruncature_ani;
     ier = MMG5_3dSolTruncature_ani(mesh,met);
   }
 
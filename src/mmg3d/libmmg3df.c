@@ -83,3 +83,66 @@ FORTRAN_NAME(MMG3D_MMG3DMOV,mmg3d_mmg3dmov,(MMG5_pMesh *mesh,MMG5_pSol *met
 
   return;
 }
+
+/**
+ * See \ref MMG3D_mmg3dlib_threaded function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_MMG3DLIB_THREADED,mmg3d_mmg3dlib_threaded,
+             (MMG5_pMesh *mesh,MMG5_pSol *met,int* retval),
+             (mesh,met,retval)){
+
+  *retval = MMG3D_mmg3dlib_threaded(*mesh,*met);
+
+  return;
+}
+
+/**
+ * See \ref MMG3D_mmg3dlib_update function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_MMG3DLIB_UPDATE,mmg3d_mmg3dlib_update,
+             (MMG5_pMesh *mesh,MMG5_pSol *met,int* retval),
+             (mesh,met,retval)){
+
+  *retval = MMG3D_mmg3dlib_update(*mesh,*met);
+
+  return;
+}
+
+/**
+ * See \ref MMG3D_mmg3dlib_region function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_MMG3DLIB_REGION,mmg3d_mmg3dlib_region,
+             (MMG5_pMesh *mesh,MMG5_pSol *met,MMG5_int *list,MMG5_int *nlist,
+              int *nlayer,int* retval),
+             (mesh,met,list,nlist,nlayer,retval)){
+
+  *retval = MMG3D_mmg3dlib_region(*mesh,*met,list,*nlist,*nlayer);
+
+  return;
+}
+
+/**
+ * See \ref MMG3D_mmg3dlib_box function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_MMG3DLIB_BOX,mmg3d_mmg3dlib_box,
+             (MMG5_pMesh *mesh,MMG5_pSol *met,double *min,double *max,
+              int *nlayer,int* retval),
+             (mesh,met,min,max,nlayer,retval)){
+
+  *retval = MMG3D_mmg3dlib_box(*mesh,*met,min,max,*nlayer);
+
+  return;
+}
+
+/**
+ * See \ref MMG3D_mmg3dlib_ball function in \ref mmg3d/libmmg3d.h file.
+ */
+FORTRAN_NAME(MMG3D_MMG3DLIB_BALL,mmg3d_mmg3dlib_ball,
+             (MMG5_pMesh *mesh,MMG5_pSol *met,double *c,double *r,
+              int *nlayer,int* retval),
+             (mesh,met,c,r,nlayer,retval)){
+
+  *retval = MMG3D_mmg3dlib_ball(*mesh,*met,c,*r,*nlayer);
+
+  return;
+}
@@ -34,10 +34,10 @@
 #include "libmmg3d_private.h"
 #include "libmmg3d.h"
 
-#ifdef USE_SCOTCH
-
 #include "librnbg_private.h"
 
+#ifdef USE_SCOTCH
+
 /**
  * \param tetras pointer to a table containing the tetra structures.
  * \param *perm pointer to the permutation table (to perform in place
@@ -423,3 +423,351 @@ int MMG5_mmg3dRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol,
 }
 #endif
 
+/** Number of bits per direction of the space-filling curve keys */
+#define MMG3D_SFCBITS 21
+
+/**
+ * \struct MMG3D_SfcKey
+ * \brief Position of an element along the space-filling curve.
+ */
+typedef struct {
+  uint64_t key;
+  MMG5_int k;
+} MMG3D_SfcKey;
+
+static int MMG3D_cmpSfcKey(const void *a,const void *b) {
+  const MMG3D_SfcKey *ka = (const MMG3D_SfcKey*)a;
+  const MMG3D_SfcKey *kb = (const MMG3D_SfcKey*)b;
+
+  if ( ka->key < kb->key ) return -1;
+  if ( ka->key > kb->key ) return  1;
+  return ( ka->k > kb->k ) - ( ka->k < kb->k );
+}
+
+/**
+ * \param x integer coordinate (on \ref MMG3D_SFCBITS bits).
+ * \return \a x with two zero bits inserted between each of its bits.
+ */
+static inline uint64_t MMG3D_sfcSpread(uint64_t x) {
+  x &= 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffULL;
+  x = (x | x << 16) & 0x1f0000ff0000ffULL;
+  x = (x | x <<  8) & 0x100f00f00f00f00fULL;
+  x = (x | x <<  4) & 0x10c30c30c30c30c3ULL;
+  x = (x | x <<  2) & 0x1249249249249249ULL;
+  return x;
+}
+
+/**
+ * \param c point coordinates.
+ * \param min lower corner of the bounding box.
+ * \param dd scaling from the bounding box to the integer grid.
+ * \return the Morton key of \a c.
+ */
+static inline uint64_t MMG3D_sfcKey(double c[3],double min[3],double dd) {
+  uint64_t x[3];
+  double   d;
+  int      i;
+
+  for ( i=0; i<3; ++i ) {
+    d    = (c[i]-min[i])*dd;
+    x[i] = d > 0. ? (uint64_t)d : 0;
+    if ( x[i] >= (1ULL<<MMG3D_SFCBITS) ) x[i] = (1ULL<<MMG3D_SFCBITS)-1;
+  }
+  return MMG3D_sfcSpread(x[0]) | MMG3D_sfcSpread(x[1]) << 1
+    | MMG3D_sfcSpread(x[2]) << 2;
+}
+
+/**
+ * \param tab pointer toward the first item of the array to permute.
+ * \param siz size of an item of the array.
+ * \param perm new position of each item (0 for an item to drop), destroyed.
+ * \param n number of items (from 1 to \a n).
+ * \param tmp buffer of size \a siz.
+ *
+ * Permute in place an array of items numbered from 1: the items that are
+ * dropped are moved after the kept ones.
+ *
+ */
+static void MMG3D_sfcPermute(void *tab,size_t siz,MMG5_int *perm,MMG5_int n,
+                             void *tmp) {
+  char     *t = (char*)tab;
+  MMG5_int k,j;
+
+  for ( k=1; k<=n; ++k ) {
+    while ( perm[k] && perm[k] != k ) {
+      j = perm[k];
+      memcpy(tmp        ,t+(j-1)*siz,siz);
+      memcpy(t+(j-1)*siz,t+(k-1)*siz,siz);
+      memcpy(t+(k-1)*siz,tmp        ,siz);
+      perm[k] = perm[j];
+      perm[j] = j;
+    }
+  }
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param ne the tetra from 1 to \a ne are sorted.
+ * \param order array of size \a ne filled by the indices of the used tetra
+ * sorted along the curve.
+ * \return the number of used tetra stored in \a order, -1 if fail.
+ *
+ * Sort the used tetra along a Morton space-filling curve of their barycenters.
+ *
+ */
+MMG5_int MMG3D_sfcSortTetra(MMG5_pMesh mesh,MMG5_int ne,MMG5_int *order) {
+  MMG5_pTetra  pt;
+  MMG5_pPoint  ppt;
+  MMG3D_SfcKey *key;
+  MMG5_int     k,nereal;
+  double       min[3],max[3],c[3],dd;
+  int          i,j;
+
+  /* Bounding box of the used points */
+  for ( i=0; i<3; ++i ) {
+    min[i] =  DBL_MAX;
+    max[i] = -DBL_MAX;
+  }
+  nereal = 0;
+  for ( k=1; k<=ne; ++k ) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+    ++nereal;
+    for ( j=0; j<4; ++j ) {
+      ppt = &mesh->point[pt->v[j]];
+      for ( i=0; i<3; ++i ) {
+        min[i] = MG_MIN(min[i],ppt->c[i]);
+        max[i] = MG_MAX(max[i],ppt->c[i]);
+      }
+    }
+  }
+  if ( !nereal ) return 0;
+
+  dd = 0.;
+  for ( i=0; i<3; ++i ) dd = MG_MAX(dd,max[i]-min[i]);
+  dd = dd > 0. ? (double)((1ULL<<MMG3D_SFCBITS)-1) / dd : 1.;
+
+  MMG5_ADD_MEM(mesh,nereal*sizeof(MMG3D_SfcKey),"space-filling curve keys",
+               return -1);
+  MMG5_SAFE_MALLOC(key,nereal,MMG3D_SfcKey,
+                   mesh->memCur -= nereal*sizeof(MMG3D_SfcKey); return -1);
+
+  /* 4 times the barycenter is used */
+  nereal = 0;
+  for ( k=1; k<=ne; ++k ) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+    c[0] = c[1] = c[2] = 0.;
+    for ( j=0; j<4; ++j ) {
+      ppt = &mesh->point[pt->v[j]];
+      for ( i=0; i<3; ++i ) c[i] += 0.25*ppt->c[i];
+    }
+    key[nereal].key = MMG3D_sfcKey(c,min,dd);
+    key[nereal].k   = k;
+    ++nereal;
+  }
+  qsort(key,nereal,sizeof(MMG3D_SfcKey),MMG3D_cmpSfcKey);
+  for ( k=0; k<nereal; ++k ) order[k] = key[k].k;
+  MMG5_DEL_MEM(mesh,key);
+
+  return nereal;
+}
+
+/**
+ * \param boxVertNbr unused (for compatibility with the scotch renumbering).
+ * \param mesh pointer to the mesh structure.
+ * \param sol pointer to the solution structure
+ * \param fields pointer to an array of solution fields
+ * \param permNodGlob array to store the global permutation of nodes (non mandatory)
+ *
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Renumber the tetra along a Morton space-filling curve of their barycenters,
+ * then the points, the xtetra and the xpoints by order of first appearance in
+ * the renumbered tetra, to improve the data locality without the scotch
+ * library. The adjacency relationships are permuted too (if allocated). As
+ * with scotch, the unused non required points are removed.
+ *
+ */
+int MMG3D_sfcRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol,
+                         MMG5_pSol fields,MMG5_int* permNodGlob) {
+  MMG5_pTetra  pt;
+  MMG5_pPoint  ppt;
+  MMG5_pPrism  pp;
+  MMG5_int     *tperm,*pperm,*xtperm,*xpperm,*work,*adja,nereal,npreal,nxt,nxp;
+  MMG5_int     k,kk,v,siz;
+  union {
+    MMG5_Tetra  t;
+    MMG5_xTetra xt;
+    MMG5_xPoint xp;
+    MMG5_int    adj[4];
+  }            tmp;
+  int          i,j;
+
+  (void)boxVertNbr;
+
+  /* Sort the tetra along the curve (work stores the sorted tetra) */
+  siz = 2*(mesh->ne+1)*sizeof(MMG5_int);
+  MMG5_ADD_MEM(mesh,siz,"renumbering keys",return 1);
+  MMG5_SAFE_CALLOC(tperm,mesh->ne+1,MMG5_int,
+                   mesh->memCur -= siz; return 1);
+  MMG5_SAFE_MALLOC(work,mesh->ne+1,MMG5_int,
+                   MMG5_DEL_MEM(mesh,tperm); mesh->memCur -= siz; return 1);
+
+  nereal = MMG3D_sfcSortTetra(mesh,mesh->ne,work);
+  if ( nereal <= 0 ) {
+    /* Empty mesh or lack of memory: the mesh is not renumbered */
+    MMG5_DEL_MEM(mesh,work);
+    MMG5_DEL_MEM(mesh,tperm);
+    return 1;
+  }
+  for ( k=0; k<nereal; ++k ) tperm[work[k]] = k+1;
+  MMG5_DEL_MEM(mesh,work);
+
+  /* Number the points and the boundary entities by order of appearance */
+  siz = (mesh->np+1 + mesh->xt+1 + mesh->xp+1)*sizeof(MMG5_int);
+  MMG5_ADD_MEM(mesh,siz,"renumbering tables",
+               MMG5_DEL_MEM(mesh,tperm);return 1);
+  MMG5_SAFE_CALLOC(pperm,mesh->np+1,MMG5_int,return 1);
+  MMG5_SAFE_CALLOC(xtperm,mesh->xt+1,MMG5_int,return 1);
+  MMG5_SAFE_CALLOC(xpperm,mesh->xp+1,MMG5_int,return 1);
+
+  MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(MMG5_int),"renumbering tables",
+               MMG5_DEL_MEM(mesh,tperm);MMG5_DEL_MEM(mesh,pperm);
+               MMG5_DEL_MEM(mesh,xtperm);MMG5_DEL_MEM(mesh,xpperm);
+               return 1);
+  MMG5_SAFE_MALLOC(work,mesh->ne+1,MMG5_int,return 1);
+
+  /* work: inverse permutation of the tetra */
+  for ( k=1; k<=mesh->ne; ++k ) {
+    if ( tperm[k] ) work[tperm[k]] = k;
+  }
+
+  npreal = nxt = nxp = 0;
+  for ( kk=1; kk<=nereal; ++kk ) {
+    pt = &mesh->tetra[work[kk]];
+    if ( pt->xt && !xtperm[pt->xt] ) xtperm[pt->xt] = ++nxt;
+    for ( j=0; j<4; ++j ) {
+      v = pt->v[j];
+      if ( pperm[v] ) continue;
+      ppt = &mesh->point[v];
+      if ( ppt->tag & MG_NUL ) continue;
+      pperm[v] = ++npreal;
+      if ( ppt->xp && !xpperm[ppt->xp] ) xpperm[ppt->xp] = ++nxp;
+    }
+  }
+  for ( k=1; k<=mesh->nprism; ++k ) {
+    pp = &mesh->prism[k];
+    if ( !MG_EOK(pp) ) continue;
+    for ( j=0; j<6; ++j ) {
+      v = pp->v[j];
+      if ( pperm[v] ) continue;
+      ppt = &mesh->point[v];
+      if ( ppt->tag & MG_NUL ) continue;
+      pperm[v] = ++npreal;
+      if ( ppt->xp && !xpperm[ppt->xp] ) xpperm[ppt->xp] = ++nxp;
+    }
+  }
+  /* Append unseen required points for orphan points preservation */
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) || pperm[k] ) continue;
+    if ( ppt->tag & MG_REQ ) {
+      pperm[k] = ++npreal;
+      if ( ppt->xp && !xpperm[ppt->xp] ) xpperm[ppt->xp] = ++nxp;
+    }
+  }
+
+  /* Update the references to the renumbered entities */
+  for ( k=1; k<=mesh->ne; ++k ) {
+    if ( !tperm[k] ) continue;
+    pt = &mesh->tetra[k];
+    for ( j=0; j<4; ++j ) pt->v[j] = pperm[pt->v[j]];
+    pt->xt = xtperm[pt->xt];
+    if ( mesh->adja ) {
+      adja = &mesh->adja[4*(k-1)+1];
+      for ( i=0; i<4; ++i ) {
+        if ( adja[i] ) adja[i] = 4*tperm[adja[i]/4] + adja[i]%4;
+      }
+    }
+  }
+  for ( k=1; k<=mesh->nprism; ++k ) {
+    for ( j=0; j<6; ++j ) mesh->prism[k].v[j] = pperm[mesh->prism[k].v[j]];
+  }
+  for ( k=1; k<=mesh->nquad; ++k ) {
+    for ( j=0; j<4; ++j ) mesh->quadra[k].v[j] = pperm[mesh->quadra[k].v[j]];
+  }
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( pperm[k] ) ppt->xp = xpperm[ppt->xp];
+  }
+
+  /* If needed, store update the global permutation for point array */
+  if ( permNodGlob ) {
+    for ( k=1; k<=mesh->npi; ++k ) {
+      if ( MG_VOK( &mesh->point[permNodGlob[k]] ) ) {
+        permNodGlob[k] = pperm[permNodGlob[k]];
+        assert ( permNodGlob[k] > 0 );
+      }
+    }
+  }
+
+  /* Permute the arrays */
+  if ( mesh->adja ) {
+    memcpy(work,tperm,(mesh->ne+1)*sizeof(MMG5_int));
+    MMG3D_sfcPermute(&mesh->adja[1],4*sizeof(MMG5_int),work,mesh->ne,&tmp);
+    memset(&mesh->adja[4*nereal+1],0,4*(mesh->ne-nereal)*sizeof(MMG5_int));
+  }
+  MMG3D_sfcPermute(&mesh->tetra[1],sizeof(MMG5_Tetra),tperm,mesh->ne,&tmp);
+  if ( mesh->xt ) {
+    MMG3D_sfcPermute(&mesh->xtetra[1],sizeof(MMG5_xTetra),xtperm,mesh->xt,&tmp);
+  }
+  if ( mesh->xp ) {
+    MMG3D_sfcPermute(&mesh->xpoint[1],sizeof(MMG5_xPoint),xpperm,mesh->xp,&tmp);
+  }
+  for ( k=1; k<=mesh->np; ++k ) {
+    while ( pperm[k] != k && pperm[k] )
+      MMG5_swapNod(mesh,mesh->point,sol ? sol->m : NULL,fields,pperm,k,
+                   pperm[k],sol ? sol->size : 0);
+  }
+
+  MMG5_DEL_MEM(mesh,work);
+  MMG5_DEL_MEM(mesh,xpperm);
+  MMG5_DEL_MEM(mesh,xtperm);
+  MMG5_DEL_MEM(mesh,pperm);
+  MMG5_DEL_MEM(mesh,tperm);
+
+  mesh->ne = nereal;
+  mesh->np = npreal;
+  mesh->xt = nxt;
+  mesh->xp = nxp;
+
+  if ( mesh->np >= mesh->npmax-1 )
+    mesh->npnil = 0;
+  else
+    mesh->npnil = mesh->np + 1;
+
+  if ( mesh->ne >= mesh->nemax-1 )
+    mesh->nenil = 0;
+  else
+    mesh->nenil = mesh->ne + 1;
+
+  if ( mesh->npnil ) {
+    for (k=mesh->npnil; k<mesh->npmax-1; k++) {
+      mesh->point[k].tmp  = k+1;
+    }
+    mesh->point[mesh->npmax-1].tmp = 0;
+    mesh->point[mesh->npmax  ].tmp = 0;
+  }
+
+  if ( mesh->nenil ) {
+    for (k=mesh->nenil; k<mesh->nemax-1; k++) {
+      mesh->tetra[k].v[3] = k+1;
+    }
+    mesh->tetra[mesh->nemax-1].v[3] = 0;
+    mesh->tetra[mesh->nemax  ].v[3] = 0;
+  }
+
+  return 1;
+}
@@ -200,7 +200,7 @@ int MMG3D_defaultOption(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol) {
   double    hsiz;
   char      stim[32];
 
-  MMG3D_Set_commonFunc();
+  MMG3D_Set_commonOps(mesh);
 
   signal(SIGABRT,MMG5_excfun);
   signal(SIGFPE,MMG5_excfun);
@@ -256,7 +256,7 @@ int MMG3D_defaultOption(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol) {
 
   /* specific meshing + hmin/hmax update */
   if ( mesh->info.optim ) {
-    if ( !MMG3D_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( !MMG5_unscaleMesh(mesh,met,sol) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
         _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
     }
@@ -313,8 +313,6 @@ int main(int argc,char *argv[]) {
   fprintf(stdout,"     %s %s\n",__DATE__,__TIME__);
 #endif
 
-  MMG3D_Set_commonFunc();
-
   /* Print timer at exit */
   atexit(MMG5_endcod);
 
@@ -369,7 +369,7 @@ int8_t MMG5_chkedg(MMG5_pMesh mesh,MMG5_Tria *pt,int8_t ori, double hmax,
   double        ps,ps2,ux,uy,uz,ll,il,alpha,dis,hma2;
   MMG5_int      ia,ib,ic;//l,info;
   int8_t        i,i1,i2;
-  static int8_t mmgWarn0 = 0, mmgWarn1 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0, mmgWarn1 = 0;
 
   ia   = pt->v[0];
   ib   = pt->v[1];
@@ -583,19 +583,79 @@ int8_t MMG5_chkedg(MMG5_pMesh mesh,MMG5_Tria *pt,int8_t ori, double hmax,
   return pt->flag;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param nlayer number of layers of elements to add around the flagged ones.
+ * \return the number of active elements.
+ *
+ * Restrict the remeshing to the elements flagged by the caller (\a flag
+ * field set to 1), extended by \a nlayer layers of elements sharing a vertex
+ * with them. The active elements are marked with \a mesh->mark and the other
+ * ones with a mark lower than \a mesh->markmin, so they are skipped by the
+ * remeshing operators (which treat only the elements with a mark greater than
+ * a test mark, itself always greater than \a mesh->markmin). Element flags
+ * are reset.
+ *
+ */
+MMG5_int MMG3D_setActiveRegion(MMG5_pMesh mesh,int nlayer) {
+  MMG5_pTetra pt;
+  MMG5_int    k,nact;
+  int         i,l;
+
+  for (l=0; l<nlayer; l++) {
+    ++mesh->base;
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) || pt->flag != 1 ) continue;
+      for (i=0; i<4; i++)
+        mesh->point[pt->v[i]].flag = mesh->base;
+    }
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) || pt->flag == 1 ) continue;
+      for (i=0; i<4; i++) {
+        if ( mesh->point[pt->v[i]].flag == mesh->base ) {
+          pt->flag = 1;
+          break;
+        }
+      }
+    }
+  }
+
+  mesh->mark   += 3;
+  mesh->markmin = mesh->mark-2;
+
+  nact = 0;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+    if ( pt->flag == 1 ) {
+      pt->mark = mesh->mark;
+      ++nact;
+    }
+    else
+      pt->mark = mesh->mark-3;
+    pt->flag = 0;
+  }
+
+  return nact;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
  * \param PROctree pointer to the PROctree structure (only for delaunay).
  * \param typchk type of checking permformed for edge length (hmin or LSHORT
  * criterion).
+ * \param testmark all the tets with a mark less than testmark will not be treated.
  * \return -1 if failed and swap number otherwise.
  *
  * Search for boundary edges that could be swapped for geometric
  * approximation.
  *
  */
-MMG5_int MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree PROctree, int typchk) {
+MMG5_int MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree PROctree,
+                     int typchk,MMG5_int testmark) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
   int           it,ilist,ret,maxit;
@@ -611,6 +671,7 @@ MMG5_int MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree PROctree, int
       pt = &mesh->tetra[k];
       if ( (!MG_EOK(pt)) || pt->ref < 0 || (pt->tag & MG_REQ) )   continue;
       else if ( !pt->xt ) continue;
+      else if ( pt->mark < testmark )  continue;
       pxt = &mesh->xtetra[pt->xt];
 
       for (i=0; i<4; i++) {
@@ -716,6 +777,239 @@ MMG5_int MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
   return nns;
 }
 
+/** Maximal number of colours used to move the internal points by waves */
+#define MMG3D_MAXCOL 64
+
+/**
+ * \struct MMG3D_MovWaves
+ * \brief Work arrays to move the internal points by waves of independent
+ * points (see \ref MMG3D_movintpt_waves).
+ */
+typedef struct {
+  int64_t      *cand;  /*!< points to move (4*tetra+local index) */
+  int64_t      *ord;   /*!< points to move sorted by colour */
+  double       *oldc;  /*!< coordinates before the move (for the PROctree) */
+  uint8_t      *pcol;  /*!< colour of the points */
+  MMG3D_pVisit *vis;   /*!< traversal contexts (one per thread) */
+  MMG5_int     ncand;  /*!< number of points to move */
+  int          nc;     /*!< number of threads (1: no waves) */
+} MMG3D_MovWaves;
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param mw pointer to the work arrays.
+ *
+ * Free the work arrays allocated by \ref MMG3D_Init_movWaves.
+ *
+ */
+static void MMG3D_Free_movWaves(MMG5_pMesh mesh,MMG3D_MovWaves *mw) {
+  int c;
+
+  if ( mw->vis ) {
+    for ( c=0; c<mw->nc; ++c ) {
+      if ( mw->vis[c] ) MMG3D_Free_visit(mesh,&mw->vis[c]);
+    }
+    MMG5_DEL_MEM(mesh,mw->vis);
+  }
+  if ( mw->oldc ) MMG5_DEL_MEM(mesh,mw->oldc);
+  if ( mw->pcol ) MMG5_DEL_MEM(mesh,mw->pcol);
+  if ( mw->ord  ) MMG5_DEL_MEM(mesh,mw->ord);
+  if ( mw->cand ) MMG5_DEL_MEM(mesh,mw->cand);
+  mw->nc = 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param PROctree pointer to the PROctree structure.
+ * \param mw pointer to the work arrays.
+ *
+ * Allocate the work arrays needed to move the internal points by waves if
+ * several threads are available. Otherwise, or if the memory doesn't allow it,
+ * \a mw->nc is set to 1 and the points are moved during the tetra sweep.
+ *
+ */
+static void MMG3D_Init_movWaves(MMG5_pMesh mesh,MMG3D_pPROctree PROctree,
+                                MMG3D_MovWaves *mw) {
+  size_t siz;
+  int    c;
+
+  memset(mw,0,sizeof(MMG3D_MovWaves));
+
+  mw->nc = MMG5_nthreads(mesh,mesh->np);
+  if ( mw->nc == 1 ) return;
+
+  siz  = 2*mesh->np*sizeof(int64_t) + (mesh->np+1)*sizeof(uint8_t);
+  siz += mw->nc*sizeof(MMG3D_pVisit);
+  if ( PROctree ) siz += 3*mesh->np*sizeof(double);
+  if ( mesh->memCur + siz > mesh->memMax ) {
+    mw->nc = 1;
+    return;
+  }
+
+  mesh->memCur += mesh->np*sizeof(int64_t);
+  MMG5_SAFE_CALLOC(mw->cand,mesh->np,int64_t,
+                   mesh->memCur -= mesh->np*sizeof(int64_t);
+                   MMG3D_Free_movWaves(mesh,mw);return);
+  mesh->memCur += mesh->np*sizeof(int64_t);
+  MMG5_SAFE_CALLOC(mw->ord,mesh->np,int64_t,
+                   mesh->memCur -= mesh->np*sizeof(int64_t);
+                   MMG3D_Free_movWaves(mesh,mw);return);
+  mesh->memCur += (mesh->np+1)*sizeof(uint8_t);
+  MMG5_SAFE_CALLOC(mw->pcol,mesh->np+1,uint8_t,
+                   mesh->memCur -= (mesh->np+1)*sizeof(uint8_t);
+                   MMG3D_Free_movWaves(mesh,mw);return);
+  if ( PROctree ) {
+    mesh->memCur += 3*mesh->np*sizeof(double);
+    MMG5_SAFE_CALLOC(mw->oldc,3*mesh->np,double,
+                     mesh->memCur -= 3*mesh->np*sizeof(double);
+                     MMG3D_Free_movWaves(mesh,mw);return);
+  }
+  mesh->memCur += mw->nc*sizeof(MMG3D_pVisit);
+  MMG5_SAFE_CALLOC(mw->vis,mw->nc,MMG3D_pVisit,
+                   mesh->memCur -= mw->nc*sizeof(MMG3D_pVisit);
+                   MMG3D_Free_movWaves(mesh,mw);return);
+  for ( c=0; c<mw->nc; ++c ) {
+    if ( !MMG3D_Init_visit(mesh,&mw->vis[c]) ) {
+      MMG3D_Free_movWaves(mesh,mw);
+      return;
+    }
+  }
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param PROctree pointer to the PROctree structure.
+ * \param mw pointer to the work arrays storing the points to move.
+ * \param improveVol forbid volume degradation during the move
+ * \return number of moved points.
+ *
+ * Move internal points by waves of independent points. Points are greedily
+ * coloured in the order of \a mw->cand so that the vertices of a tetra have
+ * different colours, then the points of each colour are moved in parallel:
+ * their balls don't share any tetra so the moves don't interact and the result
+ * doesn't depend on the number of threads. The PROctree is updated serially
+ * after each wave, in the order of \a mw->cand. The few points that can't be
+ * coloured are moved serially at the end.
+ *
+ */
+static MMG5_int MMG3D_movintpt_waves(MMG5_pMesh mesh,MMG5_pSol met,
+                                     MMG3D_pPROctree PROctree,
+                                     MMG3D_MovWaves *mw,int improveVol) {
+  MMG5_pTetra   pt;
+  MMG5_int      q,ip,nm,ncand,wave[MMG3D_MAXCOL+4],beg,end;
+  int64_t       *cand,*ord,listv[MMG3D_LMAX+2];
+  double        *oldc;
+  uint64_t      used;
+  uint8_t       *pcol;
+  int           ilistv,l,j,col,ncw;
+
+  cand  = mw->cand;
+  ord   = mw->ord;
+  oldc  = mw->oldc;
+  pcol  = mw->pcol;
+  ncand = mw->ncand;
+
+  if ( !ncand ) return 0;
+
+  /* Greedy colouring: pcol[ip] is 0 if the point has no colour yet, the
+   * colour+1 otherwise. A colour of MMG3D_MAXCOL marks a point that must be
+   * moved serially, MMG3D_MAXCOL+1 a point whose ball can't be computed */
+  for (q=0; q<ncand; q++) {
+    pcol[mesh->tetra[cand[q]/4].v[cand[q]%4]] = 0;
+  }
+  memset(wave,0,(MMG3D_MAXCOL+4)*sizeof(MMG5_int));
+
+  for (q=0; q<ncand; q++) {
+    ip     = mesh->tetra[cand[q]/4].v[cand[q]%4];
+    ilistv = MMG5_boulevolp(mesh,cand[q]/4,cand[q]%4,listv);
+
+    if ( !ilistv ) {
+      col = MMG3D_MAXCOL+1;
+    }
+    else {
+      used = 0;
+      for (l=0; l<ilistv; l++) {
+        pt = &mesh->tetra[listv[l]/4];
+        for (j=0; j<4; j++) {
+          if ( pcol[pt->v[j]] && pcol[pt->v[j]] <= MMG3D_MAXCOL ) {
+            used |= (uint64_t)1 << (pcol[pt->v[j]]-1);
+          }
+        }
+      }
+      for (col=0; col<MMG3D_MAXCOL && (used & ((uint64_t)1 << col)); col++);
+    }
+    pcol[ip] = col+1;
+    ++wave[col+2];
+  }
+
+  /* Sort the points by colour, keeping the order of cand in each colour: at
+   * the end, points of colour col are stored from wave[col] to wave[col+1] */
+  for (col=1; col<=MMG3D_MAXCOL+2; col++) {
+    wave[col+1] += wave[col];
+  }
+  for (q=0; q<ncand; q++) {
+    ip = mesh->tetra[cand[q]/4].v[cand[q]%4];
+    ord[wave[pcol[ip]]++] = cand[q];
+  }
+
+  /* Move the points, one colour after the other */
+  nm  = 0;
+  beg = 0;
+  for (col=0; col<MMG3D_MAXCOL; col++) {
+    end = wave[col+1];
+    if ( end == beg ) break;
+
+    ncw = MG_MIN(mw->nc,MMG5_nthreads(mesh,end-beg));
+
+    /* The pcol slot of a point stores the result of its move */
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(ncw) schedule(dynamic,64)
+#endif
+    for (q=beg; q<end; q++) {
+      int64_t  lv[MMG3D_LMAX+2];
+      MMG5_int k,iq;
+      int      il,i;
+
+      k  = ord[q]/4;
+      i  = ord[q]%4;
+      iq = mesh->tetra[k].v[i];
+
+      il = MMG5_boulevolp_visit(mesh,mw->vis[MMG5_THREAD_NUM()],k,i,lv);
+      if ( !il ) {
+        pcol[iq] = 0;
+        continue;
+      }
+      if ( PROctree ) {
+        memcpy(&oldc[3*q],mesh->point[iq].c,3*sizeof(double));
+      }
+      pcol[iq] = mesh->ops->movintpt_par(mesh,met,lv,il,improveVol);
+    }
+
+    for (q=beg; q<end; q++) {
+      ip = mesh->tetra[ord[q]/4].v[ord[q]%4];
+      if ( !pcol[ip] ) continue;
+
+      ++nm;
+      if ( PROctree ) {
+        MMG3D_movePROctree(mesh,PROctree,ip,mesh->point[ip].c,&oldc[3*q]);
+      }
+    }
+    beg = end;
+  }
+
+  /* Points with too many coloured neighbours */
+  end = wave[MMG3D_MAXCOL+1];
+  for (q=wave[MMG3D_MAXCOL]; q<end; q++) {
+    ilistv = MMG5_boulevolp(mesh,ord[q]/4,ord[q]%4,listv);
+    if ( !ilistv ) continue;
+
+    if ( MMG5_movintpt(mesh,met,PROctree,listv,ilistv,improveVol) ) ++nm;
+  }
+
+  return nm;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -732,6 +1026,11 @@ MMG5_int MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
  *
  * Analyze tetrahedra and move points so as to make mesh more uniform.
  *
+ * \remark with several threads, the internal points are moved after the sweep
+ * by waves of independent points (see \ref MMG3D_movintpt_waves): the result
+ * is the same for any number of threads greater than 1 but differs from the
+ * serial one.
+ *
  */
 MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
                 double clickSurf,double clickVol,int moveVol, int improveSurf,
@@ -740,6 +1039,7 @@ MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
   MMG5_pPoint   ppt;
   MMG5_pxTetra  pxt;
   MMG5_Tria     tt;
+  MMG3D_MovWaves mw;
   double        *n,caltri;
   int           ier,ilists,ilistv,it,i;
   MMG5_int      k,lists[MMG3D_LMAX+2],nm,nnm,ns,base;
@@ -753,6 +1053,14 @@ MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = base;
 
+  /* With several threads, the internal points are moved after the tetra sweep
+   * by waves of independent points */
+  memset(&mw,0,sizeof(MMG3D_MovWaves));
+  mw.nc = 1;
+  if ( moveVol && mesh->ops->movintpt_par ) {
+    MMG3D_Init_movWaves(mesh,PROctree,&mw);
+  }
+
   it = nnm = 0;
   do {
     base++;
@@ -811,8 +1119,10 @@ MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
                 if( !ier )  continue;
                 else if ( ier>0 )
                   ier = MMG5_movbdynompt(mesh,met,PROctree,listv,ilistv,lists,ilists,improveVolSurf);
-                else
+                else {
+                  MMG3D_Free_movWaves(mesh,&mw);
                   return -1;
+                }
               }
             }
             else if ( ppt->tag & MG_GEO ) {
@@ -820,8 +1130,10 @@ MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
               if ( !ier )  continue;
               else if ( ier>0 )
                 ier = MMG5_movbdyridpt(mesh,met,PROctree,listv,ilistv,lists,ilists,improveVolSurf);
-              else
+              else {
+                MMG3D_Free_movWaves(mesh,&mw);
                 return -1;
+              }
             }
             else if ( ppt->tag & MG_REF ) {
               ier=MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
@@ -829,15 +1141,19 @@ MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
                 continue;
               else if ( ier>0 )
                 ier = MMG5_movbdyrefpt(mesh,met,PROctree,listv,ilistv,lists,ilists,improveVolSurf);
-              else
+              else {
+                MMG3D_Free_movWaves(mesh,&mw);
                 return -1;
+              }
             }
             else {
               ier=MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
               if ( !ier )
                 continue;
-              else if ( ier<0 )
+              else if ( ier<0 ) {
+                MMG3D_Free_movWaves(mesh,&mw);
                 return -1;
+              }
 
               n = &(mesh->xpoint[ppt->xp].n1[0]);
 
@@ -850,12 +1166,21 @@ MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
               }
               ier = MMG5_movbdyregpt(mesh,met,PROctree,listv,ilistv,
                                      lists,ilists,improveSurf,improveVolSurf);
-              if (ier < 0 ) return -1;
+              if (ier < 0 ) {
+                MMG3D_Free_movWaves(mesh,&mw);
+                return -1;
+              }
               else if ( ier )  ns++;
             }
           }
           else if ( moveVol && (pt->qual < clickVol) ) {
             assert( 0<=i0 && i0<4 && "unexpected local index for vertex");
+            if ( mw.nc > 1 ) {
+              /* Point moved by MMG3D_movintpt_waves after the sweep */
+              ppt->flag = base;
+              mw.cand[mw.ncand++] = 4*k+i0;
+              continue;
+            }
             ilistv = MMG5_boulevolp(mesh,k,i0,listv);
             if ( !ilistv )  continue;
             ier = MMG5_movintpt(mesh,met,PROctree,listv,ilistv,improveVol);
@@ -869,11 +1194,19 @@ MMG5_int MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
         }
       }
     }
+    if ( mw.nc > 1 ) {
+      nm += MMG3D_movintpt_waves(mesh,met,PROctree,&mw,improveVol);
+      mw.ncand = 0;
+    }
     nnm += nm;
     if ( mesh->info.ddebug )  fprintf(stdout,"     %8" MMG5_PRId " moved, %" MMG5_PRId " geometry\n",nm,ns);
   }
   while( ++it < maxit && nm > 0 );
 
+  if ( mw.nc > 1 ) {
+    MMG3D_Free_movWaves(mesh,&mw);
+  }
+
   if ( (abs(mesh->info.imprim) > 5 || mesh->info.ddebug) && nnm )
     fprintf(stdout,"     %8" MMG5_PRId " vertices moved, %d iter.\n",nnm,it);
 
@@ -894,6 +1227,7 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
   MMG5_pxTetra    pxt;
   MMG5_pPoint     p0,p1;
   MMG5_pPar       par;
+  MMG3D_pHotPoint hp;
   double          ll,ux,uy,uz,hmi2;
   int             ilists,ilist;
   MMG5_int        base,k,nc,nnm,lists[MMG3D_LMAX+2],refmin,refplus;
@@ -914,6 +1248,13 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
     p0->flag = 0;
   }
 
+  /* Isotropic lengths: read the coordinates and sizes from a compact copy of
+   * the points (collapses neither move nor create points) */
+  hp = NULL;
+  if ( typchk == 2 && !mesh->info.ani && met->m && met->size == 1 ) {
+    hp = MMG3D_hotPoints(mesh,met);
+  }
+
   for (k=1; k<=mesh->ne; k++) {
     /* Remark: we can have int32 overflow on large meshes for base field..*/
     base = ++mesh->base;
@@ -981,6 +1322,7 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
                 bsret = MMG5_boulesurfvolpNom(mesh,k,ip,i,
                                               list,&ilist,lists,&ilists,&refmin,&refplus,p0->tag & MG_NOM);
                 if(bsret==-1 || bsret==-3 || bsret==-4){
+                  MMG3D_freeHotPoints(mesh,&hp);
                   return -3;   // fatal
                 }else if(bsret==-2){
                   continue;    // ball computation failed: cannot handle this vertex
@@ -990,8 +1332,10 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
             }
             else {
               if (MMG5_boulesurfvolp(mesh,k,ip,i,
-                                     list,&ilist,lists,&ilists,p0->tag & MG_NOM) < 0 )
+                                     list,&ilist,lists,&ilists,p0->tag & MG_NOM) < 0 ) {
+                MMG3D_freeHotPoints(mesh,&hp);
                 return -2;
+              }
             }
           }
           else {
@@ -1092,7 +1436,12 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
           if ( ll > hmi2*MMG3D_LSHRT )  continue;
         }
         else if ( typchk == 2 ) {
-          ll = MMG5_lenedg(mesh,met,MMG5_iarf[i][j],pt);
+          if ( hp ) {
+            ll = MMG3D_lenedg_iso_hot(hp,MMG5_iarf[i][j],pt);
+          }
+          else {
+            ll = MMG5_lenedg(mesh,met,MMG5_iarf[i][j],pt);
+          }
           // Case of an internal tetra with 4 ridges vertices.
           if ( ll == 0 ) continue;
           if ( ll > MMG3D_LSHRT )  continue;
@@ -1120,6 +1469,7 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
                 bsret = MMG5_boulesurfvolpNom(mesh,k,ip,i,
                                               list,&ilist,lists,&ilists,&refmin,&refplus,p0->tag & MG_NOM);
                 if(bsret==-1 || bsret==-3 || bsret==-4){
+                  MMG3D_freeHotPoints(mesh,&hp);
                   return -3;   // fatal
                 }else if(bsret==-2){
                   continue;    // ball computation failed: cannot handle this vertex
@@ -1129,8 +1479,10 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
             }
             else {
               if (MMG5_boulesurfvolp(mesh,k,ip,i,
-                                     list,&ilist,lists,&ilists,p0->tag & MG_NOM) < 0 )
+                                     list,&ilist,lists,&ilists,p0->tag & MG_NOM) < 0 ) {
+                MMG3D_freeHotPoints(mesh,&hp);
                 return -4;
+              }
             }
           }
           else {
@@ -1164,13 +1516,19 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
 
         if ( ilist > 0 ) {
           ier = MMG5_colver(mesh,met,list,ilist,iq,typchk);
-          if ( ier < 0 ) return -5;
+          if ( ier < 0 ) {
+            MMG3D_freeHotPoints(mesh,&hp);
+            return -5;
+          }
           else if ( ier ) {
             MMG3D_delPt(mesh,ier);
             break;
           }
         }
-        else if (ilist < 0 ) return -6;
+        else if (ilist < 0 ) {
+          MMG3D_freeHotPoints(mesh,&hp);
+          return -6;
+        }
       }
       if ( ier ) {
         p1->flag = base;
@@ -1183,6 +1541,8 @@ static MMG5_int MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
   if ( nc > 0 && (abs(mesh->info.imprim) > 5 || mesh->info.ddebug) )
     fprintf(stdout,"     %8" MMG5_PRId " vertices removed, %8" MMG5_PRId " non manifold,\n",nc,nnm);
 
+  MMG3D_freeHotPoints(mesh,&hp);
+
   return nc;
 }
 
@@ -1686,7 +2046,7 @@ int MMG3D_normalAndTangent_at_sinRidge(MMG5_pMesh mesh,MMG5_int k,int i,int j,
   MMG5_Tria ptt;
   double    dd;
   int       ier;
-  static int8_t warn_n = 0;
+  static MMG5_THREADLOCAL int8_t warn_n = 0;
 
   assert ( 0<=i && i<4 && "unexpected local idx for face" );
   assert ( 0<=j && j<3 && "unexpected local edg odx in face" );
@@ -2300,7 +2660,7 @@ MMG3D_anatets_iso(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
   MMG5_int      ip,vx[6],src,nc,ns,ni,ne,k,ip1,ip2,nap,ixp1,ixp2;
   int8_t        i,j,j2,ia,i1,i2,ifac,intnom;
   static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
-  static int8_t mmgWarn = 0, mmgWarn2 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn = 0, mmgWarn2 = 0;
 
   /** 1. analysis of boundary elements */
   if ( !MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) ) return -1;
@@ -2728,8 +3088,6 @@ MMG3D_anatets_iso(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
   return nap;
 }
 
-static MMG5_int (*MMG3D_anatets)(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk);
-
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -3034,7 +3392,7 @@ static MMG5_int MMG5_anatet4(MMG5_pMesh mesh, MMG5_pSol met,MMG5_int *nf, int8_t
   MMG5_int      ier,ns,k,adj;
   int8_t        nbdy,j;
 #ifndef NDEBUG
-  static int8_t mmgWarn=0;
+  static MMG5_THREADLOCAL int8_t mmgWarn=0;
 #endif
 
   ns = 0;
@@ -3159,6 +3517,7 @@ static MMG5_int MMG5_anatet4rid(MMG5_pMesh mesh, MMG5_pSol met,MMG5_int *nf, int
 int MMG5_anatet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk, int patternMode) {
   int        it,minit,maxit,lastit;
   MMG5_int   nc,ns,nnc,nns,nnf,ier,nf;
+  MMG5_int   (*MMG3D_anatets)(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk);
 
   /* pointer to the suitable anatets function */
   if ( met->m && met->size==6 ) {
@@ -3237,7 +3596,7 @@ int MMG5_anatet(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk, int patternMode) {
 
     /* attempt to swap */
     if ( !mesh->info.noswap ) {
-      ier = MMG5_swpmsh(mesh,met,NULL,typchk);
+      ier = MMG5_swpmsh(mesh,met,NULL,typchk,-1);
       if ( ier < 0 ) {
         fprintf(stderr,"\n  ## Unable to improve mesh. Exiting.\n");
         return 0;
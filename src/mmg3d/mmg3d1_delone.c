@@ -411,40 +411,47 @@ int MMG3D_mmg3d1_delone_splcol(MMG5_pMesh mesh, MMG5_pSol met,
  * \param met pointer to the metric structure.
  * \param PROctree pointer to the PROctree structure.
  * \param ne number of elements.
+ * \param order if not NULL, indices of the \a ne elements to process in the
+ * processing order.
  * \param ifilt pointer to store the number of vertices filtered by the PROctree.
  * \param ns pointer to store the number of vertices insertions.
  * \param nc pointer to store the number of collapse.
+ * \param nvis pointer to store the number of visited elements.
  * \param warn pointer to store a flag that warn the user in case of
  * reallocation difficulty.
  * \return -1 if fail and we don't save the mesh, 0 if fail but we try to save
  * the mesh, 1 otherwise.
  *
  * \a adpsplcol loop: split edges longer than \ref MMG3D_LOPTL_DEL and
- * collapse edges shorter than \ref MMG3D_LOPTS.
+ * collapse edges shorter than \ref MMG3D_LOPTS. Only the elements modified by
+ * the two previous waves (mark greater than \a mesh->mark-2) are visited.
  *
  */
 static inline
 int MMG5_adpsplcol(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree *PROctree,
-                   MMG5_int ne,MMG5_int* ifilt,MMG5_int* ns,MMG5_int* nc,int* warn) {
+                   MMG5_int ne,MMG5_int *order,MMG5_int* ifilt,MMG5_int* ns,
+                   MMG5_int* nc,MMG5_int *nvis,int* warn) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
   double        len,lmax;
-  MMG5_int      k,base;
+  MMG5_int      k,kk,base;
   double        lmin;
   double        lmaxtet,lmintet;
   int           ier,imaxtet,imintet;
   int8_t        imin,imax,chkRidTet;
-  static int8_t mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0;
 
   base = ++mesh->mark;
 
   if ( met->size==6 )  chkRidTet=1;
   else chkRidTet=0;
 
-  for (k=1; k<=ne; k++) {
+  for (kk=1; kk<=ne; kk++) {
+    k  = order ? order[kk] : kk;
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt)  || (pt->tag & MG_REQ) )   continue;
     else if ( pt->mark < base-2 )  continue;
+    ++(*nvis);
     pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
 
     /** Step 1: find longest and shortest edge  (and try to manage them) */
@@ -575,10 +582,10 @@ int MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree) {
 
   do {
     /* treatment of bad elements*/
-    nw = MMG3D_opttyp(mesh,met,PROctree,-1);
+    nw = MMG3D_opttyp(mesh,met,PROctree,mesh->markmin);
     /* badly shaped process */
     if ( !mesh->info.noswap ) {
-      nf = MMG5_swpmsh(mesh,met,PROctree,2);
+      nf = MMG5_swpmsh(mesh,met,PROctree,2,mesh->markmin);
       if ( nf < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to improve mesh. Exiting.\n",
                 __func__);
@@ -614,6 +621,9 @@ int MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree) {
       fprintf(stdout,"                                          ");
       fprintf(stdout,"  %8" MMG5_PRId " improved, %8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",nw,nf,nm);
     }
+
+    if ( MMG5_outOfTime(mesh) || MMG5_converged(mesh,nw+nf+nm,mesh->ne) )
+      break;
   }
   while( ++it < maxit && nw+nm+nf > 0 );
 
@@ -626,23 +636,92 @@ int MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree) {
   return 1;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param PROctree pointer to the PROctree structure (rebuilt if needed).
+ * \param permNodGlob array to store the global permutation of nodes (if provided).
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Renumber the mesh if asked by the user and rebuild the PROctree (that stores
+ * point indices).
+ *
+ */
+static
+int MMG3D_renumDelone(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree,
+                      MMG5_int *permNodGlob) {
+
+  if ( !mesh->info.renum ) return 1;
+
+  if ( !MMG5_scotchCall(mesh,met,NULL,permNodGlob) )
+    return 0;
+
+  if ( *PROctree ) {
+    MMG3D_freePROctree(mesh,PROctree);
+    if ( !MMG3D_initPROctree(mesh,PROctree,mesh->info.PROctree) ) {
+      if ( *PROctree ) MMG3D_freePROctree(mesh,PROctree);
+    }
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param ne the elements from 1 to \a ne are sorted.
+ * \param order pointer toward the array of sorted elements (allocated here,
+ * from index 1, NULL if fail).
+ * \return the number of elements stored in \a order (\a ne if fail).
+ *
+ * Sort the used elements along a space-filling curve. Processing them in this
+ * order, two successive insertions are close to each other so the cavities and
+ * the PROctree cells that they visit are likely to be in cache.
+ *
+ * \remark Only the order of the wave changes: the candidate points are not
+ * collected nor filtered against each other in bulk, each of them is still
+ * filtered by the PROctree when its edge is processed. The elements created
+ * during the wave are processed at the next wave.
+ *
+ */
+static
+MMG5_int MMG3D_batchOrder(MMG5_pMesh mesh,MMG5_int ne,MMG5_int **order) {
+  MMG5_int n;
+
+  *order = NULL;
+  MMG5_ADD_MEM(mesh,(ne+1)*sizeof(MMG5_int),"insertion order",return ne);
+  MMG5_SAFE_MALLOC(*order,ne+1,MMG5_int,
+                   mesh->memCur -= (ne+1)*sizeof(MMG5_int);return ne);
+
+  n = MMG3D_sfcSortTetra(mesh,ne,&(*order)[1]);
+  if ( n < 0 ) {
+    MMG5_DEL_MEM(mesh,*order);
+    return ne;
+  }
+  return n;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
  * \param PROctree pointer to the PROctree structure.
  * \param warn set to 1 if we can't insert point due to lack of memory.
+ * \param permNodGlob array to store the global permutation of nodes (if provided).
  * \return -1 if fail and we dont try to end the remesh process,
  * 0 if fail but we try to end the remesh process and 1 if success.
  *
  * Split edges longer than \ref MMG3D_LOPTL_DEL and collapse edges shorter
- * than \ref MMG3D_LOPTS.
+ * than \ref MMG3D_LOPTS. Without scotch, the mesh is renumbered along a
+ * space-filling curve (if asked) each time its number of points has doubled.
  *
  */
 static
-int MMG5_adpdel(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree, int* warn) {
+int MMG5_adpdel(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree, int* warn,
+                MMG5_int *permNodGlob) {
   int        ier;
   int        it,maxit,noptim;
-  MMG5_int   ns,nc,ne,nnm,nm,nnf,nf,nnc,nns,nfilt,ifilt;
+  MMG5_int   ns,nc,ne,nnm,nm,nnf,nf,nnc,nns,nfilt,ifilt,nvis,*order;
+#ifndef USE_SCOTCH
+  MMG5_int   nprenum;
+#endif
   double     maxgap,dd,declic,declicsurf;
 
   /* Iterative mesh modifications */
@@ -652,20 +731,32 @@ int MMG5_adpdel(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree, int* wa
   mesh->gap = maxgap = 0.5;
   declic = 0.5/MMG3D_ALPHAD;
   declicsurf = 1./3.46;
+#ifndef USE_SCOTCH
+  nprenum = mesh->np;
+#endif
 
   do {
+    ne = mesh->ne;
     if ( !mesh->info.noinsert ) {
       *warn=0;
-      ns = nc = 0;
+      ns = nc = nvis = 0;
       ifilt = 0;
-      ne = mesh->ne;
-      ier = MMG5_adpsplcol(mesh,met,PROctree,ne,&ifilt,&ns,&nc,warn);
+      order = NULL;
+      if ( mesh->info.batchins ) {
+        ne = MMG3D_batchOrder(mesh,ne,&order);
+      }
+      ier = MMG5_adpsplcol(mesh,met,PROctree,ne,order,&ifilt,&ns,&nc,&nvis,warn);
+      if ( order ) {
+        MMG5_DEL_MEM(mesh,order);
+      }
       if ( ier<=0 ) return -1;
     } /* End conditional loop on mesh->info.noinsert */
-    else  ns = nc = ifilt = 0;
+    else  ns = nc = ifilt = nvis = 0;
 
     if ( !mesh->info.noswap ) {
-      nf = MMG5_swpmsh(mesh,met,*PROctree,2);
+      /* only the boundary of the region modified by the last waves may have
+       * new swaps */
+      nf = MMG5_swpmsh(mesh,met,*PROctree,2,mesh->mark-2);
       if ( nf < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to improve mesh. Exiting.\n",
           __func__);
@@ -704,6 +795,15 @@ int MMG5_adpdel(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree, int* wa
     nnf += nf;
     nfilt += ifilt;
 
+#ifndef USE_SCOTCH
+    /* space-filling curve renumbering if asked and needed (scotch builds keep
+     * the single renumbering after the insertion loop) */
+    if ( mesh->np > 2*nprenum ) {
+      if ( !MMG3D_renumDelone(mesh,met,PROctree,permNodGlob) ) return -1;
+      nprenum = mesh->np;
+    }
+#endif
+
     /* decrease size of gap for reallocation */
 
     if ( mesh->gap > maxgap/(double)maxit )
@@ -715,6 +815,13 @@ int MMG5_adpdel(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree, int* wa
     if ( (abs(mesh->info.imprim) > 4 || mesh->info.ddebug) && ns+nc+nm+nf > 0)
       fprintf(stdout,"     %8"MMG5_PRId" filtered, %8" MMG5_PRId " splitted, %8" MMG5_PRId " collapsed,"
               " %8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",ifilt,ns,nc,nf,nm);
+    if ( (abs(mesh->info.imprim) > 4 || mesh->info.ddebug) && nvis )
+      fprintf(stdout,"     %8" MMG5_PRId " visited elements (%5.1f %%),"
+              " %8" MMG5_PRId " modifications\n",nvis,
+              100.*(double)nvis/(double)MG_MAX(ne,1),ns+nc+nf+nm);
+
+    /* time budget exhausted: the mesh is valid, skip the remaining waves */
+    if ( MMG5_outOfTime(mesh) )  break;
 
     /*optimization*/
     dd = MMG5_abs(nc-ns);
@@ -723,6 +830,9 @@ int MMG5_adpdel(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree, int* wa
       noptim = 1;
     }
 
+    /* few elements have been modified by this wave */
+    if ( noptim && MMG5_converged(mesh,ns+nc+nf+nm,mesh->ne) )  break;
+
     if( it > 5 ) {
       //  if ( ns < 10 && MMG5_abs(nc-ns) < 3 )  break;
       //else if ( it > 3 && MMG5_abs(nc-ns) < 0.3 * MG_MAX(nc,ns) )  break;
@@ -806,10 +916,13 @@ int MMG5_optetLES(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree) {
       fprintf(stdout,"                                          ");
       fprintf(stdout,"  %8" MMG5_PRId " improved, %8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",nw,nf,nm);
     }
+
+    if ( MMG5_outOfTime(mesh) || MMG5_converged(mesh,nw+nf+nm,mesh->ne) )
+      break;
   }
   while( ++it < maxit && nw+nm+nf > 0 );
 
-  if ( !mesh->info.nomove ) {
+  if ( !mesh->info.nomove && !MMG5_outOfTime(mesh) ) {
     /* move for tria with qual<declicsurf, tetra with qual<declic, internal
      * move allowed, surface degradation forbidden, volume degradation during
        * the surface move authorized and volume degradation during volumic move
@@ -858,9 +971,11 @@ int MMG5_optet(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree) {
   maxit  = 10;
   crit   = MMG3D_SSWAPIMPROVE;
   declic = 0.7/MMG3D_ALPHAD;
-  /* mark reinitialization in order to see at least one time each tetra */
+  /* mark reinitialization in order to see at least one time each tetra (out
+   * of the frozen ones) */
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
+    if ( pt->mark < mesh->markmin ) continue;
     pt->mark = mesh->mark;
   }
 
@@ -875,7 +990,7 @@ int MMG5_optet(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree) {
       nw = 0;
     /* badly shaped process */
     if ( !mesh->info.noswap ) {
-      nf = MMG5_swpmsh(mesh,met,PROctree,2);
+      nf = MMG5_swpmsh(mesh,met,PROctree,2,mesh->markmin);
       if ( nf < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to improve mesh. Exiting.\n",
           __func__);
@@ -914,10 +1029,13 @@ int MMG5_optet(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree) {
     if ( it > 3 ) {
       if ( !nw && (!nm || !nf) )   break;
     }
+
+    if ( MMG5_outOfTime(mesh) || MMG5_converged(mesh,nw+nf+nm,mesh->ne) )
+      break;
   }
   while( ++it < maxit && nw+nm+nf > 0 );
 
-  if ( !mesh->info.nomove ) {
+  if ( !mesh->info.nomove && !MMG5_outOfTime(mesh) ) {
     /* move for tria with qual<1., tetra with qual<1., internal move allowed,
      * surface degradation forbidden, volume degradation during the surface and
      * volume move forbidden. Perform 4 iter max. */
@@ -963,7 +1081,7 @@ int MMG5_adptet_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree,
 
   /** Step 1: few iters of swaps */
   if ( !mesh->info.noswap ) {
-    nnf = MMG5_swpmsh(mesh,met,*PROctree,2);
+    nnf = MMG5_swpmsh(mesh,met,*PROctree,2,mesh->markmin);
     if ( nnf < 0 ) {
       fprintf(stderr,"\n  ## Error: %s: unable to improve mesh. Exiting.\n",
               __func__);
@@ -988,7 +1106,13 @@ int MMG5_adptet_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree,
   /** Step 2: few iters of splits, collapses, swaps and moves */
   warn = 0;
 
-  ns = MMG5_adpdel(mesh,met,PROctree,&warn);
+  ns = MMG5_adpdel(mesh,met,PROctree,&warn,permNodGlob);
+
+  if ( (abs(mesh->info.imprim) > 4 || mesh->info.ddebug) && mesh->delw.nins ) {
+    fprintf(stdout,"     %8zu delaunay insertions, %8zu workspace allocations\n",
+            mesh->delw.nins,mesh->delw.nalloc);
+  }
+  MMG5_freeDeloneWork(mesh);
 
   if ( ns < 0 ) {
     fprintf(stderr,"\n  ## Error: %s: unable to complete mesh. Exit program.\n",
@@ -1006,11 +1130,13 @@ int MMG5_adptet_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree,
   }
 
   /* renumerotation if available */
-  if ( !MMG5_scotchCall(mesh,met,NULL,permNodGlob) )
+  if ( !MMG3D_renumDelone(mesh,met,PROctree,permNodGlob) )
     return 0;
 
   /** Step 3: Last wave of improvements: few iters of bad elts treatment, swaps
-   * and moves */
+   * and moves (skipped if the time budget is exhausted) */
+  if ( MMG5_outOfTime(mesh) )  return 1;
+
   if(mesh->info.optimLES) {
     if(!MMG5_optetLES(mesh,met,*PROctree)) return 0;
   }
@@ -1020,6 +1146,72 @@ int MMG5_adptet_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree,
   return 1;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \return the number of elements to remesh, -1 if fail.
+ *
+ * Warm-start remeshing: compare the sizes realized by the mesh (adapted to the
+ * previous metric) with the new metric. The mean length, in the new metric, of
+ * the edges incident to each vertex is computed and the remeshing is
+ * restricted to the elements having a vertex whose mean length lies out of
+ * [\ref MMG3D_LOPTS, \ref MMG3D_LOPTL], plus one layer of elements around
+ * them. The mean length is used rather than the length of each edge because
+ * a converged adaptation still leaves a few percent of edges slightly out of
+ * bounds, which would spread the region to almost the whole mesh.
+ *
+ */
+static
+MMG5_int MMG3D_updateRegion(MMG5_pMesh mesh,MMG5_pSol met) {
+  MMG5_pTetra   pt;
+  double        len,*lsum;
+  MMG5_int      k,ip,nseed,*nedg;
+  int           i,j;
+
+  MMG5_ADD_MEM(mesh,(mesh->np+1)*(sizeof(double)+sizeof(MMG5_int)),
+               "mean edge lengths",return -1);
+  MMG5_SAFE_CALLOC(lsum,mesh->np+1,double,return -1);
+  MMG5_SAFE_CALLOC(nedg,mesh->np+1,MMG5_int,MMG5_DEL_MEM(mesh,lsum);return -1);
+
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+    for (i=0; i<6; i++) {
+      len = MMG5_lenedg(mesh,met,i,pt);
+      for (j=0; j<2; j++) {
+        ip = pt->v[MMG5_iare[i][j]];
+        lsum[ip] += len;
+        ++nedg[ip];
+      }
+    }
+  }
+  for (k=1; k<=mesh->np; k++) {
+    if ( nedg[k] ) lsum[k] /= nedg[k];
+  }
+
+  nseed = 0;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    pt->flag = 0;
+    if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
+
+    for (i=0; i<4; i++) {
+      len = lsum[pt->v[i]];
+      if ( len < MMG3D_LOPTS || len > MMG3D_LOPTL ) {
+        pt->flag = 1;
+        ++nseed;
+        break;
+      }
+    }
+  }
+  MMG5_DEL_MEM(mesh,lsum);
+  MMG5_DEL_MEM(mesh,nedg);
+
+  if ( !nseed ) return 0;
+
+  return MMG3D_setActiveRegion(mesh,1);
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -1031,6 +1223,7 @@ int MMG5_adptet_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_pPROctree *PROctree,
  */
 int MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
   MMG3D_pPROctree PROctree = NULL;
+  MMG5_int        nact;
 
   if ( abs(mesh->info.imprim) > 4 )
     fprintf(stdout,"  ** MESH ANALYSIS\n");
@@ -1044,7 +1237,9 @@ int MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
   if ( abs(mesh->info.imprim) > 4 || mesh->info.ddebug )
     fprintf(stdout,"  ** GEOMETRIC MESH\n");
 
-  if ( !MMG5_anatet(mesh,met,1,0) ) {
+  /* the geometric approximation of a mesh given for a warm start has been
+   * done by the previous run */
+  if ( !mesh->info.update && !MMG5_anatet(mesh,met,1,0) ) {
     fprintf(stderr,"\n  ## Unable to split mesh. Exiting.\n");
     return 0;
   }
@@ -1099,7 +1294,20 @@ int MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
   /*update quality*/
   if ( !MMG3D_tetraQual(mesh,met,1) ) return 0;
 
-  if ( !MMG5_anatet(mesh,met,2,0) ) {
+  if ( mesh->info.update ) {
+    /* warm start: remesh only the elements not adapted to the new metric */
+    nact = MMG3D_updateRegion(mesh,met);
+    if ( nact < 0 ) {
+      fprintf(stderr,"\n  ## Unable to compute the area to remesh. Exiting.\n");
+      return 0;
+    }
+    if ( abs(mesh->info.imprim) > 3 || mesh->info.ddebug ) {
+      fprintf(stdout,"     %8" MMG5_PRId " active elements (%5.1f %%)\n",
+              nact,100.*nact/MG_MAX(1,mesh->ne));
+    }
+    if ( !nact ) return 1;
+  }
+  else if ( !MMG5_anatet(mesh,met,2,0) ) {
     fprintf(stderr,"\n  ## Unable to split mesh. Exiting.\n");
     return 0;
   }
@@ -60,7 +60,7 @@ static MMG5_int MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
  int           ier,ilist;
  int8_t        imax,j,i,i1,i2;
  int8_t        chkRidTet;
- static int8_t mmgWarn    = 0;
+ static MMG5_THREADLOCAL int8_t mmgWarn    = 0;
 
   *warn=0;
   ns = 0;
@@ -196,7 +196,7 @@ static MMG5_int MMG5_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_int      k,nc;
   int           ier;
   int8_t        imin,i;
-  static int8_t mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn = 0;
 
   nc = 0;
   for (k=1; k<=mesh->ne; k++) {
@@ -299,7 +299,7 @@ static int MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
     else  nm = 0;
 
     if ( !mesh->info.noswap ) {
-      nf = MMG5_swpmsh(mesh,met,NULL,2);
+      nf = MMG5_swpmsh(mesh,met,NULL,2,-1);
       if ( nf < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to improve mesh."
                 " Exiting.\n",__func__);
@@ -325,6 +325,10 @@ static int MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
       fprintf(stdout,"     %8" MMG5_PRId " splitted, %8" MMG5_PRId " collapsed, %8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",ns,nc,nf,nm);
     if ( ns < 10 && MMG5_abs(nc-ns) < 3 )  break;
     else if ( it > 3 && MMG5_abs(nc-ns) < 0.3 * MG_MAX(nc,ns) )  break;
+
+    /* time budget exhausted or few modified elements */
+    if ( MMG5_outOfTime(mesh) || MMG5_converged(mesh,ns+nc+nf+nm,mesh->ne) )
+      break;
   }
   while( ++it < maxit && nc+ns > 0 );
 
@@ -347,6 +351,9 @@ static int MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
   it  = 0;
   maxit = 2;
   do {
+    /* time budget exhausted: the mesh is valid, skip the remaining waves */
+    if ( MMG5_outOfTime(mesh) )  break;
+
 /*     /\* treatment of bad elements*\/ */
 /*     if( 0 && it < 2) { */
 /*       nw = MMG3D_opttyp(mesh,met,NULL); */
@@ -366,7 +373,7 @@ static int MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
     else  nm = 0;
 
     if ( !mesh->info.noswap ) {
-      nf = MMG5_swpmsh(mesh,met,NULL,2);
+      nf = MMG5_swpmsh(mesh,met,NULL,2,-1);
       if ( nf < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to improve mesh."
                 " Exiting.\n",__func__);
@@ -387,10 +394,12 @@ static int MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *permNodGlob) {
       fprintf(stdout,"                                            ");
       fprintf(stdout,"%8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",nf,nm);
     }
+
+    if ( MMG5_converged(mesh,/*nw+*/nf+nm,mesh->ne) )  break;
   }
   while( ++it < maxit && /*nw+*/nm+nf > 0 );
 
-  if ( !mesh->info.nomove ) {
+  if ( !mesh->info.nomove && !MMG5_outOfTime(mesh) ) {
     nm = MMG5_movtet(mesh,met,NULL,MMG3D_MAXKAL,MMG3D_MAXKAL,1,1,1,1,3,mesh->mark-2);
     if ( nm < 0 ) {
       fprintf(stderr,"\n  ## Error: %s: unable to improve mesh.\n",
@@ -410,7 +410,7 @@ int MMG3D_ismaniball(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int k,int indp) {
   int           ibdy,ilist,cur,l;
   MMG5_int      *adja,list[MMG3D_LMAX+1],bdy[MMG3D_LMAX+1],jel,np,iel,res,base;
   int8_t        i,i0,i1,i2,j0,j1,j2,j,ip,nzeros,nopp,nsame;
-  static int8_t mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0;
 
   pt = &mesh->tetra[k];
   np = pt->v[indp];
@@ -1032,7 +1032,7 @@ int MMG3D_cuttet_ls(MMG5_pMesh mesh, MMG5_pSol sol,MMG5_pSol met){
   int           ier;
   MMG5_int      vx[6],k,ip0,ip1,np,nb,ns,ne,src,refext,refint;
   int8_t        ia,j,npneg;
-  static int8_t mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn = 0;
 
   /* reset point flags and h */
   for (k=1; k<=mesh->np; k++)
@@ -1530,7 +1530,7 @@ int MMG3D_chkmani(MMG5_pMesh mesh){
   MMG5_int      ref;
   MMG5_int      iel,k,*adja;
   int8_t        i,j,ip,cnt;
-  static int8_t mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0 = 0;
 
   for(k=1; k<=mesh->np; k++){
     mesh->point[k].flag = 0;
@@ -2223,16 +2223,16 @@ int MMG3D_mmg3d2(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol met) {
   if ( mesh->info.isosurf ) {
     strcat(str,"(BOUNDARY PART)");
 
-    MMG3D_snpval   = MMG3D_snpval_lssurf;
-    MMG3D_resetRef = MMG3D_resetRef_lssurf;
-    MMG3D_cuttet   = MMG3D_cuttet_lssurf;
-    MMG3D_setref   = MMG3D_setref_lssurf;
+    mesh->ops->snpval     = MMG3D_snpval_lssurf;
+    mesh->ops->resetRef   = MMG3D_resetRef_lssurf;
+    mesh->ops->cuttet     = MMG3D_cuttet_lssurf;
+    mesh->ops->setref     = MMG3D_setref_lssurf;
   }
   else {
-    MMG3D_snpval   = MMG3D_snpval_ls;
-    MMG3D_resetRef = MMG3D_resetRef_ls;
-    MMG3D_cuttet   = MMG3D_cuttet_ls;
-    MMG3D_setref   = MMG3D_setref_ls;
+    mesh->ops->snpval     = MMG3D_snpval_ls;
+    mesh->ops->resetRef   = MMG3D_resetRef_ls;
+    mesh->ops->cuttet     = MMG3D_cuttet_ls;
+    mesh->ops->setref     = MMG3D_setref_ls;
   }
 
   if ( abs(mesh->info.imprim) > 3 )
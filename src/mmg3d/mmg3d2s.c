@@ -165,7 +165,7 @@ int MMG3D_cuttet_lssurf(MMG5_pMesh mesh, MMG5_pSol sol,MMG5_pSol met){
   double        c[3],v0,v1,s;
   MMG5_int      vx[6],nb,k,ip0,ip1,np,ns,ne,ier,src,refext,refint;
   int8_t        ia,iface,j,npneg;
-  static int8_t mmgWarn = 0;
+  static MMG5_THREADLOCAL int8_t mmgWarn = 0;
 
   /* Reset point flags */
   for (k=1; k<=mesh->np; k++)
@@ -111,7 +111,7 @@ static MMG5_int MMG5_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itd
   MMG5_int       src,ns,k,ip,ip1,ip2,iadr;
   int64_t        list[MMG3D_LMAX+2];
   int8_t         imax,i,i1,i2;
-  static int8_t  mmgWarn0 = 0;
+  static MMG5_THREADLOCAL int8_t  mmgWarn0 = 0;
 
   *warn=0;
   ns = 0;
@@ -1,11 +1,21 @@
+#include "libmmg3d.h"
 #include "libmmg3d_private.h"
 #include "mmg3d_export.h"
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Compute the size map with the function of the operators table of the mesh
+ * (the table is filled if \ref MMG3D_setfunc has not been called).
+ *
+ */
+static int MMG3D_doSol_mesh(MMG5_pMesh mesh,MMG5_pSol met) {
+  if ( !mesh->ops->doSol ) MMG3D_setfunc(mesh,met);
+  return mesh->ops->doSol(mesh,met);
+}
 
-#define MMG_EXTERN
-#define MMG_ASSIGN_NULL =NULL
-
-#include  "mmg3dexterns_private.h"
-
-LIBMMG3D_EXPORT double (*MMG3D_lenedgCoor)(double *ca,double *cb,double *sa,double *sb)=NULL;
-LIBMMG3D_EXPORT int    (*MMG3D_doSol)(MMG5_pMesh mesh,MMG5_pSol met)=NULL;
+/* Legacy pointers: they are set once here and never modified by the library */
+LIBMMG3D_EXPORT double (*MMG3D_lenedgCoor)(double *ca,double *cb,double *sa,double *sb)=MMG5_lenedgCoor_iso;
+LIBMMG3D_EXPORT int    (*MMG3D_doSol)(MMG5_pMesh mesh,MMG5_pSol met)=MMG3D_doSol_mesh;
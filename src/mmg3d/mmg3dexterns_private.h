@@ -5,33 +5,29 @@
 #include "PRoctree_3d_private.h"
 #include "mmgcommon_private.h"
 
-#ifndef MMG_EXTERN
-#define MMG_EXTERN extern
-#define MMG_ASSIGN_NULL
-#endif
-
-FUNCTION_POINTER ( double (*MMG5_lenedg)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra ) );
-FUNCTION_POINTER ( double (*MMG5_lenedgspl)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra ) );
-FUNCTION_POINTER ( double (*MMG5_caltet)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt) );
-FUNCTION_POINTER ( double (*MMG5_caltri)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt) );
-FUNCTION_POINTER ( int    (*MMG3D_defsiz)(MMG5_pMesh ,MMG5_pSol ) );
-FUNCTION_POINTER ( int    (*MMG3D_gradsiz)(MMG5_pMesh ,MMG5_pSol ) );
-FUNCTION_POINTER ( int    (*MMG3D_gradsizreq)(MMG5_pMesh ,MMG5_pSol ) );
-FUNCTION_POINTER ( int    (*MMG5_intmet)(MMG5_pMesh,MMG5_pSol,MMG5_int,int8_t,MMG5_int, double) );
-FUNCTION_POINTER ( int    (*MMG5_interp4bar)(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int,double *) );
-FUNCTION_POINTER ( int    (*MMG5_movintpt)(MMG5_pMesh ,MMG5_pSol, MMG3D_pPROctree ,int64_t *, int , int ) );
-FUNCTION_POINTER ( int    (*MMG5_movbdyregpt)(MMG5_pMesh, MMG5_pSol, MMG3D_pPROctree ,int64_t*, int, MMG5_int*, int, int ,int) );
-FUNCTION_POINTER ( int    (*MMG5_movbdyrefpt)(MMG5_pMesh, MMG5_pSol, MMG3D_pPROctree ,int64_t*, int, MMG5_int*, int ,int) );
-FUNCTION_POINTER ( int    (*MMG5_movbdynompt)(MMG5_pMesh, MMG5_pSol, MMG3D_pPROctree ,int64_t*, int, MMG5_int*, int ,int) );
-FUNCTION_POINTER ( int    (*MMG5_movbdyridpt)(MMG5_pMesh, MMG5_pSol, MMG3D_pPROctree ,int64_t*, int, MMG5_int*, int ,int) );
-FUNCTION_POINTER ( int    (*MMG5_cavity)(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,int ,int64_t *,int ,double) );
-FUNCTION_POINTER ( int    (*MMG3D_PROctreein)(MMG5_pMesh ,MMG5_pSol ,MMG3D_pPROctree ,MMG5_int,double ) );
-FUNCTION_POINTER ( int    (*MMG3D_resetRef)(MMG5_pMesh) );
-FUNCTION_POINTER ( int    (*MMG3D_setref)(MMG5_pMesh,MMG5_pSol) );
-FUNCTION_POINTER ( int    (*MMG3D_snpval)(MMG5_pMesh,MMG5_pSol) );
-FUNCTION_POINTER ( int    (*MMG3D_cuttet)(MMG5_pMesh,MMG5_pSol,MMG5_pSol) );
-
-#undef MMG_EXTERN
-#undef MMG_ASSIGN_NULL
+/**
+ * Operators of the \ref MMG5_Ops table of the mesh that are specific to mmg3d
+ * (filled by MMG3D_setfunc and MMG3D_mmg3d2).
+ */
+#define MMG5_lenedg(mesh,...)        (mesh)->ops->lenedg(mesh,__VA_ARGS__)
+#define MMG5_lenedgspl(mesh,...)     (mesh)->ops->lenedgspl(mesh,__VA_ARGS__)
+#define MMG5_caltet(mesh,...)        (mesh)->ops->caltet(mesh,__VA_ARGS__)
+#define MMG5_caltri(mesh,...)        (mesh)->ops->caltri(mesh,__VA_ARGS__)
+#define MMG3D_defsiz(mesh,...)       (mesh)->ops->defsiz(mesh,__VA_ARGS__)
+#define MMG3D_gradsiz(mesh,...)      (mesh)->ops->gradsiz(mesh,__VA_ARGS__)
+#define MMG3D_gradsizreq(mesh,...)   (mesh)->ops->gradsizreq(mesh,__VA_ARGS__)
+#define MMG5_intmet(mesh,...)        (mesh)->ops->intmet(mesh,__VA_ARGS__)
+#define MMG5_interp4bar(mesh,...)    (mesh)->ops->interp4bar(mesh,__VA_ARGS__)
+#define MMG5_movintpt(mesh,...)      (mesh)->ops->movintpt(mesh,__VA_ARGS__)
+#define MMG5_movbdyregpt(mesh,...)   (mesh)->ops->movbdyregpt(mesh,__VA_ARGS__)
+#define MMG5_movbdyrefpt(mesh,...)   (mesh)->ops->movbdyrefpt(mesh,__VA_ARGS__)
+#define MMG5_movbdynompt(mesh,...)   (mesh)->ops->movbdynompt(mesh,__VA_ARGS__)
+#define MMG5_movbdyridpt(mesh,...)   (mesh)->ops->movbdyridpt(mesh,__VA_ARGS__)
+#define MMG5_cavity(mesh,...)        (mesh)->ops->cavity(mesh,__VA_ARGS__)
+#define MMG3D_PROctreein(mesh,...)   (mesh)->ops->PROctreein(mesh,__VA_ARGS__)
+#define MMG3D_resetRef(mesh)         (mesh)->ops->resetRef(mesh)
+#define MMG3D_setref(mesh,...)       (mesh)->ops->setref(mesh,__VA_ARGS__)
+#define MMG3D_snpval(mesh,...)       (mesh)->ops->snpval(mesh,__VA_ARGS__)
+#define MMG3D_cuttet(mesh,...)       (mesh)->ops->cuttet(mesh,__VA_ARGS__)
 
 #endif
@@ -160,6 +160,112 @@ int MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, MMG3D_pPROctree PROctree,
   return 1;
 }
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param list pointer to the volumic ball of the point.
+ * \param ilist size of the volumic ball.
+ * \param improve force the new minimum element quality to be greater or equal
+ * than 1.02 of the old minimum element quality.
+ *
+ * \return 0 if we can't move the point, 1 if we can.
+ *
+ * Move internal point whose volumic ball is passed, as \ref MMG5_movintpt_iso
+ * does, but without using the point and tetra 0 as work storage and without
+ * updating the PROctree. Concurrent calls are thread-safe as long as the moved
+ * points don't belong to a same tetra.
+ *
+ * \remark the metric is not interpolated at the new position.
+ * \remark we don't check if we break the hausdorff criterion.
+ * \remark the edge length criterion (\a improve=2) is not available.
+ *
+ */
+int MMG3D_movintpt_iso_par(MMG5_pMesh mesh,MMG5_pSol met,
+                           int64_t *list,int ilist,int improve) {
+  MMG5_pTetra          pt;
+  MMG5_pPoint          p0,p1,p2,p3;
+  double               vol,totvol,c[3],*cv[4];
+  double               calold,calnew,callist[MMG3D_LMAX+2];
+  int                  k,j,i0;
+  MMG5_int             iel;
+
+  (void)met;
+  assert ( improve < 2 );
+
+  /* Coordinates of optimal point */
+  c[0] = c[1] = c[2] = 0.0;
+  calold = DBL_MAX;
+  totvol = 0.0;
+  for (k=0; k<ilist; k++) {
+    iel = list[k] / 4;
+    pt = &mesh->tetra[iel];
+    p0 = &mesh->point[pt->v[0]];
+    p1 = &mesh->point[pt->v[1]];
+    p2 = &mesh->point[pt->v[2]];
+    p3 = &mesh->point[pt->v[3]];
+    vol= MMG5_det4pt(p0->c,p1->c,p2->c,p3->c);
+    totvol += vol;
+    /* barycenter */
+    c[0] += 0.25 * vol*(p0->c[0] + p1->c[0] + p2->c[0] + p3->c[0]);
+    c[1] += 0.25 * vol*(p0->c[1] + p1->c[1] + p2->c[1] + p3->c[1]);
+    c[2] += 0.25 * vol*(p0->c[2] + p1->c[2] + p2->c[2] + p3->c[2]);
+    calold = MG_MIN(calold, pt->qual);
+  }
+  if (totvol < MMG5_EPSD2) {
+    return 0;
+  }
+
+  totvol = 1.0 / totvol;
+  c[0] *= totvol;
+  c[1] *= totvol;
+  c[2] *= totvol;
+
+  /* Check new position validity */
+  calnew = DBL_MAX;
+  i0 = -1;
+  pt = NULL;
+  assert ( ilist>0 );
+  for (k=0; k<ilist; k++) {
+    iel = list[k] / 4;
+    i0  = list[k] % 4;
+    pt  = &mesh->tetra[iel];
+    for (j=0; j<4; j++) {
+      cv[j] = mesh->point[pt->v[j]].c;
+    }
+    cv[i0] = c;
+    callist[k] = MMG5_caltet_iso_4pt(cv[0],cv[1],cv[2],cv[3]);
+    if (callist[k] < MMG5_NULKAL) {
+      return 0;
+    }
+    calnew = MG_MIN(calnew,callist[k]);
+  }
+  if (calold < MMG5_EPSOK && calnew <= calold) {
+    return 0;
+  }
+  else if (calnew < MMG5_EPSOK) {
+    return 0;
+  }
+  else if ( improve && calnew < 1.02 * calold ) {
+    return 0;
+  }
+  else if ( calnew < 0.3 * calold ) {
+    return 0;
+  }
+
+  /* update position */
+  assert ( i0 >=0 && pt );
+  p0 = &mesh->point[pt->v[i0]];
+  p0->c[0] = c[0];
+  p0->c[1] = c[1];
+  p0->c[2] = c[2];
+  for (k=0; k<ilist; k++) {
+    (&mesh->tetra[list[k]/4])->qual=callist[k];
+    (&mesh->tetra[list[k]/4])->mark=mesh->mark;
+  }
+
+  return 1;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -492,7 +598,7 @@ int MMG3D_movbdyregpt_geom(MMG5_pMesh mesh,MMG5_int *lists,const MMG5_int kel,
   double            uv[2],to[3],detloc;
   int               iel,na,nb,ntempb,ntempc,nxp;
   uint8_t           iface,i;
-  static int8_t     mmgErr0=0,mmgErr1=0;
+  static MMG5_THREADLOCAL int8_t     mmgErr0=0,mmgErr1=0;
 
   iel    = lists[kel] / 4;
   iface  = lists[kel] % 4;
@@ -458,6 +458,55 @@ int MMG3D_splitalmostall(MMG5_pMesh mesh,  MMG5_pSol met,MMG3D_pPROctree PROctre
   return ier;
 }
 
+/** Entry of the worklist of bad elements (element index and quality key) */
+typedef struct {
+  double   qual;
+  MMG5_int k;
+} MMG3D_BadTet;
+
+/**
+ * \param a pointer to the first worklist entry.
+ * \param b pointer to the second worklist entry.
+ * \return -1, 0 or 1 following the quality order (worst element first).
+ *
+ * Comparison of two worklist entries: ties are broken on the element index so
+ * the processing order does not depend on the qsort implementation.
+ *
+ */
+static int MMG3D_cmpBadTet(const void *a,const void *b) {
+  const MMG3D_BadTet *ba = (const MMG3D_BadTet*)a;
+  const MMG3D_BadTet *bb = (const MMG3D_BadTet*)b;
+
+  if ( ba->qual < bb->qual ) return -1;
+  if ( ba->qual > bb->qual ) return  1;
+  return (ba->k > bb->k) - (ba->k < bb->k);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param list pointer to the worklist of bad elements.
+ * \param lmax pointer to the worklist capacity.
+ * \param nl number of entries that the worklist must store.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Ensure that the worklist of bad elements can store \a nl entries.
+ *
+ */
+static int MMG3D_badTetList(MMG5_pMesh mesh,MMG3D_BadTet **list,
+                            MMG5_int *lmax,MMG5_int nl) {
+
+  if ( nl <= *lmax ) return 1;
+
+  if ( *list ) MMG5_DEL_MEM(mesh,*list);
+  *lmax = 0;
+
+  MMG5_ADD_MEM(mesh,nl*sizeof(MMG3D_BadTet),"bad elements list",return 0);
+  MMG5_SAFE_MALLOC(*list,nl,MMG3D_BadTet,return 0);
+  *lmax = nl;
+
+  return 1;
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -468,13 +517,21 @@ int MMG3D_splitalmostall(MMG5_pMesh mesh,  MMG5_pSol met,MMG3D_pPROctree PROctre
  * Travel across the mesh to detect element with very bad quality (less than
  * 0.2) and try to improve them by every means.
  *
+ * The bad elements are stored in a worklist sorted by quality and treated
+ * worst first. Each pass stamps the elements modified by the local operators
+ * with a new mark so the next pass only revisits the bad elements created or
+ * modified by the previous one (elements whose neighbourhood did not change
+ * would fail again). The element marks and \a mesh->mark are restored on exit
+ * so the callers still see the modified elements with the current mark.
+ *
  */
 MMG5_int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree,MMG5_int testmark) {
   MMG5_pTetra    pt;
   MMG5_pxTetra   pxt;
+  MMG3D_BadTet   *list;
   double         crit;
   int            ityp,item[2];
-  MMG5_int       k,ntot,ne,nd,cs[10],ds[10];
+  MMG5_int       k,kk,ntot,ne,nd,cs[10],ds[10],nl,lmax,mark0;
   int            ier,i,npeau;
   int            it,maxit;
 //  double         OCRIT = 1.01;
@@ -483,6 +540,9 @@ MMG5_int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree,MM
   ntot = 0;
   crit = 0.2 / MMG3D_ALPHAD;
   base = testmark;
+  mark0 = mesh->mark;
+  list  = NULL;
+  lmax  = 0;
 
   it = 0;
   maxit = 10;
@@ -493,11 +553,42 @@ MMG5_int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree,MM
     memset(cs,0,10*sizeof(MMG5_int));
     memset(ds,0,10*sizeof(MMG5_int));
 
+    /* worklist of the bad elements of this pass */
+    nl = 0;
     for (k=1 ; k<=ne ; k++) {
       pt = &mesh->tetra[k];
       if(!MG_EOK(pt)  || (pt->tag & MG_REQ) ) continue;
       else if ( pt->mark < base )  continue;
+      if(pt->qual > crit) continue;
+      nl++;
+    }
+    if ( !nl ) break;
+
+    if ( !MMG3D_badTetList(mesh,&list,&lmax,nl) ) {
+      fprintf(stderr,"  Exit optimization of bad elements.\n");
+      break;
+    }
+
+    nl = 0;
+    for (k=1 ; k<=ne ; k++) {
+      pt = &mesh->tetra[k];
+      if(!MG_EOK(pt)  || (pt->tag & MG_REQ) ) continue;
+      else if ( pt->mark < base )  continue;
+      if(pt->qual > crit) continue;
+      list[nl].qual = pt->qual;
+      list[nl].k    = k;
+      nl++;
+    }
+    qsort(list,nl,sizeof(MMG3D_BadTet),MMG3D_cmpBadTet);
+
+    /* elements modified during this pass receive a new mark */
+    base = ++mesh->mark;
 
+    for (kk=0 ; kk<nl ; kk++) {
+      k  = list[kk].k;
+      pt = &mesh->tetra[k];
+      /* element deleted or already improved by a previous operation */
+      if(!MG_EOK(pt)  || (pt->tag & MG_REQ) ) continue;
       if(pt->qual > crit) continue;
 
       ityp = MMG3D_typelt(mesh,k,item);
@@ -609,7 +700,7 @@ MMG5_int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree,MM
         }
         break;
       } /* end switch */
-    } /* end for k */
+    } /* end for kk */
 
     /* printf("bdry : %" MMG5_PRId " %" MMG5_PRId "\n",nbdy,nbdy2); */
     /*  for (k=0; k<=7; k++) */
@@ -617,8 +708,18 @@ MMG5_int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,MMG3D_pPROctree PROctree,MM
     /*    printf("  optim [%" MMG5_PRId "]      = %5d   %5d  %6.2f %%\n",k,cs[k],ds[k],100.0*ds[k]/cs[k]); */
 
     ntot += nd;
-    if(base==-1) base = mesh->mark-1;
   } while (nd && it++<maxit);
 
+  if ( list ) MMG5_DEL_MEM(mesh,list);
+
+  /* restore the marks seen by the callers */
+  if ( mesh->mark != mark0 ) {
+    for (k=1 ; k<=mesh->ne ; k++) {
+      pt = &mesh->tetra[k];
+      if ( pt->mark > mark0 ) pt->mark = mark0;
+    }
+    mesh->mark = mark0;
+  }
+
   return ntot;
 }
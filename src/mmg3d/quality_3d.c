@@ -38,29 +38,147 @@
 
 extern int8_t ddb;
 
+/**
+ * \struct MMG3D_QualStats
+ * \brief Quality statistics over a range of tetra (see \ref MMG3D_qualStats).
+ */
+typedef struct {
+  double   min,max,avg; /*!< worst, best and summed qualities */
+  MMG5_int iel; /*!< index of the worst tetra among the used tetra of the range */
+  MMG5_int ok,nex; /*!< numbers of used and unused tetra */
+  MMG5_int good,med,nrid,his[5];
+  int8_t   neg; /*!< 1 if a tetra with negative volume has been found */
+  int8_t   badkal; /*!< 1 if a very bad tetra has been found */
+} MMG3D_QualStats;
+
+/**
+ * \struct MMG3D_LenStats
+ * \brief Edge length statistics over a range of tetra (see \ref
+ * MMG3D_computePrilen).
+ */
+typedef struct {
+  double   avlen,lmin,lmax;
+  MMG5_int ned,amin,bmin,amax,bmax,nullEdge,hl[9];
+} MMG3D_LenStats;
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param st pointer to the array of chunk statistics (to allocate).
+ * \return the number of chunks.
+ *
+ * Allocate the statistics of the chunks of a parallel sweep over the
+ * tetra. If there is only one chunk (or if the allocation fails), nothing is
+ * allocated and the sweep has to be done sequentially.
+ *
+ */
+static inline
+int MMG3D_allocQualChunks(MMG5_pMesh mesh,MMG3D_QualStats **st) {
+  int nc;
+
+  *st = NULL;
+  nc  = MMG5_nthreads(mesh,mesh->ne);
+  if ( nc == 1 ) return 1;
+
+  MMG5_ADD_MEM(mesh,nc*sizeof(MMG3D_QualStats),"quality chunks",return 1);
+  MMG5_SAFE_CALLOC(*st,nc,MMG3D_QualStats,
+                   mesh->memCur -= nc*sizeof(MMG3D_QualStats);return 1);
+
+  return nc;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure (may be NULL).
+ * \return a compact copy of the point coordinates and isotropic sizes, NULL if
+ * it can't be allocated.
+ *
+ * Build the compact copy of the points read by the isotropic quality and length
+ * sweeps (\ref MMG3D_caltet_iso_hot and \ref MMG3D_lenedg_iso_hot). The copy
+ * is valid as long as the coordinates and sizes of the points are not
+ * modified and no point is created. If the allocation fails, the caller has to
+ * fall back on the point and metric arrays.
+ *
+ */
+MMG3D_pHotPoint MMG3D_hotPoints(MMG5_pMesh mesh,MMG5_pSol met) {
+  MMG3D_pHotPoint hp;
+  double          *m;
+  int             nc;
+
+  MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(MMG3D_HotPoint),"hot points",
+               return NULL);
+  MMG5_SAFE_MALLOC(hp,mesh->np+1,MMG3D_HotPoint,
+                   mesh->memCur -= (mesh->np+1)*sizeof(MMG3D_HotPoint);
+                   return NULL);
+
+  m  = ( met && met->m && met->size == 1 ) ? met->m : NULL;
+  nc = MMG5_nthreads(mesh,mesh->np);
+
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(nc) if(nc>1)
+#endif
+  {
+    MMG5_int kmin,kmax,k;
+    int      ic;
+
+    for ( ic=MMG5_THREAD_NUM(); ic<nc; ic+=MMG5_NUM_THREADS() ) {
+      MMG5_CHUNK_RANGE(mesh->np,ic,nc,kmin,kmax);
+      for ( k=kmin; k<=kmax; ++k ) {
+        hp[k].c[0] = mesh->point[k].c[0];
+        hp[k].c[1] = mesh->point[k].c[1];
+        hp[k].c[2] = mesh->point[k].c[2];
+        hp[k].h    = m ? m[k] : 0.;
+      }
+    }
+  }
+
+  return hp;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param hp pointer to the compact copy of the points (set to NULL).
+ *
+ * Free the compact copy of the points built by \ref MMG3D_hotPoints.
+ *
+ */
+void MMG3D_freeHotPoints(MMG5_pMesh mesh,MMG3D_pHotPoint *hp) {
+
+  if ( !*hp ) return;
+
+  MMG5_DEL_MEM(mesh,*hp);
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the meric structure.
  * \param metRidTyp metric storage (classic or special)
- * \return 1 if success, 0 if fail.
+ * \param hp compact copy of the points if the quality is isotropic (may be
+ * NULL).
+ * \param kmin first tetra to treat.
+ * \param kmax last tetra to treat.
+ * \param minqual minimal quality over the range (to fill).
+ * \param iel index of the worst tetra (to fill).
  *
- * Compute the quality of the tetras over the mesh.
+ * Compute the quality of the tetras \a kmin to \a kmax.
  *
  */
-int MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,int8_t metRidTyp) {
+static inline
+void MMG3D_tetraQual_range(MMG5_pMesh mesh, MMG5_pSol met,int8_t metRidTyp,
+                           MMG3D_pHotPoint hp,MMG5_int kmin,MMG5_int kmax,double *minqual,MMG5_int *iel) {
   MMG5_pTetra pt;
-  double      minqual;
-  MMG5_int    k,iel;
-
-  minqual = 2./MMG3D_ALPHAD;
+  MMG5_int    k;
 
   /* compute tet quality */
-  iel = 1;
-  for (k=1; k<=mesh->ne; k++) {
+  *minqual = 2./MMG3D_ALPHAD;
+  *iel     = 1;
+  for (k=kmin; k<=kmax; k++) {
     pt = &mesh->tetra[k];
     if( !MG_EOK(pt) )   continue;
 
-    if ( !metRidTyp && met->size == 6 && met->m ) {
+    if ( hp ) {
+      pt->qual = MMG3D_caltet_iso_hot(hp,pt);
+    }
+    else if ( !metRidTyp && met->size == 6 && met->m ) {
       pt->qual = MMG5_caltet33_ani(mesh,met,pt);
     }
     else if ( !(met && met->m) ) {
@@ -83,11 +201,69 @@ int MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,int8_t metRidTyp) {
     }
 
     /* Check quality on suitable elements */
-    if ( i < 4 && pt->qual < minqual ) {
-      minqual = pt->qual;
-      iel     = k;
+    if ( i < 4 && pt->qual < *minqual ) {
+      *minqual = pt->qual;
+      *iel     = k;
     }
   }
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the meric structure.
+ * \param metRidTyp metric storage (classic or special)
+ * \return 1 if success, 0 if fail.
+ *
+ * Compute the quality of the tetras over the mesh. The mesh is split into
+ * ordered chunks treated in parallel and merged in order, so the result does
+ * not depend on the number of threads.
+ *
+ */
+int MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,int8_t metRidTyp) {
+  MMG3D_QualStats *st;
+  MMG3D_pHotPoint hp;
+  double          minqual;
+  MMG5_int        iel;
+  int             nc,c;
+
+  /* Isotropic quality: read the coordinates from a compact copy of the
+   * points */
+  hp = NULL;
+  if ( !(met && met->m && (mesh->info.ani || met->size != 1 || mesh->info.optimLES)) ) {
+    hp = MMG3D_hotPoints(mesh,met);
+  }
+
+  nc = MMG3D_allocQualChunks(mesh,&st);
+
+  if ( nc == 1 ) {
+    MMG3D_tetraQual_range(mesh,met,metRidTyp,hp,1,mesh->ne,&minqual,&iel);
+  }
+  else {
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(nc)
+#endif
+    {
+      MMG5_int kmin,kmax;
+      int      ic;
+
+      for ( ic=MMG5_THREAD_NUM(); ic<nc; ic+=MMG5_NUM_THREADS() ) {
+        MMG5_CHUNK_RANGE(mesh->ne,ic,nc,kmin,kmax);
+        MMG3D_tetraQual_range(mesh,met,metRidTyp,hp,kmin,kmax,&st[ic].min,&st[ic].iel);
+      }
+    }
+
+    /* Merge chunks in order */
+    minqual = st[0].min;
+    iel     = st[0].iel;
+    for ( c=1; c<nc; ++c ) {
+      if ( st[c].min < minqual ) {
+        minqual = st[c].min;
+        iel     = st[c].iel;
+      }
+    }
+    MMG5_DEL_MEM(mesh,st);
+  }
+  MMG3D_freeHotPoints(mesh,&hp);
 
   /* Here the quality is not normalized by alpha, thus we need to
    * normalized it */
@@ -197,6 +373,100 @@ inline double MMG5_caltet33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt) {
 }
 
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param metRidTyp metric storage (classic or special)
+ * \param own for each tetra, flags of the edges whose length is computed from
+ * this tetra.
+ * \param hp compact copy of the points if the lengths are isotropic (may be
+ * NULL).
+ * \param bd bounds of the length histogram.
+ * \param kmin first tetra to treat.
+ * \param kmax last tetra to treat.
+ * \param st length statistics over the range (to fill).
+ *
+ * Compute the length statistics of the edges owned by tetra \a kmin to \a
+ * kmax.
+ *
+ */
+static inline
+void MMG3D_computePrilen_range( MMG5_pMesh mesh, MMG5_pSol met, int8_t metRidTyp,
+                                uint8_t *own, MMG3D_pHotPoint hp,
+                                double *bd, MMG5_int kmin,
+                                MMG5_int kmax, MMG3D_LenStats *st )
+{
+  MMG5_pTetra     pt;
+  double          len;
+  MMG5_int        k,np,nq;
+  int8_t          ia,i;
+
+  memset(st->hl,0,9*sizeof(MMG5_int));
+  st->ned = 0;
+  st->avlen = 0.0;
+  st->lmax = 0.0;
+  st->lmin = 1.e30;
+  st->amin = st->amax = st->bmin = st->bmax = 0;
+  st->nullEdge = 0;
+
+  for(k=kmin; k<=kmax; k++) {
+    if ( !own[k] ) continue;
+    pt = &mesh->tetra[k];
+
+    for(ia=0; ia<6; ia++) {
+      if ( !(own[k] & (1 << ia)) ) continue;
+
+      np = pt->v[MMG5_iare[ia][0]];
+      nq = pt->v[MMG5_iare[ia][1]];
+
+      if ( hp ) {
+        len = MMG3D_lenedg_iso_hot(hp,ia,pt);
+      }
+      else if ( (!metRidTyp) && met->size==6 && met->m ) {
+        // Warning: we may erroneously approximate the length of a curve
+        // boundary edge by the length of the straight edge if the "MG_BDY"
+        // tag is missing along the edge.
+        len = MMG5_lenedg33_ani(mesh,met,ia,pt);
+      }
+      else
+        // Warning: we may erroneously approximate the length of a curve
+        // boundary edge by the length of the straight edge if the "MG_BDY"
+        // tag is missing along the edge.
+        len = MMG5_lenedg(mesh,met,ia,pt);
+
+
+      if ( !len ) {
+        ++st->nullEdge;
+      }
+      else {
+        st->avlen += len;
+        st->ned++;
+
+        if( len < st->lmin ) {
+          st->lmin = len;
+          st->amin = np;
+          st->bmin = nq;
+        }
+
+        if ( len > st->lmax ) {
+          st->lmax = len;
+          st->amax = np;
+          st->bmax = nq;
+        }
+
+        /* Locate size of edge among given table */
+        for(i=0; i<8; i++) {
+          if ( bd[i] <= len && len < bd[i+1] ) {
+            st->hl[i]++;
+            break;
+          }
+        }
+        if( i == 8 ) st->hl[8]++;
+      }
+    }
+  }
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -227,9 +497,12 @@ int MMG3D_computePrilen( MMG5_pMesh mesh, MMG5_pSol met, double* avlen,
   MMG5_pTetra     pt;
   MMG5_pPoint     ppt;
   MMG5_Hash       hash;
-  double          len;
+  MMG3D_LenStats  *st;
+  MMG3D_pHotPoint hp;
   MMG5_int        k,np,nq,n;
-  int8_t          ia,i0,i1,ier,i;
+  uint8_t         *own;
+  int8_t          ia,i0,i1,i;
+  int             nc,c;
   static double   bd[9]= {0.0, 0.3, 0.6, 0.7071, 0.9, 1.3, 1.4142, 2.0, 5.0};
 
   *bd_in = bd;
@@ -267,12 +540,18 @@ int MMG3D_computePrilen( MMG5_pMesh mesh, MMG5_pSol met, double* avlen,
       if(!MMG5_hashEdge(mesh,&hash,np,nq,0)){
         fprintf(stderr,"  ## Error: %s: function MMG5_hashEdge return 0\n",
                 __func__);
+        MMG5_DEL_MEM(mesh,hash.item);
         return 0;
       }
     }
   }
 
-  /* Pop edges from hash table, and analyze their length */
+  MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(uint8_t),"edge owners",
+               MMG5_DEL_MEM(mesh,hash.item);return 0);
+  MMG5_SAFE_CALLOC(own,mesh->ne+1,uint8_t,MMG5_DEL_MEM(mesh,hash.item);return 0);
+
+  /* Pop edges from hash table: the length of each edge is computed from the
+   * first tetra that pops it */
   for(k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) ) continue;
@@ -292,54 +571,63 @@ int MMG3D_computePrilen( MMG5_pMesh mesh, MMG5_pSol met, double* avlen,
       nq = pt->v[i1];
 
       /* Remove edge from hash ; ier = 1 if edge has been found */
-      ier = MMG5_hashPop(&hash,np,nq);
-      if( ier ) {
-        if ( (!metRidTyp) && met->size==6 && met->m ) {
-          // Warning: we may erroneously approximate the length of a curve
-          // boundary edge by the length of the straight edge if the "MG_BDY"
-          // tag is missing along the edge.
-          len = MMG5_lenedg33_ani(mesh,met,ia,pt);
-        }
-        else
-          // Warning: we may erroneously approximate the length of a curve
-          // boundary edge by the length of the straight edge if the "MG_BDY"
-          // tag is missing along the edge.
-          len = MMG5_lenedg(mesh,met,ia,pt);
+      if ( MMG5_hashPop(&hash,np,nq) ) {
+        own[k] |= (1 << ia);
+      }
+    }
+  }
+  MMG5_DEL_MEM(mesh,hash.item);
 
+  /* Analyze edge lengths by ordered chunks of tetra */
+  nc = MMG5_nthreads(mesh,mesh->ne);
+  MMG5_ADD_MEM(mesh,nc*sizeof(MMG3D_LenStats),"length chunks",
+               MMG5_DEL_MEM(mesh,own);return 0);
+  MMG5_SAFE_CALLOC(st,nc,MMG3D_LenStats,MMG5_DEL_MEM(mesh,own);return 0);
+
+  /* Isotropic lengths: read the coordinates and sizes from a compact copy of
+   * the points */
+  hp = NULL;
+  if ( !mesh->info.ani && met->size == 1 ) {
+    hp = MMG3D_hotPoints(mesh,met);
+  }
 
-        if ( !len ) {
-          ++(*nullEdge);
-        }
-        else {
-          *avlen += len;
-          (*ned)++;
-
-          if( len < (*lmin) ) {
-            *lmin = len;
-            *amin = np;
-            *bmin = nq;
-          }
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(nc) if(nc>1)
+#endif
+  {
+    MMG5_int kmin,kmax;
+    int      ic;
 
-          if ( len > (*lmax) ) {
-            *lmax = len;
-            *amax = np;
-            *bmax = nq;
-          }
+    for ( ic=MMG5_THREAD_NUM(); ic<nc; ic+=MMG5_NUM_THREADS() ) {
+      MMG5_CHUNK_RANGE(mesh->ne,ic,nc,kmin,kmax);
+      MMG3D_computePrilen_range(mesh,met,metRidTyp,own,hp,bd,kmin,kmax,&st[ic]);
+    }
+  }
 
-          /* Locate size of edge among given table */
-          for(i=0; i<8; i++) {
-            if ( bd[i] <= len && len < bd[i+1] ) {
-              hl[i]++;
-              break;
-            }
-          }
-          if( i == 8 ) hl[8]++;
-        }
-      }
+  /* Merge chunks in order */
+  for ( c=0; c<nc; ++c ) {
+    *avlen    += st[c].avlen;
+    *ned      += st[c].ned;
+    *nullEdge += st[c].nullEdge;
+    if ( st[c].lmin < *lmin ) {
+      *lmin = st[c].lmin;
+      *amin = st[c].amin;
+      *bmin = st[c].bmin;
+    }
+    if ( st[c].lmax > *lmax ) {
+      *lmax = st[c].lmax;
+      *amax = st[c].amax;
+      *bmax = st[c].bmax;
+    }
+    for ( i=0; i<9; ++i ) {
+      hl[i] += st[c].hl[i];
     }
   }
 
-  MMG5_DEL_MEM(mesh,hash.item);
+  MMG5_DEL_MEM(mesh,st);
+  MMG5_DEL_MEM(mesh,own);
+  MMG3D_freeHotPoints(mesh,&hp);
+
   return 1;
 }
 
@@ -372,6 +660,164 @@ int MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, int8_t metRidTyp) {
 }
 
 
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param les 1 to compute the LES (skewness) statistics, 0 otherwise.
+ * \param chkrid 1 to ignore tetra with 4 ridge points (special storage of
+ * metric at ridges).
+ * \param chkneg 1 to look for tetra with negative volume.
+ * \param kmin first tetra to treat.
+ * \param kmax last tetra to treat.
+ * \param st quality statistics over the range (to fill).
+ *
+ * Compute the quality statistics of tetra \a kmin to \a kmax from their
+ * stored quality.
+ *
+ */
+static inline
+void MMG3D_qualStats_range(MMG5_pMesh mesh,int8_t les,int8_t chkrid,int8_t chkneg,
+                           MMG5_int kmin,MMG5_int kmax,MMG3D_QualStats *st) {
+  MMG5_pTetra   pt;
+  MMG5_pPoint   ppt;
+  double        rap;
+  int           i,ir,n;
+  MMG5_int      k;
+
+  memset(st,0,sizeof(MMG3D_QualStats));
+  if ( les ) {
+    st->max = 1.0;
+  }
+  else {
+    st->min = 2.0;
+  }
+
+  for (k=kmin; k<=kmax; k++) {
+    pt = &mesh->tetra[k];
+    if( !MG_EOK(pt) ) {
+      st->nex++;
+      continue;
+    }
+    st->ok++;
+    if ( chkneg && (!st->neg) && (MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
+      st->neg = 1;
+    }
+
+    /* Count the number of tets with only ridge metric if special metric storage
+     * at ridge. */
+    if ( chkrid ) {
+      n = 0;
+      for(i=0 ; i<4 ; i++) {
+        ppt = &mesh->point[pt->v[i]];
+        if(!(MG_SIN(ppt->tag) || MG_NOM & ppt->tag) && (ppt->tag & MG_GEO)) continue;
+        n++;
+      }
+      if(!n) {
+        st->nrid++;
+        continue;
+      }
+    }
+
+    if ( les ) {
+      rap = 1. - MMG3D_ALPHAD * pt->qual;
+      if ( rap > st->min ) {
+        st->min = rap;
+        st->iel = st->ok;
+      }
+      if ( rap < 0.9 )  st->med++;
+      if ( rap < 0.6 )  st->good++;
+      st->avg += rap;
+      st->max  = MG_MIN(st->max,rap);
+      if(rap < 0.6)
+        st->his[0] += 1;
+      else if(rap < 0.9)
+        st->his[1] += 1;
+      else if(rap < 0.93)
+        st->his[2] += 1;
+      else if(rap < 0.99)
+        st->his[3] += 1;
+      else
+        st->his[4] += 1;
+    }
+    else {
+      rap = MMG3D_ALPHAD * pt->qual;
+      if ( rap < st->min ) {
+        st->min = rap;
+        st->iel = st->ok;
+      }
+      if ( rap > 0.5 )  st->med++;
+      if ( rap > 0.12 ) st->good++;
+      if ( rap < MMG3D_BADKAL )  st->badkal = 1;
+      st->avg += rap;
+      st->max  = MG_MAX(st->max,rap);
+      ir = MG_MIN(4,(int)(5.0*rap));
+      st->his[ir] += 1;
+    }
+  }
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param les 1 to compute the LES (skewness) statistics, 0 otherwise.
+ * \param chkrid 1 to ignore tetra with 4 ridge points.
+ * \param chkneg 1 to look for tetra with negative volume.
+ * \param st quality statistics over the mesh (to fill).
+ *
+ * Compute the quality statistics over the mesh. The tetra are split into
+ * ordered chunks (treated in parallel) whose statistics are merged in order:
+ * counts, histogram, extrema and worst element are the same than for a
+ * sequential sweep whatever the number of threads.
+ *
+ */
+static
+void MMG3D_qualStats(MMG5_pMesh mesh,int8_t les,int8_t chkrid,int8_t chkneg,
+                     MMG3D_QualStats *st) {
+  MMG3D_QualStats *cst;
+  int             nc,c,i;
+
+  nc = MMG3D_allocQualChunks(mesh,&cst);
+
+  if ( nc == 1 ) {
+    MMG3D_qualStats_range(mesh,les,chkrid,chkneg,1,mesh->ne,st);
+    return;
+  }
+
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(nc)
+#endif
+  {
+    MMG5_int kmin,kmax;
+    int      ic;
+
+    for ( ic=MMG5_THREAD_NUM(); ic<nc; ic+=MMG5_NUM_THREADS() ) {
+      MMG5_CHUNK_RANGE(mesh->ne,ic,nc,kmin,kmax);
+      MMG3D_qualStats_range(mesh,les,chkrid,chkneg,kmin,kmax,&cst[ic]);
+    }
+  }
+
+  /* Merge chunks in order */
+  *st = cst[0];
+  for ( c=1; c<nc; ++c ) {
+    if ( les ? (cst[c].min > st->min) : (cst[c].min < st->min) ) {
+      st->min = cst[c].min;
+      st->iel = st->ok + cst[c].iel;
+    }
+    st->max     = les ? MG_MIN(st->max,cst[c].max) : MG_MAX(st->max,cst[c].max);
+    st->avg    += cst[c].avg;
+    st->ok     += cst[c].ok;
+    st->nex    += cst[c].nex;
+    st->good   += cst[c].good;
+    st->med    += cst[c].med;
+    st->nrid   += cst[c].nrid;
+    st->neg    |= cst[c].neg;
+    st->badkal |= cst[c].badkal;
+    for ( i=0; i<5; ++i ) {
+      st->his[i] += cst[c].his[i];
+    }
+  }
+
+  MMG5_DEL_MEM(mesh,cst);
+}
+
 /**
  * \param mesh pointer to the mesh structure.
  * \param met pointer to the metric structure.
@@ -391,12 +837,15 @@ int MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, int8_t metRidTyp) {
  */
 void MMG3D_computeLESqua(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *ne,double *max,double *avg,
                          double *min,MMG5_int *iel,MMG5_int *good,MMG5_int *med,MMG5_int his[5],int imprim) {
-  MMG5_pTetra    pt;
-  double         rap;
-  MMG5_int       k,ok,nex;
-  static int8_t  mmgWarn0=0;
+  MMG5_pTetra     pt;
+  MMG3D_QualStats st;
+  MMG5_int        k;
+  static MMG5_THREADLOCAL int8_t   mmgWarn0=0;
 
   /*compute tet quality*/
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(MMG5_nthreads(mesh,mesh->ne)) private(pt)
+#endif
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
     if( !MG_EOK(pt) )   continue;
@@ -407,49 +856,23 @@ void MMG3D_computeLESqua(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *ne,double *max,
   if ( imprim <= 0 )
     return;
 
-  (*min)  = (*avg) = 0.0;
-  (*max)  = 1.0;
-  (*iel)  = 0;
-  (*med) = (*good) = 0;
-
-  for (k=0; k<5; k++)  his[k] = 0;
+  MMG3D_qualStats(mesh,1,0,!mmgWarn0,&st);
 
-  nex = ok = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",
-              __func__);
-    }
-    rap = 1. - MMG3D_ALPHAD * pt->qual;
-    if ( rap > (*min) ) {
-      (*min) = rap;
-      (*iel) = ok;
-    }
-    if ( rap < 0.9 )  (*med)++;
-    if ( rap < 0.6 )  (*good)++;
-    // if ( rap < MMG3D_BADKAL )  mesh->info.badkal = 1;
-    (*avg) += rap;
-    (*max)  = MG_MIN((*max),rap);
-    if(rap < 0.6)
-      his[0] += 1;
-    else if(rap < 0.9)
-      his[1] += 1;
-    else if(rap < 0.93)
-      his[2] += 1;
-    else if(rap < 0.99)
-      his[3] += 1;
-    else
-      his[4] += 1;
+  if ( (!mmgWarn0) && st.neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",
+            __func__);
   }
 
-  (*ne) = mesh->ne-nex;
+  (*min)  = st.min;
+  (*max)  = st.max;
+  (*avg)  = st.avg;
+  (*iel)  = st.iel;
+  (*med)  = st.med;
+  (*good) = st.good;
+  for (k=0; k<5; k++)  his[k] = st.his[k];
+
+  (*ne) = mesh->ne-st.nex;
 
   return;
 }
@@ -574,13 +997,15 @@ int MMG3D_displayQualHisto_internal(MMG5_int ne,double max,double avg,double min
  */
 void MMG3D_computeInqua(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *ne,double *max,double *avg,
                         double *min,MMG5_int *iel,MMG5_int *good,MMG5_int *med,MMG5_int his[5],int imprim) {
-  MMG5_pTetra   pt;
-  double        rap;
-  MMG5_int      k,ok,nex;
-  int           ir;
-  static int8_t mmgWarn0 = 0;
+  MMG5_pTetra     pt;
+  MMG3D_QualStats st;
+  MMG5_int        k;
+  static MMG5_THREADLOCAL int8_t   mmgWarn0 = 0;
 
   /*compute tet quality*/
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(MMG5_nthreads(mesh,mesh->ne)) private(pt)
+#endif
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
     if( !MG_EOK(pt) )   continue;
@@ -597,41 +1022,24 @@ void MMG3D_computeInqua(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *ne,double *max,d
   }
   if ( imprim <= 0 ) return;
 
-  (*min)  = 2.0;
-  (*max)  = (*avg) = 0.0;
-  (*iel)  = 0;
-  (*med) = (*good) = 0;
-
-  for (k=0; k<5; k++)  his[k] = 0;
+  MMG3D_qualStats(mesh,0,0,!mmgWarn0,&st);
 
-  nex = ok = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",
-              __func__);
-    }
-    rap = MMG3D_ALPHAD * pt->qual;
-    if ( rap < (*min) ) {
-      (*min) = rap;
-      (*iel) = ok;
-    }
-    if ( rap > 0.5 )  (*med)++;
-    if ( rap > 0.12 ) (*good)++;
-    if ( rap < MMG3D_BADKAL )  mesh->info.badkal = 1;
-    (*avg) += rap;
-    (*max)  = MG_MAX((*max),rap);
-    ir = MG_MIN(4,(int)(5.0*rap));
-    his[ir] += 1;
+  if ( (!mmgWarn0) && st.neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",
+            __func__);
   }
+  if ( st.badkal )  mesh->info.badkal = 1;
+
+  (*min)  = st.min;
+  (*max)  = st.max;
+  (*avg)  = st.avg;
+  (*iel)  = st.iel;
+  (*med)  = st.med;
+  (*good) = st.good;
+  for (k=0; k<5; k++)  his[k] = st.his[k];
 
-  (*ne) = mesh->ne-nex;
+  (*ne) = mesh->ne-st.nex;
 
   return;
 }
@@ -696,14 +1104,15 @@ int MMG3D_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
 void MMG3D_computeOutqua(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *ne,double *max,double *avg,
                          double *min,MMG5_int *iel,MMG5_int *good,MMG5_int *med,MMG5_int his[5],
                          MMG5_int *nrid,int imprim) {
-  MMG5_pTetra   pt;
-  MMG5_pPoint   ppt;
-  double        rap;
-  int           i,ir,n;
-  MMG5_int      k,ok,nex;
-  static int8_t mmgWarn0 = 0;
+  MMG5_pTetra     pt;
+  MMG3D_QualStats st;
+  MMG5_int        k;
+  static MMG5_THREADLOCAL int8_t   mmgWarn0 = 0;
 
   /*compute tet quality*/
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(MMG5_nthreads(mesh,mesh->ne)) private(pt)
+#endif
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
     if( !MG_EOK(pt) )   continue;
@@ -713,57 +1122,25 @@ void MMG3D_computeOutqua(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *ne,double *max,
   if ( imprim <= 0 )
     return;
 
-  (*min)  = 2.0;
-  (*max)  = (*avg) = 0.0;
-  (*iel)  = 0;
-  (*med) = (*good) = 0;
-
-  for (k=0; k<5; k++)  his[k] = 0;
-
-  nex = ok = (*nrid) = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",
-              __func__);
-    }
-
-    /* Count the number of tets with only ridge metric if special metric storage
-     * at ridge. */
-    if ( mesh->info.metRidTyp==1 ) {
-      n = 0;
-      for(i=0 ; i<4 ; i++) {
-        ppt = &mesh->point[pt->v[i]];
-        if(!(MG_SIN(ppt->tag) || MG_NOM & ppt->tag) && (ppt->tag & MG_GEO)) continue;
-        n++;
-      }
-      if(!n) {
-        (*nrid)++;
-        continue;
-      }
-    }
+  MMG3D_qualStats(mesh,0,mesh->info.metRidTyp==1,!mmgWarn0,&st);
 
-    rap = MMG3D_ALPHAD * pt->qual;
-    if ( rap < (*min) ) {
-      (*min) = rap;
-      (*iel) = ok;
-    }
-    if ( rap > 0.5 )  (*med)++;
-    if ( rap > 0.12 ) (*good)++;
-    if ( rap < MMG3D_BADKAL )  mesh->info.badkal = 1;
-    (*avg) += rap;
-    (*max)  = MG_MAX((*max),rap);
-    ir = MG_MIN(4,(int)(5.0*rap));
-    his[ir] += 1;
+  if ( (!mmgWarn0) && st.neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",
+            __func__);
   }
-
-  (*ne) = mesh->ne-nex;
+  if ( st.badkal )  mesh->info.badkal = 1;
+
+  (*min)  = st.min;
+  (*max)  = st.max;
+  (*avg)  = st.avg;
+  (*iel)  = st.iel;
+  (*med)  = st.med;
+  (*good) = st.good;
+  (*nrid) = st.nrid;
+  for (k=0; k<5; k++)  his[k] = st.his[k];
+
+  (*ne) = mesh->ne-st.nex;
 
   return;
 }
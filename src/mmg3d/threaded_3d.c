@@ -0,0 +1,1677 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mmg3d/threaded_3d.c
+ * \brief Shared-memory remeshing by partitioning with frozen interfaces.
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ *
+ * The mesh is split into subdomains by recursive coordinate bisection of the
+ * tetra barycenters. Each subdomain is copied into an independent mesh whose
+ * interface triangles are marked as parallel triangles (\a MG_PARBDY, as done
+ * by ParMmg), so they are frozen by the remeshing. The subdomains are remeshed
+ * concurrently by \ref MMG3D_mmg3dlib_int then merged back into the input mesh.
+ * The mesh is partitioned again with moved cuts so that the faces frozen at
+ * a pass are remeshed at the next one.
+ *
+ * The interface points of a subdomain are stored first in the sub-mesh: they
+ * can't be deleted and the packing of the sub-mesh preserves the relative
+ * order of the points, so they keep their index through the remeshing.
+ *
+ * The same machinery remeshes a region of the mesh (\ref MMG3D_mmg3dlib_region):
+ * the region and a buffer layer are extracted as a single subdomain, remeshed
+ * and merged back in place, the rest of the mesh being untouched.
+ *
+ */
+
+#include "libmmg3d.h"
+#include "libmmg3d_private.h"
+#include "mmg3dexterns_private.h"
+
+/** Number of partitioning/remeshing/merging passes of the threaded driver */
+#define MMG3D_THR_NPASS 3
+
+/**
+ * \struct MMG3D_Subdom
+ * \brief Subdomain remeshed by one thread of \ref MMG3D_mmg3dlib_threaded.
+ */
+typedef struct {
+  MMG5_pMesh mesh; /*!< sub-mesh */
+  MMG5_pSol  met;  /*!< metric of the sub-mesh */
+  MMG5_int   *l2g; /*!< index in the global mesh of the points of the sub-mesh */
+  MMG5_int   nif;  /*!< the \a nif first points of the sub-mesh are interface points */
+  int        ier;  /*!< return value of the remeshing of the sub-mesh */
+} MMG3D_Subdom;
+
+/**
+ * \struct MMG3D_Iface
+ * \brief Copy of the global entities lying on the subdomain interfaces.
+ *
+ * The interface entities are frozen in the sub-meshes: they are recovered from
+ * this copy when merging the sub-meshes so they are not duplicated and keep
+ * the tags and references they had before the partitioning.
+ */
+typedef struct {
+  MMG5_int   *gif;  /*!< index of a global point among the interface points (0 if not on an interface) */
+  MMG5_Point *pt;   /*!< interface points */
+  double     *m;    /*!< input metric at the interface points (if any) */
+  MMG5_Tria  *tr;   /*!< interface faces (flag: 0 for a pure interface face, 1
+                         for a boundary triangle, 2 once the triangle is merged) */
+  MMG5_Edge  *ed;   /*!< edges between interface points (base: 1 once merged) */
+  MMG5_Hash  fhash; /*!< hash table of the interface faces */
+  MMG5_Hash  ehash; /*!< hash table of the edges between interface points */
+  MMG5_int   np,nf,na;
+} MMG3D_Iface;
+
+/**
+ * \struct MMG3D_RcbKey
+ * \brief Sort key of a tetra along a cut axis.
+ */
+typedef struct {
+  double   x;
+  MMG5_int k;
+} MMG3D_RcbKey;
+
+static int MMG3D_cmpRcbKey(const void *a,const void *b) {
+  const MMG3D_RcbKey *ka = (const MMG3D_RcbKey*)a;
+  const MMG3D_RcbKey *kb = (const MMG3D_RcbKey*)b;
+
+  if ( ka->x < kb->x ) return -1;
+  if ( ka->x > kb->x ) return  1;
+  return ( ka->k > kb->k ) - ( ka->k < kb->k );
+}
+
+/**
+ * \param bar barycenters of the tetra.
+ * \param key tetra to split.
+ * \param n number of tetra to split.
+ * \param npart number of parts to build.
+ * \param first index of the first part.
+ * \param ipass index of the pass of the threaded driver.
+ * \param part part of each tetra (to fill).
+ *
+ * Recursive coordinate bisection of the tetra of \a key into \a npart parts.
+ * At the first pass, the tetra are cut at the median along the
+ * largest extent of their barycenters. The next passes cycle through the axes
+ * of comparable extent and move the cut so that the new interfaces cross the
+ * previous ones.
+ *
+ */
+static void MMG3D_rcbPart(double *bar,MMG3D_RcbKey *key,MMG5_int n,int npart,
+                          int first,int ipass,MMG5_int *part) {
+  double   min[3],max[3],ext[3],q,sh;
+  MMG5_int k,m;
+  int      i,j,ax[3],nax,n1,d;
+
+  if ( npart == 1 ) {
+    for ( k=0; k<n; ++k ) part[key[k].k] = first;
+    return;
+  }
+
+  for ( i=0; i<3; ++i ) {
+    min[i] =  DBL_MAX;
+    max[i] = -DBL_MAX;
+  }
+  for ( k=0; k<n; ++k ) {
+    for ( i=0; i<3; ++i ) {
+      min[i] = MG_MIN(min[i],bar[3*key[k].k+i]);
+      max[i] = MG_MAX(max[i],bar[3*key[k].k+i]);
+    }
+  }
+
+  /* axes by decreasing extent */
+  for ( i=0; i<3; ++i ) {
+    ext[i] = max[i]-min[i];
+    ax[i]  = i;
+  }
+  for ( i=1; i<3; ++i ) {
+    for ( j=i; j>0 && ext[ax[j]] > ext[ax[j-1]]; --j ) {
+      d = ax[j]; ax[j] = ax[j-1]; ax[j-1] = d;
+    }
+  }
+  nax = 1;
+  while ( nax < 3 && ext[ax[nax]] >= 0.5*ext[ax[0]] ) ++nax;
+  d = ax[ipass % nax];
+
+  for ( k=0; k<n; ++k ) key[k].x = bar[3*key[k].k+d];
+  qsort(key,n,sizeof(MMG3D_RcbKey),MMG3D_cmpRcbKey);
+
+  n1 = npart/2;
+  q  = (double)n1/(double)npart;
+  sh = ( ipass % 3 == 1 ) ? 0.25 : ( ipass % 3 == 2 ) ? -0.25 : 0.;
+  q += sh * MG_MIN(q,1.-q);
+  m  = (MMG5_int)(q*n);
+  m  = MG_MAX(1,MG_MIN(n-1,m));
+
+  MMG3D_rcbPart(bar,key,m,n1,first,ipass,part);
+  MMG3D_rcbPart(bar,key+m,n-m,npart-n1,first+n1,ipass,part);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param npart number of parts.
+ * \param ipass index of the pass of the threaded driver.
+ * \param part part of each tetra (to fill).
+ * \return 1 if success, 0 if fail.
+ *
+ * Partition the tetra of the mesh into \a npart parts of same size.
+ *
+ */
+static int MMG3D_thr_partition(MMG5_pMesh mesh,int npart,int ipass,MMG5_int *part) {
+  MMG5_pTetra  pt;
+  MMG3D_RcbKey *key;
+  double       *bar;
+  MMG5_int     k,n;
+  int          i,j;
+
+  MMG5_ADD_MEM(mesh,(3*(mesh->ne+1))*sizeof(double),"barycenters",return 0);
+  MMG5_SAFE_CALLOC(bar,3*(mesh->ne+1),double,return 0);
+
+  MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(MMG3D_RcbKey),"partitioning keys",
+               MMG5_DEL_MEM(mesh,bar);
+               return 0);
+  MMG5_SAFE_CALLOC(key,mesh->ne+1,MMG3D_RcbKey,
+                   MMG5_DEL_MEM(mesh,bar);
+                   return 0);
+
+  n = 0;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    part[k] = -1;
+    if ( !MG_EOK(pt) ) continue;
+
+    for ( j=0; j<3; ++j ) {
+      for ( i=0; i<4; ++i ) {
+        bar[3*k+j] += mesh->point[pt->v[i]].c[j];
+      }
+      bar[3*k+j] *= 0.25;
+    }
+    key[n++].k = k;
+  }
+
+  MMG3D_rcbPart(bar,key,n,npart,0,ipass,part);
+
+  MMG5_DEL_MEM(mesh,key);
+  MMG5_DEL_MEM(mesh,bar);
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param ifc interface entities.
+ *
+ * Free the copy of the interface entities.
+ *
+ */
+static void MMG3D_thr_freeIface(MMG5_pMesh mesh,MMG3D_Iface *ifc) {
+  if ( ifc->gif )        MMG5_DEL_MEM(mesh,ifc->gif);
+  if ( ifc->pt )         MMG5_DEL_MEM(mesh,ifc->pt);
+  if ( ifc->m )          MMG5_DEL_MEM(mesh,ifc->m);
+  if ( ifc->tr )         MMG5_DEL_MEM(mesh,ifc->tr);
+  if ( ifc->ed )         MMG5_DEL_MEM(mesh,ifc->ed);
+  if ( ifc->fhash.item ) MMG5_DEL_MEM(mesh,ifc->fhash.item);
+  if ( ifc->ehash.item ) MMG5_DEL_MEM(mesh,ifc->ehash.item);
+}
+
+/**
+ * \param mesh pointer to the mesh structure (with adjacency).
+ * \param met pointer to the metric structure.
+ * \param part partition of the tetra.
+ * \param list tetra to scan (NULL to scan the whole mesh).
+ * \param ne number of tetra in \a list.
+ * \param ttab hash table of the boundary triangles.
+ * \param ifc interface entities (to fill).
+ * \return 1 if success, 0 if fail.
+ *
+ * Copy the faces between tetra of different parts, their vertices (and the
+ * metric at these vertices) and the edges joining their vertices. If \a list
+ * is given, only the faces of the tetra of the list are seen (each interface
+ * face is then seen only once).
+ *
+ */
+static int MMG3D_thr_setIface(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *part,
+                              MMG5_int *list,MMG5_int ne,MMG5_Hash *ttab,
+                              MMG3D_Iface *ifc) {
+  MMG5_pTetra pt;
+  MMG5_pTria  ptt;
+  MMG5_pEdge  pa;
+  MMG5_int    k,kk,kt,n,*adja,v[3];
+  int         i,j;
+
+  if ( !list ) ne = mesh->ne;
+
+  MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(MMG5_int),"interface points",return 0);
+  MMG5_SAFE_CALLOC(ifc->gif,mesh->np+1,MMG5_int,return 0);
+
+  /* Count the interface faces and number the interface points */
+  ifc->nf = ifc->np = 0;
+  for ( n=0; n<ne; ++n ) {
+    k  = list ? list[n] : n+1;
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; ++i ) {
+      kk = adja[i]/4;
+      if ( (!kk) || part[kk] == part[k] ) continue;
+
+      for ( j=0; j<3; ++j ) {
+        v[0] = pt->v[MMG5_idir[i][j]];
+        if ( !ifc->gif[v[0]] ) ifc->gif[v[0]] = ++ifc->np;
+      }
+      if ( list || k < kk ) ++ifc->nf;
+    }
+  }
+
+  MMG5_ADD_MEM(mesh,(ifc->np+1)*sizeof(MMG5_Point),"interface points",return 0);
+  MMG5_SAFE_CALLOC(ifc->pt,ifc->np+1,MMG5_Point,return 0);
+
+  /* The metric of the frozen points is reset by the sub-meshes from the length
+   * of the frozen edges: save the input one */
+  if ( met->m ) {
+    MMG5_ADD_MEM(mesh,(ifc->np+1)*sizeof(double),"interface metric",return 0);
+    MMG5_SAFE_CALLOC(ifc->m,ifc->np+1,double,return 0);
+  }
+
+  /* Interface faces and points */
+  MMG5_ADD_MEM(mesh,(ifc->nf+1)*sizeof(MMG5_Tria),"interface faces",return 0);
+  MMG5_SAFE_CALLOC(ifc->tr,ifc->nf+1,MMG5_Tria,return 0);
+  if ( !MMG5_hashNew(mesh,&ifc->fhash,ifc->nf,3*ifc->nf) ) return 0;
+
+  ifc->nf = 0;
+  for ( n=0; n<ne; ++n ) {
+    k  = list ? list[n] : n+1;
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; ++i ) {
+      kk = adja[i]/4;
+      if ( (!kk) || part[kk] == part[k] || ((!list) && kk < k) ) continue;
+
+      v[0] = pt->v[MMG5_idir[i][0]];
+      v[1] = pt->v[MMG5_idir[i][1]];
+      v[2] = pt->v[MMG5_idir[i][2]];
+      for ( j=0; j<3; ++j ) {
+        ifc->pt[ifc->gif[v[j]]] = mesh->point[v[j]];
+        if ( met->m ) ifc->m[ifc->gif[v[j]]] = met->m[v[j]];
+      }
+
+      ptt = &ifc->tr[++ifc->nf];
+      kt  = ttab->siz ? MMG5_hashGetFace(ttab,v[0],v[1],v[2]) : 0;
+      if ( kt ) {
+        *ptt = mesh->tria[kt];
+        ptt->flag = 1;
+      }
+      else {
+        ptt->v[0] = v[0];
+        ptt->v[1] = v[1];
+        ptt->v[2] = v[2];
+        ptt->flag = 0;
+      }
+      if ( !MMG5_hashFace(mesh,&ifc->fhash,v[0],v[1],v[2],ifc->nf) ) return 0;
+    }
+  }
+
+  /* Edges between interface points */
+  ifc->na = 0;
+  for ( k=1; k<=mesh->na; ++k ) {
+    pa = &mesh->edge[k];
+    if ( ifc->gif[pa->a] && ifc->gif[pa->b] ) ++ifc->na;
+  }
+  if ( !ifc->na ) return 1;
+
+  MMG5_ADD_MEM(mesh,(ifc->na+1)*sizeof(MMG5_Edge),"interface edges",return 0);
+  MMG5_SAFE_CALLOC(ifc->ed,ifc->na+1,MMG5_Edge,return 0);
+  if ( !MMG5_hashNew(mesh,&ifc->ehash,ifc->na,3*ifc->na) ) return 0;
+
+  ifc->na = 0;
+  for ( k=1; k<=mesh->na; ++k ) {
+    pa = &mesh->edge[k];
+    if ( !(ifc->gif[pa->a] && ifc->gif[pa->b]) ) continue;
+
+    ifc->ed[++ifc->na] = *pa;
+    ifc->ed[ifc->na].base = 0;
+    if ( !MMG5_hashEdge(mesh,&ifc->ehash,pa->a,pa->b,ifc->na) ) return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param sd subdomains.
+ * \param npart number of subdomains.
+ *
+ * Free the sub-meshes.
+ *
+ */
+static void MMG3D_thr_freeSubdom(MMG5_pMesh mesh,MMG3D_Subdom *sd,int npart) {
+  int p;
+
+  for ( p=0; p<npart; ++p ) {
+    if ( sd[p].l2g ) MMG5_DEL_MEM(mesh,sd[p].l2g);
+    if ( sd[p].mesh ) {
+      MMG3D_Free_all(MMG5_ARG_start,
+                     MMG5_ARG_ppMesh,&sd[p].mesh,MMG5_ARG_ppMet,&sd[p].met,
+                     MMG5_ARG_end);
+    }
+  }
+}
+
+/**
+ * \param mesh pointer to the mesh structure (with adjacency).
+ * \param met pointer to the metric structure.
+ * \param sinfo parameters of the sub-meshes.
+ * \param part partition of the tetra.
+ * \param list tetra of the part \a p.
+ * \param ne number of tetra of the part \a p.
+ * \param p index of the part.
+ * \param ttab hash table of the boundary triangles.
+ * \param ifc interface entities.
+ * \param gl work array of size np+1 filled by 0.
+ * \param tmark work array of size nt+1 (triangle marks).
+ * \param sd subdomain to fill.
+ * \return 1 if success, 0 if fail.
+ *
+ * Copy the tetra of the part \a p, their vertices, the boundary triangles and
+ * edges that they contain into a new mesh. The interface points are stored
+ * first and the interface faces are set as parallel triangles.
+ *
+ */
+static int MMG3D_thr_extract(MMG5_pMesh mesh,MMG5_pSol met,MMG5_Info *sinfo,
+                             MMG5_int *part,MMG5_int *list,MMG5_int ne,int p,
+                             MMG5_Hash *ttab,MMG3D_Iface *ifc,MMG5_int *gl,
+                             MMG5_int *tmark,MMG3D_Subdom *sd) {
+  MMG5_pMesh  sub;
+  MMG5_pTetra pt,pt1;
+  MMG5_pTria  ptt,ptt1;
+  MMG5_pEdge  pa,pa1;
+  MMG5_pPoint ppt,ppt1;
+  MMG5_int    k,kk,kt,np,nt,na,n,*adja,v[3];
+  int         i,j,isif;
+
+  /* Number the points: interface points first */
+  np = 0;
+  for ( n=0; n<ne; ++n ) {
+    pt = &mesh->tetra[list[n]];
+    for ( i=0; i<4; ++i ) {
+      if ( !gl[pt->v[i]] ) {
+        gl[pt->v[i]] = -1;
+        ++np;
+      }
+    }
+  }
+  MMG5_ADD_MEM(mesh,(np+1)*sizeof(MMG5_int),"subdomain points",return 0);
+  MMG5_SAFE_CALLOC(sd->l2g,np+1,MMG5_int,return 0);
+
+  np = 0;
+  for ( isif=1; isif>=0; --isif ) {
+    for ( n=0; n<ne; ++n ) {
+      k    = list[n];
+      pt   = &mesh->tetra[k];
+      adja = &mesh->adja[4*(k-1)+1];
+      for ( i=0; i<4; ++i ) {
+        kk = adja[i]/4;
+        if ( isif && ((!kk) || part[kk] == p) ) continue;
+
+        for ( j=0; j<3; ++j ) {
+          v[0] = pt->v[MMG5_idir[i][j]];
+          if ( gl[v[0]] < 0 ) {
+            gl[v[0]] = ++np;
+            sd->l2g[np] = v[0];
+          }
+        }
+      }
+    }
+    if ( isif ) sd->nif = np;
+  }
+
+  /* Count the triangles */
+  nt = 0;
+  for ( n=0; n<ne; ++n ) {
+    k    = list[n];
+    pt   = &mesh->tetra[k];
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; ++i ) {
+      kk = adja[i]/4;
+      if ( kk && part[kk] != p ) {
+        ++nt;
+        continue;
+      }
+      if ( !ttab->siz ) continue;
+
+      kt = MMG5_hashGetFace(ttab,pt->v[MMG5_idir[i][0]],pt->v[MMG5_idir[i][1]],
+                            pt->v[MMG5_idir[i][2]]);
+      if ( kt && tmark[kt] != p+1 ) {
+        tmark[kt] = p+1;
+        ++nt;
+      }
+    }
+  }
+
+  na = 0;
+  for ( k=1; k<=mesh->na; ++k ) {
+    pa = &mesh->edge[k];
+    if ( gl[pa->a] && gl[pa->b] ) ++na;
+  }
+
+  /* Sub-mesh creation */
+  sd->mesh = NULL;
+  sd->met  = NULL;
+  if ( !MMG3D_Init_mesh(MMG5_ARG_start,
+                        MMG5_ARG_ppMesh,&sd->mesh,MMG5_ARG_ppMet,&sd->met,
+                        MMG5_ARG_end) ) {
+    return 0;
+  }
+  sub = sd->mesh;
+
+  sub->info     = *sinfo;
+  sub->info.par = NULL;
+  if ( sinfo->npar ) {
+    MMG5_ADD_MEM(sub,sinfo->npar*sizeof(MMG5_Par),"parameters",return 0);
+    MMG5_SAFE_CALLOC(sub->info.par,sinfo->npar,MMG5_Par,return 0);
+    memcpy(sub->info.par,sinfo->par,sinfo->npar*sizeof(MMG5_Par));
+  }
+
+  if ( !MMG3D_Set_meshSize(sub,np,ne,0,nt,0,na) ) return 0;
+
+  for ( k=1; k<=np; ++k ) {
+    ppt  = &mesh->point[sd->l2g[k]];
+    ppt1 = &sub->point[k];
+    ppt1->c[0] = ppt->c[0];
+    ppt1->c[1] = ppt->c[1];
+    ppt1->c[2] = ppt->c[2];
+    ppt1->ref  = ppt->ref;
+    ppt1->tag  = ppt->tag;
+    if ( k <= sd->nif ) {
+      /* Parallel point (same convention as ParMmg): a truly required point
+       * doesn't have the MG_NOSURF tag */
+      if ( ppt1->tag & MG_REQ ) {
+        ppt1->tag |= MG_PARBDY + MG_BDY;
+      }
+      else {
+        ppt1->tag |= MG_PARBDY + MG_BDY + MG_REQ + MG_NOSURF;
+      }
+    }
+  }
+
+  nt = 0;
+  for ( n=0; n<ne; ++n ) {
+    k    = list[n];
+    pt   = &mesh->tetra[k];
+    pt1  = &sub->tetra[n+1];
+    for ( i=0; i<4; ++i ) pt1->v[i] = gl[pt->v[i]];
+    pt1->ref = pt->ref;
+    pt1->tag = pt->tag;
+
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; ++i ) {
+      v[0] = pt->v[MMG5_idir[i][0]];
+      v[1] = pt->v[MMG5_idir[i][1]];
+      v[2] = pt->v[MMG5_idir[i][2]];
+
+      kk = adja[i]/4;
+      if ( kk && part[kk] != p ) {
+        /* Interface face: frozen */
+        kt   = MMG5_hashGetFace(&ifc->fhash,v[0],v[1],v[2]);
+        assert ( kt );
+        ptt  = &ifc->tr[kt];
+        ptt1 = &sub->tria[++nt];
+        if ( ptt->flag ) {
+          *ptt1 = *ptt;
+          for ( j=0; j<3; ++j ) ptt1->v[j] = gl[ptt->v[j]];
+        }
+        else {
+          for ( j=0; j<3; ++j ) ptt1->v[j] = gl[v[j]];
+        }
+        MMG3D_Set_parallelTriangle(sub,nt);
+        continue;
+      }
+      if ( !ttab->siz ) continue;
+
+      kt = MMG5_hashGetFace(ttab,v[0],v[1],v[2]);
+      if ( kt && tmark[kt] == p+1 ) {
+        tmark[kt] = -(p+1);
+        ptt1  = &sub->tria[++nt];
+        *ptt1 = mesh->tria[kt];
+        for ( j=0; j<3; ++j ) ptt1->v[j] = gl[ptt1->v[j]];
+      }
+    }
+  }
+
+  na = 0;
+  for ( k=1; k<=mesh->na; ++k ) {
+    pa = &mesh->edge[k];
+    if ( !(gl[pa->a] && gl[pa->b]) ) continue;
+
+    pa1  = &sub->edge[++na];
+    *pa1 = *pa;
+    pa1->a = gl[pa->a];
+    pa1->b = gl[pa->b];
+  }
+
+  if ( met->m ) {
+    if ( !MMG3D_Set_solSize(sub,sd->met,MMG5_Vertex,np,MMG5_Scalar) ) return 0;
+    for ( k=1; k<=np; ++k ) sd->met->m[k] = met->m[sd->l2g[k]];
+  }
+
+  for ( k=1; k<=np; ++k ) gl[sd->l2g[k]] = 0;
+
+  return 1;
+}
+
+/**
+ * \param tag tag of an entity of a remeshed sub-mesh.
+ * \return the tag without the parallel boundary information.
+ *
+ */
+static inline uint16_t MMG3D_thr_unsetParTag(uint16_t tag) {
+  if ( tag & MG_PARBDY ) {
+    tag &= ~(MG_PARBDY | MG_PARBDYBDY);
+    if ( tag & MG_NOSURF ) tag &= ~(MG_NOSURF | MG_REQ);
+  }
+  return tag;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param ifc interface entities.
+ * \param sd remeshed subdomains.
+ * \param npart number of subdomains.
+ * \return 1 if the sub-meshes can be merged, 0 otherwise.
+ *
+ * Check that the interface points of the remeshed sub-meshes are still stored
+ * first and have not moved.
+ *
+ */
+static int MMG3D_thr_chkSubdom(MMG5_pMesh mesh,MMG3D_Iface *ifc,
+                               MMG3D_Subdom *sd,int npart) {
+  MMG5_pMesh  sub;
+  MMG5_pPoint ppt,ppt1;
+  double      tol;
+  MMG5_int    k;
+  int         p;
+
+  tol = MMG5_EPS * mesh->info.delta;
+  for ( p=0; p<npart; ++p ) {
+    sub = sd[p].mesh;
+    if ( sub->np < sd[p].nif || (!sd[p].met->m) || sd[p].met->np != sub->np ) {
+      return 0;
+    }
+    for ( k=1; k<=sd[p].nif; ++k ) {
+      ppt  = &sub->point[k];
+      ppt1 = &ifc->pt[ifc->gif[sd[p].l2g[k]]];
+      if ( fabs(ppt->c[0]-ppt1->c[0]) > tol ||
+           fabs(ppt->c[1]-ppt1->c[1]) > tol ||
+           fabs(ppt->c[2]-ppt1->c[2]) > tol ) {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param ifc interface entities.
+ * \param sd remeshed subdomains.
+ * \param npart number of subdomains.
+ * \return 1 if success, 0 if fail.
+ *
+ * Replace the mesh by the union of the remeshed sub-meshes. The frozen
+ * interface entities are recovered from \a ifc, the pure interface triangles
+ * are removed.
+ *
+ */
+static int MMG3D_thr_merge(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_Iface *ifc,
+                           MMG3D_Subdom *sd,int npart) {
+  MMG5_pMesh  sub;
+  MMG5_pTetra pt,pt1;
+  MMG5_pTria  ptt,ptt1;
+  MMG5_pEdge  pa,pa1;
+  MMG5_pPoint ppt,ppt1;
+  MMG5_int    *nid,*loc,*l2g,np,ne,nt,na,npmax,k,kt,nif;
+  int         i,p;
+
+  np = ifc->np;
+  ne = nt = na = npmax = 0;
+  for ( p=0; p<npart; ++p ) {
+    sub    = sd[p].mesh;
+    np    += sub->np - sd[p].nif;
+    ne    += sub->ne;
+    nt    += sub->nt;
+    na    += sub->na;
+    npmax  = MG_MAX(npmax,sub->np);
+  }
+
+  MMG5_ADD_MEM(mesh,(ifc->np+1)*sizeof(MMG5_int),"interface points",return 0);
+  MMG5_SAFE_CALLOC(nid,ifc->np+1,MMG5_int,return 0);
+  MMG5_ADD_MEM(mesh,(npmax+1)*sizeof(MMG5_int),"subdomain points",
+               MMG5_DEL_MEM(mesh,nid);
+               return 0);
+  MMG5_SAFE_CALLOC(loc,npmax+1,MMG5_int,
+                   MMG5_DEL_MEM(mesh,nid);
+                   return 0);
+
+  MMG3D_Free_topoTables(mesh);
+  if ( !MMG3D_Set_meshSize(mesh,np,ne,0,nt,0,na) ||
+       !MMG3D_Set_solSize(mesh,met,MMG5_Vertex,np,MMG5_Scalar) ) {
+    MMG5_DEL_MEM(mesh,loc);
+    MMG5_DEL_MEM(mesh,nid);
+    return 0;
+  }
+
+  np = ne = nt = na = 0;
+  for ( p=0; p<npart; ++p ) {
+    sub = sd[p].mesh;
+    l2g = sd[p].l2g;
+    nif = sd[p].nif;
+
+    /* Points: the interface points are recovered from the global mesh */
+    for ( k=1; k<=sub->np; ++k ) {
+      if ( k <= nif ) {
+        kt = ifc->gif[l2g[k]];
+        if ( !nid[kt] ) {
+          nid[kt] = ++np;
+          ppt  = &ifc->pt[kt];
+          ppt1 = &mesh->point[np];
+          memcpy(ppt1->c,ppt->c,3*sizeof(double));
+          ppt1->ref = ppt->ref;
+          ppt1->tag = ppt->tag;
+          met->m[np] = ifc->m ? ifc->m[kt] : sd[p].met->m[k];
+        }
+        loc[k] = nid[kt];
+        /* Add the geometric tags found by the analysis of the subdomain (the
+         * MG_BDY tag is set from the boundary triangles) */
+        mesh->point[loc[k]].tag |= sub->point[k].tag &
+          ~(MG_PARBDY | MG_PARBDYBDY | MG_NOSURF | MG_REQ | MG_BDY);
+      }
+      else {
+        loc[k] = ++np;
+        ppt  = &sub->point[k];
+        ppt1 = &mesh->point[np];
+        memcpy(ppt1->c,ppt->c,3*sizeof(double));
+        ppt1->ref = ppt->ref;
+        ppt1->tag = MMG3D_thr_unsetParTag(ppt->tag);
+        met->m[np] = sd[p].met->m[k];
+      }
+    }
+
+    for ( k=1; k<=sub->ne; ++k ) {
+      pt = &sub->tetra[k];
+      if ( !MG_EOK(pt) ) continue;
+
+      pt1 = &mesh->tetra[++ne];
+      for ( i=0; i<4; ++i ) pt1->v[i] = loc[pt->v[i]];
+      pt1->ref = pt->ref;
+      pt1->tag = MMG3D_thr_unsetParTag(pt->tag);
+    }
+
+    /* Triangles: the interface faces are recovered from the global mesh (and
+     * removed if they are not boundary triangles) */
+    for ( k=1; k<=sub->nt; ++k ) {
+      ptt = &sub->tria[k];
+      if ( !MG_EOK(ptt) ) continue;
+
+      if ( ptt->v[0] <= nif && ptt->v[1] <= nif && ptt->v[2] <= nif ) {
+        kt = MMG5_hashGetFace(&ifc->fhash,l2g[ptt->v[0]],l2g[ptt->v[1]],
+                              l2g[ptt->v[2]]);
+        if ( kt ) {
+          if ( ifc->tr[kt].flag == 1 ) {
+            ifc->tr[kt].flag = 2;
+            ptt1  = &mesh->tria[++nt];
+            *ptt1 = ifc->tr[kt];
+            for ( i=0; i<3; ++i ) ptt1->v[i] = nid[ifc->gif[ptt1->v[i]]];
+            ptt1->flag = 0;
+          }
+          continue;
+        }
+      }
+      ptt1  = &mesh->tria[++nt];
+      *ptt1 = *ptt;
+      for ( i=0; i<3; ++i ) {
+        ptt1->v[i]   = loc[ptt->v[i]];
+        ptt1->tag[i] = MMG3D_thr_unsetParTag(ptt->tag[i]);
+      }
+    }
+
+    /* Edges: the edges between interface points are recovered from the global
+     * mesh (and removed if they didn't exist) */
+    for ( k=1; k<=sub->na; ++k ) {
+      pa = &sub->edge[k];
+      if ( !pa->a ) continue;
+
+      if ( pa->a <= nif && pa->b <= nif ) {
+        kt = ifc->na ? MMG5_hashGet(&ifc->ehash,l2g[pa->a],l2g[pa->b]) : 0;
+        if ( kt && !ifc->ed[kt].base ) {
+          ifc->ed[kt].base = 1;
+          pa1  = &mesh->edge[++na];
+          *pa1 = ifc->ed[kt];
+          pa1->a    = nid[ifc->gif[pa1->a]];
+          pa1->b    = nid[ifc->gif[pa1->b]];
+          pa1->base = 0;
+        }
+        continue;
+      }
+      pa1  = &mesh->edge[++na];
+      *pa1 = *pa;
+      pa1->a   = loc[pa->a];
+      pa1->b   = loc[pa->b];
+      pa1->tag = MMG3D_thr_unsetParTag(pa->tag);
+    }
+  }
+  assert ( np == mesh->np && ne == mesh->ne );
+
+  for ( k=1; k<=nt; ++k ) {
+    ptt = &mesh->tria[k];
+    for ( i=0; i<3; ++i ) mesh->point[ptt->v[i]].tag |= MG_BDY;
+  }
+
+  mesh->nt = mesh->nti = nt;
+  mesh->na = mesh->nai = na;
+
+  MMG5_DEL_MEM(mesh,loc);
+  MMG5_DEL_MEM(mesh,nid);
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param sinfo parameters of the sub-meshes.
+ * \param npart number of subdomains.
+ * \param ipass index of the pass.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but the
+ * mesh is still valid (unchanged or merged), \ref MMG5_STRONGFAILURE if fail
+ * and the mesh is lost.
+ *
+ * One pass of the threaded driver: partition the mesh, remesh the subdomains
+ * concurrently and merge them.
+ *
+ */
+static int MMG3D_thr_pass(MMG5_pMesh mesh,MMG5_pSol met,MMG5_Info *sinfo,
+                          int npart,int ipass) {
+  MMG5_pTria   ptt;
+  MMG3D_Subdom *sd;
+  MMG3D_Iface  ifc;
+  MMG5_Hash    ttab;
+  MMG5_int     *part,*head,*list,*gl,*tmark,k;
+  int          p,ier,ret;
+
+  ret   = MMG5_LOWFAILURE;
+  part  = head = list = gl = tmark = NULL;
+  sd    = NULL;
+  memset(&ifc,0,sizeof(MMG3D_Iface));
+  memset(&ttab,0,sizeof(MMG5_Hash));
+
+  if ( !mesh->adja && !MMG3D_hashTetra(mesh,0) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to build the adjacency.\n",__func__);
+    return MMG5_LOWFAILURE;
+  }
+
+  /* Partitioning */
+  MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(MMG5_int),"partition",goto end);
+  MMG5_SAFE_CALLOC(part,mesh->ne+1,MMG5_int,goto end);
+  if ( !MMG3D_thr_partition(mesh,npart,ipass,part) ) goto end;
+
+  /* List of tetra of each part (in increasing order) */
+  MMG5_ADD_MEM(mesh,(npart+1)*sizeof(MMG5_int),"partition",goto end);
+  MMG5_SAFE_CALLOC(head,npart+1,MMG5_int,goto end);
+  MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(MMG5_int),"partition",goto end);
+  MMG5_SAFE_CALLOC(list,mesh->ne+1,MMG5_int,goto end);
+  for ( k=1; k<=mesh->ne; ++k ) {
+    if ( part[k] >= 0 ) ++head[part[k]+1];
+  }
+  for ( p=0; p<npart; ++p ) head[p+1] += head[p];
+  for ( k=1; k<=mesh->ne; ++k ) {
+    if ( part[k] >= 0 ) list[head[part[k]]++] = k;
+  }
+  for ( p=npart; p>0; --p ) head[p] = head[p-1];
+  head[0] = 0;
+
+  /* Boundary triangles */
+  if ( mesh->nt ) {
+    if ( !MMG5_hashNew(mesh,&ttab,mesh->nt,3*mesh->nt) ) goto end;
+    for ( k=1; k<=mesh->nt; ++k ) {
+      ptt = &mesh->tria[k];
+      if ( !MG_EOK(ptt) ) continue;
+      if ( !MMG5_hashFace(mesh,&ttab,ptt->v[0],ptt->v[1],ptt->v[2],k) ) goto end;
+    }
+  }
+
+  if ( !MMG3D_thr_setIface(mesh,met,part,NULL,0,&ttab,&ifc) ) goto end;
+
+  /* Sub-meshes */
+  MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(MMG5_int),"local numbering",goto end);
+  MMG5_SAFE_CALLOC(gl,mesh->np+1,MMG5_int,goto end);
+  MMG5_ADD_MEM(mesh,(mesh->nt+1)*sizeof(MMG5_int),"triangle marks",goto end);
+  MMG5_SAFE_CALLOC(tmark,mesh->nt+1,MMG5_int,goto end);
+  MMG5_ADD_MEM(mesh,npart*sizeof(MMG3D_Subdom),"subdomains",goto end);
+  MMG5_SAFE_CALLOC(sd,npart,MMG3D_Subdom,goto end);
+
+  for ( p=0; p<npart; ++p ) {
+    if ( !MMG3D_thr_extract(mesh,met,sinfo,part,&list[head[p]],head[p+1]-head[p],
+                            p,&ttab,&ifc,gl,tmark,&sd[p]) ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to build the subdomain %d.\n",
+              __func__,p);
+      goto end;
+    }
+  }
+  MMG5_DEL_MEM(mesh,tmark);
+  MMG5_DEL_MEM(mesh,gl);
+  MMG5_DEL_MEM(mesh,list);
+  MMG5_DEL_MEM(mesh,head);
+  MMG5_DEL_MEM(mesh,part);
+  if ( ttab.item ) MMG5_DEL_MEM(mesh,ttab.item);
+
+  /* Concurrent remeshing */
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic,1) num_threads(npart)
+#endif
+  for ( p=0; p<npart; ++p ) {
+    sd[p].ier = MMG3D_mmg3dlib_int(sd[p].mesh,sd[p].met);
+  }
+
+  ier = MMG5_SUCCESS;
+  for ( p=0; p<npart; ++p ) {
+    if ( sd[p].ier == MMG5_STRONGFAILURE ) {
+      fprintf(stderr,"\n  ## Error: %s: remeshing of subdomain %d failed.\n",
+              __func__,p);
+      goto end;
+    }
+    ier = MG_MAX(ier,sd[p].ier);
+  }
+
+  if ( !MMG3D_thr_chkSubdom(mesh,&ifc,sd,npart) ) {
+    fprintf(stderr,"\n  ## Error: %s: interface of a subdomain has been"
+            " modified.\n",__func__);
+    goto end;
+  }
+
+  /* Merge */
+  if ( !MMG3D_thr_merge(mesh,met,&ifc,sd,npart) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to merge the subdomains.\n",__func__);
+    ret = MMG5_STRONGFAILURE;
+    goto end;
+  }
+  ret = ier;
+
+end:
+  if ( sd ) {
+    MMG3D_thr_freeSubdom(mesh,sd,npart);
+    MMG5_DEL_MEM(mesh,sd);
+  }
+  MMG3D_thr_freeIface(mesh,&ifc);
+  if ( ttab.item ) MMG5_DEL_MEM(mesh,ttab.item);
+  if ( tmark )     MMG5_DEL_MEM(mesh,tmark);
+  if ( gl )        MMG5_DEL_MEM(mesh,gl);
+  if ( list )      MMG5_DEL_MEM(mesh,list);
+  if ( head )      MMG5_DEL_MEM(mesh,head);
+  if ( part )      MMG5_DEL_MEM(mesh,part);
+
+  return ret;
+}
+
+int MMG3D_mmg3dlib_threaded(MMG5_pMesh mesh,MMG5_pSol met) {
+  MMG5_pSol sol=NULL; // unused
+  MMG5_Info sinfo;
+  mytime    ctim[TIMEMAX];
+  char      stim[32];
+  double    hmin,hmax;
+  int       npart,ipass,ier;
+
+  /** In debug mode, check that all structures are allocated */
+  assert ( mesh );
+  assert ( met );
+  assert ( mesh->point );
+  assert ( mesh->tetra );
+
+  npart = MMG5_nthreads(mesh,mesh->ne);
+  if ( npart < 2 ) {
+    return MMG3D_mmg3dlib(mesh,met);
+  }
+
+  /* Modes and data not handled by the threaded remeshing (or invalid and
+   * reported by the sequential library) */
+  if ( mesh->info.lag > -1 || mesh->info.iso || mesh->info.isosurf ||
+       mesh->info.opnbdy || mesh->info.nsd || mesh->info.ani ||
+       mesh->nprism || mesh->nquad || met->size != 1 ||
+       (met->np && (met->np != mesh->np || mesh->info.optim || mesh->info.hsiz > 0.)) ||
+       (mesh->info.optim && mesh->info.hsiz > 0.) ) {
+    if ( mesh->info.imprim > 0 ) {
+      fprintf(stdout,"\n  ## Warning: %s: options or data not supported by the"
+              " threaded remeshing. Sequential remeshing.\n",__func__);
+    }
+    return MMG3D_mmg3dlib(mesh,met);
+  }
+
+  MMG5_version(mesh,"3D");
+
+  MMG3D_Set_commonOps(mesh);
+
+  MMG5_warnOrientation(mesh);
+
+  MMG3D_Free_topoTables(mesh);
+
+  signal(SIGABRT,MMG5_excfun);
+  signal(SIGFPE,MMG5_excfun);
+  signal(SIGILL,MMG5_excfun);
+  signal(SIGSEGV,MMG5_excfun);
+  signal(SIGTERM,MMG5_excfun);
+  signal(SIGINT,MMG5_excfun);
+
+  tminit(ctim,TIMEMAX);
+  chrono(ON,&(ctim[0]));
+
+  if ( !MMG5_boundingBox(mesh) ) {
+    _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+  }
+
+  /* Parameters of the sub-meshes: the pointers are not shared and the default
+   * size bounds are computed from the global bounding box */
+  sinfo          = mesh->info;
+  sinfo.imprim   = -1;
+  sinfo.nthreads = 1;
+  sinfo.renum    = 0;
+  sinfo.mem      = mesh->info.mem > 0 ? mesh->info.mem / npart : -1;
+  sinfo.fparam   = NULL;
+  sinfo.br       = NULL;
+  sinfo.nbr      = sinfo.nbri = 0;
+  sinfo.mat      = NULL;
+  sinfo.nmat     = sinfo.nmati = 0;
+  memset(&sinfo.invmat,0,sizeof(MMG5_InvMat));
+  /* The frozen interfaces are artificial: their sizes must not be propagated */
+  sinfo.hgradreq = -1.;
+
+  if ( (!met->np) && (!mesh->info.optim) && mesh->info.hsiz <= 0. ) {
+    hmin = mesh->info.hmin;
+    hmax = mesh->info.hmax;
+    if ( mesh->info.sethmin ) mesh->info.hmin /= mesh->info.delta;
+    if ( mesh->info.sethmax ) mesh->info.hmax /= mesh->info.delta;
+    ier = MMG5_Set_defaultTruncatureSizes(mesh,mesh->info.sethmin,mesh->info.sethmax);
+    sinfo.hmin    = mesh->info.hmin * mesh->info.delta;
+    sinfo.hmax    = mesh->info.hmax * mesh->info.delta;
+    sinfo.sethmin = sinfo.sethmax = 1;
+    mesh->info.hmin = hmin;
+    mesh->info.hmax = hmax;
+    if ( !ier ) {
+      _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+    }
+  }
+
+  ier = MMG5_SUCCESS;
+  for ( ipass=0; ipass<MMG3D_THR_NPASS; ++ipass ) {
+    if ( mesh->info.imprim > 0 ) {
+      fprintf(stdout,"\n  -- PASS %d: REMESHING OF %d SUBDOMAINS\n",ipass+1,npart);
+    }
+
+    chrono(ON,&(ctim[ipass+1]));
+    ier = MMG3D_thr_pass(mesh,met,&sinfo,npart,ipass);
+    chrono(OFF,&(ctim[ipass+1]));
+
+    if ( ier == MMG5_STRONGFAILURE ) {
+      _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
+    }
+    if ( ier != MMG5_SUCCESS ) break;
+
+    if ( mesh->info.imprim > 0 ) {
+      printim(ctim[ipass+1].gdif,stim);
+      fprintf(stdout,"  -- PASS %d COMPLETED.     %s\n",ipass+1,stim);
+      fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId
+              "   NUMBER OF TETRAHEDRA %8" MMG5_PRId "\n",mesh->np,mesh->ne);
+    }
+
+    /* The metric is now available: the next passes use it */
+    sinfo.optim = 0;
+    sinfo.hsiz  = -1.;
+  }
+
+  chrono(OFF,&ctim[0]);
+  printim(ctim[0].gdif,stim);
+  if ( mesh->info.imprim >= 0 ) {
+    fprintf(stdout,"\n   MMG3DLIB: ELAPSED TIME  %s\n",stim);
+    fprintf(stdout,"\n  %s\n   END OF MODULE MMG3D\n  %s\n\n",MG_STR,MG_STR);
+  }
+  _LIBMMG5_RETURN(mesh,met,sol,ier);
+}
+
+/**
+ * \param mesh pointer to the mesh structure (with adjacency).
+ * \param part tetra marks (1 for the tetra of the region).
+ * \param list pointer to the tetra of the region (reallocated if needed).
+ * \param nr pointer to the number of tetra of the region.
+ * \param nrmax pointer to the size of the \a list array.
+ * \param nlayer number of layers of tetra to add to the region.
+ * \param base flag given to the vertices of the region.
+ * \return 1 if success, 0 if fail.
+ *
+ * Add \a nlayer layers of tetra (sharing a vertex with the region) around the
+ * region and flag the vertices of the final region with \a base. Only the
+ * balls of the vertices of the region are travelled.
+ *
+ */
+static int MMG3D_reg_grow(MMG5_pMesh mesh,MMG5_int *part,MMG5_int **list,
+                          MMG5_int *nr,MMG5_int *nrmax,int nlayer,
+                          MMG5_int base) {
+  MMG5_pTetra pt;
+  MMG5_pPoint ppt;
+  int64_t     ball[MMG3D_LMAX+2];
+  MMG5_int    k,kk,n,first,last,nmax;
+  int         l,i,j,ilist;
+
+  first = 0;
+  for ( l=0; l<=nlayer; ++l ) {
+    last = *nr;
+    for ( n=first; n<last; ++n ) {
+      k  = (*list)[n];
+      pt = &mesh->tetra[k];
+      for ( i=0; i<4; ++i ) {
+        ppt = &mesh->point[pt->v[i]];
+        if ( ppt->flag == base ) continue;
+        ppt->flag = base;
+
+        /* Last layer: only flag the vertices */
+        if ( l == nlayer ) continue;
+
+        ilist = MMG5_boulevolp(mesh,k,i,ball);
+        if ( !ilist ) {
+          fprintf(stderr,"\n  ## Error: %s: unable to compute the ball of"
+                  " point %" MMG5_PRId ".\n",__func__,pt->v[i]);
+          return 0;
+        }
+        for ( j=0; j<ilist; ++j ) {
+          kk = ball[j]/4;
+          if ( part[kk] ) continue;
+
+          if ( *nr == *nrmax ) {
+            nmax = *nrmax + MG_MAX(*nrmax/2,MMG3D_LMAX);
+            MMG5_ADD_MEM(mesh,(nmax-*nrmax)*sizeof(MMG5_int),"region",return 0);
+            MMG5_SAFE_RECALLOC(*list,*nrmax,nmax,MMG5_int,"region",return 0);
+            *nrmax = nmax;
+          }
+          part[kk] = 1;
+          (*list)[(*nr)++] = kk;
+        }
+      }
+    }
+    first = last;
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param ifc interface entities.
+ * \param ext outer tetra (4*tetra+face) of each interface face.
+ * \param list tetra of the region.
+ * \param nr number of tetra of the region.
+ * \param tmark triangle marks (negative for the triangles of the region).
+ * \param npr number of points of the region.
+ * \param sd remeshed region.
+ * \return 1 if success, 0 if fail (the mesh is lost).
+ *
+ * Replace the region by the remeshed sub-mesh in place: the entities of the
+ * region are deleted, the new ones reuse their slots and are linked to the
+ * rest of the mesh through the frozen interface faces. The mesh is packed only
+ * if the region has lost tetra or points.
+ *
+ */
+static int MMG3D_reg_merge(MMG5_pMesh mesh,MMG5_pSol met,MMG3D_Iface *ifc,
+                           MMG5_int *ext,MMG5_int *list,MMG5_int nr,
+                           MMG5_int *tmark,MMG5_int npr,MMG3D_Subdom *sd) {
+  MMG5_pMesh  sub;
+  MMG5_pTetra pt,pt1;
+  MMG5_pTria  ptt,ptt1,tria;
+  MMG5_pEdge  pa,pa1,edge;
+  MMG5_pPoint ppt,ppt1;
+  MMG5_int    *loc,*tloc,*l2g,*adja,*adjs,nif,np,nt,na,nc,n,k,kt,iel,ip,v[3];
+  int         i,j,ier;
+
+  sub  = sd->mesh;
+  l2g  = sd->l2g;
+  nif  = sd->nif;
+  loc  = tloc = NULL;
+  tria = NULL;
+  edge = NULL;
+  ier  = 0;
+
+  MMG5_ADD_MEM(mesh,(sub->np+1)*sizeof(MMG5_int),"subdomain points",return 0);
+  MMG5_SAFE_CALLOC(loc,sub->np+1,MMG5_int,return 0);
+  MMG5_ADD_MEM(mesh,(sub->ne+1)*sizeof(MMG5_int),"subdomain tetra",goto end);
+  MMG5_SAFE_CALLOC(tloc,sub->ne+1,MMG5_int,goto end);
+
+  /* Deletion of the region (the xpoint table is not available) */
+  for ( k=0; k<nr; ++k ) {
+    if ( !MMG3D_delElt(mesh,list[k]) ) goto end;
+  }
+  for ( k=nif+1; k<=npr; ++k ) {
+    mesh->point[l2g[k]].xp = 0;
+    MMG3D_delPt(mesh,l2g[k]);
+  }
+
+  /* Boundary entities kept: the triangles that have not been copied in the
+   * sub-mesh and the edges that don't have an inner point */
+  nt = 0;
+  for ( kt=1; kt<=mesh->nt; ++kt ) {
+    if ( tmark[kt] < 0 ) continue;
+    if ( ++nt < kt ) mesh->tria[nt] = mesh->tria[kt];
+  }
+  na = 0;
+  for ( k=1; k<=mesh->na; ++k ) {
+    pa = &mesh->edge[k];
+    if ( !(MG_VOK(&mesh->point[pa->a]) && MG_VOK(&mesh->point[pa->b])) ) continue;
+    if ( ++na < k ) mesh->edge[na] = *pa;
+  }
+
+  /* Points: the interface points are kept, the other ones are created */
+  for ( k=1; k<=sub->np; ++k ) {
+    ppt = &sub->point[k];
+    if ( k <= nif ) {
+      loc[k] = l2g[k];
+      mesh->point[loc[k]].tag |= ppt->tag &
+        ~(MG_PARBDY | MG_PARBDYBDY | MG_NOSURF | MG_REQ | MG_BDY);
+      continue;
+    }
+    ip = MMG3D_newPt(mesh,ppt->c,0,1);
+    if ( !ip ) {
+      MMG3D_POINT_REALLOC(mesh,met,ip,mesh->gap,
+                          fprintf(stderr,"\n  ## Error: %s: unable to allocate"
+                                  " a new point\n",__func__);
+                          MMG5_INCREASE_MEM_MESSAGE();
+                          goto end,
+                          ppt->c,0,1);
+    }
+    ppt1 = &mesh->point[ip];
+    ppt1->ref  = ppt->ref;
+    ppt1->tag  = MMG3D_thr_unsetParTag(ppt->tag);
+    met->m[ip] = sd->met->m[k];
+    loc[k]     = ip;
+  }
+
+  /* Tetra */
+  for ( k=1; k<=sub->ne; ++k ) {
+    pt = &sub->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    iel = MMG3D_newElt(mesh);
+    if ( !iel ) {
+      MMG3D_TETRA_REALLOC(mesh,iel,mesh->gap,
+                          fprintf(stderr,"\n  ## Error: %s: unable to allocate"
+                                  " a new element.\n",__func__);
+                          MMG5_INCREASE_MEM_MESSAGE();
+                          goto end);
+    }
+    pt1 = &mesh->tetra[iel];
+    memset(pt1,0,sizeof(MMG5_Tetra));
+    for ( i=0; i<4; ++i ) pt1->v[i] = loc[pt->v[i]];
+    pt1->ref  = pt->ref;
+    pt1->tag  = MMG3D_thr_unsetParTag(pt->tag);
+    pt1->qual = pt->qual;
+    pt1->mark = mesh->mark;
+    tloc[k]   = iel;
+  }
+
+  /* Adjacency: inside the region from the sub-mesh, through the interface
+   * from the outer tetra of the interface faces */
+  for ( k=1; k<=sub->ne; ++k ) {
+    if ( !tloc[k] ) continue;
+
+    pt   = &sub->tetra[k];
+    iel  = tloc[k];
+    adja = &mesh->adja[4*(iel-1)+1];
+    adjs = &sub->adja[4*(k-1)+1];
+    for ( i=0; i<4; ++i ) {
+      adja[i] = 0;
+      if ( adjs[i] ) {
+        adja[i] = 4*tloc[adjs[i]/4] + adjs[i]%4;
+        continue;
+      }
+      for ( j=0; j<3; ++j ) v[j] = pt->v[MMG5_idir[i][j]];
+      if ( v[0] > nif || v[1] > nif || v[2] > nif ) continue;
+
+      kt = MMG5_hashGetFace(&ifc->fhash,l2g[v[0]],l2g[v[1]],l2g[v[2]]);
+      if ( !kt ) continue;
+
+      adja[i] = ext[kt];
+      mesh->adja[4*(ext[kt]/4-1)+1+ext[kt]%4] = 4*iel + i;
+    }
+  }
+
+  /* Triangles: the interface faces are kept in the mesh */
+  n = nt;
+  for ( k=1; k<=sub->nt; ++k ) {
+    ptt = &sub->tria[k];
+    if ( !MG_EOK(ptt) ) continue;
+    if ( ptt->v[0] <= nif && ptt->v[1] <= nif && ptt->v[2] <= nif &&
+         MMG5_hashGetFace(&ifc->fhash,l2g[ptt->v[0]],l2g[ptt->v[1]],
+                          l2g[ptt->v[2]]) ) continue;
+    ++n;
+  }
+  if ( n ) {
+    MMG5_ADD_MEM(mesh,(n+1)*sizeof(MMG5_Tria),"triangles",goto end);
+    MMG5_SAFE_CALLOC(tria,n+1,MMG5_Tria,goto end);
+    if ( nt ) memcpy(&tria[1],&mesh->tria[1],nt*sizeof(MMG5_Tria));
+  }
+  for ( k=1; k<=sub->nt; ++k ) {
+    ptt = &sub->tria[k];
+    if ( !MG_EOK(ptt) ) continue;
+    if ( ptt->v[0] <= nif && ptt->v[1] <= nif && ptt->v[2] <= nif &&
+         MMG5_hashGetFace(&ifc->fhash,l2g[ptt->v[0]],l2g[ptt->v[1]],
+                          l2g[ptt->v[2]]) ) continue;
+
+    ptt1  = &tria[++nt];
+    *ptt1 = *ptt;
+    for ( i=0; i<3; ++i ) {
+      ptt1->v[i]   = loc[ptt->v[i]];
+      ptt1->tag[i] = MMG3D_thr_unsetParTag(ptt->tag[i]);
+      mesh->point[ptt1->v[i]].tag |= MG_BDY;
+    }
+  }
+  if ( mesh->tria ) MMG5_DEL_MEM(mesh,mesh->tria);
+  mesh->tria = tria;
+  mesh->nt   = mesh->nti = nt;
+  tria       = NULL;
+
+  /* Edges: the edges between interface points are kept in the mesh */
+  n = na;
+  for ( k=1; k<=sub->na; ++k ) {
+    pa = &sub->edge[k];
+    if ( pa->a && (pa->a > nif || pa->b > nif) ) ++n;
+  }
+  if ( n ) {
+    MMG5_ADD_MEM(mesh,(n+1)*sizeof(MMG5_Edge),"edges",goto end);
+    MMG5_SAFE_CALLOC(edge,n+1,MMG5_Edge,goto end);
+    if ( na ) memcpy(&edge[1],&mesh->edge[1],na*sizeof(MMG5_Edge));
+  }
+  for ( k=1; k<=sub->na; ++k ) {
+    pa = &sub->edge[k];
+    if ( !(pa->a && (pa->a > nif || pa->b > nif)) ) continue;
+
+    pa1  = &edge[++na];
+    *pa1 = *pa;
+    pa1->a   = loc[pa->a];
+    pa1->b   = loc[pa->b];
+    pa1->tag = MMG3D_thr_unsetParTag(pa->tag);
+  }
+  if ( mesh->edge ) MMG5_DEL_MEM(mesh,mesh->edge);
+  mesh->edge = edge;
+  mesh->na   = mesh->nai = na;
+  edge       = NULL;
+
+  /* Pack the mesh if the region has been coarsened */
+  if ( sub->ne < nr ) {
+    if ( !MMG3D_pack_tetraAndAdja(mesh) ) goto end;
+  }
+  if ( sub->np < npr ) {
+    if ( !MMG3D_pack_sol(mesh,met) ) goto end;
+    if ( !MMG3D_mark_packedPoints(mesh,&np,&nc) ) goto end;
+    if ( !MMG3D_update_eltsVertices(mesh) ) goto end;
+    for ( k=1; k<=mesh->nt; ++k ) {
+      ptt = &mesh->tria[k];
+      for ( i=0; i<3; ++i ) ptt->v[i] = mesh->point[ptt->v[i]].tmp;
+    }
+    for ( k=1; k<=mesh->na; ++k ) {
+      pa    = &mesh->edge[k];
+      pa->a = mesh->point[pa->a].tmp;
+      pa->b = mesh->point[pa->b].tmp;
+    }
+    if ( !MMG3D_pack_pointArray(mesh) ) goto end;
+  }
+  met->np = met->npi = mesh->np;
+
+  ier = 1;
+
+end:
+  if ( edge ) MMG5_DEL_MEM(mesh,edge);
+  if ( tria ) MMG5_DEL_MEM(mesh,tria);
+  if ( tloc ) MMG5_DEL_MEM(mesh,tloc);
+  MMG5_DEL_MEM(mesh,loc);
+
+  return ier;
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the metric structure.
+ * \param sinfo parameters of the sub-mesh.
+ * \param seed tetra of the region.
+ * \param nseed number of tetra in \a seed.
+ * \param nlayer number of layers of tetra added around the region.
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but the
+ * mesh is unchanged, \ref MMG5_STRONGFAILURE if fail and the mesh is lost.
+ *
+ * Remesh a region of the mesh: the region is copied into a sub-mesh whose
+ * boundary faces inside the mesh are frozen, the sub-mesh is remeshed by
+ * \ref MMG3D_mmg3dlib_int and merged back in place.
+ *
+ */
+static int MMG3D_reg_pass(MMG5_pMesh mesh,MMG5_pSol met,MMG5_Info *sinfo,
+                          MMG5_int *seed,MMG5_int nseed,int nlayer) {
+  MMG5_pTetra  pt;
+  MMG5_pTria   ptt;
+  MMG3D_Subdom sd;
+  MMG3D_Iface  ifc;
+  MMG5_Hash    ttab;
+  MMG5_int     *part,*list,*gl,*tmark,*ext,*adja,nr,nrmax,npr,base,k,kk,kt,n;
+  int          i,ret;
+
+  ret  = MMG5_LOWFAILURE;
+  part = list = gl = tmark = ext = NULL;
+  memset(&sd,0,sizeof(MMG3D_Subdom));
+  memset(&ifc,0,sizeof(MMG3D_Iface));
+  memset(&ttab,0,sizeof(MMG5_Hash));
+
+  if ( !mesh->adja && !MMG3D_hashTetra(mesh,0) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to build the adjacency.\n",__func__);
+    return MMG5_LOWFAILURE;
+  }
+
+  /* Region: input tetra and layers around them */
+  MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(MMG5_int),"region",goto end);
+  MMG5_SAFE_CALLOC(part,mesh->ne+1,MMG5_int,goto end);
+  nrmax = nseed;
+  MMG5_ADD_MEM(mesh,nrmax*sizeof(MMG5_int),"region",goto end);
+  MMG5_SAFE_CALLOC(list,nrmax,MMG5_int,goto end);
+
+  nr = 0;
+  for ( n=0; n<nseed; ++n ) {
+    k = seed[n];
+    if ( k < 1 || k > mesh->ne || !MG_EOK(&mesh->tetra[k]) ) {
+      fprintf(stderr,"\n  ## Error: %s: invalid tetrahedron %" MMG5_PRId
+              " in the region.\n",__func__,k);
+      goto end;
+    }
+    if ( part[k] ) continue;
+    part[k]    = 1;
+    list[nr++] = k;
+  }
+
+  base = ++mesh->base;
+  if ( !MMG3D_reg_grow(mesh,part,&list,&nr,&nrmax,nlayer,base) ) goto end;
+
+  /* Boundary triangles of the region */
+  n = 0;
+  for ( k=1; k<=mesh->nt; ++k ) {
+    ptt = &mesh->tria[k];
+    if ( mesh->point[ptt->v[0]].flag == base &&
+         mesh->point[ptt->v[1]].flag == base &&
+         mesh->point[ptt->v[2]].flag == base ) ++n;
+  }
+  if ( n ) {
+    if ( !MMG5_hashNew(mesh,&ttab,n,3*n) ) goto end;
+    for ( k=1; k<=mesh->nt; ++k ) {
+      ptt = &mesh->tria[k];
+      if ( mesh->point[ptt->v[0]].flag != base ||
+           mesh->point[ptt->v[1]].flag != base ||
+           mesh->point[ptt->v[2]].flag != base ) continue;
+      if ( !MMG5_hashFace(mesh,&ttab,ptt->v[0],ptt->v[1],ptt->v[2],k) ) goto end;
+    }
+  }
+
+  /* Interface faces and the outer tetra through them */
+  if ( !MMG3D_thr_setIface(mesh,met,part,list,nr,&ttab,&ifc) ) goto end;
+
+  MMG5_ADD_MEM(mesh,(ifc.nf+1)*sizeof(MMG5_int),"interface faces",goto end);
+  MMG5_SAFE_CALLOC(ext,ifc.nf+1,MMG5_int,goto end);
+  for ( n=0; n<nr; ++n ) {
+    k    = list[n];
+    pt   = &mesh->tetra[k];
+    adja = &mesh->adja[4*(k-1)+1];
+    for ( i=0; i<4; ++i ) {
+      kk = adja[i]/4;
+      if ( (!kk) || part[kk] ) continue;
+
+      kt = MMG5_hashGetFace(&ifc.fhash,pt->v[MMG5_idir[i][0]],
+                            pt->v[MMG5_idir[i][1]],pt->v[MMG5_idir[i][2]]);
+      assert ( kt );
+      ext[kt] = adja[i];
+    }
+  }
+
+  /* Sub-mesh */
+  MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(MMG5_int),"local numbering",goto end);
+  MMG5_SAFE_CALLOC(gl,mesh->np+1,MMG5_int,goto end);
+  MMG5_ADD_MEM(mesh,(mesh->nt+1)*sizeof(MMG5_int),"triangle marks",goto end);
+  MMG5_SAFE_CALLOC(tmark,mesh->nt+1,MMG5_int,goto end);
+
+  if ( !MMG3D_thr_extract(mesh,met,sinfo,part,list,nr,1,&ttab,&ifc,gl,tmark,&sd) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to build the region.\n",__func__);
+    goto end;
+  }
+  npr = sd.mesh->np;
+  for ( k=1; k<=npr; ++k ) mesh->point[sd.l2g[k]].flag = 0;
+
+  MMG5_DEL_MEM(mesh,gl);
+  MMG5_DEL_MEM(mesh,part);
+  if ( ttab.item ) MMG5_DEL_MEM(mesh,ttab.item);
+
+  if ( mesh->info.imprim > 0 ) {
+    fprintf(stdout,"     REGION: %8" MMG5_PRId " TETRAHEDRA   %8" MMG5_PRId
+            " INTERFACE FACES\n",nr,ifc.nf);
+  }
+
+  /* Remeshing */
+  sd.ier = MMG3D_mmg3dlib_int(sd.mesh,sd.met);
+  if ( sd.ier == MMG5_STRONGFAILURE ) {
+    fprintf(stderr,"\n  ## Error: %s: remeshing of the region failed.\n",
+            __func__);
+    goto end;
+  }
+  if ( !sd.mesh->adja && !MMG3D_hashTetra(sd.mesh,0) ) goto end;
+
+  /* The tolerance on the interface points is computed from the region size */
+  if ( !MMG3D_thr_chkSubdom(sd.mesh,&ifc,&sd,1) ) {
+    fprintf(stderr,"\n  ## Error: %s: interface of the region has been"
+            " modified.\n",__func__);
+    goto end;
+  }
+
+  /* Merge */
+  if ( !MMG3D_reg_merge(mesh,met,&ifc,ext,list,nr,tmark,npr,&sd) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to merge the region.\n",__func__);
+    ret = MMG5_STRONGFAILURE;
+    goto end;
+  }
+  ret = sd.ier;
+
+end:
+  MMG3D_thr_freeSubdom(mesh,&sd,1);
+  MMG3D_thr_freeIface(mesh,&ifc);
+  if ( ttab.item ) MMG5_DEL_MEM(mesh,ttab.item);
+  if ( ext )       MMG5_DEL_MEM(mesh,ext);
+  if ( tmark )     MMG5_DEL_MEM(mesh,tmark);
+  if ( gl )        MMG5_DEL_MEM(mesh,gl);
+  if ( list )      MMG5_DEL_MEM(mesh,list);
+  if ( part )      MMG5_DEL_MEM(mesh,part);
+
+  return ret;
+}
+
+int MMG3D_mmg3dlib_region(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,
+                          MMG5_int nlist,int nlayer) {
+  MMG5_pSol sol=NULL; // unused
+  MMG5_Info sinfo;
+  mytime    ctim[TIMEMAX];
+  char      stim[32];
+  int       ier;
+
+  /** In debug mode, check that all structures are allocated */
+  assert ( mesh );
+  assert ( met );
+  assert ( mesh->point );
+  assert ( mesh->tetra );
+
+  /* Modes and data not handled by the region remeshing: the metric of the
+   * whole mesh is needed */
+  if ( mesh->info.lag > -1 || mesh->info.iso || mesh->info.isosurf ||
+       mesh->info.opnbdy || mesh->info.nsd || mesh->info.ani ||
+       mesh->info.optim || mesh->info.hsiz > 0. ||
+       mesh->nprism || mesh->nquad || met->size != 1 ||
+       (!met->m) || met->np != mesh->np ) {
+    fprintf(stderr,"\n  ## Error: %s: options or data not supported by the"
+            " region remeshing (a scalar metric at the vertices is needed)."
+            "\n",__func__);
+    return MMG5_LOWFAILURE;
+  }
+  if ( nlist < 1 ) return MMG5_SUCCESS;
+
+  MMG5_version(mesh,"3D");
+
+  MMG3D_Set_commonOps(mesh);
+
+  signal(SIGABRT,MMG5_excfun);
+  signal(SIGFPE,MMG5_excfun);
+  signal(SIGILL,MMG5_excfun);
+  signal(SIGSEGV,MMG5_excfun);
+  signal(SIGTERM,MMG5_excfun);
+  signal(SIGINT,MMG5_excfun);
+
+  tminit(ctim,TIMEMAX);
+  chrono(ON,&(ctim[0]));
+
+  if ( mesh->info.imprim > 0 ) {
+    fprintf(stdout,"\n  -- MMG3DLIB: REGION REMESHING\n");
+  }
+
+  /* The boundary entities of a previous call can't be updated: they are
+   * rebuilt by the next call */
+  if ( mesh->xtetra ) MMG5_DEL_MEM(mesh,mesh->xtetra);
+  if ( mesh->xpoint ) MMG5_DEL_MEM(mesh,mesh->xpoint);
+  mesh->xt = mesh->xp = 0;
+
+  /* Parameters of the sub-mesh: the pointers are not shared */
+  sinfo          = mesh->info;
+  sinfo.imprim   = -1;
+  sinfo.renum    = 0;
+  sinfo.fparam   = NULL;
+  sinfo.br       = NULL;
+  sinfo.nbr      = sinfo.nbri = 0;
+  sinfo.mat      = NULL;
+  sinfo.nmat     = sinfo.nmati = 0;
+  memset(&sinfo.invmat,0,sizeof(MMG5_InvMat));
+  /* The frozen interface is artificial: its sizes must not be propagated */
+  sinfo.hgradreq = -1.;
+
+  ier = MMG3D_reg_pass(mesh,met,&sinfo,list,nlist,MG_MAX(nlayer,0));
+
+  chrono(OFF,&ctim[0]);
+  printim(ctim[0].gdif,stim);
+  if ( mesh->info.imprim > 0 && ier != MMG5_STRONGFAILURE ) {
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId
+            "   NUMBER OF TETRAHEDRA %8" MMG5_PRId "\n",mesh->np,mesh->ne);
+  }
+  if ( mesh->info.imprim >= 0 ) {
+    fprintf(stdout,"\n   MMG3DLIB: ELAPSED TIME  %s\n",stim);
+    fprintf(stdout,"\n  %s\n   END OF MODULE MMG3D\n  %s\n\n",MG_STR,MG_STR);
+  }
+  _LIBMMG5_RETURN(mesh,met,sol,ier);
+}
+
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param min lower corner of the box (NULL for a ball).
+ * \param max upper corner of the box.
+ * \param c center of the ball (NULL for a box).
+ * \param r radius of the ball.
+ * \param list pointer to the list of the selected tetra (to allocate).
+ * \param nlist pointer to the number of selected tetra.
+ * \return 1 if success, 0 if fail.
+ *
+ * Select the tetra whose barycenter is inside a box or a ball.
+ *
+ */
+static int MMG3D_reg_select(MMG5_pMesh mesh,double *min,double *max,
+                            double *c,double r,MMG5_int **list,
+                            MMG5_int *nlist) {
+  MMG5_pTetra pt;
+  double      b[3],d;
+  MMG5_int    k;
+  int         i,j,ipass;
+
+  *list = NULL;
+  for ( ipass=0; ipass<2; ++ipass ) {
+    *nlist = 0;
+    for ( k=1; k<=mesh->ne; ++k ) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) ) continue;
+
+      for ( j=0; j<3; ++j ) {
+        b[j] = 0.;
+        for ( i=0; i<4; ++i ) b[j] += mesh->point[pt->v[i]].c[j];
+        b[j] *= 0.25;
+      }
+      if ( min ) {
+        if ( b[0] < min[0] || b[0] > max[0] ||
+             b[1] < min[1] || b[1] > max[1] ||
+             b[2] < min[2] || b[2] > max[2] ) continue;
+      }
+      else {
+        d = (b[0]-c[0])*(b[0]-c[0]) + (b[1]-c[1])*(b[1]-c[1])
+          + (b[2]-c[2])*(b[2]-c[2]);
+        if ( d > r*r ) continue;
+      }
+      if ( ipass ) (*list)[*nlist] = k;
+      ++(*nlist);
+    }
+    if ( (!ipass) && *nlist ) {
+      MMG5_ADD_MEM(mesh,(*nlist)*sizeof(MMG5_int),"region",return 0);
+      MMG5_SAFE_MALLOC(*list,*nlist,MMG5_int,return 0);
+    }
+    else if ( !ipass ) break;
+  }
+  return 1;
+}
+
+int MMG3D_mmg3dlib_box(MMG5_pMesh mesh,MMG5_pSol met,double min[3],
+                       double max[3],int nlayer) {
+  MMG5_int *list,nlist;
+  int      ier;
+
+  if ( !MMG3D_reg_select(mesh,min,max,NULL,0.,&list,&nlist) ) {
+    return MMG5_LOWFAILURE;
+  }
+  ier = MMG3D_mmg3dlib_region(mesh,met,list,nlist,nlayer);
+  if ( list ) MMG5_DEL_MEM(mesh,list);
+
+  return ier;
+}
+
+int MMG3D_mmg3dlib_ball(MMG5_pMesh mesh,MMG5_pSol met,double c[3],double r,
+                        int nlayer) {
+  MMG5_int *list,nlist;
+  int      ier;
+
+  if ( !MMG3D_reg_select(mesh,NULL,NULL,c,r,&list,&nlist) ) {
+    return MMG5_LOWFAILURE;
+  }
+  ier = MMG3D_mmg3dlib_region(mesh,met,list,nlist,nlayer);
+  if ( list ) MMG5_DEL_MEM(mesh,list);
+
+  return ier;
+}
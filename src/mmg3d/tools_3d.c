@@ -1153,7 +1153,7 @@ int MMG3D_localParamNm(MMG5_pMesh mesh,MMG5_int iel,int iface,int ia,
   int           ilistv;
   int64_t       listv[MMG3D_LMAX+2];
   MMG5_int      ifac1,ifac2;
-  static int8_t mmgWarn0;
+  static MMG5_THREADLOCAL int8_t mmgWarn0;
 
 
   hausd = mesh->info.hausd;
@@ -58,8 +58,12 @@ int MMG3D_Alloc_mesh(MMG5_pMesh *mesh, MMG5_pSol *met, MMG5_pSol *ls, MMG5_pSol
   ) {
 
   /* mesh allocation */
-  if ( *mesh )  MMG5_SAFE_FREE(*mesh);
+  if ( *mesh ) {
+    MMG5_SAFE_FREE((*mesh)->ops);
+    MMG5_SAFE_FREE(*mesh);
+  }
   MMG5_SAFE_CALLOC(*mesh,1,MMG5_Mesh,return 0);
+  MMG5_SAFE_CALLOC((*mesh)->ops,1,MMG5_Ops,MMG5_SAFE_FREE(*mesh);return 0);
 
   /* metric allocation */
   if ( met ) {
@@ -97,7 +101,7 @@ static inline
 void MMG3D_Init_woalloc_mesh(MMG5_pMesh mesh, MMG5_pSol *met,MMG5_pSol *ls, MMG5_pSol *disp
   ) {
 
-  MMG3D_Set_commonFunc();
+  MMG3D_Set_commonOps(mesh);
 
   (mesh)->dim   = 3;
   (mesh)->ver   = 2;
@@ -343,6 +347,7 @@ int MMG3D_Free_all_var(va_list argptr)
     MMG5_DEL_MEM(*mesh,*sols);
   }
 
+  MMG5_SAFE_FREE((*mesh)->ops);
   MMG5_SAFE_FREE(*mesh);
 
   return 1;
@@ -1450,6 +1450,23 @@ int MMGS_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, MMG5_int val
   case MMGS_IPARAM_anisosize :
     mesh->info.ani = val;
     break;
+  case MMGS_IPARAM_threads :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of threads must be positive"
+              " (0 to use the OpenMP default).\n",__func__);
+      return 0;
+    }
+#ifdef USE_OPENMP
+    mesh->info.nthreads = val;
+#else
+    if ( val > 1 ) {
+      fprintf(stderr,"\n  ## Warning: %s: multithreading unavailable:"
+              " set the USE_OPENMP CMake's flag to ON when compiling the mmgs"
+              " library to enable this feature.\n",__func__);
+    }
+    mesh->info.nthreads = 1;
+#endif
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
@@ -1502,6 +1519,9 @@ int MMGS_Get_iparameter(MMG5_pMesh mesh, MMG5_int iparam) {
     return  mesh->info.renum;
     break;
 #endif
+  case MMGS_IPARAM_threads :
+    return  mesh->info.nthreads;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
@@ -1581,6 +1601,22 @@ int MMGS_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val){
       mesh->info.rmc      = val;
     }
     break;
+  case MMGS_DPARAM_timeBudget :
+    if ( val < 0.0 ) {
+      fprintf(stderr,"\n  ## Error: %s: time budget must be positive"
+              " (0 for no limit).\n",__func__);
+      return 0;
+    }
+    mesh->info.tbudget  = val;
+    break;
+  case MMGS_DPARAM_convergence :
+    if ( val < 0.0 || val >= 1.0 ) {
+      fprintf(stderr,"\n  ## Error: %s: convergence threshold must be comprised"
+              " between 0 and 1.\n",__func__);
+      return 0;
+    }
+    mesh->info.conv     = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
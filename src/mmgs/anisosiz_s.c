@@ -758,8 +758,8 @@ int MMGS_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   else {
     ismet = 0;
 
-    MMG5_calelt     = MMG5_caltri_ani;
-    MMG5_lenSurfEdg = MMG5_lenSurfEdg_ani;
+    mesh->ops->caltri     = MMG5_caltri_ani;
+    mesh->ops->lenSurfEdg = MMG5_lenSurfEdg_ani;
 
     if ( !MMGS_Set_solSize(mesh,met,MMG5_Vertex,mesh->np,3) )
       return 0;
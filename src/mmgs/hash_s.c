@@ -120,14 +120,7 @@ int MMGS_assignEdge(MMG5_pMesh mesh) {
   if ( !mesh->na ) return 1;
 
   /* adjust hash table params */
-  hash.siz  = mesh->na;
-  hash.max  = 3*mesh->na+1;
-  MMG5_ADD_MEM(mesh,(hash.max+1)*sizeof(MMG5_hedge),"hash table",return 0);
-  MMG5_SAFE_CALLOC(hash.item,hash.max+1,MMG5_hedge,return 0);
-
-  hash.nxt  = mesh->na;
-  for (k=mesh->na; k<hash.max; k++)
-    hash.item[k].nxt = k+1;
+  if ( !MMG5_hashNew(mesh,&hash,mesh->na,3*mesh->na) ) return 0;
 
   /* hash mesh edges */
   for (k=1; k<=mesh->na; k++)
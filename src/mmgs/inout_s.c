@@ -42,6 +42,9 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   FILE        *inm;
   MMG5_pTria  pt1,pt2;
   MMG5_pPoint ppt;
+  MMG5_MeshbMap mb;
+  MMG5_TxtBuf tb;
+  const char  *cur;
   double      *norm,*n,dd;
   float       fc;
   long        posnp,posnt,posne,posncor,posnq,posned,posnr;
@@ -52,7 +55,7 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   int         binch,bin,iswp,bdim;
   MMG5_int    na;
   char        *ptr,*data;
-  char        chaine[MMG5_FILESTR_LGTH],strskip[MMG5_FILESTR_LGTH];
+  char        chaine[MMG5_FILESTR_LGTH];
 
   posnp = posnt = posne = posncor = posnq = 0;
   posned = posnr = posnpreq = posntreq = posnc1 = npreq = 0;
@@ -64,6 +67,9 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   mesh->np = mesh->nt = mesh->nti = mesh->npi = 0;
 
   nref = 0;
+  mb.buf = NULL;
+  tb.buf = NULL;
+  cur = NULL;
 
   MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,return -1);
 
@@ -72,12 +78,12 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if ( !ptr ) {
     /* data contains the filename without extension */
     strcat(data,".meshb");
-    if( !(inm = fopen(data,"rb")) ) {
+    if( !(inm = MMG5_fopen(data,"rb")) ) {
       /* our file is not a .meshb file, try with .mesh ext */
       ptr = strstr(data,".mesh");
       *ptr = '\0';
       strcat(data,".mesh");
-      if( !(inm = fopen(data,"rb")) ) {
+      if( !(inm = MMG5_fopen(data,"rb")) ) {
         MMG5_SAFE_FREE(data);
         return 0;
       }
@@ -87,7 +93,7 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   else {
     ptr = strstr(data,".meshb");
     if ( ptr )  bin = 1;
-    if( !(inm = fopen(data,"rb")) ) {
+    if( !(inm = MMG5_fopen(data,"rb")) ) {
       MMG5_SAFE_FREE(data);
       return 0;
     }
@@ -98,73 +104,105 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   MMG5_SAFE_FREE(data);
 
   if (!bin) {
+    if ( !MMG5_txtInit(mesh,inm,&tb) ) return -1;
     strcpy(chaine,"D");
-    while(fscanf(inm,"%127s",&chaine[0])!=EOF && strncmp(chaine,"End",strlen("End")) ) {
+    while(MMG5_txtKeyword(&tb,chaine,MMG5_FILESTR_LGTH) && strncmp(chaine,"End",strlen("End")) ) {
       if ( chaine[0] == '#' ) {
-        while(1){           // skip until end of line or file
-          char *s = fgets(strskip,MMG5_FILESTR_LGTH,inm);
-          if(!s) break;     // nothing could be read
-          if(s[strlen(s)-1]=='\n') break;   // end of line
-        }
+        // skip until end of line or file
+        MMG5_txtSkipLine(&tb);
         continue;
       }
       if(!strncmp(chaine,"MeshVersionFormatted",strlen("MeshVersionFormatted"))) {
-        MMG_FSCANF(inm,"%d",&mesh->ver);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&mesh->ver));
         continue;
       } else if(!strncmp(chaine,"Dimension",strlen("Dimension"))) {
-        MMG_FSCANF(inm,"%d",&mesh->dim);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&mesh->dim));
         if(mesh->dim!=3) {
           fprintf(stderr,"BAD DIMENSION : %d\n",mesh->dim);
+          MMG5_txtFree(&tb);
           return -1;
         }
         continue;
       } else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->npi);
-        posnp = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->npi));
+        posnp = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&npreq);
-        posnpreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&npreq));
+        posnpreq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nti);
-        posnt = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nti));
+        posnt = MMG5_txtTell(&tb);
         continue;
       }
       else if(!strncmp(chaine,"RequiredTriangles",strlen("RequiredTriangles"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ntreq);
-        posntreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ntreq));
+        posntreq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nq);
-        posnq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nq));
+        posnq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ncor);
-        posncor = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ncor));
+        posncor = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->na);
-        posned = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->na));
+        posned = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nedreq);
-        posnedreq = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nedreq));
+        posnedreq = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"Ridges",strlen("Ridges"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&nri);
-        posnr = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&nri));
+        posnr = MMG5_txtTell(&tb);
         continue;
       } else if(!ng && !strncmp(chaine,"Normals",strlen("Normals"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ng);
-        posnormal = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ng));
+        posnormal = MMG5_txtTell(&tb);
         continue;
       } else if(!strncmp(chaine,"NormalAtVertices",strlen("NormalAtVertices"))) {
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&mesh->nc1);
-        posnc1 = ftell(inm);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->nc1));
+        posnc1 = MMG5_txtTell(&tb);
         continue;
       }
     }
+  } else if ( MMG5_mapMeshb(inm,&mb) ) {
+    /* binary file mapped in memory: sections are located from the keyword
+     * table */
+    iswp      = mb.iswp;
+    mesh->ver = mb.ver;
+    if ( mb.dim ) {
+      mesh->dim = mb.dim;
+      if(mesh->dim!=3) {
+        fprintf(stderr,"BAD MESH DIMENSION : %d\n",mesh->dim);
+        MMG5_unmapMeshb(&mb);
+        return -1;
+      }
+    }
+    mesh->npi = mb.num[4];  posnp     = mb.pos[4];  //Vertices
+    npreq     = mb.num[15]; posnpreq  = mb.pos[15]; //RequiredVertices
+    mesh->nti = mb.num[6];  posnt     = mb.pos[6];  //Triangles
+    ntreq     = mb.num[17]; posntreq  = mb.pos[17]; //RequiredTriangles
+    nq        = mb.num[7];  posnq     = mb.pos[7];  //Quadrilaterals
+    ncor      = mb.num[13]; posncor   = mb.pos[13]; //Corners
+    mesh->na  = mb.num[5];  posned    = mb.pos[5];  //Edges
+    nedreq    = mb.num[16]; posnedreq = mb.pos[16]; //RequiredEdges
+    nri       = mb.num[14]; posnr     = mb.pos[14]; //Ridges
+    ng        = mb.num[60]; posnormal = mb.pos[60]; //Normals
+    mesh->nc1 = mb.num[20]; posnc1    = mb.pos[20]; //NormalAtVertices
+
+    if ( !(MMG5_mapFits(&mb,posnp,mesh->npi,1,3) &&
+           MMG5_mapFits(&mb,posnt,mesh->nti,4,0) &&
+           MMG5_mapFits(&mb,posnq,nq,5,0)        &&
+           MMG5_mapFits(&mb,posned,mesh->na,3,0)) ) {
+      fputs ( "Reading error", stderr );
+      MMG5_unmapMeshb(&mb);
+      return -1;
+    }
   } else { //binary file
     bdim = 0;
     MMG_FREAD(&mesh->ver,MMG5_SW,1,inm);
@@ -300,48 +338,53 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
 
   if ( !mesh->npi || !mesh->nti ) {
     fprintf(stdout,"  ** MISSING DATA\n");
+    MMG5_unmapMeshb(&mb);
+    MMG5_txtFree(&tb);
     return -1;
   }
   mesh->np = mesh->npi;
   mesh->nt = mesh->nti + 2*nq;
 
   /* mem alloc */
-  if ( !MMGS_zaldy(mesh) )  return -1;
+  if ( !MMGS_zaldy(mesh) ) {
+    MMG5_unmapMeshb(&mb);
+    MMG5_txtFree(&tb);
+    return -1;
+  }
 
   /* read vertices */
 
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  if ( tb.buf ) {
+    MMG5_txtSeek(&tb,posnp);
+    MMG5_TXT_READ(&tb,MMG5_txtRecords(mesh,&tb,mesh->np,4,MMG5_txtPoint,mesh));
+  }
+  if ( mb.buf ) cur = mb.buf + posnp;
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
-        for (i=0 ; i<3 ; i++) {
-          MMG_FSCANF(inm,"%f",&fc);
-          ppt->c[i] = (double) fc;
-        }
-        MMG_FSCANF(inm,"%" MMG5_PRId "",&ppt->ref);
-      } else {
+    if ( mb.buf ) {
+      for (i=0 ; i<3 ; i++) {
+        ppt->c[i] = MMG5_mapReal(&mb,&cur);
+      }
+      ppt->ref = MMG5_mapInt(&mb,&cur);
+    }
+    else if ( bin ) {
+      if (mesh->ver < 2) { /*float*/
         for (i=0 ; i<3 ; i++) {
           MMG_FREAD(&fc,MMG5_SW,1,inm);
           if(iswp) fc=MMG5_swapf(fc);
           ppt->c[i] = (double) fc;
         }
-        MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
-        if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
-      }
-    } else {
-      if (!bin) {
-        MMG_FSCANF(inm,"%lf %lf %lf %" MMG5_PRId "",&ppt->c[0],&ppt->c[1],&ppt->c[2],&ppt->ref);
       }
       else {
         for (i=0 ; i<3 ; i++) {
           MMG_FREAD(&ppt->c[i],MMG5_SD,1,inm);
           if(iswp) ppt->c[i]=MMG5_swapd(ppt->c[i]);
         }
-        MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
-        if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
       }
+      MMG_FREAD(&ppt->ref,MMG5_SW,1,inm);
+      if(iswp) ppt->ref=MMG5_swapbin(ppt->ref);
     }
     if ( ppt->ref < 0 ) {
       ppt->ref = -ppt->ref;
@@ -354,12 +397,20 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if ( mesh->nti ) {
     rewind(inm);
     fseek(inm,posnt,SEEK_SET);
+    if ( tb.buf ) {
+      MMG5_txtSeek(&tb,posnt);
+      MMG5_TXT_READ(&tb,MMG5_txtRecords(mesh,&tb,mesh->nti,4,MMG5_txtTria,mesh));
+    }
+    if ( mb.buf ) cur = mb.buf + posnt;
     for (k=1; k<=mesh->nti; k++) {
       pt1 = &mesh->tria[k];
-      if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
+      if ( mb.buf ) {
+        for (i=0 ; i<3 ; i++) {
+          pt1->v[i] = MMG5_mapInt(&mb,&cur);
+        }
+        pt1->ref = MMG5_mapInt(&mb,&cur);
       }
-      else {
+      else if ( bin ) {
         for (i=0 ; i<3 ; i++) {
           MMG_FREAD(&pt1->v[i],MMG5_SW,1,inm);
           if(iswp) pt1->v[i]=MMG5_swapbin(pt1->v[i]);
@@ -376,9 +427,10 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     if(ntreq) {
       rewind(inm);
       fseek(inm,posntreq,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posntreq);
       for (k=1; k<=ntreq; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%d",&i);
+          MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
         }
         else {
           MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -401,6 +453,8 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if ( nq > 0 ) {
     rewind(inm);
     fseek(inm,posnq,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnq);
+    if ( mb.buf ) cur = mb.buf + posnq;
 
     printf("  ## Warning: %s: quadrangles automatically converted into"
            " triangles\n.",__func__);
@@ -412,7 +466,16 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
       pt2 = &mesh->tria[mesh->nti];
 
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt2->v[2],&pt1->ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&pt1->v[0]) && MMG5_txtInt(&tb,&pt1->v[1]) &&
+                          MMG5_txtInt(&tb,&pt1->v[2]) && MMG5_txtInt(&tb,&pt2->v[2]) &&
+                          MMG5_txtInt(&tb,&pt1->ref));
+      }
+      else if ( mb.buf ) {
+        for (i=0 ; i<3 ; i++) {
+          pt1->v[i] = MMG5_mapInt(&mb,&cur);
+        }
+        pt2->v[2] = MMG5_mapInt(&mb,&cur);
+        pt1->ref  = MMG5_mapInt(&mb,&cur);
       }
       else {
         for (i=0 ; i<3 ; i++) {
@@ -445,9 +508,10 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if(ncor) {
     rewind(inm);
     fseek(inm,posncor,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posncor);
     for (k=1; k<=ncor; k++) {
       if(!bin) {
-        MMG_FSCANF(inm,"%d",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -467,9 +531,10 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if(npreq) {
     rewind(inm);
     fseek(inm,posnpreq,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnpreq);
     for (k=1; k<=npreq; k++) {
       if(!bin) {
-        MMG_FSCANF(inm,"%d",&i);
+        MMG5_TXT_READ(&tb,MMG5_txtInt32(&tb,&i));
       }
       else {
         MMG_FREAD(&i,MMG5_SW,1,inm);
@@ -491,10 +556,18 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if ( mesh->na ) {
     rewind(inm);
     fseek(inm,posned,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posned);
+    if ( mb.buf ) cur = mb.buf + posned;
 
     for (k=1; k<=mesh->na; k++) {
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "",&mesh->edge[k].a,&mesh->edge[k].b,&mesh->edge[k].ref);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&mesh->edge[k].a) && MMG5_txtInt(&tb,&mesh->edge[k].b) &&
+                          MMG5_txtInt(&tb,&mesh->edge[k].ref));
+      }
+      else if ( mb.buf ) {
+        mesh->edge[k].a   = MMG5_mapInt(&mb,&cur);
+        mesh->edge[k].b   = MMG5_mapInt(&mb,&cur);
+        mesh->edge[k].ref = MMG5_mapInt(&mb,&cur);
       }
       else {
         MMG_FREAD(&mesh->edge[k].a,MMG5_SW,1,inm);
@@ -517,9 +590,10 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     if ( nri ) {
       rewind(inm);
       fseek(inm,posnr,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnr);
       for (k=1; k<=nri; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId "",&ia);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ia));
         }
         else {
           MMG_FREAD(&ia,MMG5_SW,1,inm);
@@ -538,9 +612,10 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     if ( nedreq ) {
       rewind(inm);
       fseek(inm,posnedreq,SEEK_SET);
+      if ( tb.buf ) MMG5_txtSeek(&tb,posnedreq);
       for (k=1; k<=nedreq; k++) {
         if(!bin) {
-          MMG_FSCANF(inm,"%" MMG5_PRId "",&ia);
+          MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ia));
         }
         else {
           MMG_FREAD(&ia,MMG5_SW,1,inm);
@@ -569,12 +644,13 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
 
     rewind(inm);
     fseek(inm,posnormal,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnormal);
     for (k=1; k<=ng; k++) {
       n = &norm[3*(k-1)+1];
       if ( mesh->ver == 1 ) {
         if (!bin) {
           for (i=0 ; i<3 ; i++) {
-            MMG_FSCANF(inm,"%f",&fc);
+            MMG5_TXT_READ(&tb,MMG5_txtFloat(&tb,&fc));
             n[i] = (double) fc;
           }
         } else {
@@ -587,7 +663,8 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
       }
       else {
         if (!bin) {
-          MMG_FSCANF(inm,"%lf %lf %lf",&n[0],&n[1],&n[2]);
+          MMG5_TXT_READ(&tb,MMG5_txtDouble(&tb,&n[0]) && MMG5_txtDouble(&tb,&n[1]) &&
+                            MMG5_txtDouble(&tb,&n[2]));
         }
         else {
           for (i=0 ; i<3 ; i++) {
@@ -607,10 +684,11 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
 
     rewind(inm);
     fseek(inm,posnc1,SEEK_SET);
+    if ( tb.buf ) MMG5_txtSeek(&tb,posnc1);
 
     for (k=1; k<=mesh->nc1; k++) {
       if (!bin) {
-        MMG_FSCANF(inm,"%" MMG5_PRId " %" MMG5_PRId "",&ip,&idn);
+        MMG5_TXT_READ(&tb,MMG5_txtInt(&tb,&ip) && MMG5_txtInt(&tb,&idn));
       }
       else {
         MMG_FREAD(&ip,MMG5_SW,1,inm);
@@ -638,6 +716,8 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     if ( mesh->na )
       fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "  RIDGES %6" MMG5_PRId "\n",mesh->na,nri);
   }
+  MMG5_unmapMeshb(&mb);
+  MMG5_txtFree(&tb);
   fclose(inm);
   return 1;
 }
@@ -859,11 +939,11 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
   ptr = strstr(data,".mesh");
   if ( !ptr ) {
     strcat(data,".meshb");
-    if( !(inm = fopen(data,"wb")) ) {
+    if( !(inm = MMG5_fopen(data,"wb")) ) {
       ptr  = strstr(data,".mesh");
       *ptr = '\0';
       strcat(data,".mesh");
-      if( !(inm = fopen(data,"w")) ) {
+      if( !(inm = MMG5_fopen(data,"w")) ) {
         MMG5_SAFE_FREE(data);
         return 0;
       }
@@ -875,13 +955,13 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     ptr = strstr(data,".meshb");
     if( ptr ) {
       bin = 1;
-      if( !(inm = fopen(data,"wb")) ) {
+      if( !(inm = MMG5_fopen(data,"wb")) ) {
         fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
         MMG5_SAFE_FREE(data);
         return 0;
       }
     } else {
-      if( !(inm = fopen(data,"w")) ) {
+      if( !(inm = MMG5_fopen(data,"w")) ) {
         fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",data);
         MMG5_SAFE_FREE(data);
         return 0;
@@ -1312,6 +1392,7 @@ int MMGS_saveMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *file
 int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
 
   FILE       *inm;
+  MMG5_TxtBuf tb;
   long        posnp;
   int         iswp,ier,*type,ver,bin,nsols,dim;
   MMG5_int    k,np;
@@ -1361,21 +1442,30 @@ int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
   /* Read mesh solutions */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  tb.buf = NULL;
+  if ( !bin && !MMG5_txtInit(mesh,inm,&tb) ) {
+    fclose(inm);
+    return -1;
+  }
 
   /* isotropic metric */
-  if ( met->ver == 1 ) {
+  if ( !bin ) {
+    MMG5_TXT_READ(&tb,MMG5_txtSols(mesh,&tb,met,1,mesh->np));
+  }
+  else if ( met->ver == 1 ) {
     /* Simple precision */
     for (k=1; k<=mesh->np; k++) {
-      if ( MMG5_readFloatSol3D(met,inm,bin,iswp,k) < 0 ) return -1;
+      if ( MMG5_readFloatSol3D(met,inm,iswp,k) < 0 ) return -1;
     }
   }
   else {
     /* Double precision */
     for (k=1; k<=mesh->np; k++) {
-      if ( MMG5_readDoubleSol3D(met,inm,bin,iswp,k) < 0 ) return -1;
+      if ( MMG5_readDoubleSol3D(met,inm,iswp,k) < 0 ) return -1;
     }
   }
 
+  MMG5_txtFree(&tb);
   fclose(inm);
 
   /* stats */
@@ -1387,6 +1477,7 @@ int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
 int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol   psl;
   FILE        *inm;
+  MMG5_TxtBuf tb;
   long        posnp;
   int         iswp,ier,*type,ver,bin,nsols,dim;
   MMG5_int    j,k,np;
@@ -1453,13 +1544,21 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   /* read mesh solutions */
   rewind(inm);
   fseek(inm,posnp,SEEK_SET);
+  tb.buf = NULL;
+  if ( !bin && !MMG5_txtInit(mesh,inm,&tb) ) {
+    fclose(inm);
+    return -1;
+  }
 
-  if ( (*sol)[0].ver == 1 ) {
+  if ( !bin ) {
+    MMG5_TXT_READ(&tb,MMG5_txtSols(mesh,&tb,*sol,nsols,mesh->np));
+  }
+  else if ( (*sol)[0].ver == 1 ) {
     /* Single precision */
     for (k=1; k<=mesh->np; k++) {
       for ( j=0; j<nsols; ++j ) {
         psl = *sol + j;
-        if ( MMG5_readFloatSol3D(psl,inm,bin,iswp,k) < 0 ) return -1;
+        if ( MMG5_readFloatSol3D(psl,inm,iswp,k) < 0 ) return -1;
       }
     }
   }
@@ -1468,10 +1567,11 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
     for (k=1; k<=mesh->np; k++) {
       for ( j=0; j<nsols; ++j ) {
         psl = *sol + j;
-        if ( MMG5_readDoubleSol3D(psl,inm,bin,iswp,k) < 0 ) return -1;
+        if ( MMG5_readDoubleSol3D(psl,inm,iswp,k) < 0 ) return -1;
       }
     }
   }
+  MMG5_txtFree(&tb);
   fclose(inm);
 
   /* stats */
@@ -1482,6 +1582,7 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
 int MMGS_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE*        inm;
+  MMG5_OutBuf  ob;
   MMG5_pPoint  ppt;
   int          binch,bin,ier;
   MMG5_int     bpos,k;
@@ -1498,12 +1599,24 @@ int MMGS_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
+  if ( !MMG5_outInit(inm,&ob) ) {
+    fclose(inm);
+    return 0;
+  }
+
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
     if ( !MG_VOK(ppt) ) continue;
 
-    MMG5_writeDoubleSol3D(mesh,met,inm,bin,k,1);
-    fprintf(inm,"\n");
+    MMG5_writeDoubleSol3D(mesh,met,&ob,bin,k,1);
+    MMG5_outChar(&ob,'\n');
+  }
+
+  if ( !MMG5_outFree(&ob) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write the solution file.\n",
+            __func__);
+    fclose(inm);
+    return 0;
   }
 
   /* end of file */
@@ -1520,6 +1633,7 @@ int MMGS_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 int MMGS_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol    psl;
   FILE*        inm;
+  MMG5_OutBuf  ob;
   MMG5_pPoint  ppt;
   int          binch,bin,ier,npointSols,ncellSols;
   int          *type,*entities,j,*size;
@@ -1561,6 +1675,14 @@ int MMGS_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
+  if ( !MMG5_outInit(inm,&ob) ) {
+    MMG5_SAFE_FREE(type);
+    MMG5_SAFE_FREE(size);
+    MMG5_SAFE_FREE(entities);
+    fclose(inm);
+    return 0;
+  }
+
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
     if ( !MG_VOK(ppt) )  continue;
@@ -1569,12 +1691,14 @@ int MMGS_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
       psl = *sol + j;
 
       if ( (psl->entities==MMG5_Noentity) || (psl->entities==MMG5_Vertex) ) {
-        MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+        MMG5_writeDoubleSol3D(mesh,psl,&ob,bin,k,0);
       }
     }
-    fprintf(inm,"\n");
+    MMG5_outChar(&ob,'\n');
   }
 
+  MMG5_outFlush(&ob);
+
   MMG5_saveSolAtTrianglesHeader( mesh,inm,(*sol)[0].ver,bin,&bpos,mesh->nsols,
                                  ncellSols,entities,type,size );
 
@@ -1585,16 +1709,23 @@ int MMGS_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
     for ( j=0; j<mesh->nsols; ++j ) {
       psl = *sol + j;
       if ( psl->entities==MMG5_Triangle ) {
-        MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+        MMG5_writeDoubleSol3D(mesh,psl,&ob,bin,k,0);
       }
     }
-    fprintf(inm,"\n");
+    MMG5_outChar(&ob,'\n');
   }
 
   MMG5_SAFE_FREE(type);
   MMG5_SAFE_FREE(size);
   MMG5_SAFE_FREE(entities);
 
+  if ( !MMG5_outFree(&ob) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write the solution file.\n",
+            __func__);
+    fclose(inm);
+    return 0;
+  }
+
   /* End file */
   if(!bin) {
     fprintf(inm,"\n\nEnd\n");
@@ -325,7 +325,7 @@ int MMGS_mmgsls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet)
     met = umet;
   }
 
-  MMGS_Set_commonFunc();
+  MMGS_Set_commonOps(mesh);
 
   /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
    * run */
@@ -341,6 +341,7 @@ int MMGS_mmgsls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet)
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
 #ifdef USE_SCOTCH
   MMG5_warnScotch(mesh);
@@ -443,7 +444,7 @@ int MMGS_mmgsls(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_pSol umet)
    * discretization mesh elements have too bad qualities */
   if ( mesh->info.optim ) {
     /* Mean metric computation */
-    if ( !MMGS_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( mettofree ) { MMG5_DEL_MEM(mesh,met->m);MMG5_SAFE_FREE (met); }
       if ( !MMG5_unscaleMesh(mesh,met,sol) ) {
         _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE); }
@@ -556,7 +557,7 @@ int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
 
   MMG5_version(mesh,"S");
 
-  MMGS_Set_commonFunc();
+  MMGS_Set_commonOps(mesh);
 
   /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
    * run */
@@ -572,6 +573,7 @@ int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
 
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
+  MMG5_startTimeBudget(mesh);
 
   if ( mesh->info.iso || mesh->info.isosurf ) {
     fprintf(stderr,"\n  ## ERROR: LEVEL-SET DISCRETISATION UNAVAILABLE"
@@ -653,7 +655,7 @@ int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
 
   /* specific meshing: optim mode needs normal at vertices */
   if ( mesh->info.optim ) {
-    if ( !MMGS_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( !MMG5_unscaleMesh(mesh,met,NULL) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
       _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
     }
@@ -726,19 +728,29 @@ int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
 }
 
 /**
-* Set common pointer functions between mmgs and mmg3d to the matching mmgs
-* functions.
-*/
-void MMGS_Set_commonFunc(void) {
-    MMG5_bezierCP = MMG5_mmgsBezierCP;
-    MMG5_chkmsh = MMG5_mmgsChkmsh;
-    MMG5_indPt = MMGS_indPt;
-    MMG5_indElt = MMGS_indElt;
-    MMG5_grad2met_ani = MMG5_grad2metSurf;
-    MMG5_grad2metreq_ani = MMG5_grad2metSurfreq;
-    MMG5_solTruncature_ani = MMG5_3dSolTruncature_ani;
+ * \param mesh pointer to the mesh structure.
+ *
+ * Set the operators shared between mmgs and mmg3d to the matching mmgs
+ * functions in the operators table of the mesh.
+ */
+void MMGS_Set_commonOps(MMG5_pMesh mesh) {
+    mesh->ops->bezierCP          = MMG5_mmgsBezierCP;
+    mesh->ops->chkmsh            = MMG5_mmgsChkmsh;
+    mesh->ops->indPt             = MMGS_indPt;
+    mesh->ops->indElt            = MMGS_indElt;
+    mesh->ops->grad2met_ani      = MMG5_grad2metSurf;
+    mesh->ops->grad2metreq_ani   = MMG5_grad2metSurfreq;
+    mesh->ops->solTruncature_ani = MMG5_3dSolTruncature_ani;
 
 #ifdef USE_SCOTCH
-    MMG5_renumbering = MMG5_mmgsRenumbering;
+    mesh->ops->renumbering = MMG5_mmgsRenumbering;
 #endif
 }
+
+/**
+ * Deprecated: the common functions are now stored in the operators table of
+ * each mesh (see MMGS_Set_commonOps).
+ */
+void MMGS_Set_commonFunc(void) {
+  return;
+}
@@ -128,6 +128,7 @@ enum MMGS_Param {
   MMGS_IPARAM_renum,             /*!< [1/0], Turn on/off renumbering with Scotch */
   MMGS_IPARAM_anisosize,         /*!< [1/0], Turn on/off anisotropic metric creation when no metric is provided */
   MMGS_IPARAM_nosizreq,          /*!< [0/1], Allow/avoid overwritings of sizes at required vertices (advanced usage) */
+  MMGS_IPARAM_threads,           /*!< [n], Number of threads used to read the ASCII files (0 for the OpenMP default) */
   MMGS_DPARAM_angleDetection,    /*!< [val], Threshold for angle detection */
   MMGS_DPARAM_hmin,              /*!< [val], Minimal edge length */
   MMGS_DPARAM_hmax,              /*!< [val], Maximal edge length */
@@ -138,6 +139,8 @@ enum MMGS_Param {
   MMGS_DPARAM_ls,                /*!< [val], Function value where the level set is to be discretized */
   MMGS_DPARAM_xreg,              /*!< [val], Relaxation parameter for coordinate regularization (0<val<1) */
   MMGS_DPARAM_rmc,               /*!< [-1/val], Remove small disconnected components in level-set mode */
+  MMGS_DPARAM_timeBudget,        /*!< [val], Wall-clock budget of the remeshing in seconds (0 for no limit) */
+  MMGS_DPARAM_convergence,       /*!< [val], Stop the remeshing waves when they modify less than this fraction of the elements (0 to disable) */
   MMGS_PARAM_size,               /*!< [n], Number of parameters */
 };
 
@@ -2258,8 +2261,8 @@ LIBMMGS_EXPORT int  MMGS_mmgsls(MMG5_pMesh mesh,  MMG5_pSol sol,MMG5_pSol met);
 /**
  * \brief Set function pointers for caltet, lenedg, defsiz and gradsiz.
  *
- * \param mesh pointer to the mesh structure (unused).
- * \param met pointer to the sol structure (unused).
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol structure.
  *
  * \remark Fortran interface:
  * >   SUBROUTINE MMGS_SETFUNC(mesh,met)\n
@@ -2333,6 +2336,9 @@ LIBMMGS_EXPORT void  MMGS_setfunc(MMG5_pMesh mesh,MMG5_pSol met);
  * \param met pointer to the sol structure
  * \return 1 on success
  *
+ * This pointer is not modified by the library: it calls the function matching
+ * the metric type of \a mesh (see \ref MMGS_setfunc).
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE MMGS_DOSOL(mesh,met,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT)     :: mesh,met\n
@@ -2548,8 +2554,9 @@ LIBMMGS_EXPORT void MMGS_Free_solutions(MMG5_pMesh mesh,MMG5_pSol sol);
  LIBMMGS_EXPORT int MMGS_Clean_isoSurf(MMG5_pMesh mesh);
 
 /**
- * \brief Set common function pointers between mmgs and mmg3d to the matching mmgs
- * functions.
+ * \deprecated The common functions between mmgs and mmg3d are now stored in
+ * the operators table of each mesh and set by \ref MMGS_Init_mesh. This
+ * function does nothing and is kept for compatibility.
  */
 LIBMMGS_EXPORT void MMGS_Set_commonFunc(void);
 
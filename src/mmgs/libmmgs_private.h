@@ -191,6 +191,7 @@ void MMGS_keep_only1Subdomain ( MMG5_pMesh mesh,MMG5_int nsd );
 /* useful functions to debug */
 MMG5_int  MMGS_indElt(MMG5_pMesh mesh,MMG5_int kel);
 MMG5_int  MMGS_indPt(MMG5_pMesh mesh,MMG5_int kp);
+void      MMGS_Set_commonOps(MMG5_pMesh mesh);
 
 /* function pointers */
 
@@ -42,16 +42,16 @@
 
 void MMGS_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( (!mesh->info.ani) && ((!met) || (met->size < 6)) ) {
-    MMG5_calelt      = MMG5_caltri_iso;
-    MMGS_doSol       = MMGS_doSol_iso;
-    MMG5_lenSurfEdg  = MMG5_lenSurfEdg_iso;
-    MMG5_compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_iso;
-    MMGS_defsiz      = MMGS_defsiz_iso;
-    MMGS_gradsiz     = MMG5_gradsiz_iso;
-    MMGS_gradsizreq  = MMG5_gradsizreq_iso;
-    intmet           = intmet_iso;
-    movintpt         = movintpt_iso;
-    movridpt         = movridpt_iso;
+    mesh->ops->caltri     = MMG5_caltri_iso;
+    mesh->ops->doSol      = MMGS_doSol_iso;
+    mesh->ops->lenSurfEdg = MMG5_lenSurfEdg_iso;
+    mesh->ops->compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_iso;
+    mesh->ops->defsiz     = MMGS_defsiz_iso;
+    mesh->ops->gradsiz    = MMG5_gradsiz_iso;
+    mesh->ops->gradsizreq = MMG5_gradsizreq_iso;
+    mesh->ops->intmet     = intmet_iso;
+    mesh->ops->movintpt_s = movintpt_iso;
+    mesh->ops->movridpt_s = movridpt_iso;
   }
   else {
     /* Force data consistency: if aniso metric is provided, met->size==6 and
@@ -61,22 +61,22 @@ void MMGS_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
 
     /* Set function pointers */
     if ( (!met->m) && (!mesh->info.optim) && mesh->info.hsiz<=0. ) {
-      MMG5_calelt     = MMG5_caltri_iso;
-      MMGS_doSol      = MMGS_doSol_iso;
-      MMG5_lenSurfEdg = MMG5_lenSurfEdg_iso;
+      mesh->ops->caltri     = MMG5_caltri_iso;
+      mesh->ops->doSol      = MMGS_doSol_iso;
+      mesh->ops->lenSurfEdg = MMG5_lenSurfEdg_iso;
     }
     else {
-      MMG5_calelt     = MMG5_caltri_ani;
-      MMGS_doSol      = MMGS_doSol_ani;
-      MMG5_lenSurfEdg = MMG5_lenSurfEdg_ani;
+      mesh->ops->caltri     = MMG5_caltri_ani;
+      mesh->ops->doSol      = MMGS_doSol_ani;
+      mesh->ops->lenSurfEdg = MMG5_lenSurfEdg_ani;
     }
-    MMG5_compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_ani;
-    MMGS_defsiz      = MMGS_defsiz_ani;
-    MMGS_gradsiz     = MMGS_gradsiz_ani;
-    MMGS_gradsizreq  = MMG5_gradsizreq_ani;
-    intmet        = intmet_ani;
-    movintpt      = movintpt_ani;
-    movridpt      = movridpt_ani;
+    mesh->ops->compute_meanMetricAtMarkedPoints = MMG5_compute_meanMetricAtMarkedPoints_ani;
+    mesh->ops->defsiz     = MMGS_defsiz_ani;
+    mesh->ops->gradsiz    = MMGS_gradsiz_ani;
+    mesh->ops->gradsizreq = MMG5_gradsizreq_ani;
+    mesh->ops->intmet     = intmet_ani;
+    mesh->ops->movintpt_s = movintpt_ani;
+    mesh->ops->movridpt_s = movridpt_ani;
   }
 }
 
@@ -94,6 +94,12 @@ int MMGS_usage(char *prog) {
 #ifdef USE_SCOTCH
   fprintf(stdout,"-rn [n]      Turn on or off the renumbering using SCOTCH [0/1] \n");
 #endif
+#ifdef USE_OPENMP
+  fprintf(stdout,"-nt val      number of threads to read ASCII files (0: OpenMP default)\n");
+#endif
+  fprintf(stdout,"-tbudget val wall-clock budget of the remeshing in seconds\n");
+  fprintf(stdout,"-conv    val stop the remeshing waves when they modify less than\n"
+          "             this fraction of the elements\n");
 
   fprintf(stdout,"\n");
 
@@ -116,6 +122,16 @@ int MMGS_defaultValues(MMG5_pMesh mesh) {
 #else
   fprintf(stdout,"SCOTCH renumbering                  : disabled\n");
 #endif
+#ifdef USE_OPENMP
+  fprintf(stdout,"Number of threads (-nt)             : %d\n",
+          mesh->info.nthreads);
+#endif
+  fprintf(stdout,"Time budget (-tbudget)              : ");
+  if ( mesh->info.tbudget > 0. )
+    fprintf(stdout,"%gs\n",mesh->info.tbudget);
+  else
+    fprintf(stdout,"none\n");
+  fprintf(stdout,"Convergence threshold (-conv)       : %g\n",mesh->info.conv);
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -171,6 +187,20 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol so
         if ( !MMGS_Set_solSize(mesh,met,MMG5_Vertex,0,MMG5_Tensor) )
           return 0;
         break;
+      case 'c':
+        if ( !strcmp(argv[i],"-conv") ) {
+          if ( ++i < argc ) {
+            val = strtof(argv[i],&endptr);
+          }
+          if ( i >= argc || endptr != &(argv[i][strlen(argv[i])]) ) {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            MMGS_usage(argv[0]);
+            return 0;
+          }
+          if ( !MMGS_Set_dparameter(mesh,met,MMGS_DPARAM_convergence,val) )
+            return 0;
+        }
+        break;
       case 'f':
         if ( !strcmp(argv[i],"-f") ) {
           if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
@@ -343,6 +373,19 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol so
             return 0;
           }
         }
+#ifdef USE_OPENMP
+        else if ( !strcmp(argv[i],"-nt") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMGS_Set_iparameter(mesh,met,MMGS_IPARAM_threads,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            MMGS_usage(argv[0]);
+            return 0;
+          }
+        }
+#endif
         else if ( !strcmp(argv[i],"-noswap") ) {
           if ( !MMGS_Set_iparameter(mesh,met,MMGS_IPARAM_noswap,1) )
             return 0;
@@ -441,6 +484,20 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol so
           }
         }
         break;
+      case 't':
+        if ( !strcmp(argv[i],"-tbudget") ) {
+          if ( ++i < argc ) {
+            val = strtof(argv[i],&endptr);
+          }
+          if ( i >= argc || endptr != &(argv[i][strlen(argv[i])]) ) {
+            fprintf(stderr,"\nMissing argument option %s\n",argv[i-1]);
+            MMGS_usage(argv[0]);
+            return 0;
+          }
+          if ( !MMGS_Set_dparameter(mesh,met,MMGS_DPARAM_timeBudget,val) )
+            return 0;
+        }
+        break;
       case 'v':
         if ( ++i < argc ) {
           if ( argv[i][0] == '-' || isdigit(argv[i][0]) ) {
@@ -836,7 +893,7 @@ int MMGS_solTruncatureForOptim(MMG5_pMesh mesh, MMG5_pSol met,int ani) {
     ier = MMG5_solTruncature_iso(mesh,met);
   }
   else {
-    MMG5_solTruncature_ani = MMG5_3dSolTruncature_ani;
+    mesh->ops->solTruncature_ani = MMG5_3dSolTruncature_ani;
     ier = MMG5_3dSolTruncature_ani(mesh,met);
   }
 
@@ -272,7 +272,7 @@ int MMGS_defaultOption(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol) {
   double    hsiz;
   char      stim[32];
 
-  MMGS_Set_commonFunc();
+  MMGS_Set_commonOps(mesh);
 
   signal(SIGABRT,MMG5_excfun);
   signal(SIGFPE,MMG5_excfun);
@@ -327,7 +327,7 @@ int MMGS_defaultOption(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol) {
 
   /* Specific meshing + hmin/hmax update */
   if ( mesh->info.optim ) {
-    if ( !MMGS_doSol(mesh,met) ) {
+    if ( !mesh->ops->doSol(mesh,met) ) {
       if ( !MMG5_unscaleMesh(mesh,met,sol) )   _LIBMMG5_RETURN(mesh,met,sol,MMG5_STRONGFAILURE);
         _LIBMMG5_RETURN(mesh,met,sol,MMG5_LOWFAILURE);
     }
@@ -373,7 +373,6 @@ int main(int argc,char *argv[]) {
   fprintf(stdout,"     %s %s\n",__DATE__,__TIME__);
 #endif
 
-  MMGS_Set_commonFunc();
 
   /* Print timer at exit */
   atexit(MMG5_endcod);
@@ -391,6 +391,7 @@ int chkedg(MMG5_pMesh mesh,MMG5_int iel) {
 }
 
 /**
+ * \param mesh pointer to mesh structure
  * \param met pointer to met structure
  * \param typchk type of check to perform: 1 for first stage (adaptation to
  * capture roughly the surface mesh), 2 for second stage of adaptation
@@ -403,7 +404,7 @@ int chkedg(MMG5_pMesh mesh,MMG5_int iel) {
  *
  */
 static inline
-void MMGS_set_localFunc ( MMG5_pSol met, int8_t typchk,
+void MMGS_set_localFunc ( MMG5_pMesh mesh,MMG5_pSol met, int8_t typchk,
                           double (**MMGS_lenEdg)(MMG5_pMesh,MMG5_pSol,MMG5_int ,MMG5_int,int8_t),
                           double (**MMGS_caltri)(MMG5_pMesh,MMG5_pSol,MMG5_pTria)) {
 
@@ -413,8 +414,8 @@ void MMGS_set_localFunc ( MMG5_pSol met, int8_t typchk,
       *MMGS_caltri = MMG5_caltri33_ani;
     }
     else if ( typchk == 2 ) {
-      *MMGS_lenEdg = MMG5_lenSurfEdg;
-      *MMGS_caltri = MMG5_calelt;
+      *MMGS_lenEdg = mesh->ops->lenSurfEdg;
+      *MMGS_caltri = mesh->ops->caltri;
     }
     else {
       *MMGS_lenEdg = MMG5_lenSurfEdg_iso;
@@ -436,7 +437,7 @@ static int swpmsh(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
   double (*MMGS_lenEdg)(MMG5_pMesh mesh,MMG5_pSol sol ,MMG5_int ,MMG5_int, int8_t ) = NULL;
   double (*MMGS_caltri)(MMG5_pMesh mesh,MMG5_pSol sol ,MMG5_pTria pt ) = MMG5_caltri_iso;
 
-  MMGS_set_localFunc ( met, typchk, &MMGS_lenEdg, &MMGS_caltri);
+  MMGS_set_localFunc ( mesh,met, typchk, &MMGS_lenEdg, &MMGS_caltri);
 
   it = nns = 0;
   maxit = 2;
@@ -1036,7 +1037,7 @@ static MMG5_int colelt(MMG5_pMesh mesh,MMG5_pSol met,int8_t typchk) {
   double (*MMGS_lenEdg)(MMG5_pMesh mesh,MMG5_pSol sol ,MMG5_int ,MMG5_int, int8_t ) = NULL;
   double (*MMGS_caltri)(MMG5_pMesh mesh,MMG5_pSol sol ,MMG5_pTria pt ) = MMG5_caltri_iso;
 
-  MMGS_set_localFunc ( met, typchk, &MMGS_lenEdg, &MMGS_caltri);
+  MMGS_set_localFunc ( mesh,met, typchk, &MMGS_lenEdg, &MMGS_caltri);
 
   nc = 0;
   for (k=1; k<=mesh->nt; k++) {
@@ -1240,7 +1241,7 @@ static MMG5_int adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
       else if ( p1->tag > p2->tag || p1->tag > pt->tag[i] )  continue;
 
       /* check if geometry preserved */
-      ilist = chkcol(mesh,met,k,i,list,2,MMG5_lenSurfEdg,MMG5_calelt);
+      ilist = chkcol(mesh,met,k,i,list,2,mesh->ops->lenSurfEdg,mesh->ops->caltri);
 
       int8_t open = (mesh->adja[3*(k-1)+1+i] == 0);
 
@@ -1326,6 +1327,10 @@ static int adptri(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int* permNodGlob) {
       fprintf(stdout,"     %8" MMG5_PRId " splitted, %8" MMG5_PRId " collapsed, %8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",ns,nc,nf,nm);
     if ( ns < 10 && MMG5_abs(nc-ns) < 3 )  break;
     else if ( it > 3 && MMG5_abs(nc-ns) < 0.3 * MG_MAX(nc,ns) )  break;
+
+    /* time budget exhausted or few modified elements */
+    if ( MMG5_outOfTime(mesh) || MMG5_converged(mesh,ns+nc+nf+nm,mesh->nt) )
+      break;
   }
   while( ++it < maxit && nc+ns > 0 );
 
@@ -1337,6 +1342,8 @@ static int adptri(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int* permNodGlob) {
   it  = 0;
   maxit = 2;
   do {
+    /* time budget exhausted: the mesh is valid, skip the remaining waves */
+    if ( MMG5_outOfTime(mesh) )  break;
 
     if ( !mesh->info.nomove ) {
       nm = movtri(mesh,met,5);
@@ -1362,10 +1369,12 @@ static int adptri(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int* permNodGlob) {
       fprintf(stdout,"                                            ");
       fprintf(stdout,"%8" MMG5_PRId " swapped, %8" MMG5_PRId " moved\n",nf,nm);
     }
+
+    if ( MMG5_converged(mesh,nf+nm,mesh->nt) )  break;
   }
   while( ++it < maxit && nm+nf > 0 );
 
-  if ( !mesh->info.nomove ) {
+  if ( !mesh->info.nomove && !MMG5_outOfTime(mesh) ) {
     nm = movtri(mesh,met,5);
     if ( nm < 0 ) {
       fprintf(stderr,"\n  ## Unable to improve mesh.\n");
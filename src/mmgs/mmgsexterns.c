@@ -1,9 +1,20 @@
-#include "libmmgtypes.h"
+#include "libmmgs.h"
+#include "libmmgs_private.h"
 #include "mmgs_export.h"
 
-#define MMG_EXTERN
-#define MMG_ASSIGN_NULL =NULL
+/**
+ * \param mesh pointer to the mesh structure.
+ * \param met pointer to the sol structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Compute the size map with the function of the operators table of the mesh
+ * (the table is filled if \ref MMGS_setfunc has not been called).
+ *
+ */
+static int MMGS_doSol_mesh(MMG5_pMesh mesh,MMG5_pSol met) {
+  if ( !mesh->ops->doSol ) MMGS_setfunc(mesh,met);
+  return mesh->ops->doSol(mesh,met);
+}
 
-#include  "mmgsexterns_private.h"
-
-LIBMMGS_EXPORT int (*MMGS_doSol)(MMG5_pMesh mesh,MMG5_pSol met)=NULL;
+/* Legacy pointer: it is set once here and never modified by the library */
+LIBMMGS_EXPORT int (*MMGS_doSol)(MMG5_pMesh mesh,MMG5_pSol met)=MMGS_doSol_mesh;
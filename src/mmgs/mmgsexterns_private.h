@@ -4,20 +4,16 @@
 #include "libmmgtypes.h"
 #include "mmgcommon_private.h"
 
-#ifndef MMG_EXTERN
-#define MMG_EXTERN extern
-#define MMG_ASSIGN_NULL
-#endif
-
-FUNCTION_POINTER ( double (*MMG5_calelt)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt) );
-FUNCTION_POINTER ( int    (*MMGS_defsiz)(MMG5_pMesh mesh,MMG5_pSol met) );
-FUNCTION_POINTER ( int    (*MMGS_gradsiz)(MMG5_pMesh mesh,MMG5_pSol met) );
-FUNCTION_POINTER ( int    (*MMGS_gradsizreq)(MMG5_pMesh mesh,MMG5_pSol met) );
-FUNCTION_POINTER ( int    (*intmet)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int8_t i,MMG5_int ip,double s) );
-FUNCTION_POINTER ( int    (*movintpt)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist) );
-FUNCTION_POINTER ( int    (*movridpt)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist) );
-
-#undef MMG_EXTERN
-#undef MMG_ASSIGN_NULL
+/**
+ * Operators of the \ref MMG5_Ops table of the mesh that are used by mmgs
+ * (filled by MMGS_setfunc).
+ */
+#define MMG5_calelt(mesh,...)       (mesh)->ops->caltri(mesh,__VA_ARGS__)
+#define MMGS_defsiz(mesh,...)       (mesh)->ops->defsiz(mesh,__VA_ARGS__)
+#define MMGS_gradsiz(mesh,...)      (mesh)->ops->gradsiz(mesh,__VA_ARGS__)
+#define MMGS_gradsizreq(mesh,...)   (mesh)->ops->gradsizreq(mesh,__VA_ARGS__)
+#define intmet(mesh,...)            (mesh)->ops->intmet(mesh,__VA_ARGS__)
+#define movintpt(mesh,...)          (mesh)->ops->movintpt_s(mesh,__VA_ARGS__)
+#define movridpt(mesh,...)          (mesh)->ops->movridpt_s(mesh,__VA_ARGS__)
 
 #endif
@@ -55,8 +55,12 @@ static inline
 int MMGS_Alloc_mesh(MMG5_pMesh *mesh, MMG5_pSol *met, MMG5_pSol *ls) {
 
   /* mesh allocation */
-  if ( *mesh )  MMG5_SAFE_FREE(*mesh);
+  if ( *mesh ) {
+    MMG5_SAFE_FREE((*mesh)->ops);
+    MMG5_SAFE_FREE(*mesh);
+  }
   MMG5_SAFE_CALLOC(*mesh,1,MMG5_Mesh,return 0);
+  MMG5_SAFE_CALLOC((*mesh)->ops,1,MMG5_Ops,MMG5_SAFE_FREE(*mesh);return 0);
 
  /* metric allocation */
   if ( met ) {
@@ -85,7 +89,7 @@ int MMGS_Alloc_mesh(MMG5_pMesh *mesh, MMG5_pSol *met, MMG5_pSol *ls) {
 static inline
 void MMGS_Init_woalloc_mesh(MMG5_pMesh mesh, MMG5_pSol *met,MMG5_pSol *ls ) {
 
-  MMGS_Set_commonFunc();
+  MMGS_Set_commonOps(mesh);
 
   (mesh)->dim   = 3;
   (mesh)->ver   = 2;
@@ -290,6 +294,7 @@ int MMGS_Free_all_var(va_list argptr)
     MMG5_DEL_MEM(*mesh,*sols);
   }
 
+  MMG5_SAFE_FREE((*mesh)->ops);
   MMG5_SAFE_FREE(*mesh);
 
   return 1;